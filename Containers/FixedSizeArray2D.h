@@ -0,0 +1,235 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+
+/// Holds code related to containers/collections.
+namespace CONTAINERS
+{
+    /// A 2D array whose dimensions are known at compile time.
+    /// Unlike Array2D, elements are stored inline rather than on the heap,
+    /// so these arrays can be created, copied, and destroyed without any memory allocations
+    /// and can be used in constant expressions.  Elements are aligned to 16 bytes so that
+    /// rows of 4-byte elements can be directly loaded into SIMD registers.
+    ///
+    /// Element access mirrors Array2D, so code can switch between the classes
+    /// without changes beyond the declared type.
+    /// @tparam T - The type of data to store in the array.
+    /// @tparam WIDTH - The width (number of columns) in the array.
+    /// @tparam HEIGHT - The height (number of rows) in the array.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    class FixedSizeArray2D
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The total number of elements in the array.
+        static constexpr std::size_t ELEMENT_COUNT = static_cast<std::size_t>(WIDTH) * static_cast<std::size_t>(HEIGHT);
+        /// The alignment of the elements in bytes.
+        static constexpr std::size_t ALIGNMENT_IN_BYTES = 16;
+
+        // CONSTRUCTION.
+        /// Default constructor to create an array of value-initialized elements.
+        constexpr explicit FixedSizeArray2D() = default;
+        constexpr explicit FixedSizeArray2D(const std::initializer_list<T>& data);
+
+        // COMPARISON OPERATORS.
+        constexpr bool operator==(const FixedSizeArray2D& rhs) const;
+        constexpr bool operator!=(const FixedSizeArray2D& rhs) const;
+
+        // DIMENSION ACCESS.
+        constexpr unsigned int GetWidth() const;
+        constexpr unsigned int GetHeight() const;
+        constexpr void Fill(const T& value);
+
+        // BOUNDS CHECKING.
+        constexpr bool IndicesInRange(const unsigned int x, const unsigned int y) const;
+
+        // ELEMENT ACCESS.
+        constexpr T& operator()(const unsigned int x, const unsigned int y);
+        constexpr const T& operator()(const unsigned int x, const unsigned int y) const;
+        constexpr const T* ValuesInRowMajorOrder() const;
+        constexpr T* ValuesInRowMajorOrder();
+        constexpr std::array<T, ELEMENT_COUNT> ValuesInColumnMajorOrder() const;
+
+    private:
+        // HELPER METHODS.
+        constexpr std::size_t Get1DArrayIndex(const unsigned int x, const unsigned int y) const;
+
+        // MEMBER VARIABLES.
+        /// The raw data in the array, stored in the same order as Array2D.
+        /// Data is stored starting with the top row, going down to lower rows.
+        /// Within each row, each element is stored from left to right.
+        alignas(ALIGNMENT_IN_BYTES) std::array<T, ELEMENT_COUNT> Data = {};
+    };
+
+    /// Constructor to fill the array with the provided data.
+    /// @param[in]  data - The data to fill in the array.  The data should
+    ///     be ordered such that the first width number of elements are
+    ///     for the first row, with subsequent rows following.  Within
+    ///     each row, elements should go from left to right across columns.
+    /// @throws std::invalid_argument - Thrown if the data's size does
+    ///     not match the size indicated by the width and height.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    constexpr FixedSizeArray2D<T, WIDTH, HEIGHT>::FixedSizeArray2D(const std::initializer_list<T>& data)
+    {
+        // MAKE SURE THE SIZE OF THE DATA IS VALID.
+        bool enough_data_provided = (ELEMENT_COUNT == data.size());
+        if (!enough_data_provided)
+        {
+            throw std::invalid_argument("Insufficient data elements provided to FixedSizeArray2D.");
+        }
+
+        // COPY THE DATA.
+        std::size_t element_index = 0;
+        for (const T& value : data)
+        {
+            Data[element_index] = value;
+            ++element_index;
+        }
+    }
+
+    /// Equality operator.
+    /// @param[in]  rhs - The array to compare with.
+    /// @return True if this array and the provided array are equal; false otherwise.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    constexpr bool FixedSizeArray2D<T, WIDTH, HEIGHT>::operator==(const FixedSizeArray2D& rhs) const
+    {
+        return Data == rhs.Data;
+    }
+
+    /// Inequality operator.
+    /// @param[in]  rhs - The array to compare with.
+    /// @return True if this array and the provided array aren't equal; false otherwise.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    constexpr bool FixedSizeArray2D<T, WIDTH, HEIGHT>::operator!=(const FixedSizeArray2D& rhs) const
+    {
+        bool arrays_equal = ((*this) == rhs);
+        return !arrays_equal;
+    }
+
+    /// Gets the width (number of columns) in the array.
+    /// @return The width of the array.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    constexpr unsigned int FixedSizeArray2D<T, WIDTH, HEIGHT>::GetWidth() const
+    {
+        return WIDTH;
+    }
+
+    /// Gets the height (number of rows) in the array.
+    /// @return The height of the array.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    constexpr unsigned int FixedSizeArray2D<T, WIDTH, HEIGHT>::GetHeight() const
+    {
+        return HEIGHT;
+    }
+
+    /// Fills the array with the specified value.
+    /// @param[in]  value - The value to fill the array with.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    constexpr void FixedSizeArray2D<T, WIDTH, HEIGHT>::Fill(const T& value)
+    {
+        Data.fill(value);
+    }
+
+    /// Determines if the provided indices are in range of this array's bounds.
+    /// @param[in]  x - The horizontal coordinate (or column) to check.
+    /// @param[in]  y - The vertical coordinate (or row) to check.
+    /// @return True if both indices are in range; false otherwise.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    constexpr bool FixedSizeArray2D<T, WIDTH, HEIGHT>::IndicesInRange(const unsigned int x, const unsigned int y) const
+    {
+        // CHECK IF BOTH INDICES ARE IN BOUNDS.
+        bool x_within_bounds = (x < WIDTH);
+        bool y_within_bounds = (y < HEIGHT);
+        bool indices_within_bounds = (x_within_bounds && y_within_bounds);
+        return indices_within_bounds;
+    }
+
+    /// Retrieves a reference to the element at the specified 2D coordinates.
+    /// @param[in]  x - The horizontal coordinate (or column) of the element to retrieve.
+    /// @param[in]  y - The vertical coordinate (or row) of the element to retrieve.
+    /// @return A reference to the element at the specified 2D position.
+    /// @throws std::out_of_range - Thrown if the coordinates are out of range
+    ///     of the array's bounds.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    constexpr T& FixedSizeArray2D<T, WIDTH, HEIGHT>::operator()(const unsigned int x, const unsigned int y)
+    {
+        std::size_t element_index = Get1DArrayIndex(x, y);
+        return Data[element_index];
+    }
+
+    /// Retrieves a constant reference to the element at the specified 2D coordinates.
+    /// @param[in]  x - The horizontal coordinate (or column) of the element to retrieve.
+    /// @param[in]  y - The vertical coordinate (or row) of the element to retrieve.
+    /// @return A constant reference to the element at the specified 2D position.
+    /// @throws std::out_of_range - Thrown if the coordinates are out of range
+    ///     of the array's bounds.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    constexpr const T& FixedSizeArray2D<T, WIDTH, HEIGHT>::operator()(const unsigned int x, const unsigned int y) const
+    {
+        std::size_t element_index = Get1DArrayIndex(x, y);
+        return Data[element_index];
+    }
+
+    /// Gets the values in the array in row-major order
+    /// (all values for each row before the next row).
+    /// @return The array values in row-major order.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    constexpr const T* FixedSizeArray2D<T, WIDTH, HEIGHT>::ValuesInRowMajorOrder() const
+    {
+        return Data.data();
+    }
+
+    /// Gets the values in the array in row-major order
+    /// (all values for each row before the next row).
+    /// @return The array values in row-major order.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    constexpr T* FixedSizeArray2D<T, WIDTH, HEIGHT>::ValuesInRowMajorOrder()
+    {
+        return Data.data();
+    }
+
+    /// Gets a copy of the values in the array in column-major order
+    /// (all values for each column before the next column).
+    /// @return The array values in column-major order.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    constexpr std::array<T, FixedSizeArray2D<T, WIDTH, HEIGHT>::ELEMENT_COUNT> FixedSizeArray2D<T, WIDTH, HEIGHT>::ValuesInColumnMajorOrder() const
+    {
+        std::array<T, ELEMENT_COUNT> values_in_column_major_order = {};
+
+        std::size_t column_major_index = 0;
+        for (unsigned int column_index = 0; column_index < WIDTH; ++column_index)
+        {
+            for (unsigned int row_index = 0; row_index < HEIGHT; ++row_index)
+            {
+                values_in_column_major_order[column_major_index] = (*this)(column_index, row_index);
+                ++column_major_index;
+            }
+        }
+
+        return values_in_column_major_order;
+    }
+
+    /// Converts the provided 2D coordinates to a 1D array index.
+    /// @param[in]  x - The horizontal coordinate (or column) of the element index.
+    /// @param[in]  y - The vertical coordinate (or row) of the element index.
+    /// @return The 1D array index for the provided 2D coordinates.
+    /// @throws std::out_of_range - Thrown if the coordinates are out of range
+    ///     of the array's bounds.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    constexpr std::size_t FixedSizeArray2D<T, WIDTH, HEIGHT>::Get1DArrayIndex(const unsigned int x, const unsigned int y) const
+    {
+        // MAKE SURE THE COORDINATES ARE WITHIN THE ARRAY'S BOUNDS.
+        bool coordinates_within_bounds = IndicesInRange(x, y);
+        if (!coordinates_within_bounds)
+        {
+            throw std::out_of_range("FixedSizeArray2D coordinates out-of-range.");
+        }
+
+        // CALCULATE THE INDEX OF THE ELEMENT.
+        std::size_t element_index = (static_cast<std::size_t>(y) * WIDTH) + x;
+        return element_index;
+    }
+}
@@ -2,3 +2,4 @@
 #include <catch.hpp>
 #include "Array2DTests.h"
 #include "ContainerTests.h"
+#include "FixedSizeArray2DTests.h"
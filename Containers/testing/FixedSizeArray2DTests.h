@@ -0,0 +1,96 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include "Containers/FixedSizeArray2D.h"
+
+/// A namespace for testing the FixedSizeArray2D class.
+namespace FIXED_SIZE_ARRAY_2D_TESTS
+{
+    TEST_CASE("A fixed-size array can be constructed with initial data.", "[FixedSizeArray2D]")
+    {
+        // CREATE A 2D ARRAY.
+        constexpr unsigned int WIDTH = 3;
+        constexpr unsigned int HEIGHT = 2;
+        CONTAINERS::FixedSizeArray2D<int, WIDTH, HEIGHT> array_2d({
+            1, 2, 3,
+            4, 5, 6 });
+
+        // VALIDATE THE DIMENSIONS.
+        REQUIRE(WIDTH == array_2d.GetWidth());
+        REQUIRE(HEIGHT == array_2d.GetHeight());
+
+        // VALIDATE THE DATA.
+        REQUIRE(1 == array_2d(0, 0));
+        REQUIRE(2 == array_2d(1, 0));
+        REQUIRE(3 == array_2d(2, 0));
+        REQUIRE(4 == array_2d(0, 1));
+        REQUIRE(5 == array_2d(1, 1));
+        REQUIRE(6 == array_2d(2, 1));
+
+        const std::array<int, 6> EXPECTED_VALUES_IN_COLUMN_MAJOR_ORDER = { 1, 4, 2, 5, 3, 6 };
+        REQUIRE(EXPECTED_VALUES_IN_COLUMN_MAJOR_ORDER == array_2d.ValuesInColumnMajorOrder());
+    }
+
+    TEST_CASE("An exception is thrown if an attempt is made to construct a fixed-size array with insufficient initial data.", "[FixedSizeArray2D]")
+    {
+        bool exception_thrown = false;
+        try
+        {
+            // CREATE A 2D ARRAY WITHOUT ENOUGH INITIAL DATA.
+            CONTAINERS::FixedSizeArray2D<int, 3, 2> array_2d({
+                1, 2, 3,
+                4, 5 });
+        }
+        catch (const std::exception&)
+        {
+            exception_thrown = true;
+        }
+
+        // VALIDATE AN EXCEPTION WAS THROWN.
+        REQUIRE(exception_thrown);
+    }
+
+    TEST_CASE("An exception is thrown when accessing fixed-size array elements out of range.", "[FixedSizeArray2D]")
+    {
+        CONTAINERS::FixedSizeArray2D<int, 4, 3> array_2d;
+
+        REQUIRE_THROWS_AS(array_2d(4, 0), std::out_of_range);
+        REQUIRE_THROWS_AS(array_2d(0, 3), std::out_of_range);
+    }
+
+    TEST_CASE("Fixed-size arrays with different data aren't equal.", "[FixedSizeArray2D]")
+    {
+        // CREATE TWO ARRAYS WITH DIFFERENT DATA.
+        CONTAINERS::FixedSizeArray2D<int, 4, 3> first_array_2d;
+        CONTAINERS::FixedSizeArray2D<int, 4, 3> second_array_2d;
+        REQUIRE(first_array_2d == second_array_2d);
+
+        first_array_2d(3, 2) = 7;
+        second_array_2d(3, 2) = 8;
+
+        // MAKE SURE THE ARRAYS AREN'T EQUAL.
+        REQUIRE(first_array_2d != second_array_2d);
+    }
+
+    TEST_CASE("A fixed-size array is aligned and can be used in constant expressions.", "[FixedSizeArray2D]")
+    {
+        // CREATE AND FILL AN ARRAY AT COMPILE TIME.
+        constexpr CONTAINERS::FixedSizeArray2D<float, 4, 4> ARRAY_2D = []()
+        {
+            CONTAINERS::FixedSizeArray2D<float, 4, 4> array_2d;
+            array_2d.Fill(2.0f);
+            array_2d(1, 3) = 5.0f;
+            return array_2d;
+        }();
+
+        // VERIFY THE ARRAY.
+        STATIC_REQUIRE(2.0f == ARRAY_2D(0, 0));
+        STATIC_REQUIRE(5.0f == ARRAY_2D(1, 3));
+        STATIC_REQUIRE(alignof(CONTAINERS::FixedSizeArray2D<float, 4, 4>) >= 16);
+
+        std::uintptr_t values_address = reinterpret_cast<std::uintptr_t>(ARRAY_2D.ValuesInRowMajorOrder());
+        REQUIRE(0 == values_address % 16);
+    }
+}
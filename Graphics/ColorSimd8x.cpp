@@ -0,0 +1,191 @@
+#include <cstddef>
+#include "Graphics/ColorSimd8x.h"
+
+namespace GRAPHICS
+{
+    /// Loads a single color into all 8 colors of SIMD format.
+    /// @param[in]  color - The color to load.
+    /// @return The color in SIMD format.
+    SIMD_TARGET_AVX2 ColorSimd8x ColorSimd8x::Load(const Color& color)
+    {
+        ColorSimd8x colors;
+        colors.Red = _mm256_set1_ps(color.Red);
+        colors.Green = _mm256_set1_ps(color.Green);
+        colors.Blue = _mm256_set1_ps(color.Blue);
+        colors.Alpha = _mm256_set1_ps(color.Alpha);
+        return colors;
+    }
+
+    /// Unpacks 8 colors from a packed color format.
+    /// @param[in]  packed_colors - The 8 packed 32-bit colors to unpack.
+    /// @param[in]  color_format - The format of data in the packed colors.
+    /// @return The unpacked colors.
+    SIMD_TARGET_AVX2 ColorSimd8x ColorSimd8x::Unpack(const __m256i packed_colors, const ColorFormat color_format)
+    {
+        // DETERMINE THE BIT OFFSETS OF EACH COMPONENT BASED ON THE COLOR FORMAT.
+        int red_bit_shift = 0;
+        int green_bit_shift = 0;
+        int blue_bit_shift = 0;
+        int alpha_bit_shift = 0;
+        switch (color_format)
+        {
+            case ColorFormat::RGBA:
+                red_bit_shift = 24;
+                green_bit_shift = 16;
+                blue_bit_shift = 8;
+                alpha_bit_shift = 0;
+                break;
+            case ColorFormat::ARGB:
+                alpha_bit_shift = 24;
+                red_bit_shift = 16;
+                green_bit_shift = 8;
+                blue_bit_shift = 0;
+                break;
+            default:
+                // RETURN A DEFAULT COLOR.
+                return Load(Color::BLACK);
+        }
+
+        // EXTRACT EACH 8-BIT COMPONENT.
+        const __m256i COMPONENT_BYTE_MASK = _mm256_set1_epi32(0xFF);
+        __m256i red_as_integers = _mm256_and_si256(_mm256_srlv_epi32(packed_colors, _mm256_set1_epi32(red_bit_shift)), COMPONENT_BYTE_MASK);
+        __m256i green_as_integers = _mm256_and_si256(_mm256_srlv_epi32(packed_colors, _mm256_set1_epi32(green_bit_shift)), COMPONENT_BYTE_MASK);
+        __m256i blue_as_integers = _mm256_and_si256(_mm256_srlv_epi32(packed_colors, _mm256_set1_epi32(blue_bit_shift)), COMPONENT_BYTE_MASK);
+        __m256i alpha_as_integers = _mm256_and_si256(_mm256_srlv_epi32(packed_colors, _mm256_set1_epi32(alpha_bit_shift)), COMPONENT_BYTE_MASK);
+
+        // SCALE THE COLOR COMPONENTS FROM RANGE [0,255] to [0,1].
+        // Division is used rather than multiplication by a reciprocal to exactly match the non-SIMD conversion.
+        const __m256 MAX_INTEGRAL_COLOR_COMPONENT = _mm256_set1_ps(Color::MAX_INTEGRAL_COLOR_COMPONENT);
+        ColorSimd8x colors;
+        colors.Red = _mm256_div_ps(_mm256_cvtepi32_ps(red_as_integers), MAX_INTEGRAL_COLOR_COMPONENT);
+        colors.Green = _mm256_div_ps(_mm256_cvtepi32_ps(green_as_integers), MAX_INTEGRAL_COLOR_COMPONENT);
+        colors.Blue = _mm256_div_ps(_mm256_cvtepi32_ps(blue_as_integers), MAX_INTEGRAL_COLOR_COMPONENT);
+        colors.Alpha = _mm256_div_ps(_mm256_cvtepi32_ps(alpha_as_integers), MAX_INTEGRAL_COLOR_COMPONENT);
+        return colors;
+    }
+
+    /// Scales the colors by the specified factors, performing clamping.
+    /// Only red, green, and blue components are scaled (alpha is left alone).
+    /// @param[in]  scale_factors - The scaling factors to multiply the colors by.
+    /// @param[in]  colors - The original colors to scale.
+    /// @return Copies of the colors scaled as specified.
+    SIMD_TARGET_AVX2 ColorSimd8x ColorSimd8x::ScaleRedGreenBlue(const __m256 scale_factors, const ColorSimd8x& colors)
+    {
+        ColorSimd8x scaled_colors = colors;
+        scaled_colors.Red = _mm256_mul_ps(colors.Red, scale_factors);
+        scaled_colors.Green = _mm256_mul_ps(colors.Green, scale_factors);
+        scaled_colors.Blue = _mm256_mul_ps(colors.Blue, scale_factors);
+        scaled_colors.Clamp();
+        return scaled_colors;
+    }
+
+    /// Performs component-wise multiplication of the colors (excluding alpha components),
+    /// performing clamping.  Alpha components are opaque, matching the non-SIMD multiplication.
+    /// @param[in]  colors_1 - One set of colors to multiply by.
+    /// @param[in]  colors_2 - The other set of colors to multiply by.
+    /// @return The component-wise multiplied colors.
+    SIMD_TARGET_AVX2 ColorSimd8x ColorSimd8x::ComponentMultiplyRedGreenBlue(const ColorSimd8x& colors_1, const ColorSimd8x& colors_2)
+    {
+        ColorSimd8x multiplied_colors = Load(Color::BLACK);
+        multiplied_colors.Red = _mm256_mul_ps(colors_1.Red, colors_2.Red);
+        multiplied_colors.Green = _mm256_mul_ps(colors_1.Green, colors_2.Green);
+        multiplied_colors.Blue = _mm256_mul_ps(colors_1.Blue, colors_2.Blue);
+        multiplied_colors.Clamp();
+        return multiplied_colors;
+    }
+
+    /// Adds colors to these colors, performing clamping.
+    /// @param[in]  rhs - The colors to add.
+    /// @return These colors after being updated.
+    SIMD_TARGET_AVX2 ColorSimd8x& ColorSimd8x::operator+=(const ColorSimd8x& rhs)
+    {
+        Red = _mm256_add_ps(Red, rhs.Red);
+        Green = _mm256_add_ps(Green, rhs.Green);
+        Blue = _mm256_add_ps(Blue, rhs.Blue);
+        Alpha = _mm256_add_ps(Alpha, rhs.Alpha);
+        Clamp();
+        return *this;
+    }
+
+    /// Packs the colors into 32-bit integers according to the specified format.
+    /// Colors are expected to already be clamped to the valid range.
+    /// @param[in]  color_format - The format in which to pack the colors.
+    /// @return The packed colors.
+    SIMD_TARGET_AVX2 __m256i ColorSimd8x::Pack(const ColorFormat color_format) const
+    {
+        // CONVERT THE COLOR COMPONENTS TO 8-BIT INTEGERS.
+        // Truncation is used to match the non-SIMD conversion.
+        const __m256 MAX_INTEGRAL_COLOR_COMPONENT = _mm256_set1_ps(Color::MAX_INTEGRAL_COLOR_COMPONENT);
+        __m256i red = _mm256_cvttps_epi32(_mm256_mul_ps(Red, MAX_INTEGRAL_COLOR_COMPONENT));
+        __m256i green = _mm256_cvttps_epi32(_mm256_mul_ps(Green, MAX_INTEGRAL_COLOR_COMPONENT));
+        __m256i blue = _mm256_cvttps_epi32(_mm256_mul_ps(Blue, MAX_INTEGRAL_COLOR_COMPONENT));
+        __m256i alpha = _mm256_cvttps_epi32(_mm256_mul_ps(Alpha, MAX_INTEGRAL_COLOR_COMPONENT));
+
+        // PACK ACCORDING TO THE COLOR FORMAT.
+        switch (color_format)
+        {
+            case ColorFormat::RGBA:
+            {
+                __m256i packed_colors = _mm256_or_si256(
+                    _mm256_or_si256(_mm256_slli_epi32(red, 24), _mm256_slli_epi32(green, 16)),
+                    _mm256_or_si256(_mm256_slli_epi32(blue, 8), alpha));
+                return packed_colors;
+            }
+            case ColorFormat::ARGB:
+            {
+                __m256i packed_colors = _mm256_or_si256(
+                    _mm256_or_si256(_mm256_slli_epi32(alpha, 24), _mm256_slli_epi32(red, 16)),
+                    _mm256_or_si256(_mm256_slli_epi32(green, 8), blue));
+                return packed_colors;
+            }
+            default:
+                // RETURN A DEFAULT COLOR.
+                return _mm256_setzero_si256();
+        }
+    }
+
+    /// Stores the colors into non-SIMD colors.
+    /// @param[out] colors - The 8 consecutive colors to store into.
+    SIMD_TARGET_AVX2 void ColorSimd8x::Store(Color* const colors) const
+    {
+        alignas(32) float reds[8];
+        alignas(32) float greens[8];
+        alignas(32) float blues[8];
+        alignas(32) float alphas[8];
+        _mm256_store_ps(reds, Red);
+        _mm256_store_ps(greens, Green);
+        _mm256_store_ps(blues, Blue);
+        _mm256_store_ps(alphas, Alpha);
+        for (std::size_t color_index = 0; color_index < 8; ++color_index)
+        {
+            colors[color_index] = Color(reds[color_index], greens[color_index], blues[color_index], alphas[color_index]);
+        }
+    }
+
+    /// Clamps all color components to the valid range,
+    /// which needs to be done after many operations.
+    SIMD_TARGET_AVX2 void ColorSimd8x::Clamp()
+    {
+        const __m256 MIN_FLOAT_COLOR_COMPONENT = _mm256_set1_ps(Color::MIN_FLOAT_COLOR_COMPONENT);
+        const __m256 MAX_FLOAT_COLOR_COMPONENT = _mm256_set1_ps(Color::MAX_FLOAT_COLOR_COMPONENT);
+        Red = _mm256_min_ps(_mm256_max_ps(Red, MIN_FLOAT_COLOR_COMPONENT), MAX_FLOAT_COLOR_COMPONENT);
+        Green = _mm256_min_ps(_mm256_max_ps(Green, MIN_FLOAT_COLOR_COMPONENT), MAX_FLOAT_COLOR_COMPONENT);
+        Blue = _mm256_min_ps(_mm256_max_ps(Blue, MIN_FLOAT_COLOR_COMPONENT), MAX_FLOAT_COLOR_COMPONENT);
+        Alpha = _mm256_min_ps(_mm256_max_ps(Alpha, MIN_FLOAT_COLOR_COMPONENT), MAX_FLOAT_COLOR_COMPONENT);
+    }
+
+    /// Determines which colors would not be black when converted to 8-bit integral components,
+    /// considering only red, green, and blue components.
+    /// @return A mask with all bits set for colors that are not black; all bits cleared for black colors.
+    SIMD_TARGET_AVX2 __m256 ColorSimd8x::NonBlackRedGreenBlueMask() const
+    {
+        // Any component that would be truncated to a non-zero integer makes the color non-black.
+        const __m256 MAX_INTEGRAL_COLOR_COMPONENT = _mm256_set1_ps(Color::MAX_INTEGRAL_COLOR_COMPONENT);
+        const __m256 MIN_NON_BLACK_INTEGRAL_COLOR_COMPONENT = _mm256_set1_ps(1.0f);
+        __m256 red_non_black = _mm256_cmp_ps(_mm256_mul_ps(Red, MAX_INTEGRAL_COLOR_COMPONENT), MIN_NON_BLACK_INTEGRAL_COLOR_COMPONENT, _CMP_GE_OQ);
+        __m256 green_non_black = _mm256_cmp_ps(_mm256_mul_ps(Green, MAX_INTEGRAL_COLOR_COMPONENT), MIN_NON_BLACK_INTEGRAL_COLOR_COMPONENT, _CMP_GE_OQ);
+        __m256 blue_non_black = _mm256_cmp_ps(_mm256_mul_ps(Blue, MAX_INTEGRAL_COLOR_COMPONENT), MIN_NON_BLACK_INTEGRAL_COLOR_COMPONENT, _CMP_GE_OQ);
+        __m256 non_black_mask = _mm256_or_ps(_mm256_or_ps(red_non_black, green_non_black), blue_non_black);
+        return non_black_mask;
+    }
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Graphics/Color.h"
+#include "Graphics/ColorFormat.h"
+#include "Processor/SimdIntrinsics.h"
+
+namespace GRAPHICS
+{
+    /// 8 RGBA colors in an 8-wide (8x meaning "8 times") SIMD format.
+    /// Each component is stored as a floating-point value between [0,1],
+    /// mirroring the non-SIMD @ref Color class.
+    /// Requires AVX2 support (see @ref PROCESSOR::CpuFeatures).
+    class ColorSimd8x
+    {
+    public:
+        // CONSTRUCTION.
+        SIMD_TARGET_AVX2 static ColorSimd8x Load(const Color& color);
+        SIMD_TARGET_AVX2 static ColorSimd8x Unpack(const __m256i packed_colors, const ColorFormat color_format);
+
+        // STATIC METHODS.
+        SIMD_TARGET_AVX2 static ColorSimd8x ScaleRedGreenBlue(const __m256 scale_factors, const ColorSimd8x& colors);
+        SIMD_TARGET_AVX2 static ColorSimd8x ComponentMultiplyRedGreenBlue(const ColorSimd8x& colors_1, const ColorSimd8x& colors_2);
+
+        // OPERATORS.
+        SIMD_TARGET_AVX2 ColorSimd8x& operator+=(const ColorSimd8x& rhs);
+
+        // OTHER METHODS.
+        SIMD_TARGET_AVX2 __m256i Pack(const ColorFormat color_format) const;
+        SIMD_TARGET_AVX2 void Store(Color* const colors) const;
+        SIMD_TARGET_AVX2 void Clamp();
+        SIMD_TARGET_AVX2 __m256 NonBlackRedGreenBlueMask() const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The red components of the colors.
+        __m256 Red;
+        /// The green components of the colors.
+        __m256 Green;
+        /// The blue components of the colors.
+        __m256 Blue;
+        /// The alpha components of the colors.
+        __m256 Alpha;
+    };
+}
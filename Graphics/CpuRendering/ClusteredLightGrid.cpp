@@ -0,0 +1,184 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include "Graphics/CpuRendering/ClusteredLightGrid.h"
+#include "Graphics/CpuRendering/DeferredLightingAlgorithm.h"
+#include "Math/Rectangle.h"
+#include "Math/Vector4.h"
+
+namespace GRAPHICS::CPU_RENDERING
+{
+    /// Builds the lists of lights for each cluster of a screen.
+    /// @param[in]  lights - The lights to assign to clusters.
+    /// @param[in]  viewing_transformations - The viewing transformations for the screen.
+    /// @param[in]  screen_width_in_pixels - The width of the screen.
+    /// @param[in]  screen_height_in_pixels - The height of the screen.
+    ClusteredLightGrid::ClusteredLightGrid(
+        const std::vector<SHADING::LIGHTING::Light>& lights,
+        const VIEWING::ViewingTransformations& viewing_transformations,
+        const unsigned int screen_width_in_pixels,
+        const unsigned int screen_height_in_pixels) :
+        GridViewingTransformations(viewing_transformations),
+        ScreenWidthInPixels(screen_width_in_pixels),
+        ScreenHeightInPixels(screen_height_in_pixels),
+        TileColumnCount((screen_width_in_pixels + TILE_DIMENSION_IN_PIXELS - 1) / TILE_DIMENSION_IN_PIXELS),
+        TileRowCount((screen_height_in_pixels + TILE_DIMENSION_IN_PIXELS - 1) / TILE_DIMENSION_IN_PIXELS),
+        MinViewDepth(std::numeric_limits<float>::max()),
+        MaxViewDepth(std::numeric_limits<float>::lowest()),
+        AllLights(lights)
+    {
+        // COMPUTE THE REGION EACH LIMITED-RANGE LIGHT MAY ILLUMINATE.
+        // View depths are padded slightly since surface positions are transformed separately from lights,
+        // which may introduce small rounding differences.
+        constexpr float VIEW_DEPTH_PADDING_FRACTION = 1e-4f;
+        std::vector<MATH::Rectangleui> light_screen_bounds(lights.size());
+        std::vector<float> light_min_view_depths(lights.size());
+        std::vector<float> light_max_view_depths(lights.size());
+        for (std::size_t light_index = 0; light_index < lights.size(); ++light_index)
+        {
+            // SKIP LIGHTS WITHOUT LIMITED RANGES.
+            const SHADING::LIGHTING::Light& light = lights[light_index];
+            bool light_has_limited_range = (
+                SHADING::LIGHTING::LightType::POINT == light.Type &&
+                light.PointLightRange < std::numeric_limits<float>::max());
+            if (!light_has_limited_range)
+            {
+                UnlimitedRangeLights.emplace_back(light);
+                continue;
+            }
+
+            // SKIP LIGHTS THAT CAN'T ILLUMINATE ANYTHING ON SCREEN.
+            light_screen_bounds[light_index] = DeferredLightingAlgorithm::ComputeScreenBounds(
+                light,
+                viewing_transformations,
+                screen_width_in_pixels,
+                screen_height_in_pixels);
+            if (light_screen_bounds[light_index].IsEmpty())
+            {
+                continue;
+            }
+
+            // COMPUTE THE RANGE OF VIEW DEPTHS THE LIGHT COVERS.
+            // View depths are along the negative Z axis.
+            MATH::Vector4f light_view_position = viewing_transformations.CameraViewTransform * MATH::Vector4f::HomogeneousPositionVector(light.PointLightWorldPosition);
+            float light_view_depth = -light_view_position.Z;
+            float view_depth_padding = VIEW_DEPTH_PADDING_FRACTION * (std::abs(light_view_depth) + light.PointLightRange);
+            light_min_view_depths[light_index] = light_view_depth - light.PointLightRange - view_depth_padding;
+            light_max_view_depths[light_index] = light_view_depth + light.PointLightRange + view_depth_padding;
+            MinViewDepth = std::min(MinViewDepth, light_min_view_depths[light_index]);
+            MaxViewDepth = std::max(MaxViewDepth, light_max_view_depths[light_index]);
+        }
+
+        // CHECK IF ANY LIMITED-RANGE LIGHTS NEED CLUSTERS.
+        // Otherwise, all positions on screen are only illuminated by lights without limited ranges.
+        bool any_limited_range_lights_on_screen = (MinViewDepth <= MaxViewDepth);
+        if (!any_limited_range_lights_on_screen)
+        {
+            return;
+        }
+        DepthSliceThickness = (MaxViewDepth - MinViewDepth) / static_cast<float>(DEPTH_SLICE_COUNT);
+
+        // ADD EACH LIGHT TO THE CLUSTERS IT MAY ILLUMINATE.
+        // Lights are added in order so that lighting is summed in the same order as for all lights.
+        std::size_t cluster_count = static_cast<std::size_t>(DEPTH_SLICE_COUNT) * TileRowCount * TileColumnCount;
+        LightsByCluster.resize(cluster_count);
+        for (std::size_t light_index = 0; light_index < lights.size(); ++light_index)
+        {
+            // ADD LIGHTS WITHOUT LIMITED RANGES TO ALL CLUSTERS.
+            const SHADING::LIGHTING::Light& light = lights[light_index];
+            bool light_has_limited_range = (
+                SHADING::LIGHTING::LightType::POINT == light.Type &&
+                light.PointLightRange < std::numeric_limits<float>::max());
+            if (!light_has_limited_range)
+            {
+                for (std::vector<SHADING::LIGHTING::Light>& cluster_lights : LightsByCluster)
+                {
+                    cluster_lights.emplace_back(light);
+                }
+                continue;
+            }
+
+            // SKIP LIGHTS THAT CAN'T ILLUMINATE ANYTHING ON SCREEN.
+            const MATH::Rectangleui& screen_bounds = light_screen_bounds[light_index];
+            if (screen_bounds.IsEmpty())
+            {
+                continue;
+            }
+
+            // ADD THE LIGHT TO CLUSTERS WITHIN ITS BOUNDS.
+            unsigned int first_depth_slice_index = GetDepthSliceIndex(light_min_view_depths[light_index]);
+            unsigned int last_depth_slice_index = GetDepthSliceIndex(light_max_view_depths[light_index]);
+            unsigned int first_tile_row_index = screen_bounds.TopY / TILE_DIMENSION_IN_PIXELS;
+            unsigned int end_tile_row_index = (screen_bounds.BottomY() + TILE_DIMENSION_IN_PIXELS - 1) / TILE_DIMENSION_IN_PIXELS;
+            unsigned int first_tile_column_index = screen_bounds.LeftX / TILE_DIMENSION_IN_PIXELS;
+            unsigned int end_tile_column_index = (screen_bounds.RightX() + TILE_DIMENSION_IN_PIXELS - 1) / TILE_DIMENSION_IN_PIXELS;
+            for (unsigned int depth_slice_index = first_depth_slice_index; depth_slice_index <= last_depth_slice_index; ++depth_slice_index)
+            {
+                for (unsigned int tile_row_index = first_tile_row_index; tile_row_index < end_tile_row_index; ++tile_row_index)
+                {
+                    for (unsigned int tile_column_index = first_tile_column_index; tile_column_index < end_tile_column_index; ++tile_column_index)
+                    {
+                        std::size_t cluster_index = (static_cast<std::size_t>(depth_slice_index) * TileRowCount + tile_row_index) * TileColumnCount + tile_column_index;
+                        LightsByCluster[cluster_index].emplace_back(light);
+                    }
+                }
+            }
+        }
+    }
+
+    /// Gets the lights that may illuminate a position.
+    /// @param[in]  world_position - The world position to get lights for.
+    /// @return The lights of the cluster containing the position.  All lights are returned for positions
+    ///     outside of the screen or clip planes since light bounds are clipped to those regions.
+    const std::vector<SHADING::LIGHTING::Light>& ClusteredLightGrid::GetLights(const MATH::Vector3f& world_position) const
+    {
+        // USE ALL LIGHTS FOR POSITIONS OUTSIDE OF THE SCREEN.
+        std::optional<MATH::Vector3f> screen_position = GridViewingTransformations.WorldToScreen(world_position);
+        if (!screen_position)
+        {
+            return AllLights;
+        }
+        bool position_on_screen = (
+            0.0f <= screen_position->X && screen_position->X < static_cast<float>(ScreenWidthInPixels) &&
+            0.0f <= screen_position->Y && screen_position->Y < static_cast<float>(ScreenHeightInPixels));
+        if (!position_on_screen)
+        {
+            return AllLights;
+        }
+
+        // USE ONLY LIGHTS WITHOUT LIMITED RANGES FOR POSITIONS THAT NO LIMITED-RANGE LIGHTS REACH.
+        MATH::Vector4f view_position = GridViewingTransformations.CameraViewTransform * MATH::Vector4f::HomogeneousPositionVector(world_position);
+        float view_depth = -view_position.Z;
+        bool position_within_limited_range_lights = (MinViewDepth <= view_depth && view_depth <= MaxViewDepth);
+        if (!position_within_limited_range_lights)
+        {
+            return UnlimitedRangeLights;
+        }
+
+        // USE THE LIGHTS OF THE CLUSTER CONTAINING THE POSITION.
+        unsigned int depth_slice_index = GetDepthSliceIndex(view_depth);
+        unsigned int tile_row_index = static_cast<unsigned int>(screen_position->Y) / TILE_DIMENSION_IN_PIXELS;
+        unsigned int tile_column_index = static_cast<unsigned int>(screen_position->X) / TILE_DIMENSION_IN_PIXELS;
+        std::size_t cluster_index = (static_cast<std::size_t>(depth_slice_index) * TileRowCount + tile_row_index) * TileColumnCount + tile_column_index;
+        return LightsByCluster[cluster_index];
+    }
+
+    /// Gets the index of the depth slice containing a view depth.
+    /// @param[in]  view_depth - The view depth (distance in front of the camera).
+    /// @return The index of the depth slice, clamped to the valid range of slices.
+    unsigned int ClusteredLightGrid::GetDepthSliceIndex(const float view_depth) const
+    {
+        // All depths are in the first slice if lights only cover a single depth.
+        if (DepthSliceThickness <= 0.0f)
+        {
+            return 0;
+        }
+
+        constexpr float FIRST_DEPTH_SLICE_INDEX = 0.0f;
+        constexpr float LAST_DEPTH_SLICE_INDEX = static_cast<float>(DEPTH_SLICE_COUNT - 1);
+        float depth_slice_index = std::floor((view_depth - MinViewDepth) / DepthSliceThickness);
+        float clamped_depth_slice_index = std::clamp(depth_slice_index, FIRST_DEPTH_SLICE_INDEX, LAST_DEPTH_SLICE_INDEX);
+        return static_cast<unsigned int>(clamped_depth_slice_index);
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "Graphics/Shading/Lighting/Light.h"
+#include "Graphics/Viewing/ViewingTransformations.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS::CPU_RENDERING
+{
+    /// A grid subdividing the viewing frustum into clusters (screen tiles by depth slices),
+    /// with lists of the lights that may illuminate each cluster.
+    ///
+    /// Shading a position then only needs to loop over the lights of its cluster rather than all lights,
+    /// which keeps shading costs close to that of a single light even in scenes with hundreds of
+    /// point lights with limited ranges.  Lights are culled conservatively, and lights that don't reach
+    /// a position contribute no lighting, so shading results are exactly the same as with all lights.
+    ///
+    /// Depth slices evenly divide the range of view depths that limited-range point lights cover
+    /// rather than the range between the camera's clip planes, which is often unbounded.
+    class ClusteredLightGrid
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The width and height of square tiles of pixels for clusters.
+        static constexpr unsigned int TILE_DIMENSION_IN_PIXELS = 32;
+        /// The number of depth slices for clusters.
+        static constexpr unsigned int DEPTH_SLICE_COUNT = 16;
+
+        // CONSTRUCTION.
+        explicit ClusteredLightGrid(
+            const std::vector<SHADING::LIGHTING::Light>& lights,
+            const VIEWING::ViewingTransformations& viewing_transformations,
+            const unsigned int screen_width_in_pixels,
+            const unsigned int screen_height_in_pixels);
+
+        // LIGHTS.
+        const std::vector<SHADING::LIGHTING::Light>& GetLights(const MATH::Vector3f& world_position) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The viewing transformations for the screen that the grid covers.
+        VIEWING::ViewingTransformations GridViewingTransformations;
+        /// The width of the screen that the grid covers.
+        unsigned int ScreenWidthInPixels = 0;
+        /// The height of the screen that the grid covers.
+        unsigned int ScreenHeightInPixels = 0;
+        /// The number of columns of tiles.
+        unsigned int TileColumnCount = 0;
+        /// The number of rows of tiles.
+        unsigned int TileRowCount = 0;
+        /// The minimum view depth (distance in front of the camera) covered by any limited-range light.
+        float MinViewDepth = 0.0f;
+        /// The maximum view depth (distance in front of the camera) covered by any limited-range light.
+        float MaxViewDepth = 0.0f;
+        /// The view depth covered by each depth slice.
+        float DepthSliceThickness = 0.0f;
+        /// All lights, for positions outside of the grid.
+        std::vector<SHADING::LIGHTING::Light> AllLights = {};
+        /// Lights that aren't limited in range, for positions on screen that no limited-range lights reach.
+        std::vector<SHADING::LIGHTING::Light> UnlimitedRangeLights = {};
+        /// The lights that may illuminate each cluster, in the same relative order as all lights.
+        /// Clusters are ordered by depth slice, then tile row, then tile column.
+        std::vector<std::vector<SHADING::LIGHTING::Light>> LightsByCluster = {};
+
+    private:
+        // HELPER METHODS.
+        unsigned int GetDepthSliceIndex(const float view_depth) const;
+    };
+}
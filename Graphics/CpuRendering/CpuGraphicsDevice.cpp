@@ -8,21 +8,29 @@ namespace GRAPHICS::CPU_RENDERING
     /// Attempts to connect a graphics device to the specified window for rendering via the CPU.
     /// @param[in]  device_type - The type of graphics device to connect to the window.
     /// @param[in,out]  window - The window in which to do CPU rendering.  Non-const since non-const access is sometimes needed.
+    /// @param[in]  swap_chain_buffer_count - The number of color buffers to render to in turn.
+    ///     At least 2 are needed for presenting to overlap with rendering.
     /// return  The CPU graphics device, if successfully connected to the window; null if an error occurs.
-    std::unique_ptr<CpuGraphicsDevice> CpuGraphicsDevice::ConnectTo(const GRAPHICS::HARDWARE::GraphicsDeviceType device_type, WINDOWING::IWindow& window)
+    std::unique_ptr<CpuGraphicsDevice> CpuGraphicsDevice::ConnectTo(
+        const GRAPHICS::HARDWARE::GraphicsDeviceType device_type,
+        WINDOWING::IWindow& window,
+        const std::size_t swap_chain_buffer_count)
     {
         auto graphics_device = std::make_unique<CpuGraphicsDevice>();
 
         graphics_device->DeviceType = device_type;
         graphics_device->Window = &window;
 
-        // CREATE A CLEARED COLOR BUFFER FOR THE GRAPHICS DEVICE.
+        // CREATE CLEARED COLOR BUFFERS FOR THE GRAPHICS DEVICE.
+        // The swap chain clears its buffers to black to help ensure a known, common initial state.
         unsigned int width_in_pixels = window.GetWidthInPixels();
         unsigned int height_in_pixels = window.GetHeightInPixels();
         /// @todo   Figure out color format.
-        graphics_device->ColorBuffer = GRAPHICS::IMAGES::Bitmap(width_in_pixels, height_in_pixels, GRAPHICS::ColorFormat::ARGB);
-        // Clearing to black helps ensure a known, common initial state for the color buffer.
-        graphics_device->ColorBuffer.FillPixels(GRAPHICS::Color::BLACK);
+        graphics_device->SwapChain = GRAPHICS::CPU_RENDERING::SwapChain(
+            width_in_pixels,
+            height_in_pixels,
+            GRAPHICS::ColorFormat::ARGB,
+            swap_chain_buffer_count);
 
         graphics_device->DepthBuffer = GRAPHICS::DepthBuffer(width_in_pixels, height_in_pixels);
 
@@ -32,7 +40,9 @@ namespace GRAPHICS::CPU_RENDERING
     /// Shutdowns the graphics device, freeing up allocated resources.
     void CpuGraphicsDevice::Shutdown()
     {
-        // Currently nothing to do.
+        // WAIT FOR ANY PRESENTS TO FINISH.
+        // The window being presented to may be destroyed after the device is shut down.
+        SwapChain.WaitForIdle();
     }
 
     /// Shuts down the graphics device to ensure all resources are freed.
@@ -60,9 +70,11 @@ namespace GRAPHICS::CPU_RENDERING
     /// @param[in]  color - The background color to clear to.
     void CpuGraphicsDevice::ClearBackground(const GRAPHICS::Color& color)
     {
-        ColorBuffer.FillPixels(color);
+        // The color buffer is usually already cleared in the background after its previous present.
+        SwapChain.ClearCurrentBuffer(color);
 
-        DepthBuffer.ClearToDepth(GRAPHICS::DepthBuffer::MAX_DEPTH);
+        // Depths are only written for tiles that are actually rendered to.
+        DepthBuffer.FastClearToDepth(GRAPHICS::DepthBuffer::MAX_DEPTH);
     }
 
     /// Renders the specified scene using the graphics device.
@@ -75,17 +87,57 @@ namespace GRAPHICS::CPU_RENDERING
         const VIEWING::Camera& camera,
         const GRAPHICS::RenderingSettings& rendering_settings)
     {
+        // START SELECTING LEVELS OF DETAIL AND CACHING VERTICES FOR THE NEW FRAME.
+        LevelOfDetailSelector.BeginFrame();
+        LitVertexCache.BeginFrame();
+
+        // CLEAR THE COLOR BUFFER TO THE BACKGROUND IF RASTERIZING.
+        // The swap chain skips the clear if it already cleared the buffer to the background color
+        // on its present thread, and later background clears use the same color.
+        // The ray tracer writes every pixel, so it doesn't need a cleared buffer.
+        bool rasterizing = (GRAPHICS::HARDWARE::GraphicsDeviceType::CPU_RASTERIZER == DeviceType);
+        if (rasterizing)
+        {
+            SwapChain.ClearCurrentBuffer(scene.BackgroundColor);
+        }
+
+        // GET THE COLOR BUFFER TO RENDER TO.
+        // This waits for any previous present of the buffer to finish.
+        GRAPHICS::IMAGES::Bitmap& color_buffer = SwapChain.GetCurrentBuffer();
+
         switch (DeviceType)
         {
             case GRAPHICS::HARDWARE::GraphicsDeviceType::CPU_RASTERIZER:
             {
-                GRAPHICS::DepthBuffer* depth_buffer = rendering_settings.DepthBuffering ? &DepthBuffer : nullptr;
+                // RECREATE THE DEPTH BUFFER IF A DIFFERENT KIND IS NEEDED.
+                GRAPHICS::DepthBuffer* depth_buffer = nullptr;
+                if (rendering_settings.DepthBuffering)
+                {
+                    bool depth_buffer_format_changed = (
+                        (rendering_settings.DepthBufferFormat != DepthBuffer.GetFormat()) ||
+                        (rendering_settings.ReversedZ != DepthBuffer.IsReversedZ()));
+                    if (depth_buffer_format_changed)
+                    {
+                        DepthBuffer = GRAPHICS::DepthBuffer(
+                            DepthBuffer.GetWidthInPixels(),
+                            DepthBuffer.GetHeightInPixels(),
+                            rendering_settings.DepthBufferFormat,
+                            rendering_settings.ReversedZ);
+                    }
+
+                    depth_buffer = &DepthBuffer;
+                }
+                constexpr bool COLOR_BUFFER_ALREADY_CLEARED = true;
                 CpuRasterizationAlgorithm::Render(
                     scene,
                     camera,
                     rendering_settings,
-                    ColorBuffer,
-                    depth_buffer);
+                    color_buffer,
+                    depth_buffer,
+                    &LevelOfDetailSelector,
+                    &LitVertexCache,
+                    &GBuffer,
+                    COLOR_BUFFER_ALREADY_CLEARED);
                 break;
             }
             case GRAPHICS::HARDWARE::GraphicsDeviceType::CPU_RAY_TRACER:
@@ -94,7 +146,8 @@ namespace GRAPHICS::CPU_RENDERING
                     scene,
                     camera,
                     rendering_settings,
-                    ColorBuffer);
+                    color_buffer,
+                    &LevelOfDetailSelector);
                 break;
             }
             default:
@@ -106,10 +159,23 @@ namespace GRAPHICS::CPU_RENDERING
     }
 
     /// Displays the rendered image from the graphics device.
+    /// The image is displayed on a background thread, so it may not be visible immediately.
     /// @param[in]  window - The window in which to display the image.
     void CpuGraphicsDevice::DisplayRenderedImage(WINDOWING::IWindow& window)
+    {
+        DisplayRenderedImage(window, nullptr);
+    }
+
+    /// Displays the rendered image from the graphics device on a background thread,
+    /// allowing the next image to be rendered while this one is being displayed.
+    /// @param[in]  window - The window in which to display the image.
+    /// @param[out] read_back_bitmap - Any bitmap to copy the displayed image into.  Must not be accessed
+    ///     until the returned fence has completed (see @ref SwapChain::WaitForFence).
+    /// @return The fence value for the displayed image.
+    uint64_t CpuGraphicsDevice::DisplayRenderedImage(WINDOWING::IWindow& window, GRAPHICS::IMAGES::Bitmap* read_back_bitmap)
     {
         // DISPLAY THE COLORED IMAGE IN THE WINDOW. 
-        window.Display(ColorBuffer);
+        uint64_t fence_value = SwapChain.Present(window, read_back_bitmap);
+        return fence_value;
     }
 }
@@ -1,9 +1,15 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include "Graphics/CpuRendering/GBuffer.h"
+#include "Graphics/CpuRendering/LitVertexCache.h"
+#include "Graphics/CpuRendering/SwapChain.h"
 #include "Graphics/DepthBuffer.h"
 #include "Graphics/Hardware/GraphicsDeviceType.h"
 #include "Graphics/Hardware/IGraphicsDevice.h"
 #include "Graphics/Images/Bitmap.h"
+#include "Graphics/Viewing/LevelOfDetailSelector.h"
 #include "Windowing/IWindow.h"
 
 /// Holds graphics code related to rendering on a CPU (rather than a GPU).
@@ -14,7 +20,10 @@ namespace GRAPHICS::CPU_RENDERING
     {
     public:
         // CREATION/SHUTDOWN.
-        static std::unique_ptr<CpuGraphicsDevice> ConnectTo(const GRAPHICS::HARDWARE::GraphicsDeviceType device_type, WINDOWING::IWindow& window);
+        static std::unique_ptr<CpuGraphicsDevice> ConnectTo(
+            const GRAPHICS::HARDWARE::GraphicsDeviceType device_type,
+            WINDOWING::IWindow& window,
+            const std::size_t swap_chain_buffer_count = GRAPHICS::CPU_RENDERING::SwapChain::DEFAULT_BUFFER_COUNT);
         void Shutdown() override;
         virtual ~CpuGraphicsDevice();
 
@@ -31,15 +40,23 @@ namespace GRAPHICS::CPU_RENDERING
             const VIEWING::Camera& camera,
             const GRAPHICS::RenderingSettings& rendering_settings) override;
         void DisplayRenderedImage(WINDOWING::IWindow& window) override;
+        uint64_t DisplayRenderedImage(WINDOWING::IWindow& window, GRAPHICS::IMAGES::Bitmap* read_back_bitmap);
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The type of this device.
         GRAPHICS::HARDWARE::GraphicsDeviceType DeviceType = GRAPHICS::HARDWARE::GraphicsDeviceType::CPU_RASTERIZER;
         /// The window the graphics device is connected to.
         WINDOWING::IWindow* Window = nullptr;
-        /// The buffer holds colors for the rendered image.
-        GRAPHICS::IMAGES::Bitmap ColorBuffer = GRAPHICS::IMAGES::Bitmap(0, 0, GRAPHICS::ColorFormat::RGBA);
+        /// The color buffers for rendered images.  Rendered images are presented to the window in the background
+        /// while the next image is rendered, and fences from the swap chain can be used to wait for presents.
+        GRAPHICS::CPU_RENDERING::SwapChain SwapChain = GRAPHICS::CPU_RENDERING::SwapChain(0, 0, GRAPHICS::ColorFormat::RGBA);
         /// The buffer holding depth values for depth/z-buffering.
         GRAPHICS::DepthBuffer DepthBuffer = GRAPHICS::DepthBuffer(0, 0);
+        /// Selects levels of detail for meshes, remembering selections across frames to avoid popping between levels.
+        GRAPHICS::VIEWING::LevelOfDetailSelector LevelOfDetailSelector = {};
+        /// Caches transformed and lit vertices of meshes across frames for the rasterizer.
+        GRAPHICS::CPU_RENDERING::LitVertexCache LitVertexCache = {};
+        /// Holds surface attributes for deferred lighting.  Only sized once deferred lighting is used.
+        GRAPHICS::CPU_RENDERING::GBuffer GBuffer = GRAPHICS::CPU_RENDERING::GBuffer();
     };
 }
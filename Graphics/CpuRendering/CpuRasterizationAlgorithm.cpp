@@ -3,13 +3,19 @@
 // To avoid annoyances with Windows min/max #defines.
 #define NOMINMAX
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include "Debugging/Timer.h"
+#include "Graphics/ColorSimd8x.h"
 #include "Graphics/CpuRendering/CpuRasterizationAlgorithm.h"
+#include "Graphics/CpuRendering/DeferredLightingAlgorithm.h"
 #include "Graphics/Geometry/TriangleSimd8x.h"
 #include "Graphics/Shading/WorldSpaceShading.h"
 #include "Graphics/TextureMappingAlgorithm.h"
 #include "Graphics/Viewing/ViewingTransformations.h"
 #include "Math/Number.h"
+#include "Processor/CpuFeatures.h"
 
 namespace GRAPHICS::CPU_RENDERING
 {
@@ -24,31 +30,225 @@ namespace GRAPHICS::CPU_RENDERING
             return;
         }
 
-        // RENDER A GLYPH FOR EACH CHARACTER.
-        unsigned int current_glyph_left_x_position = static_cast<unsigned int>(text.LeftTopPosition.X);
-        unsigned int current_glyph_top_y_position = static_cast<unsigned int>(text.LeftTopPosition.Y);
-        for (char character : text.String)
+        // RENDER THE TEXT WITH A NEWLY COMPUTED LAYOUT.
+        GUI::TextLayout text_layout = GUI::TextLayout::Compute(text.String, *text.Font);
+        Render(text, text_layout, render_target);
+    }
+
+    /// Renders some text onto the render target, reusing any previously computed layout for the text.
+    /// @param[in]  text - The text to render.
+    /// @param[in,out]  text_layout_cache - The cache of text layouts.  Updated with any newly computed layout.
+    /// @param[in,out]  render_target - The target to render to.
+    void CpuRasterizationAlgorithm::Render(const GUI::Text& text, GUI::TextLayoutCache& text_layout_cache, IMAGES::Bitmap& render_target)
+    {
+        // MAKE SURE A FONT EXISTS.
+        if (!text.Font)
         {
-            // RENDER ALL PIXELS FOR THE CURRENT GLYPH.
-            const GUI::Glyph& glyph = text.Font->GlyphsByCharacter[static_cast<unsigned char>(character)];
-            for (unsigned int glyph_local_pixel_y_position = 0; glyph_local_pixel_y_position < glyph.HeightInPixels; ++glyph_local_pixel_y_position)
+            return;
+        }
+
+        // RENDER THE TEXT WITH ITS CACHED LAYOUT.
+        const GUI::TextLayout& text_layout = text_layout_cache.GetLayout(text);
+        Render(text, text_layout, render_target);
+    }
+
+    /// Renders some text with an already computed layout onto the render target.
+    /// The text color is blended with existing pixels based on the coverage of each glyph pixel.
+    /// @param[in]  text - The text to render.
+    /// @param[in]  text_layout - The layout of the text.
+    /// @param[in,out]  render_target - The target to render to.
+    void CpuRasterizationAlgorithm::Render(const GUI::Text& text, const GUI::TextLayout& text_layout, IMAGES::Bitmap& render_target)
+    {
+        // PACK THE TEXT COLOR.
+        // This only needs to be done once for all pixels.
+        Color text_color = text.Color;
+        text_color.Clamp();
+        uint32_t packed_text_color = text_color.Pack(render_target.GetColorFormat());
+
+        // The SIMD path is only used if the CPU supports the instructions needed for it.
+        bool simd_blending_supported = (PROCESSOR::CpuFeatures::GetSimdInstructionSet() >= PROCESSOR::SimdInstructionSet::AVX2);
+
+        // RENDER EACH GLYPH.
+        int render_target_width_in_pixels = static_cast<int>(render_target.GetWidthInPixels());
+        int render_target_height_in_pixels = static_cast<int>(render_target.GetHeightInPixels());
+        uint32_t* render_target_pixels = render_target.GetRawData();
+        int text_left_x_position = static_cast<int>(text.LeftTopPosition.X);
+        int text_top_y_position = static_cast<int>(text.LeftTopPosition.Y);
+        MATH::Rectangleui text_dirty_rectangle;
+        for (const GUI::TextLayout::PositionedGlyph& positioned_glyph : text_layout.Glyphs)
+        {
+            // SKIP GLYPHS WITHOUT ANY COVERAGE.
+            const GUI::Glyph& glyph = *positioned_glyph.Glyph;
+            if (glyph.CoverageMask.empty())
             {
-                for (unsigned int glyph_local_pixel_x_position = 0; glyph_local_pixel_x_position < glyph.WidthInPixels; ++glyph_local_pixel_x_position)
+                continue;
+            }
+
+            // CLIP THE GLYPH TO THE RENDER TARGET.
+            // This is done once per glyph so that individual pixels don't need bounds checks.
+            int glyph_left_x_position = text_left_x_position + static_cast<int>(positioned_glyph.LeftTopOffsetInPixels.X);
+            int glyph_top_y_position = text_top_y_position + static_cast<int>(positioned_glyph.LeftTopOffsetInPixels.Y);
+            int first_local_x = std::max(0, -glyph_left_x_position);
+            int first_local_y = std::max(0, -glyph_top_y_position);
+            int end_local_x = std::min(static_cast<int>(glyph.WidthInPixels), render_target_width_in_pixels - glyph_left_x_position);
+            int end_local_y = std::min(static_cast<int>(glyph.HeightInPixels), render_target_height_in_pixels - glyph_top_y_position);
+            bool glyph_visible = (first_local_x < end_local_x) && (first_local_y < end_local_y);
+            if (!glyph_visible)
+            {
+                continue;
+            }
+
+            // BLEND EACH ROW OF THE GLYPH ONTO THE RENDER TARGET.
+            unsigned int row_pixel_count = static_cast<unsigned int>(end_local_x - first_local_x);
+            MATH::Rectangleui glyph_dirty_rectangle = MATH::Rectangleui::FromLeftTopAndDimensions(
+                static_cast<unsigned int>(glyph_left_x_position + first_local_x),
+                static_cast<unsigned int>(glyph_top_y_position + first_local_y),
+                row_pixel_count,
+                static_cast<unsigned int>(end_local_y - first_local_y));
+            text_dirty_rectangle = MATH::Rectangleui::Union(text_dirty_rectangle, glyph_dirty_rectangle);
+            std::size_t coverage_mask_row_stride = glyph.CoverageMaskRowStride();
+            for (int local_y = first_local_y; local_y < end_local_y; ++local_y)
+            {
+                const uint8_t* coverages = glyph.CoverageMask.data() + (local_y * coverage_mask_row_stride) + first_local_x;
+                std::size_t first_destination_pixel_index = (
+                    static_cast<std::size_t>(glyph_top_y_position + local_y) * render_target_width_in_pixels +
+                    static_cast<std::size_t>(glyph_left_x_position + first_local_x));
+                uint32_t* destination_pixels = render_target_pixels + first_destination_pixel_index;
+                if (simd_blending_supported)
                 {
-                    // ONLY WRITE THE PIXEL IF IT IS VISIBLE.
-                    GRAPHICS::Color pixel_color = glyph.GetPixelColor(glyph_local_pixel_x_position, glyph_local_pixel_y_position);
-                    bool pixel_visible = (pixel_color.Alpha > 0);
-                    if (pixel_visible)
-                    {
-                        unsigned int glyph_destination_x_position = current_glyph_left_x_position + glyph_local_pixel_x_position;
-                        unsigned int glyph_destination_y_position = current_glyph_top_y_position + glyph_local_pixel_y_position;
-                        render_target.WritePixel(glyph_destination_x_position, glyph_destination_y_position, pixel_color);
-                    }
+                    BlendTextRowSimd8x(coverages, packed_text_color, row_pixel_count, destination_pixels);
+                }
+                else
+                {
+                    BlendTextRow(coverages, packed_text_color, row_pixel_count, destination_pixels);
                 }
             }
+        }
+
+        // MARK THE WRITTEN PIXELS AS DIRTY.
+        // This is done once for all glyphs since they're usually close together.
+        render_target.MarkDirty(text_dirty_rectangle);
+    }
+
+    /// Blends a packed color onto a row of pixels based on coverage.
+    /// Each byte of the packed colors is blended independently, so any color format can be used.
+    /// @param[in]  coverages - How much each pixel is covered by the color (0 to 255).
+    /// @param[in]  packed_color - The color to blend onto the pixels, in the same format as the pixels.
+    /// @param[in]  pixel_count - The number of pixels in the row.
+    /// @param[in,out]  destination_pixels - The pixels to blend onto.
+    void CpuRasterizationAlgorithm::BlendTextRow(
+        const uint8_t* coverages,
+        const uint32_t packed_color,
+        const unsigned int pixel_count,
+        uint32_t* destination_pixels)
+    {
+        constexpr uint32_t MAX_COVERAGE = 255;
+        for (unsigned int pixel_index = 0; pixel_index < pixel_count; ++pixel_index)
+        {
+            // SKIP PIXELS THAT AREN'T COVERED.
+            uint32_t coverage = coverages[pixel_index];
+            if (0 == coverage)
+            {
+                continue;
+            }
 
-            // MOVE TO THE NEXT GLYPH.
-            current_glyph_left_x_position += glyph.WidthInPixels;
+            // BLEND EACH BYTE OF THE COLOR.
+            uint32_t destination_color = destination_pixels[pixel_index];
+            uint32_t blended_color = 0;
+            constexpr unsigned int BITS_PER_BYTE = 8;
+            for (unsigned int byte_shift = 0; byte_shift < 32; byte_shift += BITS_PER_BYTE)
+            {
+                uint32_t destination_component = (destination_color >> byte_shift) & 0xFF;
+                uint32_t source_component = (packed_color >> byte_shift) & 0xFF;
+                uint32_t weighted_sum = (destination_component * (MAX_COVERAGE - coverage)) + (source_component * coverage);
+                // This divides by 255 with rounding using only adds and shifts.
+                uint32_t rounded_weighted_sum = weighted_sum + 128;
+                uint32_t blended_component = (rounded_weighted_sum + (rounded_weighted_sum >> BITS_PER_BYTE)) >> BITS_PER_BYTE;
+                blended_color |= (blended_component << byte_shift);
+            }
+            destination_pixels[pixel_index] = blended_color;
+        }
+    }
+
+    /// Blends a packed color onto a row of pixels based on coverage, 8 pixels at a time using SIMD operations.
+    /// Results match the non-SIMD version.
+    /// @param[in]  coverages - How much each pixel is covered by the color (0 to 255).
+    /// @param[in]  packed_color - The color to blend onto the pixels, in the same format as the pixels.
+    /// @param[in]  pixel_count - The number of pixels in the row.
+    /// @param[in,out]  destination_pixels - The pixels to blend onto.
+    SIMD_TARGET_AVX2 void CpuRasterizationAlgorithm::BlendTextRowSimd8x(
+        const uint8_t* coverages,
+        const uint32_t packed_color,
+        const unsigned int pixel_count,
+        uint32_t* destination_pixels)
+    {
+        // SPLIT THE COLOR INTO COMPONENTS.
+        // Each byte of the packed colors is blended independently, so components are kept in the same byte order.
+        constexpr int COLOR_COMPONENT_COUNT = 4;
+        const __m256i BYTE_SHIFTS[COLOR_COMPONENT_COUNT] =
+        {
+            _mm256_set1_epi32(0),
+            _mm256_set1_epi32(8),
+            _mm256_set1_epi32(16),
+            _mm256_set1_epi32(24),
+        };
+        __m256i packed_colors = _mm256_set1_epi32(static_cast<int>(packed_color));
+        const __m256i BYTE_MASK = _mm256_set1_epi32(0xFF);
+        __m256i source_components[COLOR_COMPONENT_COUNT];
+        for (int component_index = 0; component_index < COLOR_COMPONENT_COUNT; ++component_index)
+        {
+            source_components[component_index] = _mm256_and_si256(_mm256_srlv_epi32(packed_colors, BYTE_SHIFTS[component_index]), BYTE_MASK);
+        }
+
+        // BLEND THE PIXELS 8 AT A TIME.
+        constexpr unsigned int SIMD_AVX_REGISTER_ELEMENT_COUNT = 8;
+        const __m256i MAX_COVERAGE = _mm256_set1_epi32(255);
+        const __m256i ROUNDING_OFFSET = _mm256_set1_epi32(128);
+        const __m256i ZERO = _mm256_setzero_si256();
+        for (unsigned int pixel_index = 0; pixel_index < pixel_count; pixel_index += SIMD_AVX_REGISTER_ELEMENT_COUNT)
+        {
+            // LOAD THE COVERAGES.
+            // A partial block at the end of the row is copied so that memory past the row isn't read,
+            // with zero coverage ensuring pixels past the row aren't touched.
+            __m128i coverage_bytes = _mm_setzero_si128();
+            unsigned int remaining_pixel_count = pixel_count - pixel_index;
+            if (remaining_pixel_count >= SIMD_AVX_REGISTER_ELEMENT_COUNT)
+            {
+                coverage_bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(coverages + pixel_index));
+            }
+            else
+            {
+                alignas(16) uint8_t remaining_coverages[16] = {};
+                std::copy(coverages + pixel_index, coverages + pixel_count, remaining_coverages);
+                coverage_bytes = _mm_load_si128(reinterpret_cast<const __m128i*>(remaining_coverages));
+            }
+            __m256i pixel_coverages = _mm256_cvtepu8_epi32(coverage_bytes);
+
+            // SKIP THE BLOCK IF NO PIXELS ARE COVERED.
+            __m256i covered_pixels = _mm256_cmpgt_epi32(pixel_coverages, ZERO);
+            bool no_pixels_covered = _mm256_testz_si256(covered_pixels, covered_pixels);
+            if (no_pixels_covered)
+            {
+                continue;
+            }
+
+            // BLEND EACH COMPONENT OF THE COVERED PIXELS.
+            int* current_destination_pixels = reinterpret_cast<int*>(destination_pixels + pixel_index);
+            __m256i destination_colors = _mm256_maskload_epi32(current_destination_pixels, covered_pixels);
+            __m256i inverse_coverages = _mm256_sub_epi32(MAX_COVERAGE, pixel_coverages);
+            __m256i blended_colors = ZERO;
+            for (int component_index = 0; component_index < COLOR_COMPONENT_COUNT; ++component_index)
+            {
+                __m256i destination_components = _mm256_and_si256(_mm256_srlv_epi32(destination_colors, BYTE_SHIFTS[component_index]), BYTE_MASK);
+                __m256i weighted_sums = _mm256_add_epi32(
+                    _mm256_mullo_epi32(destination_components, inverse_coverages),
+                    _mm256_mullo_epi32(source_components[component_index], pixel_coverages));
+                // This divides by 255 with rounding using only adds and shifts.
+                __m256i rounded_weighted_sums = _mm256_add_epi32(weighted_sums, ROUNDING_OFFSET);
+                __m256i blended_components = _mm256_srli_epi32(_mm256_add_epi32(rounded_weighted_sums, _mm256_srli_epi32(rounded_weighted_sums, 8)), 8);
+                blended_colors = _mm256_or_si256(blended_colors, _mm256_sllv_epi32(blended_components, BYTE_SHIFTS[component_index]));
+            }
+            _mm256_maskstore_epi32(current_destination_pixels, covered_pixels, blended_colors);
         }
     }
 
@@ -58,24 +258,283 @@ namespace GRAPHICS::CPU_RENDERING
     /// @param[in]  rendering_settings - The settings to use for rendering.
     /// @param[in,out]  output_bitmap - The bitmap to render to.
     /// @param[in,out]  depth_buffer - The depth buffer to use for any depth buffering.
+    /// @param[in,out]  level_of_detail_selector - The selector to use for levels of detail of meshes.  Full detail is used if null.
+    /// @param[in,out]  lit_vertex_cache - The cache to use for transformed and lit vertices across frames.
+    ///     A temporary cache for just this frame is used if null.
+    /// @param[in,out]  g_buffer - The G-buffer to use for any deferred lighting.
+    ///     A temporary G-buffer for just this frame is used if null.
+    /// @param[in]  output_bitmap_already_cleared - True if the caller guarantees the output bitmap was just cleared
+    ///     to the scene's background color (such as by a swap chain); false to have the bitmap cleared here.
     void CpuRasterizationAlgorithm::Render(
         const Scene& scene, 
         const VIEWING::Camera& camera,
         const GRAPHICS::RenderingSettings& rendering_settings,
         IMAGES::Bitmap& output_bitmap,
-        DepthBuffer* depth_buffer)
+        DepthBuffer* depth_buffer,
+        VIEWING::LevelOfDetailSelector* level_of_detail_selector,
+        LitVertexCache* lit_vertex_cache,
+        GBuffer* g_buffer,
+        const bool output_bitmap_already_cleared)
     {
-        // CLEAR THE BACKGROUND.
-        output_bitmap.FillPixels(scene.BackgroundColor);
+        // CLEAR THE BACKGROUND IF NEEDED.
+        if (!output_bitmap_already_cleared)
+        {
+            output_bitmap.FillPixels(scene.BackgroundColor);
+        }
         if (depth_buffer)
         {
-            depth_buffer->ClearToDepth(DepthBuffer::MAX_DEPTH);
+            // Depths are only written for tiles that are actually rendered to.
+            depth_buffer->FastClearToDepth(DepthBuffer::MAX_DEPTH);
+        }
+
+        // SORT THE MESHES IN THE SCENE INTO DRAWING ORDER.
+        // Opaque meshes are drawn front to back so that more pixels fail depth tests before being shaded,
+        // and transparent meshes are drawn last from back to front so that they blend over what's behind them.
+        RenderQueue render_queue;
+        render_queue.Add(scene, camera, level_of_detail_selector);
+        render_queue.Sort();
+
+        // USE A TEMPORARY VERTEX CACHE IF NEEDED.
+        // Even without a persistent cache, vertices are still only transformed and lit once for both rendering passes.
+        LitVertexCache frame_lit_vertex_cache;
+        LitVertexCache& current_lit_vertex_cache = lit_vertex_cache ? *lit_vertex_cache : frame_lit_vertex_cache;
+
+        // RENDER SHADOW MAPS FOR THE LIGHTS IF APPLICABLE.
+        // Shadows only affect lighting, so they're only needed if colors are lit.
+        std::vector<ShadowMap> shadow_maps;
+        bool shadow_mapping_enabled = (
+            rendering_settings.ShadowMapping &&
+            rendering_settings.ColorWrites &&
+            rendering_settings.Shading.Lighting.Enabled &&
+            rendering_settings.Shading.Lighting.ShadowsEnabled &&
+            SHADING::ShadingType::WIREFRAME != rendering_settings.Shading.ShadingType);
+        if (shadow_mapping_enabled)
+        {
+            shadow_maps = RenderShadowMaps(render_queue, scene.Lights, rendering_settings, current_lit_vertex_cache);
+        }
+
+        // RENDER THE DEPTHS OF EACH MESH IN THE SCENE IF APPLICABLE.
+        // Filling the depth buffer first means only the closest pixels will pass depth tests during the main pass,
+        // so shading and texturing for pixels that would later be overwritten can be avoided.
+        bool depth_pre_pass_enabled = (depth_buffer && rendering_settings.DepthPrePass);
+        if (depth_pre_pass_enabled)
+        {
+            RenderingSettings depth_pre_pass_settings = rendering_settings;
+            depth_pre_pass_settings.ColorWrites = false;
+            const std::vector<ShadowMap> NO_SHADOW_MAPS;
+            Render(render_queue, scene.Lights, NO_SHADOW_MAPS, camera, depth_pre_pass_settings, current_lit_vertex_cache, output_bitmap, depth_buffer);
         }
 
-        // RENDER EACH OBJECT IN THE SCENE.
-        for (const auto& object_3D : scene.Objects)
+        // RENDER EACH MESH IN THE SCENE WITH DEFERRED LIGHTING IF APPLICABLE.
+        // Only material-based shading computes lighting that can be deferred.
+        bool deferred_lighting_enabled = (
+            rendering_settings.DeferredLighting &&
+            SHADING::ShadingType::MATERIAL == rendering_settings.Shading.ShadingType);
+        if (deferred_lighting_enabled)
         {
-            Render(object_3D, scene.Lights, camera, rendering_settings, output_bitmap, depth_buffer);
+            GBuffer frame_g_buffer;
+            GBuffer& current_g_buffer = g_buffer ? *g_buffer : frame_g_buffer;
+            RenderDeferred(render_queue, scene.Lights, shadow_maps, camera, rendering_settings, current_lit_vertex_cache, current_g_buffer, output_bitmap, depth_buffer);
+            return;
+        }
+
+        // RENDER EACH MESH IN THE SCENE.
+        Render(render_queue, scene.Lights, shadow_maps, camera, rendering_settings, current_lit_vertex_cache, output_bitmap, depth_buffer);
+    }
+
+    /// Renders shadow maps for each light that casts shadows (see @ref ShadowMap::CastsShadows).
+    /// Only opaque items cast shadows since transparent items would otherwise block all light.
+    /// @param[in]  render_queue - The queue of items that may cast shadows.
+    /// @param[in]  lights - The lights to render shadow maps for.
+    /// @param[in]  rendering_settings - The settings to use for rendering.
+    /// @param[in,out]  lit_vertex_cache - The cache to use for transformed vertices.
+    /// @return The shadow maps for lights that cast shadows.
+    std::vector<ShadowMap> CpuRasterizationAlgorithm::RenderShadowMaps(
+        const RenderQueue& render_queue,
+        const std::vector<SHADING::LIGHTING::Light>& lights,
+        const RenderingSettings& rendering_settings,
+        LitVertexCache& lit_vertex_cache)
+    {
+        // GATHER THE WORLD POSITIONS OF ALL SHADOW CASTERS.
+        // Vertices of indexed meshes are transformed via the cache so that they're reused when rendering.
+        std::vector<const RenderQueue::DrawItem*> shadow_caster_draw_items;
+        std::vector<MATH::Vector3f> shadow_caster_world_positions;
+        for (const RenderQueue::DrawItem& draw_item : render_queue.Items)
+        {
+            bool item_transparent = (draw_item.SortKey & RenderQueue::TRANSPARENT_SORT_KEY_BIT);
+            if (item_transparent)
+            {
+                continue;
+            }
+
+            const MATH::AffineTransform3x4& object_world_transform = draw_item.WorldTransform;
+            shadow_caster_draw_items.emplace_back(&draw_item);
+
+            if (draw_item.Mesh->IsIndexed())
+            {
+                const LitVertexCache::MeshEntry& cached_mesh = lit_vertex_cache.GetWorldSpaceVertices(*draw_item.Mesh, object_world_transform);
+                for (const VertexWithAttributes& world_space_vertex : cached_mesh.WorldSpaceVertices)
+                {
+                    shadow_caster_world_positions.emplace_back(world_space_vertex.Position);
+                }
+            }
+            else
+            {
+                for (const GEOMETRY::Triangle& local_triangle : draw_item.Mesh->Triangles)
+                {
+                    GEOMETRY::Triangle world_space_triangle = TransformLocalToWorld(local_triangle, object_world_transform);
+                    for (const VertexWithAttributes& world_space_vertex : world_space_triangle.Vertices)
+                    {
+                        shadow_caster_world_positions.emplace_back(world_space_vertex.Position);
+                    }
+                }
+            }
+        }
+
+        // CHECK IF ANYTHING CASTS SHADOWS.
+        std::vector<ShadowMap> shadow_maps;
+        if (shadow_caster_world_positions.empty())
+        {
+            return shadow_maps;
+        }
+
+        // COMPUTE A BOUNDING SPHERE AROUND ALL SHADOW CASTERS.
+        // Shadow maps only need to cover the shadow casters, which keeps their texels as small as possible.
+        MATH::Vector3f min_world_position = shadow_caster_world_positions.front();
+        MATH::Vector3f max_world_position = shadow_caster_world_positions.front();
+        for (const MATH::Vector3f& world_position : shadow_caster_world_positions)
+        {
+            min_world_position.X = std::min(min_world_position.X, world_position.X);
+            min_world_position.Y = std::min(min_world_position.Y, world_position.Y);
+            min_world_position.Z = std::min(min_world_position.Z, world_position.Z);
+            max_world_position.X = std::max(max_world_position.X, world_position.X);
+            max_world_position.Y = std::max(max_world_position.Y, world_position.Y);
+            max_world_position.Z = std::max(max_world_position.Z, world_position.Z);
+        }
+        MATH::Vector3f shadow_casters_center_world_position = MATH::Vector3f::Scale(0.5f, min_world_position + max_world_position);
+        float shadow_casters_radius = 0.5f * (max_world_position - min_world_position).Length();
+
+        // RENDER THE DEPTHS OF SHADOW CASTERS FOR EACH LIGHT.
+        // Back faces are also rendered so that meshes without closed surfaces still cast shadows.
+        RenderingSettings shadow_map_rendering_settings = rendering_settings;
+        shadow_map_rendering_settings.ColorWrites = false;
+        shadow_map_rendering_settings.DepthBuffering = true;
+        shadow_map_rendering_settings.CullBackfaces = false;
+        const ClusteredLightGrid* NO_LIGHT_GRID = nullptr;
+        const std::vector<ShadowMap> NO_SHADOW_MAPS;
+        // The render target only provides the dimensions of each face since colors aren't written.
+        std::optional<IMAGES::Bitmap> shadow_map_render_target;
+        for (const SHADING::LIGHTING::Light& light : lights)
+        {
+            // SKIP LIGHTS THAT DON'T CAST SHADOWS.
+            if (!ShadowMap::CastsShadows(light))
+            {
+                continue;
+            }
+
+            // GET A RENDER TARGET MATCHING THE SHADOW MAP.
+            unsigned int shadow_map_dimension_in_pixels = light.ShadowMapDimensionInPixels;
+            bool render_target_matches_shadow_map = (
+                shadow_map_render_target &&
+                shadow_map_render_target->GetWidthInPixels() == shadow_map_dimension_in_pixels);
+            if (!render_target_matches_shadow_map)
+            {
+                shadow_map_render_target.emplace(shadow_map_dimension_in_pixels, shadow_map_dimension_in_pixels, ColorFormat::RGBA);
+            }
+            LineBatch wireframe_line_batch(shadow_map_render_target->GetColorFormat());
+
+            // RENDER EACH FACE OF THE SHADOW MAP.
+            ShadowMap& shadow_map = shadow_maps.emplace_back(
+                light,
+                shadow_casters_center_world_position,
+                shadow_casters_radius,
+                rendering_settings.ShadowMapFilterRadiusInTexels);
+            for (ShadowMap::Face& face : shadow_map.Faces)
+            {
+                for (const RenderQueue::DrawItem* shadow_caster_draw_item : shadow_caster_draw_items)
+                {
+                    RenderMesh(
+                        *shadow_caster_draw_item->Mesh,
+                        shadow_caster_draw_item->WorldTransform,
+                        lights,
+                        NO_LIGHT_GRID,
+                        NO_SHADOW_MAPS,
+                        face.LightCamera,
+                        face.LightViewingTransformations,
+                        shadow_map_rendering_settings,
+                        wireframe_line_batch,
+                        lit_vertex_cache,
+                        *shadow_map_render_target,
+                        &face.Depths);
+                }
+            }
+        }
+
+        return shadow_maps;
+    }
+
+    /// Renders all items in a render queue in their current order.
+    /// @param[in]  render_queue - The queue of items to render.
+    /// @param[in]  lights - Any lights that should illuminate the items.
+    /// @param[in]  shadow_maps - Shadow maps for any lights that cast shadows.
+    /// @param[in]  camera - The camera through which the items are being viewed.
+    /// @param[in]  rendering_settings - The settings to use for rendering.
+    /// @param[in,out]  lit_vertex_cache - The cache to use for transformed and lit vertices.
+    /// @param[in,out]  output_bitmap - The bitmap to render to.
+    /// @param[in,out]  depth_buffer - The depth buffer to use for any depth buffering.
+    void CpuRasterizationAlgorithm::Render(
+        const RenderQueue& render_queue,
+        const std::vector<SHADING::LIGHTING::Light>& lights,
+        const std::vector<ShadowMap>& shadow_maps,
+        const VIEWING::Camera& camera,
+        const RenderingSettings& rendering_settings,
+        LitVertexCache& lit_vertex_cache,
+        IMAGES::Bitmap& output_bitmap,
+        DepthBuffer* depth_buffer)
+    {
+        // SKIP WIREFRAMES IF ONLY DEPTHS ARE BEING WRITTEN.
+        // Lines don't cover enough of the screen to be worth depth-only rendering.
+        bool wireframe_rendering = (SHADING::ShadingType::WIREFRAME == rendering_settings.Shading.ShadingType);
+        if (wireframe_rendering && !rendering_settings.ColorWrites)
+        {
+            return;
+        }
+
+        // GET RE-USED TRANSFORMATIONS.
+        VIEWING::ViewingTransformations viewing_transformations(camera, output_bitmap);
+        viewing_transformations.ReversedZ = (depth_buffer && depth_buffer->IsReversedZ());
+        LineBatch wireframe_line_batch(output_bitmap.GetColorFormat());
+
+        // CULL LIGHTS TO CLUSTERS OF THE VIEWING FRUSTUM IF APPLICABLE.
+        // Lights are only needed if colors are being written.
+        std::optional<ClusteredLightGrid> light_grid;
+        bool clustered_light_culling_enabled = (
+            rendering_settings.ClusteredLightCulling &&
+            rendering_settings.ColorWrites &&
+            rendering_settings.Shading.Lighting.Enabled);
+        if (clustered_light_culling_enabled)
+        {
+            light_grid.emplace(lights, viewing_transformations, output_bitmap.GetWidthInPixels(), output_bitmap.GetHeightInPixels());
+        }
+        const ClusteredLightGrid* current_light_grid = light_grid ? &*light_grid : nullptr;
+
+        // RENDER EACH ITEM.
+        // Each item carries its object's world transform, computed once when the queue was built.
+        for (const RenderQueue::DrawItem& draw_item : render_queue.Items)
+        {
+            RenderMesh(
+                *draw_item.Mesh,
+                draw_item.WorldTransform,
+                lights,
+                current_light_grid,
+                shadow_maps,
+                camera,
+                viewing_transformations,
+                rendering_settings,
+                wireframe_line_batch,
+                lit_vertex_cache,
+                output_bitmap,
+                depth_buffer);
         }
     }
 
@@ -96,8 +555,23 @@ namespace GRAPHICS::CPU_RENDERING
     {
         // GET RE-USED TRANSFORMATIONS.
         // This is done before the loop to avoid performance hits for repeatedly calculating these matrices.
-        MATH::Matrix4x4f object_world_transform = object_3D.WorldTransform();
+        MATH::AffineTransform3x4 object_world_transform = object_3D.WorldAffineTransform();
         VIEWING::ViewingTransformations viewing_transformations(camera, output_bitmap);
+        viewing_transformations.ReversedZ = (depth_buffer && depth_buffer->IsReversedZ());
+
+        // SKIP WIREFRAMES IF ONLY DEPTHS ARE BEING WRITTEN.
+        // Lines don't cover enough of the screen to be worth depth-only rendering.
+        bool wireframe_rendering = (SHADING::ShadingType::WIREFRAME == rendering_settings.Shading.ShadingType);
+        if (wireframe_rendering && !rendering_settings.ColorWrites)
+        {
+            return;
+        }
+
+        // Wireframe triangles are batched into lines per mesh so that edges shared between triangles are only drawn once.
+        LineBatch wireframe_line_batch(output_bitmap.GetColorFormat());
+        LitVertexCache lit_vertex_cache;
+        const ClusteredLightGrid* NO_LIGHT_GRID = nullptr;
+        const std::vector<ShadowMap> NO_SHADOW_MAPS;
 
         // RENDER EACH MESH OF THE OBJECT.
         for (const auto& [mesh_name, mesh] : object_3D.Model.MeshesByName)
@@ -108,84 +582,722 @@ namespace GRAPHICS::CPU_RENDERING
                 continue;
             }
 
-            // RENDER EACH TRIANGLE OF THE MESH.
+            RenderMesh(
+                mesh,
+                object_world_transform,
+                lights,
+                NO_LIGHT_GRID,
+                NO_SHADOW_MAPS,
+                camera,
+                viewing_transformations,
+                rendering_settings,
+                wireframe_line_batch,
+                lit_vertex_cache,
+                output_bitmap,
+                depth_buffer);
+        }
+    }
+
+    /// Renders a single mesh of an object to the render target.
+    /// @param[in]  mesh - The mesh to render.
+    /// @param[in]  object_world_transform - The transform from the mesh's local space into world space.
+    /// @param[in]  lights - Any lights that should illuminate the mesh.
+    /// @param[in]  light_grid - The lights culled to clusters of the viewing frustum, if any.
+    ///     All lights are used for shading if null.
+    /// @param[in]  shadow_maps - Shadow maps for any lights that cast shadows.
+    /// @param[in]  camera - The camera through which the mesh is being viewed.
+    /// @param[in]  viewing_transformations - The viewing transformations for the camera.
+    /// @param[in]  rendering_settings - The settings to use for rendering.
+    /// @param[in,out]  wireframe_line_batch - An empty batch to use for any wireframe lines.  Cleared after rendering.
+    /// @param[in,out]  lit_vertex_cache - The cache to use for transformed and lit vertices of indexed meshes.
+    /// @param[in,out]  output_bitmap - The bitmap to render to.
+    /// @param[in,out]  depth_buffer - The depth buffer to use for any depth buffering.
+    void CpuRasterizationAlgorithm::RenderMesh(
+        const Mesh& mesh,
+        const MATH::AffineTransform3x4& object_world_transform,
+        const std::vector<SHADING::LIGHTING::Light>& lights,
+        const ClusteredLightGrid* light_grid,
+        const std::vector<ShadowMap>& shadow_maps,
+        const VIEWING::Camera& camera,
+        const VIEWING::ViewingTransformations& viewing_transformations,
+        const RenderingSettings& rendering_settings,
+        LineBatch& wireframe_line_batch,
+        LitVertexCache& lit_vertex_cache,
+        IMAGES::Bitmap& output_bitmap,
+        DepthBuffer* depth_buffer)
+    {
+        bool wireframe_rendering = (SHADING::ShadingType::WIREFRAME == rendering_settings.Shading.ShadingType);
+
+        // RENDER EACH TRIANGLE OF THE MESH.
+        if (mesh.IsIndexed())
+        {
+            // TRANSFORM EACH UNIQUE VERTEX INTO WORLD SPACE.
+            // This is only done once per vertex, regardless of how many triangles share the vertex,
+            // and is reused across rendering passes and frames until the world transform changes.
+            // Vertices are also lit once if lighting doesn't depend on triangles.  Shadows depend on other meshes
+            // that may move independently, so vertices with shadows are lit per triangle instead.
+            bool vertices_lit = (
+                rendering_settings.ColorWrites &&
+                shadow_maps.empty() &&
+                LitVertexCache::VertexLightingCacheable(mesh, rendering_settings.Shading.Lighting));
+            const LitVertexCache::MeshEntry& cached_mesh = vertices_lit ?
+                lit_vertex_cache.GetLitVertices(mesh, object_world_transform, lights, camera.WorldPosition, rendering_settings.Shading.Lighting, light_grid) :
+                lit_vertex_cache.GetWorldSpaceVertices(mesh, object_world_transform);
+            const std::vector<VertexWithAttributes>& world_space_vertices = cached_mesh.WorldSpaceVertices;
+
+            // RENDER THE TRIANGLES FOR EACH SUBSET OF THE MESH.
+            for (std::size_t subset_index = 0; subset_index < mesh.Subsets.size(); ++subset_index)
+            {
+                const MeshSubset& subset = mesh.Subsets[subset_index];
+                const std::vector<Color>* lit_vertex_colors = vertices_lit ?
+                    &cached_mesh.LitVertexColorsByMaterialIndex[cached_mesh.SubsetMaterialIndices[subset_index]] :
+                    nullptr;
+
+                std::size_t subset_end_index = static_cast<std::size_t>(subset.FirstIndex) + subset.IndexCount;
+                for (std::size_t first_index_index = subset.FirstIndex; first_index_index < subset_end_index; first_index_index += GEOMETRY::Triangle::VERTEX_COUNT)
+                {
+                    // ASSEMBLE THE WORLD SPACE TRIANGLE FROM ITS INDEXED VERTICES.
+                    GEOMETRY::Triangle world_space_triangle;
+                    world_space_triangle.Material = subset.Material;
+                    for (std::size_t vertex_index = 0; vertex_index < GEOMETRY::Triangle::VERTEX_COUNT; ++vertex_index)
+                    {
+                        uint32_t mesh_vertex_index = mesh.Indices[first_index_index + vertex_index];
+                        world_space_triangle.Vertices[vertex_index] = world_space_vertices[mesh_vertex_index];
+                        if (lit_vertex_colors)
+                        {
+                            world_space_triangle.Vertices[vertex_index].Color = (*lit_vertex_colors)[mesh_vertex_index];
+                        }
+                    }
+
+                    // RENDER THE TRIANGLE.
+                    if (wireframe_rendering)
+                    {
+                        // ADD ANY NEW EDGES OF THE TRIANGLE TO THE WIREFRAME.
+                        std::optional<GEOMETRY::Triangle> screen_space_triangle = ComputeShadedScreenSpaceTriangle(
+                            world_space_triangle,
+                            lights,
+                            light_grid,
+                            shadow_maps,
+                            camera,
+                            viewing_transformations,
+                            rendering_settings,
+                            vertices_lit);
+                        if (!screen_space_triangle)
+                        {
+                            continue;
+                        }
+
+                        for (std::size_t start_vertex_index = 0; start_vertex_index < GEOMETRY::Triangle::VERTEX_COUNT; ++start_vertex_index)
+                        {
+                            std::size_t end_vertex_index = (start_vertex_index + 1) % GEOMETRY::Triangle::VERTEX_COUNT;
+                            wireframe_line_batch.AddEdge(
+                                mesh.Indices[first_index_index + start_vertex_index],
+                                mesh.Indices[first_index_index + end_vertex_index],
+                                screen_space_triangle->Vertices[start_vertex_index],
+                                screen_space_triangle->Vertices[end_vertex_index]);
+                        }
+                    }
+                    else
+                    {
+                        RenderWorldSpaceTriangle(
+                            world_space_triangle,
+                            lights,
+                            light_grid,
+                            shadow_maps,
+                            camera,
+                            viewing_transformations,
+                            rendering_settings,
+                            output_bitmap,
+                            depth_buffer,
+                            vertices_lit);
+                    }
+                }
+            }
+        }
+        else
+        {
             for (const auto& local_triangle : mesh.Triangles)
             {
                 // TRANSFORM THE TRIANGLE INTO WORLD SPACE.
                 GEOMETRY::Triangle world_space_triangle = TransformLocalToWorld(local_triangle, object_world_transform);
 
-                // CULL BACKFACES IF APPLICABLE.
-                MATH::Vector3f unit_surface_normal = world_space_triangle.SurfaceNormal();
-                if (rendering_settings.CullBackfaces)
+                // RENDER THE TRIANGLE.
+                if (wireframe_rendering)
                 {
-                    // If the surface normal is facing opposite of the camera's view direction (negative dot product),
-                    // then the surface normal should be facing the camera.
-                    MATH::Vector3f view_direction = -camera.CoordinateFrame.Forward;
-                    float surface_normal_camera_view_direction_dot_product = MATH::Vector3f::DotProduct(unit_surface_normal, view_direction);
-                    bool triangle_facing_toward_camera = (surface_normal_camera_view_direction_dot_product < 0.0f);
-                    if (!triangle_facing_toward_camera)
+                    // ADD THE EDGES OF THE TRIANGLE TO THE WIREFRAME.
+                    // Non-indexed triangles don't share vertices, so there's no cheap way to identify shared edges.
+                    std::optional<GEOMETRY::Triangle> screen_space_triangle = ComputeShadedScreenSpaceTriangle(
+                        world_space_triangle,
+                        lights,
+                        light_grid,
+                        shadow_maps,
+                        camera,
+                        viewing_transformations,
+                        rendering_settings);
+                    if (!screen_space_triangle)
                     {
                         continue;
                     }
+
+                    for (std::size_t start_vertex_index = 0; start_vertex_index < GEOMETRY::Triangle::VERTEX_COUNT; ++start_vertex_index)
+                    {
+                        std::size_t end_vertex_index = (start_vertex_index + 1) % GEOMETRY::Triangle::VERTEX_COUNT;
+                        wireframe_line_batch.Add(
+                            screen_space_triangle->Vertices[start_vertex_index],
+                            screen_space_triangle->Vertices[end_vertex_index]);
+                    }
+                }
+                else
+                {
+                    RenderWorldSpaceTriangle(world_space_triangle, lights, light_grid, shadow_maps, camera, viewing_transformations, rendering_settings, output_bitmap, depth_buffer);
+                }
+            }
+        }
+
+        // RENDER ANY WIREFRAME FOR THE MESH.
+        Render(wireframe_line_batch, output_bitmap, depth_buffer);
+        wireframe_line_batch.Clear();
+    }
+
+    /// Renders all items in a render queue with deferred lighting.  Surface attributes of opaque items are first
+    /// written to a G-buffer, and then lighting is computed once for each visible pixel.  Transparent items
+    /// are rendered normally afterward since they need to blend over what's behind them.
+    /// @param[in]  render_queue - The sorted queue of items to render.
+    /// @param[in]  lights - Any lights that should illuminate the items.
+    /// @param[in]  shadow_maps - Shadow maps for any lights that cast shadows.
+    /// @param[in]  camera - The camera through which the items are being viewed.
+    /// @param[in]  rendering_settings - The settings to use for rendering.
+    /// @param[in,out]  lit_vertex_cache - The cache to use for transformed vertices.
+    /// @param[in,out]  g_buffer - The G-buffer to write surface attributes to.  Resized to the output bitmap if needed.
+    /// @param[in,out]  output_bitmap - The bitmap to render to.
+    /// @param[in,out]  depth_buffer - The depth buffer to use for any depth buffering.
+    void CpuRasterizationAlgorithm::RenderDeferred(
+        const RenderQueue& render_queue,
+        const std::vector<SHADING::LIGHTING::Light>& lights,
+        const std::vector<ShadowMap>& shadow_maps,
+        const VIEWING::Camera& camera,
+        const RenderingSettings& rendering_settings,
+        LitVertexCache& lit_vertex_cache,
+        GBuffer& g_buffer,
+        IMAGES::Bitmap& output_bitmap,
+        DepthBuffer* depth_buffer)
+    {
+        // GET RE-USED TRANSFORMATIONS.
+        VIEWING::ViewingTransformations viewing_transformations(camera, output_bitmap);
+        viewing_transformations.ReversedZ = (depth_buffer && depth_buffer->IsReversedZ());
+
+        // WRITE THE SURFACE ATTRIBUTES OF EACH OPAQUE ITEM TO THE G-BUFFER.
+        // Opaque items are sorted before all transparent items.
+        g_buffer.Resize(output_bitmap.GetWidthInPixels(), output_bitmap.GetHeightInPixels());
+        g_buffer.Clear();
+        RenderQueue transparent_render_queue;
+        for (const RenderQueue::DrawItem& draw_item : render_queue.Items)
+        {
+            bool item_transparent = (draw_item.SortKey & RenderQueue::TRANSPARENT_SORT_KEY_BIT);
+            if (item_transparent)
+            {
+                transparent_render_queue.Items.emplace_back(draw_item);
+                continue;
+            }
+
+            RenderMeshToGBuffer(
+                *draw_item.Mesh,
+                draw_item.WorldTransform,
+                camera,
+                viewing_transformations,
+                rendering_settings,
+                lit_vertex_cache,
+                g_buffer,
+                depth_buffer);
+        }
+
+        // LIGHT ALL VISIBLE PIXELS.
+        DeferredLightingAlgorithm::Apply(
+            g_buffer,
+            lights,
+            shadow_maps,
+            camera.WorldPosition,
+            viewing_transformations,
+            rendering_settings.Shading,
+            output_bitmap);
+
+        // RENDER TRANSPARENT ITEMS OVER THE LIT PIXELS.
+        Render(transparent_render_queue, lights, shadow_maps, camera, rendering_settings, lit_vertex_cache, output_bitmap, depth_buffer);
+    }
+
+    /// Writes the surface attributes of a single mesh to a G-buffer.
+    /// Triangles without materials have no surface attributes to light and are skipped.
+    /// @param[in]  mesh - The mesh to render.
+    /// @param[in]  object_world_transform - The transform from the mesh's local space into world space.
+    /// @param[in]  camera - The camera through which the mesh is being viewed.
+    /// @param[in]  viewing_transformations - The viewing transformations for the camera.
+    /// @param[in]  rendering_settings - The settings to use for rendering.
+    /// @param[in,out]  lit_vertex_cache - The cache to use for transformed vertices of indexed meshes.
+    /// @param[in,out]  g_buffer - The G-buffer to write to.
+    /// @param[in,out]  depth_buffer - The depth buffer to use for any depth buffering.
+    void CpuRasterizationAlgorithm::RenderMeshToGBuffer(
+        const Mesh& mesh,
+        const MATH::AffineTransform3x4& object_world_transform,
+        const VIEWING::Camera& camera,
+        const VIEWING::ViewingTransformations& viewing_transformations,
+        const RenderingSettings& rendering_settings,
+        LitVertexCache& lit_vertex_cache,
+        GBuffer& g_buffer,
+        DepthBuffer* depth_buffer)
+    {
+        // ASSEMBLE EACH WORLD SPACE TRIANGLE OF THE MESH.
+        // Only indexed meshes have vertex normals transformed into world space.
+        bool interpolate_vertex_normals = (mesh.IsIndexed() && rendering_settings.Shading.Lighting.VertexNormalsEnabled);
+        std::vector<GEOMETRY::Triangle> world_space_triangles;
+        if (mesh.IsIndexed())
+        {
+            const std::vector<VertexWithAttributes>& world_space_vertices = lit_vertex_cache.GetWorldSpaceVertices(mesh, object_world_transform).WorldSpaceVertices;
+            for (const MeshSubset& subset : mesh.Subsets)
+            {
+                std::size_t subset_end_index = static_cast<std::size_t>(subset.FirstIndex) + subset.IndexCount;
+                for (std::size_t first_index_index = subset.FirstIndex; first_index_index < subset_end_index; first_index_index += GEOMETRY::Triangle::VERTEX_COUNT)
+                {
+                    GEOMETRY::Triangle& world_space_triangle = world_space_triangles.emplace_back();
+                    world_space_triangle.Material = subset.Material;
+                    for (std::size_t vertex_index = 0; vertex_index < GEOMETRY::Triangle::VERTEX_COUNT; ++vertex_index)
+                    {
+                        uint32_t mesh_vertex_index = mesh.Indices[first_index_index + vertex_index];
+                        world_space_triangle.Vertices[vertex_index] = world_space_vertices[mesh_vertex_index];
+                    }
                 }
+            }
+        }
+        else
+        {
+            for (const auto& local_triangle : mesh.Triangles)
+            {
+                world_space_triangles.emplace_back(TransformLocalToWorld(local_triangle, object_world_transform));
+            }
+        }
 
-                // TRANSFORM THE TRIANGLE FOR PROPER CAMERA VIEWING.
-                std::optional<GEOMETRY::Triangle> screen_space_triangle = viewing_transformations.Apply(world_space_triangle);
-                if (!screen_space_triangle)
+        // RENDER EACH TRIANGLE TO THE G-BUFFER.
+        for (const GEOMETRY::Triangle& world_space_triangle : world_space_triangles)
+        {
+            // SKIP TRIANGLES WITHOUT MATERIALS.
+            uint16_t material_id = g_buffer.GetMaterialId(world_space_triangle.Material);
+            if (GBuffer::NO_MATERIAL_ID == material_id)
+            {
+                continue;
+            }
+
+            // CULL BACKFACES IF APPLICABLE.
+            if (rendering_settings.CullBackfaces)
+            {
+                // If the surface normal is facing opposite of the camera's view direction (negative dot product),
+                // then the surface normal should be facing the camera.
+                MATH::Vector3f unit_surface_normal = world_space_triangle.SurfaceNormal();
+                MATH::Vector3f view_direction = -camera.CoordinateFrame.Forward;
+                float surface_normal_camera_view_direction_dot_product = MATH::Vector3f::DotProduct(unit_surface_normal, view_direction);
+                bool triangle_facing_toward_camera = (surface_normal_camera_view_direction_dot_product < 0.0f);
+                if (!triangle_facing_toward_camera)
                 {
                     continue;
                 }
+            }
+
+            // TRANSFORM THE TRIANGLE FOR PROPER CAMERA VIEWING.
+            std::optional<GEOMETRY::Triangle> screen_space_triangle = viewing_transformations.Apply(world_space_triangle);
+            if (!screen_space_triangle)
+            {
+                continue;
+            }
+
+            // WRITE THE TRIANGLE'S PIXELS.
+            RasterizeToGBuffer(
+                world_space_triangle,
+                *screen_space_triangle,
+                material_id,
+                interpolate_vertex_normals,
+                rendering_settings,
+                g_buffer,
+                depth_buffer);
+        }
+    }
+
+    /// Rasterizes a single triangle into a G-buffer.
+    /// @param[in]  world_space_triangle - The world space triangle, for surface normals.
+    /// @param[in]  screen_space_triangle - The screen space triangle to rasterize.
+    /// @param[in]  material_id - The G-buffer ID for the triangle's material.
+    /// @param[in]  interpolate_vertex_normals - True if the triangle's vertex normals (which must be in world space)
+    ///     should be interpolated across pixels; false to use the triangle's surface normal for all pixels.
+    /// @param[in]  rendering_settings - The settings to use for rendering.
+    /// @param[in,out]  g_buffer - The G-buffer to write to.
+    /// @param[in,out]  depth_buffer - The depth buffer to use for any depth buffering.
+    void CpuRasterizationAlgorithm::RasterizeToGBuffer(
+        const GEOMETRY::Triangle& world_space_triangle,
+        const GEOMETRY::Triangle& screen_space_triangle,
+        const uint16_t material_id,
+        const bool interpolate_vertex_normals,
+        const RenderingSettings& rendering_settings,
+        GBuffer& g_buffer,
+        DepthBuffer* depth_buffer)
+    {
+        // GET THE VERTICES.
+        const VertexWithAttributes& first_vertex = screen_space_triangle.Vertices[0];
+        const VertexWithAttributes& second_vertex = screen_space_triangle.Vertices[1];
+        const VertexWithAttributes& third_vertex = screen_space_triangle.Vertices[2];
+
+        // GET THE BOUNDING RECTANGLE OF THE TRIANGLE.
+        // This is clamped the same as for regular rasterization so that the same pixels are covered.
+        float min_x = std::min({ first_vertex.Position.X, second_vertex.Position.X, third_vertex.Position.X });
+        float max_x = std::max({ first_vertex.Position.X, second_vertex.Position.X, third_vertex.Position.X });
+        float min_y = std::min({ first_vertex.Position.Y, second_vertex.Position.Y, third_vertex.Position.Y });
+        float max_y = std::max({ first_vertex.Position.Y, second_vertex.Position.Y, third_vertex.Position.Y });
+
+        constexpr float MIN_BITMAP_COORDINATE = 1.0f;
+
+        float max_x_position = static_cast<float>(g_buffer.GetWidthInPixels() - 1);
+        float clamped_min_x = MATH::Number::Clamp<float>(min_x, MIN_BITMAP_COORDINATE, max_x_position);
+        float clamped_max_x = MATH::Number::Clamp<float>(max_x, MIN_BITMAP_COORDINATE, max_x_position);
+
+        float max_y_position = static_cast<float>(g_buffer.GetHeightInPixels() - 1);
+        float clamped_min_y = MATH::Number::Clamp<float>(min_y, MIN_BITMAP_COORDINATE, max_y_position);
+        float clamped_max_y = MATH::Number::Clamp<float>(max_y, MIN_BITMAP_COORDINATE, max_y_position);
 
-                // COMPUTE VERTEX COLORS.
-                for (std::size_t vertex_index = 0; vertex_index < GEOMETRY::Triangle::VERTEX_COUNT; ++vertex_index)
+        // DETERMINE WHICH TEXTURES NEED TO BE APPLIED.
+        // These checks are done once per triangle rather than per pixel.
+        TriangleTextures triangle_textures = GetTriangleTextures(screen_space_triangle, rendering_settings.Shading);
+        bool any_texture_exists = (triangle_textures.Count > 0);
+
+        // WRITE PIXELS WITHIN THE TRIANGLE.
+        MATH::Vector3f unit_surface_normal = world_space_triangle.SurfaceNormal();
+        constexpr float ONE_PIXEL = 1.0f;
+        for (float y = clamped_min_y; y <= clamped_max_y; y += ONE_PIXEL)
+        {
+            for (float x = clamped_min_x; x <= clamped_max_x; x += ONE_PIXEL)
+            {
+                // CHECK IF THE CURRENT PIXEL IS WITHIN THE TRIANGLE.
+                MATH::Vector2f current_point(x, y);
+                MATH::Vector3f current_point_barycentric_coordinates = screen_space_triangle.BarycentricCoordinates2DOf(current_point);
+                bool pixel_in_triangle = (
+                    (0.0f <= current_point_barycentric_coordinates.X && current_point_barycentric_coordinates.X <= 1.0f) &&
+                    (0.0f <= current_point_barycentric_coordinates.Y && current_point_barycentric_coordinates.Y <= 1.0f) &&
+                    (0.0f <= current_point_barycentric_coordinates.Z && current_point_barycentric_coordinates.Z <= 1.0f));
+                if (!pixel_in_triangle)
                 {
-                    // SHADE THE CURRENT VERTEX.
-                    const VertexWithAttributes& current_world_vertex = world_space_triangle.Vertices[vertex_index];
-
-                    /// @todo   Think about whether we want a triangle-only version of this.
-                    Surface surface = { .Shape = &world_space_triangle };
-                    SHADING::ShadingSettings vertex_shading_settings = rendering_settings.Shading;
-                    vertex_shading_settings.TextureMappingEnabled = false;
-                    const std::vector<float> NO_SHADOWING;
-                    Color final_vertex_color = SHADING::WorldSpaceShading::ComputeMaterialShading(
-                        current_world_vertex.Position,
-                        surface,
-                        camera.WorldPosition,
-                        lights,
-                        NO_SHADOWING,
-                        vertex_shading_settings);
+                    continue;
+                }
+
+                // SKIP THE PIXEL IF ANOTHER PIXEL IS ALREADY IN FRONT OF IT.
+                float interpolated_z = (
+                    (current_point_barycentric_coordinates.X * second_vertex.Position.Z) +
+                    (current_point_barycentric_coordinates.Y * third_vertex.Position.Z) +
+                    (current_point_barycentric_coordinates.Z * first_vertex.Position.Z));
+                // The coordinates need to be rounded to integer in order to plot a pixel on a fixed grid.
+                unsigned int current_pixel_x = static_cast<unsigned int>(std::round(x));
+                unsigned int current_pixel_y = static_cast<unsigned int>(std::round(y));
+                if (depth_buffer)
+                {
+                    bool current_pixel_in_front_of_old_pixels = depth_buffer->TestDepth(current_pixel_x, current_pixel_y, interpolated_z);
+                    if (!current_pixel_in_front_of_old_pixels)
+                    {
+                        continue;
+                    }
+
+                    depth_buffer->WriteDepth(current_pixel_x, current_pixel_y, interpolated_z);
+                }
+
+                // COMPUTE THE SURFACE NORMAL.
+                MATH::Vector3f pixel_normal = unit_surface_normal;
+                if (interpolate_vertex_normals)
+                {
+                    const MATH::Vector3f& first_vertex_normal = world_space_triangle.Vertices[0].Normal;
+                    const MATH::Vector3f& second_vertex_normal = world_space_triangle.Vertices[1].Normal;
+                    const MATH::Vector3f& third_vertex_normal = world_space_triangle.Vertices[2].Normal;
+                    MATH::Vector3f interpolated_normal(
+                        (current_point_barycentric_coordinates.X * second_vertex_normal.X) +
+                        (current_point_barycentric_coordinates.Y * third_vertex_normal.X) +
+                        (current_point_barycentric_coordinates.Z * first_vertex_normal.X),
+                        (current_point_barycentric_coordinates.X * second_vertex_normal.Y) +
+                        (current_point_barycentric_coordinates.Y * third_vertex_normal.Y) +
+                        (current_point_barycentric_coordinates.Z * first_vertex_normal.Y),
+                        (current_point_barycentric_coordinates.X * second_vertex_normal.Z) +
+                        (current_point_barycentric_coordinates.Y * third_vertex_normal.Z) +
+                        (current_point_barycentric_coordinates.Z * first_vertex_normal.Z));
+                    pixel_normal = MATH::Vector3f::Normalize(interpolated_normal);
+                }
 
-                    screen_space_triangle->Vertices[vertex_index].Color = final_vertex_color;
+                // COMPUTE THE ALBEDO FROM ANY TEXTURES.
+                // If no textures exist, lighting shouldn't be modulated at all.
+                Color albedo = Color::WHITE;
+                if (any_texture_exists)
+                {
+                    Color texture_color = ComputeTextureColor(screen_space_triangle, current_point, triangle_textures);
+                    bool texture_coloring_exists = (Color::BLACK != texture_color);
+                    if (texture_coloring_exists)
+                    {
+                        // Albedos are packed into 8-bit components, so they must be within the proper range.
+                        albedo = texture_color;
+                        albedo.Clamp();
+                    }
                 }
 
-                // RENDER THE FINAL SCREEN SPACE TRIANGLE.
-                Render(*screen_space_triangle, rendering_settings, output_bitmap, depth_buffer);
+                // WRITE THE SURFACE ATTRIBUTES.
+                g_buffer.WritePixel(current_pixel_x, current_pixel_y, pixel_normal, albedo, material_id, interpolated_z);
+            }
+        }
+    }
+
+    /// Renders a single world space triangle to the render target, including culling, shading, and viewing transformations.
+    /// @param[in]  world_space_triangle - The world space triangle to render.
+    /// @param[in]  lights - Any lights that should illuminate the triangle.
+    /// @param[in]  light_grid - The lights culled to clusters of the viewing frustum, if any.
+    ///     All lights are used for shading if null.
+    /// @param[in]  shadow_maps - Shadow maps for any lights that cast shadows.
+    /// @param[in]  camera - The camera through which the triangle is being viewed.
+    /// @param[in]  viewing_transformations - The viewing transformations for the camera.
+    /// @param[in]  rendering_settings - The settings to use for rendering.
+    /// @param[in,out]  output_bitmap - The bitmap to render to.
+    /// @param[in,out]  depth_buffer - The depth buffer to use for any depth buffering.
+    /// @param[in]  vertices_already_shaded - True if vertex colors of the triangle are already shaded; false if they need to be shaded.
+    void CpuRasterizationAlgorithm::RenderWorldSpaceTriangle(
+        const GEOMETRY::Triangle& world_space_triangle,
+        const std::vector<SHADING::LIGHTING::Light>& lights,
+        const ClusteredLightGrid* light_grid,
+        const std::vector<ShadowMap>& shadow_maps,
+        const VIEWING::Camera& camera,
+        const VIEWING::ViewingTransformations& viewing_transformations,
+        const RenderingSettings& rendering_settings,
+        IMAGES::Bitmap& output_bitmap,
+        DepthBuffer* depth_buffer,
+        const bool vertices_already_shaded)
+    {
+        // SHADE AND TRANSFORM THE TRIANGLE INTO SCREEN SPACE.
+        std::optional<GEOMETRY::Triangle> screen_space_triangle = ComputeShadedScreenSpaceTriangle(
+            world_space_triangle,
+            lights,
+            light_grid,
+            shadow_maps,
+            camera,
+            viewing_transformations,
+            rendering_settings,
+            vertices_already_shaded);
+        if (!screen_space_triangle)
+        {
+            return;
+        }
+
+        // RENDER THE FINAL SCREEN SPACE TRIANGLE.
+        Render(*screen_space_triangle, rendering_settings, output_bitmap, depth_buffer);
+    }
+
+    /// Computes the shaded screen space version of a world space triangle, including culling, shading, and viewing transformations.
+    /// @param[in]  world_space_triangle - The world space triangle to shade and transform.
+    /// @param[in]  lights - Any lights that should illuminate the triangle.
+    /// @param[in]  light_grid - The lights culled to clusters of the viewing frustum, if any.
+    ///     All lights are used for shading if null.
+    /// @param[in]  shadow_maps - Shadow maps for any lights that cast shadows.
+    /// @param[in]  camera - The camera through which the triangle is being viewed.
+    /// @param[in]  viewing_transformations - The viewing transformations for the camera.
+    /// @param[in]  rendering_settings - The settings to use for rendering.
+    /// @param[in]  vertices_already_shaded - True if vertex colors of the triangle are already shaded; false if they need to be shaded.
+    /// @return The screen space triangle with shaded vertex colors; null if the triangle was culled or clipped.
+    std::optional<GEOMETRY::Triangle> CpuRasterizationAlgorithm::ComputeShadedScreenSpaceTriangle(
+        const GEOMETRY::Triangle& world_space_triangle,
+        const std::vector<SHADING::LIGHTING::Light>& lights,
+        const ClusteredLightGrid* light_grid,
+        const std::vector<ShadowMap>& shadow_maps,
+        const VIEWING::Camera& camera,
+        const VIEWING::ViewingTransformations& viewing_transformations,
+        const RenderingSettings& rendering_settings,
+        const bool vertices_already_shaded)
+    {
+        // CULL BACKFACES IF APPLICABLE.
+        MATH::Vector3f unit_surface_normal = world_space_triangle.SurfaceNormal();
+        if (rendering_settings.CullBackfaces)
+        {
+            // If the surface normal is facing opposite of the camera's view direction (negative dot product),
+            // then the surface normal should be facing the camera.
+            MATH::Vector3f view_direction = -camera.CoordinateFrame.Forward;
+            float surface_normal_camera_view_direction_dot_product = MATH::Vector3f::DotProduct(unit_surface_normal, view_direction);
+            bool triangle_facing_toward_camera = (surface_normal_camera_view_direction_dot_product < 0.0f);
+            if (!triangle_facing_toward_camera)
+            {
+                return std::nullopt;
             }
         }
+
+        // TRANSFORM THE TRIANGLE FOR PROPER CAMERA VIEWING.
+        std::optional<GEOMETRY::Triangle> screen_space_triangle = viewing_transformations.Apply(world_space_triangle);
+        if (!screen_space_triangle)
+        {
+            return std::nullopt;
+        }
+
+        // COMPUTE VERTEX COLORS.
+        // Shading is skipped if only depths are being written since the colors would never be used.
+        bool vertices_need_shading = (rendering_settings.ColorWrites && !vertices_already_shaded);
+        std::size_t shaded_vertex_count = vertices_need_shading ? GEOMETRY::Triangle::VERTEX_COUNT : 0;
+        /// @todo   Think about whether we want a triangle-only version of this.
+        Surface surface = { .Shape = &world_space_triangle };
+        SHADING::ShadingSettings vertex_shading_settings = rendering_settings.Shading;
+        vertex_shading_settings.TextureMappingEnabled = false;
+        std::vector<float> shadow_factors_by_light_index;
+        for (std::size_t vertex_index = 0; vertex_index < shaded_vertex_count; ++vertex_index)
+        {
+            // SHADE THE CURRENT VERTEX.
+            // Only lights that may reach the vertex's cluster need to be considered.
+            const VertexWithAttributes& current_world_vertex = world_space_triangle.Vertices[vertex_index];
+            const std::vector<SHADING::LIGHTING::Light>& vertex_lights = light_grid ? light_grid->GetLights(current_world_vertex.Position) : lights;
+            ShadowMap::ComputeShadowFactors(shadow_maps, vertex_lights, current_world_vertex.Position, unit_surface_normal, shadow_factors_by_light_index);
+            Color final_vertex_color = SHADING::WorldSpaceShading::ComputeMaterialShading(
+                current_world_vertex.Position,
+                surface,
+                camera.WorldPosition,
+                vertex_lights,
+                shadow_factors_by_light_index,
+                vertex_shading_settings);
+
+            screen_space_triangle->Vertices[vertex_index].Color = final_vertex_color;
+        }
+
+        return screen_space_triangle;
+    }
+
+    /// Transforms vertices from local coordinates to world coordinates.
+    /// @param[in]  local_vertices - The local vertices to transform.
+    /// @param[in]  world_transform - The world transformation for the vertices.
+    /// @return The world space vertices, in the same order as the local vertices.
+    std::vector<VertexWithAttributes> CpuRasterizationAlgorithm::TransformLocalToWorld(const std::vector<VertexWithAttributes>& local_vertices, const MATH::AffineTransform3x4& world_transform)
+    {
+        // TRANSFORM EACH VERTEX.
+        // Non-positional attributes of the vertices are preserved.
+        std::vector<VertexWithAttributes> world_space_vertices = local_vertices;
+        for (VertexWithAttributes& world_vertex : world_space_vertices)
+        {
+            world_vertex.Position = world_transform.TransformPoint(world_vertex.Position);
+        }
+
+        return world_space_vertices;
     }
 
     /// Transforms a triangle from local coordinates to world coordinates.
     /// @param[in]  local_triangle - The local triangle to transform.
     /// @param[in]  world_transform - The world transformation for the triangle.
     /// @return The world space triangle.
-    GEOMETRY::Triangle CpuRasterizationAlgorithm::TransformLocalToWorld(const GEOMETRY::Triangle& local_triangle, const MATH::Matrix4x4f& world_transform)
+    GEOMETRY::Triangle CpuRasterizationAlgorithm::TransformLocalToWorld(const GEOMETRY::Triangle& local_triangle, const MATH::AffineTransform3x4& world_transform)
     {
         // TRANSFORM EACH VERTEX OF THE TRIANGLE.
         GEOMETRY::Triangle world_space_triangle = local_triangle;
 
-        std::size_t triangle_vertex_count = world_space_triangle.Vertices.size();
-        for (std::size_t vertex_index = 0; vertex_index < triangle_vertex_count; ++vertex_index)
+        std::size_t triangle_vertex_count = world_space_triangle.Vertices.size();
+        for (std::size_t vertex_index = 0; vertex_index < triangle_vertex_count; ++vertex_index)
+        {
+            // TRANFORM THE CURRENT LOCAL VERTEX INTO WORLD SPACE.
+            const MATH::Vector3f& local_vertex = local_triangle.Vertices[vertex_index].Position;
+            VertexWithAttributes& world_vertex = world_space_triangle.Vertices[vertex_index];
+            world_vertex.Position = world_transform.TransformPoint(local_vertex);
+        }
+
+        return world_space_triangle;
+    }
+
+    /// Gets the flags for how a triangle needs to be rasterized.
+    /// @param[in]  triangle_textures - The textures that apply to the triangle.
+    /// @param[in]  rendering_settings - The settings to use for rendering.
+    /// @param[in]  depth_buffer - The depth buffer to use for any depth buffering.
+    /// @return The normalized TRIANGLE_RASTERIZATION_* flags for the triangle.
+    unsigned int CpuRasterizationAlgorithm::GetTriangleRasterizationFlags(
+        const TriangleTextures& triangle_textures,
+        const RenderingSettings& rendering_settings,
+        const DepthBuffer* const depth_buffer)
+    {
+        unsigned int rasterization_flags = 0;
+
+        bool is_flat_shading = (SHADING::ShadingType::FLAT == rendering_settings.Shading.ShadingType);
+        if (is_flat_shading)
+        {
+            rasterization_flags |= TRIANGLE_RASTERIZATION_FLAT_SHADING;
+        }
+
+        bool any_texture_exists = (triangle_textures.Count > 0);
+        if (any_texture_exists)
+        {
+            rasterization_flags |= TRIANGLE_RASTERIZATION_TEXTURE_MAPPING;
+        }
+
+        // Nearest filtering produces the same results for either version of a texture but doesn't require computing mipmap levels.
+        bool mipmapping_enabled = (TextureFilteringType::NEAREST != triangle_textures.Filtering);
+        bool any_mipmapped_texture_exists = std::any_of(
+            triangle_textures.Textures.cbegin(),
+            triangle_textures.Textures.cbegin() + triangle_textures.Count,
+            [](const TriangleTexture& triangle_texture) { return nullptr != triangle_texture.MipmappedTexture; });
+        if (mipmapping_enabled && any_mipmapped_texture_exists)
+        {
+            rasterization_flags |= TRIANGLE_RASTERIZATION_MIPMAPPING;
+        }
+
+        if (depth_buffer)
+        {
+            rasterization_flags |= TRIANGLE_RASTERIZATION_DEPTH_BUFFERING;
+        }
+
+        if (rendering_settings.ColorWrites)
+        {
+            rasterization_flags |= TRIANGLE_RASTERIZATION_COLOR_WRITES;
+        }
+
+        return NormalizeTriangleRasterizationFlags(rasterization_flags);
+    }
+
+    /// Removes triangle rasterization flags that don't have any effect given other flags.
+    /// This avoids instantiating different versions of rasterization that would behave identically.
+    /// @param[in]  rasterization_flags - The TRIANGLE_RASTERIZATION_* flags to normalize.
+    /// @return The normalized flags.
+    constexpr unsigned int CpuRasterizationAlgorithm::NormalizeTriangleRasterizationFlags(const unsigned int rasterization_flags)
+    {
+        unsigned int normalized_rasterization_flags = rasterization_flags;
+
+        // Shading doesn't matter if colors aren't written.
+        bool color_writes = (0 != (normalized_rasterization_flags & TRIANGLE_RASTERIZATION_COLOR_WRITES));
+        if (!color_writes)
+        {
+            normalized_rasterization_flags &= ~(TRIANGLE_RASTERIZATION_FLAT_SHADING | TRIANGLE_RASTERIZATION_TEXTURE_MAPPING | TRIANGLE_RASTERIZATION_MIPMAPPING);
+        }
+
+        // Flat shading doesn't use textures.
+        bool is_flat_shading = (0 != (normalized_rasterization_flags & TRIANGLE_RASTERIZATION_FLAT_SHADING));
+        if (is_flat_shading)
         {
-            // TRANFORM THE CURRENT LOCAL VERTEX INTO WORLD SPACE.
-            const MATH::Vector3f& local_vertex = local_triangle.Vertices[vertex_index].Position;
-            MATH::Vector4f local_homogeneous_vertex = MATH::Vector4f::HomogeneousPositionVector(local_vertex);
+            normalized_rasterization_flags &= ~(TRIANGLE_RASTERIZATION_TEXTURE_MAPPING | TRIANGLE_RASTERIZATION_MIPMAPPING);
+        }
 
-            MATH::Vector4f world_homogeneous_vertex = world_transform * local_homogeneous_vertex;
-            VertexWithAttributes& world_vertex = world_space_triangle.Vertices[vertex_index];
-            world_vertex.Position = MATH::Vector3f(world_homogeneous_vertex.X, world_homogeneous_vertex.Y, world_homogeneous_vertex.Z);
+        // Mipmapping only applies to textures.
+        bool texture_mapping = (0 != (normalized_rasterization_flags & TRIANGLE_RASTERIZATION_TEXTURE_MAPPING));
+        if (!texture_mapping)
+        {
+            normalized_rasterization_flags &= ~TRIANGLE_RASTERIZATION_MIPMAPPING;
         }
 
-        return world_space_triangle;
+        return normalized_rasterization_flags;
+    }
+
+    /// Gets the non-SIMD triangle rasterization functions for all combinations of flags.
+    /// Mipmap levels are computed per pixel in the non-SIMD version, so the mipmapping flag is ignored.
+    /// @param[in]  all_rasterization_flags - All combinations of TRIANGLE_RASTERIZATION_* flags.
+    ///     Only used to deduce the flags, so it's unnamed to avoid unused parameter warnings.
+    /// @return The rasterization functions, indexed by flags.
+    template <unsigned int... RASTERIZATION_FLAGS>
+    constexpr std::array<CpuRasterizationAlgorithm::TriangleRasterizationFunction, sizeof...(RASTERIZATION_FLAGS)> CpuRasterizationAlgorithm::GetRasterizationFunctions(
+        std::integer_sequence<unsigned int, RASTERIZATION_FLAGS...> /*all_rasterization_flags*/)
+    {
+        return { &Rasterize<NormalizeTriangleRasterizationFlags(RASTERIZATION_FLAGS) & ~TRIANGLE_RASTERIZATION_MIPMAPPING>... };
+    }
+
+    /// Gets the SIMD triangle rasterization functions for all combinations of flags.
+    /// @param[in]  all_rasterization_flags - All combinations of TRIANGLE_RASTERIZATION_* flags.
+    ///     Only used to deduce the flags, so it's unnamed to avoid unused parameter warnings.
+    /// @return The rasterization functions, indexed by flags.
+    template <unsigned int... RASTERIZATION_FLAGS>
+    constexpr std::array<CpuRasterizationAlgorithm::TriangleRasterizationFunction, sizeof...(RASTERIZATION_FLAGS)> CpuRasterizationAlgorithm::GetRasterizationFunctionsSimd8x(
+        std::integer_sequence<unsigned int, RASTERIZATION_FLAGS...> /*all_rasterization_flags*/)
+    {
+        return { &RasterizeSimd8x<NormalizeTriangleRasterizationFlags(RASTERIZATION_FLAGS)>... };
     }
 
     /// Renders a single triangle to the render target.
@@ -205,6 +1317,14 @@ namespace GRAPHICS::CPU_RENDERING
         const VertexWithAttributes& second_vertex = triangle.Vertices[1];
         const VertexWithAttributes& third_vertex = triangle.Vertices[2];
 
+        // SKIP WIREFRAME TRIANGLES IF ONLY DEPTHS ARE BEING WRITTEN.
+        // Lines don't cover enough of the screen to be worth depth-only rendering.
+        bool triangle_rendered_as_wireframe = (!triangle.Material || SHADING::ShadingType::WIREFRAME == rendering_settings.Shading.ShadingType);
+        if (!rendering_settings.ColorWrites && triangle_rendered_as_wireframe)
+        {
+            return;
+        }
+
         // RENDER THE TRIANGLE AS A WIREFRAME IF THERE IS NO MATERIAL.
         // This allows viewing at least something for a triangle.
         if (!triangle.Material)
@@ -283,411 +1403,591 @@ namespace GRAPHICS::CPU_RENDERING
                 float clamped_min_y = MATH::Number::Clamp<float>(min_y, MIN_BITMAP_COORDINATE, max_y_position);
                 float clamped_max_y = MATH::Number::Clamp<float>(max_y, MIN_BITMAP_COORDINATE, max_y_position);
 
-                /// @todo   Clean-up all of this SIMD code if we think it might provide significant enough speed benefits.
-                ///     Right now, it provides about a 20 FPS increase over the non-SIMD path in release mode,
-                ///     which is a nice enough speed benefit but may not be enough yet to warrant further effort in the SIMD path.
-                if (rendering_settings.UseCpuSimd)
+                // MARK PIXELS THAT MAY BE WRITTEN AS DIRTY.
+                // The bounds are expanded to whole pixels since coordinates are rounded or truncated depending on the rasterization path.
+                if (rendering_settings.ColorWrites)
                 {
-                    // LOAD THE TRIANGLE INTO SIMD FORMAT.
-                    GEOMETRY::TriangleSimd8x simd_triangle = GEOMETRY::TriangleSimd8x::Load(triangle);
+                    unsigned int dirty_left_x = static_cast<unsigned int>(std::floor(clamped_min_x));
+                    unsigned int dirty_top_y = static_cast<unsigned int>(std::floor(clamped_min_y));
+                    unsigned int dirty_right_x = static_cast<unsigned int>(std::ceil(clamped_max_x)) + 1;
+                    unsigned int dirty_bottom_y = static_cast<unsigned int>(std::ceil(clamped_max_y)) + 1;
+                    render_target.MarkDirty(MATH::Rectangleui::FromLeftTopAndDimensions(
+                        dirty_left_x,
+                        dirty_top_y,
+                        dirty_right_x - dirty_left_x,
+                        dirty_bottom_y - dirty_top_y));
+                }
+
+                // SKIP RASTERIZATION IF NOTHING WOULD BE WRITTEN.
+                if (!rendering_settings.ColorWrites && !depth_buffer)
+                {
+                    break;
+                }
 
+                // DETERMINE HOW THE TRIANGLE NEEDS TO BE RASTERIZED.
+                // Settings are only checked here, once per triangle, so that rasterization can use a version
+                // specialized at compile time for the specific combination of settings without any per-pixel checks.
+                TriangleTextures triangle_textures = GetTriangleTextures(triangle, rendering_settings.Shading);
+                unsigned int rasterization_flags = GetTriangleRasterizationFlags(triangle_textures, rendering_settings, depth_buffer);
+
+                // The SIMD path is only used if the CPU supports the instructions needed for it.
+                // Otherwise, the non-SIMD path is used rather than crashing on unsupported instructions.
+                // There is not currently a separate AVX-512 path, so AVX2 instructions are also used on such CPUs.
+                PROCESSOR::SimdInstructionSet simd_instruction_set = PROCESSOR::CpuFeatures::GetSimdInstructionSet();
+                bool simd_rasterization_supported = (simd_instruction_set >= PROCESSOR::SimdInstructionSet::AVX2);
+                if (rendering_settings.UseCpuSimd && simd_rasterization_supported)
+                {
+                    // COLOR PIXELS WITHIN THE TRIANGLE 8 AT A TIME.
+                    static constexpr std::array<TriangleRasterizationFunction, TRIANGLE_RASTERIZATION_FLAG_COMBINATION_COUNT> RASTERIZATION_FUNCTIONS_SIMD_8X =
+                        GetRasterizationFunctionsSimd8x(std::make_integer_sequence<unsigned int, TRIANGLE_RASTERIZATION_FLAG_COMBINATION_COUNT>());
+                    TriangleRasterizationFunction rasterize_simd_8x = RASTERIZATION_FUNCTIONS_SIMD_8X[rasterization_flags];
+                    rasterize_simd_8x(
+                        triangle,
+                        triangle_textures,
+                        clamped_min_x,
+                        clamped_max_x,
+                        clamped_min_y,
+                        clamped_max_y,
+                        render_target,
+                        depth_buffer);
+                }
+                else
+                {
                     // COLOR PIXELS WITHIN THE TRIANGLE.
-                    constexpr float ONE_PIXEL = 1.0f;
-                    for (float y = clamped_min_y; y <= clamped_max_y; y += ONE_PIXEL)
+                    static constexpr std::array<TriangleRasterizationFunction, TRIANGLE_RASTERIZATION_FLAG_COMBINATION_COUNT> RASTERIZATION_FUNCTIONS =
+                        GetRasterizationFunctions(std::make_integer_sequence<unsigned int, TRIANGLE_RASTERIZATION_FLAG_COMBINATION_COUNT>());
+                    TriangleRasterizationFunction rasterize = RASTERIZATION_FUNCTIONS[rasterization_flags];
+                    rasterize(
+                        triangle,
+                        triangle_textures,
+                        clamped_min_x,
+                        clamped_max_x,
+                        clamped_min_y,
+                        clamped_max_y,
+                        render_target,
+                        depth_buffer);
+                }
+                break;
+            }
+        }
+    }
+
+    /// Gets the textures of a triangle's material that apply based on shading settings.
+    /// Textures are only included for kinds of lighting that are enabled.
+    /// Mipmapped versions of textures are used if they exist since their memory layout may be more cache-friendly.
+    /// @param[in]  triangle - The triangle to get textures for.  Must have a material.
+    /// @param[in]  shading_settings - The settings to use for shading.
+    /// @return The textures to apply to the triangle; empty if texture mapping is disabled.
+    CpuRasterizationAlgorithm::TriangleTextures CpuRasterizationAlgorithm::GetTriangleTextures(
+        const GEOMETRY::Triangle& triangle,
+        const SHADING::ShadingSettings& shading_settings)
+    {
+        // CHECK IF TEXTURE MAPPING IS ENABLED.
+        TriangleTextures triangle_textures = { .Filtering = shading_settings.TextureFiltering };
+        if (!shading_settings.TextureMappingEnabled)
+        {
+            return triangle_textures;
+        }
+
+        // ADD ANY AMBIENT TEXTURE IF APPLICABLE.
+        // Textures are added in a consistent order so that colors are always summed the same way.
+        bool ambient_texture_exists = (triangle.Material->AmbientProperties.MipmappedTexture || triangle.Material->AmbientProperties.Texture);
+        if (shading_settings.Lighting.AmbientLightingEnabled && ambient_texture_exists)
+        {
+            triangle_textures.Textures[triangle_textures.Count] =
+            {
+                .MipmappedTexture = triangle.Material->AmbientProperties.MipmappedTexture.get(),
+                .Texture = triangle.Material->AmbientProperties.Texture.get(),
+            };
+            ++triangle_textures.Count;
+        }
+
+        // ADD ANY DIFFUSE TEXTURE IF APPLICABLE.
+        bool diffuse_texture_exists = (triangle.Material->DiffuseProperties.MipmappedTexture || triangle.Material->DiffuseProperties.Texture);
+        if (shading_settings.Lighting.DiffuseLightingEnabled && diffuse_texture_exists)
+        {
+            triangle_textures.Textures[triangle_textures.Count] =
+            {
+                .MipmappedTexture = triangle.Material->DiffuseProperties.MipmappedTexture.get(),
+                .Texture = triangle.Material->DiffuseProperties.Texture.get(),
+            };
+            ++triangle_textures.Count;
+        }
+
+        // ADD ANY SPECULAR TEXTURE IF APPLICABLE.
+        bool specular_texture_exists = (triangle.Material->SpecularProperties.MipmappedTexture || triangle.Material->SpecularProperties.Texture);
+        if (shading_settings.Lighting.SpecularLightingEnabled && specular_texture_exists)
+        {
+            triangle_textures.Textures[triangle_textures.Count] =
+            {
+                .MipmappedTexture = triangle.Material->SpecularProperties.MipmappedTexture.get(),
+                .Texture = triangle.Material->SpecularProperties.Texture.get(),
+            };
+            ++triangle_textures.Count;
+        }
+
+        return triangle_textures;
+    }
+
+    /// Computes the combined color of all textures of a triangle that apply to a point.
+    /// @param[in]  triangle - The screen space triangle being textured.
+    /// @param[in]  point - The screen space point within the triangle to texture.
+    /// @param[in]  triangle_textures - The textures that apply to the triangle.
+    /// @return The sum of the texel colors at the point; black if no textures apply.
+    Color CpuRasterizationAlgorithm::ComputeTextureColor(
+        const GEOMETRY::Triangle& triangle,
+        const MATH::Vector2f& point,
+        const TriangleTextures& triangle_textures)
+    {
+        Color texture_color = Color::BLACK;
+
+        for (std::size_t texture_index = 0; texture_index < triangle_textures.Count; ++texture_index)
+        {
+            const TriangleTexture& triangle_texture = triangle_textures.Textures[texture_index];
+            if (triangle_texture.MipmappedTexture)
+            {
+                Color current_texture_color = TextureMappingAlgorithm::LookupTexel(
+                    triangle,
+                    point,
+                    triangle_textures.Filtering,
+                    *triangle_texture.MipmappedTexture);
+                texture_color += current_texture_color;
+            }
+            else
+            {
+                Color current_texture_color = TextureMappingAlgorithm::LookupTexel(
+                    triangle,
+                    point,
+                    *triangle_texture.Texture);
+                texture_color += current_texture_color;
+            }
+        }
+
+        return texture_color;
+    }
+
+    /// Rasterizes a filled triangle one pixel at a time.
+    /// Features are selected at compile time so that no settings need to be checked for each pixel.
+    /// @tparam RASTERIZATION_FLAGS - The TRIANGLE_RASTERIZATION_* flags for features to use.
+    /// @param[in]  triangle - The screen space triangle to rasterize.
+    /// @param[in]  triangle_textures - The textures to apply to the triangle if texture mapping.
+    /// @param[in]  clamped_min_x - The minimum x coordinate of the triangle's bounding box, clamped to the render target.
+    /// @param[in]  clamped_max_x - The maximum x coordinate of the triangle's bounding box, clamped to the render target.
+    /// @param[in]  clamped_min_y - The minimum y coordinate of the triangle's bounding box, clamped to the render target.
+    /// @param[in]  clamped_max_y - The maximum y coordinate of the triangle's bounding box, clamped to the render target.
+    /// @param[in,out]  render_target - The target to render to.
+    /// @param[in,out]  depth_buffer - The depth buffer to use if depth buffering.
+    template <unsigned int RASTERIZATION_FLAGS>
+    void CpuRasterizationAlgorithm::Rasterize(
+        const GEOMETRY::Triangle& triangle,
+        const TriangleTextures& triangle_textures,
+        const float clamped_min_x,
+        const float clamped_max_x,
+        const float clamped_min_y,
+        const float clamped_max_y,
+        IMAGES::Bitmap& render_target,
+        DepthBuffer* depth_buffer)
+    {
+        // DETERMINE THE FEATURES TO USE.
+        constexpr bool FLAT_SHADING = (0 != (RASTERIZATION_FLAGS & TRIANGLE_RASTERIZATION_FLAT_SHADING));
+        constexpr bool TEXTURE_MAPPING = (0 != (RASTERIZATION_FLAGS & TRIANGLE_RASTERIZATION_TEXTURE_MAPPING));
+        constexpr bool DEPTH_BUFFERING = (0 != (RASTERIZATION_FLAGS & TRIANGLE_RASTERIZATION_DEPTH_BUFFERING));
+        constexpr bool COLOR_WRITES = (0 != (RASTERIZATION_FLAGS & TRIANGLE_RASTERIZATION_COLOR_WRITES));
+
+        // GET THE VERTICES.
+        const VertexWithAttributes& first_vertex = triangle.Vertices[0];
+        const VertexWithAttributes& second_vertex = triangle.Vertices[1];
+        const VertexWithAttributes& third_vertex = triangle.Vertices[2];
+
+        // COMPUTE ANY FLAT SHADING COLOR.
+        // Flat shading uses the average vertex color for the entire triangle.
+        Color flat_shading_color = Color::BLACK;
+        if constexpr (FLAT_SHADING)
+        {
+            const Color& first_vertex_color = first_vertex.Color;
+            const Color& second_vertex_color = second_vertex.Color;
+            const Color& third_vertex_color = third_vertex.Color;
+
+            constexpr float VERTEX_COUNT = static_cast<float>(GEOMETRY::Triangle::VERTEX_COUNT);
+            float average_red = (first_vertex_color.Red + second_vertex_color.Red + third_vertex_color.Red) / VERTEX_COUNT;
+            float average_green = (first_vertex_color.Green + second_vertex_color.Green + third_vertex_color.Green) / VERTEX_COUNT;
+            float average_blue = (first_vertex_color.Blue + second_vertex_color.Blue + third_vertex_color.Blue) / VERTEX_COUNT;
+            float average_alpha = (first_vertex_color.Alpha + second_vertex_color.Alpha + third_vertex_color.Alpha) / VERTEX_COUNT;
+
+            /// @todo   Should we try some kind of texture mapping here?
+
+            flat_shading_color = Color(average_red, average_green, average_blue, average_alpha);
+        }
+
+        // COLOR PIXELS WITHIN THE TRIANGLE.
+        constexpr float ONE_PIXEL = 1.0f;
+        for (float y = clamped_min_y; y <= clamped_max_y; y += ONE_PIXEL)
+        {
+            for (float x = clamped_min_x; x <= clamped_max_x; x += ONE_PIXEL)
+            {
+                // CHECK IF THE CURRENT PIXEL IS WITHIN THE TRIANGLE.
+                MATH::Vector2f current_point(x, y);
+                MATH::Vector3f current_point_barycentric_coordinates = triangle.BarycentricCoordinates2DOf(current_point);
+
+                constexpr float MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE = 0.0f;
+                constexpr float MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX = 1.0f;
+                bool pixel_between_opposite_edge_and_center_vertex = (
+                    (MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE <= current_point_barycentric_coordinates.X) &&
+                    (current_point_barycentric_coordinates.X <= MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX));
+                bool pixel_between_left_edge_and_right_vertex = (
+                    (MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE <= current_point_barycentric_coordinates.Y) &&
+                    (current_point_barycentric_coordinates.Y <= MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX));
+                bool pixel_between_right_edge_and_left_vertex = (
+                    (MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE <= current_point_barycentric_coordinates.Z) &&
+                    (current_point_barycentric_coordinates.Z <= MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX));
+                bool pixel_in_triangle = (
+                    pixel_between_opposite_edge_and_center_vertex &&
+                    pixel_between_left_edge_and_right_vertex &&
+                    pixel_between_right_edge_and_left_vertex);
+                if (!pixel_in_triangle)
+                {
+                    continue;
+                }
+
+                // The coordinates need to be rounded to integer in order to plot a pixel on a fixed grid.
+                unsigned int current_pixel_x = static_cast<unsigned int>(std::round(x));
+                unsigned int current_pixel_y = static_cast<unsigned int>(std::round(y));
+
+                // AVOID SHADING THE PIXEL IF ANOTHER PIXEL IS ALREADY IN FRONT OF IT.
+                // Depth testing is done before any color computations so that the cost of shading and texturing
+                // is only paid for visible pixels.  The z-coordinate needs to be properly interpolated first.
+                if constexpr (DEPTH_BUFFERING)
+                {
+                    float interpolated_z = (
+                        (current_point_barycentric_coordinates.X * second_vertex.Position.Z) +
+                        (current_point_barycentric_coordinates.Y * third_vertex.Position.Z) +
+                        (current_point_barycentric_coordinates.Z * first_vertex.Position.Z));
+                    bool current_pixel_in_front_of_old_pixels = depth_buffer->TestDepth(current_pixel_x, current_pixel_y, interpolated_z);
+                    if (!current_pixel_in_front_of_old_pixels)
+                    {
+                        // Continue to the next iteration of the loop in
+                        // case there is another pixel to draw.
+                        continue;
+                    }
+
+                    // WRITE THE DEPTH VALUE.
+                    // Nothing can fail after a passing depth test, so the depth can be written immediately.
+                    depth_buffer->WriteDepth(current_pixel_x, current_pixel_y, interpolated_z);
+                }
+
+                // COMPUTE THE PIXEL COLOR BASED ON THE TYPE OF SHADING.
+                // Nothing else needs to be done if only depths are being written.
+                if constexpr (COLOR_WRITES)
+                {
+                    Color pixel_color = flat_shading_color;
+                    if constexpr (!FLAT_SHADING)
                     {
-                        constexpr float SIMD_AVX_REGISTER_ELEMENT_COUNT = 8.0f;
-                        for (float x = clamped_min_x; x <= clamped_max_x; x += SIMD_AVX_REGISTER_ELEMENT_COUNT)
+                        // INTERPOLATE THE VERTEX COLORS.
+                        // The color needs to be interpolated for other kinds of shading.
+                        const Color& first_vertex_color = first_vertex.Color;
+                        const Color& second_vertex_color = second_vertex.Color;
+                        const Color& third_vertex_color = third_vertex.Color;
+
+                        pixel_color.Red = (
+                            (current_point_barycentric_coordinates.X * second_vertex_color.Red) +
+                            (current_point_barycentric_coordinates.Y * third_vertex_color.Red) +
+                            (current_point_barycentric_coordinates.Z * first_vertex_color.Red));
+                        pixel_color.Green = (
+                            (current_point_barycentric_coordinates.X * second_vertex_color.Green) +
+                            (current_point_barycentric_coordinates.Y * third_vertex_color.Green) +
+                            (current_point_barycentric_coordinates.Z * first_vertex_color.Green));
+                        pixel_color.Blue = (
+                            (current_point_barycentric_coordinates.X * second_vertex_color.Blue) +
+                            (current_point_barycentric_coordinates.Y * third_vertex_color.Blue) +
+                            (current_point_barycentric_coordinates.Z * first_vertex_color.Blue));
+
+                        // ADD TEXTURING IF APPLICABLE.
+                        if constexpr (TEXTURE_MAPPING)
                         {
-                            // LOAD THE CURRENT POINT INTO SIMD FORMAT.
-                            // r version maps to more intuitive memory order.
-                            __m256 current_point_x_coordinates = _mm256_setr_ps(
-                                x,
-                                x + 1.0f,
-                                x + 2.0f,
-                                x + 3.0f,
-                                x + 4.0f,
-                                x + 5.0f,
-                                x + 6.0f,
-                                x + 7.0f);
-                            __m256 current_point_y_coordinates = _mm256_set1_ps(y);
-                            MATH::Vector2<__m256> current_points(current_point_x_coordinates, current_point_y_coordinates);
-
-                            // COMPUTE THE BARYCENTRIC COORDINATES OF THE CURRENT POINTS.
-                            MATH::Vector3Simd8x current_point_barycentric_coordinates = simd_triangle.BarycentricCoordinates2DOf(current_points);
-
-                            // CHECK IF THE POINTS ARE WITHIN THE TRIANGLE.
-                            const __m256 MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE = _mm256_set1_ps(0.0f);
-                            const __m256 MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX = _mm256_set1_ps(1.0f);
-                            __m256 pixels_x_on_inner_side_of_edge = _mm256_cmp_ps(MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE, current_point_barycentric_coordinates.X, _CMP_LE_OS);
-                            __m256 pixels_x_on_inner_side_of_vertex = _mm256_cmp_ps(current_point_barycentric_coordinates.X, MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX, _CMP_LE_OS);
-                            __m256 pixels_x_in_triangle = _mm256_and_ps(pixels_x_on_inner_side_of_edge, pixels_x_on_inner_side_of_vertex);
-
-                            __m256 pixels_y_on_inner_side_of_edge = _mm256_cmp_ps(MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE, current_point_barycentric_coordinates.Y, _CMP_LE_OS);
-                            __m256 pixels_y_on_inner_side_of_vertex = _mm256_cmp_ps(current_point_barycentric_coordinates.Y, MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX, _CMP_LE_OS);
-                            __m256 pixels_y_in_triangle = _mm256_and_ps(pixels_y_on_inner_side_of_edge, pixels_y_on_inner_side_of_vertex);
-
-                            __m256 pixels_z_on_inner_side_of_edge = _mm256_cmp_ps(MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE, current_point_barycentric_coordinates.Z, _CMP_LE_OS);
-                            __m256 pixels_z_on_inner_side_of_vertex = _mm256_cmp_ps(current_point_barycentric_coordinates.Z, MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX, _CMP_LE_OS);
-                            __m256 pixels_z_in_triangle = _mm256_and_ps(pixels_z_on_inner_side_of_edge, pixels_z_on_inner_side_of_vertex);
-
-                            __m256 pixels_x_y_in_triangle = _mm256_and_ps(pixels_x_in_triangle, pixels_y_in_triangle);
-                            __m256 pixels_in_triangle = _mm256_and_ps(pixels_x_y_in_triangle, pixels_z_in_triangle);;
-
-                            // INTERPOLATE Z COORDINATES FOR DEPTH BUFFERING.
-                            __m256 interpolated_z_barycentric_x_times_second_z = _mm256_mul_ps(current_point_barycentric_coordinates.X, simd_triangle.CenterVertexPosition.Z);
-                            __m256 interpolated_z_barycentric_y_times_third_z = _mm256_mul_ps(current_point_barycentric_coordinates.Y, simd_triangle.RightVertexPosition.Z);
-                            __m256 interpolated_z_barycentric_z_times_first_z = _mm256_mul_ps(current_point_barycentric_coordinates.Z, simd_triangle.LeftVertexPosition.Z);
-                            __m256 interpolated_z_coordinates = _mm256_add_ps(interpolated_z_barycentric_x_times_second_z, interpolated_z_barycentric_y_times_third_z);
-                            interpolated_z_coordinates = _mm256_add_ps(interpolated_z_coordinates, interpolated_z_barycentric_z_times_first_z);
-
-                            // INTERPOLATE PIXEL COLORS.
-                            __m256 pixel_reds_barycentric_x_times_second_red = _mm256_mul_ps(current_point_barycentric_coordinates.X, simd_triangle.SecondVertexColorRed);
-                            __m256 pixel_reds_barycentric_y_times_third_red = _mm256_mul_ps(current_point_barycentric_coordinates.Y, simd_triangle.ThirdVertexColorRed);
-                            __m256 pixel_reds_barycentric_z_times_first_red = _mm256_mul_ps(current_point_barycentric_coordinates.Z, simd_triangle.FirstVertexColorRed);
-                            __m256 pixel_reds = _mm256_add_ps(pixel_reds_barycentric_x_times_second_red, pixel_reds_barycentric_y_times_third_red);
-                            pixel_reds = _mm256_add_ps(pixel_reds, pixel_reds_barycentric_z_times_first_red);
-
-                            __m256 pixel_greens_barycentric_x_times_second_green = _mm256_mul_ps(current_point_barycentric_coordinates.X, simd_triangle.SecondVertexColorGreen);
-                            __m256 pixel_greens_barycentric_y_times_third_green = _mm256_mul_ps(current_point_barycentric_coordinates.Y, simd_triangle.ThirdVertexColorGreen);
-                            __m256 pixel_greens_barycentric_z_times_first_green = _mm256_mul_ps(current_point_barycentric_coordinates.Z, simd_triangle.FirstVertexColorGreen);
-                            __m256 pixel_greens = _mm256_add_ps(pixel_greens_barycentric_x_times_second_green, pixel_greens_barycentric_y_times_third_green);
-                            pixel_greens = _mm256_add_ps(pixel_greens, pixel_greens_barycentric_z_times_first_green);
-
-                            __m256 pixel_blues_barycentric_x_times_second_blue = _mm256_mul_ps(current_point_barycentric_coordinates.X, simd_triangle.SecondVertexColorBlue);
-                            __m256 pixel_blues_barycentric_y_times_third_blue = _mm256_mul_ps(current_point_barycentric_coordinates.Y, simd_triangle.ThirdVertexColorBlue);
-                            __m256 pixel_blues_barycentric_z_times_first_blue = _mm256_mul_ps(current_point_barycentric_coordinates.Z, simd_triangle.FirstVertexColorBlue);
-                            __m256 pixel_blues = _mm256_add_ps(pixel_blues_barycentric_x_times_second_blue, pixel_blues_barycentric_y_times_third_blue);
-                            pixel_blues = _mm256_add_ps(pixel_blues, pixel_blues_barycentric_z_times_first_blue);
-
-                            // INTERPOLATE TEXTURE COORDINATES FOR TEXTURE MAPPING.
-                            __m256 point_texture_coordinates_x_times_second_x = _mm256_mul_ps(current_point_barycentric_coordinates.X, simd_triangle.SecondVertexTextureCoordinates.X);
-                            __m256 point_texture_coordinates_y_times_third_x = _mm256_mul_ps(current_point_barycentric_coordinates.Y, simd_triangle.ThirdVertexTextureCoordinates.X);
-                            __m256 point_texture_coordinates_z_times_first_x = _mm256_mul_ps(current_point_barycentric_coordinates.Z, simd_triangle.FirstVertexTextureCoordinates.X);
-                            __m256 point_texture_x_coordinates = _mm256_add_ps(point_texture_coordinates_x_times_second_x, point_texture_coordinates_y_times_third_x);
-                            point_texture_x_coordinates = _mm256_add_ps(point_texture_x_coordinates, point_texture_coordinates_z_times_first_x);
-
-                            __m256 point_texture_coordinates_x_times_second_y = _mm256_mul_ps(current_point_barycentric_coordinates.X, simd_triangle.SecondVertexTextureCoordinates.Y);
-                            __m256 point_texture_coordinates_y_times_third_y = _mm256_mul_ps(current_point_barycentric_coordinates.Y, simd_triangle.ThirdVertexTextureCoordinates.Y);
-                            __m256 point_texture_coordinates_z_times_first_y = _mm256_mul_ps(current_point_barycentric_coordinates.Z, simd_triangle.FirstVertexTextureCoordinates.Y);
-                            __m256 point_texture_y_coordinates = _mm256_add_ps(point_texture_coordinates_x_times_second_y, point_texture_coordinates_y_times_third_y);
-                            point_texture_y_coordinates = _mm256_add_ps(point_texture_y_coordinates, point_texture_coordinates_z_times_first_y);
-
-                            // READ OUT ALL PIXEL DATA.
-                            float pixel_red_indices[static_cast<int>(SIMD_AVX_REGISTER_ELEMENT_COUNT)] = {};
-                            _mm256_store_ps(pixel_red_indices, pixel_reds);
-
-                            float pixel_blue_indices[static_cast<int>(SIMD_AVX_REGISTER_ELEMENT_COUNT)] = {};
-                            _mm256_store_ps(pixel_blue_indices, pixel_blues);
-
-                            float pixel_green_indices[static_cast<int>(SIMD_AVX_REGISTER_ELEMENT_COUNT)] = {};
-                            _mm256_store_ps(pixel_green_indices, pixel_greens);
-
-                            float interpolated_z_by_index[static_cast<int>(SIMD_AVX_REGISTER_ELEMENT_COUNT)] = {};
-                            _mm256_store_ps(interpolated_z_by_index, interpolated_z_coordinates);
-
-                            float pixel_indices_in_triangle[static_cast<int>(SIMD_AVX_REGISTER_ELEMENT_COUNT)] = {};
-                            _mm256_store_ps(pixel_indices_in_triangle, pixels_in_triangle);
-
-                            float texture_x_coordinates[static_cast<int>(SIMD_AVX_REGISTER_ELEMENT_COUNT)] = {};
-                            _mm256_store_ps(texture_x_coordinates, point_texture_x_coordinates);
-
-                            float texture_y_coordinates[static_cast<int>(SIMD_AVX_REGISTER_ELEMENT_COUNT)] = {};
-                            _mm256_store_ps(texture_y_coordinates, point_texture_y_coordinates);
-
-                            // RENDER OUT EACH PIXEL IN THE CURRENT SIMD BLOCK.
-                            for (std::size_t pixel_x_offset = 0; pixel_x_offset < static_cast<int>(SIMD_AVX_REGISTER_ELEMENT_COUNT); ++pixel_x_offset)
+                            Color texture_color = ComputeTextureColor(triangle, current_point, triangle_textures);
+
+                            // ADD THE FINAL COMPUTED TEXTURE COLOR IF IT EXISTS.
+                            // If no textures exist, the texture color would be left black, which would cancel out normal coloring
+                            // (which is not desirable).
+                            bool texture_coloring_exists = (Color::BLACK != texture_color);
+                            if (texture_coloring_exists)
                             {
-                                float current_pixel_in_triangle = pixel_indices_in_triangle[pixel_x_offset];
-                                if (std::isnan(current_pixel_in_triangle))
-                                {
-                                    // GET THE CURRENT PIXEL COORDINATES.
-                                    unsigned int current_pixel_x = static_cast<unsigned int>(std::round(x + static_cast<float>(pixel_x_offset)));
-                                    unsigned int current_pixel_y = static_cast<unsigned int>(std::round(y));
-
-                                    // SKIP WRITING PIXELS IF NEW PIXEL IS BEHIND ALREADY WRITTEN ONE.
-                                    float interpolated_z = interpolated_z_by_index[pixel_x_offset];
-                                    if (depth_buffer)
-                                    {
-                                        float current_pixel_depth = depth_buffer->GetDepth(current_pixel_x, current_pixel_y);
-                                        bool current_pixel_in_front_of_old_pixels = (interpolated_z >= current_pixel_depth);
-                                        if (!current_pixel_in_front_of_old_pixels)
-                                        {
-                                            // Continue to the next iteration of the loop in
-                                            // case there is another pixel to draw.
-                                            continue;
-                                        }
-                                    }
-
-                                    // GET THE FINAL PIXEL COLOR.
-                                    float current_pixel_red = pixel_red_indices[pixel_x_offset];
-                                    float current_pixel_green = pixel_red_indices[pixel_x_offset];
-                                    float current_pixel_blue = pixel_red_indices[pixel_x_offset];
-                                    Color pixel_color(current_pixel_red, current_pixel_green, current_pixel_blue, Color::MAX_FLOAT_COLOR_COMPONENT);
-
-                                    // ADD TEXTURING IF APPLICABLE.
-                                    if (rendering_settings.Shading.TextureMappingEnabled)
-                                    {
-                                        // GET TEXTURE COORDINATES REGARDLESS OF TYPE OF TEXTURE.
-                                        constexpr float MIN_TEXTURE_COORDINATE = 0.0f;
-                                        constexpr float MAX_TEXTURE_COORDINATE = 1.0f;
-                                        float current_pixel_texture_x_coordinate = MATH::Number::Clamp<float>(texture_x_coordinates[pixel_x_offset], MIN_TEXTURE_COORDINATE, MAX_TEXTURE_COORDINATE);
-                                        float current_pixel_texture_y_coordinate = MATH::Number::Clamp<float>(texture_y_coordinates[pixel_x_offset], MIN_TEXTURE_COORDINATE, MAX_TEXTURE_COORDINATE);
-
-                                        // HAVE THE INITIAL COLOR FROM TEXTURING BE BLACK.
-                                        Color texture_color = Color::BLACK;
-
-                                        // ADD AMBIENT TEXTURING IF APPLICABLE.
-                                        if (rendering_settings.Shading.Lighting.AmbientLightingEnabled)
-                                        {
-                                            bool ambient_texture_exists = (nullptr != triangle.Material->AmbientProperties.Texture);
-                                            if (ambient_texture_exists)
-                                            {
-                                                // LOOKUP THE APPROPRIATE TEXEL.
-                                                unsigned int texture_width_in_pixels = triangle.Material->AmbientProperties.Texture->GetWidthInPixels();
-                                                unsigned int max_texture_pixel_x_coordinate = texture_width_in_pixels - 1;
-                                                unsigned int texture_pixel_x_coordinate = static_cast<unsigned int>(max_texture_pixel_x_coordinate * current_pixel_texture_x_coordinate);
-
-                                                unsigned int texture_height_in_pixels = triangle.Material->AmbientProperties.Texture->GetHeightInPixels();
-                                                unsigned int max_texture_pixel_y_coordinate = texture_height_in_pixels - 1;
-                                                unsigned int texture_pixel_y_coordinate = static_cast<unsigned int>(max_texture_pixel_y_coordinate * current_pixel_texture_y_coordinate);
-
-                                                Color ambient_texture_color = triangle.Material->AmbientProperties.Texture->GetPixel(texture_pixel_x_coordinate, texture_pixel_y_coordinate);
-                                                texture_color += ambient_texture_color;
-                                            }
-                                        }
-
-                                        // ADD DIFFUSE TEXTURING IF APPLICABLE.
-                                        if (rendering_settings.Shading.Lighting.DiffuseLightingEnabled)
-                                        {
-                                            bool diffuse_texture_exists = (nullptr != triangle.Material->DiffuseProperties.Texture);
-                                            if (diffuse_texture_exists)
-                                            {
-                                                // LOOKUP THE APPROPRIATE TEXEL.
-                                                unsigned int texture_width_in_pixels = triangle.Material->DiffuseProperties.Texture->GetWidthInPixels();
-                                                unsigned int max_texture_pixel_x_coordinate = texture_width_in_pixels - 1;
-                                                unsigned int texture_pixel_x_coordinate = static_cast<unsigned int>(max_texture_pixel_x_coordinate * current_pixel_texture_x_coordinate);
-
-                                                unsigned int texture_height_in_pixels = triangle.Material->DiffuseProperties.Texture->GetHeightInPixels();
-                                                unsigned int max_texture_pixel_y_coordinate = texture_height_in_pixels - 1;
-                                                unsigned int texture_pixel_y_coordinate = static_cast<unsigned int>(max_texture_pixel_y_coordinate * current_pixel_texture_y_coordinate);
-
-                                                Color diffuse_texture_color = triangle.Material->DiffuseProperties.Texture->GetPixel(texture_pixel_x_coordinate, texture_pixel_y_coordinate);
-                                                texture_color += diffuse_texture_color;
-                                            }
-                                        }
-
-                                        // ADD SPECULAR TEXTURING IF APPLICABLE.
-                                        if (rendering_settings.Shading.Lighting.SpecularLightingEnabled)
-                                        {
-                                            bool specular_texture_exists = (nullptr != triangle.Material->SpecularProperties.Texture);
-                                            if (specular_texture_exists)
-                                            {
-                                                // LOOKUP THE APPROPRIATE TEXEL.
-                                                unsigned int texture_width_in_pixels = triangle.Material->SpecularProperties.Texture->GetWidthInPixels();
-                                                unsigned int max_texture_pixel_x_coordinate = texture_width_in_pixels - 1;
-                                                unsigned int texture_pixel_x_coordinate = static_cast<unsigned int>(max_texture_pixel_x_coordinate * current_pixel_texture_x_coordinate);
-
-                                                unsigned int texture_height_in_pixels = triangle.Material->SpecularProperties.Texture->GetHeightInPixels();
-                                                unsigned int max_texture_pixel_y_coordinate = texture_height_in_pixels - 1;
-                                                unsigned int texture_pixel_y_coordinate = static_cast<unsigned int>(max_texture_pixel_y_coordinate * current_pixel_texture_y_coordinate);
-
-                                                Color specular_texture_color = triangle.Material->SpecularProperties.Texture->GetPixel(texture_pixel_x_coordinate, texture_pixel_y_coordinate);
-                                                texture_color += specular_texture_color;
-                                            }
-                                        }
-
-                                        // ADD THE FINAL COMPUTED TEXTURE COLOR IF IT EXISTS.
-                                        // If no textures exist, the texture color would be left black, which would cancel out normal coloring
-                                        // (which is not desirable).
-                                        bool texture_coloring_exists = (Color::BLACK != texture_color);
-                                        if (texture_coloring_exists)
-                                        {
-                                            pixel_color = Color::ComponentMultiplyRedGreenBlue(pixel_color, texture_color);
-                                        }
-                                    }
-
-                                    // ENSURE THE COLOR IS WITHIN THE PROPER RANGE
-                                    pixel_color.Clamp();
-
-                                    // WRITE THE FINAL COLOR AND DEPTH VALUES.
-                                    render_target.WritePixel(current_pixel_x, current_pixel_y, pixel_color);
-                                    if (depth_buffer)
-                                    {
-                                        depth_buffer->WriteDepth(current_pixel_x, current_pixel_y, interpolated_z);
-                                    }
-                                }
+                                pixel_color = Color::ComponentMultiplyRedGreenBlue(pixel_color, texture_color);
                             }
                         }
+
+                        // ENSURE THE COLOR IS WITHIN THE PROPER RANGE
+                        pixel_color.Clamp();
                     }
+
+                    // WRITE THE FINAL COLOR.
+                    render_target.WritePixel(current_pixel_x, current_pixel_y, pixel_color);
                 }
-                else
+            }
+        }
+    }
+
+    /// Rasterizes a filled triangle using 8-wide SIMD operations for all per-pixel work.
+    /// Coverage, depth testing, texturing, and color packing are all computed for 8 horizontally
+    /// adjacent pixels at once, with masked loads and stores used for the depth and color buffers.
+    /// Features are selected at compile time so that no settings need to be checked for each block of pixels.
+    /// @tparam RASTERIZATION_FLAGS - The TRIANGLE_RASTERIZATION_* flags for features to use.
+    /// @param[in]  triangle - The screen space triangle to rasterize.
+    /// @param[in]  triangle_textures - The textures to apply to the triangle if texture mapping.
+    /// @param[in]  clamped_min_x - The minimum x coordinate of the triangle's bounding box, clamped to the render target.
+    /// @param[in]  clamped_max_x - The maximum x coordinate of the triangle's bounding box, clamped to the render target.
+    /// @param[in]  clamped_min_y - The minimum y coordinate of the triangle's bounding box, clamped to the render target.
+    /// @param[in]  clamped_max_y - The maximum y coordinate of the triangle's bounding box, clamped to the render target.
+    /// @param[in,out]  render_target - The target to render to.
+    /// @param[in,out]  depth_buffer - The depth buffer to use if depth buffering.
+    template <unsigned int RASTERIZATION_FLAGS>
+    SIMD_TARGET_AVX2 void CpuRasterizationAlgorithm::RasterizeSimd8x(
+        const GEOMETRY::Triangle& triangle,
+        const TriangleTextures& triangle_textures,
+        const float clamped_min_x,
+        const float clamped_max_x,
+        const float clamped_min_y,
+        const float clamped_max_y,
+        IMAGES::Bitmap& render_target,
+        DepthBuffer* depth_buffer)
+    {
+        // DETERMINE THE FEATURES TO USE.
+        constexpr bool FLAT_SHADING = (0 != (RASTERIZATION_FLAGS & TRIANGLE_RASTERIZATION_FLAT_SHADING));
+        constexpr bool TEXTURE_MAPPING = (0 != (RASTERIZATION_FLAGS & TRIANGLE_RASTERIZATION_TEXTURE_MAPPING));
+        constexpr bool MIPMAPPING = (0 != (RASTERIZATION_FLAGS & TRIANGLE_RASTERIZATION_MIPMAPPING));
+        constexpr bool DEPTH_BUFFERING = (0 != (RASTERIZATION_FLAGS & TRIANGLE_RASTERIZATION_DEPTH_BUFFERING));
+        constexpr bool COLOR_WRITES = (0 != (RASTERIZATION_FLAGS & TRIANGLE_RASTERIZATION_COLOR_WRITES));
+
+        // LOAD THE TRIANGLE INTO SIMD FORMAT.
+        GEOMETRY::TriangleSimd8x simd_triangle = GEOMETRY::TriangleSimd8x::Load(triangle);
+
+        // COMPUTE ANY FLAT SHADING COLOR.
+        // Flat shading uses a single color for the entire triangle without any texturing.
+        ColorSimd8x flat_shading_colors = ColorSimd8x::Load(Color::BLACK);
+        if constexpr (FLAT_SHADING)
+        {
+            const Color& first_vertex_color = triangle.Vertices[0].Color;
+            const Color& second_vertex_color = triangle.Vertices[1].Color;
+            const Color& third_vertex_color = triangle.Vertices[2].Color;
+
+            constexpr float VERTEX_COUNT = static_cast<float>(GEOMETRY::Triangle::VERTEX_COUNT);
+            float average_red = (first_vertex_color.Red + second_vertex_color.Red + third_vertex_color.Red) / VERTEX_COUNT;
+            float average_green = (first_vertex_color.Green + second_vertex_color.Green + third_vertex_color.Green) / VERTEX_COUNT;
+            float average_blue = (first_vertex_color.Blue + second_vertex_color.Blue + third_vertex_color.Blue) / VERTEX_COUNT;
+            float average_alpha = (first_vertex_color.Alpha + second_vertex_color.Alpha + third_vertex_color.Alpha) / VERTEX_COUNT;
+            flat_shading_colors = ColorSimd8x::Load(Color(average_red, average_green, average_blue, average_alpha));
+        }
+
+        // GET DIRECT ACCESS TO THE RENDER TARGET MEMORY.
+        // Bounds are guaranteed by the clamped bounding box and masking, so per-pixel bounds checks are avoided.
+        unsigned int render_target_width_in_pixels = render_target.GetWidthInPixels();
+        ColorFormat render_target_color_format = render_target.GetColorFormat();
+        uint32_t* render_target_pixels = render_target.GetRawData();
+
+        // DETERMINE THE PIXEL RANGE TO RENDER.
+        // Like the non-SIMD version, points are sampled at whole pixel steps from the minimum corner of the bounding box,
+        // with the coordinates rounded to integer in order to plot pixels on a fixed grid.  This keeps coverage consistent
+        // between versions even when the bounding box isn't aligned to pixels.
+        int first_pixel_x = static_cast<int>(std::round(clamped_min_x));
+        int last_pixel_x = first_pixel_x + static_cast<int>(clamped_max_x - clamped_min_x);
+        int first_pixel_y = static_cast<int>(std::round(clamped_min_y));
+        int last_pixel_y = first_pixel_y + static_cast<int>(clamped_max_y - clamped_min_y);
+        const __m256i LAST_PIXEL_X = _mm256_set1_epi32(last_pixel_x);
+
+        // COLOR PIXELS WITHIN THE TRIANGLE.
+        constexpr int SIMD_AVX_REGISTER_ELEMENT_COUNT = 8;
+        const __m256i PIXEL_X_OFFSETS = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        const __m256 POINT_X_OFFSETS = _mm256_cvtepi32_ps(PIXEL_X_OFFSETS);
+        const __m256 MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE = _mm256_set1_ps(0.0f);
+        const __m256 MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX = _mm256_set1_ps(1.0f);
+        for (int y = first_pixel_y; y <= last_pixel_y; ++y)
+        {
+            std::size_t row_start_pixel_index = static_cast<std::size_t>(y) * render_target_width_in_pixels;
+            __m256 current_point_y_coordinates = _mm256_set1_ps(clamped_min_y + static_cast<float>(y - first_pixel_y));
+            for (int x = first_pixel_x; x <= last_pixel_x; x += SIMD_AVX_REGISTER_ELEMENT_COUNT)
+            {
+                // LOAD THE CURRENT POINTS INTO SIMD FORMAT.
+                __m256i current_pixel_x_coordinates = _mm256_add_epi32(_mm256_set1_epi32(x), PIXEL_X_OFFSETS);
+                __m256 first_point_x_coordinate = _mm256_set1_ps(clamped_min_x + static_cast<float>(x - first_pixel_x));
+                __m256 current_point_x_coordinates = _mm256_add_ps(first_point_x_coordinate, POINT_X_OFFSETS);
+                MATH::Vector2<__m256> current_points(current_point_x_coordinates, current_point_y_coordinates);
+
+                // COMPUTE THE BARYCENTRIC COORDINATES OF THE CURRENT POINTS.
+                MATH::Vector3Simd8x current_point_barycentric_coordinates = simd_triangle.BarycentricCoordinates2DOf(current_points);
+
+                // CHECK IF THE POINTS ARE WITHIN THE TRIANGLE.
+                __m256 pixels_x_on_inner_side_of_edge = _mm256_cmp_ps(MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE, current_point_barycentric_coordinates.X, _CMP_LE_OS);
+                __m256 pixels_x_on_inner_side_of_vertex = _mm256_cmp_ps(current_point_barycentric_coordinates.X, MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX, _CMP_LE_OS);
+                __m256 pixels_x_in_triangle = _mm256_and_ps(pixels_x_on_inner_side_of_edge, pixels_x_on_inner_side_of_vertex);
+
+                __m256 pixels_y_on_inner_side_of_edge = _mm256_cmp_ps(MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE, current_point_barycentric_coordinates.Y, _CMP_LE_OS);
+                __m256 pixels_y_on_inner_side_of_vertex = _mm256_cmp_ps(current_point_barycentric_coordinates.Y, MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX, _CMP_LE_OS);
+                __m256 pixels_y_in_triangle = _mm256_and_ps(pixels_y_on_inner_side_of_edge, pixels_y_on_inner_side_of_vertex);
+
+                __m256 pixels_z_on_inner_side_of_edge = _mm256_cmp_ps(MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE, current_point_barycentric_coordinates.Z, _CMP_LE_OS);
+                __m256 pixels_z_on_inner_side_of_vertex = _mm256_cmp_ps(current_point_barycentric_coordinates.Z, MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX, _CMP_LE_OS);
+                __m256 pixels_z_in_triangle = _mm256_and_ps(pixels_z_on_inner_side_of_edge, pixels_z_on_inner_side_of_vertex);
+
+                // Pixels past the end of the bounding box (in the last block of a row) must not be written.
+                __m256 pixels_past_bounding_box = _mm256_castsi256_ps(_mm256_cmpgt_epi32(current_pixel_x_coordinates, LAST_PIXEL_X));
+
+                __m256 pixels_x_y_in_triangle = _mm256_and_ps(pixels_x_in_triangle, pixels_y_in_triangle);
+                __m256 pixels_in_triangle = _mm256_and_ps(pixels_x_y_in_triangle, pixels_z_in_triangle);
+                __m256 pixels_to_write = _mm256_andnot_ps(pixels_past_bounding_box, pixels_in_triangle);
+
+                // SKIP THE BLOCK IF NO PIXELS ARE WITHIN THE TRIANGLE.
+                bool no_pixels_to_write = _mm256_testz_ps(pixels_to_write, pixels_to_write);
+                if (no_pixels_to_write)
                 {
-                    // COLOR PIXELS WITHIN THE TRIANGLE.
-                    constexpr float ONE_PIXEL = 1.0f;
-                    for (float y = clamped_min_y; y <= clamped_max_y; y += ONE_PIXEL)
+                    continue;
+                }
+
+                // INTERPOLATE Z COORDINATES FOR DEPTH BUFFERING.
+                __m256 interpolated_z_coordinates = _mm256_mul_ps(current_point_barycentric_coordinates.X, simd_triangle.CenterVertexPosition.Z);
+                interpolated_z_coordinates = _mm256_add_ps(interpolated_z_coordinates, _mm256_mul_ps(current_point_barycentric_coordinates.Y, simd_triangle.RightVertexPosition.Z));
+                interpolated_z_coordinates = _mm256_add_ps(interpolated_z_coordinates, _mm256_mul_ps(current_point_barycentric_coordinates.Z, simd_triangle.LeftVertexPosition.Z));
+
+                // SKIP WRITING PIXELS IF NEW PIXELS ARE BEHIND ALREADY WRITTEN ONES.
+                std::size_t block_start_pixel_index = row_start_pixel_index + x;
+                if constexpr (DEPTH_BUFFERING)
+                {
+                    // The depth buffer only reads memory for pixels that might be written, so reads past the end of the row are avoided.
+                    __m256 pixels_in_front_of_old_pixels = depth_buffer->TestDepths(block_start_pixel_index, interpolated_z_coordinates, pixels_to_write);
+                    pixels_to_write = _mm256_and_ps(pixels_to_write, pixels_in_front_of_old_pixels);
+
+                    no_pixels_to_write = _mm256_testz_ps(pixels_to_write, pixels_to_write);
+                    if (no_pixels_to_write)
                     {
-                        for (float x = clamped_min_x; x <= clamped_max_x; x += ONE_PIXEL)
-                        {
-                            // CHECK IF THE CURRENT PIXEL IS WITHIN THE TRIANGLE.
-                            MATH::Vector2f current_point(x, y);
-                            MATH::Vector3f current_point_barycentric_coordinates = triangle.BarycentricCoordinates2DOf(current_point);
-
-                            constexpr float MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE = 0.0f;
-                            constexpr float MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX = 1.0f;
-                            bool pixel_between_opposite_edge_and_center_vertex = (
-                                (MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE <= current_point_barycentric_coordinates.X) &&
-                                (current_point_barycentric_coordinates.X <= MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX));
-                            bool pixel_between_left_edge_and_right_vertex = (
-                                (MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE <= current_point_barycentric_coordinates.Y) &&
-                                (current_point_barycentric_coordinates.Y <= MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX));
-                            bool pixel_between_right_edge_and_left_vertex = (
-                                (MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE <= current_point_barycentric_coordinates.Z) &&
-                                (current_point_barycentric_coordinates.Z <= MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX));
-                            bool pixel_in_triangle = (
-                                pixel_between_opposite_edge_and_center_vertex &&
-                                pixel_between_left_edge_and_right_vertex &&
-                                pixel_between_right_edge_and_left_vertex);
-                            if (pixel_in_triangle)
-                            {
-                                // COMPUTE THE PIXEL COLOR BASED ON THE TYPE OF SHADING.
-                                // If flat shading is not specified, then regular interpolation is assumed.
-                                Color pixel_color = Color::BLACK;
-                                bool is_flat_shading = (SHADING::ShadingType::FLAT == shading_type);
-                                if (is_flat_shading)
-                                {
-                                    // AVERAGE THE VERTEX COLORS.
-                                    const Color& first_vertex_color = triangle.Vertices[0].Color;
-                                    const Color& second_vertex_color = triangle.Vertices[1].Color;
-                                    const Color& third_vertex_color = triangle.Vertices[2].Color;
+                        continue;
+                    }
 
-                                    constexpr float VERTEX_COUNT = static_cast<float>(GEOMETRY::Triangle::VERTEX_COUNT);
-                                    float average_red = (first_vertex_color.Red + second_vertex_color.Red + third_vertex_color.Red) / VERTEX_COUNT;
-                                    float average_green = (first_vertex_color.Green + second_vertex_color.Green + third_vertex_color.Green) / VERTEX_COUNT;
-                                    float average_blue = (first_vertex_color.Blue + second_vertex_color.Blue + third_vertex_color.Blue) / VERTEX_COUNT;
-                                    float average_alpha = (first_vertex_color.Alpha + second_vertex_color.Alpha + third_vertex_color.Alpha) / VERTEX_COUNT;
+                    // WRITE THE DEPTH VALUES.
+                    // Nothing can fail after a passing depth test, so depths can be written before shading.
+                    depth_buffer->WriteDepths(block_start_pixel_index, interpolated_z_coordinates, pixels_to_write);
+                }
 
-                                    /// @todo   Should we try some kind of texture mapping here?
+                // SKIP COLORING THE PIXELS IF ONLY DEPTHS ARE BEING WRITTEN.
+                if constexpr (!COLOR_WRITES)
+                {
+                    continue;
+                }
+                __m256i pixels_to_write_mask = _mm256_castps_si256(pixels_to_write);
 
-                                    pixel_color = Color(average_red, average_green, average_blue, average_alpha);
-                                }
-                                else
-                                {
-                                    // INTERPOLATE THE VERTEX COLORS.
-                                    // The color needs to be interpolated for other kinds of shading.
-                                    const Color& first_vertex_color = triangle.Vertices[0].Color;
-                                    const Color& second_vertex_color = triangle.Vertices[1].Color;
-                                    const Color& third_vertex_color = triangle.Vertices[2].Color;
-
-                                    pixel_color.Red = (
-                                        (current_point_barycentric_coordinates.X * second_vertex_color.Red) +
-                                        (current_point_barycentric_coordinates.Y * third_vertex_color.Red) +
-                                        (current_point_barycentric_coordinates.Z * first_vertex_color.Red));
-                                    pixel_color.Green = (
-                                        (current_point_barycentric_coordinates.X * second_vertex_color.Green) +
-                                        (current_point_barycentric_coordinates.Y * third_vertex_color.Green) +
-                                        (current_point_barycentric_coordinates.Z * first_vertex_color.Green));
-                                    pixel_color.Blue = (
-                                        (current_point_barycentric_coordinates.X * second_vertex_color.Blue) +
-                                        (current_point_barycentric_coordinates.Y * third_vertex_color.Blue) +
-                                        (current_point_barycentric_coordinates.Z * first_vertex_color.Blue));
-
-                                    // ADD TEXTURING IF APPLICABLE.
-                                    if (rendering_settings.Shading.TextureMappingEnabled)
-                                    {
-                                        Color texture_color = Color::BLACK;
-
-                                        // ADD AMBIENT TEXTURING IF APPLICABLE.
-                                        if (rendering_settings.Shading.Lighting.AmbientLightingEnabled)
-                                        {
-                                            bool ambient_texture_exists = (nullptr != triangle.Material->AmbientProperties.Texture);
-                                            if (ambient_texture_exists)
-                                            {
-                                                Color ambient_texture_color = TextureMappingAlgorithm::LookupTexel(
-                                                    triangle,
-                                                    current_point,
-                                                    *triangle.Material->AmbientProperties.Texture);
-                                                texture_color += ambient_texture_color;
-                                            }
-                                        }
-
-                                        // ADD DIFFUSE TEXTURING IF APPLICABLE.
-                                        if (rendering_settings.Shading.Lighting.DiffuseLightingEnabled)
-                                        {
-                                            bool diffuse_texture_exists = (nullptr != triangle.Material->DiffuseProperties.Texture);
-                                            if (diffuse_texture_exists)
-                                            {
-                                                Color diffuse_texture_color = TextureMappingAlgorithm::LookupTexel(
-                                                    triangle,
-                                                    current_point,
-                                                    *triangle.Material->DiffuseProperties.Texture);
-                                                texture_color += diffuse_texture_color;
-                                            }
-                                        }
-
-                                        // ADD SPECULAR TEXTURING IF APPLICABLE.
-                                        if (rendering_settings.Shading.Lighting.SpecularLightingEnabled)
-                                        {
-                                            bool specular_texture_exists = (nullptr != triangle.Material->SpecularProperties.Texture);
-                                            if (specular_texture_exists)
-                                            {
-                                                Color specular_texture_color = TextureMappingAlgorithm::LookupTexel(
-                                                    triangle,
-                                                    current_point,
-                                                    *triangle.Material->SpecularProperties.Texture);
-                                                texture_color += specular_texture_color;
-                                            }
-                                        }
-
-                                        // ADD THE FINAL COMPUTED TEXTURE COLOR IF IT EXISTS.
-                                        // If no textures exist, the texture color would be left black, which would cancel out normal coloring
-                                        // (which is not desirable).
-                                        bool texture_coloring_exists = (Color::BLACK != texture_color);
-                                        if (texture_coloring_exists)
-                                        {
-                                            pixel_color = Color::ComponentMultiplyRedGreenBlue(pixel_color, texture_color);
-                                        }
-                                    }
-
-                                    // ENSURE THE COLOR IS WITHIN THE PROPER RANGE
-                                    pixel_color.Clamp();
-                                }
+                // COMPUTE THE PIXEL COLORS BASED ON THE TYPE OF SHADING.
+                ColorSimd8x pixel_colors = flat_shading_colors;
+                if constexpr (!FLAT_SHADING)
+                {
+                    // INTERPOLATE THE VERTEX COLORS.
+                    pixel_colors.Red = _mm256_mul_ps(current_point_barycentric_coordinates.X, simd_triangle.SecondVertexColorRed);
+                    pixel_colors.Red = _mm256_add_ps(pixel_colors.Red, _mm256_mul_ps(current_point_barycentric_coordinates.Y, simd_triangle.ThirdVertexColorRed));
+                    pixel_colors.Red = _mm256_add_ps(pixel_colors.Red, _mm256_mul_ps(current_point_barycentric_coordinates.Z, simd_triangle.FirstVertexColorRed));
 
-                                // AVOID WRITING THE PIXEL IF ANOTHER PIXEL IS ALREADY IN FRONT OF IT.
-                                // The z-coordinate needs to be properly interpolated first.
-                                float interpolated_z = (
-                                    (current_point_barycentric_coordinates.X * second_vertex.Position.Z) +
-                                    (current_point_barycentric_coordinates.Y * third_vertex.Position.Z) +
-                                    (current_point_barycentric_coordinates.Z * first_vertex.Position.Z));
-                                // The coordinates need to be rounded to integer in order to plot a pixel on a fixed grid.
-                                unsigned int current_pixel_x = static_cast<unsigned int>(std::round(x));
-                                unsigned int current_pixel_y = static_cast<unsigned int>(std::round(y));
-                                if (depth_buffer)
-                                {
-                                    float current_pixel_depth = depth_buffer->GetDepth(current_pixel_x, current_pixel_y);
-                                    bool current_pixel_in_front_of_old_pixels = (interpolated_z >= current_pixel_depth);
-                                    if (!current_pixel_in_front_of_old_pixels)
-                                    {
-                                        // Continue to the next iteration of the loop in
-                                        // case there is another pixel to draw.
-                                        continue;
-                                    }
-                                }
+                    pixel_colors.Green = _mm256_mul_ps(current_point_barycentric_coordinates.X, simd_triangle.SecondVertexColorGreen);
+                    pixel_colors.Green = _mm256_add_ps(pixel_colors.Green, _mm256_mul_ps(current_point_barycentric_coordinates.Y, simd_triangle.ThirdVertexColorGreen));
+                    pixel_colors.Green = _mm256_add_ps(pixel_colors.Green, _mm256_mul_ps(current_point_barycentric_coordinates.Z, simd_triangle.FirstVertexColorGreen));
+
+                    pixel_colors.Blue = _mm256_mul_ps(current_point_barycentric_coordinates.X, simd_triangle.SecondVertexColorBlue);
+                    pixel_colors.Blue = _mm256_add_ps(pixel_colors.Blue, _mm256_mul_ps(current_point_barycentric_coordinates.Y, simd_triangle.ThirdVertexColorBlue));
+                    pixel_colors.Blue = _mm256_add_ps(pixel_colors.Blue, _mm256_mul_ps(current_point_barycentric_coordinates.Z, simd_triangle.FirstVertexColorBlue));
+
+                    pixel_colors.Alpha = _mm256_set1_ps(Color::MAX_FLOAT_COLOR_COMPONENT);
+
+                    // ADD TEXTURING IF APPLICABLE.
+                    if constexpr (TEXTURE_MAPPING)
+                    {
+                        // INTERPOLATE TEXTURE COORDINATES FOR TEXTURE MAPPING.
+                        MATH::Vector2Simd8x texture_coordinates = simd_triangle.InterpolateTextureCoordinates(current_point_barycentric_coordinates);
+
+                        // INTERPOLATE TEXTURE COORDINATES AT THE CORNERS OF EACH PIXEL'S 2x2 QUAD FOR MIPMAPPING.
+                        // Quads are aligned to even pixel coordinates.  Differences in texture coordinates across
+                        // each quad determine the mipmap level for all pixels in the quad.
+                        MATH::Vector2Simd8x quad_top_left_texture_coordinates = texture_coordinates;
+                        MATH::Vector2Simd8x quad_top_right_texture_coordinates = texture_coordinates;
+                        MATH::Vector2Simd8x quad_bottom_left_texture_coordinates = texture_coordinates;
+                        if constexpr (MIPMAPPING)
+                        {
+                            const __m256i EVEN_PIXEL_COORDINATE_MASK = _mm256_set1_epi32(~1);
+                            const __m256 ONE_PIXEL = _mm256_set1_ps(1.0f);
+                            __m256 quad_left_x_coordinates = _mm256_cvtepi32_ps(_mm256_and_si256(current_pixel_x_coordinates, EVEN_PIXEL_COORDINATE_MASK));
+                            __m256 quad_right_x_coordinates = _mm256_add_ps(quad_left_x_coordinates, ONE_PIXEL);
+                            __m256 quad_top_y_coordinates = _mm256_set1_ps(static_cast<float>(y & ~1));
+                            __m256 quad_bottom_y_coordinates = _mm256_add_ps(quad_top_y_coordinates, ONE_PIXEL);
+
+                            MATH::Vector2<__m256> quad_top_left_points(quad_left_x_coordinates, quad_top_y_coordinates);
+                            quad_top_left_texture_coordinates = simd_triangle.InterpolateTextureCoordinates(simd_triangle.BarycentricCoordinates2DOf(quad_top_left_points));
+                            MATH::Vector2<__m256> quad_top_right_points(quad_right_x_coordinates, quad_top_y_coordinates);
+                            quad_top_right_texture_coordinates = simd_triangle.InterpolateTextureCoordinates(simd_triangle.BarycentricCoordinates2DOf(quad_top_right_points));
+                            MATH::Vector2<__m256> quad_bottom_left_points(quad_left_x_coordinates, quad_bottom_y_coordinates);
+                            quad_bottom_left_texture_coordinates = simd_triangle.InterpolateTextureCoordinates(simd_triangle.BarycentricCoordinates2DOf(quad_bottom_left_points));
+                        }
 
-                                // WRITE THE FINAL COLOR AND DEPTH VALUES.
-                                render_target.WritePixel(current_pixel_x, current_pixel_y, pixel_color);
-                                if (depth_buffer)
+                        // ADD TEXEL COLORS FROM EACH TEXTURE.
+                        ColorSimd8x texture_colors = ColorSimd8x::Load(Color::BLACK);
+                        for (std::size_t texture_index = 0; texture_index < triangle_textures.Count; ++texture_index)
+                        {
+                            const TriangleTexture& triangle_texture = triangle_textures.Textures[texture_index];
+                            ColorSimd8x current_texture_colors;
+                            if (triangle_texture.MipmappedTexture)
+                            {
+                                // Nearest filtering doesn't require computing mipmap levels.
+                                __m256 mipmap_levels = _mm256_setzero_ps();
+                                if constexpr (MIPMAPPING)
                                 {
-                                    depth_buffer->WriteDepth(current_pixel_x, current_pixel_y, interpolated_z);
+                                    mipmap_levels = TextureMappingAlgorithm::ComputeMipmapLevels(
+                                        quad_top_left_texture_coordinates,
+                                        quad_top_right_texture_coordinates,
+                                        quad_bottom_left_texture_coordinates,
+                                        *triangle_texture.MipmappedTexture);
                                 }
+                                current_texture_colors = TextureMappingAlgorithm::LookupTexels(
+                                    texture_coordinates,
+                                    mipmap_levels,
+                                    triangle_textures.Filtering,
+                                    pixels_to_write,
+                                    *triangle_texture.MipmappedTexture);
+                            }
+                            else
+                            {
+                                current_texture_colors = TextureMappingAlgorithm::LookupTexels(texture_coordinates, pixels_to_write, *triangle_texture.Texture);
                             }
+                            texture_colors.Red = _mm256_add_ps(texture_colors.Red, current_texture_colors.Red);
+                            texture_colors.Green = _mm256_add_ps(texture_colors.Green, current_texture_colors.Green);
+                            texture_colors.Blue = _mm256_add_ps(texture_colors.Blue, current_texture_colors.Blue);
                         }
+                        texture_colors.Clamp();
+
+                        // APPLY THE FINAL COMPUTED TEXTURE COLOR WHERE IT EXISTS.
+                        // If no textures exist, the texture color would be left black, which would cancel out normal coloring
+                        // (which is not desirable).
+                        __m256 texture_coloring_exists = texture_colors.NonBlackRedGreenBlueMask();
+                        pixel_colors.Red = _mm256_blendv_ps(pixel_colors.Red, _mm256_mul_ps(pixel_colors.Red, texture_colors.Red), texture_coloring_exists);
+                        pixel_colors.Green = _mm256_blendv_ps(pixel_colors.Green, _mm256_mul_ps(pixel_colors.Green, texture_colors.Green), texture_coloring_exists);
+                        pixel_colors.Blue = _mm256_blendv_ps(pixel_colors.Blue, _mm256_mul_ps(pixel_colors.Blue, texture_colors.Blue), texture_coloring_exists);
                     }
                 }
-                break;
+
+                // ENSURE THE COLORS ARE WITHIN THE PROPER RANGE.
+                pixel_colors.Clamp();
+
+                // WRITE THE FINAL COLORS.
+                __m256i packed_pixel_colors = pixel_colors.Pack(render_target_color_format);
+                _mm256_maskstore_epi32(reinterpret_cast<int*>(render_target_pixels + block_start_pixel_index), pixels_to_write_mask, packed_pixel_colors);
             }
         }
     }
 
+    /// Renders a batch of lines (in screen coordinates).
+    /// @param[in]  line_batch - The lines to render.  Colors must be packed in the render target's format.
+    /// @param[in,out]  render_target - The target to render to.
+    /// @param[in,out]  depth_buffer - The depth buffer to use for any depth buffering.
+    void CpuRasterizationAlgorithm::Render(const LineBatch& line_batch, IMAGES::Bitmap& render_target, DepthBuffer* depth_buffer)
+    {
+        for (const LineBatch::Line& line : line_batch.Lines)
+        {
+            RasterizeLine(line, render_target, depth_buffer);
+        }
+    }
+
     /// Renders a line with the specified endpoints (in screen coordinates).
     /// @param[in]  start_vertex - The starting coordinate of the line.
     /// @param[in]  end_vertex - The ending coordinate of the line.
@@ -701,86 +2001,9 @@ namespace GRAPHICS::CPU_RENDERING
         IMAGES::Bitmap& render_target,
         DepthBuffer* depth_buffer)
     {
-        // EXTRACT COMPONENTS OF THE VERTEX.
-        float start_x = start_vertex.X;
-        float start_y = start_vertex.Y;
-        float start_z = start_vertex.Z;
-        float end_x = end_vertex.X;
-        float end_y = end_vertex.Y;
-        float end_z = end_vertex.Z;
-
-        // CLAMP ENDPOINTS TO AVOID TRYING TO DRAW REALLY HUGE LINES OFF-SCREEN.
-        constexpr float MIN_BITMAP_COORDINATE = 1.0f;
-
-        float max_x_position = static_cast<float>(render_target.GetWidthInPixels() - 1);
-        float clamped_start_x = MATH::Number::Clamp<float>(start_x, MIN_BITMAP_COORDINATE, max_x_position);
-        float clamped_end_x = MATH::Number::Clamp<float>(end_x, MIN_BITMAP_COORDINATE, max_x_position);
-
-        float max_y_position = static_cast<float>(render_target.GetHeightInPixels() - 1);
-        float clamped_start_y = MATH::Number::Clamp<float>(start_y, MIN_BITMAP_COORDINATE, max_y_position);
-        float clamped_end_y = MATH::Number::Clamp<float>(end_y, MIN_BITMAP_COORDINATE, max_y_position);
-
-        // COMPUTE THE INCREMENTS ALONG EACH AXIS FOR EACH PIXEL.
-        // Each time we draw a pixel, we need to move slightly further along the axes.
-        float delta_x = clamped_end_x - clamped_start_x;
-        float delta_y = clamped_end_y - clamped_start_y;
-        float length = std::max(std::abs(delta_x), std::abs(delta_y));
-        float x_increment = delta_x / length;
-        float y_increment = delta_y / length;
-
-        float delta_z = end_z - start_z;
-        float z_increment = delta_z / length;
-
-        // HAVE THE LINE START BEING DRAWN AT THE STARTING COORDINATES.
-        float x = clamped_start_x;
-        float y = clamped_start_y;
-        float z = start_z;
-
-        // DRAW PIXELS FOR THE LINE.
-        for (float pixel_index = 0.0f; pixel_index <= length; ++pixel_index, x += x_increment, y += y_increment, z += z_increment)
-        {
-            // PREVENT WRITING BEYOND THE BOUNDARIES OF THE RENDER TARGET.
-            bool x_boundary_exceeded = (
-                (x < 0.0f) ||
-                (x > max_x_position));
-            bool y_boundary_exceeded = (
-                (y < 0.0f) ||
-                (y > max_y_position));
-            bool boundary_exceeded = (x_boundary_exceeded || y_boundary_exceeded);
-            if (boundary_exceeded)
-            {
-                // Continue to the next iteration of the loop in
-                // case there is another pixel to draw.
-                continue;
-            }
-
-            // DETERMINE IF THE NEW Z IS IN FRONT.
-            unsigned int current_pixel_x = static_cast<unsigned int>(std::round(x));
-            unsigned int current_pixel_y = static_cast<unsigned int>(std::round(y));
-            if (depth_buffer)
-            {
-                float current_pixel_depth = depth_buffer->GetDepth(current_pixel_x, current_pixel_y);
-                bool current_pixel_in_front_of_old_pixels = (z >= current_pixel_depth);
-                if (!current_pixel_in_front_of_old_pixels)
-                {
-                    // Continue to the next iteration of the loop in
-                    // case there is another pixel to draw.
-                    continue;
-                }
-            }
-            
-            // DRAW A PIXEL AT THE CURRENT POSITION.
-            // The coordinates need to be rounded to integer in order
-            // to plot a pixel on a fixed grid.
-            render_target.WritePixel(
-                current_pixel_x,
-                current_pixel_y,
-                color);
-            if (depth_buffer)
-            {
-                depth_buffer->WriteDepth(current_pixel_x, current_pixel_y, z);
-            }
-        }
+        LineBatch line_batch(render_target.GetColorFormat());
+        line_batch.Add(start_vertex, end_vertex, color);
+        Render(line_batch, render_target, depth_buffer);
     }
 
     /// Renders a line with the specified endpoints (in screen coordinates) and interpolated color from the vertices.
@@ -794,98 +2017,282 @@ namespace GRAPHICS::CPU_RENDERING
         IMAGES::Bitmap& render_target,
         DepthBuffer* depth_buffer)
     {
-        // EXTRACT COMPONENTS OF THE VERTEX.
-        float start_x = start_vertex.Position.X;
-        float start_y = start_vertex.Position.Y;
-        float start_z = start_vertex.Position.Z;
-        float end_x = end_vertex.Position.X;
-        float end_y = end_vertex.Position.Y;
-        float end_z = end_vertex.Position.Z;
+        LineBatch line_batch(render_target.GetColorFormat());
+        line_batch.Add(start_vertex, end_vertex);
+        Render(line_batch, render_target, depth_buffer);
+    }
 
-        // CLAMP ENDPOINTS TO AVOID TRYING TO DRAW REALLY HUGE LINES OFF-SCREEN.
-        constexpr float MIN_BITMAP_COORDINATE = 1.0f;
+    /// Rasterizes a single line using Bresenham's line algorithm (https://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm).
+    /// The line is clipped to the render target once up-front so that only integer stepping
+    /// (without any bounds checks) is needed per pixel.
+    /// @param[in]  line - The line to rasterize.
+    /// @param[in,out]  render_target - The target to render to.
+    /// @param[in,out]  depth_buffer - The depth buffer to use for any depth buffering.
+    void CpuRasterizationAlgorithm::RasterizeLine(const LineBatch::Line& line, IMAGES::Bitmap& render_target, DepthBuffer* depth_buffer)
+    {
+        // CLIP THE LINE TO THE RENDER TARGET.
+        // Ratios along the original line are tracked for clipped endpoints so that colors remain consistent.
+        unsigned int render_target_width_in_pixels = render_target.GetWidthInPixels();
+        unsigned int render_target_height_in_pixels = render_target.GetHeightInPixels();
+        bool render_target_empty = (0 == render_target_width_in_pixels) || (0 == render_target_height_in_pixels);
+        if (render_target_empty)
+        {
+            return;
+        }
+        float max_x_position = static_cast<float>(render_target_width_in_pixels - 1);
+        float max_y_position = static_cast<float>(render_target_height_in_pixels - 1);
+        MATH::Vector3f start_position = line.StartPosition;
+        MATH::Vector3f end_position = line.EndPosition;
+        float start_ratio_along_line = 0.0f;
+        float end_ratio_along_line = 1.0f;
+        bool line_visible = ClipLine(max_x_position, max_y_position, start_position, start_ratio_along_line, end_position, end_ratio_along_line);
+        if (!line_visible)
+        {
+            return;
+        }
 
-        float max_x_position = static_cast<float>(render_target.GetWidthInPixels() - 1);
-        float clamped_start_x = MATH::Number::Clamp<float>(start_x, MIN_BITMAP_COORDINATE, max_x_position);
-        float clamped_end_x = MATH::Number::Clamp<float>(end_x, MIN_BITMAP_COORDINATE, max_x_position);
+        // COMPUTE THE INTEGER STEPPING FOR THE LINE.
+        // The coordinates need to be rounded to integer in order to plot pixels on a fixed grid.
+        int start_x = static_cast<int>(std::lround(start_position.X));
+        int start_y = static_cast<int>(std::lround(start_position.Y));
+        int end_x = static_cast<int>(std::lround(end_position.X));
+        int end_y = static_cast<int>(std::lround(end_position.Y));
+        int delta_x = std::abs(end_x - start_x);
+        // The y delta is negative so that the error term handles all octants without swapping axes.
+        int negative_delta_y = -std::abs(end_y - start_y);
+        int x_step = (start_x < end_x) ? 1 : -1;
+        int y_step = (start_y < end_y) ? 1 : -1;
+        int step_count = std::max(delta_x, -negative_delta_y);
+
+        // MARK THE LINE'S PIXELS AS DIRTY.
+        unsigned int dirty_left_x = static_cast<unsigned int>(std::min(start_x, end_x));
+        unsigned int dirty_top_y = static_cast<unsigned int>(std::min(start_y, end_y));
+        render_target.MarkDirty(MATH::Rectangleui::FromLeftTopAndDimensions(
+            dirty_left_x,
+            dirty_top_y,
+            static_cast<unsigned int>(delta_x + 1),
+            static_cast<unsigned int>(-negative_delta_y + 1)));
+
+        // COMPUTE THE DEPTH INCREMENT FOR EACH PIXEL.
+        float z = start_position.Z;
+        float z_increment = (step_count > 0) ? ((end_position.Z - start_position.Z) / static_cast<float>(step_count)) : 0.0f;
+
+        // COMPUTE THE COLOR INCREMENTS FOR EACH PIXEL.
+        // Each byte of the packed colors is interpolated as 16.16 fixed-point so that colors can be
+        // stepped and repacked with only integer operations, regardless of the color format.
+        constexpr unsigned int COLOR_COMPONENT_COUNT = 4;
+        constexpr int FIXED_POINT_FRACTIONAL_BIT_COUNT = 16;
+        constexpr float FIXED_POINT_ONE = static_cast<float>(1 << FIXED_POINT_FRACTIONAL_BIT_COUNT);
+        constexpr float FIXED_POINT_ONE_HALF = FIXED_POINT_ONE / 2.0f;
+        bool single_colored_line = (line.StartColor == line.EndColor);
+        uint32_t packed_color = line.StartColor;
+        std::array<int32_t, COLOR_COMPONENT_COUNT> color_components = {};
+        std::array<int32_t, COLOR_COMPONENT_COUNT> color_component_increments = {};
+        if (!single_colored_line)
+        {
+            for (unsigned int component_index = 0; component_index < COLOR_COMPONENT_COUNT; ++component_index)
+            {
+                unsigned int component_bit_shift = 8 * component_index;
+                float line_start_component = static_cast<float>((line.StartColor >> component_bit_shift) & 0xFF);
+                float line_end_component = static_cast<float>((line.EndColor >> component_bit_shift) & 0xFF);
+                float line_component_delta = line_end_component - line_start_component;
+                float start_component = line_start_component + (line_component_delta * start_ratio_along_line);
+                float end_component = line_start_component + (line_component_delta * end_ratio_along_line);
+
+                // Rounding is included in the starting value so that later truncation rounds to the nearest value.
+                int32_t fixed_point_start_component = static_cast<int32_t>((start_component * FIXED_POINT_ONE) + FIXED_POINT_ONE_HALF);
+                int32_t fixed_point_end_component = static_cast<int32_t>((end_component * FIXED_POINT_ONE) + FIXED_POINT_ONE_HALF);
+                color_components[component_index] = fixed_point_start_component;
+                color_component_increments[component_index] = (step_count > 0) ? ((fixed_point_end_component - fixed_point_start_component) / step_count) : 0;
+            }
+        }
 
-        float max_y_position = static_cast<float>(render_target.GetHeightInPixels() - 1);
-        float clamped_start_y = MATH::Number::Clamp<float>(start_y, MIN_BITMAP_COORDINATE, max_y_position);
-        float clamped_end_y = MATH::Number::Clamp<float>(end_y, MIN_BITMAP_COORDINATE, max_y_position);
+        // DRAW PIXELS FOR THE LINE.
+        // Clipping guarantees all pixels are within the render target.
+        uint32_t* render_target_pixels = render_target.GetRawData();
+        int error = delta_x + negative_delta_y;
+        int x = start_x;
+        int y = start_y;
+        for (int step_index = 0; step_index <= step_count; ++step_index)
+        {
+            // DETERMINE IF THE NEW Z IS IN FRONT.
+            unsigned int current_pixel_x = static_cast<unsigned int>(x);
+            unsigned int current_pixel_y = static_cast<unsigned int>(y);
+            bool current_pixel_in_front_of_old_pixels = !depth_buffer || depth_buffer->TestDepth(current_pixel_x, current_pixel_y, z);
+            if (current_pixel_in_front_of_old_pixels)
+            {
+                // PACK ANY INTERPOLATED COLOR.
+                if (!single_colored_line)
+                {
+                    packed_color = 0;
+                    for (unsigned int component_index = 0; component_index < COLOR_COMPONENT_COUNT; ++component_index)
+                    {
+                        uint32_t component = static_cast<uint32_t>(color_components[component_index] >> FIXED_POINT_FRACTIONAL_BIT_COUNT);
+                        packed_color |= (component << (8 * component_index));
+                    }
+                }
 
-        // COMPUTE THE LENGTH OF THE ENTIRE LINE.
-        MATH::Vector2f vector_from_start_to_end(clamped_end_x - clamped_start_x, clamped_end_y - clamped_start_y);
-        float line_length = vector_from_start_to_end.Length();
+                // DRAW A PIXEL AT THE CURRENT POSITION.
+                std::size_t pixel_index = static_cast<std::size_t>(current_pixel_y) * render_target_width_in_pixels + current_pixel_x;
+                render_target_pixels[pixel_index] = packed_color;
+                if (depth_buffer)
+                {
+                    depth_buffer->WriteDepth(current_pixel_x, current_pixel_y, z);
+                }
+            }
 
-        // COMPUTE THE INCREMENTS ALONG EACH AXIS FOR EACH PIXEL.
-        // Each time we draw a pixel, we need to move slightly
-        // further along the axes.
-        float delta_x = clamped_end_x - clamped_start_x;
-        float delta_y = clamped_end_y - clamped_start_y;
-        float length = std::max(std::abs(delta_x), std::abs(delta_y));
-        float x_increment = delta_x / length;
-        float y_increment = delta_y / length;
+            // MOVE TO THE NEXT PIXEL.
+            z += z_increment;
+            for (unsigned int component_index = 0; component_index < COLOR_COMPONENT_COUNT; ++component_index)
+            {
+                color_components[component_index] += color_component_increments[component_index];
+            }
 
-        float delta_z = end_z - start_z;
-        float z_increment = delta_z / length;
+            int doubled_error = 2 * error;
+            if (doubled_error >= negative_delta_y)
+            {
+                error += negative_delta_y;
+                x += x_step;
+            }
+            if (doubled_error <= delta_x)
+            {
+                error += delta_x;
+                y += y_step;
+            }
+        }
+    }
 
-        // HAVE THE LINE START BEING DRAWN AT THE STARTING COORDINATES.
-        float x = clamped_start_x;
-        float y = clamped_start_y;
-        float z = start_z;
+    /// Clips a line to the rectangle from (0, 0) to the specified maximum coordinates using the
+    /// Cohen-Sutherland algorithm (https://en.wikipedia.org/wiki/Cohen%E2%80%93Sutherland_algorithm).
+    /// @param[in]  max_x - The maximum x coordinate of the clipping rectangle.
+    /// @param[in]  max_y - The maximum y coordinate of the clipping rectangle.
+    /// @param[in,out]  start_position - The starting position of the line.  Updated to the clipped starting position.
+    /// @param[in,out]  start_ratio_along_line - The ratio along the original line of the starting position.
+    ///     Updated for any clipped starting position.
+    /// @param[in,out]  end_position - The ending position of the line.  Updated to the clipped ending position.
+    /// @param[in,out]  end_ratio_along_line - The ratio along the original line of the ending position.
+    ///     Updated for any clipped ending position.
+    /// @return True if any part of the line is within the clipping rectangle; false if not.
+    bool CpuRasterizationAlgorithm::ClipLine(
+        const float max_x,
+        const float max_y,
+        MATH::Vector3f& start_position,
+        float& start_ratio_along_line,
+        MATH::Vector3f& end_position,
+        float& end_ratio_along_line)
+    {
+        // REJECT LINES WITH INVALID COORDINATES.
+        // Such coordinates can't be meaningfully clipped.
+        bool coordinates_finite = (
+            std::isfinite(start_position.X) && std::isfinite(start_position.Y) &&
+            std::isfinite(end_position.X) && std::isfinite(end_position.Y));
+        if (!coordinates_finite)
+        {
+            return false;
+        }
 
-        // DRAW PIXELS FOR THE LINE.
-        for (float pixel_index = 0.0f; pixel_index <= length; ++pixel_index, x += x_increment, y += y_increment, z += z_increment)
-        {
-            // PREVENT WRITING BEYOND THE BOUNDARIES OF THE RENDER TARGET.
-            bool x_boundary_exceeded = (
-                (x < 0.0f) ||
-                (x > max_x_position));
-            bool y_boundary_exceeded = (
-                (y < 0.0f) ||
-                (y > max_y_position));
-            bool boundary_exceeded = (x_boundary_exceeded || y_boundary_exceeded);
-            if (boundary_exceeded)
-            {
-                // Continue to the next iteration of the loop in
-                // case there is another pixel to draw.
-                continue;
+        // CLIP THE LINE UNTIL IT IS ENTIRELY INSIDE OR OUTSIDE OF THE RECTANGLE.
+        // Each iteration moves one endpoint onto a rectangle boundary, so this terminates after a few iterations.
+        while (true)
+        {
+            // CHECK IF THE LINE IS TRIVIALLY INSIDE OR OUTSIDE OF THE RECTANGLE.
+            unsigned int start_outcode = ComputeClipOutcode(start_position, max_x, max_y);
+            unsigned int end_outcode = ComputeClipOutcode(end_position, max_x, max_y);
+            bool line_entirely_inside = (CLIP_OUTCODE_INSIDE == (start_outcode | end_outcode));
+            if (line_entirely_inside)
+            {
+                return true;
+            }
+            bool line_entirely_outside = (CLIP_OUTCODE_INSIDE != (start_outcode & end_outcode));
+            if (line_entirely_outside)
+            {
+                return false;
             }
 
-            // DETERMINE IF THE NEW Z IS IN FRONT.
-            unsigned int current_pixel_x = static_cast<unsigned int>(std::round(x));
-            unsigned int current_pixel_y = static_cast<unsigned int>(std::round(y));
-            if (depth_buffer)
+            // COMPUTE WHERE THE LINE CROSSES A BOUNDARY OUTSIDE OF WHICH AN ENDPOINT LIES.
+            bool start_outside = (CLIP_OUTCODE_INSIDE != start_outcode);
+            unsigned int outside_outcode = start_outside ? start_outcode : end_outcode;
+            MATH::Vector3f start_to_end = end_position - start_position;
+            float ratio_toward_end = 0.0f;
+            if (outside_outcode & CLIP_OUTCODE_ABOVE)
             {
-                float current_pixel_depth = depth_buffer->GetDepth(current_pixel_x, current_pixel_y);
-                bool current_pixel_in_front_of_old_pixels = (z >= current_pixel_depth);
-                if (!current_pixel_in_front_of_old_pixels)
-                {
-                    // Continue to the next iteration of the loop in
-                    // case there is another pixel to draw.
-                    continue;
-                }
+                ratio_toward_end = (0.0f - start_position.Y) / start_to_end.Y;
+            }
+            else if (outside_outcode & CLIP_OUTCODE_BELOW)
+            {
+                ratio_toward_end = (max_y - start_position.Y) / start_to_end.Y;
+            }
+            else if (outside_outcode & CLIP_OUTCODE_RIGHT)
+            {
+                ratio_toward_end = (max_x - start_position.X) / start_to_end.X;
+            }
+            else
+            {
+                ratio_toward_end = (0.0f - start_position.X) / start_to_end.X;
             }
+            MATH::Vector3f clipped_position = start_position + MATH::Vector3f::Scale(ratio_toward_end, start_to_end);
+            float clipped_ratio_along_line = start_ratio_along_line + ratio_toward_end * (end_ratio_along_line - start_ratio_along_line);
 
-            // CALCULATE THE COLOR AT THE CURRENT POINT.
-            MATH::Vector2f vector_to_current_pixel(x - start_x, y - start_y);
-            float length_to_current_pixel_from_line_start = vector_to_current_pixel.Length();
-            float ratio_toward_end_of_line = (length_to_current_pixel_from_line_start / line_length);
-            Color interpolated_color = Color::InterpolateRedGreenBlue(start_vertex.Color, end_vertex.Color, ratio_toward_end_of_line);
+            // Clipped coordinates are snapped exactly onto the boundary to avoid floating-point error keeping them outside.
+            if (outside_outcode & CLIP_OUTCODE_ABOVE)
+            {
+                clipped_position.Y = 0.0f;
+            }
+            else if (outside_outcode & CLIP_OUTCODE_BELOW)
+            {
+                clipped_position.Y = max_y;
+            }
+            else if (outside_outcode & CLIP_OUTCODE_RIGHT)
+            {
+                clipped_position.X = max_x;
+            }
+            else
+            {
+                clipped_position.X = 0.0f;
+            }
 
-            // DRAW A PIXEL AT THE CURRENT POSITION.
-            // The coordinates need to be rounded to integer in order
-            // to plot a pixel on a fixed grid.
-            render_target.WritePixel(
-                current_pixel_x,
-                current_pixel_y,
-                interpolated_color);
-            if (depth_buffer)
+            // MOVE THE OUTSIDE ENDPOINT ONTO THE BOUNDARY.
+            if (start_outside)
+            {
+                start_position = clipped_position;
+                start_ratio_along_line = clipped_ratio_along_line;
+            }
+            else
             {
-                depth_buffer->WriteDepth(current_pixel_x, current_pixel_y, z);
+                end_position = clipped_position;
+                end_ratio_along_line = clipped_ratio_along_line;
             }
         }
     }
+
+    /// Computes the Cohen-Sutherland outcode for a position relative to a clipping rectangle from (0, 0) to the specified maximum coordinates.
+    /// @param[in]  position - The position for which to compute the outcode.
+    /// @param[in]  max_x - The maximum x coordinate of the clipping rectangle.
+    /// @param[in]  max_y - The maximum y coordinate of the clipping rectangle.
+    /// @return The outcode with bits set for each boundary outside of which the position lies.
+    unsigned int CpuRasterizationAlgorithm::ComputeClipOutcode(const MATH::Vector3f& position, const float max_x, const float max_y)
+    {
+        unsigned int outcode = CLIP_OUTCODE_INSIDE;
+        if (position.X < 0.0f)
+        {
+            outcode |= CLIP_OUTCODE_LEFT;
+        }
+        else if (position.X > max_x)
+        {
+            outcode |= CLIP_OUTCODE_RIGHT;
+        }
+
+        if (position.Y < 0.0f)
+        {
+            outcode |= CLIP_OUTCODE_ABOVE;
+        }
+        else if (position.Y > max_y)
+        {
+            outcode |= CLIP_OUTCODE_BELOW;
+        }
+
+        return outcode;
+    }
 }
 
 #endif
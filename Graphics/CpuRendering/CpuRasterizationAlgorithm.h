@@ -2,17 +2,32 @@
 
 #if _WIN32
 
+#include <array>
+#include <cstddef>
 #include <optional>
+#include <utility>
 #include <vector>
+#include "Graphics/CpuRendering/ClusteredLightGrid.h"
+#include "Graphics/CpuRendering/GBuffer.h"
+#include "Graphics/CpuRendering/LineBatch.h"
+#include "Graphics/CpuRendering/LitVertexCache.h"
+#include "Graphics/CpuRendering/ShadowMap.h"
 #include "Graphics/DepthBuffer.h"
 #include "Graphics/Geometry/Triangle.h"
 #include "Graphics/Gui/Text.h"
+#include "Graphics/Gui/TextLayout.h"
+#include "Graphics/Gui/TextLayoutCache.h"
 #include "Graphics/Images/Bitmap.h"
+#include "Graphics/Images/MipmappedTexture.h"
 #include "Graphics/RenderingSettings.h"
+#include "Graphics/RenderQueue.h"
 #include "Graphics/Scene.h"
 #include "Graphics/Shading/Lighting/Light.h"
 #include "Graphics/VertexWithAttributes.h"
 #include "Graphics/Viewing/Camera.h"
+#include "Graphics/Viewing/ViewingTransformations.h"
+#include "Math/AffineTransform3x4.h"
+#include "Processor/SimdIntrinsics.h"
 
 namespace GRAPHICS::CPU_RENDERING
 {
@@ -22,13 +37,29 @@ namespace GRAPHICS::CPU_RENDERING
     {
     public:
         static void Render(const GUI::Text& text, IMAGES::Bitmap& render_target);
+        static void Render(const GUI::Text& text, GUI::TextLayoutCache& text_layout_cache, IMAGES::Bitmap& render_target);
+        static void Render(const GUI::Text& text, const GUI::TextLayout& text_layout, IMAGES::Bitmap& render_target);
+        static void BlendTextRow(
+            const uint8_t* coverages,
+            const uint32_t packed_color,
+            const unsigned int pixel_count,
+            uint32_t* destination_pixels);
+        SIMD_TARGET_AVX2 static void BlendTextRowSimd8x(
+            const uint8_t* coverages,
+            const uint32_t packed_color,
+            const unsigned int pixel_count,
+            uint32_t* destination_pixels);
 
         static void Render(
             const Scene& scene, 
             const VIEWING::Camera& camera,
             const RenderingSettings& rendering_settings,
             IMAGES::Bitmap& output_bitmap,
-            DepthBuffer* depth_buffer);
+            DepthBuffer* depth_buffer,
+            VIEWING::LevelOfDetailSelector* level_of_detail_selector = nullptr,
+            LitVertexCache* lit_vertex_cache = nullptr,
+            GBuffer* g_buffer = nullptr,
+            const bool output_bitmap_already_cleared = false);
         static void Render(
             const Object3D& object_3D, 
             const std::vector<SHADING::LIGHTING::Light>& lights, 
@@ -36,8 +67,85 @@ namespace GRAPHICS::CPU_RENDERING
             const RenderingSettings& rendering_settings,
             IMAGES::Bitmap& output_bitmap,
             DepthBuffer* depth_buffer);
+        static std::vector<ShadowMap> RenderShadowMaps(
+            const RenderQueue& render_queue,
+            const std::vector<SHADING::LIGHTING::Light>& lights,
+            const RenderingSettings& rendering_settings,
+            LitVertexCache& lit_vertex_cache);
+        static void Render(
+            const RenderQueue& render_queue,
+            const std::vector<SHADING::LIGHTING::Light>& lights,
+            const std::vector<ShadowMap>& shadow_maps,
+            const VIEWING::Camera& camera,
+            const RenderingSettings& rendering_settings,
+            LitVertexCache& lit_vertex_cache,
+            IMAGES::Bitmap& output_bitmap,
+            DepthBuffer* depth_buffer);
+        static void RenderMesh(
+            const Mesh& mesh,
+            const MATH::AffineTransform3x4& object_world_transform,
+            const std::vector<SHADING::LIGHTING::Light>& lights,
+            const ClusteredLightGrid* light_grid,
+            const std::vector<ShadowMap>& shadow_maps,
+            const VIEWING::Camera& camera,
+            const VIEWING::ViewingTransformations& viewing_transformations,
+            const RenderingSettings& rendering_settings,
+            LineBatch& wireframe_line_batch,
+            LitVertexCache& lit_vertex_cache,
+            IMAGES::Bitmap& output_bitmap,
+            DepthBuffer* depth_buffer);
 
-        static GEOMETRY::Triangle TransformLocalToWorld(const GEOMETRY::Triangle& local_triangle, const MATH::Matrix4x4f& world_transform);
+        static void RenderDeferred(
+            const RenderQueue& render_queue,
+            const std::vector<SHADING::LIGHTING::Light>& lights,
+            const std::vector<ShadowMap>& shadow_maps,
+            const VIEWING::Camera& camera,
+            const RenderingSettings& rendering_settings,
+            LitVertexCache& lit_vertex_cache,
+            GBuffer& g_buffer,
+            IMAGES::Bitmap& output_bitmap,
+            DepthBuffer* depth_buffer);
+        static void RenderMeshToGBuffer(
+            const Mesh& mesh,
+            const MATH::AffineTransform3x4& object_world_transform,
+            const VIEWING::Camera& camera,
+            const VIEWING::ViewingTransformations& viewing_transformations,
+            const RenderingSettings& rendering_settings,
+            LitVertexCache& lit_vertex_cache,
+            GBuffer& g_buffer,
+            DepthBuffer* depth_buffer);
+        static void RasterizeToGBuffer(
+            const GEOMETRY::Triangle& world_space_triangle,
+            const GEOMETRY::Triangle& screen_space_triangle,
+            const uint16_t material_id,
+            const bool interpolate_vertex_normals,
+            const RenderingSettings& rendering_settings,
+            GBuffer& g_buffer,
+            DepthBuffer* depth_buffer);
+
+        static void RenderWorldSpaceTriangle(
+            const GEOMETRY::Triangle& world_space_triangle,
+            const std::vector<SHADING::LIGHTING::Light>& lights,
+            const ClusteredLightGrid* light_grid,
+            const std::vector<ShadowMap>& shadow_maps,
+            const VIEWING::Camera& camera,
+            const VIEWING::ViewingTransformations& viewing_transformations,
+            const RenderingSettings& rendering_settings,
+            IMAGES::Bitmap& output_bitmap,
+            DepthBuffer* depth_buffer,
+            const bool vertices_already_shaded = false);
+        static std::optional<GEOMETRY::Triangle> ComputeShadedScreenSpaceTriangle(
+            const GEOMETRY::Triangle& world_space_triangle,
+            const std::vector<SHADING::LIGHTING::Light>& lights,
+            const ClusteredLightGrid* light_grid,
+            const std::vector<ShadowMap>& shadow_maps,
+            const VIEWING::Camera& camera,
+            const VIEWING::ViewingTransformations& viewing_transformations,
+            const RenderingSettings& rendering_settings,
+            const bool vertices_already_shaded = false);
+
+        static std::vector<VertexWithAttributes> TransformLocalToWorld(const std::vector<VertexWithAttributes>& local_vertices, const MATH::AffineTransform3x4& world_transform);
+        static GEOMETRY::Triangle TransformLocalToWorld(const GEOMETRY::Triangle& local_triangle, const MATH::AffineTransform3x4& world_transform);
 
         static void Render(
             const GEOMETRY::Triangle& triangle,
@@ -45,6 +153,87 @@ namespace GRAPHICS::CPU_RENDERING
             IMAGES::Bitmap& render_target,
             DepthBuffer* depth_buffer);
 
+        /// A single texture applied to a triangle.  Only one version of the texture is set.
+        struct TriangleTexture
+        {
+            /// The mipmapped version of the texture, which is preferred if it exists.
+            const IMAGES::MipmappedTexture* MipmappedTexture = nullptr;
+            /// The non-mipmapped version of the texture.
+            const IMAGES::Bitmap* Texture = nullptr;
+        };
+        /// The textures applied to a triangle, which only need to be determined once per triangle.
+        struct TriangleTextures
+        {
+            /// The textures, in the order their colors are summed (ambient, diffuse, specular).
+            std::array<TriangleTexture, 3> Textures = {};
+            /// The number of textures that apply.
+            std::size_t Count = 0;
+            /// The type of filtering to use for mipmapped textures.
+            TextureFilteringType Filtering = TextureFilteringType::NEAREST;
+        };
+        static TriangleTextures GetTriangleTextures(const GEOMETRY::Triangle& triangle, const SHADING::ShadingSettings& shading_settings);
+        static Color ComputeTextureColor(
+            const GEOMETRY::Triangle& triangle,
+            const MATH::Vector2f& point,
+            const TriangleTextures& triangle_textures);
+
+        // TRIANGLE RASTERIZATION SPECIALIZATION.
+        /// The flag for rasterizing triangles with a single flat color.
+        static constexpr unsigned int TRIANGLE_RASTERIZATION_FLAT_SHADING = 1 << 0;
+        /// The flag for applying textures to rasterized triangles.
+        static constexpr unsigned int TRIANGLE_RASTERIZATION_TEXTURE_MAPPING = 1 << 1;
+        /// The flag for computing mipmap levels for textures of rasterized triangles.
+        static constexpr unsigned int TRIANGLE_RASTERIZATION_MIPMAPPING = 1 << 2;
+        /// The flag for depth testing and writing rasterized pixels.
+        static constexpr unsigned int TRIANGLE_RASTERIZATION_DEPTH_BUFFERING = 1 << 3;
+        /// The flag for writing colors of rasterized pixels.
+        static constexpr unsigned int TRIANGLE_RASTERIZATION_COLOR_WRITES = 1 << 4;
+        /// The number of possible combinations of triangle rasterization flags.
+        static constexpr unsigned int TRIANGLE_RASTERIZATION_FLAG_COMBINATION_COUNT = 1 << 5;
+
+        static unsigned int GetTriangleRasterizationFlags(
+            const TriangleTextures& triangle_textures,
+            const RenderingSettings& rendering_settings,
+            const DepthBuffer* const depth_buffer);
+        static constexpr unsigned int NormalizeTriangleRasterizationFlags(const unsigned int rasterization_flags);
+        /// A function that rasterizes a triangle, specialized for a combination of rasterization flags.
+        using TriangleRasterizationFunction = void (*)(
+            const GEOMETRY::Triangle& triangle,
+            const TriangleTextures& triangle_textures,
+            const float clamped_min_x,
+            const float clamped_max_x,
+            const float clamped_min_y,
+            const float clamped_max_y,
+            IMAGES::Bitmap& render_target,
+            DepthBuffer* depth_buffer);
+        template <unsigned int... RASTERIZATION_FLAGS>
+        static constexpr std::array<TriangleRasterizationFunction, sizeof...(RASTERIZATION_FLAGS)> GetRasterizationFunctions(
+            std::integer_sequence<unsigned int, RASTERIZATION_FLAGS...> all_rasterization_flags);
+        template <unsigned int... RASTERIZATION_FLAGS>
+        static constexpr std::array<TriangleRasterizationFunction, sizeof...(RASTERIZATION_FLAGS)> GetRasterizationFunctionsSimd8x(
+            std::integer_sequence<unsigned int, RASTERIZATION_FLAGS...> all_rasterization_flags);
+        template <unsigned int RASTERIZATION_FLAGS>
+        static void Rasterize(
+            const GEOMETRY::Triangle& triangle,
+            const TriangleTextures& triangle_textures,
+            const float clamped_min_x,
+            const float clamped_max_x,
+            const float clamped_min_y,
+            const float clamped_max_y,
+            IMAGES::Bitmap& render_target,
+            DepthBuffer* depth_buffer);
+        template <unsigned int RASTERIZATION_FLAGS>
+        SIMD_TARGET_AVX2 static void RasterizeSimd8x(
+            const GEOMETRY::Triangle& triangle,
+            const TriangleTextures& triangle_textures,
+            const float clamped_min_x,
+            const float clamped_max_x,
+            const float clamped_min_y,
+            const float clamped_max_y,
+            IMAGES::Bitmap& render_target,
+            DepthBuffer* depth_buffer);
+
+        static void Render(const LineBatch& line_batch, IMAGES::Bitmap& render_target, DepthBuffer* depth_buffer);
         static void DrawLine(
             const MATH::Vector3f& start_vertex,
             const MATH::Vector3f& end_vertex,
@@ -56,6 +245,29 @@ namespace GRAPHICS::CPU_RENDERING
             const VertexWithAttributes& end_vertex,
             IMAGES::Bitmap& render_target,
             DepthBuffer* depth_buffer);
+        static void RasterizeLine(const LineBatch::Line& line, IMAGES::Bitmap& render_target, DepthBuffer* depth_buffer);
+
+    private:
+        // LINE CLIPPING.
+        /// The outcode for a position inside of a clipping rectangle.
+        static constexpr unsigned int CLIP_OUTCODE_INSIDE = 0;
+        /// The outcode bit for a position left of a clipping rectangle.
+        static constexpr unsigned int CLIP_OUTCODE_LEFT = 1 << 0;
+        /// The outcode bit for a position right of a clipping rectangle.
+        static constexpr unsigned int CLIP_OUTCODE_RIGHT = 1 << 1;
+        /// The outcode bit for a position above (smaller y than) a clipping rectangle.
+        static constexpr unsigned int CLIP_OUTCODE_ABOVE = 1 << 2;
+        /// The outcode bit for a position below (larger y than) a clipping rectangle.
+        static constexpr unsigned int CLIP_OUTCODE_BELOW = 1 << 3;
+
+        static bool ClipLine(
+            const float max_x,
+            const float max_y,
+            MATH::Vector3f& start_position,
+            float& start_ratio_along_line,
+            MATH::Vector3f& end_position,
+            float& end_ratio_along_line);
+        static unsigned int ComputeClipOutcode(const MATH::Vector3f& position, const float max_x, const float max_y);
     };
 }
 
@@ -0,0 +1,330 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <future>
+#include <limits>
+#include <optional>
+#include <thread>
+#include "ErrorHandling/Asserts.h"
+#include "Graphics/CpuRendering/DeferredLightingAlgorithm.h"
+#include "Graphics/Shading/WorldSpaceShading.h"
+#include "Graphics/Surface.h"
+#include "Math/Vector4.h"
+
+namespace GRAPHICS::CPU_RENDERING
+{
+    /// Computes the screen space bounds of the region a light can illuminate.
+    /// Only point lights with a limited range have bounds smaller than the entire screen.
+    /// @param[in]  light - The light to compute bounds for.
+    /// @param[in]  viewing_transformations - The viewing transformations for the screen.
+    /// @param[in]  screen_width_in_pixels - The width of the screen.
+    /// @param[in]  screen_height_in_pixels - The height of the screen.
+    /// @return The pixels the light may illuminate; empty if the light can't illuminate anything in view.
+    MATH::Rectangleui DeferredLightingAlgorithm::ComputeScreenBounds(
+        const SHADING::LIGHTING::Light& light,
+        const VIEWING::ViewingTransformations& viewing_transformations,
+        const unsigned int screen_width_in_pixels,
+        const unsigned int screen_height_in_pixels)
+    {
+        // CHECK IF THE LIGHT HAS A LIMITED RANGE.
+        MATH::Rectangleui entire_screen = MATH::Rectangleui::FromLeftTopAndDimensions(0, 0, screen_width_in_pixels, screen_height_in_pixels);
+        bool light_has_limited_range = (
+            SHADING::LIGHTING::LightType::POINT == light.Type &&
+            light.PointLightRange < std::numeric_limits<float>::max());
+        if (!light_has_limited_range)
+        {
+            return entire_screen;
+        }
+
+        // GET THE CORNERS OF A CUBE BOUNDING THE LIGHT'S RANGE.
+        constexpr std::size_t CORNER_COUNT = 8;
+        std::array<MATH::Vector3f, CORNER_COUNT> world_corners;
+        for (std::size_t corner_index = 0; corner_index < CORNER_COUNT; ++corner_index)
+        {
+            float x_offset = (corner_index & 1) ? light.PointLightRange : -light.PointLightRange;
+            float y_offset = (corner_index & 2) ? light.PointLightRange : -light.PointLightRange;
+            float z_offset = (corner_index & 4) ? light.PointLightRange : -light.PointLightRange;
+            world_corners[corner_index] = light.PointLightWorldPosition + MATH::Vector3f(x_offset, y_offset, z_offset);
+        }
+
+        // CHECK IF THE LIGHT IS ENTIRELY IN FRONT OF THE NEAR PLANE OR BEYOND THE FAR PLANE.
+        // "Direction" of comparisons is reversed due to being along negative Z axis.
+        float near_z_boundary = -viewing_transformations.CameraNearClipPlaneViewDistance;
+        float far_z_boundary = -viewing_transformations.CameraFarClipPlaneViewDistance;
+        bool all_corners_behind_near_plane = true;
+        bool all_corners_beyond_far_plane = true;
+        for (const MATH::Vector3f& world_corner : world_corners)
+        {
+            MATH::Vector4f view_corner = viewing_transformations.CameraViewTransform * MATH::Vector4f::HomogeneousPositionVector(world_corner);
+            all_corners_behind_near_plane = all_corners_behind_near_plane && (view_corner.Z > near_z_boundary);
+            all_corners_beyond_far_plane = all_corners_beyond_far_plane && (view_corner.Z < far_z_boundary);
+        }
+        if (all_corners_behind_near_plane || all_corners_beyond_far_plane)
+        {
+            return MATH::Rectangleui();
+        }
+
+        // BOUND THE PROJECTED CORNERS.
+        // If any corner can't be projected, then the light straddles a clip plane, and its projection
+        // may wrap around the screen, so the entire screen is conservatively used.
+        float min_x = std::numeric_limits<float>::max();
+        float max_x = std::numeric_limits<float>::lowest();
+        float min_y = std::numeric_limits<float>::max();
+        float max_y = std::numeric_limits<float>::lowest();
+        for (const MATH::Vector3f& world_corner : world_corners)
+        {
+            std::optional<MATH::Vector3f> screen_corner = viewing_transformations.WorldToScreen(world_corner);
+            if (!screen_corner)
+            {
+                return entire_screen;
+            }
+
+            min_x = std::min(min_x, screen_corner->X);
+            max_x = std::max(max_x, screen_corner->X);
+            min_y = std::min(min_y, screen_corner->Y);
+            max_y = std::max(max_y, screen_corner->Y);
+        }
+
+        // CLIP THE BOUNDS TO THE SCREEN.
+        // Bounds are expanded to whole pixels since pixels are sampled at integer coordinates.
+        float screen_width = static_cast<float>(screen_width_in_pixels);
+        float screen_height = static_cast<float>(screen_height_in_pixels);
+        float clipped_min_x = std::clamp(std::floor(min_x), 0.0f, screen_width);
+        float clipped_max_x = std::clamp(std::ceil(max_x) + 1.0f, 0.0f, screen_width);
+        float clipped_min_y = std::clamp(std::floor(min_y), 0.0f, screen_height);
+        float clipped_max_y = std::clamp(std::ceil(max_y) + 1.0f, 0.0f, screen_height);
+        MATH::Rectangleui screen_bounds = MATH::Rectangleui::FromLeftTopAndDimensions(
+            static_cast<unsigned int>(clipped_min_x),
+            static_cast<unsigned int>(clipped_min_y),
+            static_cast<unsigned int>(clipped_max_x - clipped_min_x),
+            static_cast<unsigned int>(clipped_max_y - clipped_min_y));
+        return screen_bounds;
+    }
+
+    /// Lights all pixels covered by geometry in a G-buffer, writing the final colors to a render target.
+    /// Pixels not covered by geometry are left unchanged.
+    /// @param[in]  g_buffer - The G-buffer with surface attributes of pixels to light.
+    /// @param[in]  lights - The lights illuminating the pixels.
+    /// @param[in]  shadow_maps - Shadow maps for any lights that cast shadows.
+    /// @param[in]  viewing_point - The world position from which the pixels are being viewed.
+    /// @param[in]  viewing_transformations - The viewing transformations used to write the G-buffer.
+    /// @param[in]  shading_settings - The settings to use for shading.  Texture mapping must have already
+    ///     been applied when writing albedos to the G-buffer.
+    /// @param[in,out]  render_target - The target to write lit pixels to.  Must be the same size as the G-buffer.
+    void DeferredLightingAlgorithm::Apply(
+        const GBuffer& g_buffer,
+        const std::vector<SHADING::LIGHTING::Light>& lights,
+        const std::vector<ShadowMap>& shadow_maps,
+        const MATH::Vector3f& viewing_point,
+        const VIEWING::ViewingTransformations& viewing_transformations,
+        const SHADING::ShadingSettings& shading_settings,
+        IMAGES::Bitmap& render_target)
+    {
+        // MAKE SURE THE RENDER TARGET MATCHES THE G-BUFFER.
+        bool render_target_matches_g_buffer = (
+            render_target.GetWidthInPixels() == g_buffer.GetWidthInPixels() &&
+            render_target.GetHeightInPixels() == g_buffer.GetHeightInPixels());
+        ASSERT_THEN_IF_NOT(render_target_matches_g_buffer)
+        {
+            return;
+        }
+
+        // SKIP LIGHTING IF NO PIXELS ARE COVERED.
+        if (g_buffer.WrittenBounds.IsEmpty())
+        {
+            return;
+        }
+        render_target.MarkDirty(g_buffer.WrittenBounds);
+
+        // COMPUTE THE SCREEN BOUNDS OF EACH LIGHT.
+        std::vector<MATH::Rectangleui> light_screen_bounds;
+        light_screen_bounds.reserve(lights.size());
+        for (const SHADING::LIGHTING::Light& light : lights)
+        {
+            MATH::Rectangleui screen_bounds = ComputeScreenBounds(light, viewing_transformations, g_buffer.GetWidthInPixels(), g_buffer.GetHeightInPixels());
+            light_screen_bounds.emplace_back(screen_bounds);
+        }
+
+        // FIND THE SHADOW MAP OF EACH LIGHT.
+        // This avoids searching for shadow maps for every pixel.
+        std::vector<const ShadowMap*> light_shadow_maps;
+        light_shadow_maps.reserve(lights.size());
+        for (const SHADING::LIGHTING::Light& light : lights)
+        {
+            light_shadow_maps.emplace_back(ShadowMap::Find(shadow_maps, light));
+        }
+
+        // LIGHT ROWS OF TILES ACROSS MULTIPLE THREADS.
+        // Only tiles with pixels covered by geometry need to be lit.
+        // Each thread writes to different pixels, so no synchronization is needed.
+        MATH::Matrix4x4f screen_to_world_transform = viewing_transformations.ScreenToWorldTransform();
+        unsigned int first_tile_row_index = g_buffer.WrittenBounds.TopY / TILE_DIMENSION_IN_PIXELS;
+        unsigned int end_tile_row_index = (g_buffer.WrittenBounds.BottomY() + TILE_DIMENSION_IN_PIXELS - 1) / TILE_DIMENSION_IN_PIXELS;
+        unsigned int tile_row_count = end_tile_row_index - first_tile_row_index;
+        unsigned int thread_count = std::clamp(std::thread::hardware_concurrency(), 1u, tile_row_count);
+        unsigned int tile_row_count_per_thread = (tile_row_count + thread_count - 1) / thread_count;
+        std::vector<std::future<void>> lighting_threads;
+        for (unsigned int thread_first_tile_row_index = first_tile_row_index; thread_first_tile_row_index < end_tile_row_index; thread_first_tile_row_index += tile_row_count_per_thread)
+        {
+            unsigned int thread_end_tile_row_index = std::min(thread_first_tile_row_index + tile_row_count_per_thread, end_tile_row_index);
+            lighting_threads.emplace_back(std::async(
+                std::launch::async,
+                [=, &g_buffer, &lights, &light_screen_bounds, &light_shadow_maps, &viewing_point, &viewing_transformations, &screen_to_world_transform, &shading_settings, &render_target]()
+                {
+                    ApplyToTileRows(
+                        thread_first_tile_row_index,
+                        thread_end_tile_row_index,
+                        g_buffer,
+                        lights,
+                        light_screen_bounds,
+                        light_shadow_maps,
+                        viewing_point,
+                        viewing_transformations,
+                        screen_to_world_transform,
+                        shading_settings,
+                        render_target);
+                }));
+        }
+        for (std::future<void>& lighting_thread : lighting_threads)
+        {
+            lighting_thread.wait();
+        }
+    }
+
+    /// Lights the covered pixels within rows of tiles.
+    /// @param[in]  first_tile_row_index - The index of the first row of tiles to light.
+    /// @param[in]  end_tile_row_index - The index one past the last row of tiles to light.
+    /// @param[in]  g_buffer - The G-buffer with surface attributes of pixels to light.
+    /// @param[in]  lights - The lights illuminating the pixels.
+    /// @param[in]  light_screen_bounds - The screen bounds of each light, in the same order as the lights.
+    /// @param[in]  light_shadow_maps - The shadow map of each light (null for lights without shadow maps), in the same order as the lights.
+    /// @param[in]  viewing_point - The world position from which the pixels are being viewed.
+    /// @param[in]  viewing_transformations - The viewing transformations used to write the G-buffer.
+    /// @param[in]  screen_to_world_transform - The transform for reconstructing world positions of pixels.
+    /// @param[in]  shading_settings - The settings to use for shading.
+    /// @param[in,out]  render_target - The target to write lit pixels to.
+    void DeferredLightingAlgorithm::ApplyToTileRows(
+        const unsigned int first_tile_row_index,
+        const unsigned int end_tile_row_index,
+        const GBuffer& g_buffer,
+        const std::vector<SHADING::LIGHTING::Light>& lights,
+        const std::vector<MATH::Rectangleui>& light_screen_bounds,
+        const std::vector<const ShadowMap*>& light_shadow_maps,
+        const MATH::Vector3f& viewing_point,
+        const VIEWING::ViewingTransformations& viewing_transformations,
+        const MATH::Matrix4x4f& screen_to_world_transform,
+        const SHADING::ShadingSettings& shading_settings,
+        IMAGES::Bitmap& render_target)
+    {
+        // GET DIRECT ACCESS TO THE PIXEL DATA.
+        // This avoids bounds checking for every attribute of every pixel.
+        const MATH::Vector3f* normals = g_buffer.Normals.ValuesInRowMajorOrder();
+        const uint32_t* albedos = g_buffer.Albedos.ValuesInRowMajorOrder();
+        const uint16_t* material_ids = g_buffer.MaterialIds.ValuesInRowMajorOrder();
+        const float* depths = g_buffer.Depths.ValuesInRowMajorOrder();
+        uint32_t* pixels = render_target.GetRawData();
+        ColorFormat color_format = render_target.GetColorFormat();
+        unsigned int width_in_pixels = g_buffer.GetWidthInPixels();
+
+        // Texturing was already applied to albedos.
+        SHADING::ShadingSettings lighting_shading_settings = shading_settings;
+        lighting_shading_settings.TextureMappingEnabled = false;
+        constexpr float NO_SHADOWING = 1.0f;
+
+        // LIGHT EACH TILE.
+        unsigned int first_tile_column_index = g_buffer.WrittenBounds.LeftX / TILE_DIMENSION_IN_PIXELS;
+        unsigned int end_tile_column_index = (g_buffer.WrittenBounds.RightX() + TILE_DIMENSION_IN_PIXELS - 1) / TILE_DIMENSION_IN_PIXELS;
+        std::vector<std::size_t> tile_light_indices;
+        for (unsigned int tile_row_index = first_tile_row_index; tile_row_index < end_tile_row_index; ++tile_row_index)
+        {
+            for (unsigned int tile_column_index = first_tile_column_index; tile_column_index < end_tile_column_index; ++tile_column_index)
+            {
+                // GET THE COVERED PIXELS IN THE TILE.
+                MATH::Rectangleui tile = MATH::Rectangleui::Intersection(
+                    g_buffer.WrittenBounds,
+                    MATH::Rectangleui::FromLeftTopAndDimensions(
+                        tile_column_index * TILE_DIMENSION_IN_PIXELS,
+                        tile_row_index * TILE_DIMENSION_IN_PIXELS,
+                        TILE_DIMENSION_IN_PIXELS,
+                        TILE_DIMENSION_IN_PIXELS));
+                if (tile.IsEmpty())
+                {
+                    continue;
+                }
+
+                // DETERMINE WHICH LIGHTS MAY ILLUMINATE THE TILE.
+                tile_light_indices.clear();
+                if (shading_settings.Lighting.Enabled)
+                {
+                    for (std::size_t light_index = 0; light_index < lights.size(); ++light_index)
+                    {
+                        if (light_screen_bounds[light_index].Intersects(tile))
+                        {
+                            tile_light_indices.emplace_back(light_index);
+                        }
+                    }
+                }
+
+                // LIGHT EACH COVERED PIXEL IN THE TILE.
+                // The surface's material is only changed when needed to avoid excess reference counting.
+                Surface surface;
+                uint16_t surface_material_id = GBuffer::NO_MATERIAL_ID;
+                for (unsigned int y = tile.TopY; y < tile.BottomY(); ++y)
+                {
+                    for (unsigned int x = tile.LeftX; x < tile.RightX(); ++x)
+                    {
+                        // SKIP PIXELS NOT COVERED BY GEOMETRY.
+                        std::size_t pixel_index = static_cast<std::size_t>(y) * width_in_pixels + x;
+                        uint16_t material_id = material_ids[pixel_index];
+                        if (GBuffer::NO_MATERIAL_ID == material_id)
+                        {
+                            continue;
+                        }
+
+                        // RECONSTRUCT THE SURFACE AT THE PIXEL.
+                        if (material_id != surface_material_id)
+                        {
+                            surface.Material = g_buffer.GetMaterial(material_id);
+                            surface_material_id = material_id;
+                        }
+                        surface.Normal = normals[pixel_index];
+                        MATH::Vector3f screen_position(static_cast<float>(x), static_cast<float>(y), depths[pixel_index]);
+                        MATH::Vector3f world_position = viewing_transformations.ScreenToWorld(screen_position, screen_to_world_transform);
+
+                        // ADD LIGHTING FROM EACH LIGHT WHOSE BOUNDS INCLUDE THE PIXEL.
+                        MATH::Rectangleui pixel = MATH::Rectangleui::FromLeftTopAndDimensions(x, y, 1, 1);
+                        Color light_total_color = Color::BLACK;
+                        for (std::size_t light_index : tile_light_indices)
+                        {
+                            if (!light_screen_bounds[light_index].Contains(pixel))
+                            {
+                                continue;
+                            }
+
+                            // Shadow maps are only sampled for lights that reach the pixel since other lights contribute no lighting.
+                            const SHADING::LIGHTING::Light& light = lights[light_index];
+                            const ShadowMap* shadow_map = light_shadow_maps[light_index];
+                            float shadow_factor = (shadow_map && light.Reaches(world_position)) ?
+                                shadow_map->ComputeShadowFactor(world_position, normals[pixel_index]) :
+                                NO_SHADOWING;
+                            Color light_color = SHADING::WorldSpaceShading::ComputeMaterialShading(
+                                world_position,
+                                surface,
+                                viewing_point,
+                                light,
+                                shadow_factor,
+                                lighting_shading_settings);
+                            light_total_color += light_color;
+                        }
+
+                        // WRITE THE FINAL COLOR.
+                        Color albedo = Color::Unpack(albedos[pixel_index], GBuffer::ALBEDO_COLOR_FORMAT);
+                        Color pixel_color = Color::ComponentMultiplyRedGreenBlue(light_total_color, albedo);
+                        pixel_color.Clamp();
+                        pixels[pixel_index] = pixel_color.Pack(color_format);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <vector>
+#include "Graphics/CpuRendering/GBuffer.h"
+#include "Graphics/CpuRendering/ShadowMap.h"
+#include "Graphics/Images/Bitmap.h"
+#include "Graphics/Shading/Lighting/Light.h"
+#include "Graphics/Shading/ShadingSettings.h"
+#include "Graphics/Viewing/ViewingTransformations.h"
+#include "Math/Matrix4x4.h"
+#include "Math/Rectangle.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS::CPU_RENDERING
+{
+    /// Lights pixels from the surface attributes in a G-buffer after all geometry has been rasterized.
+    /// This keeps the cost of lighting proportional to the number of visible pixels rather than
+    /// the amount of geometry, which matters most for scenes with many lights.
+    ///
+    /// Lighting is computed for tiles of pixels in parallel, and each light is only applied
+    /// to pixels within the screen space bounds of the region it can illuminate.
+    class DeferredLightingAlgorithm
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The width and height of square tiles of pixels that lights are culled against.
+        static constexpr unsigned int TILE_DIMENSION_IN_PIXELS = 32;
+
+        static MATH::Rectangleui ComputeScreenBounds(
+            const SHADING::LIGHTING::Light& light,
+            const VIEWING::ViewingTransformations& viewing_transformations,
+            const unsigned int screen_width_in_pixels,
+            const unsigned int screen_height_in_pixels);
+        static void Apply(
+            const GBuffer& g_buffer,
+            const std::vector<SHADING::LIGHTING::Light>& lights,
+            const std::vector<ShadowMap>& shadow_maps,
+            const MATH::Vector3f& viewing_point,
+            const VIEWING::ViewingTransformations& viewing_transformations,
+            const SHADING::ShadingSettings& shading_settings,
+            IMAGES::Bitmap& render_target);
+
+    private:
+        static void ApplyToTileRows(
+            const unsigned int first_tile_row_index,
+            const unsigned int end_tile_row_index,
+            const GBuffer& g_buffer,
+            const std::vector<SHADING::LIGHTING::Light>& lights,
+            const std::vector<MATH::Rectangleui>& light_screen_bounds,
+            const std::vector<const ShadowMap*>& light_shadow_maps,
+            const MATH::Vector3f& viewing_point,
+            const VIEWING::ViewingTransformations& viewing_transformations,
+            const MATH::Matrix4x4f& screen_to_world_transform,
+            const SHADING::ShadingSettings& shading_settings,
+            IMAGES::Bitmap& render_target);
+    };
+}
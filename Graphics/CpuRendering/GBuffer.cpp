@@ -0,0 +1,134 @@
+#include <algorithm>
+#include "ErrorHandling/Asserts.h"
+#include "Graphics/CpuRendering/GBuffer.h"
+
+namespace GRAPHICS::CPU_RENDERING
+{
+    /// Constructor.  The buffer starts out cleared.
+    /// @param[in]  width_in_pixels - The width of the buffer.
+    /// @param[in]  height_in_pixels - The height of the buffer.
+    GBuffer::GBuffer(const unsigned int width_in_pixels, const unsigned int height_in_pixels)
+    {
+        Resize(width_in_pixels, height_in_pixels);
+    }
+
+    /// Gets the width of the buffer.
+    /// @return The width of the buffer, in pixels.
+    unsigned int GBuffer::GetWidthInPixels() const
+    {
+        return MaterialIds.GetWidth();
+    }
+
+    /// Gets the height of the buffer.
+    /// @return The height of the buffer, in pixels.
+    unsigned int GBuffer::GetHeightInPixels() const
+    {
+        return MaterialIds.GetHeight();
+    }
+
+    /// Resizes the buffer, clearing it if the size changes.
+    /// @param[in]  width_in_pixels - The new width of the buffer.
+    /// @param[in]  height_in_pixels - The new height of the buffer.
+    void GBuffer::Resize(const unsigned int width_in_pixels, const unsigned int height_in_pixels)
+    {
+        // SKIP RESIZING IF THE SIZE ISN'T CHANGING.
+        bool size_changing = (width_in_pixels != GetWidthInPixels() || height_in_pixels != GetHeightInPixels());
+        if (!size_changing)
+        {
+            return;
+        }
+
+        // RESIZE ALL ATTRIBUTES.
+        Normals.Resize(width_in_pixels, height_in_pixels);
+        Albedos.Resize(width_in_pixels, height_in_pixels);
+        MaterialIds.Resize(width_in_pixels, height_in_pixels);
+        Depths.Resize(width_in_pixels, height_in_pixels);
+        Clear();
+    }
+
+    /// Clears the buffer so that no pixels are covered by any materials.
+    /// Only material IDs are reset since other attributes are only used for covered pixels.
+    void GBuffer::Clear()
+    {
+        MaterialIds.Fill(NO_MATERIAL_ID);
+        WrittenBounds = {};
+        Materials = { nullptr };
+        MaterialIdsByMaterial.clear();
+    }
+
+    /// Gets the ID for a material, assigning a new ID if the material hasn't been written since the last clear.
+    /// @param[in]  material - The material to get the ID for.
+    /// @return The ID for the material; @ref NO_MATERIAL_ID if the material is null or too many materials exist.
+    uint16_t GBuffer::GetMaterialId(const std::shared_ptr<Material>& material)
+    {
+        // CHECK IF A MATERIAL EXISTS.
+        if (!material)
+        {
+            return NO_MATERIAL_ID;
+        }
+
+        // CHECK IF THE MATERIAL ALREADY HAS AN ID.
+        auto existing_material_id = MaterialIdsByMaterial.find(material.get());
+        if (existing_material_id != MaterialIdsByMaterial.cend())
+        {
+            return existing_material_id->second;
+        }
+
+        // ASSIGN THE NEXT ID TO THE MATERIAL.
+        ASSERT_THEN_IF_NOT(Materials.size() <= MAX_MATERIAL_COUNT)
+        {
+            return NO_MATERIAL_ID;
+        }
+        uint16_t material_id = static_cast<uint16_t>(Materials.size());
+        Materials.emplace_back(material);
+        MaterialIdsByMaterial[material.get()] = material_id;
+        return material_id;
+    }
+
+    /// Gets the material with the specified ID.
+    /// @param[in]  material_id - The ID of the material to get.
+    /// @return The material with the ID; null if no such material exists.
+    std::shared_ptr<Material> GBuffer::GetMaterial(const uint16_t material_id) const
+    {
+        bool material_exists = (material_id < Materials.size());
+        if (!material_exists)
+        {
+            return nullptr;
+        }
+
+        return Materials[material_id];
+    }
+
+    /// Writes all attributes for a single pixel.
+    /// Depth testing must be done by the caller.
+    /// @param[in]  x - The horizontal coordinate of the pixel.
+    /// @param[in]  y - The vertical coordinate of the pixel.
+    /// @param[in]  world_normal - The unit world space surface normal.
+    /// @param[in]  albedo - The color modulating lighting for the pixel.
+    /// @param[in]  material_id - The ID of the material for the pixel.
+    /// @param[in]  depth - The screen space depth of the pixel.
+    void GBuffer::WritePixel(
+        const unsigned int x,
+        const unsigned int y,
+        const MATH::Vector3f& world_normal,
+        const Color& albedo,
+        const uint16_t material_id,
+        const float depth)
+    {
+        // MAKE SURE THE PIXEL COORDINATES ARE VALID.
+        bool pixel_coordinates_valid = MaterialIds.IndicesInRange(x, y);
+        if (!pixel_coordinates_valid)
+        {
+            return;
+        }
+
+        // WRITE THE ATTRIBUTES.
+        Normals(x, y) = world_normal;
+        Albedos(x, y) = albedo.Pack(ALBEDO_COLOR_FORMAT);
+        MaterialIds(x, y) = material_id;
+        Depths(x, y) = depth;
+
+        // EXPAND THE WRITTEN BOUNDS TO INCLUDE THE PIXEL.
+        WrittenBounds = MATH::Rectangleui::Union(WrittenBounds, MATH::Rectangleui::FromLeftTopAndDimensions(x, y, 1, 1));
+    }
+}
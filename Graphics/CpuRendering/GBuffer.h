@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "Containers/Array2D.h"
+#include "Graphics/Color.h"
+#include "Graphics/ColorFormat.h"
+#include "Graphics/Material.h"
+#include "Math/Rectangle.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS::CPU_RENDERING
+{
+    /// A geometry buffer holding the surface attributes of the closest geometry at each pixel,
+    /// so that lighting can be computed afterward only once per visible pixel regardless of overdraw.
+    ///
+    /// Each attribute is stored in its own compact 2D array the size of the render target.
+    /// Materials are stored as small IDs that index into a table of materials written to the buffer.
+    class GBuffer
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The material ID for pixels not covered by any geometry.
+        static constexpr uint16_t NO_MATERIAL_ID = 0;
+        /// The maximum number of different materials that can be written between clears.
+        static constexpr std::size_t MAX_MATERIAL_COUNT = UINT16_MAX;
+        /// The color format of packed albedos.
+        static constexpr ColorFormat ALBEDO_COLOR_FORMAT = ColorFormat::RGBA;
+
+        // CONSTRUCTION.
+        explicit GBuffer() = default;
+        explicit GBuffer(const unsigned int width_in_pixels, const unsigned int height_in_pixels);
+
+        // DIMENSIONS.
+        unsigned int GetWidthInPixels() const;
+        unsigned int GetHeightInPixels() const;
+        void Resize(const unsigned int width_in_pixels, const unsigned int height_in_pixels);
+
+        // CLEARING.
+        void Clear();
+
+        // MATERIALS.
+        uint16_t GetMaterialId(const std::shared_ptr<Material>& material);
+        std::shared_ptr<Material> GetMaterial(const uint16_t material_id) const;
+
+        // PIXEL WRITING.
+        void WritePixel(
+            const unsigned int x,
+            const unsigned int y,
+            const MATH::Vector3f& world_normal,
+            const Color& albedo,
+            const uint16_t material_id,
+            const float depth);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The unit world space surface normal at each pixel.
+        CONTAINERS::Array2D<MATH::Vector3f> Normals = CONTAINERS::Array2D<MATH::Vector3f>();
+        /// The packed color (in @ref ALBEDO_COLOR_FORMAT) modulating lighting at each pixel, such as from textures.
+        CONTAINERS::Array2D<uint32_t> Albedos = CONTAINERS::Array2D<uint32_t>();
+        /// The ID of the material at each pixel; @ref NO_MATERIAL_ID if no geometry covers the pixel.
+        CONTAINERS::Array2D<uint16_t> MaterialIds = CONTAINERS::Array2D<uint16_t>();
+        /// The screen space depth at each pixel, for reconstructing world positions.
+        CONTAINERS::Array2D<float> Depths = CONTAINERS::Array2D<float>();
+        /// The bounds of all pixels written since the last clear.
+        MATH::Rectangleui WrittenBounds = {};
+
+    private:
+        // MEMBER VARIABLES.
+        /// The materials written since the last clear, indexed by material ID.
+        /// The first entry is always null for @ref NO_MATERIAL_ID.
+        std::vector<std::shared_ptr<Material>> Materials = { nullptr };
+        /// The IDs of materials written since the last clear.
+        std::unordered_map<const Material*, uint16_t> MaterialIdsByMaterial = {};
+    };
+}
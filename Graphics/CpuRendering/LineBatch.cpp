@@ -0,0 +1,90 @@
+#include <algorithm>
+#include "Graphics/CpuRendering/LineBatch.h"
+
+namespace GRAPHICS::CPU_RENDERING
+{
+    /// Constructor.
+    /// @param[in]  color_format - The format in which to pack line colors.  Should match the render target.
+    LineBatch::LineBatch(const GRAPHICS::ColorFormat color_format) :
+        ColorFormat(color_format),
+        Lines(),
+        AddedEdgeKeys()
+    {}
+
+    /// Adds a single-colored line to the batch.
+    /// @param[in]  start_position - The starting screen space position of the line.
+    /// @param[in]  end_position - The ending screen space position of the line.
+    /// @param[in]  color - The color of the line.
+    void LineBatch::Add(const MATH::Vector3f& start_position, const MATH::Vector3f& end_position, const Color& color)
+    {
+        Color clamped_color = color;
+        clamped_color.Clamp();
+        uint32_t packed_color = clamped_color.Pack(ColorFormat);
+
+        Lines.emplace_back(Line
+        {
+            .StartPosition = start_position,
+            .EndPosition = end_position,
+            .StartColor = packed_color,
+            .EndColor = packed_color,
+        });
+    }
+
+    /// Adds a line between two vertices to the batch, with colors interpolated between the vertices.
+    /// @param[in]  start_vertex - The starting screen space vertex of the line.
+    /// @param[in]  end_vertex - The ending screen space vertex of the line.
+    void LineBatch::Add(const VertexWithAttributes& start_vertex, const VertexWithAttributes& end_vertex)
+    {
+        // CLAMP THE COLORS TO THE VALID RANGE.
+        Color start_color = start_vertex.Color;
+        start_color.Clamp();
+        Color end_color = end_vertex.Color;
+        // Only red, green, and blue are interpolated along lines, so the alpha of the start is used for the entire line.
+        end_color.Alpha = start_color.Alpha;
+        end_color.Clamp();
+
+        // ADD THE LINE.
+        Lines.emplace_back(Line
+        {
+            .StartPosition = start_vertex.Position,
+            .EndPosition = end_vertex.Position,
+            .StartColor = start_color.Pack(ColorFormat),
+            .EndColor = end_color.Pack(ColorFormat),
+        });
+    }
+
+    /// Adds a line for an edge between two vertices of a mesh to the batch if the edge hasn't already been added.
+    /// @param[in]  start_vertex_index - The index of the starting vertex in the mesh.
+    /// @param[in]  end_vertex_index - The index of the ending vertex in the mesh.
+    /// @param[in]  start_vertex - The starting screen space vertex of the line.
+    /// @param[in]  end_vertex - The ending screen space vertex of the line.
+    void LineBatch::AddEdge(
+        const uint32_t start_vertex_index,
+        const uint32_t end_vertex_index,
+        const VertexWithAttributes& start_vertex,
+        const VertexWithAttributes& end_vertex)
+    {
+        // SKIP THE EDGE IF IT HAS ALREADY BEEN ADDED.
+        // Edges are the same regardless of the direction in which they're traversed, so the
+        // smaller index is always put in the upper bits of the key.
+        uint64_t smaller_vertex_index = std::min(start_vertex_index, end_vertex_index);
+        uint64_t larger_vertex_index = std::max(start_vertex_index, end_vertex_index);
+        uint64_t edge_key = (smaller_vertex_index << 32) | larger_vertex_index;
+        bool edge_newly_added = AddedEdgeKeys.insert(edge_key).second;
+        if (!edge_newly_added)
+        {
+            return;
+        }
+
+        // ADD THE LINE.
+        Add(start_vertex, end_vertex);
+    }
+
+    /// Removes all lines and edges from the batch.
+    /// Memory is kept so that it can be reused for subsequent lines.
+    void LineBatch::Clear()
+    {
+        Lines.clear();
+        AddedEdgeKeys.clear();
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+#include "Graphics/Color.h"
+#include "Graphics/ColorFormat.h"
+#include "Graphics/VertexWithAttributes.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS::CPU_RENDERING
+{
+    /// A batch of screen space lines to be rasterized together.
+    /// Colors are packed when lines are added so that rasterization doesn't need to pack colors per pixel,
+    /// and edges shared between triangles can be skipped so that they're only rasterized once.
+    class LineBatch
+    {
+    public:
+        /// A single line in the batch.
+        struct Line
+        {
+            /// The starting screen space position of the line.
+            MATH::Vector3f StartPosition = MATH::Vector3f();
+            /// The ending screen space position of the line.
+            MATH::Vector3f EndPosition = MATH::Vector3f();
+            /// The packed color at the start of the line.
+            uint32_t StartColor = 0;
+            /// The packed color at the end of the line.
+            uint32_t EndColor = 0;
+        };
+
+        // CONSTRUCTION.
+        explicit LineBatch(const GRAPHICS::ColorFormat color_format);
+
+        // ADDING LINES.
+        void Add(const MATH::Vector3f& start_position, const MATH::Vector3f& end_position, const Color& color);
+        void Add(const VertexWithAttributes& start_vertex, const VertexWithAttributes& end_vertex);
+        void AddEdge(
+            const uint32_t start_vertex_index,
+            const uint32_t end_vertex_index,
+            const VertexWithAttributes& start_vertex,
+            const VertexWithAttributes& end_vertex);
+        void Clear();
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The format in which line colors are packed.  Should match the render target.
+        GRAPHICS::ColorFormat ColorFormat = GRAPHICS::ColorFormat::ARGB;
+        /// The lines in the batch.
+        std::vector<Line> Lines = {};
+        /// Keys for edges (pairs of mesh vertex indices in either order) that have already been added.
+        std::unordered_set<uint64_t> AddedEdgeKeys = {};
+    };
+}
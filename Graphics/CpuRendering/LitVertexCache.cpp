@@ -0,0 +1,271 @@
+#include <algorithm>
+#include <functional>
+#include <future>
+#include <thread>
+#include <utility>
+#include "Graphics/CpuRendering/LitVertexCache.h"
+#include "Graphics/Shading/SurfacePointBatch.h"
+#include "Graphics/Shading/WorldSpaceShading.h"
+
+namespace GRAPHICS::CPU_RENDERING
+{
+    /// Determines if lighting for vertices of a mesh can be cached.
+    /// @param[in]  mesh - The mesh to check.
+    /// @param[in]  lighting_settings - The settings for lighting the mesh.
+    /// @return True if lighting of each unique vertex is independent of the triangles using it; false if not.
+    bool LitVertexCache::VertexLightingCacheable(const Mesh& mesh, const SHADING::LIGHTING::LightingSettings& lighting_settings)
+    {
+        bool vertex_lighting_cacheable = (mesh.IsIndexed() && lighting_settings.Enabled && lighting_settings.VertexNormalsEnabled);
+        return vertex_lighting_cacheable;
+    }
+
+    /// Starts using the cache for a new frame.
+    /// Entries for meshes that weren't rendered in the previous frame are removed so that memory
+    /// for removed meshes doesn't accumulate.
+    void LitVertexCache::BeginFrame()
+    {
+        std::erase_if(EntriesByMesh, [](const auto& mesh_with_entry) { return !mesh_with_entry.second.UsedThisFrame; });
+        for (auto& [mesh, mesh_entry] : EntriesByMesh)
+        {
+            mesh_entry.UsedThisFrame = false;
+        }
+    }
+
+    /// Removes all entries from the cache.
+    void LitVertexCache::Clear()
+    {
+        EntriesByMesh.clear();
+    }
+
+    /// Gets the world space vertices of an indexed mesh, transforming them only if not already cached.
+    /// @param[in]  mesh - The indexed mesh for which to get vertices.  Must remain at the same address (with the same vertex memory) to be cached.
+    /// @param[in]  world_transform - The transform from the mesh's local space into world space.
+    /// @return The cache entry for the mesh, with world space vertices.
+    const LitVertexCache::MeshEntry& LitVertexCache::GetWorldSpaceVertices(const Mesh& mesh, const MATH::AffineTransform3x4& world_transform)
+    {
+        // CHECK IF THE CACHED VERTICES ARE STILL VALID.
+        MeshEntry& mesh_entry = EntriesByMesh[&mesh];
+        mesh_entry.UsedThisFrame = true;
+        // Meshes are keyed by address, so a different mesh may have replaced the cached one at the same address.
+        bool same_mesh_cached = (
+            (mesh.Vertices.data() == mesh_entry.MeshVertices) &&
+            (mesh.Indices.size() == mesh_entry.MeshIndexCount));
+        bool world_transform_changed = (world_transform != mesh_entry.WorldTransform);
+        bool vertices_cached = (same_mesh_cached && mesh_entry.WorldSpaceVertices.size() == mesh.Vertices.size());
+        if (vertices_cached && !world_transform_changed)
+        {
+            return mesh_entry;
+        }
+
+        // TRANSFORM EACH UNIQUE VERTEX INTO WORLD SPACE.
+        mesh_entry.MeshVertices = mesh.Vertices.data();
+        mesh_entry.MeshIndexCount = mesh.Indices.size();
+        mesh_entry.WorldTransform = world_transform;
+        mesh_entry.WorldSpaceVertices = mesh.Vertices;
+        for (VertexWithAttributes& vertex : mesh_entry.WorldSpaceVertices)
+        {
+            vertex.Position = world_transform.TransformPoint(vertex.Position);
+
+            // Normals are directions, so they aren't translated.
+            MATH::Vector3f unnormalized_world_normal = world_transform.TransformDirection(vertex.Normal);
+            if (unnormalized_world_normal.Length() > 0.0f)
+            {
+                vertex.Normal = MATH::Vector3f::Normalize(unnormalized_world_normal);
+            }
+        }
+
+        // Any previous lighting was for the old vertex positions.
+        mesh_entry.VertexLightingComputed = false;
+        return mesh_entry;
+    }
+
+    /// Gets the world space vertices of an indexed mesh along with lit colors for them,
+    /// computing them only if not already cached.  Lighting should be cacheable for the mesh.
+    /// @param[in]  mesh - The indexed mesh for which to get vertices.  Must remain at the same address (with the same vertex memory) to be cached.
+    /// @param[in]  world_transform - The transform from the mesh's local space into world space.
+    /// @param[in]  lights - The lights illuminating the mesh.
+    /// @param[in]  camera_world_position - The world position of the camera viewing the mesh.
+    /// @param[in]  lighting_settings - The settings for lighting the mesh.
+    /// @param[in]  light_grid - The lights culled to clusters of the viewing frustum, if any.  Only used to speed up
+    ///     lighting since it doesn't change results, so changes to the grid alone don't invalidate cached lighting.
+    /// @return The cache entry for the mesh, with world space vertices and lit colors.
+    const LitVertexCache::MeshEntry& LitVertexCache::GetLitVertices(
+        const Mesh& mesh,
+        const MATH::AffineTransform3x4& world_transform,
+        const std::vector<SHADING::LIGHTING::Light>& lights,
+        const MATH::Vector3f& camera_world_position,
+        const SHADING::LIGHTING::LightingSettings& lighting_settings,
+        const ClusteredLightGrid* light_grid)
+    {
+        // CHECK IF THE CACHED LIGHTING IS STILL VALID.
+        GetWorldSpaceVertices(mesh, world_transform);
+        MeshEntry& mesh_entry = EntriesByMesh[&mesh];
+        bool lighting_inputs_changed = (
+            (camera_world_position != mesh_entry.CameraWorldPosition) ||
+            (lights != mesh_entry.Lights) ||
+            (lighting_settings != mesh_entry.LightingSettings));
+        if (mesh_entry.VertexLightingComputed && !lighting_inputs_changed)
+        {
+            return mesh_entry;
+        }
+        mesh_entry.CameraWorldPosition = camera_world_position;
+        mesh_entry.Lights = lights;
+        mesh_entry.LightingSettings = lighting_settings;
+
+        // FIND THE VERTICES USED WITH EACH UNIQUE MATERIAL.
+        mesh_entry.Materials.clear();
+        mesh_entry.SubsetMaterialIndices.clear();
+        std::vector<std::vector<uint32_t>> vertex_indices_by_material_index;
+        for (const MeshSubset& subset : mesh.Subsets)
+        {
+            const std::shared_ptr<Material>& material = subset.Material;
+            auto existing_material = std::find(mesh_entry.Materials.cbegin(), mesh_entry.Materials.cend(), material);
+            std::size_t material_index = static_cast<std::size_t>(existing_material - mesh_entry.Materials.cbegin());
+            if (mesh_entry.Materials.cend() == existing_material)
+            {
+                mesh_entry.Materials.emplace_back(material);
+                vertex_indices_by_material_index.emplace_back();
+            }
+            mesh_entry.SubsetMaterialIndices.emplace_back(material_index);
+
+            std::vector<uint32_t>& material_vertex_indices = vertex_indices_by_material_index[material_index];
+            material_vertex_indices.insert(
+                material_vertex_indices.end(),
+                mesh.Indices.cbegin() + subset.FirstIndex,
+                mesh.Indices.cbegin() + subset.FirstIndex + subset.IndexCount);
+        }
+
+        // LIGHT THE VERTICES USED WITH EACH MATERIAL.
+        mesh_entry.LitVertexColorsByMaterialIndex.resize(mesh_entry.Materials.size());
+        for (std::size_t material_index = 0; material_index < mesh_entry.Materials.size(); ++material_index)
+        {
+            // Each unique vertex only needs to be lit once.
+            std::vector<uint32_t>& material_vertex_indices = vertex_indices_by_material_index[material_index];
+            std::sort(material_vertex_indices.begin(), material_vertex_indices.end());
+            material_vertex_indices.erase(std::unique(material_vertex_indices.begin(), material_vertex_indices.end()), material_vertex_indices.end());
+
+            // Vertices without materials are just left black.
+            std::vector<Color>& lit_vertex_colors = mesh_entry.LitVertexColorsByMaterialIndex[material_index];
+            lit_vertex_colors.assign(mesh.Vertices.size(), Color::BLACK);
+            const std::shared_ptr<Material>& material = mesh_entry.Materials[material_index];
+            if (!material)
+            {
+                continue;
+            }
+
+            // LIGHT VERTICES ACROSS MULTIPLE THREADS IF THERE ARE ENOUGH.
+            std::size_t vertex_count = material_vertex_indices.size();
+            std::size_t max_thread_count = std::max(1u, std::thread::hardware_concurrency());
+            std::size_t thread_count = std::clamp<std::size_t>(vertex_count / MIN_VERTEX_COUNT_PER_THREAD, 1, max_thread_count);
+            if (thread_count <= 1)
+            {
+                LightVertices(material_vertex_indices, material, mesh_entry, light_grid, lit_vertex_colors);
+                continue;
+            }
+
+            // Each thread writes to different vertices, so no synchronization is needed.
+            std::vector<std::future<void>> vertex_lighting_threads;
+            std::size_t vertex_count_per_thread = (vertex_count + thread_count - 1) / thread_count;
+            for (std::size_t first_vertex_index_index = 0; first_vertex_index_index < vertex_count; first_vertex_index_index += vertex_count_per_thread)
+            {
+                std::size_t end_vertex_index_index = std::min(first_vertex_index_index + vertex_count_per_thread, vertex_count);
+                std::vector<uint32_t> thread_vertex_indices(
+                    material_vertex_indices.cbegin() + first_vertex_index_index,
+                    material_vertex_indices.cbegin() + end_vertex_index_index);
+                vertex_lighting_threads.emplace_back(std::async(
+                    std::launch::async,
+                    [thread_vertex_indices = std::move(thread_vertex_indices), &material, &mesh_entry, light_grid, &lit_vertex_colors]()
+                    {
+                        LightVertices(thread_vertex_indices, material, mesh_entry, light_grid, lit_vertex_colors);
+                    }));
+            }
+            for (std::future<void>& vertex_lighting_thread : vertex_lighting_threads)
+            {
+                vertex_lighting_thread.wait();
+            }
+        }
+
+        mesh_entry.VertexLightingComputed = true;
+        return mesh_entry;
+    }
+
+    /// Computes lit colors for vertices of a mesh.
+    /// @param[in]  vertex_indices - The indices of the vertices to light.
+    /// @param[in]  material - The material to light the vertices with.
+    /// @param[in]  mesh_entry - The cache entry with world space vertices and lighting inputs.
+    /// @param[in]  light_grid - The lights culled to clusters of the viewing frustum, if any.
+    ///     All lights of the mesh entry are used if null.
+    /// @param[in,out]  lit_vertex_colors - The lit colors for all vertices of the mesh.  Only the specified vertices are written.
+    void LitVertexCache::LightVertices(
+        const std::vector<uint32_t>& vertex_indices,
+        const std::shared_ptr<Material>& material,
+        const MeshEntry& mesh_entry,
+        const ClusteredLightGrid* light_grid,
+        std::vector<Color>& lit_vertex_colors)
+    {
+        // GROUP THE VERTICES BY THE LIGHTS THAT MAY REACH THEM.
+        // Vertices in the same cluster share the same lights, so they can still be lit together as a batch.
+        std::vector<std::pair<const std::vector<SHADING::LIGHTING::Light>*, uint32_t>> vertex_indices_with_lights;
+        vertex_indices_with_lights.reserve(vertex_indices.size());
+        for (uint32_t vertex_index : vertex_indices)
+        {
+            const std::vector<SHADING::LIGHTING::Light>* vertex_lights = light_grid ?
+                &light_grid->GetLights(mesh_entry.WorldSpaceVertices[vertex_index].Position) :
+                &mesh_entry.Lights;
+            vertex_indices_with_lights.emplace_back(vertex_lights, vertex_index);
+        }
+        std::sort(
+            vertex_indices_with_lights.begin(),
+            vertex_indices_with_lights.end(),
+            [](const auto& first, const auto& second) { return std::less<>()(first.first, second.first); });
+
+        // Texture mapping isn't done per vertex.
+        SHADING::ShadingSettings vertex_shading_settings =
+        {
+            .Lighting = mesh_entry.LightingSettings,
+            .TextureMappingEnabled = false,
+        };
+
+        // LIGHT EACH GROUP OF VERTICES.
+        std::size_t group_first_index = 0;
+        while (group_first_index < vertex_indices_with_lights.size())
+        {
+            // FIND THE END OF THE GROUP.
+            const std::vector<SHADING::LIGHTING::Light>* group_lights = vertex_indices_with_lights[group_first_index].first;
+            std::size_t group_end_index = group_first_index + 1;
+            while (group_end_index < vertex_indices_with_lights.size() && vertex_indices_with_lights[group_end_index].first == group_lights)
+            {
+                ++group_end_index;
+            }
+
+            // GATHER THE VERTICES FOR SHADING TOGETHER.
+            // Shading as a batch allows multiple vertices to be lit at once with SIMD instructions.
+            // All vertices share the same material.
+            constexpr uint16_t VERTEX_MATERIAL_ID = 0;
+            SHADING::SurfacePointBatch vertex_surface_points;
+            vertex_surface_points.Materials = { material };
+            vertex_surface_points.Reserve(group_end_index - group_first_index);
+            for (std::size_t vertex_index_index = group_first_index; vertex_index_index < group_end_index; ++vertex_index_index)
+            {
+                const VertexWithAttributes& world_vertex = mesh_entry.WorldSpaceVertices[vertex_indices_with_lights[vertex_index_index].second];
+                vertex_surface_points.Add(world_vertex.Position, world_vertex.Normal, VERTEX_MATERIAL_ID);
+            }
+
+            // LIGHT THE VERTICES.
+            std::vector<Color> vertex_colors;
+            SHADING::WorldSpaceShading::ComputeMaterialShading(
+                vertex_surface_points,
+                mesh_entry.CameraWorldPosition,
+                *group_lights,
+                vertex_shading_settings,
+                vertex_colors);
+            for (std::size_t vertex_index_index = group_first_index; vertex_index_index < group_end_index; ++vertex_index_index)
+            {
+                uint32_t vertex_index = vertex_indices_with_lights[vertex_index_index].second;
+                lit_vertex_colors[vertex_index] = vertex_colors[vertex_index_index - group_first_index];
+            }
+
+            group_first_index = group_end_index;
+        }
+    }
+}
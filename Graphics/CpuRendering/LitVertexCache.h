@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "Graphics/Color.h"
+#include "Graphics/CpuRendering/ClusteredLightGrid.h"
+#include "Graphics/Material.h"
+#include "Graphics/Mesh.h"
+#include "Graphics/Shading/Lighting/Light.h"
+#include "Graphics/Shading/Lighting/LightingSettings.h"
+#include "Graphics/VertexWithAttributes.h"
+#include "Math/AffineTransform3x4.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS::CPU_RENDERING
+{
+    /// A cache of world space vertices and vertex lighting for indexed meshes.
+    ///
+    /// Unique vertices of a mesh are transformed (and lit if possible) once rather than once per triangle
+    /// using them, and the results are reused across rendering passes and frames until the object's
+    /// world transform, the lights, the camera position, or lighting settings change.
+    /// Entries are keyed by mesh address, but a different mesh later placed at the same address is detected
+    /// by its vertex memory and index count.  In-place changes to the vertices or materials of a mesh aren't detected,
+    /// so the cache should be cleared after such changes.
+    ///
+    /// Lighting is only cached when vertex normals are enabled since lighting with triangle surface normals
+    /// differs for each triangle sharing a vertex.
+    class LitVertexCache
+    {
+    public:
+        /// Cached data for a single mesh.
+        struct MeshEntry
+        {
+            // INPUTS.
+            /// The memory of the mesh's unique vertices, to distinguish different meshes at the same address.
+            const VertexWithAttributes* MeshVertices = nullptr;
+            /// The number of indices in the mesh, to distinguish different meshes at the same address.
+            std::size_t MeshIndexCount = 0;
+            /// The world transform used for the vertices.
+            MATH::AffineTransform3x4 WorldTransform = MATH::AffineTransform3x4::Identity();
+            /// The world position of the camera used for lighting.
+            MATH::Vector3f CameraWorldPosition = MATH::Vector3f();
+            /// The lights used for lighting.
+            std::vector<SHADING::LIGHTING::Light> Lights = {};
+            /// The lighting settings used for lighting.
+            SHADING::LIGHTING::LightingSettings LightingSettings = {};
+
+            // OUTPUTS.
+            /// The unique vertices of the mesh in world space.
+            std::vector<VertexWithAttributes> WorldSpaceVertices = {};
+            /// True if vertex lighting has been computed for the current inputs; false if not.
+            bool VertexLightingComputed = false;
+            /// The unique materials used by subsets of the mesh.
+            std::vector<std::shared_ptr<Material>> Materials = {};
+            /// The index into the unique materials for each subset of the mesh.
+            std::vector<std::size_t> SubsetMaterialIndices = {};
+            /// Lit colors for each vertex, per unique material since the same vertex may be used with different materials.
+            /// Colors are only computed for vertices used with each material.
+            std::vector<std::vector<Color>> LitVertexColorsByMaterialIndex = {};
+            /// True if the entry has been used since the start of the current frame; false if not.
+            bool UsedThisFrame = false;
+        };
+
+        // STATIC CONSTANTS.
+        /// The minimum number of vertices to light per thread so that small meshes aren't slowed down by threading overhead.
+        static constexpr std::size_t MIN_VERTEX_COUNT_PER_THREAD = 1024;
+
+        // STATIC METHODS.
+        static bool VertexLightingCacheable(const Mesh& mesh, const SHADING::LIGHTING::LightingSettings& lighting_settings);
+
+        // CACHE ACCESS.
+        void BeginFrame();
+        void Clear();
+        const MeshEntry& GetWorldSpaceVertices(const Mesh& mesh, const MATH::AffineTransform3x4& world_transform);
+        const MeshEntry& GetLitVertices(
+            const Mesh& mesh,
+            const MATH::AffineTransform3x4& world_transform,
+            const std::vector<SHADING::LIGHTING::Light>& lights,
+            const MATH::Vector3f& camera_world_position,
+            const SHADING::LIGHTING::LightingSettings& lighting_settings,
+            const ClusteredLightGrid* light_grid = nullptr);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// Cached data for each mesh.
+        std::unordered_map<const Mesh*, MeshEntry> EntriesByMesh = {};
+
+    private:
+        // HELPER METHODS.
+        static void LightVertices(
+            const std::vector<uint32_t>& vertex_indices,
+            const std::shared_ptr<Material>& material,
+            const MeshEntry& mesh_entry,
+            const ClusteredLightGrid* light_grid,
+            std::vector<Color>& lit_vertex_colors);
+    };
+}
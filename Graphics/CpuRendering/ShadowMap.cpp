@@ -0,0 +1,273 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <optional>
+#include "Graphics/CpuRendering/ShadowMap.h"
+#include "Math/CoordinateFrame.h"
+
+namespace GRAPHICS::CPU_RENDERING
+{
+    /// Determines if a light casts shadows via a shadow map.
+    /// @param[in]  light - The light to check.
+    /// @return True if the light is a directional or point light with a non-empty shadow map; false otherwise.
+    bool ShadowMap::CastsShadows(const SHADING::LIGHTING::Light& light)
+    {
+        bool light_type_casts_shadows = (
+            SHADING::LIGHTING::LightType::DIRECTIONAL == light.Type ||
+            SHADING::LIGHTING::LightType::POINT == light.Type);
+        bool light_has_shadow_map = (light.ShadowMapDimensionInPixels > 0);
+        return light_type_casts_shadows && light_has_shadow_map;
+    }
+
+    /// Finds the shadow map for a light.
+    /// @param[in]  shadow_maps - The shadow maps to search.
+    /// @param[in]  light - The light to find the shadow map for.
+    /// @return The shadow map for the light, if one exists; null otherwise.
+    const ShadowMap* ShadowMap::Find(const std::vector<ShadowMap>& shadow_maps, const SHADING::LIGHTING::Light& light)
+    {
+        // Only a few lights typically have shadow maps, so a linear search is fast enough.
+        auto shadow_map = std::find_if(
+            shadow_maps.cbegin(),
+            shadow_maps.cend(),
+            [&light](const ShadowMap& current_shadow_map) { return current_shadow_map.ShadowCastingLight == light; });
+        if (shadow_maps.cend() == shadow_map)
+        {
+            return nullptr;
+        }
+
+        return &*shadow_map;
+    }
+
+    /// Creates an empty shadow map for a light, with faces positioned to cover all shadow casters.
+    /// Depths still need to be rendered to each face.
+    /// @param[in]  light - The light casting shadows.  Must be a light that casts shadows (see CastsShadows()).
+    /// @param[in]  shadow_casters_center_world_position - The center of a bounding sphere around all shadow casters.
+    /// @param[in]  shadow_casters_radius - The radius of a bounding sphere around all shadow casters.
+    /// @param[in]  filter_radius_in_texels - The number of texels on each side of a sampled texel to compare for filtering.
+    ShadowMap::ShadowMap(
+        const SHADING::LIGHTING::Light& light,
+        const MATH::Vector3f& shadow_casters_center_world_position,
+        const float shadow_casters_radius,
+        const unsigned int filter_radius_in_texels) :
+        ShadowCastingLight(light),
+        FilterRadiusInTexels(filter_radius_in_texels)
+    {
+        // PAD THE BOUNDS OF THE SHADOW CASTERS.
+        // This keeps casters on the edges of the bounds from being clipped and avoids empty bounds.
+        constexpr float BOUNDS_PADDING_FRACTION = 0.01f;
+        constexpr float MIN_BOUNDS_RADIUS = 0.001f;
+        float padded_radius = std::max(shadow_casters_radius * (1.0f + BOUNDS_PADDING_FRACTION), MIN_BOUNDS_RADIUS);
+
+        // DETERMINE THE CAMERAS FOR EACH FACE.
+        std::vector<VIEWING::Camera> face_cameras;
+        const MATH::Angle<float>::Degrees NINETY_DEGREE_FIELD_OF_VIEW(90.0f);
+        if (SHADING::LIGHTING::LightType::DIRECTIONAL == light.Type)
+        {
+            // LOOK AT THE SHADOW CASTERS FROM BEHIND THEM ALONG THE LIGHT'S DIRECTION.
+            // An orthographic camera's half-width is the tangent of half its field of view times its near distance,
+            // so a 90 degree field of view with the near plane at the bounds' radius covers the entire bounds.
+            MATH::Vector3f unit_light_direction = MATH::Vector3f::Normalize(light.DirectionalLightDirection);
+            constexpr float MAX_UP_DIRECTION_ALIGNMENT = 0.99f;
+            bool light_direction_vertical = (std::abs(unit_light_direction.Y) > MAX_UP_DIRECTION_ALIGNMENT);
+            MATH::Vector3f up_direction = light_direction_vertical ? MATH::Vector3f(0.0f, 0.0f, 1.0f) : MATH::Vector3f(0.0f, 1.0f, 0.0f);
+
+            VIEWING::Camera camera;
+            camera.Projection = VIEWING::ProjectionType::ORTHOGRAPHIC;
+            camera.WorldPosition = shadow_casters_center_world_position - MATH::Vector3f::Scale(2.0f * padded_radius, unit_light_direction);
+            camera.CoordinateFrame = MATH::CoordinateFrame::FromUpAndForward(up_direction, -unit_light_direction);
+            camera.NearClipPlaneViewDistance = padded_radius;
+            camera.FarClipPlaneViewDistance = 3.0f * padded_radius;
+            camera.FieldOfView = NINETY_DEGREE_FIELD_OF_VIEW;
+            face_cameras.emplace_back(camera);
+        }
+        else
+        {
+            // LOOK ALONG EACH AXIS FROM THE LIGHT.
+            // The far plane covers all shadow casters, even beyond the light's range, since triangles are skipped
+            // entirely if any of their vertices are clipped.
+            const std::array<MATH::Vector3f, CUBE_MAP_FACE_COUNT> FACE_VIEW_DIRECTIONS =
+            {
+                MATH::Vector3f(1.0f, 0.0f, 0.0f),
+                MATH::Vector3f(-1.0f, 0.0f, 0.0f),
+                MATH::Vector3f(0.0f, 1.0f, 0.0f),
+                MATH::Vector3f(0.0f, -1.0f, 0.0f),
+                MATH::Vector3f(0.0f, 0.0f, 1.0f),
+                MATH::Vector3f(0.0f, 0.0f, -1.0f),
+            };
+            float light_to_shadow_casters_distance = (shadow_casters_center_world_position - light.PointLightWorldPosition).Length();
+            float far_clip_plane_view_distance = light_to_shadow_casters_distance + padded_radius;
+            constexpr float NEAR_TO_FAR_CLIP_PLANE_RATIO = 0.001f;
+            for (const MATH::Vector3f& face_view_direction : FACE_VIEW_DIRECTIONS)
+            {
+                bool face_vertical = (0.0f != face_view_direction.Y);
+                MATH::Vector3f up_direction = face_vertical ? MATH::Vector3f(0.0f, 0.0f, 1.0f) : MATH::Vector3f(0.0f, 1.0f, 0.0f);
+
+                VIEWING::Camera camera;
+                camera.Projection = VIEWING::ProjectionType::PERSPECTIVE;
+                camera.WorldPosition = light.PointLightWorldPosition;
+                camera.CoordinateFrame = MATH::CoordinateFrame::FromUpAndForward(up_direction, -face_view_direction);
+                camera.NearClipPlaneViewDistance = NEAR_TO_FAR_CLIP_PLANE_RATIO * far_clip_plane_view_distance;
+                camera.FarClipPlaneViewDistance = far_clip_plane_view_distance;
+                camera.FieldOfView = NINETY_DEGREE_FIELD_OF_VIEW;
+                face_cameras.emplace_back(camera);
+            }
+        }
+
+        // CREATE EACH FACE.
+        // Depth buffers start cleared to the maximum depth, which never shadows anything.
+        unsigned int dimension_in_pixels = light.ShadowMapDimensionInPixels;
+        constexpr bool REVERSED_Z = true;
+        for (const VIEWING::Camera& face_camera : face_cameras)
+        {
+            Face& face = Faces.emplace_back(Face
+            {
+                .LightCamera = face_camera,
+                .LightViewingTransformations = VIEWING::ViewingTransformations(face_camera, dimension_in_pixels, dimension_in_pixels),
+                .Depths = DepthBuffer(dimension_in_pixels, dimension_in_pixels, DepthBufferFormat::FLOAT_32, REVERSED_Z),
+            });
+            face.LightViewingTransformations.ReversedZ = REVERSED_Z;
+        }
+    }
+
+    /// Computes shadow factors for a position from any lights with shadow maps.
+    /// @param[in]  shadow_maps - The shadow maps for lights.
+    /// @param[in]  lights - The lights to compute shadow factors for.
+    /// @param[in]  world_position - The world position of the surface to compute shadow factors for.
+    /// @param[in]  unit_surface_normal - The unit surface normal at the position.
+    /// @param[out]  shadow_factors_by_light_index - The shadow factors (0 == full shadowing, 1 == no shadowing),
+    ///     in the same order as the lights.  Empty (for no shadowing from any lights) if there are no shadow maps.
+    void ShadowMap::ComputeShadowFactors(
+        const std::vector<ShadowMap>& shadow_maps,
+        const std::vector<SHADING::LIGHTING::Light>& lights,
+        const MATH::Vector3f& world_position,
+        const MATH::Vector3f& unit_surface_normal,
+        std::vector<float>& shadow_factors_by_light_index)
+    {
+        // CHECK IF ANY LIGHTS HAVE SHADOW MAPS.
+        shadow_factors_by_light_index.clear();
+        if (shadow_maps.empty())
+        {
+            return;
+        }
+
+        // COMPUTE THE SHADOW FACTOR FOR EACH LIGHT.
+        // Lights that don't reach the position don't contribute any lighting, so their shadow maps don't need to be sampled.
+        constexpr float NO_SHADOWING = 1.0f;
+        for (const SHADING::LIGHTING::Light& light : lights)
+        {
+            const ShadowMap* shadow_map = light.Reaches(world_position) ? Find(shadow_maps, light) : nullptr;
+            float shadow_factor = shadow_map ? shadow_map->ComputeShadowFactor(world_position, unit_surface_normal) : NO_SHADOWING;
+            shadow_factors_by_light_index.push_back(shadow_factor);
+        }
+    }
+
+    /// Computes how shadowed a position is from the light.
+    /// @param[in]  world_position - The world position of the surface to compute the shadow factor for.
+    /// @param[in]  unit_surface_normal - The unit surface normal at the position.
+    /// @return The fraction of filtered texels that the position is lit in (0 == full shadowing, 1 == no shadowing).
+    float ShadowMap::ComputeShadowFactor(const MATH::Vector3f& world_position, const MATH::Vector3f& unit_surface_normal) const
+    {
+        // COMPUTE THE DIRECTION TO THE LIGHT AND THE WORLD SIZE OF TEXELS AT THE POSITION.
+        constexpr float NO_SHADOWING = 1.0f;
+        const Face& face = Faces[GetFaceIndex(world_position)];
+        float dimension_in_pixels = static_cast<float>(face.Depths.GetWidthInPixels());
+        MATH::Vector3f unit_direction_to_light;
+        float texel_world_size = 0.0f;
+        if (SHADING::LIGHTING::LightType::DIRECTIONAL == ShadowCastingLight.Type)
+        {
+            // The orthographic projection is twice as wide as its near distance.
+            unit_direction_to_light = -MATH::Vector3f::Normalize(ShadowCastingLight.DirectionalLightDirection);
+            texel_world_size = 2.0f * face.LightCamera.NearClipPlaneViewDistance / dimension_in_pixels;
+        }
+        else
+        {
+            // A 90 degree perspective projection is at most twice as wide as the distance from the light.
+            MATH::Vector3f direction_to_light = ShadowCastingLight.PointLightDirectionFrom(world_position);
+            float distance_to_light = direction_to_light.Length();
+            if (distance_to_light <= 0.0f)
+            {
+                return NO_SHADOWING;
+            }
+            unit_direction_to_light = MATH::Vector3f::Scale(1.0f / distance_to_light, direction_to_light);
+            texel_world_size = 2.0f * distance_to_light / dimension_in_pixels;
+        }
+
+        // OFFSET THE POSITION TO AVOID SURFACES SHADOWING THEMSELVES.
+        // Depths are only stored at discrete texels, so surfaces would otherwise be partially shadowed by their own depths
+        // ("shadow acne").  Filtering compares depths of texels farther away, so the offset grows with the filter size.
+        constexpr float LIGHT_DIRECTION_OFFSET_IN_TEXELS = 1.5f;
+        float surface_normal_offset_in_texels = 1.0f + static_cast<float>(FilterRadiusInTexels);
+        MATH::Vector3f offset_world_position = (
+            world_position +
+            MATH::Vector3f::Scale(surface_normal_offset_in_texels * texel_world_size, unit_surface_normal) +
+            MATH::Vector3f::Scale(LIGHT_DIRECTION_OFFSET_IN_TEXELS * texel_world_size, unit_direction_to_light));
+
+        // PROJECT THE POSITION INTO THE SHADOW MAP.
+        // Positions outside of the shadow map are beyond all shadow casters.
+        std::optional<MATH::Vector3f> shadow_map_position = face.LightViewingTransformations.WorldToScreen(offset_world_position);
+        if (!shadow_map_position)
+        {
+            return NO_SHADOWING;
+        }
+
+        // COMPARE THE POSITION'S DEPTH WITH DEPTHS OF TEXELS AROUND IT.
+        // The rasterizer only covers pixels from 1 to the dimension - 1, so texels are clamped to that range.
+        // The position is lit for texels whose depths aren't closer to the light.
+        constexpr float MIN_TEXEL_COORDINATE = 1.0f;
+        float max_texel_coordinate = dimension_in_pixels - 1.0f;
+        int center_texel_x = static_cast<int>(std::clamp(std::round(shadow_map_position->X), MIN_TEXEL_COORDINATE, max_texel_coordinate));
+        int center_texel_y = static_cast<int>(std::clamp(std::round(shadow_map_position->Y), MIN_TEXEL_COORDINATE, max_texel_coordinate));
+        int filter_radius_in_texels = static_cast<int>(FilterRadiusInTexels);
+        unsigned int lit_texel_count = 0;
+        for (int texel_y_offset = -filter_radius_in_texels; texel_y_offset <= filter_radius_in_texels; ++texel_y_offset)
+        {
+            float texel_y = std::clamp(static_cast<float>(center_texel_y + texel_y_offset), MIN_TEXEL_COORDINATE, max_texel_coordinate);
+            for (int texel_x_offset = -filter_radius_in_texels; texel_x_offset <= filter_radius_in_texels; ++texel_x_offset)
+            {
+                float texel_x = std::clamp(static_cast<float>(center_texel_x + texel_x_offset), MIN_TEXEL_COORDINATE, max_texel_coordinate);
+                float shadow_caster_depth = face.Depths.GetDepth(static_cast<unsigned int>(texel_x), static_cast<unsigned int>(texel_y));
+                bool texel_lit = (shadow_caster_depth <= shadow_map_position->Z);
+                if (texel_lit)
+                {
+                    ++lit_texel_count;
+                }
+            }
+        }
+
+        unsigned int filter_dimension_in_texels = 2 * FilterRadiusInTexels + 1;
+        float filter_texel_count = static_cast<float>(filter_dimension_in_texels * filter_dimension_in_texels);
+        float shadow_factor = static_cast<float>(lit_texel_count) / filter_texel_count;
+        return shadow_factor;
+    }
+
+    /// Gets the index of the face of the shadow map covering a position.
+    /// @param[in]  world_position - The world position to get the face for.
+    /// @return The index of the face.  Point lights use the face along the major axis of the direction to the position.
+    std::size_t ShadowMap::GetFaceIndex(const MATH::Vector3f& world_position) const
+    {
+        // DIRECTIONAL LIGHTS ONLY HAVE A SINGLE FACE.
+        if (SHADING::LIGHTING::LightType::DIRECTIONAL == ShadowCastingLight.Type)
+        {
+            return 0;
+        }
+
+        // FIND THE MAJOR AXIS OF THE DIRECTION FROM THE LIGHT.
+        // Faces are ordered +X, -X, +Y, -Y, +Z, -Z.
+        MATH::Vector3f direction_from_light = world_position - ShadowCastingLight.PointLightWorldPosition;
+        float absolute_x = std::abs(direction_from_light.X);
+        float absolute_y = std::abs(direction_from_light.Y);
+        float absolute_z = std::abs(direction_from_light.Z);
+        if (absolute_x >= absolute_y && absolute_x >= absolute_z)
+        {
+            return (direction_from_light.X >= 0.0f) ? 0 : 1;
+        }
+        else if (absolute_y >= absolute_z)
+        {
+            return (direction_from_light.Y >= 0.0f) ? 2 : 3;
+        }
+        else
+        {
+            return (direction_from_light.Z >= 0.0f) ? 4 : 5;
+        }
+    }
+}
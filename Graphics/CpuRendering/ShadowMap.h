@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "Graphics/DepthBuffer.h"
+#include "Graphics/Shading/Lighting/Light.h"
+#include "Graphics/Viewing/Camera.h"
+#include "Graphics/Viewing/ViewingTransformations.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS::CPU_RENDERING
+{
+    /// The depths of surfaces nearest to a light, for determining which positions are shadowed from the light
+    /// when rasterizing (https://en.wikipedia.org/wiki/Shadow_mapping).
+    ///
+    /// Directional lights have a single face with an orthographic projection covering all shadow casters.
+    /// Point lights have a cube map of 6 faces with 90 degree perspective projections along each axis.
+    /// Faces are rendered like any other depth-only pass (with reversed-Z depths to preserve precision
+    /// far from point lights), so larger depths are closer to the light.
+    ///
+    /// Shadows are filtered with percentage-closer filtering (PCF), which averages depth comparisons
+    /// over a square of texels to soften the jagged edges of shadows.
+    class ShadowMap
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The number of faces in the cube map for a point light.
+        static constexpr std::size_t CUBE_MAP_FACE_COUNT = 6;
+
+        /// A single depth map rendered from the point of view of a light.
+        struct Face
+        {
+            /// The camera viewing shadow casters from the light.
+            VIEWING::Camera LightCamera;
+            /// The viewing transformations for the camera into the depth map.
+            VIEWING::ViewingTransformations LightViewingTransformations;
+            /// The depths of surfaces nearest to the light.
+            DepthBuffer Depths;
+        };
+
+        // LIGHT METHODS.
+        static bool CastsShadows(const SHADING::LIGHTING::Light& light);
+        static const ShadowMap* Find(const std::vector<ShadowMap>& shadow_maps, const SHADING::LIGHTING::Light& light);
+
+        // CONSTRUCTION.
+        explicit ShadowMap(
+            const SHADING::LIGHTING::Light& light,
+            const MATH::Vector3f& shadow_casters_center_world_position,
+            const float shadow_casters_radius,
+            const unsigned int filter_radius_in_texels);
+
+        // SHADOWING.
+        static void ComputeShadowFactors(
+            const std::vector<ShadowMap>& shadow_maps,
+            const std::vector<SHADING::LIGHTING::Light>& lights,
+            const MATH::Vector3f& world_position,
+            const MATH::Vector3f& unit_surface_normal,
+            std::vector<float>& shadow_factors_by_light_index);
+        float ComputeShadowFactor(const MATH::Vector3f& world_position, const MATH::Vector3f& unit_surface_normal) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The light casting the shadows.
+        SHADING::LIGHTING::Light ShadowCastingLight = {};
+        /// The number of texels on each side of a sampled texel that are also compared for filtering.
+        /// 0 only compares a single texel, producing hard shadow edges.
+        unsigned int FilterRadiusInTexels = 1;
+        /// The faces of the shadow map, with 1 for directional lights or 6 for point lights (+X, -X, +Y, -Y, +Z, -Z).
+        std::vector<Face> Faces = {};
+
+    private:
+        // HELPER METHODS.
+        std::size_t GetFaceIndex(const MATH::Vector3f& world_position) const;
+    };
+}
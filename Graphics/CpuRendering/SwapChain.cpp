@@ -0,0 +1,304 @@
+#include <algorithm>
+#include "Graphics/CpuRendering/SwapChain.h"
+
+namespace GRAPHICS::CPU_RENDERING
+{
+    /// Constructor.
+    /// @param[in]  width_in_pixels - The width of each buffer.
+    /// @param[in]  height_in_pixels - The height of each buffer.
+    /// @param[in]  color_format - The color format of each buffer.
+    /// @param[in]  buffer_count - The number of buffers in the chain.  At least 1 buffer is always created,
+    ///     but presents can only overlap with rendering if there are at least 2.
+    SwapChain::SwapChain(
+        const unsigned int width_in_pixels,
+        const unsigned int height_in_pixels,
+        const GRAPHICS::ColorFormat color_format,
+        const std::size_t buffer_count)
+    {
+        // CREATE CLEARED BUFFERS.
+        // Clearing helps ensure a known, common initial state for each buffer.
+        std::size_t actual_buffer_count = std::max<std::size_t>(1, buffer_count);
+        for (std::size_t buffer_index = 0; buffer_index < actual_buffer_count; ++buffer_index)
+        {
+            Buffer& buffer = Buffers.emplace_back(Buffer
+            {
+                .Image = IMAGES::Bitmap(width_in_pixels, height_in_pixels, color_format),
+                .ClearedColor = ClearColor,
+            });
+            buffer.Image.FillPixels(ClearColor);
+        }
+    }
+
+    /// Destructor.  Waits for any in-progress presents since they reference the buffers.
+    SwapChain::~SwapChain()
+    {
+        StopPresentThread();
+    }
+
+    /// Move assignment.  Waits for any in-progress presents of this swap chain before replacing it.
+    /// @param[in,out]  other - The swap chain to move from.
+    /// @return This swap chain.
+    SwapChain& SwapChain::operator=(SwapChain&& other)
+    {
+        StopPresentThread();
+
+        ClearColor = other.ClearColor;
+        Buffers = std::move(other.Buffers);
+        CurrentIndex = other.CurrentIndex;
+        LastSubmittedFence = other.LastSubmittedFence;
+        Presenter = std::move(other.Presenter);
+        LastPresentedFillColor = other.LastPresentedFillColor;
+        LastPresentedDirtyRectangles = std::move(other.LastPresentedDirtyRectangles);
+        return *this;
+    }
+
+    /// Gets the number of buffers in the chain.
+    /// @return The number of buffers.
+    std::size_t SwapChain::BufferCount() const
+    {
+        return Buffers.size();
+    }
+
+    /// Gets the index of the buffer currently being rendered to.
+    /// @return The index of the current buffer.
+    std::size_t SwapChain::CurrentBufferIndex() const
+    {
+        return CurrentIndex;
+    }
+
+    /// Gets the buffer to render to, waiting for any previous present of the buffer to complete.
+    /// The buffer is assumed to be modified by the caller.
+    /// @return The current buffer.
+    IMAGES::Bitmap& SwapChain::GetCurrentBuffer()
+    {
+        Buffer& buffer = Buffers[CurrentIndex];
+        WaitForBuffer(buffer);
+        buffer.ClearedColor = std::nullopt;
+        return buffer.Image;
+    }
+
+    /// Clears the buffer to render to, waiting for any previous present of the buffer to complete.
+    /// The clear is skipped if the buffer was already cleared to the color in the background,
+    /// and subsequent background clears use the same color.
+    /// @param[in]  color - The color to clear to.
+    void SwapChain::ClearCurrentBuffer(const Color& color)
+    {
+        ClearColor = color;
+
+        Buffer& buffer = Buffers[CurrentIndex];
+        WaitForBuffer(buffer);
+        bool buffer_already_cleared = (buffer.ClearedColor == color);
+        if (buffer_already_cleared)
+        {
+            return;
+        }
+
+        buffer.Image.FillPixels(color);
+        buffer.ClearedColor = color;
+    }
+
+    /// Presents the current buffer to a window on a background thread and advances to the next buffer.
+    /// After being displayed, the buffer is cleared to the current clear color on the same background thread.
+    /// Windows that don't support displaying from other threads are instead displayed to before returning.
+    /// If the buffer was filled with the same color as the previously presented buffer, only the regions
+    /// dirtied in either buffer are displayed.
+    /// @param[in,out]  window - The window to display the buffer in.  Must remain valid until the present completes.
+    /// @param[out] read_back_bitmap - Any bitmap to copy the presented image into before the buffer is cleared.
+    ///     Must remain valid and unused until the present completes.
+    /// @return The fence value for the present.
+    uint64_t SwapChain::Present(WINDOWING::IWindow& window, IMAGES::Bitmap* read_back_bitmap)
+    {
+        // ASSIGN A FENCE FOR THE PRESENT.
+        ++LastSubmittedFence;
+        Buffer& buffer = Buffers[CurrentIndex];
+        buffer.FenceValue = LastSubmittedFence;
+        // The buffer isn't accessed on this thread again until after the present completes.
+        buffer.ClearedColor = ClearColor;
+
+        // DETERMINE WHICH REGIONS OF THE WINDOW NEED TO CHANGE.
+        // Any region not dirtied in either the previously presented buffer or this buffer still has
+        // the common fill color, so only the dirty regions of both buffers need to be displayed.
+        std::optional<Color> fill_color = buffer.Image.GetFillColor();
+        const std::vector<MATH::Rectangleui>& buffer_dirty_rectangles = buffer.Image.GetDirtyRectangles();
+        bool only_dirty_regions_changed = (fill_color.has_value() && fill_color == LastPresentedFillColor);
+        std::vector<MATH::Rectangleui> changed_rectangles;
+        if (only_dirty_regions_changed)
+        {
+            changed_rectangles = LastPresentedDirtyRectangles;
+            changed_rectangles.insert(changed_rectangles.end(), buffer_dirty_rectangles.cbegin(), buffer_dirty_rectangles.cend());
+        }
+        LastPresentedFillColor = fill_color;
+        LastPresentedDirtyRectangles = buffer_dirty_rectangles;
+
+        // DISPLAY THE BUFFER IMMEDIATELY IF THE WINDOW CAN'T BE DISPLAYED TO IN THE BACKGROUND.
+        // Such windows are always displayed to from this thread, so frames are still displayed in order.
+        auto display = [&window, &buffer, only_dirty_regions_changed, changed_rectangles = std::move(changed_rectangles)]()
+        {
+            if (only_dirty_regions_changed)
+            {
+                window.Display(buffer.Image, changed_rectangles);
+            }
+            else
+            {
+                window.Display(buffer.Image);
+            }
+        };
+        bool display_in_background = window.SupportsDisplayFromAnyThread();
+        if (!display_in_background)
+        {
+            display();
+        }
+
+        // QUEUE THE BUFFER TO BE PRESENTED AND CLEARED IN THE BACKGROUND.
+        // The present thread performs presents one at a time, so frames are displayed in order.
+        QueuedPresent queued_present =
+        {
+            .FenceValue = LastSubmittedFence,
+            .Present = [display = std::move(display), display_in_background, &buffer, read_back_bitmap, clear_color = ClearColor]()
+            {
+                if (display_in_background)
+                {
+                    display();
+                }
+                if (read_back_bitmap)
+                {
+                    *read_back_bitmap = buffer.Image;
+                }
+                buffer.Image.FillPixels(clear_color);
+            },
+        };
+        {
+            std::lock_guard<std::mutex> lock(Presenter->Mutex);
+            Presenter->QueuedPresents.emplace_back(std::move(queued_present));
+            if (!Presenter->Thread.joinable())
+            {
+                Presenter->Thread = std::thread(PerformPresents, std::ref(*Presenter));
+            }
+        }
+        Presenter->PresentQueued.notify_one();
+
+        // MOVE TO THE NEXT BUFFER.
+        CurrentIndex = (CurrentIndex + 1) % Buffers.size();
+        return LastSubmittedFence;
+    }
+
+    /// Gets the number of presents that have been submitted but not yet started on the present thread.
+    /// @return The number of queued presents.
+    std::size_t SwapChain::QueuedPresentCount() const
+    {
+        if (!Presenter)
+        {
+            return 0;
+        }
+
+        std::lock_guard<std::mutex> lock(Presenter->Mutex);
+        return Presenter->QueuedPresents.size();
+    }
+
+    /// Gets the fence value of the most recently submitted present.
+    /// @return The last submitted fence value; @ref NO_FENCE if nothing has been presented yet.
+    uint64_t SwapChain::LastSubmittedFenceValue() const
+    {
+        return LastSubmittedFence;
+    }
+
+    /// Checks if a present has completed.
+    /// @param[in]  fence_value - The fence value returned when presenting.
+    /// @return True if the present has completed; false if not or if the fence hasn't been submitted yet.
+    bool SwapChain::FenceCompleted(const uint64_t fence_value) const
+    {
+        // CHECK IF THE FENCE HAS BEEN SUBMITTED.
+        if (fence_value > LastSubmittedFence)
+        {
+            return false;
+        }
+
+        // CHECK IF THE PRESENT THREAD HAS REACHED THE FENCE.
+        // Presents complete in order, so all fences up to the most recently completed one are complete.
+        if (!Presenter)
+        {
+            return true;
+        }
+        std::lock_guard<std::mutex> lock(Presenter->Mutex);
+        bool present_completed = (fence_value <= Presenter->CompletedFence);
+        return present_completed;
+    }
+
+    /// Waits for a present to complete.  Returns immediately if the fence hasn't been submitted yet.
+    /// @param[in]  fence_value - The fence value returned when presenting.
+    void SwapChain::WaitForFence(const uint64_t fence_value) const
+    {
+        // CHECK IF THE FENCE HAS BEEN SUBMITTED.
+        bool fence_submitted = (fence_value <= LastSubmittedFence);
+        if (!fence_submitted || !Presenter)
+        {
+            return;
+        }
+
+        // WAIT FOR THE PRESENT THREAD TO REACH THE FENCE.
+        std::unique_lock<std::mutex> lock(Presenter->Mutex);
+        Presenter->PresentCompleted.wait(lock, [this, fence_value]() { return fence_value <= Presenter->CompletedFence; });
+    }
+
+    /// Waits for all submitted presents to complete.
+    void SwapChain::WaitForIdle() const
+    {
+        // Presents complete in order, so the last present completing means all have completed.
+        WaitForFence(LastSubmittedFence);
+    }
+
+    /// Performs queued presents in order until the thread is requested to stop and no presents remain.
+    /// @param[in,out]  present_thread - The present thread state.
+    void SwapChain::PerformPresents(PresentThread& present_thread)
+    {
+        while (true)
+        {
+            // WAIT FOR A PRESENT TO BE QUEUED.
+            std::unique_lock<std::mutex> lock(present_thread.Mutex);
+            present_thread.PresentQueued.wait(lock, [&present_thread]() { return present_thread.StopRequested || !present_thread.QueuedPresents.empty(); });
+            if (present_thread.QueuedPresents.empty())
+            {
+                return;
+            }
+            QueuedPresent queued_present = std::move(present_thread.QueuedPresents.front());
+            present_thread.QueuedPresents.pop_front();
+            lock.unlock();
+
+            // PERFORM THE PRESENT.
+            // The present is performed without holding the lock so that more presents can be queued meanwhile.
+            queued_present.Present();
+
+            // SIGNAL THAT THE PRESENT COMPLETED.
+            lock.lock();
+            present_thread.CompletedFence = queued_present.FenceValue;
+            lock.unlock();
+            present_thread.PresentCompleted.notify_all();
+        }
+    }
+
+    /// Stops the present thread after any queued presents have been performed.
+    void SwapChain::StopPresentThread()
+    {
+        if (!Presenter)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(Presenter->Mutex);
+            Presenter->StopRequested = true;
+        }
+        Presenter->PresentQueued.notify_one();
+        if (Presenter->Thread.joinable())
+        {
+            Presenter->Thread.join();
+        }
+    }
+
+    /// Waits for any present of a buffer to complete.
+    /// @param[in]  buffer - The buffer to wait for.
+    void SwapChain::WaitForBuffer(const Buffer& buffer) const
+    {
+        WaitForFence(buffer.FenceValue);
+    }
+}
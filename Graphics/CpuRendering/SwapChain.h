@@ -0,0 +1,136 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+#include "Graphics/Color.h"
+#include "Graphics/ColorFormat.h"
+#include "Graphics/Images/Bitmap.h"
+#include "Math/Rectangle.h"
+#include "Windowing/IWindow.h"
+
+namespace GRAPHICS::CPU_RENDERING
+{
+    /// A chain of color buffers that are rendered to in turn, with each buffer being presented to a window
+    /// and then cleared on a background thread while rendering continues into the next buffer.
+    /// A single long-lived background thread performs all presents, one at a time, from a queue.
+    ///
+    /// Each present is assigned an increasing fence value that can be used to check or wait for completion
+    /// of that present (including any read back of the presented image and clearing of the buffer).
+    /// Presents complete in the order they were submitted.
+    ///
+    /// When consecutive frames start from the same fill color, only the regions dirtied in either frame
+    /// are displayed, since the rest of the window already shows the fill color.
+    ///
+    /// Windows that don't support displaying from other threads are displayed to synchronously when presenting,
+    /// with only any read back and clearing of the presented buffer done on the background thread.
+    class SwapChain
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The default number of buffers, allowing one frame to be presented while the next is rendered.
+        static constexpr std::size_t DEFAULT_BUFFER_COUNT = 2;
+        /// A fence value that is never signaled by a present and is always considered complete.
+        static constexpr uint64_t NO_FENCE = 0;
+
+        // CONSTRUCTION/DESTRUCTION.
+        explicit SwapChain(
+            const unsigned int width_in_pixels,
+            const unsigned int height_in_pixels,
+            const GRAPHICS::ColorFormat color_format,
+            const std::size_t buffer_count = DEFAULT_BUFFER_COUNT);
+        ~SwapChain();
+        SwapChain(const SwapChain&) = delete;
+        SwapChain& operator=(const SwapChain&) = delete;
+        SwapChain(SwapChain&&) = default;
+        SwapChain& operator=(SwapChain&& other);
+
+        // BUFFER ACCESS.
+        std::size_t BufferCount() const;
+        std::size_t CurrentBufferIndex() const;
+        IMAGES::Bitmap& GetCurrentBuffer();
+        void ClearCurrentBuffer(const Color& color);
+
+        // PRESENTATION.
+        uint64_t Present(WINDOWING::IWindow& window, IMAGES::Bitmap* read_back_bitmap = nullptr);
+        std::size_t QueuedPresentCount() const;
+
+        // FENCES.
+        uint64_t LastSubmittedFenceValue() const;
+        bool FenceCompleted(const uint64_t fence_value) const;
+        void WaitForFence(const uint64_t fence_value) const;
+        void WaitForIdle() const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The color buffers are cleared to on the background thread after being presented.
+        Color ClearColor = Color::BLACK;
+
+    private:
+        /// A single buffer in the swap chain.
+        struct Buffer
+        {
+            /// The color image for the buffer.
+            IMAGES::Bitmap Image = IMAGES::Bitmap(0, 0, GRAPHICS::ColorFormat::RGBA);
+            /// The fence value for the most recent present of the buffer, which completes once the present
+            /// (including clearing) has finished.
+            uint64_t FenceValue = NO_FENCE;
+            /// The color the entire buffer is known to be cleared to, if any.
+            std::optional<Color> ClearedColor = std::nullopt;
+        };
+
+        /// A present waiting to be performed on the present thread.
+        struct QueuedPresent
+        {
+            /// The fence value that is completed once the present has been performed.
+            uint64_t FenceValue = NO_FENCE;
+            /// Displays (unless already displayed when presenting), reads back, and clears the presented buffer.
+            std::function<void()> Present = {};
+        };
+
+        /// The background thread that performs presents in submission order.
+        /// It's kept separate from the swap chain so that it remains at the same address if the swap chain is moved.
+        struct PresentThread
+        {
+            /// Protects access to the other members.
+            std::mutex Mutex = {};
+            /// Signaled when a present is queued or the thread is requested to stop.
+            std::condition_variable PresentQueued = {};
+            /// Signaled when a present completes.
+            std::condition_variable PresentCompleted = {};
+            /// The presents waiting to be performed, in submission order.
+            std::deque<QueuedPresent> QueuedPresents = {};
+            /// The fence value of the most recently completed present.
+            uint64_t CompletedFence = NO_FENCE;
+            /// True if the thread should exit once all queued presents have been performed.
+            bool StopRequested = false;
+            /// The thread performing presents.  Only started once something is presented.
+            std::thread Thread = {};
+        };
+
+        // HELPER METHODS.
+        static void PerformPresents(PresentThread& present_thread);
+        void StopPresentThread();
+        void WaitForBuffer(const Buffer& buffer) const;
+
+        // MEMBER VARIABLES.
+        /// The buffers in the chain.
+        std::vector<Buffer> Buffers = {};
+        /// The index of the buffer currently being rendered to.
+        std::size_t CurrentIndex = 0;
+        /// The fence value of the most recently submitted present.
+        uint64_t LastSubmittedFence = NO_FENCE;
+        /// The thread performing presents.  Only null if the swap chain has been moved from.
+        std::unique_ptr<PresentThread> Presenter = std::make_unique<PresentThread>();
+        /// The color the most recently presented buffer was filled with before rendering, if known.
+        std::optional<Color> LastPresentedFillColor = std::nullopt;
+        /// The regions of the most recently presented buffer that differ from its fill color.
+        std::vector<MATH::Rectangleui> LastPresentedDirtyRectangles = {};
+    };
+}
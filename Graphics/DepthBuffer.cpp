@@ -1,41 +1,224 @@
+#include <algorithm>
+#include <bit>
+#include <cmath>
 #include "Graphics/DepthBuffer.h"
+#include "Processor/SimdMemory.h"
 
 namespace GRAPHICS
 {
-    /// Constructor.
+    /// Constructor for a depth buffer with 32-bit floating-point depths and without reversed-Z.
     /// @param[in]  width_in_pixels - The width of the buffer.
     /// @param[in]  height_in_pixels - The height of the buffer.
     DepthBuffer::DepthBuffer(const unsigned int width_in_pixels, const unsigned int height_in_pixels):
+        DepthBuffer(width_in_pixels, height_in_pixels, DepthBufferFormat::FLOAT_32, false)
+    {}
+
+    /// Constructor.
+    /// @param[in]  width_in_pixels - The width of the buffer.
+    /// @param[in]  height_in_pixels - The height of the buffer.
+    /// @param[in]  format - The format in which to store depth values.
+    /// @param[in]  reversed_z - True if depths will be reversed-Z depths; false if not.
+    DepthBuffer::DepthBuffer(
+        const unsigned int width_in_pixels,
+        const unsigned int height_in_pixels,
+        const DepthBufferFormat format,
+        const bool reversed_z):
         WidthInPixels(width_in_pixels),
         HeightInPixels(height_in_pixels),
-        DepthValues(width_in_pixels, height_in_pixels)
+        Format(format),
+        ReversedZ(reversed_z),
+        DepthValues(),
+        FixedPoint16DepthValues(),
+        FastClearTileColumnCount((width_in_pixels + FAST_CLEAR_TILE_DIMENSION_IN_PIXELS - 1) / FAST_CLEAR_TILE_DIMENSION_IN_PIXELS),
+        TilesPendingFastClear(),
+        PendingFastClearTileCount(0),
+        FastClearDepth(MAX_DEPTH)
     {
+        // ALLOCATE MEMORY FOR ONLY THE FORMAT BEING USED.
+        switch (Format)
+        {
+            case DepthBufferFormat::FIXED_POINT_16:
+                FixedPoint16DepthValues.Resize(width_in_pixels, height_in_pixels);
+                break;
+            case DepthBufferFormat::FLOAT_32:
+            default:
+                DepthValues.Resize(width_in_pixels, height_in_pixels);
+                break;
+        }
+
+        unsigned int fast_clear_tile_row_count = (height_in_pixels + FAST_CLEAR_TILE_DIMENSION_IN_PIXELS - 1) / FAST_CLEAR_TILE_DIMENSION_IN_PIXELS;
+        TilesPendingFastClear.resize(static_cast<std::size_t>(FastClearTileColumnCount) * fast_clear_tile_row_count, false);
+
         ClearToDepth(MAX_DEPTH);
     }
 
+    /// Gets the width of the depth buffer.
+    /// @return The width in pixels.
+    unsigned int DepthBuffer::GetWidthInPixels() const
+    {
+        return WidthInPixels;
+    }
+
+    /// Gets the height of the depth buffer.
+    /// @return The height in pixels.
+    unsigned int DepthBuffer::GetHeightInPixels() const
+    {
+        return HeightInPixels;
+    }
+
+    /// Gets the format in which depth values are stored.
+    /// @return The format of the depth buffer.
+    DepthBufferFormat DepthBuffer::GetFormat() const
+    {
+        return Format;
+    }
+
+    /// Determines if the depth buffer expects reversed-Z depths.
+    /// @return True if reversed-Z depths are used; false if not.
+    bool DepthBuffer::IsReversedZ() const
+    {
+        return ReversedZ;
+    }
+
+    /// Gets the depth at the far clip plane, which is the farthest depth that fixed-point formats can store.
+    /// @return The far depth.
+    float DepthBuffer::GetFarDepth() const
+    {
+        float far_depth = ReversedZ ? REVERSED_Z_FAR_DEPTH : FAR_DEPTH;
+        return far_depth;
+    }
+
+    /// Retrieves a pointer to the raw depth values, in row-major order.
+    /// Only available for the 32-bit floating-point format.
+    /// Any pending fast clear must be resolved first for all raw depth values to be accurate.
+    /// @return A pointer to the raw depth values; null for other formats.
+    const float* DepthBuffer::GetRawData() const
+    {
+        return DepthValues.ValuesInRowMajorOrder();
+    }
+
+    /// Retrieves a pointer to the raw depth values, in row-major order.
+    /// Only available for the 32-bit floating-point format.
+    /// Any pending fast clear is resolved so that all raw depth values are accurate.
+    /// @return A pointer to the raw depth values; null for other formats.
+    float* DepthBuffer::GetRawData()
+    {
+        ResolveFastClear();
+        return DepthValues.ValuesInRowMajorOrder();
+    }
+
     /// Clears the depth buffer to the specified depth.
     /// @param[in]  depth - The depth value to clear the buffer too.
     void DepthBuffer::ClearToDepth(const float depth)
     {
-        DepthValues.Fill(depth);
+        std::size_t depth_value_count = static_cast<std::size_t>(WidthInPixels) * HeightInPixels;
+        switch (Format)
+        {
+            case DepthBufferFormat::FIXED_POINT_16:
+                FixedPoint16DepthValues.Fill(static_cast<uint16_t>(ToFixedPoint(depth)));
+                break;
+            case DepthBufferFormat::FLOAT_32:
+            default:
+                PROCESSOR::SimdMemory::Fill(DepthValues.ValuesInRowMajorOrder(), depth_value_count, depth);
+                break;
+        }
+
+        // CANCEL ANY PENDING FAST CLEAR SINCE ALL DEPTHS HAVE BEEN WRITTEN.
+        if (PendingFastClearTileCount > 0)
+        {
+            std::fill(TilesPendingFastClear.begin(), TilesPendingFastClear.end(), false);
+            PendingFastClearTileCount = 0;
+        }
+    }
+
+    /// Clears the depth buffer to the specified depth without writing any depths yet.
+    /// Depths in each tile are only written the first time a depth in the tile is written.
+    /// @param[in]  depth - The depth value to clear the buffer to.
+    void DepthBuffer::FastClearToDepth(const float depth)
+    {
+        FastClearDepth = depth;
+        std::fill(TilesPendingFastClear.begin(), TilesPendingFastClear.end(), true);
+        PendingFastClearTileCount = TilesPendingFastClear.size();
+    }
+
+    /// Writes the depths for all tiles still pending a fast clear.
+    void DepthBuffer::ResolveFastClear()
+    {
+        // SKIP CHECKING TILES IF NONE ARE PENDING A FAST CLEAR.
+        if (0 == PendingFastClearTileCount)
+        {
+            return;
+        }
+
+        for (std::size_t tile_index = 0; tile_index < TilesPendingFastClear.size(); ++tile_index)
+        {
+            ResolveFastClearTile(tile_index);
+        }
     }
 
     /// Gets the depth at the specified coordinates.
     /// @param[in]  x - The horizontal coordinate of the pixel.
     /// @param[in]  y - The vertical coorindate of the pixel.
-    /// @return The depth for the specified pixel.
+    /// @return The depth for the specified pixel.  For fixed-point formats,
+    ///     this is the depth at the precision of the format.
     float DepthBuffer::GetDepth(const unsigned int x, const unsigned int y) const
     {
         // RETURN A DEFAULT DEPTH VALUE IF THE PIXEL COORDINATES AREN'T VALID.
-        bool pixel_coordinates_valid = DepthValues.IndicesInRange(x, y);
+        bool pixel_coordinates_valid = (x < WidthInPixels) && (y < HeightInPixels);
         if (!pixel_coordinates_valid)
         {
             return MIN_DEPTH;
         }
 
+        // RETURN THE FAST CLEAR DEPTH IF THE PIXEL'S TILE HASN'T BEEN WRITTEN SINCE A FAST CLEAR.
+        if (TilePendingFastClear(x, y))
+        {
+            float fast_clear_depth = (DepthBufferFormat::FLOAT_32 == Format) ? FastClearDepth : FromFixedPoint(ToFixedPoint(FastClearDepth));
+            return fast_clear_depth;
+        }
+
         // RETURN THE DEPTH.
-        float depth = DepthValues(x, y);
-        return depth;
+        switch (Format)
+        {
+            case DepthBufferFormat::FIXED_POINT_16:
+                return FromFixedPoint(FixedPoint16DepthValues(x, y));
+            case DepthBufferFormat::FLOAT_32:
+            default:
+                return DepthValues(x, y);
+        }
+    }
+
+    /// Determines if a depth at the specified coordinates would pass the depth test
+    /// (being in front of or at the same depth as the existing depth).
+    /// @param[in]  x - The horizontal coordinate of the pixel.
+    /// @param[in]  y - The vertical coorindate of the pixel.
+    /// @param[in]  depth - The depth to test.
+    /// @return True if the depth passes the depth test; false if not (including if the coordinates are invalid).
+    bool DepthBuffer::TestDepth(const unsigned int x, const unsigned int y, const float depth) const
+    {
+        // MAKE SURE THE PIXEL COORDINATES ARE VALID.
+        bool pixel_coordinates_valid = (x < WidthInPixels) && (y < HeightInPixels);
+        if (!pixel_coordinates_valid)
+        {
+            return false;
+        }
+
+        // COMPARE AGAINST THE FAST CLEAR DEPTH IF THE PIXEL'S TILE HASN'T BEEN WRITTEN SINCE A FAST CLEAR.
+        if (TilePendingFastClear(x, y))
+        {
+            bool depth_passes = (DepthBufferFormat::FLOAT_32 == Format) ? (depth >= FastClearDepth) : (ToFixedPoint(depth) >= ToFixedPoint(FastClearDepth));
+            return depth_passes;
+        }
+
+        // COMPARE THE DEPTHS AT THE PRECISION OF THE FORMAT.
+        switch (Format)
+        {
+            case DepthBufferFormat::FIXED_POINT_16:
+                return ToFixedPoint(depth) >= FixedPoint16DepthValues(x, y);
+            case DepthBufferFormat::FLOAT_32:
+            default:
+                return depth >= DepthValues(x, y);
+        }
     }
 
     /// Writes the depth at the specified coordinates.
@@ -45,14 +228,267 @@ namespace GRAPHICS
     void DepthBuffer::WriteDepth(const unsigned int x, const unsigned int y, const float depth)
     {
         // MAKE SURE THE PIXEL COORDINATES ARE VALID.
-        bool pixel_coordinates_valid = DepthValues.IndicesInRange(x, y);
+        bool pixel_coordinates_valid = (x < WidthInPixels) && (y < HeightInPixels);
         if (!pixel_coordinates_valid)
         {
             // The depth can't be written.
             return;
         }
 
+        // WRITE ANY FAST CLEARED DEPTHS FOR THE PIXEL'S TILE.
+        if (PendingFastClearTileCount > 0)
+        {
+            ResolveFastClearTile(FastClearTileIndex(x, y));
+        }
+
         // FILL IN THE DEPTH OF THE PIXEL.
-        DepthValues(x, y) = depth;
+        switch (Format)
+        {
+            case DepthBufferFormat::FIXED_POINT_16:
+                FixedPoint16DepthValues(x, y) = static_cast<uint16_t>(ToFixedPoint(depth));
+                break;
+            case DepthBufferFormat::FLOAT_32:
+            default:
+                DepthValues(x, y) = depth;
+                break;
+        }
+    }
+
+    /// Determines if 8 horizontally adjacent depths would pass the depth test using SIMD operations.
+    /// Results match the non-SIMD version.
+    /// @param[in]  first_pixel_index - The row-major index of the first (leftmost) pixel.
+    /// @param[in]  depths - The depths to test.
+    /// @param[in]  pixel_mask - A mask indicating which pixels to test.  Only pixels with all bits set are read
+    ///     from depth buffer memory, so other pixels may be outside of the depth buffer.
+    /// @return A mask with all bits set for pixels in the pixel mask that pass the depth test; all bits cleared otherwise.
+    SIMD_TARGET_AVX2 __m256 DepthBuffer::TestDepths(const std::size_t first_pixel_index, const __m256 depths, const __m256 pixel_mask) const
+    {
+        // TEST PIXELS INDIVIDUALLY IF ANY OF THEIR TILES HAVEN'T BEEN WRITTEN SINCE A FAST CLEAR.
+        // This only happens for the first pixels tested in a tile, so it's not worth optimizing.
+        constexpr unsigned int PIXEL_COUNT = 8;
+        if (PendingFastClearTileCount > 0)
+        {
+            unsigned int first_pixel_x = static_cast<unsigned int>(first_pixel_index % WidthInPixels);
+            unsigned int pixel_y = static_cast<unsigned int>(first_pixel_index / WidthInPixels);
+            unsigned int last_pixel_x = std::min(first_pixel_x + PIXEL_COUNT - 1, WidthInPixels - 1);
+            bool any_tile_pending_fast_clear = TilePendingFastClear(first_pixel_x, pixel_y) || TilePendingFastClear(last_pixel_x, pixel_y);
+            if (any_tile_pending_fast_clear)
+            {
+                alignas(32) float depth_values[PIXEL_COUNT];
+                _mm256_store_ps(depth_values, depths);
+                alignas(32) uint32_t passing_pixel_bits[PIXEL_COUNT] = {};
+                int pixel_bit_mask = _mm256_movemask_ps(pixel_mask);
+                while (pixel_bit_mask)
+                {
+                    int pixel_index = std::countr_zero(static_cast<unsigned int>(pixel_bit_mask));
+                    bool pixel_passes = TestDepth(first_pixel_x + pixel_index, pixel_y, depth_values[pixel_index]);
+                    passing_pixel_bits[pixel_index] = pixel_passes ? 0xFFFFFFFF : 0;
+                    pixel_bit_mask &= (pixel_bit_mask - 1);
+                }
+                __m256 passing_pixels = _mm256_castsi256_ps(_mm256_load_si256(reinterpret_cast<const __m256i*>(passing_pixel_bits)));
+                return passing_pixels;
+            }
+        }
+
+        __m256i integer_pixel_mask = _mm256_castps_si256(pixel_mask);
+        switch (Format)
+        {
+            case DepthBufferFormat::FIXED_POINT_16:
+            {
+                // LOAD THE EXISTING DEPTHS.
+                // There are no masked loads for 16-bit values, so depths are only read directly from
+                // the buffer if all 8 are within the buffer.
+                std::size_t depth_value_count = static_cast<std::size_t>(WidthInPixels) * HeightInPixels;
+                const uint16_t* existing_depth_values = FixedPoint16DepthValues.ValuesInRowMajorOrder() + first_pixel_index;
+                __m128i existing_16_bit_depths = _mm_setzero_si128();
+                bool all_pixels_in_buffer = (first_pixel_index + PIXEL_COUNT <= depth_value_count);
+                if (all_pixels_in_buffer)
+                {
+                    existing_16_bit_depths = _mm_loadu_si128(reinterpret_cast<const __m128i*>(existing_depth_values));
+                }
+                else
+                {
+                    alignas(16) uint16_t remaining_depth_values[PIXEL_COUNT] = {};
+                    std::size_t remaining_pixel_count = depth_value_count - first_pixel_index;
+                    std::copy(existing_depth_values, existing_depth_values + remaining_pixel_count, remaining_depth_values);
+                    existing_16_bit_depths = _mm_load_si128(reinterpret_cast<const __m128i*>(remaining_depth_values));
+                }
+
+                // COMPARE THE DEPTHS.
+                __m256i existing_depths = _mm256_cvtepu16_epi32(existing_16_bit_depths);
+                __m256i existing_depths_in_front = _mm256_cmpgt_epi32(existing_depths, ToFixedPoint(depths));
+                __m256 passing_pixels = _mm256_andnot_ps(_mm256_castsi256_ps(existing_depths_in_front), pixel_mask);
+                return passing_pixels;
+            }
+            case DepthBufferFormat::FLOAT_32:
+            default:
+            {
+                // Masked loads avoid reading memory past the end of the buffer for pixels that aren't tested.
+                __m256 existing_depths = _mm256_maskload_ps(DepthValues.ValuesInRowMajorOrder() + first_pixel_index, integer_pixel_mask);
+                __m256 depths_in_front = _mm256_cmp_ps(depths, existing_depths, _CMP_GE_OQ);
+                __m256 passing_pixels = _mm256_and_ps(pixel_mask, depths_in_front);
+                return passing_pixels;
+            }
+        }
+    }
+
+    /// Writes 8 horizontally adjacent depths using SIMD operations.
+    /// @param[in]  first_pixel_index - The row-major index of the first (leftmost) pixel.
+    /// @param[in]  depths - The depths to write.
+    /// @param[in]  pixel_mask - A mask indicating which pixels to write.  Only pixels with all bits set are written,
+    ///     so other pixels may be outside of the depth buffer.
+    SIMD_TARGET_AVX2 void DepthBuffer::WriteDepths(const std::size_t first_pixel_index, const __m256 depths, const __m256 pixel_mask)
+    {
+        // WRITE ANY FAST CLEARED DEPTHS FOR THE PIXELS' TILES.
+        if (PendingFastClearTileCount > 0)
+        {
+            ResolveFastClearTiles(first_pixel_index);
+        }
+
+        __m256i integer_pixel_mask = _mm256_castps_si256(pixel_mask);
+        switch (Format)
+        {
+            case DepthBufferFormat::FIXED_POINT_16:
+            {
+                // There are no masked stores for 16-bit values, so only the masked pixels are individually written.
+                alignas(32) uint32_t fixed_point_depths[8];
+                _mm256_store_si256(reinterpret_cast<__m256i*>(fixed_point_depths), ToFixedPoint(depths));
+                int pixel_bit_mask = _mm256_movemask_ps(pixel_mask);
+                uint16_t* depth_values = FixedPoint16DepthValues.ValuesInRowMajorOrder() + first_pixel_index;
+                while (pixel_bit_mask)
+                {
+                    int pixel_index = std::countr_zero(static_cast<unsigned int>(pixel_bit_mask));
+                    depth_values[pixel_index] = static_cast<uint16_t>(fixed_point_depths[pixel_index]);
+                    pixel_bit_mask &= (pixel_bit_mask - 1);
+                }
+                break;
+            }
+            case DepthBufferFormat::FLOAT_32:
+            default:
+                _mm256_maskstore_ps(DepthValues.ValuesInRowMajorOrder() + first_pixel_index, integer_pixel_mask, depths);
+                break;
+        }
+    }
+
+    /// Gets the maximum fixed-point value for the depth buffer's format.
+    /// @return The maximum fixed-point value (as a float for easy conversions).
+    float DepthBuffer::FixedPointMaxValue() const
+    {
+        constexpr float MAX_FIXED_POINT_16_VALUE = static_cast<float>((1u << 16) - 1);
+        return MAX_FIXED_POINT_16_VALUE;
+    }
+
+    /// Converts a depth to the depth buffer's fixed-point format.
+    /// @param[in]  depth - The depth to convert.
+    /// @return The nearest fixed-point depth, clamped to the range between the far and near depths.
+    uint32_t DepthBuffer::ToFixedPoint(const float depth) const
+    {
+        // SCALE THE DEPTH TO THE RANGE OF FIXED-POINT VALUES.
+        // The scaling factor is computed the same way as the SIMD version for consistent rounding.
+        float max_fixed_point_value = FixedPointMaxValue();
+        float far_depth = GetFarDepth();
+        float fixed_point_values_per_depth = max_fixed_point_value / (NEAR_DEPTH - far_depth);
+        float scaled_depth = (depth - far_depth) * fixed_point_values_per_depth;
+        float clamped_scaled_depth = std::clamp(scaled_depth, 0.0f, max_fixed_point_value);
+
+        // ROUND TO THE NEAREST FIXED-POINT VALUE.
+        // Rounding to even matches SIMD conversions under the default rounding mode.
+        uint32_t fixed_point_depth = static_cast<uint32_t>(std::nearbyint(clamped_scaled_depth));
+        return fixed_point_depth;
+    }
+
+    /// Converts 8 depths to the depth buffer's fixed-point format using SIMD operations.
+    /// @param[in]  depths - The depths to convert.
+    /// @return The nearest fixed-point depths, clamped to the range between the far and near depths.
+    SIMD_TARGET_AVX2 __m256i DepthBuffer::ToFixedPoint(const __m256 depths) const
+    {
+        float max_fixed_point_value = FixedPointMaxValue();
+        float far_depth = GetFarDepth();
+        float fixed_point_values_per_depth = max_fixed_point_value / (NEAR_DEPTH - far_depth);
+        __m256 scaled_depths = _mm256_mul_ps(_mm256_sub_ps(depths, _mm256_set1_ps(far_depth)), _mm256_set1_ps(fixed_point_values_per_depth));
+        __m256 clamped_scaled_depths = _mm256_min_ps(_mm256_max_ps(scaled_depths, _mm256_setzero_ps()), _mm256_set1_ps(max_fixed_point_value));
+        __m256i fixed_point_depths = _mm256_cvtps_epi32(clamped_scaled_depths);
+        return fixed_point_depths;
+    }
+
+    /// Converts a fixed-point depth from the depth buffer's format to a regular depth.
+    /// @param[in]  fixed_point_depth - The fixed-point depth to convert.
+    /// @return The regular depth.
+    float DepthBuffer::FromFixedPoint(const uint32_t fixed_point_depth) const
+    {
+        float far_depth = GetFarDepth();
+        float depth_per_fixed_point_value = (NEAR_DEPTH - far_depth) / FixedPointMaxValue();
+        float depth = far_depth + static_cast<float>(fixed_point_depth) * depth_per_fixed_point_value;
+        return depth;
+    }
+
+    /// Gets the index of the fast clear tile containing a pixel.
+    /// @param[in]  x - The horizontal coordinate of the pixel.
+    /// @param[in]  y - The vertical coordinate of the pixel.
+    /// @return The row-major index of the pixel's tile.
+    std::size_t DepthBuffer::FastClearTileIndex(const unsigned int x, const unsigned int y) const
+    {
+        std::size_t tile_column_index = x / FAST_CLEAR_TILE_DIMENSION_IN_PIXELS;
+        std::size_t tile_row_index = y / FAST_CLEAR_TILE_DIMENSION_IN_PIXELS;
+        std::size_t tile_index = (tile_row_index * FastClearTileColumnCount) + tile_column_index;
+        return tile_index;
+    }
+
+    /// Determines if a pixel's tile has been fast cleared without its depths being written yet.
+    /// @param[in]  x - The horizontal coordinate of the pixel.
+    /// @param[in]  y - The vertical coordinate of the pixel.
+    /// @return True if the pixel's depth is the fast clear depth rather than the depth in memory; false otherwise.
+    bool DepthBuffer::TilePendingFastClear(const unsigned int x, const unsigned int y) const
+    {
+        bool tile_pending_fast_clear = (PendingFastClearTileCount > 0) && TilesPendingFastClear[FastClearTileIndex(x, y)];
+        return tile_pending_fast_clear;
+    }
+
+    /// Writes the fast clear depth to all pixels in a tile if the tile is still pending a fast clear.
+    /// @param[in]  tile_index - The row-major index of the tile.
+    void DepthBuffer::ResolveFastClearTile(const std::size_t tile_index)
+    {
+        // CHECK IF THE TILE STILL NEEDS TO BE CLEARED.
+        if (!TilesPendingFastClear[tile_index])
+        {
+            return;
+        }
+        TilesPendingFastClear[tile_index] = false;
+        --PendingFastClearTileCount;
+
+        // WRITE THE FAST CLEAR DEPTH TO EACH ROW OF THE TILE.
+        // Tiles along the right and bottom edges may be partially outside of the buffer.
+        unsigned int tile_left_x = static_cast<unsigned int>(tile_index % FastClearTileColumnCount) * FAST_CLEAR_TILE_DIMENSION_IN_PIXELS;
+        unsigned int tile_top_y = static_cast<unsigned int>(tile_index / FastClearTileColumnCount) * FAST_CLEAR_TILE_DIMENSION_IN_PIXELS;
+        unsigned int tile_width_in_pixels = std::min(FAST_CLEAR_TILE_DIMENSION_IN_PIXELS, WidthInPixels - tile_left_x);
+        unsigned int tile_bottom_y = std::min(tile_top_y + FAST_CLEAR_TILE_DIMENSION_IN_PIXELS, HeightInPixels);
+        uint32_t fixed_point_depth = (DepthBufferFormat::FLOAT_32 == Format) ? 0 : ToFixedPoint(FastClearDepth);
+        for (unsigned int y = tile_top_y; y < tile_bottom_y; ++y)
+        {
+            std::size_t row_start_pixel_index = (static_cast<std::size_t>(y) * WidthInPixels) + tile_left_x;
+            switch (Format)
+            {
+                case DepthBufferFormat::FIXED_POINT_16:
+                    std::fill_n(FixedPoint16DepthValues.ValuesInRowMajorOrder() + row_start_pixel_index, tile_width_in_pixels, static_cast<uint16_t>(fixed_point_depth));
+                    break;
+                case DepthBufferFormat::FLOAT_32:
+                default:
+                    std::fill_n(DepthValues.ValuesInRowMajorOrder() + row_start_pixel_index, tile_width_in_pixels, FastClearDepth);
+                    break;
+            }
+        }
+    }
+
+    /// Writes the fast clear depth for any tiles containing 8 horizontally adjacent pixels that are still pending a fast clear.
+    /// @param[in]  first_pixel_index - The row-major index of the first (leftmost) pixel.
+    void DepthBuffer::ResolveFastClearTiles(const std::size_t first_pixel_index)
+    {
+        // Pixels past the end of the row can't be accessed, so at most 2 tiles in the same row need to be resolved.
+        constexpr unsigned int PIXEL_COUNT = 8;
+        unsigned int first_pixel_x = static_cast<unsigned int>(first_pixel_index % WidthInPixels);
+        unsigned int pixel_y = static_cast<unsigned int>(first_pixel_index / WidthInPixels);
+        unsigned int last_pixel_x = std::min(first_pixel_x + PIXEL_COUNT - 1, WidthInPixels - 1);
+        ResolveFastClearTile(FastClearTileIndex(first_pixel_x, pixel_y));
+        ResolveFastClearTile(FastClearTileIndex(last_pixel_x, pixel_y));
     }
 }
@@ -1,12 +1,30 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <limits>
+#include <vector>
 #include "Containers/Array2D.h"
+#include "Graphics/DepthBufferFormat.h"
+#include "Processor/SimdIntrinsics.h"
 
 namespace GRAPHICS
 {
     /// A depth buffer for keeping track of depth values during rendering.
     /// Also known as z-buffering: https://en.wikipedia.org/wiki/Z-buffering.
+    ///
+    /// Larger depth values are considered closer to the viewer, with new depths passing the depth test
+    /// if they are greater than or equal to existing depths.  Depths from the viewing transformations
+    /// range from -1 (far) to 1 (near) by default.  With reversed-Z, depths instead range from 0 (far) to 1 (near),
+    /// which places the most floating-point precision at far distances (where perspective projection
+    /// otherwise crowds depths together).
+    ///
+    /// Fixed-point formats evenly divide the range between the far and near depths, with depths outside
+    /// of that range clamped.  Depth tests for fixed-point formats are done at the precision of the format.
+    ///
+    /// A fast clear only records the clear depth for each tile of pixels, with depths in a tile only
+    /// being written to memory the first time any depth in the tile is written.  This avoids writing
+    /// depths for regions that nothing is rendered to and keeps newly cleared tiles in cache while rendering.
     class DepthBuffer
     {
     public:
@@ -15,24 +33,77 @@ namespace GRAPHICS
         static constexpr float MIN_DEPTH = std::numeric_limits<float>::max();
         /// The default maximum depth value for the depth buffer.
         static constexpr float MAX_DEPTH = std::numeric_limits<float>::lowest();
+        /// The depth at the near clip plane.
+        static constexpr float NEAR_DEPTH = 1.0f;
+        /// The depth at the far clip plane (without reversed-Z).
+        static constexpr float FAR_DEPTH = -1.0f;
+        /// The depth at the far clip plane with reversed-Z.
+        static constexpr float REVERSED_Z_FAR_DEPTH = 0.0f;
+        /// The width and height of square tiles of pixels that are independently fast cleared.
+        static constexpr unsigned int FAST_CLEAR_TILE_DIMENSION_IN_PIXELS = 32;
 
         // CONSTRUCTION/DESTRUCTION.
         explicit DepthBuffer(const unsigned int width_in_pixels, const unsigned int height_in_pixels);
+        explicit DepthBuffer(
+            const unsigned int width_in_pixels,
+            const unsigned int height_in_pixels,
+            const DepthBufferFormat format,
+            const bool reversed_z);
+
+        // DIMENSIONS.
+        unsigned int GetWidthInPixels() const;
+        unsigned int GetHeightInPixels() const;
+
+        // FORMAT.
+        DepthBufferFormat GetFormat() const;
+        bool IsReversedZ() const;
+        float GetFarDepth() const;
 
         // OTHER METHODS.
+        const float* GetRawData() const;
+        float* GetRawData();
         void ClearToDepth(const float depth);
+        void FastClearToDepth(const float depth);
+        void ResolveFastClear();
         float GetDepth(const unsigned int x, const unsigned int y) const;
+        bool TestDepth(const unsigned int x, const unsigned int y, const float depth) const;
         void WriteDepth(const unsigned int x, const unsigned int y, const float depth);
+        SIMD_TARGET_AVX2 __m256 TestDepths(const std::size_t first_pixel_index, const __m256 depths, const __m256 pixel_mask) const;
+        SIMD_TARGET_AVX2 void WriteDepths(const std::size_t first_pixel_index, const __m256 depths, const __m256 pixel_mask);
 
     private:
+        // HELPER METHODS.
+        float FixedPointMaxValue() const;
+        uint32_t ToFixedPoint(const float depth) const;
+        SIMD_TARGET_AVX2 __m256i ToFixedPoint(const __m256 depths) const;
+        float FromFixedPoint(const uint32_t fixed_point_depth) const;
+        std::size_t FastClearTileIndex(const unsigned int x, const unsigned int y) const;
+        bool TilePendingFastClear(const unsigned int x, const unsigned int y) const;
+        void ResolveFastClearTile(const std::size_t tile_index);
+        void ResolveFastClearTiles(const std::size_t first_pixel_index);
+
         // MEMBER VARIABLES.
         /// The width of the depth buffer in pixels.
         unsigned int WidthInPixels;
         /// The height of the depth buffer in pixels.
         unsigned int HeightInPixels;
-        /// The underlying depth buffer memory to which graphics are rendered.
-        /// The top-left corner pixel is at (0,0), and 
-        /// the bottom-right corner pixel is at (width-1, height-1). 
+        /// The format in which depth values are stored.
+        DepthBufferFormat Format;
+        /// True if reversed-Z depths (0 at the far plane) are used; false for regular depths (-1 at the far plane).
+        bool ReversedZ;
+        /// The underlying depth buffer memory to which graphics are rendered, for the 32-bit floating-point format.
+        /// The top-left corner pixel is at (0,0), and
+        /// the bottom-right corner pixel is at (width-1, height-1).
         CONTAINERS::Array2D<float> DepthValues;
+        /// The underlying depth buffer memory for the 16-bit fixed-point format, arranged like the floating-point values.
+        CONTAINERS::Array2D<uint16_t> FixedPoint16DepthValues;
+        /// The number of fast clear tiles in each row of tiles.
+        unsigned int FastClearTileColumnCount;
+        /// Whether or not each tile (in row-major order) has been fast cleared without its depths being written yet.
+        std::vector<uint8_t> TilesPendingFastClear;
+        /// The number of tiles that are pending a fast clear, allowing tile checks to be skipped if there are none.
+        std::size_t PendingFastClearTileCount;
+        /// The depth of the most recent fast clear.
+        float FastClearDepth;
     };
 }
@@ -0,0 +1,15 @@
+#pragma once
+
+namespace GRAPHICS
+{
+    /// The different formats in which depth values can be stored in a depth buffer.
+    enum class DepthBufferFormat
+    {
+        /// Depths are stored as 32-bit floating-point values exactly as provided.
+        FLOAT_32 = 0,
+        /// Depths are stored as 16-bit fixed-point values evenly spaced between the far and near depths.
+        /// This halves the memory bandwidth of 32-bit floats at the cost of precision.
+        /// There's no 24-bit format since it would still need 32 bits of storage per depth.
+        FIXED_POINT_16,
+    };
+}
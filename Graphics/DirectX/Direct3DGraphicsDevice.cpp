@@ -332,7 +332,7 @@ namespace GRAPHICS::DIRECT_X
         for (const auto& [mesh_name, mesh] : object_3D.Model.MeshesByName)
         {
             // LOAD TEXTURES FOR ALL TRIANGLES.
-            for (const GEOMETRY::Triangle& triangle : mesh.Triangles)
+            for (const GEOMETRY::Triangle& triangle : mesh.GetTriangles())
             {
                 // SKIP OVER ANY TRIANGLES WITHOUT MATERIALS.
                 if (!triangle.Material)
@@ -574,7 +574,7 @@ namespace GRAPHICS::DIRECT_X
             for (const auto& [mesh_name, mesh] : object_3D.Model.MeshesByName)
             {
                 // RENDER EACH TRIANGLE.
-                for (const GEOMETRY::Triangle& triangle : mesh.Triangles)
+                for (const GEOMETRY::Triangle& triangle : mesh.GetTriangles())
                 {
                     // CHECK IF THE TRIANGLE IS TEXTURED.
                     bool is_textured = static_cast<bool>(triangle.Material->DiffuseProperties.Texture);
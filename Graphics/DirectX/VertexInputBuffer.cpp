@@ -15,7 +15,7 @@ namespace GRAPHICS::DIRECT_X
         for (const auto& [mesh_name, mesh] : model.MeshesByName)
         {
             // GET VERTEX DATA FOR EACH TRIANGLE.
-            for (const GEOMETRY::Triangle& triangle : mesh.Triangles)
+            for (const GEOMETRY::Triangle& triangle : mesh.GetTriangles())
             {
                 // CALCULATE THE TRIANGLE'S SURFACE NORMAL.
                 MATH::Vector3f surface_normal = triangle.SurfaceNormal();
@@ -5,7 +5,7 @@ namespace GRAPHICS::GEOMETRY
     /// Loads a triangle into 8-wide SIMD format.
     /// @param[in]  triangle - The triangle to load into SIMD format.
     /// @return The triangle in SIMD format.
-    TriangleSimd8x TriangleSimd8x::Load(const Triangle& triangle)
+    SIMD_TARGET_AVX2 TriangleSimd8x TriangleSimd8x::Load(const Triangle& triangle)
     {
         TriangleSimd8x simd_triangle;
 
@@ -20,67 +20,66 @@ namespace GRAPHICS::GEOMETRY
         const VertexWithAttributes& left_vertex = triangle.Vertices[0];
         const VertexWithAttributes& right_vertex = triangle.Vertices[2];
 
-        simd_triangle.CenterVertexPosition.X = _mm256_set1_ps(center_vertex.Position.X);
-        simd_triangle.CenterVertexPosition.Y = _mm256_set1_ps(center_vertex.Position.Y);
-        simd_triangle.CenterVertexPosition.Z = _mm256_set1_ps(center_vertex.Position.Z);
+        simd_triangle.CenterVertexPosition.X = center_vertex.Position.X;
+        simd_triangle.CenterVertexPosition.Y = center_vertex.Position.Y;
+        simd_triangle.CenterVertexPosition.Z = center_vertex.Position.Z;
 
-        simd_triangle.LeftVertexPosition.X = _mm256_set1_ps(left_vertex.Position.X);
-        simd_triangle.LeftVertexPosition.Y = _mm256_set1_ps(left_vertex.Position.Y);
-        simd_triangle.LeftVertexPosition.Z = _mm256_set1_ps(left_vertex.Position.Z);
+        simd_triangle.LeftVertexPosition.X = left_vertex.Position.X;
+        simd_triangle.LeftVertexPosition.Y = left_vertex.Position.Y;
+        simd_triangle.LeftVertexPosition.Z = left_vertex.Position.Z;
 
-        simd_triangle.RightVertexPosition.X = _mm256_set1_ps(right_vertex.Position.X);
-        simd_triangle.RightVertexPosition.Y = _mm256_set1_ps(right_vertex.Position.Y);
-        simd_triangle.RightVertexPosition.Z = _mm256_set1_ps(right_vertex.Position.Z);
+        simd_triangle.RightVertexPosition.X = right_vertex.Position.X;
+        simd_triangle.RightVertexPosition.Y = right_vertex.Position.Y;
+        simd_triangle.RightVertexPosition.Z = right_vertex.Position.Z;
 
         MATH::Vector2f center_vertex_position_2d(center_vertex.Position.X, center_vertex.Position.Y);
         MATH::Vector2f left_vertex_position_2d(left_vertex.Position.X, left_vertex.Position.Y);
         MATH::Vector2f right_vertex_position_2d(right_vertex.Position.X, right_vertex.Position.Y);
         float signed_distance_of_right_vertex_from_left_edge = Triangle::SignedDistanceOfPointFromEdge2D(center_vertex_position_2d, left_vertex_position_2d, right_vertex_position_2d);
-        simd_triangle.SignedDistanceOfRightVertexFromLeftEdge = _mm256_set1_ps(signed_distance_of_right_vertex_from_left_edge);
+        simd_triangle.SignedDistanceOfRightVertexFromLeftEdge = signed_distance_of_right_vertex_from_left_edge;
         float signed_distance_of_left_vertex_from_right_edge = Triangle::SignedDistanceOfPointFromEdge2D(center_vertex_position_2d, right_vertex_position_2d, left_vertex_position_2d);
-        simd_triangle.SignedDistanceOfLeftVertexFromRightEdge = _mm256_set1_ps(signed_distance_of_left_vertex_from_right_edge);
+        simd_triangle.SignedDistanceOfLeftVertexFromRightEdge = signed_distance_of_left_vertex_from_right_edge;
 
         simd_triangle.LeftEdgeBarycentricCoordinateFormulaComponents = TriangleSimd8xBarycentricCoordinateFormulaComponents::Compute(center_vertex_position_2d, left_vertex_position_2d);
         simd_triangle.RightEdgeBarycentricCoordinateFormulaComponents = TriangleSimd8xBarycentricCoordinateFormulaComponents::Compute(center_vertex_position_2d, right_vertex_position_2d);
 
-        simd_triangle.FirstVertexColorRed = _mm256_set1_ps(triangle.Vertices[0].Color.Red);
-        simd_triangle.FirstVertexColorGreen = _mm256_set1_ps(triangle.Vertices[0].Color.Green);
-        simd_triangle.FirstVertexColorBlue = _mm256_set1_ps(triangle.Vertices[0].Color.Blue);
+        simd_triangle.FirstVertexColorRed = triangle.Vertices[0].Color.Red;
+        simd_triangle.FirstVertexColorGreen = triangle.Vertices[0].Color.Green;
+        simd_triangle.FirstVertexColorBlue = triangle.Vertices[0].Color.Blue;
 
-        simd_triangle.SecondVertexColorRed = _mm256_set1_ps(triangle.Vertices[1].Color.Red);
-        simd_triangle.SecondVertexColorGreen = _mm256_set1_ps(triangle.Vertices[1].Color.Green);
-        simd_triangle.SecondVertexColorBlue = _mm256_set1_ps(triangle.Vertices[1].Color.Blue);
+        simd_triangle.SecondVertexColorRed = triangle.Vertices[1].Color.Red;
+        simd_triangle.SecondVertexColorGreen = triangle.Vertices[1].Color.Green;
+        simd_triangle.SecondVertexColorBlue = triangle.Vertices[1].Color.Blue;
 
-        simd_triangle.ThirdVertexColorRed = _mm256_set1_ps(triangle.Vertices[2].Color.Red);
-        simd_triangle.ThirdVertexColorGreen = _mm256_set1_ps(triangle.Vertices[2].Color.Green);
-        simd_triangle.ThirdVertexColorBlue = _mm256_set1_ps(triangle.Vertices[2].Color.Blue);
+        simd_triangle.ThirdVertexColorRed = triangle.Vertices[2].Color.Red;
+        simd_triangle.ThirdVertexColorGreen = triangle.Vertices[2].Color.Green;
+        simd_triangle.ThirdVertexColorBlue = triangle.Vertices[2].Color.Blue;
 
-        simd_triangle.FirstVertexTextureCoordinates.X = _mm256_set1_ps(triangle.Vertices[0].TextureCoordinates.X);
-        simd_triangle.FirstVertexTextureCoordinates.Y = _mm256_set1_ps(triangle.Vertices[0].TextureCoordinates.Y);
+        simd_triangle.FirstVertexTextureCoordinates.X = triangle.Vertices[0].TextureCoordinates.X;
+        simd_triangle.FirstVertexTextureCoordinates.Y = triangle.Vertices[0].TextureCoordinates.Y;
 
-        simd_triangle.SecondVertexTextureCoordinates.X = _mm256_set1_ps(triangle.Vertices[1].TextureCoordinates.X);
-        simd_triangle.SecondVertexTextureCoordinates.Y = _mm256_set1_ps(triangle.Vertices[1].TextureCoordinates.Y);
+        simd_triangle.SecondVertexTextureCoordinates.X = triangle.Vertices[1].TextureCoordinates.X;
+        simd_triangle.SecondVertexTextureCoordinates.Y = triangle.Vertices[1].TextureCoordinates.Y;
 
-        simd_triangle.ThirdVertexTextureCoordinates.X = _mm256_set1_ps(triangle.Vertices[2].TextureCoordinates.X);
-        simd_triangle.ThirdVertexTextureCoordinates.Y = _mm256_set1_ps(triangle.Vertices[2].TextureCoordinates.Y);
+        simd_triangle.ThirdVertexTextureCoordinates.X = triangle.Vertices[2].TextureCoordinates.X;
+        simd_triangle.ThirdVertexTextureCoordinates.Y = triangle.Vertices[2].TextureCoordinates.Y;
 
         return simd_triangle;
     }
 
-    MATH::Vector3Simd8x TriangleSimd8x::BarycentricCoordinates2DOf(const MATH::Vector2<__m256>& points)
+    SIMD_TARGET_AVX2 MATH::Vector3Simd8x TriangleSimd8x::BarycentricCoordinates2DOf(const MATH::Vector2<__m256>& points)
     {
         // COMPUTE THE BARYCENTRIC COORDINATE RELATIVE TO THE LEFT EDGE.
-        __m256 signed_distances_of_points_from_left_edge = SignedDistanceOfPointsFromEdge2D(LeftEdgeBarycentricCoordinateFormulaComponents, points);
-        __m256 scaled_signed_distances_of_points_from_left_edge = _mm256_div_ps(signed_distances_of_points_from_left_edge, SignedDistanceOfRightVertexFromLeftEdge);
+        MATH::Simd8xf signed_distances_of_points_from_left_edge = SignedDistanceOfPointsFromEdge2D(LeftEdgeBarycentricCoordinateFormulaComponents, points);
+        MATH::Simd8xf scaled_signed_distances_of_points_from_left_edge = signed_distances_of_points_from_left_edge / SignedDistanceOfRightVertexFromLeftEdge;
 
         // COMPUTE THE BARYCENTRIC COORDINATE RELATIVE TO THE RIGHT EDGE.
-        __m256 signed_distances_of_points_from_right_edge = SignedDistanceOfPointsFromEdge2D(RightEdgeBarycentricCoordinateFormulaComponents, points);
-        __m256 scaled_signed_distances_of_points_from_right_edge = _mm256_div_ps(signed_distances_of_points_from_right_edge, SignedDistanceOfLeftVertexFromRightEdge);
+        MATH::Simd8xf signed_distances_of_points_from_right_edge = SignedDistanceOfPointsFromEdge2D(RightEdgeBarycentricCoordinateFormulaComponents, points);
+        MATH::Simd8xf scaled_signed_distances_of_points_from_right_edge = signed_distances_of_points_from_right_edge / SignedDistanceOfLeftVertexFromRightEdge;
 
         // COMPUTE THE BARYCENTRIC COORDINATE FOR THE REMAINING EDGE.
-        const __m256 ONE = _mm256_set1_ps(1.0f);
-        __m256 one_minus_scaled_signed_distances_of_points_from_left_edge = _mm256_sub_ps(ONE, scaled_signed_distances_of_points_from_left_edge);
-        __m256 scaled_signed_distances_of_points_from_opposite_edge = _mm256_sub_ps(one_minus_scaled_signed_distances_of_points_from_left_edge, scaled_signed_distances_of_points_from_right_edge);
+        const MATH::Simd8xf ONE = 1.0f;
+        MATH::Simd8xf scaled_signed_distances_of_points_from_opposite_edge = (ONE - scaled_signed_distances_of_points_from_left_edge) - scaled_signed_distances_of_points_from_right_edge;
 
         // RETURN THE FULL BARYCENTRIC COORDINATES FOR THE POINT.
         MATH::Vector3Simd8x barycentric_coordinates;
@@ -90,13 +89,28 @@ namespace GRAPHICS::GEOMETRY
         return barycentric_coordinates;
     }
 
-    __m256 TriangleSimd8x::SignedDistanceOfPointsFromEdge2D(const TriangleSimd8xBarycentricCoordinateFormulaComponents& edge, const MATH::Vector2<__m256>& points)
+    SIMD_TARGET_AVX2 MATH::Simd8xf TriangleSimd8x::SignedDistanceOfPointsFromEdge2D(const TriangleSimd8xBarycentricCoordinateFormulaComponents& edge, const MATH::Vector2<__m256>& points)
     {
-        __m256 point_x_term = _mm256_mul_ps(edge.EdgeStartEndYDistance8x, points.X);
-        __m256 point_y_term = _mm256_mul_ps(edge.EdgeEndStartXDistance8x, points.Y);
-        __m256 point_sum = _mm256_add_ps(point_x_term, point_y_term);
-        __m256 with_edge_start_end_added = _mm256_add_ps(point_sum, edge.EdgeStartXEndYProduct8x);
-        __m256 signed_distances_of_points_from_edge = _mm256_sub_ps(with_edge_start_end_added, edge.EdgeEndXStartYProduct8x);
+        MATH::Simd8xf point_x_term = edge.EdgeStartEndYDistance8x * MATH::Simd8xf(points.X);
+        MATH::Simd8xf point_y_term = edge.EdgeEndStartXDistance8x * MATH::Simd8xf(points.Y);
+        MATH::Simd8xf signed_distances_of_points_from_edge = ((point_x_term + point_y_term) + edge.EdgeStartXEndYProduct8x) - edge.EdgeEndXStartYProduct8x;
         return signed_distances_of_points_from_edge;
     }
+
+    /// Interpolates texture coordinates across the triangle.
+    /// @param[in]  barycentric_coordinates - The barycentric coordinates of the points at which to interpolate.
+    /// @return The interpolated texture coordinates at the points.
+    SIMD_TARGET_AVX2 MATH::Vector2Simd8x TriangleSimd8x::InterpolateTextureCoordinates(const MATH::Vector3Simd8x& barycentric_coordinates) const
+    {
+        MATH::Vector2Simd8x texture_coordinates;
+        texture_coordinates.X =
+            (barycentric_coordinates.X * SecondVertexTextureCoordinates.X) +
+            (barycentric_coordinates.Y * ThirdVertexTextureCoordinates.X) +
+            (barycentric_coordinates.Z * FirstVertexTextureCoordinates.X);
+        texture_coordinates.Y =
+            (barycentric_coordinates.X * SecondVertexTextureCoordinates.Y) +
+            (barycentric_coordinates.Y * ThirdVertexTextureCoordinates.Y) +
+            (barycentric_coordinates.Z * FirstVertexTextureCoordinates.Y);
+        return texture_coordinates;
+    }
 }
@@ -1,7 +1,7 @@
 #pragma once
 
-#include <intrin.h>
 #include "Graphics/Geometry/Triangle.h"
+#include "Math/Simd.h"
 #include "Math/Vector2.h"
 #include "Math/Vector3.h"
 
@@ -13,29 +13,29 @@ namespace GRAPHICS::GEOMETRY
     struct TriangleSimd8xBarycentricCoordinateFormulaComponents
     {
         /// (edge_start_position.Y - edge_end_position.Y)
-        __m256 EdgeStartEndYDistance8x;
+        MATH::Simd8xf EdgeStartEndYDistance8x;
         /// (edge_end_position.X - edge_start_position.X)
-        __m256 EdgeEndStartXDistance8x;
+        MATH::Simd8xf EdgeEndStartXDistance8x;
         /// (edge_start_position.X * edge_end_position.Y)
-        __m256 EdgeStartXEndYProduct8x;
+        MATH::Simd8xf EdgeStartXEndYProduct8x;
         /// (edge_end_position.X * edge_start_position.Y)
-        __m256 EdgeEndXStartYProduct8x;
+        MATH::Simd8xf EdgeEndXStartYProduct8x;
 
         /// Computes the formula components in SIMD format based on the non-SIMD input edge positions.
         /// @param[in]  edge_start_position - The start position of the edge.
         /// @param[in]  edge_end_position - The end position of the edge.
-        static TriangleSimd8xBarycentricCoordinateFormulaComponents Compute(const MATH::Vector2f& edge_start_position, const MATH::Vector2f& edge_end_position)
+        SIMD_TARGET_AVX2 static TriangleSimd8xBarycentricCoordinateFormulaComponents Compute(const MATH::Vector2f& edge_start_position, const MATH::Vector2f& edge_end_position)
         {
             TriangleSimd8xBarycentricCoordinateFormulaComponents formula_components;
 
             float edge_start_end_y_distance = (edge_start_position.Y - edge_end_position.Y);
-            formula_components.EdgeStartEndYDistance8x = _mm256_set1_ps(edge_start_end_y_distance);
+            formula_components.EdgeStartEndYDistance8x = edge_start_end_y_distance;
             float edge_end_start_x_distance = (edge_end_position.X - edge_start_position.X);
-            formula_components.EdgeEndStartXDistance8x = _mm256_set1_ps(edge_end_start_x_distance);
+            formula_components.EdgeEndStartXDistance8x = edge_end_start_x_distance;
             float edge_start_x_end_y_product = (edge_start_position.X * edge_end_position.Y);
-            formula_components.EdgeStartXEndYProduct8x = _mm256_set1_ps(edge_start_x_end_y_product);
+            formula_components.EdgeStartXEndYProduct8x = edge_start_x_end_y_product;
             float edge_end_x_start_y_product = (edge_end_position.X * edge_start_position.Y);
-            formula_components.EdgeEndXStartYProduct8x = _mm256_set1_ps(edge_end_x_start_y_product);
+            formula_components.EdgeEndXStartYProduct8x = edge_end_x_start_y_product;
 
             return formula_components;
         }
@@ -43,14 +43,16 @@ namespace GRAPHICS::GEOMETRY
 
     /// A triangle in an 8-wide (8x meaning "8 times") SIMD format.
     /// This class helps simplify SIMD operations for improved performance.
+    /// Requires AVX2 support (see @ref PROCESSOR::CpuFeatures).
     class TriangleSimd8x
     {
     public:
         // METHODS.
-        static TriangleSimd8x Load(const Triangle& triangle);
+        SIMD_TARGET_AVX2 static TriangleSimd8x Load(const Triangle& triangle);
 
-        MATH::Vector3Simd8x BarycentricCoordinates2DOf(const MATH::Vector2<__m256>& points);
-        static __m256 SignedDistanceOfPointsFromEdge2D(const TriangleSimd8xBarycentricCoordinateFormulaComponents& edge, const MATH::Vector2<__m256>& points);
+        SIMD_TARGET_AVX2 MATH::Vector3Simd8x BarycentricCoordinates2DOf(const MATH::Vector2<__m256>& points);
+        SIMD_TARGET_AVX2 static MATH::Simd8xf SignedDistanceOfPointsFromEdge2D(const TriangleSimd8xBarycentricCoordinateFormulaComponents& edge, const MATH::Vector2<__m256>& points);
+        SIMD_TARGET_AVX2 MATH::Vector2Simd8x InterpolateTextureCoordinates(const MATH::Vector3Simd8x& barycentric_coordinates) const;
 
         // BASE TRIANGLE DATA.
         MATH::Vector3Simd8x CenterVertexPosition;
@@ -58,23 +60,23 @@ namespace GRAPHICS::GEOMETRY
         MATH::Vector3Simd8x RightVertexPosition;
 
         // BARYCENTRIC COORDINATE DATA.
-        __m256 SignedDistanceOfRightVertexFromLeftEdge;
-        __m256 SignedDistanceOfLeftVertexFromRightEdge;
+        MATH::Simd8xf SignedDistanceOfRightVertexFromLeftEdge;
+        MATH::Simd8xf SignedDistanceOfLeftVertexFromRightEdge;
         TriangleSimd8xBarycentricCoordinateFormulaComponents LeftEdgeBarycentricCoordinateFormulaComponents;
         TriangleSimd8xBarycentricCoordinateFormulaComponents RightEdgeBarycentricCoordinateFormulaComponents;
 
         // COLORS.
-        __m256 FirstVertexColorRed;
-        __m256 FirstVertexColorGreen;
-        __m256 FirstVertexColorBlue;
+        MATH::Simd8xf FirstVertexColorRed;
+        MATH::Simd8xf FirstVertexColorGreen;
+        MATH::Simd8xf FirstVertexColorBlue;
 
-        __m256 SecondVertexColorRed;
-        __m256 SecondVertexColorGreen;
-        __m256 SecondVertexColorBlue;
+        MATH::Simd8xf SecondVertexColorRed;
+        MATH::Simd8xf SecondVertexColorGreen;
+        MATH::Simd8xf SecondVertexColorBlue;
 
-        __m256 ThirdVertexColorRed;
-        __m256 ThirdVertexColorGreen;
-        __m256 ThirdVertexColorBlue;
+        MATH::Simd8xf ThirdVertexColorRed;
+        MATH::Simd8xf ThirdVertexColorGreen;
+        MATH::Simd8xf ThirdVertexColorBlue;
 
         // TEXTURE COORDINATES.
         MATH::Vector2Simd8x FirstVertexTextureCoordinates;
@@ -106,13 +106,16 @@ namespace GRAPHICS::GUI
             }
 
             // STORE THE GLYPH FOR THE CURRENT CHARACTER.
-            system_fixed_font->GlyphsByCharacter[static_cast<unsigned char>(character)] = Glyph
+            Glyph& glyph = system_fixed_font->GlyphsByCharacter[static_cast<unsigned char>(character)];
+            glyph = Glyph
             {
                 .WidthInPixels = static_cast<unsigned int>(glyph_width),
                 .HeightInPixels = static_cast<unsigned int>(glyph_height),
                 .LeftTopOffsetInFontPixels = MATH::Vector2ui(current_glyph_rectangle.left, current_glyph_rectangle.top),
                 .FontPixels = &system_fixed_font->Pixels
             };
+            // Coverage is computed once here so that rendering text doesn't need to unpack pixel colors.
+            glyph.ComputeCoverageMask();
 
             // MOVE TO THE NEXT CHARACTER.
             current_glyph_rectangle.left += glyph_width;
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include "Graphics/Gui/Glyph.h"
 
 namespace GRAPHICS::GUI
@@ -23,4 +24,54 @@ namespace GRAPHICS::GUI
         Color pixel_color = FontPixels->GetPixel(glyph_x_within_font, glyph_y_within_font);
         return pixel_color;
     }
+
+    /// Computes the coverage mask for the glyph from its font pixels.
+    /// Coverage is based on the brightest color component (scaled by alpha)
+    /// since fonts are rendered as light colors on transparent backgrounds.
+    void Glyph::ComputeCoverageMask()
+    {
+        // ALLOCATE A CLEARED COVERAGE MASK.
+        std::size_t row_stride = CoverageMaskRowStride();
+        CoverageMask.assign(row_stride * HeightInPixels, 0);
+
+        // COMPUTE THE COVERAGE FOR EACH PIXEL.
+        for (unsigned int local_y = 0; local_y < HeightInPixels; ++local_y)
+        {
+            for (unsigned int local_x = 0; local_x < WidthInPixels; ++local_x)
+            {
+                Color pixel_color = GetPixelColor(local_x, local_y);
+                unsigned int max_color_component = std::max({ pixel_color.GetRedAsUint8(), pixel_color.GetGreenAsUint8(), pixel_color.GetBlueAsUint8() });
+                // Adding half of the max value rounds to the nearest coverage.
+                constexpr unsigned int MAX_COMPONENT_VALUE = 255;
+                unsigned int coverage = (max_color_component * pixel_color.GetAlphaAsUint8() + (MAX_COMPONENT_VALUE / 2)) / MAX_COMPONENT_VALUE;
+                CoverageMask[local_y * row_stride + local_x] = static_cast<uint8_t>(coverage);
+            }
+        }
+    }
+
+    /// Gets the number of coverage values for each row in the coverage mask, including padding.
+    /// @return The row stride of the coverage mask.
+    std::size_t Glyph::CoverageMaskRowStride() const
+    {
+        std::size_t row_stride = ((WidthInPixels + COVERAGE_MASK_ROW_ALIGNMENT - 1) / COVERAGE_MASK_ROW_ALIGNMENT) * COVERAGE_MASK_ROW_ALIGNMENT;
+        return row_stride;
+    }
+
+    /// Gets the coverage of the specified pixel, if in range.
+    /// @param[in]  local_x - The local x coordinate of the pixel (in range of [0, glyph width - 1]).
+    /// @param[in]  local_y - The local y coordinate of the pixel (in range of [0, glyph height - 1]).
+    /// @return The coverage of the pixel, if in range and computed; 0 otherwise.
+    uint8_t Glyph::GetCoverage(const unsigned int local_x, const unsigned int local_y) const
+    {
+        // MAKE SURE THE COORDINATES ARE VALID.
+        bool coordinates_valid = (local_x < WidthInPixels) && (local_y < HeightInPixels);
+        std::size_t coverage_index = local_y * CoverageMaskRowStride() + local_x;
+        bool coverage_computed = (coverage_index < CoverageMask.size());
+        if (!coordinates_valid || !coverage_computed)
+        {
+            return 0;
+        }
+
+        return CoverageMask[coverage_index];
+    }
 }
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 #include "Graphics/Color.h"
 #include "Graphics/Images/Bitmap.h"
 #include "Math/Vector2.h"
@@ -10,8 +13,17 @@ namespace GRAPHICS::GUI
     class Glyph
     {
     public:
+        // STATIC CONSTANTS.
+        /// The number of coverage values that rows of coverage masks are padded to a multiple of.
+        /// This allows entire blocks of coverage values to be read at once (such as for SIMD operations)
+        /// without reading past the end of a row.
+        static constexpr std::size_t COVERAGE_MASK_ROW_ALIGNMENT = 8;
+
         // PUBLIC METHODS.
         Color GetPixelColor(const unsigned int local_x, const unsigned int local_y) const;
+        void ComputeCoverageMask();
+        std::size_t CoverageMaskRowStride() const;
+        uint8_t GetCoverage(const unsigned int local_x, const unsigned int local_y) const;
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The width of the glyph, in pixels.
@@ -22,5 +34,9 @@ namespace GRAPHICS::GUI
         MATH::Vector2ui LeftTopOffsetInFontPixels = MATH::Vector2ui(0, 0);
         /// The entire set of pixels for the from from which this glyph came.
         const GRAPHICS::IMAGES::Bitmap* FontPixels = nullptr;
+        /// How much of each pixel the glyph covers, from 0 (not at all) to 255 (entirely), in row-major order.
+        /// Rows are padded with zero coverage to a multiple of COVERAGE_MASK_ROW_ALIGNMENT.
+        /// Precomputed from the font pixels so that rendering doesn't need to unpack colors.
+        std::vector<uint8_t> CoverageMask = {};
     };
 }
@@ -3,6 +3,7 @@
 #if _WIN32
 
 #include <string>
+#include "Graphics/Color.h"
 #include "Graphics/Gui/Font.h"
 #include "Math/Vector2.h"
 
@@ -19,6 +20,8 @@ namespace GRAPHICS::GUI
         Font* Font = nullptr;
         /// The left, top (x, y) screen position at which the text should be rendered.
         MATH::Vector2f LeftTopPosition = MATH::Vector2f(0.0f, 0.0f);
+        /// The color of the text.  Blended onto the render target based on how much each pixel is covered by glyphs.
+        GRAPHICS::Color Color = GRAPHICS::Color::WHITE;
     };
 }
 
@@ -0,0 +1,34 @@
+#if _WIN32
+
+#include <algorithm>
+#include "Graphics/Gui/TextLayout.h"
+
+namespace GRAPHICS::GUI
+{
+    /// Computes the layout for a string of text in the specified font.
+    /// @param[in]  string - The string of characters for the text.
+    /// @param[in]  font - The font in which the text will be rendered.
+    /// @return The layout of the text.
+    TextLayout TextLayout::Compute(const std::string& string, const Font& font)
+    {
+        // POSITION EACH GLYPH AFTER THE PREVIOUS ONE.
+        TextLayout layout;
+        layout.Glyphs.reserve(string.size());
+        for (char character : string)
+        {
+            const GUI::Glyph& glyph = font.GlyphsByCharacter[static_cast<unsigned char>(character)];
+            layout.Glyphs.emplace_back(PositionedGlyph
+            {
+                .Glyph = &glyph,
+                .LeftTopOffsetInPixels = MATH::Vector2ui(layout.WidthInPixels, 0),
+            });
+
+            layout.WidthInPixels += glyph.WidthInPixels;
+            layout.HeightInPixels = std::max(layout.HeightInPixels, glyph.HeightInPixels);
+        }
+
+        return layout;
+    }
+}
+
+#endif
@@ -0,0 +1,41 @@
+#pragma once
+
+#if _WIN32
+
+#include <string>
+#include <vector>
+#include "Graphics/Gui/Font.h"
+#include "Graphics/Gui/Glyph.h"
+#include "Math/Vector2.h"
+
+namespace GRAPHICS::GUI
+{
+    /// The positions of glyphs for rendering a string of text in a particular font.
+    /// Positions are relative to the left/top of the text so that layouts can be reused
+    /// regardless of where text is rendered on screen.
+    class TextLayout
+    {
+    public:
+        /// A glyph positioned within a text layout.
+        struct PositionedGlyph
+        {
+            /// The glyph to render.
+            const GUI::Glyph* Glyph = nullptr;
+            /// The left/top offset of the glyph from the left/top of the text, in pixels.
+            MATH::Vector2ui LeftTopOffsetInPixels = MATH::Vector2ui(0, 0);
+        };
+
+        // CONSTRUCTION.
+        static TextLayout Compute(const std::string& string, const Font& font);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The positioned glyphs for each character in the text, in order.
+        std::vector<PositionedGlyph> Glyphs = {};
+        /// The total width of the text, in pixels.
+        unsigned int WidthInPixels = 0;
+        /// The total height of the text, in pixels.
+        unsigned int HeightInPixels = 0;
+    };
+}
+
+#endif
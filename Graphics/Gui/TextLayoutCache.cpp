@@ -0,0 +1,42 @@
+#if _WIN32
+
+#include "Graphics/Gui/TextLayoutCache.h"
+
+namespace GRAPHICS::GUI
+{
+    /// Gets the layout for the specified text, computing it only if not already cached.
+    /// @param[in]  text - The text for which to get the layout.  Must have a font.
+    /// @return The layout for the text.  Only valid until the cache is next modified.
+    const TextLayout& TextLayoutCache::GetLayout(const Text& text)
+    {
+        // RETURN ANY ALREADY CACHED LAYOUT.
+        std::unordered_map<std::string, TextLayout>& layouts_by_string = LayoutsByFontAndString[text.Font];
+        auto cached_layout = layouts_by_string.find(text.String);
+        if (layouts_by_string.cend() != cached_layout)
+        {
+            return cached_layout->second;
+        }
+
+        // MAKE ROOM FOR THE NEW LAYOUT IF NEEDED.
+        bool cache_full = (LayoutCount >= MAX_CACHED_LAYOUT_COUNT);
+        if (cache_full)
+        {
+            Clear();
+        }
+
+        // CACHE THE NEW LAYOUT.
+        ++LayoutCount;
+        TextLayout& new_layout = LayoutsByFontAndString[text.Font][text.String];
+        new_layout = TextLayout::Compute(text.String, *text.Font);
+        return new_layout;
+    }
+
+    /// Removes all layouts from the cache.
+    void TextLayoutCache::Clear()
+    {
+        LayoutsByFontAndString.clear();
+        LayoutCount = 0;
+    }
+}
+
+#endif
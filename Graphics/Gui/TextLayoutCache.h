@@ -0,0 +1,36 @@
+#pragma once
+
+#if _WIN32
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include "Graphics/Gui/Font.h"
+#include "Graphics/Gui/Text.h"
+#include "Graphics/Gui/TextLayout.h"
+
+namespace GRAPHICS::GUI
+{
+    /// A cache of text layouts so that text re-rendered with the same strings (such as for HUDs)
+    /// doesn't need to be laid out again each frame.
+    class TextLayoutCache
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The maximum number of layouts to cache before the cache is cleared.
+        /// This prevents unbounded growth for frequently changing strings (such as counters).
+        static constexpr std::size_t MAX_CACHED_LAYOUT_COUNT = 1024;
+
+        // LAYOUT RETRIEVAL.
+        const TextLayout& GetLayout(const Text& text);
+        void Clear();
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The count of layouts currently in the cache.
+        std::size_t LayoutCount = 0;
+        /// The cached layouts, stored by font and then by string.
+        std::unordered_map<const Font*, std::unordered_map<std::string, TextLayout>> LayoutsByFontAndString = {};
+    };
+}
+
+#endif
@@ -1,9 +1,12 @@
+#include <algorithm>
 #include <fstream>
+#include <limits>
 #if _WIN32
 #include <Windows.h>
 #endif
 #include "stb/stb_image.h"
 #include "Graphics/Images/Bitmap.h"
+#include "Processor/SimdMemory.h"
 
 namespace GRAPHICS::IMAGES
 {
@@ -164,8 +167,13 @@ namespace GRAPHICS::IMAGES
         WidthInPixels(width_in_pixels),
         HeightInPixels(height_in_pixels),
         ColorFormat(color_format),
-        Pixels(width_in_pixels, height_in_pixels)
-    {}
+        Pixels(width_in_pixels, height_in_pixels),
+        FillColor(),
+        DirtyRectangles()
+    {
+        // The initial pixels aren't from any fill, so the entire bitmap is considered dirty.
+        MarkDirty(MATH::Rectangleui::FromLeftTopAndDimensions(0, 0, width_in_pixels, height_in_pixels));
+    }
 
     /// Gets the width of the bitmap.
     /// @return The width in pixels.
@@ -268,17 +276,102 @@ namespace GRAPHICS::IMAGES
         Pixels(x, y) = packed_color;
     }
 
+    /// Fills in color of the pixel at the specified coordinates and marks the pixel as dirty.
+    /// Drawing many pixels this way is slow, so callers drawing larger shapes should instead
+    /// mark the shape's bounds as dirty once and write pixels individually without marking them.
+    /// @param[in]  x - The horizontal coordinate of the pixel.
+    /// @param[in]  y - The vertical coorindate of the pixel.
+    /// @param[in]  color - The color to write to the pixel.
+    void Bitmap::WritePixelAndMarkDirty(const unsigned int x, const unsigned int y, const Color& color)
+    {
+        WritePixel(x, y, color);
+        MarkDirty(MATH::Rectangleui::FromLeftTopAndDimensions(x, y, 1, 1));
+    }
+
     /// Fills all pixels in the bitmap with the specified color.
     /// @param[in]  color - The color to fill all pixels.
     void Bitmap::FillPixels(const Color& color)
     {
+        // PACK THE COLOR ONLY ONCE.
+        uint32_t packed_color = color.Pack(ColorFormat);
+
         // FILL IN ALL PIXELS.
-        for (unsigned int y = 0; y < HeightInPixels; ++y)
+        std::size_t pixel_count = static_cast<std::size_t>(WidthInPixels) * HeightInPixels;
+        PROCESSOR::SimdMemory::Fill(Pixels.ValuesInRowMajorOrder(), pixel_count, packed_color);
+
+        // RESET DIRTY RECTANGLES SINCE ALL PIXELS ARE NOW A KNOWN COLOR.
+        FillColor = color;
+        DirtyRectangles.clear();
+    }
+
+    /// Gets the color the entire bitmap was last filled with.
+    /// All pixels outside of the dirty rectangles still have this color.
+    /// @return The last fill color; null if the bitmap hasn't been filled.
+    std::optional<Color> Bitmap::GetFillColor() const
+    {
+        return FillColor;
+    }
+
+    /// Gets rectangles containing all pixels written since the bitmap was last filled.
+    /// Rectangles may overlap and may include some unwritten pixels.
+    /// @return The dirty rectangles.
+    const std::vector<MATH::Rectangleui>& Bitmap::GetDirtyRectangles() const
+    {
+        return DirtyRectangles;
+    }
+
+    /// Marks a rectangle of pixels as having been written.  Individual pixel writes (other than through
+    /// WritePixelAndMarkDirty()) and writes through raw data don't mark pixels dirty, so drawing code
+    /// should mark the bounds of what it draws once rather than for each pixel.
+    /// @param[in]  rectangle - The rectangle of written pixels.  Clipped to the bitmap.
+    void Bitmap::MarkDirty(const MATH::Rectangleui& rectangle)
+    {
+        // CLIP THE RECTANGLE TO THE BITMAP.
+        MATH::Rectangleui bitmap_rectangle = MATH::Rectangleui::FromLeftTopAndDimensions(0, 0, WidthInPixels, HeightInPixels);
+        MATH::Rectangleui clipped_rectangle = MATH::Rectangleui::Intersection(rectangle, bitmap_rectangle);
+        if (clipped_rectangle.IsEmpty())
+        {
+            return;
+        }
+
+        // SKIP RECTANGLES THAT ARE ALREADY DIRTY.
+        // Recently added rectangles are the most likely to contain new rectangles, so they're checked first.
+        for (auto dirty_rectangle = DirtyRectangles.crbegin(); dirty_rectangle != DirtyRectangles.crend(); ++dirty_rectangle)
+        {
+            if (dirty_rectangle->Contains(clipped_rectangle))
+            {
+                return;
+            }
+        }
+
+        // ADD THE RECTANGLE IF THERE'S ROOM.
+        if (DirtyRectangles.size() < MAX_DIRTY_RECTANGLE_COUNT)
+        {
+            DirtyRectangles.emplace_back(clipped_rectangle);
+            return;
+        }
+
+        // MERGE THE RECTANGLE INTO WHICHEVER EXISTING RECTANGLE GROWS THE LEAST.
+        // This keeps the number of rectangles bounded while covering as few extra pixels as possible.
+        std::size_t closest_rectangle_index = 0;
+        unsigned int smallest_area_increase = std::numeric_limits<unsigned int>::max();
+        for (std::size_t rectangle_index = 0; rectangle_index < DirtyRectangles.size(); ++rectangle_index)
         {
-            for (unsigned int x = 0; x < WidthInPixels; ++x)
+            const MATH::Rectangleui& dirty_rectangle = DirtyRectangles[rectangle_index];
+            unsigned int area_increase = MATH::Rectangleui::Union(dirty_rectangle, clipped_rectangle).Area() - dirty_rectangle.Area();
+            if (area_increase < smallest_area_increase)
             {
-                WritePixel(x, y, color);
+                closest_rectangle_index = rectangle_index;
+                smallest_area_increase = area_increase;
             }
         }
+        DirtyRectangles[closest_rectangle_index] = MATH::Rectangleui::Union(DirtyRectangles[closest_rectangle_index], clipped_rectangle);
+
+        // MOVE THE MERGED RECTANGLE TO THE END.
+        // This makes it the first to be checked for containing the next rectangle, which often is nearby.
+        std::rotate(
+            DirtyRectangles.begin() + closest_rectangle_index,
+            DirtyRectangles.begin() + closest_rectangle_index + 1,
+            DirtyRectangles.end());
     }
 }
@@ -3,9 +3,12 @@
 #include <cstdint>
 #include <filesystem>
 #include <memory>
+#include <optional>
+#include <vector>
 #include "Containers/Array2D.h"
 #include "Graphics/Color.h"
 #include "Graphics/ColorFormat.h"
+#include "Math/Rectangle.h"
 
 /// Holds computer graphics code related to images (specifically different image file formats).
 namespace GRAPHICS::IMAGES
@@ -20,9 +23,15 @@ namespace GRAPHICS::IMAGES
     /// - 32 bits per pixel.
     /// - Each pixel stores colors in the following format
     ///   (assumes a little-endian architecture): 0xRRGGBBAA.
+    /// - Dirty rectangles of pixels written since the bitmap was last filled with a single color
+    ///   are tracked so that only changed regions need to be displayed.
     class Bitmap
     {
     public:
+        // STATIC CONSTANTS.
+        /// The maximum number of dirty rectangles tracked before rectangles are merged together.
+        static constexpr std::size_t MAX_DIRTY_RECTANGLE_COUNT = 8;
+
         // CONSTRUCTION/DESTRUCTION.
 #if _WIN32
         static std::shared_ptr<Bitmap> Load(const std::filesystem::path& filepath);
@@ -47,8 +56,14 @@ namespace GRAPHICS::IMAGES
         // DRAWING.
         void WritePixel(const unsigned int x, const unsigned int y, const uint32_t& color);
         void WritePixel(const unsigned int x, const unsigned int y, const Color& color);
+        void WritePixelAndMarkDirty(const unsigned int x, const unsigned int y, const Color& color);
         void FillPixels(const Color& color);
 
+        // DIRTY RECTANGLE TRACKING.
+        std::optional<Color> GetFillColor() const;
+        const std::vector<MATH::Rectangleui>& GetDirtyRectangles() const;
+        void MarkDirty(const MATH::Rectangleui& rectangle);
+
     private:
         // MEMBER VARIABLES.
         /// The width of the bitmap in pixels.
@@ -61,5 +76,10 @@ namespace GRAPHICS::IMAGES
         /// The top-left corner pixel is at (0,0), and 
         /// the bottom-right corner pixel is at (width-1, height-1). 
         CONTAINERS::Array2D<uint32_t> Pixels;
+        /// The color the entire bitmap was last filled with, if known.
+        std::optional<Color> FillColor;
+        /// Rectangles containing all pixels written since the bitmap was last filled.
+        /// Writing individual pixels or through raw data requires marking the written rectangles as dirty.
+        std::vector<MATH::Rectangleui> DirtyRectangles;
     };
 }
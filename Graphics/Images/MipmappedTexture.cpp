@@ -0,0 +1,208 @@
+#include <algorithm>
+#include "ErrorHandling/Asserts.h"
+#include "Graphics/Images/MipmappedTexture.h"
+
+namespace GRAPHICS::IMAGES
+{
+    /// Creates a mipmapped texture by precomputing all mipmap levels from a full-resolution bitmap.
+    /// Each texel in a smaller level is the average of a 2x2 block of texels in the previous level.
+    /// @param[in]  base_level - The full-resolution bitmap for the texture.
+    /// @param[in]  memory_layout - The arrangement of texels in memory for the texture.
+    /// @return The mipmapped texture, if successfully created; null otherwise.
+    std::shared_ptr<MipmappedTexture> MipmappedTexture::Create(const Bitmap& base_level, const TextureMemoryLayout memory_layout)
+    {
+        // MAKE SURE THE BITMAP HAS TEXELS.
+        uint32_t base_width_in_pixels = base_level.GetWidthInPixels();
+        uint32_t base_height_in_pixels = base_level.GetHeightInPixels();
+        bool base_level_has_texels = (base_width_in_pixels > 0) && (base_height_in_pixels > 0);
+        ASSERT_THEN_IF_NOT(base_level_has_texels)
+        {
+            return nullptr;
+        }
+
+        // DETERMINE THE SIZE OF ALL LEVELS.
+        // This allows memory for all levels to be allocated at once.
+        auto texture = std::make_shared<MipmappedTexture>();
+        texture->ColorFormat = base_level.GetColorFormat();
+        texture->MemoryLayout = memory_layout;
+        uint32_t tile_dimension_in_pixels = (1u << texture->GetTileDimensionBitShift());
+        uint32_t level_width_in_pixels = base_width_in_pixels;
+        uint32_t level_height_in_pixels = base_height_in_pixels;
+        uint32_t level_first_texel_index = 0;
+        while (texture->Levels.size() < MAX_LEVEL_COUNT)
+        {
+            // ADD THE CURRENT LEVEL.
+            // Levels are padded to whole tiles so that every tile can be addressed the same way.
+            uint32_t padded_width_in_pixels = ((level_width_in_pixels + tile_dimension_in_pixels - 1) / tile_dimension_in_pixels) * tile_dimension_in_pixels;
+            uint32_t padded_height_in_pixels = ((level_height_in_pixels + tile_dimension_in_pixels - 1) / tile_dimension_in_pixels) * tile_dimension_in_pixels;
+            MipmapLevel level =
+            {
+                .WidthInPixels = level_width_in_pixels,
+                .HeightInPixels = level_height_in_pixels,
+                .FirstTexelIndex = level_first_texel_index,
+                .TileRowTexelCount = padded_width_in_pixels * tile_dimension_in_pixels,
+            };
+            texture->Levels.push_back(level);
+            level_first_texel_index += padded_width_in_pixels * padded_height_in_pixels;
+
+            // STOP ONCE THE SMALLEST POSSIBLE LEVEL HAS BEEN ADDED.
+            bool smallest_level_added = (level_width_in_pixels <= 1) && (level_height_in_pixels <= 1);
+            if (smallest_level_added)
+            {
+                break;
+            }
+
+            level_width_in_pixels = std::max<uint32_t>(1, level_width_in_pixels / 2);
+            level_height_in_pixels = std::max<uint32_t>(1, level_height_in_pixels / 2);
+        }
+        std::size_t total_texel_count = level_first_texel_index;
+        texture->Texels.resize(total_texel_count);
+
+        // COPY THE FULL-RESOLUTION LEVEL.
+        // Texels are copied individually since the texture's layout may differ from the bitmap's.
+        const uint32_t* base_level_texels = base_level.GetRawData();
+        for (unsigned int y = 0; y < base_height_in_pixels; ++y)
+        {
+            for (unsigned int x = 0; x < base_width_in_pixels; ++x)
+            {
+                std::size_t base_level_texel_index = static_cast<std::size_t>(y) * base_width_in_pixels + x;
+                std::size_t texel_index = texture->GetTexelIndex(0, x, y);
+                texture->Texels[texel_index] = base_level_texels[base_level_texel_index];
+            }
+        }
+
+        // COMPUTE EACH SMALLER LEVEL FROM THE PREVIOUS LEVEL.
+        for (std::size_t level_index = 1; level_index < texture->Levels.size(); ++level_index)
+        {
+            const MipmapLevel& previous_level = texture->Levels[level_index - 1];
+            const MipmapLevel& level = texture->Levels[level_index];
+            for (unsigned int y = 0; y < level.HeightInPixels; ++y)
+            {
+                // Odd-sized levels clamp to the last row or column of the previous level.
+                unsigned int top_source_y = std::min(2 * y, previous_level.HeightInPixels - 1);
+                unsigned int bottom_source_y = std::min(2 * y + 1, previous_level.HeightInPixels - 1);
+                for (unsigned int x = 0; x < level.WidthInPixels; ++x)
+                {
+                    // GET THE 2x2 BLOCK OF TEXELS FROM THE PREVIOUS LEVEL.
+                    unsigned int left_source_x = std::min(2 * x, previous_level.WidthInPixels - 1);
+                    unsigned int right_source_x = std::min(2 * x + 1, previous_level.WidthInPixels - 1);
+                    uint32_t top_left_texel = texture->GetTexel(level_index - 1, left_source_x, top_source_y);
+                    uint32_t top_right_texel = texture->GetTexel(level_index - 1, right_source_x, top_source_y);
+                    uint32_t bottom_left_texel = texture->GetTexel(level_index - 1, left_source_x, bottom_source_y);
+                    uint32_t bottom_right_texel = texture->GetTexel(level_index - 1, right_source_x, bottom_source_y);
+
+                    // AVERAGE EACH 8-BIT COMPONENT OF THE TEXELS.
+                    // Since each component is averaged the same way, this works regardless of color format.
+                    // Half of the texel count is added before dividing to round to the nearest integer.
+                    constexpr uint32_t COMPONENT_BIT_COUNT = 8;
+                    constexpr uint32_t COMPONENT_BYTE_MASK = 0xFF;
+                    constexpr uint32_t SOURCE_TEXEL_COUNT = 4;
+                    uint32_t averaged_texel = 0;
+                    for (uint32_t bit_shift = 0; bit_shift < sizeof(uint32_t) * COMPONENT_BIT_COUNT; bit_shift += COMPONENT_BIT_COUNT)
+                    {
+                        uint32_t component_sum = (
+                            ((top_left_texel >> bit_shift) & COMPONENT_BYTE_MASK) +
+                            ((top_right_texel >> bit_shift) & COMPONENT_BYTE_MASK) +
+                            ((bottom_left_texel >> bit_shift) & COMPONENT_BYTE_MASK) +
+                            ((bottom_right_texel >> bit_shift) & COMPONENT_BYTE_MASK));
+                        uint32_t averaged_component = (component_sum + SOURCE_TEXEL_COUNT / 2) / SOURCE_TEXEL_COUNT;
+                        averaged_texel |= (averaged_component << bit_shift);
+                    }
+
+                    std::size_t texel_index = texture->GetTexelIndex(level_index, x, y);
+                    texture->Texels[texel_index] = averaged_texel;
+                }
+            }
+        }
+
+        return texture;
+    }
+
+    /// Gets the color format of texels in the texture.
+    /// @return The color format of the texture.
+    ColorFormat MipmappedTexture::GetColorFormat() const
+    {
+        return ColorFormat;
+    }
+
+    /// Gets the arrangement of texels in memory for the texture.
+    /// @return The memory layout of the texture.
+    TextureMemoryLayout MipmappedTexture::GetMemoryLayout() const
+    {
+        return MemoryLayout;
+    }
+
+    /// Gets the base-2 logarithm of the width/height of tiles in the texture's memory layout.
+    /// Row-major layouts are treated as having 1x1 tiles, which allows all layouts to be addressed the same way.
+    /// @return The number of bits to shift texel coordinates by to get tile coordinates.
+    uint32_t MipmappedTexture::GetTileDimensionBitShift() const
+    {
+        switch (MemoryLayout)
+        {
+            case TextureMemoryLayout::TILED_4X4:
+                return 2;
+            case TextureMemoryLayout::ROW_MAJOR:
+            default:
+                return 0;
+        }
+    }
+
+    /// Gets the number of mipmap levels in the texture.
+    /// @return The number of levels, including the full-resolution level.
+    std::size_t MipmappedTexture::GetLevelCount() const
+    {
+        return Levels.size();
+    }
+
+    /// Gets information about a single mipmap level.
+    /// @param[in]  level_index - The index of the level to get (0 being the full-resolution level).
+    ///     Must be less than the level count.
+    /// @return The requested level.
+    const MipmapLevel& MipmappedTexture::GetLevel(const std::size_t level_index) const
+    {
+        return Levels.at(level_index);
+    }
+
+    /// Gets information about all mipmap levels.
+    /// @return All levels, from the full-resolution level to the smallest.
+    const std::vector<MipmapLevel>& MipmappedTexture::GetLevels() const
+    {
+        return Levels;
+    }
+
+    /// Retrieves a pointer to the raw texels for all levels, with each level stored according to the
+    /// texture's memory layout starting at its first texel index.
+    /// @return A pointer to the raw texels.
+    const uint32_t* MipmappedTexture::GetRawData() const
+    {
+        return Texels.data();
+    }
+
+    /// Gets the index of a single texel within the raw texels of the texture.
+    /// @param[in]  level_index - The index of the level containing the texel.  Must be less than the level count.
+    /// @param[in]  x - The horizontal coordinate of the texel in the level.  Must be less than the level's width.
+    /// @param[in]  y - The vertical coordinate of the texel in the level.  Must be less than the level's height.
+    /// @return The index of the texel.
+    std::size_t MipmappedTexture::GetTexelIndex(const std::size_t level_index, const unsigned int x, const unsigned int y) const
+    {
+        const MipmapLevel& level = Levels[level_index];
+        uint32_t tile_dimension_bit_shift = GetTileDimensionBitShift();
+        uint32_t tile_dimension_mask = (1u << tile_dimension_bit_shift) - 1;
+        std::size_t tile_row_offset = static_cast<std::size_t>(y >> tile_dimension_bit_shift) * level.TileRowTexelCount;
+        std::size_t tile_offset = static_cast<std::size_t>(x >> tile_dimension_bit_shift) << (2 * tile_dimension_bit_shift);
+        std::size_t offset_within_tile = ((y & tile_dimension_mask) << tile_dimension_bit_shift) + (x & tile_dimension_mask);
+        std::size_t texel_index = level.FirstTexelIndex + tile_row_offset + tile_offset + offset_within_tile;
+        return texel_index;
+    }
+
+    /// Gets a single texel from the texture.
+    /// @param[in]  level_index - The index of the level from which to get the texel.  Must be less than the level count.
+    /// @param[in]  x - The horizontal coordinate of the texel in the level.  Must be less than the level's width.
+    /// @param[in]  y - The vertical coordinate of the texel in the level.  Must be less than the level's height.
+    /// @return The texel, packed according to the texture's color format.
+    uint32_t MipmappedTexture::GetTexel(const std::size_t level_index, const unsigned int x, const unsigned int y) const
+    {
+        std::size_t texel_index = GetTexelIndex(level_index, x, y);
+        return Texels[texel_index];
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Graphics/Color.h"
+#include "Graphics/ColorFormat.h"
+#include "Graphics/Images/Bitmap.h"
+#include "Graphics/TextureMemoryLayout.h"
+
+namespace GRAPHICS::IMAGES
+{
+    /// A single level within a mipmapped texture.
+    /// All fields are 32-bit to allow SIMD code to gather them for different levels at once.
+    struct MipmapLevel
+    {
+        /// The width of the level in pixels.
+        uint32_t WidthInPixels = 0;
+        /// The height of the level in pixels.
+        uint32_t HeightInPixels = 0;
+        /// The index of the level's top-left texel within all texels of the texture.
+        uint32_t FirstTexelIndex = 0;
+        /// The number of texels stored for each row of tiles in the level.
+        /// For row-major layouts (where tiles are single texels), this is just the width of the level.
+        /// For tiled layouts, this includes any padding for partial tiles on the right edge of the level.
+        uint32_t TileRowTexelCount = 0;
+    };
+
+    /// A texture with a precomputed chain of mipmaps (https://en.wikipedia.org/wiki/Mipmap).
+    /// Each level is half the size (rounded down, but at least 1 pixel) of the previous level in each dimension,
+    /// down to a final 1x1 level.  Using smaller levels for textures covering small areas of the screen
+    /// reduces aliasing and keeps texel reads closer together in memory.
+    ///
+    /// Texels for all levels are stored contiguously (from the largest level to the smallest),
+    /// which allows texels from different levels to be looked up using offsets from a single address.
+    /// Within each level, texels are arranged according to the texture's memory layout.  For tiled layouts,
+    /// each level is padded to a whole number of tiles, with padding texels never being read.
+    ///
+    /// The texel index for any layout can be computed without branching as:
+    ///     FirstTexelIndex + (y >> shift) * TileRowTexelCount + ((x >> shift) << (2 * shift)) + ((y & mask) << shift) + (x & mask)
+    /// where shift is the tile dimension bit shift and mask is the tile dimension minus 1.
+    class MipmappedTexture
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The maximum number of mipmap levels a texture can have.
+        /// This is enough for a texture with 32-bit dimensions.
+        static constexpr std::size_t MAX_LEVEL_COUNT = 32;
+
+        // CONSTRUCTION.
+        static std::shared_ptr<MipmappedTexture> Create(const Bitmap& base_level, const TextureMemoryLayout memory_layout);
+
+        // ACCESSORS.
+        ColorFormat GetColorFormat() const;
+        TextureMemoryLayout GetMemoryLayout() const;
+        uint32_t GetTileDimensionBitShift() const;
+        std::size_t GetLevelCount() const;
+        const MipmapLevel& GetLevel(const std::size_t level_index) const;
+        const std::vector<MipmapLevel>& GetLevels() const;
+        const uint32_t* GetRawData() const;
+        std::size_t GetTexelIndex(const std::size_t level_index, const unsigned int x, const unsigned int y) const;
+        uint32_t GetTexel(const std::size_t level_index, const unsigned int x, const unsigned int y) const;
+
+    private:
+        // MEMBER VARIABLES.
+        /// The color format of texels in the texture.
+        GRAPHICS::ColorFormat ColorFormat = GRAPHICS::ColorFormat::RGBA;
+        /// The arrangement of texels in memory within each level.
+        TextureMemoryLayout MemoryLayout = TextureMemoryLayout::ROW_MAJOR;
+        /// The levels of the texture, from the full-resolution level to the smallest.
+        std::vector<MipmapLevel> Levels = {};
+        /// The texels for all levels, arranged according to the memory layout within each level.
+        std::vector<uint32_t> Texels = {};
+    };
+}
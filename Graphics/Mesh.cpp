@@ -0,0 +1,168 @@
+#include <algorithm>
+#include "Graphics/Mesh.h"
+
+namespace GRAPHICS
+{
+    /// Determines if the mesh is stored in indexed form.
+    /// @return True if the mesh has indexed vertices; false if it uses standalone triangles.
+    bool Mesh::IsIndexed() const
+    {
+        bool indices_exist = !Indices.empty();
+        return indices_exist;
+    }
+
+    /// Gets the number of triangles in the mesh, regardless of how it is stored.
+    /// @return The number of triangles in the mesh.
+    std::size_t Mesh::TriangleCount() const
+    {
+        if (IsIndexed())
+        {
+            std::size_t triangle_count = Indices.size() / GEOMETRY::Triangle::VERTEX_COUNT;
+            return triangle_count;
+        }
+        else
+        {
+            return Triangles.size();
+        }
+    }
+
+    /// Gets a single triangle from the mesh, regardless of how it is stored.
+    /// @param[in]  triangle_index - The index of the triangle to get.  Must be less than the triangle count.
+    /// @return The triangle at the specified index.
+    GEOMETRY::Triangle Mesh::GetTriangle(const std::size_t triangle_index) const
+    {
+        // RETURN THE STANDALONE TRIANGLE IF THE MESH ISN'T INDEXED.
+        if (!IsIndexed())
+        {
+            return Triangles.at(triangle_index);
+        }
+
+        // GATHER THE VERTICES FOR THE TRIANGLE.
+        GEOMETRY::Triangle triangle;
+        std::size_t first_index_index = triangle_index * GEOMETRY::Triangle::VERTEX_COUNT;
+        for (std::size_t vertex_index = 0; vertex_index < GEOMETRY::Triangle::VERTEX_COUNT; ++vertex_index)
+        {
+            uint32_t mesh_vertex_index = Indices.at(first_index_index + vertex_index);
+            triangle.Vertices[vertex_index] = Vertices.at(mesh_vertex_index);
+        }
+
+        // FIND THE MATERIAL FOR THE TRIANGLE.
+        for (const MeshSubset& subset : Subsets)
+        {
+            std::size_t subset_end_index = static_cast<std::size_t>(subset.FirstIndex) + subset.IndexCount;
+            bool triangle_in_subset = (subset.FirstIndex <= first_index_index) && (first_index_index < subset_end_index);
+            if (triangle_in_subset)
+            {
+                triangle.Material = subset.Material;
+                break;
+            }
+        }
+
+        return triangle;
+    }
+
+    /// Gets all triangles in the mesh as standalone triangles, regardless of how the mesh is stored.
+    /// This is primarily intended for code that has not been updated to work with indexed meshes
+    /// since it involves copying vertices for each triangle.
+    /// @return All triangles in the mesh.
+    std::vector<GEOMETRY::Triangle> Mesh::GetTriangles() const
+    {
+        // RETURN THE STANDALONE TRIANGLES IF THE MESH ISN'T INDEXED.
+        if (!IsIndexed())
+        {
+            return Triangles;
+        }
+
+        // GET EACH TRIANGLE FROM THE INDEXED DATA.
+        std::vector<GEOMETRY::Triangle> triangles;
+        std::size_t triangle_count = TriangleCount();
+        triangles.reserve(triangle_count);
+        for (std::size_t triangle_index = 0; triangle_index < triangle_count; ++triangle_index)
+        {
+            GEOMETRY::Triangle triangle = GetTriangle(triangle_index);
+            triangles.emplace_back(triangle);
+        }
+
+        return triangles;
+    }
+
+    /// Gets the number of levels of detail for the mesh, including the mesh itself.
+    /// @return The number of levels of detail.
+    std::size_t Mesh::LevelOfDetailCount() const
+    {
+        std::size_t level_of_detail_count = 1 + LevelsOfDetail.size();
+        return level_of_detail_count;
+    }
+
+    /// Gets a specific level of detail for the mesh.
+    /// @param[in]  level_of_detail_index - The index of the level of detail to get, with 0 being this mesh.
+    ///     Indices beyond the available levels are clamped to the least detailed level.
+    /// @return The mesh for the level of detail.
+    const Mesh& Mesh::GetLevelOfDetail(const std::size_t level_of_detail_index) const
+    {
+        // RETURN THIS MESH IF NO SIMPLIFIED LEVEL IS REQUESTED OR AVAILABLE.
+        if (0 == level_of_detail_index || LevelsOfDetail.empty())
+        {
+            return *this;
+        }
+
+        // RETURN THE SIMPLIFIED LEVEL OF DETAIL.
+        std::size_t simplified_level_index = std::min(level_of_detail_index, LevelsOfDetail.size()) - 1;
+        return LevelsOfDetail[simplified_level_index];
+    }
+
+    /// Computes a sphere enclosing all vertices of the mesh.
+    /// The sphere is centered on the mesh's bounding box, which is quick to compute and reasonably tight for most meshes.
+    void Mesh::ComputeBoundingSphere()
+    {
+        // GATHER ALL VERTEX POSITIONS.
+        std::vector<MATH::Vector3f> vertex_positions;
+        if (IsIndexed())
+        {
+            for (const VertexWithAttributes& vertex : Vertices)
+            {
+                vertex_positions.emplace_back(vertex.Position);
+            }
+        }
+        else
+        {
+            for (const GEOMETRY::Triangle& triangle : Triangles)
+            {
+                for (const VertexWithAttributes& vertex : triangle.Vertices)
+                {
+                    vertex_positions.emplace_back(vertex.Position);
+                }
+            }
+        }
+
+        // HANDLE EMPTY MESHES.
+        if (vertex_positions.empty())
+        {
+            BoundingSphereCenter = MATH::Vector3f(0.0f, 0.0f, 0.0f);
+            BoundingSphereRadius = 0.0f;
+            return;
+        }
+
+        // COMPUTE THE CENTER OF THE BOUNDING BOX.
+        MATH::Vector3f min_position = vertex_positions.front();
+        MATH::Vector3f max_position = vertex_positions.front();
+        for (const MATH::Vector3f& vertex_position : vertex_positions)
+        {
+            min_position.X = std::min(min_position.X, vertex_position.X);
+            min_position.Y = std::min(min_position.Y, vertex_position.Y);
+            min_position.Z = std::min(min_position.Z, vertex_position.Z);
+            max_position.X = std::max(max_position.X, vertex_position.X);
+            max_position.Y = std::max(max_position.Y, vertex_position.Y);
+            max_position.Z = std::max(max_position.Z, vertex_position.Z);
+        }
+        BoundingSphereCenter = MATH::Vector3f::Scale(0.5f, min_position + max_position);
+
+        // COMPUTE THE RADIUS TO INCLUDE THE FARTHEST VERTEX.
+        BoundingSphereRadius = 0.0f;
+        for (const MATH::Vector3f& vertex_position : vertex_positions)
+        {
+            float distance_from_center = (vertex_position - BoundingSphereCenter).Length();
+            BoundingSphereRadius = std::max(BoundingSphereRadius, distance_from_center);
+        }
+    }
+}
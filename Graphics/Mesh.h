@@ -1,20 +1,57 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include "Graphics/Geometry/Triangle.h"
+#include "Graphics/MeshSubset.h"
+#include "Graphics/VertexWithAttributes.h"
+#include "Math/Vector3.h"
 
 namespace GRAPHICS
 {
     /// A triangle mesh (https://en.wikipedia.org/wiki/Triangle_mesh).
+    ///
+    /// A mesh may be stored in one of two forms:
+    /// - As a list of standalone triangles, each with its own copies of vertices and material.
+    /// - As an indexed mesh, where unique vertices are stored once and triangles are formed
+    ///     from groups of 3 indices into those vertices, with materials assigned per subset.
+    /// The indexed form is used if any indices exist; otherwise, the standalone triangles are used.
     class Mesh
     {
     public:
+        // INDEXED TRIANGLE ACCESS.
+        bool IsIndexed() const;
+        std::size_t TriangleCount() const;
+        GEOMETRY::Triangle GetTriangle(const std::size_t triangle_index) const;
+        std::vector<GEOMETRY::Triangle> GetTriangles() const;
+
+        // LEVELS OF DETAIL.
+        std::size_t LevelOfDetailCount() const;
+        const Mesh& GetLevelOfDetail(const std::size_t level_of_detail_index) const;
+        void ComputeBoundingSphere();
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The name of the mesh.
         std::string Name = "";
         /// True if the mesh should be rendered; false if not.
         bool Visible = true;
         /// The triangles that make up this mesh, in the local coordinate space of the mesh.
+        /// Only used for non-indexed meshes.
         std::vector<GEOMETRY::Triangle> Triangles = {};
+        /// The unique vertices of an indexed mesh, in the local coordinate space of the mesh.
+        std::vector<VertexWithAttributes> Vertices = {};
+        /// Indices into the vertices for an indexed mesh, with every 3 indices forming a triangle.
+        std::vector<uint32_t> Indices = {};
+        /// Ranges of indices with the materials to use for them.
+        std::vector<MeshSubset> Subsets = {};
+        /// Progressively simplified versions of this mesh for rendering when it covers less of the screen.
+        /// This mesh itself is level 0, so the first of these is level 1.
+        std::vector<Mesh> LevelsOfDetail = {};
+        /// The center of a sphere enclosing the mesh, in the local coordinate space of the mesh.
+        MATH::Vector3f BoundingSphereCenter = MATH::Vector3f(0.0f, 0.0f, 0.0f);
+        /// The radius of a sphere enclosing the mesh.
+        float BoundingSphereRadius = 0.0f;
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include "Graphics/Material.h"
+
+namespace GRAPHICS
+{
+    /// A contiguous range of indices in an indexed mesh that share the same material.
+    /// This allows a material to be stored once per range rather than once per triangle.
+    class MeshSubset
+    {
+    public:
+        /// Default comparison operator.
+        auto operator<=>(const MeshSubset&) const = default;
+
+        /// The index (into the mesh's index array) of the first index in this subset.
+        uint32_t FirstIndex = 0;
+        /// The number of indices in this subset.  Should be a multiple of 3 since indices form triangles.
+        uint32_t IndexCount = 0;
+        /// The material for all triangles in this subset.
+        std::shared_ptr<GRAPHICS::Material> Material = nullptr;
+    };
+}
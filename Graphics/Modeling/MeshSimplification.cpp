@@ -0,0 +1,569 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+#include "Graphics/Modeling/MeshSimplification.h"
+
+namespace GRAPHICS::MODELING
+{
+    /// Simplifies a mesh down to approximately the target number of triangles.
+    /// Fewer triangles may remain if the mesh can't be simplified further without flipping triangles.
+    /// @param[in]  mesh - The mesh to simplify.  May be indexed or non-indexed.
+    /// @param[in]  target_triangle_count - The number of triangles to simplify down to.
+    /// @return The simplified mesh, in indexed form with one subset per original subset or material.
+    Mesh MeshSimplification::Simplify(const Mesh& mesh, const std::size_t target_triangle_count)
+    {
+        // GATHER THE TRIANGLES AND MATERIALS OF THE MESH.
+        // Triangles are tracked by the subset they belong to so that each material can
+        // remain in its own subset of the simplified mesh.
+        std::vector<VertexWithAttributes> original_vertices;
+        std::vector<std::array<uint32_t, GEOMETRY::Triangle::VERTEX_COUNT>> original_triangle_vertex_indices;
+        std::vector<std::size_t> triangle_subset_indices;
+        std::vector<std::shared_ptr<Material>> subset_materials;
+        if (mesh.IsIndexed())
+        {
+            original_vertices = mesh.Vertices;
+
+            // Only triangles in subsets are rendered, so any other indices are ignored.
+            for (const MeshSubset& subset : mesh.Subsets)
+            {
+                std::size_t subset_index = subset_materials.size();
+                subset_materials.emplace_back(subset.Material);
+
+                std::size_t subset_end_index = static_cast<std::size_t>(subset.FirstIndex) + subset.IndexCount;
+                for (std::size_t first_index_index = subset.FirstIndex; first_index_index < subset_end_index; first_index_index += GEOMETRY::Triangle::VERTEX_COUNT)
+                {
+                    original_triangle_vertex_indices.push_back(
+                    {
+                        mesh.Indices[first_index_index],
+                        mesh.Indices[first_index_index + 1],
+                        mesh.Indices[first_index_index + 2],
+                    });
+                    triangle_subset_indices.push_back(subset_index);
+                }
+            }
+        }
+        else
+        {
+            std::unordered_map<const Material*, std::size_t> subset_indices_by_material;
+            for (const GEOMETRY::Triangle& triangle : mesh.Triangles)
+            {
+                auto [subset_index, subset_newly_added] = subset_indices_by_material.try_emplace(triangle.Material.get(), subset_materials.size());
+                if (subset_newly_added)
+                {
+                    subset_materials.emplace_back(triangle.Material);
+                }
+
+                uint32_t first_vertex_index = static_cast<uint32_t>(original_vertices.size());
+                original_vertices.insert(original_vertices.end(), triangle.Vertices.begin(), triangle.Vertices.end());
+                original_triangle_vertex_indices.push_back({ first_vertex_index, first_vertex_index + 1, first_vertex_index + 2 });
+                triangle_subset_indices.push_back(subset_index->second);
+            }
+        }
+
+        // MERGE IDENTICAL VERTICES.
+        // Standalone triangles have their own copies of shared vertices, so these are merged
+        // to allow the simplified mesh to store each unique vertex once.
+        std::vector<VertexWithAttributes> vertices;
+        std::vector<uint32_t> unique_vertex_indices_by_original_index(original_vertices.size());
+        std::map<std::array<float, 12>, uint32_t> unique_vertex_indices_by_attributes;
+        for (std::size_t original_vertex_index = 0; original_vertex_index < original_vertices.size(); ++original_vertex_index)
+        {
+            const VertexWithAttributes& vertex = original_vertices[original_vertex_index];
+            std::array<float, 12> vertex_attributes =
+            {
+                vertex.Position.X, vertex.Position.Y, vertex.Position.Z,
+                vertex.Color.Red, vertex.Color.Green, vertex.Color.Blue, vertex.Color.Alpha,
+                vertex.TextureCoordinates.X, vertex.TextureCoordinates.Y,
+                vertex.Normal.X, vertex.Normal.Y, vertex.Normal.Z,
+            };
+            auto [unique_vertex_index, vertex_newly_added] = unique_vertex_indices_by_attributes.try_emplace(
+                vertex_attributes,
+                static_cast<uint32_t>(vertices.size()));
+            if (vertex_newly_added)
+            {
+                vertices.emplace_back(vertex);
+            }
+            unique_vertex_indices_by_original_index[original_vertex_index] = unique_vertex_index->second;
+        }
+
+        std::size_t triangle_count = original_triangle_vertex_indices.size();
+        std::vector<std::array<uint32_t, GEOMETRY::Triangle::VERTEX_COUNT>> triangle_vertex_indices(triangle_count);
+        for (std::size_t triangle_index = 0; triangle_index < triangle_count; ++triangle_index)
+        {
+            for (std::size_t corner_index = 0; corner_index < GEOMETRY::Triangle::VERTEX_COUNT; ++corner_index)
+            {
+                uint32_t original_vertex_index = original_triangle_vertex_indices[triangle_index][corner_index];
+                triangle_vertex_indices[triangle_index][corner_index] = unique_vertex_indices_by_original_index[original_vertex_index];
+            }
+        }
+
+        // MERGE VERTICES AT THE SAME POSITION.
+        // Edges are collapsed between positions rather than vertices so that vertices which only
+        // differ in other attributes (like along texture seams) move together.
+        std::vector<MATH::Vector3f> positions;
+        std::vector<uint32_t> vertex_position_indices(vertices.size());
+        std::vector<std::vector<uint32_t>> vertex_indices_by_position;
+        std::map<std::tuple<float, float, float>, uint32_t> position_indices_by_coordinates;
+        for (std::size_t vertex_index = 0; vertex_index < vertices.size(); ++vertex_index)
+        {
+            const MATH::Vector3f& vertex_position = vertices[vertex_index].Position;
+            auto [position_index, position_newly_added] = position_indices_by_coordinates.try_emplace(
+                std::make_tuple(vertex_position.X, vertex_position.Y, vertex_position.Z),
+                static_cast<uint32_t>(positions.size()));
+            if (position_newly_added)
+            {
+                positions.emplace_back(vertex_position);
+                vertex_indices_by_position.emplace_back();
+            }
+            vertex_position_indices[vertex_index] = position_index->second;
+            vertex_indices_by_position[position_index->second].push_back(static_cast<uint32_t>(vertex_index));
+        }
+
+        // Each position points to the position it was collapsed onto, or itself if it still exists.
+        // Vertices similarly point to any vertex they were merged into.
+        std::vector<uint32_t> collapsed_position_indices(positions.size());
+        std::iota(collapsed_position_indices.begin(), collapsed_position_indices.end(), 0);
+        std::vector<uint32_t> merged_vertex_indices(vertices.size());
+        std::iota(merged_vertex_indices.begin(), merged_vertex_indices.end(), 0);
+        auto get_current_vertex_index = [&merged_vertex_indices](uint32_t vertex_index)
+        {
+            while (merged_vertex_indices[vertex_index] != vertex_index)
+            {
+                merged_vertex_indices[vertex_index] = merged_vertex_indices[merged_vertex_indices[vertex_index]];
+                vertex_index = merged_vertex_indices[vertex_index];
+            }
+            return vertex_index;
+        };
+        auto get_current_position_index = [&collapsed_position_indices](uint32_t position_index)
+        {
+            while (collapsed_position_indices[position_index] != position_index)
+            {
+                // Skipping over intermediate positions keeps chains of collapses short.
+                collapsed_position_indices[position_index] = collapsed_position_indices[collapsed_position_indices[position_index]];
+                position_index = collapsed_position_indices[position_index];
+            }
+            return position_index;
+        };
+        auto get_triangle_position_indices = [&](const std::size_t triangle_index)
+        {
+            std::array<uint32_t, GEOMETRY::Triangle::VERTEX_COUNT> triangle_position_indices;
+            for (std::size_t corner_index = 0; corner_index < GEOMETRY::Triangle::VERTEX_COUNT; ++corner_index)
+            {
+                uint32_t vertex_index = get_current_vertex_index(triangle_vertex_indices[triangle_index][corner_index]);
+                triangle_position_indices[corner_index] = get_current_position_index(vertex_position_indices[vertex_index]);
+            }
+            return triangle_position_indices;
+        };
+        auto compute_unnormalized_normal = [&positions](const std::array<uint32_t, GEOMETRY::Triangle::VERTEX_COUNT>& triangle_position_indices)
+        {
+            const MATH::Vector3f& first_position = positions[triangle_position_indices[0]];
+            MATH::Vector3f first_edge = positions[triangle_position_indices[1]] - first_position;
+            MATH::Vector3f second_edge = positions[triangle_position_indices[2]] - first_position;
+            MATH::Vector3f unnormalized_normal = MATH::Vector3f::CrossProduct(first_edge, second_edge);
+            return unnormalized_normal;
+        };
+
+        // COMPUTE THE ERROR QUADRICS FOR THE PLANES AROUND EACH POSITION.
+        std::vector<Quadric> quadrics(positions.size());
+        std::vector<std::vector<std::size_t>> triangle_indices_by_position(positions.size());
+        std::vector<bool> triangles_removed(triangle_count, false);
+        std::size_t remaining_triangle_count = triangle_count;
+        // Edges are keyed by their position indices, with the smaller index in the upper bits.
+        // The count of triangles using each edge is tracked along with the last such triangle.
+        std::unordered_map<uint64_t, std::pair<std::size_t, std::size_t>> triangle_counts_and_indices_by_edge;
+        for (std::size_t triangle_index = 0; triangle_index < triangle_count; ++triangle_index)
+        {
+            // REMOVE ANY TRIANGLES THAT ARE ALREADY DEGENERATE.
+            std::array<uint32_t, GEOMETRY::Triangle::VERTEX_COUNT> triangle_position_indices = get_triangle_position_indices(triangle_index);
+            bool triangle_degenerate = (
+                (triangle_position_indices[0] == triangle_position_indices[1]) ||
+                (triangle_position_indices[1] == triangle_position_indices[2]) ||
+                (triangle_position_indices[2] == triangle_position_indices[0]));
+            if (triangle_degenerate)
+            {
+                triangles_removed[triangle_index] = true;
+                --remaining_triangle_count;
+                continue;
+            }
+
+            // ADD THE PLANE OF THE TRIANGLE TO THE QUADRIC OF EACH CORNER.
+            // Planes are weighted by area so that tiny triangles don't dominate the error.
+            MATH::Vector3f unnormalized_normal = compute_unnormalized_normal(triangle_position_indices);
+            float twice_triangle_area = unnormalized_normal.Length();
+            if (twice_triangle_area > 0.0f)
+            {
+                MATH::Vector3f unit_normal = MATH::Vector3f::Scale(1.0f / twice_triangle_area, unnormalized_normal);
+                Quadric triangle_quadric = Quadric::FromPlane(unit_normal, positions[triangle_position_indices[0]], twice_triangle_area / 2.0);
+                for (uint32_t position_index : triangle_position_indices)
+                {
+                    quadrics[position_index] += triangle_quadric;
+                }
+            }
+
+            // TRACK WHICH TRIANGLES USE EACH POSITION AND EDGE.
+            for (std::size_t corner_index = 0; corner_index < GEOMETRY::Triangle::VERTEX_COUNT; ++corner_index)
+            {
+                uint64_t start_position_index = triangle_position_indices[corner_index];
+                uint64_t end_position_index = triangle_position_indices[(corner_index + 1) % GEOMETRY::Triangle::VERTEX_COUNT];
+                uint64_t edge_key = (std::min(start_position_index, end_position_index) << 32) | std::max(start_position_index, end_position_index);
+                auto& [edge_triangle_count, edge_triangle_index] = triangle_counts_and_indices_by_edge[edge_key];
+                ++edge_triangle_count;
+                edge_triangle_index = triangle_index;
+
+                triangle_indices_by_position[triangle_position_indices[corner_index]].push_back(triangle_index);
+            }
+        }
+
+        // ADD PLANES PERPENDICULAR TO OPEN BOUNDARY EDGES.
+        // Otherwise, boundary vertices could slide inward along the surface at no cost and shrink the mesh's outline.
+        constexpr double BOUNDARY_PLANE_WEIGHT = 10.0;
+        for (const auto& [edge_key, edge_triangle_count_and_index] : triangle_counts_and_indices_by_edge)
+        {
+            const auto& [edge_triangle_count, edge_triangle_index] = edge_triangle_count_and_index;
+            bool boundary_edge = (1 == edge_triangle_count);
+            if (!boundary_edge)
+            {
+                continue;
+            }
+
+            uint32_t start_position_index = static_cast<uint32_t>(edge_key >> 32);
+            uint32_t end_position_index = static_cast<uint32_t>(edge_key & UINT32_MAX);
+            MATH::Vector3f edge = positions[end_position_index] - positions[start_position_index];
+            MATH::Vector3f triangle_normal = compute_unnormalized_normal(get_triangle_position_indices(edge_triangle_index));
+            MATH::Vector3f boundary_normal = MATH::Vector3f::CrossProduct(edge, triangle_normal);
+            float boundary_normal_length = boundary_normal.Length();
+            if (boundary_normal_length <= 0.0f)
+            {
+                continue;
+            }
+
+            MATH::Vector3f unit_boundary_normal = MATH::Vector3f::Scale(1.0f / boundary_normal_length, boundary_normal);
+            double edge_length = edge.Length();
+            Quadric boundary_quadric = Quadric::FromPlane(
+                unit_boundary_normal,
+                positions[start_position_index],
+                BOUNDARY_PLANE_WEIGHT * edge_length * edge_length);
+            quadrics[start_position_index] += boundary_quadric;
+            quadrics[end_position_index] += boundary_quadric;
+        }
+
+        // QUEUE UP POSSIBLE EDGE COLLAPSES FROM CHEAPEST TO MOST EXPENSIVE.
+        // Versions of positions are incremented whenever their quadrics change so that any
+        // queued collapses with outdated costs can be skipped.
+        struct EdgeCollapse
+        {
+            double Cost = 0.0;
+            uint32_t RemovedPositionIndex = 0;
+            uint32_t KeptPositionIndex = 0;
+            uint32_t RemovedPositionVersion = 0;
+            uint32_t KeptPositionVersion = 0;
+        };
+        auto more_expensive = [](const EdgeCollapse& left_collapse, const EdgeCollapse& right_collapse)
+        {
+            return left_collapse.Cost > right_collapse.Cost;
+        };
+        std::priority_queue<EdgeCollapse, std::vector<EdgeCollapse>, decltype(more_expensive)> edge_collapses(more_expensive);
+        std::vector<uint32_t> position_versions(positions.size(), 0);
+        auto queue_edge_collapses = [&](const uint32_t first_position_index, const uint32_t second_position_index)
+        {
+            Quadric combined_quadric = quadrics[first_position_index];
+            combined_quadric += quadrics[second_position_index];
+
+            edge_collapses.push(EdgeCollapse
+            {
+                .Cost = combined_quadric.Evaluate(positions[second_position_index]),
+                .RemovedPositionIndex = first_position_index,
+                .KeptPositionIndex = second_position_index,
+                .RemovedPositionVersion = position_versions[first_position_index],
+                .KeptPositionVersion = position_versions[second_position_index],
+            });
+            edge_collapses.push(EdgeCollapse
+            {
+                .Cost = combined_quadric.Evaluate(positions[first_position_index]),
+                .RemovedPositionIndex = second_position_index,
+                .KeptPositionIndex = first_position_index,
+                .RemovedPositionVersion = position_versions[second_position_index],
+                .KeptPositionVersion = position_versions[first_position_index],
+            });
+        };
+        for (const auto& [edge_key, edge_triangle_count_and_index] : triangle_counts_and_indices_by_edge)
+        {
+            queue_edge_collapses(static_cast<uint32_t>(edge_key >> 32), static_cast<uint32_t>(edge_key & UINT32_MAX));
+        }
+
+        // COLLAPSE EDGES UNTIL ENOUGH TRIANGLES HAVE BEEN REMOVED.
+        while (remaining_triangle_count > target_triangle_count && !edge_collapses.empty())
+        {
+            EdgeCollapse edge_collapse = edge_collapses.top();
+            edge_collapses.pop();
+
+            // SKIP THE COLLAPSE IF IT'S OUTDATED.
+            uint32_t removed_position_index = edge_collapse.RemovedPositionIndex;
+            uint32_t kept_position_index = edge_collapse.KeptPositionIndex;
+            bool edge_collapse_outdated = (
+                (collapsed_position_indices[removed_position_index] != removed_position_index) ||
+                (collapsed_position_indices[kept_position_index] != kept_position_index) ||
+                (position_versions[removed_position_index] != edge_collapse.RemovedPositionVersion) ||
+                (position_versions[kept_position_index] != edge_collapse.KeptPositionVersion));
+            if (edge_collapse_outdated)
+            {
+                continue;
+            }
+
+            // SKIP THE COLLAPSE IF IT WOULD FLIP ANY REMAINING TRIANGLES.
+            // It may become valid later if nearby collapses change the surrounding triangles.
+            bool triangle_flipped = false;
+            for (std::size_t triangle_index : triangle_indices_by_position[removed_position_index])
+            {
+                // Triangles using the collapsed edge will be removed, so they can't flip.
+                std::array<uint32_t, GEOMETRY::Triangle::VERTEX_COUNT> triangle_position_indices = get_triangle_position_indices(triangle_index);
+                bool triangle_using_edge = (std::find(triangle_position_indices.begin(), triangle_position_indices.end(), kept_position_index) != triangle_position_indices.end());
+                if (triangles_removed[triangle_index] || triangle_using_edge)
+                {
+                    continue;
+                }
+
+                MATH::Vector3f old_normal = compute_unnormalized_normal(triangle_position_indices);
+                std::replace(triangle_position_indices.begin(), triangle_position_indices.end(), removed_position_index, kept_position_index);
+                MATH::Vector3f new_normal = compute_unnormalized_normal(triangle_position_indices);
+                bool old_triangle_has_area = (old_normal.Length() > 0.0f);
+                if (old_triangle_has_area && MATH::Vector3f::DotProduct(old_normal, new_normal) <= 0.0f)
+                {
+                    triangle_flipped = true;
+                    break;
+                }
+            }
+            if (triangle_flipped)
+            {
+                continue;
+            }
+
+            // COLLAPSE THE EDGE.
+            collapsed_position_indices[removed_position_index] = kept_position_index;
+
+            // Vertices are only merged if each position has a single vertex.  Otherwise, vertices of the
+            // removed position are just moved so that differing attributes along seams are preserved.
+            std::vector<uint32_t>& removed_vertex_indices = vertex_indices_by_position[removed_position_index];
+            std::vector<uint32_t>& kept_vertex_indices = vertex_indices_by_position[kept_position_index];
+            bool vertices_mergeable = (1 == removed_vertex_indices.size()) && (1 == kept_vertex_indices.size());
+            if (vertices_mergeable)
+            {
+                merged_vertex_indices[removed_vertex_indices.front()] = kept_vertex_indices.front();
+            }
+            else
+            {
+                kept_vertex_indices.insert(kept_vertex_indices.end(), removed_vertex_indices.begin(), removed_vertex_indices.end());
+            }
+            removed_vertex_indices.clear();
+
+            quadrics[kept_position_index] += quadrics[removed_position_index];
+            ++position_versions[kept_position_index];
+            for (std::size_t triangle_index : triangle_indices_by_position[removed_position_index])
+            {
+                if (triangles_removed[triangle_index])
+                {
+                    continue;
+                }
+
+                // REMOVE TRIANGLES THAT HAVE COLLAPSED TO A LINE.
+                std::array<uint32_t, GEOMETRY::Triangle::VERTEX_COUNT> triangle_position_indices = get_triangle_position_indices(triangle_index);
+                bool triangle_degenerate = (
+                    (triangle_position_indices[0] == triangle_position_indices[1]) ||
+                    (triangle_position_indices[1] == triangle_position_indices[2]) ||
+                    (triangle_position_indices[2] == triangle_position_indices[0]));
+                if (triangle_degenerate)
+                {
+                    triangles_removed[triangle_index] = true;
+                    --remaining_triangle_count;
+                }
+                else
+                {
+                    triangle_indices_by_position[kept_position_index].push_back(triangle_index);
+                }
+            }
+            triangle_indices_by_position[removed_position_index].clear();
+            std::erase_if(
+                triangle_indices_by_position[kept_position_index],
+                [&triangles_removed](const std::size_t triangle_index) { return triangles_removed[triangle_index]; });
+
+            // QUEUE UPDATED COLLAPSES FOR EDGES AROUND THE KEPT POSITION.
+            std::vector<uint32_t> neighbor_position_indices;
+            for (std::size_t triangle_index : triangle_indices_by_position[kept_position_index])
+            {
+                for (uint32_t position_index : get_triangle_position_indices(triangle_index))
+                {
+                    if (position_index != kept_position_index)
+                    {
+                        neighbor_position_indices.push_back(position_index);
+                    }
+                }
+            }
+            std::sort(neighbor_position_indices.begin(), neighbor_position_indices.end());
+            neighbor_position_indices.erase(std::unique(neighbor_position_indices.begin(), neighbor_position_indices.end()), neighbor_position_indices.end());
+            for (uint32_t neighbor_position_index : neighbor_position_indices)
+            {
+                queue_edge_collapses(neighbor_position_index, kept_position_index);
+            }
+        }
+
+        // BUILD THE SIMPLIFIED MESH.
+        // Vertices are moved to the positions they were collapsed onto, and only vertices
+        // still used by remaining triangles are kept.
+        Mesh simplified_mesh = { .Name = mesh.Name, .Visible = mesh.Visible };
+        simplified_mesh.BoundingSphereCenter = mesh.BoundingSphereCenter;
+        simplified_mesh.BoundingSphereRadius = mesh.BoundingSphereRadius;
+
+        std::vector<std::vector<std::size_t>> triangle_indices_by_subset(subset_materials.size());
+        for (std::size_t triangle_index = 0; triangle_index < triangle_count; ++triangle_index)
+        {
+            if (!triangles_removed[triangle_index])
+            {
+                triangle_indices_by_subset[triangle_subset_indices[triangle_index]].push_back(triangle_index);
+            }
+        }
+
+        constexpr uint32_t NO_SIMPLIFIED_VERTEX_INDEX = std::numeric_limits<uint32_t>::max();
+        std::vector<uint32_t> simplified_vertex_indices(vertices.size(), NO_SIMPLIFIED_VERTEX_INDEX);
+        for (std::size_t subset_index = 0; subset_index < subset_materials.size(); ++subset_index)
+        {
+            // SKIP SUBSETS WITH NO REMAINING TRIANGLES.
+            const std::vector<std::size_t>& subset_triangle_indices = triangle_indices_by_subset[subset_index];
+            if (subset_triangle_indices.empty())
+            {
+                continue;
+            }
+
+            // ADD THE REMAINING TRIANGLES OF THE SUBSET.
+            MeshSubset simplified_subset =
+            {
+                .FirstIndex = static_cast<uint32_t>(simplified_mesh.Indices.size()),
+                .Material = subset_materials[subset_index],
+            };
+            for (std::size_t triangle_index : subset_triangle_indices)
+            {
+                for (uint32_t triangle_vertex_index : triangle_vertex_indices[triangle_index])
+                {
+                    uint32_t vertex_index = get_current_vertex_index(triangle_vertex_index);
+                    uint32_t& simplified_vertex_index = simplified_vertex_indices[vertex_index];
+                    if (NO_SIMPLIFIED_VERTEX_INDEX == simplified_vertex_index)
+                    {
+                        simplified_vertex_index = static_cast<uint32_t>(simplified_mesh.Vertices.size());
+
+                        VertexWithAttributes simplified_vertex = vertices[vertex_index];
+                        simplified_vertex.Position = positions[get_current_position_index(vertex_position_indices[vertex_index])];
+                        simplified_mesh.Vertices.emplace_back(simplified_vertex);
+                    }
+                    simplified_mesh.Indices.push_back(simplified_vertex_index);
+                }
+            }
+            simplified_subset.IndexCount = static_cast<uint32_t>(simplified_mesh.Indices.size()) - simplified_subset.FirstIndex;
+            simplified_mesh.Subsets.emplace_back(simplified_subset);
+        }
+
+        return simplified_mesh;
+    }
+
+    /// Generates progressively simplified levels of detail for a mesh, replacing any existing levels.
+    /// Each level is simplified from the previous one.  Generation stops early if a mesh can't be
+    /// simplified enough to be worth another level.  The bounding sphere of the mesh is also computed
+    /// since it's needed to select levels of detail.
+    /// @param[in,out]  mesh - The mesh for which to generate levels of detail.
+    /// @param[in]  level_of_detail_count - The maximum number of levels of detail, including the original mesh.
+    /// @param[in]  triangle_ratio - The fraction of triangles to keep from one level to the next.
+    void MeshSimplification::GenerateLevelsOfDetail(Mesh& mesh, const std::size_t level_of_detail_count, const float triangle_ratio)
+    {
+        // COMPUTE THE BOUNDS OF THE MESH.
+        mesh.LevelsOfDetail.clear();
+        mesh.ComputeBoundingSphere();
+
+        // GENERATE EACH SIMPLIFIED LEVEL OF DETAIL.
+        // Levels that don't remove at least this fraction of triangles aren't worth the extra memory.
+        constexpr float MAX_KEPT_TRIANGLE_RATIO = 0.9f;
+        mesh.LevelsOfDetail.reserve(level_of_detail_count);
+        const Mesh* previous_level_of_detail = &mesh;
+        for (std::size_t level_of_detail_index = 1; level_of_detail_index < level_of_detail_count; ++level_of_detail_index)
+        {
+            std::size_t previous_triangle_count = previous_level_of_detail->TriangleCount();
+            std::size_t target_triangle_count = static_cast<std::size_t>(previous_triangle_count * triangle_ratio);
+            if (0 == target_triangle_count)
+            {
+                break;
+            }
+
+            Mesh simplified_mesh = Simplify(*previous_level_of_detail, target_triangle_count);
+            std::size_t max_useful_triangle_count = static_cast<std::size_t>(previous_triangle_count * MAX_KEPT_TRIANGLE_RATIO);
+            bool simplified_enough = (simplified_mesh.TriangleCount() <= max_useful_triangle_count);
+            if (!simplified_enough)
+            {
+                break;
+            }
+
+            mesh.LevelsOfDetail.emplace_back(std::move(simplified_mesh));
+            previous_level_of_detail = &mesh.LevelsOfDetail.back();
+        }
+    }
+
+    /// Creates a quadric for the squared distance to a single plane.
+    /// @param[in]  unit_normal - The unit normal of the plane.
+    /// @param[in]  point_on_plane - Any point on the plane.
+    /// @param[in]  weight - The weight by which to scale squared distances to the plane.
+    /// @return The quadric for the plane.
+    MeshSimplification::Quadric MeshSimplification::Quadric::FromPlane(
+        const MATH::Vector3f& unit_normal,
+        const MATH::Vector3f& point_on_plane,
+        const double weight)
+    {
+        // The plane is a*x + b*y + c*z + d = 0, and the quadric is the weighted outer product of (a, b, c, d).
+        double a = unit_normal.X;
+        double b = unit_normal.Y;
+        double c = unit_normal.Z;
+        double d = -MATH::Vector3f::DotProduct(unit_normal, point_on_plane);
+
+        Quadric quadric;
+        quadric.Coefficients =
+        {
+            weight * a * a, weight * a * b, weight * a * c, weight * a * d,
+                            weight * b * b, weight * b * c, weight * b * d,
+                                            weight * c * c, weight * c * d,
+                                                            weight * d * d,
+        };
+        return quadric;
+    }
+
+    /// Adds another quadric to this one.
+    /// @param[in]  rhs - The quadric to add.
+    /// @return This quadric after adding the other quadric.
+    MeshSimplification::Quadric& MeshSimplification::Quadric::operator+=(const Quadric& rhs)
+    {
+        for (std::size_t coefficient_index = 0; coefficient_index < Coefficients.size(); ++coefficient_index)
+        {
+            Coefficients[coefficient_index] += rhs.Coefficients[coefficient_index];
+        }
+        return *this;
+    }
+
+    /// Computes the weighted sum of squared distances from a position to the planes in this quadric.
+    /// @param[in]  position - The position for which to compute the error.
+    /// @return The error for the position.
+    double MeshSimplification::Quadric::Evaluate(const MATH::Vector3f& position) const
+    {
+        double x = position.X;
+        double y = position.Y;
+        double z = position.Z;
+
+        // Off-diagonal terms appear twice in the full symmetric matrix.
+        double error =
+            Coefficients[0] * x * x + 2.0 * Coefficients[1] * x * y + 2.0 * Coefficients[2] * x * z + 2.0 * Coefficients[3] * x +
+            Coefficients[4] * y * y + 2.0 * Coefficients[5] * y * z + 2.0 * Coefficients[6] * y +
+            Coefficients[7] * z * z + 2.0 * Coefficients[8] * z +
+            Coefficients[9];
+        return error;
+    }
+}
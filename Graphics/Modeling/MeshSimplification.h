@@ -0,0 +1,52 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include "Graphics/Mesh.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS::MODELING
+{
+    /// Simplifies meshes to fewer triangles using quadric error metrics
+    /// (https://www.cs.cmu.edu/~garland/Papers/quadrics.pdf).
+    ///
+    /// Edges are repeatedly collapsed by moving one endpoint onto the other, cheapest first,
+    /// where the cost is the sum of squared distances from the remaining endpoint to the planes
+    /// of triangles that were originally around both endpoints.  Collapsing onto an existing
+    /// endpoint (rather than an optimal new position) means other vertex attributes stay valid.
+    ///
+    /// Vertices at the same position are treated as a single vertex when collapsing so that seams
+    /// in texture coordinates or normals don't tear open, and open boundaries are weighted to
+    /// preserve the silhouette of the mesh.
+    class MeshSimplification
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The default number of levels of detail to generate, including the original mesh.
+        static constexpr std::size_t DEFAULT_LEVEL_OF_DETAIL_COUNT = 4;
+        /// The default fraction of triangles kept from one level of detail to the next.
+        static constexpr float DEFAULT_LEVEL_OF_DETAIL_TRIANGLE_RATIO = 0.5f;
+
+        // SIMPLIFICATION.
+        static Mesh Simplify(const Mesh& mesh, const std::size_t target_triangle_count);
+        static void GenerateLevelsOfDetail(
+            Mesh& mesh,
+            const std::size_t level_of_detail_count = DEFAULT_LEVEL_OF_DETAIL_COUNT,
+            const float triangle_ratio = DEFAULT_LEVEL_OF_DETAIL_TRIANGLE_RATIO);
+
+    private:
+        /// A symmetric 4x4 matrix measuring the sum of squared distances from a position to a set of planes.
+        /// Doubles are used since the terms get large when many planes are summed.
+        class Quadric
+        {
+        public:
+            static Quadric FromPlane(const MATH::Vector3f& unit_normal, const MATH::Vector3f& point_on_plane, const double weight);
+
+            Quadric& operator+=(const Quadric& rhs);
+            double Evaluate(const MATH::Vector3f& position) const;
+
+            /// The upper triangle of the matrix, in row-major order.
+            std::array<double, 10> Coefficients = {};
+        };
+    };
+}
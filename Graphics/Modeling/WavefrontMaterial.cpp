@@ -179,6 +179,10 @@ namespace GRAPHICS::MODELING
                 const std::string& specular_exponent_string = current_line_components.back();
                 current_material->SpecularProperties.SpecularPower = std::stof(specular_exponent_string);
 
+                // PRECOMPUTE POWERS FOR FAST SPECULAR SHADING.
+                current_material->SpecularProperties.SpecularPowerLookupTable = std::make_shared<MATH::PowerLookupTable>(
+                    current_material->SpecularProperties.SpecularPower);
+
                 // CONTINUE PROCESSING OTHER LINES IN THE FILE.
                 continue;
             }
@@ -291,6 +295,15 @@ namespace GRAPHICS::MODELING
                 /// @todo   Error-handling...different file types and texture formats!
                 std::shared_ptr<GRAPHICS::IMAGES::Bitmap> texture = GRAPHICS::IMAGES::Bitmap::LoadPng(texture_filepath, ColorFormat::RGBA);
 
+                // PRECOMPUTE MIPMAPS FOR THE TEXTURE.
+                // This is done once at load time to avoid needing to do it during rendering.
+                // A tiled layout is used to keep texels that are close in any direction close in memory.
+                std::shared_ptr<GRAPHICS::IMAGES::MipmappedTexture> mipmapped_texture = nullptr;
+                if (texture)
+                {
+                    mipmapped_texture = GRAPHICS::IMAGES::MipmappedTexture::Create(*texture, GRAPHICS::TextureMemoryLayout::TILED_4X4);
+                }
+
                 // SET THE APPROPRIATE TYPE OF TEXTURE ON THE MATERIAL.
                 /// @todo   Handle more kinds of texture maps besides ambient, diffuse, and specular!
                 ///     Bump and displacement maps are of particular interest.
@@ -301,16 +314,19 @@ namespace GRAPHICS::MODELING
                 if (is_diffuse_texture)
                 {
                     current_material->DiffuseProperties.Texture = texture;
+                    current_material->DiffuseProperties.MipmappedTexture = mipmapped_texture;
                 }
                 else if (is_specular_texture)
                 {
                     current_material->SpecularProperties.Texture = texture;
+                    current_material->SpecularProperties.MipmappedTexture = mipmapped_texture;
                 }
                 else
                 {
                     // For now, all remaining textures are assumed to be ambient,
                     // which generally provides maximum visibility into texture contents.
                     current_material->AmbientProperties.Texture = texture;
+                    current_material->AmbientProperties.MipmappedTexture = mipmapped_texture;
                 }
 
                 // CONTINUE PROCESSING OTHER LINES IN THE FILE.
@@ -1,8 +1,11 @@
 #include <cassert>
+#include <cstdint>
 #include <fstream>
+#include <map>
 #include <sstream>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 #include "ErrorHandling/Asserts.h"
 #include "Graphics/Modeling/WavefrontFaceVertexAttributeIndices.h"
@@ -48,6 +51,8 @@ namespace GRAPHICS::MODELING
         std::vector<GRAPHICS::Color> vertex_colors;
         std::vector<MATH::Vector2f> vertex_texture_coordinates;
         std::vector<MATH::Vector3f> vertex_normals;
+        // Unique vertices in the current mesh are tracked by their position and texture coordinate indices in the file.
+        std::map<std::pair<std::size_t, std::size_t>, uint32_t> current_mesh_vertex_indices_by_attribute_indices;
         std::string line;
         while (std::getline(obj_file, line))
         {
@@ -278,103 +283,6 @@ namespace GRAPHICS::MODELING
                     return std::nullopt;
                 }
 
-                // CREATE A TRIANGLE FOR THE FACE.
-                constexpr std::size_t FACE_FIRST_VERTEX_INDEX = 0;
-                const WavefrontFaceVertexAttributeIndices& first_vertex_attribute_indices = face_vertex_attribute_indices.at(FACE_FIRST_VERTEX_INDEX);
-                std::size_t first_vertex_position_index = first_vertex_attribute_indices.VertexPositionIndex - WavefrontFaceVertexAttributeIndices::OFFSET_FROM_ZERO_BASED_INDEX;
-                const MATH::Vector3f& first_vertex_position = vertex_positions.at(first_vertex_position_index);
-
-                /// @todo   Assume that the color is at the same as the position index?
-                GRAPHICS::Color first_vertex_color = GRAPHICS::Color::WHITE;
-                bool first_vertex_color_exists = (WavefrontFaceVertexAttributeIndices::UNSET_INDEX != first_vertex_attribute_indices.VertexColorIndex);
-                if (first_vertex_color_exists)
-                {
-                    first_vertex_color = vertex_colors.at(first_vertex_position_index);
-                }
-
-                MATH::Vector2f first_vertex_texture_coordinates;
-                bool first_vertex_texture_coordinates_exist = (WavefrontFaceVertexAttributeIndices::UNSET_INDEX != first_vertex_attribute_indices.VertexTextureCoordinateIndex);
-                if (first_vertex_texture_coordinates_exist)
-                {
-                    std::size_t first_vertex_texture_coordinate_index = first_vertex_attribute_indices.VertexTextureCoordinateIndex - WavefrontFaceVertexAttributeIndices::OFFSET_FROM_ZERO_BASED_INDEX;
-                    first_vertex_texture_coordinates = vertex_texture_coordinates.at(first_vertex_texture_coordinate_index);
-                }
-
-                /// @todo   Vertex normals?
-                VertexWithAttributes first_vertex = 
-                { 
-                    .Position = first_vertex_position, 
-                    .Color = first_vertex_color,
-                    .TextureCoordinates = first_vertex_texture_coordinates,
-                };
-
-                constexpr std::size_t FACE_SECOND_VERTEX_INDEX = FACE_FIRST_VERTEX_INDEX + 1;
-                const WavefrontFaceVertexAttributeIndices& second_vertex_attribute_indices = face_vertex_attribute_indices.at(FACE_SECOND_VERTEX_INDEX);
-                std::size_t second_vertex_position_index = second_vertex_attribute_indices.VertexPositionIndex - WavefrontFaceVertexAttributeIndices::OFFSET_FROM_ZERO_BASED_INDEX;
-                const MATH::Vector3f& second_vertex_position = vertex_positions.at(second_vertex_position_index);
-
-                /// @todo   Assume that the color is at the same as the position index?
-                GRAPHICS::Color second_vertex_color = GRAPHICS::Color::WHITE;
-                bool second_vertex_color_exists = (WavefrontFaceVertexAttributeIndices::UNSET_INDEX != second_vertex_attribute_indices.VertexColorIndex);
-                if (second_vertex_color_exists)
-                {
-                    second_vertex_color = vertex_colors.at(second_vertex_position_index);
-                }
-
-                MATH::Vector2f second_vertex_texture_coordinates;
-                bool second_vertex_texture_coordinates_exist = (WavefrontFaceVertexAttributeIndices::UNSET_INDEX != second_vertex_attribute_indices.VertexTextureCoordinateIndex);
-                if (second_vertex_texture_coordinates_exist)
-                {
-                    std::size_t second_vertex_texture_coordinate_index = second_vertex_attribute_indices.VertexTextureCoordinateIndex - WavefrontFaceVertexAttributeIndices::OFFSET_FROM_ZERO_BASED_INDEX;
-                    second_vertex_texture_coordinates = vertex_texture_coordinates.at(second_vertex_texture_coordinate_index);
-                }
-
-                /// @todo   Vertex normals?
-                VertexWithAttributes second_vertex =
-                {
-                    .Position = second_vertex_position,
-                    .Color = second_vertex_color,
-                    .TextureCoordinates = second_vertex_texture_coordinates,
-                };
-
-                constexpr std::size_t FACE_THIRD_VERTEX_INDEX = FACE_SECOND_VERTEX_INDEX + 1;
-                const WavefrontFaceVertexAttributeIndices& third_vertex_attribute_indices = face_vertex_attribute_indices.at(FACE_THIRD_VERTEX_INDEX);
-                std::size_t third_vertex_position_index = third_vertex_attribute_indices.VertexPositionIndex - WavefrontFaceVertexAttributeIndices::OFFSET_FROM_ZERO_BASED_INDEX;
-                const MATH::Vector3f& third_vertex_position = vertex_positions.at(third_vertex_position_index);
-
-                /// @todo   Assume that the color is at the same as the position index?
-                GRAPHICS::Color third_vertex_color = GRAPHICS::Color::WHITE;
-                bool third_vertex_color_exists = (WavefrontFaceVertexAttributeIndices::UNSET_INDEX != third_vertex_attribute_indices.VertexColorIndex);
-                if (third_vertex_color_exists)
-                {
-                    third_vertex_color = vertex_colors.at(third_vertex_position_index);
-                }
-
-                MATH::Vector2f third_vertex_texture_coordinates;
-                bool third_vertex_texture_coordinates_exist = (WavefrontFaceVertexAttributeIndices::UNSET_INDEX != third_vertex_attribute_indices.VertexTextureCoordinateIndex);
-                if (third_vertex_texture_coordinates_exist)
-                {
-                    std::size_t third_vertex_texture_coordinate_index = third_vertex_attribute_indices.VertexTextureCoordinateIndex - WavefrontFaceVertexAttributeIndices::OFFSET_FROM_ZERO_BASED_INDEX;
-                    third_vertex_texture_coordinates = vertex_texture_coordinates.at(third_vertex_texture_coordinate_index);
-                }
-
-                /// @todo   Vertex normals?
-                VertexWithAttributes third_vertex =
-                {
-                    .Position = third_vertex_position,
-                    .Color = third_vertex_color,
-                    .TextureCoordinates = third_vertex_texture_coordinates,
-                };
-                
-                GRAPHICS::GEOMETRY::Triangle triangle;
-                triangle.Material = current_material;
-                triangle.Vertices =
-                {
-                    first_vertex,
-                    second_vertex,
-                    third_vertex
-                };
-
                 // A model and mesh must exist first before adding a triangle.
                 if (!model)
                 {
@@ -383,58 +291,96 @@ namespace GRAPHICS::MODELING
                 if (!current_mesh)
                 {
                     current_mesh = GRAPHICS::Mesh { .Name = "Default" };
+                    current_mesh_vertex_indices_by_attribute_indices.clear();
                 }
 
-                current_mesh->Triangles.emplace_back(triangle);
-
-                // CREATE AN ADDITIONAL TRIANLGE IF A QUAD EXISTS.
-                // Quads are common enough to implement support here.
-                constexpr std::size_t QUAD_VERTEX_COUNT = 4;
-                bool is_quad = (QUAD_VERTEX_COUNT == face_vertex_attribute_index_count);
-                if (is_quad)
+                // GET INDICES OF UNIQUE MESH VERTICES FOR THE FACE.
+                // Vertices shared between faces are only stored once in the mesh.
+                std::vector<uint32_t> face_mesh_vertex_indices;
+                for (const WavefrontFaceVertexAttributeIndices& current_face_vertex_attribute_indices : face_vertex_attribute_indices)
                 {
-                    // EXTRACT THE FOURTH VERTEX.
-                    constexpr std::size_t FACE_FOURTH_VERTEX_INDEX = FACE_THIRD_VERTEX_INDEX + 1;
-                    const WavefrontFaceVertexAttributeIndices& fourth_vertex_attribute_indices = face_vertex_attribute_indices.at(FACE_FOURTH_VERTEX_INDEX);
-                    std::size_t fourth_vertex_position_index = fourth_vertex_attribute_indices.VertexPositionIndex - WavefrontFaceVertexAttributeIndices::OFFSET_FROM_ZERO_BASED_INDEX;
-                    const MATH::Vector3f& fourth_vertex_position = vertex_positions.at(fourth_vertex_position_index);
+                    // CHECK IF THE VERTEX ALREADY EXISTS IN THE MESH.
+                    /// @todo   Vertex normals?  They're not currently used, so they aren't part of the key.
+                    std::pair<std::size_t, std::size_t> vertex_key = std::make_pair(
+                        current_face_vertex_attribute_indices.VertexPositionIndex,
+                        current_face_vertex_attribute_indices.VertexTextureCoordinateIndex);
+                    auto existing_mesh_vertex_index = current_mesh_vertex_indices_by_attribute_indices.find(vertex_key);
+                    bool vertex_already_exists = (current_mesh_vertex_indices_by_attribute_indices.cend() != existing_mesh_vertex_index);
+                    if (vertex_already_exists)
+                    {
+                        face_mesh_vertex_indices.emplace_back(existing_mesh_vertex_index->second);
+                        continue;
+                    }
+
+                    // GET THE VERTEX POSITION.
+                    std::size_t vertex_position_index = current_face_vertex_attribute_indices.VertexPositionIndex - WavefrontFaceVertexAttributeIndices::OFFSET_FROM_ZERO_BASED_INDEX;
+                    const MATH::Vector3f& vertex_position = vertex_positions.at(vertex_position_index);
 
                     /// @todo   Assume that the color is at the same as the position index?
-                    GRAPHICS::Color fourth_vertex_color = GRAPHICS::Color::WHITE;
-                    bool fourth_vertex_color_exists = (WavefrontFaceVertexAttributeIndices::UNSET_INDEX != fourth_vertex_attribute_indices.VertexColorIndex);
-                    if (fourth_vertex_color_exists)
+                    GRAPHICS::Color vertex_color = GRAPHICS::Color::WHITE;
+                    bool vertex_color_exists = (WavefrontFaceVertexAttributeIndices::UNSET_INDEX != current_face_vertex_attribute_indices.VertexColorIndex);
+                    if (vertex_color_exists)
                     {
-                        fourth_vertex_color = vertex_colors.at(fourth_vertex_position_index);
+                        vertex_color = vertex_colors.at(vertex_position_index);
                     }
 
-                    MATH::Vector2f fourth_vertex_texture_coordinates;
-                    bool fourth_vertex_texture_coordinates_exist = (WavefrontFaceVertexAttributeIndices::UNSET_INDEX != fourth_vertex_attribute_indices.VertexTextureCoordinateIndex);
-                    if (fourth_vertex_texture_coordinates_exist)
+                    MATH::Vector2f vertex_texture_coordinates_for_face;
+                    bool vertex_texture_coordinates_exist = (WavefrontFaceVertexAttributeIndices::UNSET_INDEX != current_face_vertex_attribute_indices.VertexTextureCoordinateIndex);
+                    if (vertex_texture_coordinates_exist)
                     {
-                        std::size_t fourth_vertex_texture_coordinate_index = fourth_vertex_attribute_indices.VertexTextureCoordinateIndex - WavefrontFaceVertexAttributeIndices::OFFSET_FROM_ZERO_BASED_INDEX;
-                        fourth_vertex_texture_coordinates = vertex_texture_coordinates.at(fourth_vertex_texture_coordinate_index);
+                        std::size_t vertex_texture_coordinate_index = current_face_vertex_attribute_indices.VertexTextureCoordinateIndex - WavefrontFaceVertexAttributeIndices::OFFSET_FROM_ZERO_BASED_INDEX;
+                        vertex_texture_coordinates_for_face = vertex_texture_coordinates.at(vertex_texture_coordinate_index);
                     }
 
-                    /// @todo   Vertex normals?
-                    VertexWithAttributes fourth_vertex =
+                    // ADD THE NEW VERTEX TO THE MESH.
+                    VertexWithAttributes vertex =
                     {
-                        .Position = fourth_vertex_position,
-                        .Color = fourth_vertex_color,
-                        .TextureCoordinates = fourth_vertex_texture_coordinates,
+                        .Position = vertex_position,
+                        .Color = vertex_color,
+                        .TextureCoordinates = vertex_texture_coordinates_for_face,
                     };
-                    
-                    // CREATE THE ADDITIONAL TRIANGLE.
+                    uint32_t new_mesh_vertex_index = static_cast<uint32_t>(current_mesh->Vertices.size());
+                    current_mesh->Vertices.emplace_back(vertex);
+                    current_mesh_vertex_indices_by_attribute_indices[vertex_key] = new_mesh_vertex_index;
+                    face_mesh_vertex_indices.emplace_back(new_mesh_vertex_index);
+                }
+
+                // ENSURE A SUBSET EXISTS FOR THE CURRENT MATERIAL.
+                // Consecutive faces with the same material are grouped into a single subset.
+                bool current_material_subset_exists = (!current_mesh->Subsets.empty() && (current_mesh->Subsets.back().Material == current_material));
+                if (!current_material_subset_exists)
+                {
+                    current_mesh->Subsets.emplace_back(GRAPHICS::MeshSubset
+                    {
+                        .FirstIndex = static_cast<uint32_t>(current_mesh->Indices.size()),
+                        .IndexCount = 0,
+                        .Material = current_material,
+                    });
+                }
+                GRAPHICS::MeshSubset& current_subset = current_mesh->Subsets.back();
+
+                // ADD INDICES FOR A TRIANGLE FOR THE FACE.
+                constexpr std::size_t FACE_FIRST_VERTEX_INDEX = 0;
+                constexpr std::size_t FACE_SECOND_VERTEX_INDEX = FACE_FIRST_VERTEX_INDEX + 1;
+                constexpr std::size_t FACE_THIRD_VERTEX_INDEX = FACE_SECOND_VERTEX_INDEX + 1;
+                current_mesh->Indices.emplace_back(face_mesh_vertex_indices.at(FACE_FIRST_VERTEX_INDEX));
+                current_mesh->Indices.emplace_back(face_mesh_vertex_indices.at(FACE_SECOND_VERTEX_INDEX));
+                current_mesh->Indices.emplace_back(face_mesh_vertex_indices.at(FACE_THIRD_VERTEX_INDEX));
+                current_subset.IndexCount += GRAPHICS::GEOMETRY::Triangle::VERTEX_COUNT;
+
+                // ADD INDICES FOR AN ADDITIONAL TRIANLGE IF A QUAD EXISTS.
+                // Quads are common enough to implement support here.
+                constexpr std::size_t QUAD_VERTEX_COUNT = 4;
+                bool is_quad = (QUAD_VERTEX_COUNT == face_vertex_attribute_index_count);
+                if (is_quad)
+                {
                     // Vertices should be in first, third, then fourth order
                     // (see https://stackoverflow.com/questions/23723993/converting-quadriladerals-in-an-obj-file-into-triangles).
-                    GRAPHICS::GEOMETRY::Triangle extra_triangle_for_quad;
-                    extra_triangle_for_quad.Material = current_material;
-                    extra_triangle_for_quad.Vertices =
-                    {
-                        first_vertex,
-                        third_vertex,
-                        fourth_vertex
-                    };
-                    current_mesh->Triangles.emplace_back(extra_triangle_for_quad);
+                    constexpr std::size_t FACE_FOURTH_VERTEX_INDEX = FACE_THIRD_VERTEX_INDEX + 1;
+                    current_mesh->Indices.emplace_back(face_mesh_vertex_indices.at(FACE_FIRST_VERTEX_INDEX));
+                    current_mesh->Indices.emplace_back(face_mesh_vertex_indices.at(FACE_THIRD_VERTEX_INDEX));
+                    current_mesh->Indices.emplace_back(face_mesh_vertex_indices.at(FACE_FOURTH_VERTEX_INDEX));
+                    current_subset.IndexCount += GRAPHICS::GEOMETRY::Triangle::VERTEX_COUNT;
                 }
 
                 // CONTINUE PARSING ADDITIONAL FIELDS.
@@ -496,6 +442,7 @@ namespace GRAPHICS::MODELING
                 // CREATE A NEW MESH WITH THE APPROPRIATE NAME.
                 const std::string& mesh_name = current_line_components.back();
                 current_mesh = GRAPHICS::Mesh { .Name = mesh_name };
+                current_mesh_vertex_indices_by_attribute_indices.clear();
 
                 // CONTINUE PARSING ADDITIONAL FIELDS.
                 continue;
@@ -1,4 +1,5 @@
 #include "Graphics/Object3D.h"
+#include "Math/Quaternion.h"
 
 namespace GRAPHICS
 {
@@ -6,11 +7,20 @@ namespace GRAPHICS
     /// @return The object's world transform.
     MATH::Matrix4x4f Object3D::WorldTransform() const
     {
-        MATH::Matrix4x4f translation_matrix = MATH::Matrix4x4f::Translation(WorldPosition);
-        MATH::Matrix4x4f rotation_matrix = MATH::Matrix4x4f::Rotation(RotationInRadians);
-        MATH::Matrix4x4f scale_matrix = MATH::Matrix4x4f::Scale(Scale);
+        MATH::AffineTransform3x4 world_transform = WorldAffineTransform();
+        return world_transform.ToMatrix4x4();
+    }
 
-        MATH::Matrix4x4f world_transform = translation_matrix * rotation_matrix * scale_matrix;
+    /// Gets the world transform of the object as an affine transform, which is cheaper to apply than a 4x4 matrix.
+    /// The transform is computed each time, so callers that use it repeatedly (such as render queues) should keep a copy.
+    /// @return The world transform for the object's current position, rotation, and scale.
+    MATH::AffineTransform3x4 Object3D::WorldAffineTransform() const
+    {
+        // COMPUTE THE WORLD TRANSFORM.
+        // Rotations are combined as a quaternion, and the transform is built directly rather than by multiplying
+        // separate translation, rotation, and scaling matrices.
+        MATH::Quaternionf rotation = MATH::Quaternionf::FromEulerAngles(RotationInRadians);
+        MATH::AffineTransform3x4 world_transform = MATH::AffineTransform3x4::TranslationRotationScale(WorldPosition, rotation, Scale);
         return world_transform;
     }
 }
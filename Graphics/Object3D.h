@@ -3,6 +3,7 @@
 #include <vector>
 #include "Graphics/Geometry/Sphere.h"
 #include "Graphics/Modeling/Model.h"
+#include "Math/AffineTransform3x4.h"
 #include "Math/Angle.h"
 #include "Math/Matrix4x4.h"
 #include "Math/Vector3.h"
@@ -15,6 +16,7 @@ namespace GRAPHICS
     public:
         // METHODS.
         MATH::Matrix4x4f WorldTransform() const;
+        MATH::AffineTransform3x4 WorldAffineTransform() const;
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The 3D model for this object.
@@ -28,5 +30,6 @@ namespace GRAPHICS
         MATH::Vector3< MATH::Angle<float>::Radians > RotationInRadians = MATH::Vector3< MATH::Angle<float>::Radians >();
         /// The scaling of the object.  Defaults to no scaling (using the size of the triangles exactly).
         MATH::Vector3f Scale = MATH::Vector3f(1.0f, 1.0f, 1.0f);
+
     };
 }
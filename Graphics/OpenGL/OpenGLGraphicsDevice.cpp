@@ -170,7 +170,7 @@ namespace GRAPHICS::OPEN_GL
         for (const auto& [mesh_name, mesh] : object_3D.Model.MeshesByName)
         {
             // LOAD TEXTURES FOR ALL TRIANGLES.
-            for (const GEOMETRY::Triangle& triangle : mesh.Triangles)
+            for (const GEOMETRY::Triangle& triangle : mesh.GetTriangles())
             {
                 // SKIP OVER ANY TRIANGLES WITHOUT MATERIALS.
                 if (!triangle.Material)
@@ -384,7 +384,7 @@ namespace GRAPHICS::OPEN_GL
             for (const auto& [mesh_name, mesh] : object_3D.Model.MeshesByName)
             {
                 // RENDER THE CURRENT TRIANGLE.
-                for (const GEOMETRY::Triangle& triangle : mesh.Triangles)
+                for (const GEOMETRY::Triangle& triangle : mesh.GetTriangles())
                 {
                     // ALLOCATE A TEXTURE IF APPLICABLE.
                     /// @todo   Multiple textures?  Constant for 0.
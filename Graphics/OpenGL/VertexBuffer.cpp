@@ -32,7 +32,7 @@ namespace GRAPHICS::OPEN_GL
         for (const auto& [mesh_name, mesh] : model.MeshesByName)
         {
             // FILL THE BUFFER WITH VERTEX DATA FROM ALL TRIANGLES.
-            for (const GEOMETRY::Triangle& triangle : mesh.Triangles)
+            for (const GEOMETRY::Triangle& triangle : mesh.GetTriangles())
             {
                 // GET ALL VERTEX DATA FOR THE CURRENT TRIANGLE.
                 MATH::Vector3f surface_normal = triangle.SurfaceNormal();
@@ -16,11 +16,13 @@ namespace GRAPHICS::RAY_TRACING
     /// @param[in]  camera - The camera through which the scene is being viewed.
     /// @param[in]  rendering_settings - The settings to use for rendering.
     /// @param[in,out]  render_target - The target to render to.
+    /// @param[in,out]  level_of_detail_selector - The selector to use for levels of detail of meshes.  Full detail is used if null.
     void RayTracingAlgorithm::Render(
         const Scene& scene, 
         const VIEWING::Camera& camera,
         const RenderingSettings& rendering_settings, 
-        GRAPHICS::IMAGES::Bitmap& render_target)
+        GRAPHICS::IMAGES::Bitmap& render_target,
+        VIEWING::LevelOfDetailSelector* level_of_detail_selector)
     {
         // TRANSFORM OBJECTS IN THE SCENE INTO WORLD SPACE.
         Scene scene_with_world_space_objects;
@@ -37,31 +39,58 @@ namespace GRAPHICS::RAY_TRACING
 
             // TRANSFORM ALL MESHES IN THE OBJECT.
             MATH::Matrix4x4f world_transform = untransformed_object.WorldTransform();
-            for (const auto& [mesh_name, untransformed_mesh] : untransformed_object.Model.MeshesByName)
+            for (const auto& [mesh_name, full_detail_mesh] : untransformed_object.Model.MeshesByName)
             {
+                // SELECT THE LEVEL OF DETAIL FOR THE MESH.
+                // Fewer triangles for meshes covering less of the screen means fewer intersection tests per ray.
+                const Mesh& untransformed_mesh = level_of_detail_selector ?
+                    level_of_detail_selector->Select(full_detail_mesh, untransformed_object, camera) :
+                    full_detail_mesh;
+
                 // CREATE AN EMPTY MESH TO BE POPULATED WITH TRANSFORMED INFORMATION.
                 Mesh transformed_mesh = { .Name = mesh_name };
 
                 // TRANSFORM ALL TRIANGLES IN THE MESH.
-                for (const GEOMETRY::Triangle& untransformed_triangle : untransformed_mesh.Triangles)
+                if (untransformed_mesh.IsIndexed())
                 {
-                    // INITIALIZE THE TRANSFORMED VERSION OF THE TRIANGLE.
-                    GEOMETRY::Triangle transformed_triangle;
-                    transformed_triangle.Material = untransformed_triangle.Material;
-
-                    // TRANSFORM EACH VERTEX OF THE TRIANGLE.
-                    for (std::size_t vertex_index = 0; vertex_index < untransformed_triangle.Vertices.size(); ++vertex_index)
+                    // TRANSFORM EACH UNIQUE VERTEX OF THE MESH.
+                    // This is only done once per vertex, regardless of how many triangles share the vertex.
+                    Mesh indexed_transformed_mesh = untransformed_mesh;
+                    for (VertexWithAttributes& vertex : indexed_transformed_mesh.Vertices)
                     {
-                        const VertexWithAttributes& untransformed_vertex = untransformed_triangle.Vertices[vertex_index];
-                        MATH::Vector4f homogeneous_vertex = MATH::Vector4f::HomogeneousPositionVector(untransformed_vertex.Position);
+                        MATH::Vector4f homogeneous_vertex = MATH::Vector4f::HomogeneousPositionVector(vertex.Position);
                         MATH::Vector4f transformed_vertex = world_transform * homogeneous_vertex;
                         // Other non-positional attributes of the vertex need to be preserved at this stage.
-                        transformed_triangle.Vertices[vertex_index] = untransformed_vertex;
-                        transformed_triangle.Vertices[vertex_index].Position = MATH::Vector3f(transformed_vertex.X, transformed_vertex.Y, transformed_vertex.Z);
+                        vertex.Position = MATH::Vector3f(transformed_vertex.X, transformed_vertex.Y, transformed_vertex.Z);
                     }
 
-                    // STORE THE TRANSFORMED TRIANGLE.
-                    transformed_mesh.Triangles.push_back(transformed_triangle);
+                    // ASSEMBLE THE TRANSFORMED TRIANGLES.
+                    // Intersections need to refer to individual triangles, so triangles are assembled
+                    // from the already transformed vertices once per frame rather than per ray.
+                    transformed_mesh.Triangles = indexed_transformed_mesh.GetTriangles();
+                }
+                else
+                {
+                    for (const GEOMETRY::Triangle& untransformed_triangle : untransformed_mesh.Triangles)
+                    {
+                        // INITIALIZE THE TRANSFORMED VERSION OF THE TRIANGLE.
+                        GEOMETRY::Triangle transformed_triangle;
+                        transformed_triangle.Material = untransformed_triangle.Material;
+
+                        // TRANSFORM EACH VERTEX OF THE TRIANGLE.
+                        for (std::size_t vertex_index = 0; vertex_index < untransformed_triangle.Vertices.size(); ++vertex_index)
+                        {
+                            const VertexWithAttributes& untransformed_vertex = untransformed_triangle.Vertices[vertex_index];
+                            MATH::Vector4f homogeneous_vertex = MATH::Vector4f::HomogeneousPositionVector(untransformed_vertex.Position);
+                            MATH::Vector4f transformed_vertex = world_transform * homogeneous_vertex;
+                            // Other non-positional attributes of the vertex need to be preserved at this stage.
+                            transformed_triangle.Vertices[vertex_index] = untransformed_vertex;
+                            transformed_triangle.Vertices[vertex_index].Position = MATH::Vector3f(transformed_vertex.X, transformed_vertex.Y, transformed_vertex.Z);
+                        }
+
+                        // STORE THE TRANSFORMED TRIANGLE.
+                        transformed_mesh.Triangles.push_back(transformed_triangle);
+                    }
                 }
 
                 // STORE THE TRANSFORMED MESH.
@@ -72,6 +101,11 @@ namespace GRAPHICS::RAY_TRACING
             scene_with_world_space_objects.Objects.push_back(transformed_object);
         }
 
+        // MARK THE ENTIRE RENDER TARGET AS DIRTY.
+        // Every pixel is written, so the entire target is marked once up front rather than
+        // tracking individual pixels written from multiple threads.
+        render_target.MarkDirty(MATH::Rectangleui::FromLeftTopAndDimensions(0, 0, render_target.GetWidthInPixels(), render_target.GetHeightInPixels()));
+
         // COMPUTE HOW TO DIVIDE UP RENDERING OF PIXELS ACROSS MULTIPLE THREADS.
         unsigned int cpu_count = std::thread::hardware_concurrency();
 
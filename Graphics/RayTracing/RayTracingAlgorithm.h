@@ -9,6 +9,7 @@
 #include "Graphics/Scene.h"
 #include "Graphics/Surface.h"
 #include "Graphics/Viewing/Camera.h"
+#include "Graphics/Viewing/LevelOfDetailSelector.h"
 
 /// Holds code related to ray tracing.
 namespace GRAPHICS::RAY_TRACING
@@ -22,7 +23,8 @@ namespace GRAPHICS::RAY_TRACING
             const Scene& scene, 
             const VIEWING::Camera& camera, 
             const RenderingSettings& rendering_settings, 
-            GRAPHICS::IMAGES::Bitmap& render_target);
+            GRAPHICS::IMAGES::Bitmap& render_target,
+            VIEWING::LevelOfDetailSelector* level_of_detail_selector = nullptr);
 
         // RENDERING PARALLELIZATION HELPER METHOD.
         static void RenderRows(
@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <bit>
+#include "Graphics/RenderQueue.h"
+
+namespace GRAPHICS
+{
+    /// Determines if a material is transparent (and therefore needs to be blended over things behind it).
+    /// @param[in]  material - The material to check.  May be null.
+    /// @return True if the material is transparent; false if not.
+    bool RenderQueue::IsTransparent(const Material* material)
+    {
+        // MISSING MATERIALS ARE TREATED AS OPAQUE.
+        if (!material)
+        {
+            return false;
+        }
+
+        // CHECK IF THE MATERIAL IS PARTIALLY SEE-THROUGH.
+        bool transparent = (material->DiffuseProperties.Color.Alpha < Color::MAX_FLOAT_COLOR_COMPONENT);
+        return transparent;
+    }
+
+    /// Computes the sort key for a draw item.
+    /// @param[in]  transparent - True if the item is transparent; false if opaque.
+    /// @param[in]  material_id - The ID of the item's material.
+    /// @param[in]  view_depth - The distance of the item in front of the camera along the camera's viewing direction.
+    /// @return The sort key for the item.
+    uint64_t RenderQueue::ComputeSortKey(const bool transparent, const uint32_t material_id, const float view_depth)
+    {
+        // QUANTIZE THE DEPTH.
+        // Bit patterns of non-negative floats sort the same as the floats themselves,
+        // so this preserves the full precision of the depth without needing to know the depth range.
+        // Items behind the camera are treated as being at the camera since their order doesn't matter.
+        float clamped_view_depth = std::max(view_depth, 0.0f);
+        uint64_t quantized_depth = std::bit_cast<uint32_t>(clamped_view_depth);
+        uint64_t clamped_material_id = std::min(material_id, MAX_MATERIAL_ID);
+
+        // COMBINE THE KEY COMPONENTS.
+        if (transparent)
+        {
+            // Transparent items are ordered back to front, so depths are inverted to place larger depths first.
+            constexpr unsigned int TRANSPARENT_DEPTH_BIT_SHIFT = 24;
+            uint64_t inverted_depth = (~quantized_depth) & UINT32_MAX;
+            uint64_t sort_key = TRANSPARENT_SORT_KEY_BIT | (inverted_depth << TRANSPARENT_DEPTH_BIT_SHIFT) | clamped_material_id;
+            return sort_key;
+        }
+        else
+        {
+            // Opaque items are grouped by material and then ordered front to back.
+            constexpr unsigned int OPAQUE_MATERIAL_ID_BIT_SHIFT = 32;
+            uint64_t sort_key = (clamped_material_id << OPAQUE_MATERIAL_ID_BIT_SHIFT) | quantized_depth;
+            return sort_key;
+        }
+    }
+
+    /// Removes all items from the queue.
+    /// Memory is kept so that it can be reused for subsequent items.
+    void RenderQueue::Clear()
+    {
+        Items.clear();
+        MaterialIds.clear();
+    }
+
+    /// Adds items for all objects in a scene to the queue.
+    /// @param[in]  scene - The scene to add.  Must remain valid while items are in the queue.
+    /// @param[in]  camera - The camera through which the scene is being viewed.
+    /// @param[in,out]  level_of_detail_selector - The selector to use for levels of detail.  Full detail is used if null.
+    void RenderQueue::Add(const Scene& scene, const VIEWING::Camera& camera, VIEWING::LevelOfDetailSelector* level_of_detail_selector)
+    {
+        for (const Object3D& object_3D : scene.Objects)
+        {
+            Add(object_3D, camera, level_of_detail_selector);
+        }
+    }
+
+    /// Adds items for each visible mesh of an object to the queue.
+    /// @param[in]  object_3D - The object to add.  Must remain valid while items are in the queue.
+    /// @param[in]  camera - The camera through which the object is being viewed.
+    /// @param[in,out]  level_of_detail_selector - The selector to use for levels of detail.  Full detail is used if null.
+    void RenderQueue::Add(const Object3D& object_3D, const VIEWING::Camera& camera, VIEWING::LevelOfDetailSelector* level_of_detail_selector)
+    {
+        // COMPUTE THE DEPTH OF THE OBJECT.
+        // Meshes don't have their own positions, so the object's position is used for all of them.
+        MATH::Vector3f camera_view_direction = -camera.CoordinateFrame.Forward;
+        MATH::Vector3f camera_to_object = object_3D.WorldPosition - camera.WorldPosition;
+        float view_depth = MATH::Vector3f::DotProduct(camera_to_object, camera_view_direction);
+
+        // COMPUTE THE WORLD TRANSFORM OF THE OBJECT.
+        // The transform is the same for all meshes, so it's only computed once per object.
+        MATH::AffineTransform3x4 world_transform = object_3D.WorldAffineTransform();
+
+        // ADD AN ITEM FOR EACH VISIBLE MESH.
+        for (const auto& [mesh_name, full_detail_mesh] : object_3D.Model.MeshesByName)
+        {
+            // SKIP OVER INVISIBLE MESHES.
+            if (!full_detail_mesh.Visible)
+            {
+                continue;
+            }
+
+            // SELECT THE LEVEL OF DETAIL FOR THE MESH.
+            const Mesh& mesh = level_of_detail_selector ? level_of_detail_selector->Select(full_detail_mesh, object_3D, camera) : full_detail_mesh;
+
+            // DETERMINE THE MATERIAL OF THE MESH.
+            // The first material is used for sorting meshes with multiple materials, but the mesh
+            // is considered transparent if any of its materials are to ensure proper ordering.
+            const Material* first_material = nullptr;
+            bool mesh_transparent = false;
+            if (mesh.IsIndexed())
+            {
+                for (const MeshSubset& subset : mesh.Subsets)
+                {
+                    if (!first_material)
+                    {
+                        first_material = subset.Material.get();
+                    }
+                    mesh_transparent = mesh_transparent || IsTransparent(subset.Material.get());
+                }
+            }
+            else if (!mesh.Triangles.empty())
+            {
+                // Materials are only checked for the first triangle to avoid checking every triangle.
+                first_material = mesh.Triangles.front().Material.get();
+                mesh_transparent = IsTransparent(first_material);
+            }
+
+            // ADD THE ITEM.
+            uint32_t material_id = GetMaterialId(first_material);
+            Items.emplace_back(DrawItem
+            {
+                .SortKey = ComputeSortKey(mesh_transparent, material_id, view_depth),
+                .Object = &object_3D,
+                .Mesh = &mesh,
+                .WorldTransform = world_transform,
+            });
+        }
+    }
+
+    /// Sorts the items in the queue into drawing order.
+    /// Items with equal keys remain in the order they were added for consistent results across frames.
+    void RenderQueue::Sort()
+    {
+        std::stable_sort(
+            Items.begin(),
+            Items.end(),
+            [](const DrawItem& left_item, const DrawItem& right_item) { return left_item.SortKey < right_item.SortKey; });
+    }
+
+    /// Gets the ID for a material, assigning a new ID if the material hasn't been seen before.
+    /// @param[in]  material - The material for which to get an ID.  May be null.
+    /// @return The ID of the material.
+    uint32_t RenderQueue::GetMaterialId(const Material* material)
+    {
+        auto [material_id, material_newly_added] = MaterialIds.try_emplace(material, static_cast<uint32_t>(MaterialIds.size()));
+        return material_id->second;
+    }
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "Graphics/Material.h"
+#include "Graphics/Mesh.h"
+#include "Graphics/Object3D.h"
+#include "Graphics/Scene.h"
+#include "Graphics/Viewing/Camera.h"
+#include "Graphics/Viewing/LevelOfDetailSelector.h"
+#include "Math/AffineTransform3x4.h"
+
+namespace GRAPHICS
+{
+    /// A queue of items to draw, sorted to reduce state changes and improve depth rejection.
+    /// Not specific to any particular kind of graphics device.
+    ///
+    /// Each item is a single mesh of an object, with a 64-bit sort key:
+    /// - Opaque items are drawn first, grouped by material and then ordered front to back
+    ///     within each material so that later pixels are more likely to fail depth tests.
+    /// - Transparent items are drawn after, ordered back to front (and then by material)
+    ///     so that they blend correctly over everything behind them.
+    class RenderQueue
+    {
+    public:
+        /// A single item to draw.
+        struct DrawItem
+        {
+            /// The key by which items are sorted.
+            uint64_t SortKey = 0;
+            /// The object to which the mesh belongs.
+            const Object3D* Object = nullptr;
+            /// The mesh to draw, at the level of detail selected when added.
+            const GRAPHICS::Mesh* Mesh = nullptr;
+            /// The world transform of the object, computed once when the object was added
+            /// so that it's shared by all of the object's meshes and every rendering pass.
+            MATH::AffineTransform3x4 WorldTransform = MATH::AffineTransform3x4::Identity();
+        };
+
+        // STATIC CONSTANTS.
+        /// The sort key bit that is set for transparent items, placing them after all opaque items.
+        static constexpr uint64_t TRANSPARENT_SORT_KEY_BIT = uint64_t(1) << 63;
+        /// The maximum material ID that can be stored in a sort key.
+        /// Materials beyond this share the maximum ID, which only affects how well they are grouped.
+        static constexpr uint32_t MAX_MATERIAL_ID = (1u << 24) - 1;
+
+        // SORT KEYS.
+        static bool IsTransparent(const Material* material);
+        static uint64_t ComputeSortKey(const bool transparent, const uint32_t material_id, const float view_depth);
+
+        // QUEUE BUILDING.
+        void Clear();
+        void Add(const Scene& scene, const VIEWING::Camera& camera, VIEWING::LevelOfDetailSelector* level_of_detail_selector = nullptr);
+        void Add(const Object3D& object_3D, const VIEWING::Camera& camera, VIEWING::LevelOfDetailSelector* level_of_detail_selector = nullptr);
+        void Sort();
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The items to draw, in drawing order after sorting.
+        std::vector<DrawItem> Items = {};
+        /// IDs assigned to materials in the order they were first added.
+        std::unordered_map<const Material*, uint32_t> MaterialIds = {};
+
+    private:
+        // HELPER METHODS.
+        uint32_t GetMaterialId(const Material* material);
+    };
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Graphics/DepthBufferFormat.h"
 #include "Graphics/Hardware/GraphicsDeviceType.h"
 #include "Graphics/Shading/ShadingSettings.h"
 
@@ -11,11 +12,43 @@ namespace GRAPHICS
         /// The type of renderer to use.
         GRAPHICS::HARDWARE::GraphicsDeviceType GraphicsDeviceType = GRAPHICS::HARDWARE::GraphicsDeviceType::CPU_RASTERIZER;
         /// True if SIMD instructions should be used for CPU rendering (currently only rasterization supported).
+        /// SIMD instructions are only used if supported by the CPU at runtime (see @ref PROCESSOR::CpuFeatures),
+        /// which also allows forcing a specific instruction set.
         bool UseCpuSimd = false;
         /// True if backface culling should occur; false if not.
         bool CullBackfaces = false;
         /// True if depth buffering should be used; false if not.
         bool DepthBuffering = false;
+        /// The format for storing depths in any depth buffer for CPU rendering.
+        /// Fixed-point formats reduce memory bandwidth at the cost of precision.
+        GRAPHICS::DepthBufferFormat DepthBufferFormat = GRAPHICS::DepthBufferFormat::FLOAT_32;
+        /// True if reversed-Z depths (0 at the far plane, 1 at the near plane) should be used for CPU rendering;
+        /// false for regular depths (-1 at the far plane, 1 at the near plane).
+        bool ReversedZ = false;
+        /// True if a depth-only pass should be rendered before the regular pass when depth buffering for CPU rendering.
+        /// This reduces shading and texturing work in scenes with lots of overdraw since only visible pixels are then fully shaded,
+        /// at the cost of rasterizing triangles twice.
+        bool DepthPrePass = false;
+        /// True if colors should be written when rendering; false if only depths should be written.
+        /// Primarily intended for depth pre-passes.  Only applies to filled triangles in CPU rasterization
+        /// (wireframe lines are skipped entirely if colors aren't written).
+        bool ColorWrites = true;
+        /// True if lighting should be deferred until after all opaque geometry has been rasterized for CPU rendering.
+        /// Lighting is then only computed once for each visible pixel, and each light is only applied to pixels
+        /// within its screen space bounds, which helps for scenes with many lights.  Only applies to material-based shading,
+        /// and triangles without materials aren't rendered.
+        bool DeferredLighting = false;
+        /// True if lights should be culled to clusters of the viewing frustum (screen tiles by depth slices) when rendering scenes
+        /// with forward lighting for CPU rendering.  Each vertex is then only shaded with lights that may reach its cluster,
+        /// which helps for scenes with many point lights with limited ranges.  Shading results are unchanged.
+        bool ClusteredLightCulling = false;
+        /// True if shadows should be computed from shadow maps rendered for each light when rendering scenes for CPU rasterization
+        /// (if shadows are enabled in lighting settings).  See @ref SHADING::LIGHTING::Light::ShadowMapDimensionInPixels
+        /// for the resolution of each light's shadow map.  Forward lighting only shadows vertices, whereas deferred lighting shadows each pixel.
+        bool ShadowMapping = false;
+        /// The number of texels on each side of a sampled shadow map texel that are also compared to soften the edges of shadows.
+        /// 0 produces hard shadow edges, with larger radii producing softer edges at the cost of more time to compute shadows.
+        unsigned int ShadowMapFilterRadiusInTexels = 1;
         /// Settings specifically for shading.
         SHADING::ShadingSettings Shading = {};
         /// True if reflections should be calculated; false otherwise.
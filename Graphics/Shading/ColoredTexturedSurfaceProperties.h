@@ -5,6 +5,7 @@
 #include "Graphics/Color.h"
 #include "Graphics/DirectX/Direct3DTexture.h"
 #include "Graphics/Images/Bitmap.h"
+#include "Graphics/Images/MipmappedTexture.h"
 
 namespace GRAPHICS::SHADING
 {
@@ -18,6 +19,8 @@ namespace GRAPHICS::SHADING
         Color Color = Color::BLACK;
         /// Any texture defining the look of the surface.
         std::shared_ptr<IMAGES::Bitmap> Texture = nullptr;
+        /// Any mipmapped version of the texture for texture mapping on the CPU (preferred over the plain texture if it exists).
+        std::shared_ptr<IMAGES::MipmappedTexture> MipmappedTexture = nullptr;
         /// Any OpenGL resource for the texture.
         GLuint OpenGLTextureId = 0;
         /// Any Direct3D resource for the texture.
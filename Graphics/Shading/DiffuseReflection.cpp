@@ -1,6 +1,7 @@
 #include <algorithm>
 #include "ErrorHandling/Asserts.h"
 #include "Graphics/Shading/DiffuseReflection.h"
+#include "Math/FastMath.h"
 
 namespace GRAPHICS::SHADING
 {
@@ -53,7 +54,10 @@ namespace GRAPHICS::SHADING
         // the light and surface normal (where the cosine can be computed via the dot product).
         constexpr float NO_ILLUMINATION = 0.0f;
         MATH::Vector3f unit_surface_normal = surface.GetNormal(surface_point);
-        MATH::Vector3f unit_direction_from_point_to_light = MATH::Vector3f::Normalize(direction_from_point_to_light);
+        bool fast_math_enabled = (ShadingPrecision::FAST == shading_settings.Precision);
+        MATH::Vector3f unit_direction_from_point_to_light = fast_math_enabled ?
+            MATH::FastMath::Normalize(direction_from_point_to_light) :
+            MATH::Vector3f::Normalize(direction_from_point_to_light);
         float illumination_proportion = MATH::Vector3f::DotProduct(unit_surface_normal, unit_direction_from_point_to_light);
         illumination_proportion = std::max(NO_ILLUMINATION, illumination_proportion);
 
@@ -11,4 +11,26 @@ namespace GRAPHICS::SHADING::LIGHTING
         MATH::Vector3f direction_from_other_point_to_light = PointLightWorldPosition - other_world_position;
         return direction_from_other_point_to_light;
     }
+
+    /// Determines if the light reaches the specified world position.
+    /// Only point lights have a limited range, so other lights reach all positions.
+    /// @param[in]  world_position - The world position to check.
+    /// @return True if the light reaches the position; false if not.
+    bool Light::Reaches(const MATH::Vector3f& world_position) const
+    {
+        // CHECK IF THE LIGHT HAS A LIMITED RANGE.
+        bool is_point_light = (LightType::POINT == Type);
+        if (!is_point_light)
+        {
+            return true;
+        }
+
+        // CHECK IF THE POSITION IS WITHIN RANGE.
+        // Squared distances are compared to avoid a square root.
+        MATH::Vector3f direction_to_light = PointLightDirectionFrom(world_position);
+        float squared_distance_to_light = MATH::Vector3f::DotProduct(direction_to_light, direction_to_light);
+        float squared_range = PointLightRange * PointLightRange;
+        bool position_within_range = (squared_distance_to_light <= squared_range);
+        return position_within_range;
+    }
 }
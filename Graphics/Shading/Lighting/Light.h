@@ -1,5 +1,6 @@
 #pragma once
 
+#include <limits>
 #include "Graphics/Color.h"
 #include "Graphics/Shading/Lighting/LightType.h"
 #include "Math/Vector3.h"
@@ -11,6 +12,10 @@ namespace GRAPHICS::SHADING::LIGHTING
     {
     public:
         MATH::Vector3f PointLightDirectionFrom(const MATH::Vector3f& other_world_position) const;
+        bool Reaches(const MATH::Vector3f& world_position) const;
+
+        /// Default equality operator.
+        bool operator==(const Light&) const = default;
 
         /// The type of the light.
         LightType Type = LightType::AMBIENT;
@@ -20,5 +25,12 @@ namespace GRAPHICS::SHADING::LIGHTING
         MATH::Vector3f DirectionalLightDirection = MATH::Vector3f();
         /// The world position for a point light.
         MATH::Vector3f PointLightWorldPosition = MATH::Vector3f();
+        /// The maximum distance from a point light at which it provides illumination.
+        /// Limiting the range allows rendering to skip the light for surfaces out of range.
+        float PointLightRange = std::numeric_limits<float>::max();
+        /// The width and height of each face of the light's shadow map when rasterizing with shadow mapping.
+        /// Larger shadow maps produce sharper shadows at the cost of more memory and time to render them.
+        /// Only directional and point lights have shadow maps, and a dimension of 0 disables shadow mapping for the light.
+        unsigned int ShadowMapDimensionInPixels = 512;
     };
 }
@@ -17,5 +17,12 @@ namespace GRAPHICS::SHADING::LIGHTING
         bool ShadowsEnabled = true;
         /// True if points lights should be visibly rendered (typically for debugging); false if not.
         bool RenderPointLights = false;
+        /// True if vertex normals should be used when lighting vertices of indexed meshes in the CPU rasterizer,
+        /// smoothing lighting across triangles; false if triangle surface normals should be used.
+        /// Lighting with vertex normals doesn't depend on triangles, so it can be computed once per unique vertex.
+        bool VertexNormalsEnabled = false;
+
+        /// Default equality operator.
+        bool operator==(const LightingSettings&) const = default;
     };
 }
@@ -0,0 +1,14 @@
+#pragma once
+
+namespace GRAPHICS::SHADING
+{
+    /// The precision of math used for shading.
+    enum class ShadingPrecision
+    {
+        /// Standard library math is used for the most accurate shading.
+        EXACT = 0,
+        /// Faster approximations are used (see @ref MATH::FastMath and @ref MATH::PowerLookupTable),
+        /// with errors generally too small to noticeably change colors.
+        FAST
+    };
+}
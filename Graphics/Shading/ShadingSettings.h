@@ -1,7 +1,9 @@
 #pragma once
 
 #include "Graphics/Shading/Lighting/LightingSettings.h"
+#include "Graphics/Shading/ShadingPrecision.h"
 #include "Graphics/Shading/ShadingType.h"
+#include "Graphics/TextureFilteringType.h"
 
 namespace GRAPHICS::SHADING
 {
@@ -14,5 +16,10 @@ namespace GRAPHICS::SHADING
         LIGHTING::LightingSettings Lighting = {};
         /// True if texture mapping is enabled; false otherwise.
         bool TextureMappingEnabled = true;
+        /// The type of filtering to use for texture mapping in the CPU rasterizer.
+        /// Filtering other than nearest requires textures to have mipmaps.
+        TextureFilteringType TextureFiltering = TextureFilteringType::NEAREST;
+        /// The precision of math used for shading on the CPU.
+        ShadingPrecision Precision = ShadingPrecision::EXACT;
     };
 }
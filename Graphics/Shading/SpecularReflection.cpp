@@ -3,6 +3,7 @@
 #include "ErrorHandling/Asserts.h"
 #include "Graphics/Shading/SpecularReflection.h"
 #include "Graphics/TextureMappingAlgorithm.h"
+#include "Math/FastMath.h"
 
 namespace GRAPHICS::SHADING
 {
@@ -57,23 +58,30 @@ namespace GRAPHICS::SHADING
         // the light and surface normal (where the cosine can be computed via the dot product).
         constexpr float NO_ILLUMINATION = 0.0f;
         MATH::Vector3f unit_surface_normal = surface.GetNormal(surface_point);
-        MATH::Vector3f unit_direction_from_point_to_light = MATH::Vector3f::Normalize(direction_from_point_to_light);
+        bool fast_math_enabled = (ShadingPrecision::FAST == shading_settings.Precision);
+        MATH::Vector3f unit_direction_from_point_to_light = fast_math_enabled ?
+            MATH::FastMath::Normalize(direction_from_point_to_light) :
+            MATH::Vector3f::Normalize(direction_from_point_to_light);
         float illumination_proportion = MATH::Vector3f::DotProduct(unit_surface_normal, unit_direction_from_point_to_light);
         illumination_proportion = std::max(NO_ILLUMINATION, illumination_proportion);
 
         // COMPUTE THE REFLECTED LIGHT DIRECTION.
         MATH::Vector3f reflected_light_along_surface_normal = MATH::Vector3f::Scale(2.0f * illumination_proportion, unit_surface_normal);
         MATH::Vector3f reflected_light_direction = reflected_light_along_surface_normal - unit_direction_from_point_to_light;
-        MATH::Vector3f unit_reflected_light_direction = MATH::Vector3f::Normalize(reflected_light_direction);
+        MATH::Vector3f unit_reflected_light_direction = fast_math_enabled ?
+            MATH::FastMath::Normalize(reflected_light_direction) :
+            MATH::Vector3f::Normalize(reflected_light_direction);
 
         // COMPUTE THE SPECULAR AMOUNT.
         // The closer the ray from the surface point to the viewing point is to the ideal (perfect) reflected direction,
         // the shinier (more specular reflection) occurs.
         MATH::Vector3f ray_from_surface_point_to_viewing_point = viewing_point - surface_point;
-        MATH::Vector3f normalized_ray_from_surface_point_to_viewing_point = MATH::Vector3f::Normalize(ray_from_surface_point_to_viewing_point);
+        MATH::Vector3f normalized_ray_from_surface_point_to_viewing_point = fast_math_enabled ?
+            MATH::FastMath::Normalize(ray_from_surface_point_to_viewing_point) :
+            MATH::Vector3f::Normalize(ray_from_surface_point_to_viewing_point);
         float specular_proportion = MATH::Vector3f::DotProduct(normalized_ray_from_surface_point_to_viewing_point, unit_reflected_light_direction);
         specular_proportion = std::max(NO_ILLUMINATION, specular_proportion);
-        specular_proportion = std::pow(specular_proportion, material->SpecularProperties.SpecularPower);
+        specular_proportion = RaiseToSpecularPower(specular_proportion, material->SpecularProperties, shading_settings.Precision);
 
         // COMPUTE THE AMOUNT OF SPECULAR LIGHT SHINING ON THE SURFACE.
         float light_proportion = shadow_factor * specular_proportion;
@@ -97,4 +105,37 @@ namespace GRAPHICS::SHADING
         Color specular_color = Color::ComponentMultiplyRedGreenBlue(specular_surface_color, current_light_specular_color);
         return specular_color;
     }
+
+    /// Raises a specular proportion to a surface's specular power, which controls how quickly
+    /// specular highlights fall off.
+    /// @param[in]  specular_proportion - The proportion of specular reflection within [0, 1].
+    /// @param[in]  specular_properties - The specular properties of the surface.
+    /// @param[in]  precision - The precision of math to use.  Fast precision uses any lookup table for the
+    ///     specular power, falling back to an approximation of the power if no such table exists.
+    /// @return The specular proportion raised to the specular power.
+    float SpecularReflection::RaiseToSpecularPower(
+        const float specular_proportion,
+        const SpecularSurfaceProperties& specular_properties,
+        const ShadingPrecision precision)
+    {
+        // USE THE STANDARD LIBRARY FOR EXACT PRECISION.
+        if (ShadingPrecision::EXACT == precision)
+        {
+            return std::pow(specular_proportion, specular_properties.SpecularPower);
+        }
+
+        // USE ANY LOOKUP TABLE FOR THE SPECULAR POWER.
+        // A table for a different exponent may exist if the specular power was changed after the table was created.
+        const MATH::PowerLookupTable* specular_power_lookup_table = specular_properties.SpecularPowerLookupTable.get();
+        bool specular_power_lookup_table_applies = (
+            specular_power_lookup_table &&
+            (specular_power_lookup_table->Exponent == specular_properties.SpecularPower));
+        if (specular_power_lookup_table_applies)
+        {
+            return specular_power_lookup_table->Power(specular_proportion);
+        }
+
+        // APPROXIMATE THE POWER DIRECTLY.
+        return MATH::FastMath::Power(specular_proportion, specular_properties.SpecularPower);
+    }
 }
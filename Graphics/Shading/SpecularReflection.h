@@ -2,7 +2,9 @@
 
 #include "Graphics/Color.h"
 #include "Graphics/Shading/Lighting/Light.h"
+#include "Graphics/Shading/ShadingPrecision.h"
 #include "Graphics/Shading/ShadingSettings.h"
+#include "Graphics/Shading/SpecularSurfaceProperties.h"
 #include "Graphics/Surface.h"
 #include "Math/Vector3.h"
 
@@ -22,5 +24,9 @@ namespace GRAPHICS::SHADING
             const float shadow_factor,
             const Surface& surface,
             const MATH::Vector3f& surface_point);
+        static float RaiseToSpecularPower(
+            const float specular_proportion,
+            const SpecularSurfaceProperties& specular_properties,
+            const ShadingPrecision precision);
     };
 }
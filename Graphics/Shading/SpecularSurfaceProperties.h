@@ -5,6 +5,8 @@
 #include "Graphics/Color.h"
 #include "Graphics/DirectX/Direct3DTexture.h"
 #include "Graphics/Images/Bitmap.h"
+#include "Graphics/Images/MipmappedTexture.h"
+#include "Math/PowerLookupTable.h"
 
 namespace GRAPHICS::SHADING
 {
@@ -17,8 +19,12 @@ namespace GRAPHICS::SHADING
         Color Color = Color::BLACK;
         /// The specular power defining the shininess of specular highlights.
         float SpecularPower = 0.0f;
+        /// Any precomputed powers for fast specular shading on the CPU (only used if its exponent matches the specular power).
+        std::shared_ptr<MATH::PowerLookupTable> SpecularPowerLookupTable = nullptr;
         /// Any texture defining the specular look of the surface.
         std::shared_ptr<IMAGES::Bitmap> Texture = nullptr;
+        /// Any mipmapped version of the texture for texture mapping on the CPU (preferred over the plain texture if it exists).
+        std::shared_ptr<IMAGES::MipmappedTexture> MipmappedTexture = nullptr;
         /// Any OpenGL resource for the texture.
         GLuint OpenGLTextureId = 0;
         /// Any Direct3D resource for the texture.
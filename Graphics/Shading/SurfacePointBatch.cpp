@@ -0,0 +1,100 @@
+#include "Graphics/Shading/SurfacePointBatch.h"
+
+namespace GRAPHICS::SHADING
+{
+    /// Gets the number of points in the batch.
+    /// @return The number of points.
+    std::size_t SurfacePointBatch::Count() const
+    {
+        return PositionXs.size();
+    }
+
+    /// Removes all points and shadow factors from the batch.
+    /// Materials are left alone so that they can be reused for new points.
+    void SurfacePointBatch::Clear()
+    {
+        PositionXs.clear();
+        PositionYs.clear();
+        PositionZs.clear();
+        NormalXs.clear();
+        NormalYs.clear();
+        NormalZs.clear();
+        MaterialIds.clear();
+        ShadowFactors.clear();
+    }
+
+    /// Reserves memory for points to avoid reallocations as they're added.
+    /// @param[in]  point_count - The number of points to reserve memory for.
+    void SurfacePointBatch::Reserve(const std::size_t point_count)
+    {
+        PositionXs.reserve(point_count);
+        PositionYs.reserve(point_count);
+        PositionZs.reserve(point_count);
+        NormalXs.reserve(point_count);
+        NormalYs.reserve(point_count);
+        NormalZs.reserve(point_count);
+        MaterialIds.reserve(point_count);
+    }
+
+    /// Adds a point to the batch.
+    /// @param[in]  position - The world position of the point.
+    /// @param[in]  unit_normal - The unit surface normal at the point.
+    /// @param[in]  material_id - The index of the point's material in the batch's materials.
+    void SurfacePointBatch::Add(const MATH::Vector3f& position, const MATH::Vector3f& unit_normal, const uint16_t material_id)
+    {
+        PositionXs.push_back(position.X);
+        PositionYs.push_back(position.Y);
+        PositionZs.push_back(position.Z);
+        NormalXs.push_back(unit_normal.X);
+        NormalYs.push_back(unit_normal.Y);
+        NormalZs.push_back(unit_normal.Z);
+        MaterialIds.push_back(material_id);
+    }
+
+    /// Gets the world position of a point.
+    /// @param[in]  point_index - The index of the point.
+    /// @return The world position of the point.
+    MATH::Vector3f SurfacePointBatch::GetPosition(const std::size_t point_index) const
+    {
+        return MATH::Vector3f(PositionXs[point_index], PositionYs[point_index], PositionZs[point_index]);
+    }
+
+    /// Gets the unit surface normal of a point.
+    /// @param[in]  point_index - The index of the point.
+    /// @return The unit surface normal of the point.
+    MATH::Vector3f SurfacePointBatch::GetNormal(const std::size_t point_index) const
+    {
+        return MATH::Vector3f(NormalXs[point_index], NormalYs[point_index], NormalZs[point_index]);
+    }
+
+    /// Gets the material of a point.
+    /// @param[in]  point_index - The index of the point.
+    /// @return The material of the point; null if the point's material ID doesn't reference a material.
+    std::shared_ptr<Material> SurfacePointBatch::GetMaterial(const std::size_t point_index) const
+    {
+        uint16_t material_id = MaterialIds[point_index];
+        bool material_id_valid = (material_id < Materials.size());
+        if (!material_id_valid)
+        {
+            return nullptr;
+        }
+
+        return Materials[material_id];
+    }
+
+    /// Gets the shadow factors of all points for a light.
+    /// @param[in]  light_index - The index of the light.
+    /// @return The shadow factors for the light, indexed by point; null if the light has no shadow factors.
+    const float* SurfacePointBatch::GetShadowFactors(const std::size_t light_index) const
+    {
+        std::size_t point_count = Count();
+        std::size_t end_shadow_factor_index = (light_index + 1) * point_count;
+        bool shadow_factors_exist_for_light = (end_shadow_factor_index <= ShadowFactors.size());
+        if (!shadow_factors_exist_for_light)
+        {
+            return nullptr;
+        }
+
+        return ShadowFactors.data() + (light_index * point_count);
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Graphics/Material.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS::SHADING
+{
+    /// Many points on surfaces to shade together, such as ray hits in a tile or vertices of a mesh.
+    /// Points are stored as a structure of arrays (one array per component) so that consecutive
+    /// points can be loaded directly into SIMD registers.
+    ///
+    /// Points are added first, after which any shadow factors can be filled in.
+    class SurfacePointBatch
+    {
+    public:
+        // POINTS.
+        std::size_t Count() const;
+        void Clear();
+        void Reserve(const std::size_t point_count);
+        void Add(const MATH::Vector3f& position, const MATH::Vector3f& unit_normal, const uint16_t material_id);
+        MATH::Vector3f GetPosition(const std::size_t point_index) const;
+        MATH::Vector3f GetNormal(const std::size_t point_index) const;
+        std::shared_ptr<Material> GetMaterial(const std::size_t point_index) const;
+
+        // SHADOWING.
+        const float* GetShadowFactors(const std::size_t light_index) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The x coordinates of the world positions of the points.
+        std::vector<float> PositionXs = {};
+        /// The y coordinates of the world positions of the points.
+        std::vector<float> PositionYs = {};
+        /// The z coordinates of the world positions of the points.
+        std::vector<float> PositionZs = {};
+        /// The x components of the unit surface normals of the points.
+        std::vector<float> NormalXs = {};
+        /// The y components of the unit surface normals of the points.
+        std::vector<float> NormalYs = {};
+        /// The z components of the unit surface normals of the points.
+        std::vector<float> NormalZs = {};
+        /// The IDs of the materials of the points, which index into the materials below.
+        std::vector<uint16_t> MaterialIds = {};
+        /// The materials referenced by points.  Points with an ID not referencing a material are shaded black.
+        std::vector<std::shared_ptr<Material>> Materials = {};
+        /// Shadowing factors for each light at each point (0 == full shadowing, 1 == no shadowing),
+        /// indexed by (light_index * Count() + point_index).  Lights without factors are unshadowed,
+        /// so this may be left empty if no shadowing is needed.
+        std::vector<float> ShadowFactors = {};
+    };
+}
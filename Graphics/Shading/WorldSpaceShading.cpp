@@ -1,4 +1,9 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include "Graphics/Shading/WorldSpaceShading.h"
+#include "Math/FastMath.h"
+#include "Processor/CpuFeatures.h"
 
 namespace GRAPHICS::SHADING
 {
@@ -17,7 +22,7 @@ namespace GRAPHICS::SHADING
         const Surface& surface,
         const MATH::Vector3f& viewing_point,
         const std::vector<LIGHTING::Light>& lights,
-        const std::vector<float> shadow_factors_by_light_index,
+        const std::vector<float>& shadow_factors_by_light_index,
         const ShadingSettings& shading_settings)
     {
         // CHECK IF LIGHTING IS ENABLED.
@@ -118,6 +123,12 @@ namespace GRAPHICS::SHADING
             return light_total_color;
         }
 
+        // CHECK IF THE LIGHT REACHES THE SURFACE POINT.
+        if (!light.Reaches(surface_point))
+        {
+            return light_total_color;
+        }
+
         // ADD IN DIFFUSE LIGHTING IF ENABLED.
         if (shading_settings.Lighting.DiffuseLightingEnabled)
         {
@@ -148,4 +159,348 @@ namespace GRAPHICS::SHADING
         // RETURN THE COMPUTED LIGHT COLOR.
         return light_total_color;
     }
+
+    /// Computes material-based shading for a batch of surface points.
+    /// Texture mapping is not performed since the shapes the points are on aren't known.
+    /// @param[in]  surface_points - The points to shade.
+    /// @param[in]  viewing_point - The point from which the surfaces are being viewed.
+    /// @param[in]  lights - The lights for which to compute shading at the surface points.
+    /// @param[in]  shading_settings - Settings controlling the shading.
+    /// @param[out] colors - The computed light colors, indexed by point.
+    void WorldSpaceShading::ComputeMaterialShading(
+        const SurfacePointBatch& surface_points,
+        const MATH::Vector3f& viewing_point,
+        const std::vector<LIGHTING::Light>& lights,
+        const ShadingSettings& shading_settings,
+        std::vector<Color>& colors)
+    {
+        // CHECK IF LIGHTING IS ENABLED.
+        std::size_t point_count = surface_points.Count();
+        if (!shading_settings.Lighting.Enabled)
+        {
+            // INDICATE THAT NO LIGHTING EXISTS ON THE SURFACES.
+            colors.assign(point_count, Color::BLACK);
+            return;
+        }
+        colors.resize(point_count);
+
+        // SHADE POINTS 8 AT A TIME IF SUPPORTED.
+        // Any remaining points that don't fill all 8 SIMD lanes are shaded individually below.
+        std::size_t first_individual_point_index = 0;
+        bool simd_shading_supported = (PROCESSOR::CpuFeatures::GetSimdInstructionSet() >= PROCESSOR::SimdInstructionSet::AVX2);
+        if (simd_shading_supported)
+        {
+            constexpr std::size_t SIMD_LANE_COUNT = 8;
+            first_individual_point_index = point_count - (point_count % SIMD_LANE_COUNT);
+            ComputeMaterialShadingSimd8x(surface_points, first_individual_point_index, viewing_point, lights, shading_settings, colors);
+        }
+
+        // SHADE THE REMAINING POINTS INDIVIDUALLY.
+        ShadingSettings point_shading_settings = shading_settings;
+        point_shading_settings.TextureMappingEnabled = false;
+        std::size_t light_count = lights.size();
+        std::vector<float> shadow_factors_by_light_index;
+        for (std::size_t point_index = first_individual_point_index; point_index < point_count; ++point_index)
+        {
+            // POINTS WITHOUT MATERIALS CAN'T BE LIT.
+            std::shared_ptr<Material> material = surface_points.GetMaterial(point_index);
+            if (!material)
+            {
+                colors[point_index] = Color::BLACK;
+                continue;
+            }
+
+            // GET THE POINT'S SHADOW FACTORS.
+            shadow_factors_by_light_index.clear();
+            for (std::size_t light_index = 0; light_index < light_count; ++light_index)
+            {
+                const float* light_shadow_factors = surface_points.GetShadowFactors(light_index);
+                if (!light_shadow_factors)
+                {
+                    break;
+                }
+                shadow_factors_by_light_index.push_back(light_shadow_factors[point_index]);
+            }
+
+            // SHADE THE POINT.
+            Surface surface = { .Normal = surface_points.GetNormal(point_index), .Material = material };
+            colors[point_index] = ComputeMaterialShading(
+                surface_points.GetPosition(point_index),
+                surface,
+                viewing_point,
+                lights,
+                shadow_factors_by_light_index,
+                point_shading_settings);
+        }
+    }
+
+    /// Computes material-based shading for 8 consecutive points of a batch at once.
+    /// Requires AVX2 support (see @ref PROCESSOR::CpuFeatures).
+    /// Results exactly match shading each point individually without texture mapping.
+    /// @param[in]  surface_points - The points to shade.
+    /// @param[in]  first_point_index - The index of the first of the 8 points to shade.
+    ///     At least 8 points must exist starting at this index.
+    /// @param[in]  viewing_point - The point from which the surfaces are being viewed.
+    /// @param[in]  lights - The lights for which to compute shading at the surface points.
+    /// @param[in]  shading_settings - Settings controlling the shading.
+    /// @return The computed light colors.
+    SIMD_TARGET_AVX2 ColorSimd8x WorldSpaceShading::ComputeMaterialShading(
+        const SurfacePointBatch& surface_points,
+        const std::size_t first_point_index,
+        const MATH::Vector3f& viewing_point,
+        const std::vector<LIGHTING::Light>& lights,
+        const ShadingSettings& shading_settings)
+    {
+        // INITIALIZE THE LIGHTING WITH NO LIGHT.
+        ColorSimd8x light_total_colors = ColorSimd8x::Load(Color::BLACK);
+
+        // CHECK IF LIGHTING IS ENABLED.
+        if (!shading_settings.Lighting.Enabled)
+        {
+            return light_total_colors;
+        }
+
+        // LOAD THE SURFACE POINTS.
+        MATH::Vector3Simd8x surface_positions =
+        {
+            .X = _mm256_loadu_ps(surface_points.PositionXs.data() + first_point_index),
+            .Y = _mm256_loadu_ps(surface_points.PositionYs.data() + first_point_index),
+            .Z = _mm256_loadu_ps(surface_points.PositionZs.data() + first_point_index),
+        };
+        MATH::Vector3Simd8x unit_surface_normals =
+        {
+            .X = _mm256_loadu_ps(surface_points.NormalXs.data() + first_point_index),
+            .Y = _mm256_loadu_ps(surface_points.NormalYs.data() + first_point_index),
+            .Z = _mm256_loadu_ps(surface_points.NormalZs.data() + first_point_index),
+        };
+
+        // GATHER MATERIAL PROPERTIES FOR EACH POINT.
+        // Points may have different materials, so properties are gathered one lane at a time.
+        constexpr std::size_t SIMD_LANE_COUNT = 8;
+        alignas(32) std::array<int32_t, SIMD_LANE_COUNT> material_exists_lane_masks = {};
+        alignas(32) std::array<std::array<float, SIMD_LANE_COUNT>, 3> ambient_surface_color_components = {};
+        alignas(32) std::array<std::array<float, SIMD_LANE_COUNT>, 3> diffuse_surface_color_components = {};
+        alignas(32) std::array<std::array<float, SIMD_LANE_COUNT>, 3> specular_surface_color_components = {};
+        std::array<const SpecularSurfaceProperties*, SIMD_LANE_COUNT> specular_properties = {};
+        for (std::size_t lane_index = 0; lane_index < SIMD_LANE_COUNT; ++lane_index)
+        {
+            std::shared_ptr<Material> material = surface_points.GetMaterial(first_point_index + lane_index);
+            if (!material)
+            {
+                continue;
+            }
+
+            constexpr int32_t ALL_BITS_SET = -1;
+            material_exists_lane_masks[lane_index] = ALL_BITS_SET;
+
+            const Color& ambient_surface_color = material->AmbientProperties.Color;
+            ambient_surface_color_components[0][lane_index] = ambient_surface_color.Red;
+            ambient_surface_color_components[1][lane_index] = ambient_surface_color.Green;
+            ambient_surface_color_components[2][lane_index] = ambient_surface_color.Blue;
+
+            const Color& diffuse_surface_color = material->DiffuseProperties.Color;
+            diffuse_surface_color_components[0][lane_index] = diffuse_surface_color.Red;
+            diffuse_surface_color_components[1][lane_index] = diffuse_surface_color.Green;
+            diffuse_surface_color_components[2][lane_index] = diffuse_surface_color.Blue;
+
+            const Color& specular_surface_color = material->SpecularProperties.Color;
+            specular_surface_color_components[0][lane_index] = specular_surface_color.Red;
+            specular_surface_color_components[1][lane_index] = specular_surface_color.Green;
+            specular_surface_color_components[2][lane_index] = specular_surface_color.Blue;
+            specular_properties[lane_index] = &material->SpecularProperties;
+        }
+        __m256 material_exists_mask = _mm256_castsi256_ps(_mm256_load_si256(reinterpret_cast<const __m256i*>(material_exists_lane_masks.data())));
+        const __m256 OPAQUE_ALPHA = _mm256_set1_ps(Color::BLACK.Alpha);
+        ColorSimd8x ambient_surface_colors =
+        {
+            .Red = _mm256_load_ps(ambient_surface_color_components[0].data()),
+            .Green = _mm256_load_ps(ambient_surface_color_components[1].data()),
+            .Blue = _mm256_load_ps(ambient_surface_color_components[2].data()),
+            .Alpha = OPAQUE_ALPHA,
+        };
+        ColorSimd8x diffuse_surface_colors =
+        {
+            .Red = _mm256_load_ps(diffuse_surface_color_components[0].data()),
+            .Green = _mm256_load_ps(diffuse_surface_color_components[1].data()),
+            .Blue = _mm256_load_ps(diffuse_surface_color_components[2].data()),
+            .Alpha = OPAQUE_ALPHA,
+        };
+        ColorSimd8x specular_surface_colors =
+        {
+            .Red = _mm256_load_ps(specular_surface_color_components[0].data()),
+            .Green = _mm256_load_ps(specular_surface_color_components[1].data()),
+            .Blue = _mm256_load_ps(specular_surface_color_components[2].data()),
+            .Alpha = OPAQUE_ALPHA,
+        };
+
+        // COMPUTE THE UNIT RAYS FROM THE SURFACE POINTS TO THE VIEWING POINT.
+        // These are the same for all lights.
+        MATH::Vector3Simd8x viewing_points =
+        {
+            .X = _mm256_set1_ps(viewing_point.X),
+            .Y = _mm256_set1_ps(viewing_point.Y),
+            .Z = _mm256_set1_ps(viewing_point.Z),
+        };
+        bool fast_math_enabled = (ShadingPrecision::FAST == shading_settings.Precision);
+        MATH::Vector3Simd8x normalized_rays_from_surface_points_to_viewing_point = fast_math_enabled ?
+            MATH::FastMath::Normalize(viewing_points - surface_positions) :
+            MATH::Vector3Simd8x::Normalize(viewing_points - surface_positions);
+
+        // ADD LIGHTING FROM ALL LIGHTS.
+        // Each step mirrors the non-SIMD shading, including the order of operations, so that results are identical.
+        // In particular, lighting from each light is summed separately before being added to the total.
+        const __m256 NO_ILLUMINATION = _mm256_setzero_ps();
+        std::size_t light_count = lights.size();
+        for (std::size_t light_index = 0; light_index < light_count; ++light_index)
+        {
+            const LIGHTING::Light& light = lights[light_index];
+            ColorSimd8x light_colors = ColorSimd8x::Load(light.Color);
+            ColorSimd8x current_light_total_colors = ColorSimd8x::Load(Color::BLACK);
+
+            // ADD IN AMBIENT LIGHTING IF APPLICABLE.
+            // Ambient lights should not contribute to other kinds of lighting.
+            bool is_ambient_light = (LIGHTING::LightType::AMBIENT == light.Type);
+            if (is_ambient_light)
+            {
+                if (shading_settings.Lighting.AmbientLightingEnabled)
+                {
+                    current_light_total_colors += ColorSimd8x::ComponentMultiplyRedGreenBlue(ambient_surface_colors, light_colors);
+                    light_total_colors += current_light_total_colors;
+                }
+                continue;
+            }
+
+            // GET THE DIRECTIONS FROM THE SURFACE POINTS TO THE LIGHT.
+            // Only points within range of the light are lit, which is handled by zeroing the light's color for other points.
+            // The reflected colors for those points are then black, which leaves the total colors unchanged when added.
+            MATH::Vector3Simd8x directions_from_points_to_light;
+            if (LIGHTING::LightType::DIRECTIONAL == light.Type)
+            {
+                // The computations are based on the opposite direction.
+                directions_from_points_to_light =
+                {
+                    .X = _mm256_set1_ps(-1.0f * light.DirectionalLightDirection.X),
+                    .Y = _mm256_set1_ps(-1.0f * light.DirectionalLightDirection.Y),
+                    .Z = _mm256_set1_ps(-1.0f * light.DirectionalLightDirection.Z),
+                };
+            }
+            else if (LIGHTING::LightType::POINT == light.Type)
+            {
+                MATH::Vector3Simd8x light_positions =
+                {
+                    .X = _mm256_set1_ps(light.PointLightWorldPosition.X),
+                    .Y = _mm256_set1_ps(light.PointLightWorldPosition.Y),
+                    .Z = _mm256_set1_ps(light.PointLightWorldPosition.Z),
+                };
+                directions_from_points_to_light = light_positions - surface_positions;
+
+                __m256 squared_distances_to_light = MATH::Vector3Simd8x::DotProduct(directions_from_points_to_light, directions_from_points_to_light);
+                __m256 squared_range = _mm256_set1_ps(light.PointLightRange * light.PointLightRange);
+                __m256 points_within_range = _mm256_cmp_ps(squared_distances_to_light, squared_range, _CMP_LE_OQ);
+                light_colors.Red = _mm256_and_ps(light_colors.Red, points_within_range);
+                light_colors.Green = _mm256_and_ps(light_colors.Green, points_within_range);
+                light_colors.Blue = _mm256_and_ps(light_colors.Blue, points_within_range);
+            }
+            else
+            {
+                // Other types of light do not result in any diffuse or specular reflection.
+                continue;
+            }
+
+            // GET THE LIGHT'S SHADOW FACTORS.
+            constexpr float NO_SHADOWING = 1.0f;
+            __m256 shadow_factors = _mm256_set1_ps(NO_SHADOWING);
+            const float* light_shadow_factors = surface_points.GetShadowFactors(light_index);
+            if (light_shadow_factors)
+            {
+                shadow_factors = _mm256_loadu_ps(light_shadow_factors + first_point_index);
+            }
+
+            // COMPUTE THE PROPORTION OF EACH SURFACE POINT THAT IS ILLUMINATED BY THE LIGHT.
+            MATH::Vector3Simd8x unit_directions_from_points_to_light = fast_math_enabled ?
+                MATH::FastMath::Normalize(directions_from_points_to_light) :
+                MATH::Vector3Simd8x::Normalize(directions_from_points_to_light);
+            __m256 illumination_proportions = MATH::Vector3Simd8x::DotProduct(unit_surface_normals, unit_directions_from_points_to_light);
+            illumination_proportions = _mm256_max_ps(illumination_proportions, NO_ILLUMINATION);
+
+            // ADD IN DIFFUSE LIGHTING IF ENABLED.
+            if (shading_settings.Lighting.DiffuseLightingEnabled)
+            {
+                ColorSimd8x current_light_colors = ColorSimd8x::ScaleRedGreenBlue(illumination_proportions, light_colors);
+                current_light_colors = ColorSimd8x::ScaleRedGreenBlue(shadow_factors, current_light_colors);
+                current_light_total_colors += ColorSimd8x::ComponentMultiplyRedGreenBlue(diffuse_surface_colors, current_light_colors);
+            }
+
+            // ADD IN SPECULAR LIGHTING IF ENABLED.
+            if (shading_settings.Lighting.SpecularLightingEnabled)
+            {
+                // COMPUTE THE REFLECTED LIGHT DIRECTIONS.
+                MATH::Vector3Simd8x reflected_light_along_surface_normals = MATH::Vector3Simd8x::Scale(
+                    _mm256_mul_ps(_mm256_set1_ps(2.0f), illumination_proportions),
+                    unit_surface_normals);
+                MATH::Vector3Simd8x reflected_light_directions = reflected_light_along_surface_normals - unit_directions_from_points_to_light;
+                MATH::Vector3Simd8x unit_reflected_light_directions = fast_math_enabled ?
+                    MATH::FastMath::Normalize(reflected_light_directions) :
+                    MATH::Vector3Simd8x::Normalize(reflected_light_directions);
+
+                // COMPUTE THE SPECULAR AMOUNTS.
+                // Powers are computed per lane since lanes may have different materials and to exactly match non-SIMD shading.
+                __m256 specular_proportions = MATH::Vector3Simd8x::DotProduct(normalized_rays_from_surface_points_to_viewing_point, unit_reflected_light_directions);
+                specular_proportions = _mm256_max_ps(specular_proportions, NO_ILLUMINATION);
+                alignas(32) std::array<float, SIMD_LANE_COUNT> specular_proportion_lanes;
+                _mm256_store_ps(specular_proportion_lanes.data(), specular_proportions);
+                for (std::size_t lane_index = 0; lane_index < SIMD_LANE_COUNT; ++lane_index)
+                {
+                    // Lanes without materials are left alone since they end up black anyway.
+                    if (specular_properties[lane_index])
+                    {
+                        specular_proportion_lanes[lane_index] = SpecularReflection::RaiseToSpecularPower(
+                            specular_proportion_lanes[lane_index],
+                            *specular_properties[lane_index],
+                            shading_settings.Precision);
+                    }
+                }
+                specular_proportions = _mm256_load_ps(specular_proportion_lanes.data());
+
+                // COMPUTE THE SPECULAR COLORS REFLECTED ON THE SURFACES.
+                __m256 light_proportions = _mm256_mul_ps(shadow_factors, specular_proportions);
+                ColorSimd8x current_light_specular_colors = ColorSimd8x::ScaleRedGreenBlue(light_proportions, light_colors);
+                current_light_total_colors += ColorSimd8x::ComponentMultiplyRedGreenBlue(specular_surface_colors, current_light_specular_colors);
+            }
+
+            light_total_colors += current_light_total_colors;
+        }
+
+        // POINTS WITHOUT MATERIALS CAN'T BE LIT.
+        ColorSimd8x black_colors = ColorSimd8x::Load(Color::BLACK);
+        light_total_colors.Red = _mm256_blendv_ps(black_colors.Red, light_total_colors.Red, material_exists_mask);
+        light_total_colors.Green = _mm256_blendv_ps(black_colors.Green, light_total_colors.Green, material_exists_mask);
+        light_total_colors.Blue = _mm256_blendv_ps(black_colors.Blue, light_total_colors.Blue, material_exists_mask);
+        light_total_colors.Alpha = _mm256_blendv_ps(black_colors.Alpha, light_total_colors.Alpha, material_exists_mask);
+        return light_total_colors;
+    }
+
+    /// Computes material-based shading for the first points of a batch, 8 points at a time.
+    /// Requires AVX2 support (see @ref PROCESSOR::CpuFeatures).
+    /// @param[in]  surface_points - The points to shade.
+    /// @param[in]  point_count - The number of points to shade.  Must be a multiple of 8.
+    /// @param[in]  viewing_point - The point from which the surfaces are being viewed.
+    /// @param[in]  lights - The lights for which to compute shading at the surface points.
+    /// @param[in]  shading_settings - Settings controlling the shading.
+    /// @param[in,out]  colors - The light colors for all points in the batch.  Only the shaded points are written.
+    SIMD_TARGET_AVX2 void WorldSpaceShading::ComputeMaterialShadingSimd8x(
+        const SurfacePointBatch& surface_points,
+        const std::size_t point_count,
+        const MATH::Vector3f& viewing_point,
+        const std::vector<LIGHTING::Light>& lights,
+        const ShadingSettings& shading_settings,
+        std::vector<Color>& colors)
+    {
+        constexpr std::size_t SIMD_LANE_COUNT = 8;
+        for (std::size_t first_point_index = 0; first_point_index < point_count; first_point_index += SIMD_LANE_COUNT)
+        {
+            ColorSimd8x point_colors = ComputeMaterialShading(surface_points, first_point_index, viewing_point, lights, shading_settings);
+            point_colors.Store(colors.data() + first_point_index);
+        }
+    }
 }
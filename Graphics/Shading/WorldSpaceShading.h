@@ -1,15 +1,23 @@
 #pragma once
 
+#include <cstddef>
 #include <vector>
 #include "Graphics/Color.h"
+#include "Graphics/ColorSimd8x.h"
 #include "Graphics/Shading/Lighting/Light.h"
 #include "Graphics/Shading/ShadingSettings.h"
+#include "Graphics/Shading/SurfacePointBatch.h"
 #include "Graphics/Surface.h"
 #include "Math/Vector3.h"
+#include "Processor/SimdIntrinsics.h"
 
 namespace GRAPHICS::SHADING
 {
     /// Encapsulates domain knowledge for shading algorithms done in world-space.
+    ///
+    /// Batches of points can be shaded together, in which case 8 points are shaded at a time with SIMD
+    /// instructions if supported by the CPU.  The SIMD shading produces exactly the same results as
+    /// non-SIMD shading of each point (outside of texture mapping, which isn't supported for batches).
     class WorldSpaceShading
     {
     public:
@@ -19,7 +27,7 @@ namespace GRAPHICS::SHADING
             const Surface& surface,
             const MATH::Vector3f& viewing_point,
             const std::vector<LIGHTING::Light>& lights,
-            const std::vector<float> shadow_factors_by_light_index,
+            const std::vector<float>& shadow_factors_by_light_index,
             const ShadingSettings& shading_settings);
 
         // SINGLE LIGHT SHADING.
@@ -30,5 +38,29 @@ namespace GRAPHICS::SHADING
             const LIGHTING::Light& light,
             float shadow_factor,
             const ShadingSettings& shading_settings);
+
+        // BATCH SHADING.
+        static void ComputeMaterialShading(
+            const SurfacePointBatch& surface_points,
+            const MATH::Vector3f& viewing_point,
+            const std::vector<LIGHTING::Light>& lights,
+            const ShadingSettings& shading_settings,
+            std::vector<Color>& colors);
+        SIMD_TARGET_AVX2 static ColorSimd8x ComputeMaterialShading(
+            const SurfacePointBatch& surface_points,
+            const std::size_t first_point_index,
+            const MATH::Vector3f& viewing_point,
+            const std::vector<LIGHTING::Light>& lights,
+            const ShadingSettings& shading_settings);
+
+    private:
+        // BATCH SHADING HELPERS.
+        SIMD_TARGET_AVX2 static void ComputeMaterialShadingSimd8x(
+            const SurfacePointBatch& surface_points,
+            const std::size_t point_count,
+            const MATH::Vector3f& viewing_point,
+            const std::vector<LIGHTING::Light>& lights,
+            const ShadingSettings& shading_settings,
+            std::vector<Color>& colors);
     };
 }
@@ -6,6 +6,12 @@ namespace GRAPHICS
     /// @return The material associated with the surface, if one exists; null otherwise.
     std::shared_ptr<Material> Surface::GetMaterial() const
     {
+        // USE ANY EXPLICIT MATERIAL FOR THE SURFACE.
+        if (Material)
+        {
+            return Material;
+        }
+
         // GET THE MATERIAL ASSOCIATED WITH THE APPOPRIATE KIND OF SHAPE.
         const GEOMETRY::Triangle* const* triangle = std::get_if<const GEOMETRY::Triangle*>(&Shape);
         const GEOMETRY::Sphere* const* sphere = std::get_if<const GEOMETRY::Sphere*>(&Shape);
@@ -29,6 +35,12 @@ namespace GRAPHICS
     /// @return The surface normal of the shape at the specified point.
     MATH::Vector3f Surface::GetNormal(const MATH::Vector3f& surface_point) const
     {
+        // USE ANY EXPLICIT NORMAL FOR THE SURFACE.
+        if (Normal)
+        {
+            return *Normal;
+        }
+
         // GET THE SURFACE NORMAL FOR THE APPOPRIATE KIND OF SHAPE.
         const GEOMETRY::Triangle* const* triangle = std::get_if<const GEOMETRY::Triangle*>(&Shape);
         const GEOMETRY::Sphere* const* sphere = std::get_if<const GEOMETRY::Sphere*>(&Shape);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <variant>
 #include "Graphics/Material.h"
 #include "Math/Vector3.h"
@@ -26,5 +27,11 @@ namespace GRAPHICS
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The underlying shape for the surface.  Memory is managed externally (outside of this class).
         std::variant<std::monostate, const GRAPHICS::GEOMETRY::Triangle*, const GRAPHICS::GEOMETRY::Sphere*> Shape = {};
+        /// A normal to use for the entire surface instead of the shape's normal, such as a vertex normal
+        /// when shading an individual vertex.  Only used if set.
+        std::optional<MATH::Vector3f> Normal = std::nullopt;
+        /// A material to use for the surface instead of the shape's material, such as when shading
+        /// a pixel whose shape is no longer known.  Only used if set.
+        std::shared_ptr<class Material> Material = nullptr;
     };
 }
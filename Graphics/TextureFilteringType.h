@@ -0,0 +1,18 @@
+#pragma once
+
+namespace GRAPHICS
+{
+    /// The different kinds of filtering that can be used when looking up texels from a texture
+    /// (https://en.wikipedia.org/wiki/Texture_filtering).
+    enum class TextureFilteringType
+    {
+        /// The nearest texel from the full-resolution texture is used.
+        /// Mipmaps are not used, so minified textures may alias and read memory in scattered locations.
+        NEAREST = 0,
+        /// Texels are bilinearly interpolated from the single mipmap level closest to the texture's screen-space size.
+        BILINEAR,
+        /// Texels are bilinearly interpolated from the two mipmap levels closest to the texture's screen-space size,
+        /// with results then linearly interpolated between the levels.
+        TRILINEAR,
+    };
+}
@@ -1,28 +1,24 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include "Graphics/TextureMappingAlgorithm.h"
 #include "Math/Number.h"
 
 namespace GRAPHICS
 {
-    /// Attempts to lookup a texel color from the texture at the given point on a triangle.
-    /// @param[in]  triangle - The triangle for which to lookup a texel.
-    /// @param[in]  triangle_point - The point potentially on the surface of the triangle for which to lookup the texel.
-    ///     Assumed to be on the surface of the triangle.  If not, then the value will be clamped.
-    /// @param[in]  texture - The texture in which to lookup the texel color.
-    /// @return The color from the texture at the given surface point on the triangle.
-    ///     If the point is not on the triangle, the point will be clamped to an appropriate edge for color lookup.
-    Color TextureMappingAlgorithm::LookupTexel(
+    /// Interpolates texture coordinates across a triangle.
+    /// @param[in]  triangle - The triangle whose vertices' texture coordinates to interpolate.
+    /// @param[in]  triangle_point - The point at which to interpolate texture coordinates.
+    ///     May be outside of the triangle, in which case texture coordinates are extrapolated.
+    /// @return The interpolated (unclamped) texture coordinates at the point.
+    MATH::Vector2f TextureMappingAlgorithm::InterpolateTextureCoordinates(
         const GEOMETRY::Triangle& triangle,
-        const MATH::Vector2f& triangle_point,
-        const IMAGES::Bitmap& texture)
+        const MATH::Vector2f& triangle_point)
     {
         // EXTRACT THE TEXTURE COORDINATES FROM THE TRIANGLE.
-        VertexWithAttributes first_vertex = triangle.Vertices[0];
-        VertexWithAttributes second_vertex = triangle.Vertices[1];
-        VertexWithAttributes third_vertex = triangle.Vertices[2];
-
-        const MATH::Vector2f& first_texture_coordinate = first_vertex.TextureCoordinates;
-        const MATH::Vector2f& second_texture_coordinate = second_vertex.TextureCoordinates;
-        const MATH::Vector2f& third_texture_coordinate = third_vertex.TextureCoordinates;
+        const MATH::Vector2f& first_texture_coordinate = triangle.Vertices[0].TextureCoordinates;
+        const MATH::Vector2f& second_texture_coordinate = triangle.Vertices[1].TextureCoordinates;
+        const MATH::Vector2f& third_texture_coordinate = triangle.Vertices[2].TextureCoordinates;
 
         // COMPUTE THE LOCATION OF THE POINT WITHIN THE TRIANGLE.
         MATH::Vector3f current_point_barycentric_coordinates = triangle.BarycentricCoordinates2DOf(triangle_point);
@@ -37,6 +33,108 @@ namespace GRAPHICS
             (current_point_barycentric_coordinates.X * second_texture_coordinate.Y) +
             (current_point_barycentric_coordinates.Y * third_texture_coordinate.Y) +
             (current_point_barycentric_coordinates.Z * first_texture_coordinate.Y));
+        return interpolated_texture_coordinate;
+    }
+
+    /// Computes the mipmap level of detail for a 2x2 quad of pixels based on the screen-space
+    /// derivatives of texture coordinates across the quad.
+    /// @param[in]  quad_top_left_texture_coordinates - The texture coordinates at the quad's top-left pixel.
+    /// @param[in]  quad_top_right_texture_coordinates - The texture coordinates at the quad's top-right pixel.
+    /// @param[in]  quad_bottom_left_texture_coordinates - The texture coordinates at the quad's bottom-left pixel.
+    /// @param[in]  texture - The texture for which to compute the level of detail.
+    /// @return The (unclamped) level of detail, where 0 is the full-resolution level, 1 is the next level, etc.
+    ///     Fractional values indicate a level between two integral levels.
+    float TextureMappingAlgorithm::ComputeMipmapLevel(
+        const MATH::Vector2f& quad_top_left_texture_coordinates,
+        const MATH::Vector2f& quad_top_right_texture_coordinates,
+        const MATH::Vector2f& quad_bottom_left_texture_coordinates,
+        const IMAGES::MipmappedTexture& texture)
+    {
+        // COMPUTE THE DERIVATIVES IN TERMS OF FULL-RESOLUTION TEXELS.
+        const IMAGES::MipmapLevel& full_resolution_level = texture.GetLevel(0);
+        float texture_width_in_pixels = static_cast<float>(full_resolution_level.WidthInPixels);
+        float texture_height_in_pixels = static_cast<float>(full_resolution_level.HeightInPixels);
+        float texel_x_per_pixel_x = (quad_top_right_texture_coordinates.X - quad_top_left_texture_coordinates.X) * texture_width_in_pixels;
+        float texel_y_per_pixel_x = (quad_top_right_texture_coordinates.Y - quad_top_left_texture_coordinates.Y) * texture_height_in_pixels;
+        float texel_x_per_pixel_y = (quad_bottom_left_texture_coordinates.X - quad_top_left_texture_coordinates.X) * texture_width_in_pixels;
+        float texel_y_per_pixel_y = (quad_bottom_left_texture_coordinates.Y - quad_top_left_texture_coordinates.Y) * texture_height_in_pixels;
+
+        // COMPUTE THE LEVEL OF DETAIL FROM THE LARGEST TEXEL FOOTPRINT.
+        // Since log2(sqrt(x)) = 0.5 * log2(x), squared lengths are used to avoid square roots.
+        float squared_texels_per_pixel_x = (texel_x_per_pixel_x * texel_x_per_pixel_x) + (texel_y_per_pixel_x * texel_y_per_pixel_x);
+        float squared_texels_per_pixel_y = (texel_x_per_pixel_y * texel_x_per_pixel_y) + (texel_y_per_pixel_y * texel_y_per_pixel_y);
+        float max_squared_texels_per_pixel = std::max(squared_texels_per_pixel_x, squared_texels_per_pixel_y);
+        float mipmap_level = 0.5f * std::log2(max_squared_texels_per_pixel);
+        return mipmap_level;
+    }
+
+    /// Computes mipmap levels of detail for 8 pixels at once based on the screen-space derivatives
+    /// of texture coordinates across the 2x2 quad containing each pixel.
+    /// @param[in]  quad_top_left_texture_coordinates - The texture coordinates at each quad's top-left pixel.
+    /// @param[in]  quad_top_right_texture_coordinates - The texture coordinates at each quad's top-right pixel.
+    /// @param[in]  quad_bottom_left_texture_coordinates - The texture coordinates at each quad's bottom-left pixel.
+    /// @param[in]  texture - The texture for which to compute the levels of detail.
+    /// @return The (unclamped) levels of detail.  These are approximations of the non-SIMD
+    ///     levels of detail, differing by less than 0.002 levels.
+    SIMD_TARGET_AVX2 __m256 TextureMappingAlgorithm::ComputeMipmapLevels(
+        const MATH::Vector2Simd8x& quad_top_left_texture_coordinates,
+        const MATH::Vector2Simd8x& quad_top_right_texture_coordinates,
+        const MATH::Vector2Simd8x& quad_bottom_left_texture_coordinates,
+        const IMAGES::MipmappedTexture& texture)
+    {
+        // COMPUTE THE DERIVATIVES IN TERMS OF FULL-RESOLUTION TEXELS.
+        const IMAGES::MipmapLevel& full_resolution_level = texture.GetLevel(0);
+        __m256 texture_width_in_pixels = _mm256_set1_ps(static_cast<float>(full_resolution_level.WidthInPixels));
+        __m256 texture_height_in_pixels = _mm256_set1_ps(static_cast<float>(full_resolution_level.HeightInPixels));
+        __m256 texel_x_per_pixel_x = _mm256_mul_ps(_mm256_sub_ps(quad_top_right_texture_coordinates.X, quad_top_left_texture_coordinates.X), texture_width_in_pixels);
+        __m256 texel_y_per_pixel_x = _mm256_mul_ps(_mm256_sub_ps(quad_top_right_texture_coordinates.Y, quad_top_left_texture_coordinates.Y), texture_height_in_pixels);
+        __m256 texel_x_per_pixel_y = _mm256_mul_ps(_mm256_sub_ps(quad_bottom_left_texture_coordinates.X, quad_top_left_texture_coordinates.X), texture_width_in_pixels);
+        __m256 texel_y_per_pixel_y = _mm256_mul_ps(_mm256_sub_ps(quad_bottom_left_texture_coordinates.Y, quad_top_left_texture_coordinates.Y), texture_height_in_pixels);
+
+        // FIND THE LARGEST TEXEL FOOTPRINT.
+        __m256 squared_texels_per_pixel_x = _mm256_add_ps(_mm256_mul_ps(texel_x_per_pixel_x, texel_x_per_pixel_x), _mm256_mul_ps(texel_y_per_pixel_x, texel_y_per_pixel_x));
+        __m256 squared_texels_per_pixel_y = _mm256_add_ps(_mm256_mul_ps(texel_x_per_pixel_y, texel_x_per_pixel_y), _mm256_mul_ps(texel_y_per_pixel_y, texel_y_per_pixel_y));
+        __m256 max_squared_texels_per_pixel = _mm256_max_ps(squared_texels_per_pixel_x, squared_texels_per_pixel_y);
+
+        // APPROXIMATE THE BASE-2 LOGARITHM OF THE FOOTPRINT.
+        // Since log2(mantissa * 2^exponent) = exponent + log2(mantissa), the exponent is extracted directly from
+        // the floating-point bits, and log2 of the mantissa in [1, 2) is approximated with a polynomial.
+        constexpr int MANTISSA_BIT_COUNT = 23;
+        constexpr int EXPONENT_BIAS = 127;
+        const __m256i MANTISSA_BIT_MASK = _mm256_set1_epi32(0x007FFFFF);
+        const __m256i ONE_EXPONENT_BITS = _mm256_set1_epi32(0x3F800000);
+        __m256i footprint_bits = _mm256_castps_si256(max_squared_texels_per_pixel);
+        __m256 exponents = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(footprint_bits, MANTISSA_BIT_COUNT), _mm256_set1_epi32(EXPONENT_BIAS)));
+        __m256 mantissas = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(footprint_bits, MANTISSA_BIT_MASK), ONE_EXPONENT_BITS));
+
+        // The polynomial is (m - 1) * (c0 + m * (c1 + m * c2)), which is exact for m = 1.
+        const __m256 ONE = _mm256_set1_ps(1.0f);
+        __m256 mantissa_log2_polynomial = _mm256_set1_ps(0.16555885f);
+        mantissa_log2_polynomial = _mm256_add_ps(_mm256_mul_ps(mantissa_log2_polynomial, mantissas), _mm256_set1_ps(-0.91885147f));
+        mantissa_log2_polynomial = _mm256_add_ps(_mm256_mul_ps(mantissa_log2_polynomial, mantissas), _mm256_set1_ps(2.17677794f));
+        __m256 mantissa_log2 = _mm256_mul_ps(_mm256_sub_ps(mantissas, ONE), mantissa_log2_polynomial);
+        __m256 footprint_log2 = _mm256_add_ps(exponents, mantissa_log2);
+
+        // COMPUTE THE LEVEL OF DETAIL.
+        // Since log2(sqrt(x)) = 0.5 * log2(x), the squared footprint is used to avoid square roots.
+        __m256 mipmap_levels = _mm256_mul_ps(_mm256_set1_ps(0.5f), footprint_log2);
+        return mipmap_levels;
+    }
+
+    /// Attempts to lookup a texel color from the texture at the given point on a triangle.
+    /// @param[in]  triangle - The triangle for which to lookup a texel.
+    /// @param[in]  triangle_point - The point potentially on the surface of the triangle for which to lookup the texel.
+    ///     Assumed to be on the surface of the triangle.  If not, then the value will be clamped.
+    /// @param[in]  texture - The texture in which to lookup the texel color.
+    /// @return The color from the texture at the given surface point on the triangle.
+    ///     If the point is not on the triangle, the point will be clamped to an appropriate edge for color lookup.
+    Color TextureMappingAlgorithm::LookupTexel(
+        const GEOMETRY::Triangle& triangle,
+        const MATH::Vector2f& triangle_point,
+        const IMAGES::Bitmap& texture)
+    {
+        // INTERPOLATE THE TEXTURE COORDINATES ACROSS THE TRIANGLE.
+        MATH::Vector2f interpolated_texture_coordinate = InterpolateTextureCoordinates(triangle, triangle_point);
 
         // CLAMP THE TEXTURE COORDINATES TO THE VALID RANGE.
         constexpr float MIN_TEXTURE_COORDINATE = 0.0f;
@@ -56,4 +154,436 @@ namespace GRAPHICS
         Color texel_color = texture.GetPixel(texture_pixel_x_coordinate, texture_pixel_y_coordinate);
         return texel_color;
     }
+
+    /// Looks up a filtered texel color from a mipmapped texture at the given point on a triangle.
+    /// The mipmap level is selected based on how texture coordinates change across the 2x2 quad of pixels
+    /// containing the point (with quads aligned to even pixel coordinates).
+    /// @param[in]  triangle - The triangle for which to lookup a texel.
+    /// @param[in]  triangle_point - The point on the surface of the triangle for which to lookup the texel.
+    /// @param[in]  filtering_type - The type of filtering to use.
+    /// @param[in]  texture - The texture in which to lookup the texel color.
+    /// @return The filtered color from the texture at the given surface point on the triangle.
+    Color TextureMappingAlgorithm::LookupTexel(
+        const GEOMETRY::Triangle& triangle,
+        const MATH::Vector2f& triangle_point,
+        const TextureFilteringType filtering_type,
+        const IMAGES::MipmappedTexture& texture)
+    {
+        // INTERPOLATE THE TEXTURE COORDINATES AT THE POINT.
+        MATH::Vector2f texture_coordinates = InterpolateTextureCoordinates(triangle, triangle_point);
+
+        // LOOK UP THE TEXEL DIRECTLY IF NO MIPMAP LEVEL IS NEEDED.
+        // Nearest filtering always uses the full-resolution level.
+        if (TextureFilteringType::NEAREST == filtering_type)
+        {
+            constexpr float FULL_RESOLUTION_MIPMAP_LEVEL = 0.0f;
+            Color texel_color = LookupTexel(texture_coordinates, FULL_RESOLUTION_MIPMAP_LEVEL, filtering_type, texture);
+            return texel_color;
+        }
+
+        // INTERPOLATE THE TEXTURE COORDINATES AT THE CORNERS OF THE PIXEL QUAD CONTAINING THE POINT.
+        constexpr float PIXELS_PER_QUAD_DIMENSION = 2.0f;
+        float quad_left_x = PIXELS_PER_QUAD_DIMENSION * std::floor(std::round(triangle_point.X) / PIXELS_PER_QUAD_DIMENSION);
+        float quad_top_y = PIXELS_PER_QUAD_DIMENSION * std::floor(std::round(triangle_point.Y) / PIXELS_PER_QUAD_DIMENSION);
+        constexpr float ONE_PIXEL = 1.0f;
+        MATH::Vector2f quad_top_left_texture_coordinates = InterpolateTextureCoordinates(triangle, MATH::Vector2f(quad_left_x, quad_top_y));
+        MATH::Vector2f quad_top_right_texture_coordinates = InterpolateTextureCoordinates(triangle, MATH::Vector2f(quad_left_x + ONE_PIXEL, quad_top_y));
+        MATH::Vector2f quad_bottom_left_texture_coordinates = InterpolateTextureCoordinates(triangle, MATH::Vector2f(quad_left_x, quad_top_y + ONE_PIXEL));
+
+        // LOOK UP THE TEXEL AT THE APPROPRIATE MIPMAP LEVEL.
+        float mipmap_level = ComputeMipmapLevel(
+            quad_top_left_texture_coordinates,
+            quad_top_right_texture_coordinates,
+            quad_bottom_left_texture_coordinates,
+            texture);
+        Color texel_color = LookupTexel(texture_coordinates, mipmap_level, filtering_type, texture);
+        return texel_color;
+    }
+
+    /// Looks up a filtered texel color from a mipmapped texture.
+    /// @param[in]  texture_coordinates - The texture coordinates to look up.  Will be clamped to the valid range.
+    /// @param[in]  mipmap_level - The mipmap level of detail for the lookup.  Will be clamped to the valid range.
+    ///     Ignored for nearest filtering, which always uses the full-resolution level.
+    /// @param[in]  filtering_type - The type of filtering to use.
+    /// @param[in]  texture - The texture in which to lookup the texel color.
+    /// @return The filtered color from the texture.
+    Color TextureMappingAlgorithm::LookupTexel(
+        const MATH::Vector2f& texture_coordinates,
+        const float mipmap_level,
+        const TextureFilteringType filtering_type,
+        const IMAGES::MipmappedTexture& texture)
+    {
+        // CLAMP THE TEXTURE COORDINATES TO THE VALID RANGE.
+        constexpr float MIN_TEXTURE_COORDINATE = 0.0f;
+        constexpr float MAX_TEXTURE_COORDINATE = 1.0f;
+        MATH::Vector2f clamped_texture_coordinates(
+            MATH::Number::Clamp<float>(texture_coordinates.X, MIN_TEXTURE_COORDINATE, MAX_TEXTURE_COORDINATE),
+            MATH::Number::Clamp<float>(texture_coordinates.Y, MIN_TEXTURE_COORDINATE, MAX_TEXTURE_COORDINATE));
+
+        // CLAMP THE MIPMAP LEVEL TO THE VALID RANGE.
+        constexpr float MIN_MIPMAP_LEVEL = 0.0f;
+        float max_mipmap_level = static_cast<float>(texture.GetLevelCount() - 1);
+        float clamped_mipmap_level = MATH::Number::Clamp<float>(mipmap_level, MIN_MIPMAP_LEVEL, max_mipmap_level);
+
+        // LOOK UP THE TEXEL BASED ON THE TYPE OF FILTERING.
+        switch (filtering_type)
+        {
+            case TextureFilteringType::BILINEAR:
+            {
+                // FILTER WITHIN THE NEAREST LEVEL.
+                constexpr float HALF_LEVEL = 0.5f;
+                std::size_t nearest_level_index = static_cast<std::size_t>(std::floor(clamped_mipmap_level + HALF_LEVEL));
+                Color texel_color = LookupBilinearTexel(clamped_texture_coordinates, nearest_level_index, texture);
+                return texel_color;
+            }
+            case TextureFilteringType::TRILINEAR:
+            {
+                // FILTER WITHIN THE TWO NEAREST LEVELS.
+                float lower_level = std::floor(clamped_mipmap_level);
+                std::size_t lower_level_index = static_cast<std::size_t>(lower_level);
+                std::size_t upper_level_index = std::min(lower_level_index + 1, texture.GetLevelCount() - 1);
+                Color lower_level_texel_color = LookupBilinearTexel(clamped_texture_coordinates, lower_level_index, texture);
+                Color upper_level_texel_color = LookupBilinearTexel(clamped_texture_coordinates, upper_level_index, texture);
+
+                // INTERPOLATE BETWEEN THE LEVELS.
+                float ratio_toward_upper_level = clamped_mipmap_level - lower_level;
+                Color texel_color = InterpolateColors(lower_level_texel_color, upper_level_texel_color, ratio_toward_upper_level);
+                return texel_color;
+            }
+            case TextureFilteringType::NEAREST:
+            default:
+            {
+                // LOOK UP THE NEAREST TEXEL IN THE FULL-RESOLUTION LEVEL.
+                // This uses the same addressing as non-mipmapped textures.
+                const IMAGES::MipmapLevel& full_resolution_level = texture.GetLevel(0);
+                unsigned int max_texture_pixel_x_coordinate = full_resolution_level.WidthInPixels - 1;
+                unsigned int texture_pixel_x_coordinate = static_cast<unsigned int>(max_texture_pixel_x_coordinate * clamped_texture_coordinates.X);
+                unsigned int max_texture_pixel_y_coordinate = full_resolution_level.HeightInPixels - 1;
+                unsigned int texture_pixel_y_coordinate = static_cast<unsigned int>(max_texture_pixel_y_coordinate * clamped_texture_coordinates.Y);
+
+                uint32_t packed_texel_color = texture.GetTexel(0, texture_pixel_x_coordinate, texture_pixel_y_coordinate);
+                Color texel_color = Color::Unpack(packed_texel_color, texture.GetColorFormat());
+                return texel_color;
+            }
+        }
+    }
+
+    /// Looks up 8 texel colors from the texture at the given texture coordinates using SIMD operations.
+    /// Texels are looked up with the same nearest-neighbor addressing as the non-SIMD version.
+    /// @param[in]  texture_coordinates - The texture coordinates to look up.  Will be clamped to the valid range.
+    /// @param[in]  texel_mask - A mask indicating which texels to look up.  Only lanes with all bits set are
+    ///     read from texture memory; other lanes are left as zero (transparent black).
+    /// @param[in]  texture - The texture in which to lookup the texel colors.
+    /// @return The colors from the texture at the given texture coordinates.
+    SIMD_TARGET_AVX2 ColorSimd8x TextureMappingAlgorithm::LookupTexels(
+        const MATH::Vector2Simd8x& texture_coordinates,
+        const __m256 texel_mask,
+        const IMAGES::Bitmap& texture)
+    {
+        // CLAMP THE TEXTURE COORDINATES TO THE VALID RANGE.
+        const __m256 MIN_TEXTURE_COORDINATE = _mm256_set1_ps(0.0f);
+        const __m256 MAX_TEXTURE_COORDINATE = _mm256_set1_ps(1.0f);
+        __m256 clamped_texture_x_coordinates = _mm256_min_ps(_mm256_max_ps(texture_coordinates.X, MIN_TEXTURE_COORDINATE), MAX_TEXTURE_COORDINATE);
+        __m256 clamped_texture_y_coordinates = _mm256_min_ps(_mm256_max_ps(texture_coordinates.Y, MIN_TEXTURE_COORDINATE), MAX_TEXTURE_COORDINATE);
+
+        // COMPUTE THE TEXEL ADDRESSES.
+        unsigned int texture_width_in_pixels = texture.GetWidthInPixels();
+        unsigned int max_texture_pixel_x_coordinate = texture_width_in_pixels - 1;
+        __m256i texture_pixel_x_coordinates = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_set1_ps(static_cast<float>(max_texture_pixel_x_coordinate)), clamped_texture_x_coordinates));
+
+        unsigned int texture_height_in_pixels = texture.GetHeightInPixels();
+        unsigned int max_texture_pixel_y_coordinate = texture_height_in_pixels - 1;
+        __m256i texture_pixel_y_coordinates = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_set1_ps(static_cast<float>(max_texture_pixel_y_coordinate)), clamped_texture_y_coordinates));
+
+        __m256i texel_row_offsets = _mm256_mullo_epi32(texture_pixel_y_coordinates, _mm256_set1_epi32(static_cast<int>(texture_width_in_pixels)));
+        __m256i texel_indices = _mm256_add_epi32(texel_row_offsets, texture_pixel_x_coordinates);
+
+        // GATHER THE TEXELS FROM THE TEXTURE.
+        constexpr int TEXEL_BYTE_COUNT = sizeof(uint32_t);
+        const int* texels = reinterpret_cast<const int*>(texture.GetRawData());
+        __m256i packed_texel_colors = _mm256_mask_i32gather_epi32(
+            _mm256_setzero_si256(),
+            texels,
+            texel_indices,
+            _mm256_castps_si256(texel_mask),
+            TEXEL_BYTE_COUNT);
+
+        // UNPACK THE TEXEL COLORS.
+        ColorSimd8x texel_colors = ColorSimd8x::Unpack(packed_texel_colors, texture.GetColorFormat());
+        return texel_colors;
+    }
+
+    /// Looks up 8 filtered texel colors from a mipmapped texture using SIMD operations.
+    /// Results match the non-SIMD version to within floating-point rounding differences.
+    /// @param[in]  texture_coordinates - The texture coordinates to look up.  Will be clamped to the valid range.
+    /// @param[in]  mipmap_levels - The mipmap levels of detail for the lookups.  Will be clamped to the valid range.
+    ///     Ignored for nearest filtering, which always uses the full-resolution level.
+    /// @param[in]  filtering_type - The type of filtering to use.
+    /// @param[in]  texel_mask - A mask indicating which texels to look up.  Only lanes with all bits set are
+    ///     read from texture memory; other lanes are left as zero (transparent black).
+    /// @param[in]  texture - The texture in which to lookup the texel colors.
+    /// @return The filtered colors from the texture.
+    SIMD_TARGET_AVX2 ColorSimd8x TextureMappingAlgorithm::LookupTexels(
+        const MATH::Vector2Simd8x& texture_coordinates,
+        const __m256 mipmap_levels,
+        const TextureFilteringType filtering_type,
+        const __m256 texel_mask,
+        const IMAGES::MipmappedTexture& texture)
+    {
+        // CLAMP THE MIPMAP LEVELS TO THE VALID RANGE.
+        int max_mipmap_level_index = static_cast<int>(texture.GetLevelCount() - 1);
+        const __m256 MIN_MIPMAP_LEVEL = _mm256_set1_ps(0.0f);
+        const __m256 MAX_MIPMAP_LEVEL = _mm256_set1_ps(static_cast<float>(max_mipmap_level_index));
+        __m256 clamped_mipmap_levels = _mm256_min_ps(_mm256_max_ps(mipmap_levels, MIN_MIPMAP_LEVEL), MAX_MIPMAP_LEVEL);
+
+        // LOOK UP THE TEXELS BASED ON THE TYPE OF FILTERING.
+        switch (filtering_type)
+        {
+            case TextureFilteringType::BILINEAR:
+            {
+                // FILTER WITHIN THE NEAREST LEVELS.
+                const __m256 HALF_LEVEL = _mm256_set1_ps(0.5f);
+                __m256i nearest_level_indices = _mm256_cvttps_epi32(_mm256_floor_ps(_mm256_add_ps(clamped_mipmap_levels, HALF_LEVEL)));
+                ColorSimd8x texel_colors = LookupBilinearTexels(texture_coordinates, nearest_level_indices, texel_mask, texture);
+                return texel_colors;
+            }
+            case TextureFilteringType::TRILINEAR:
+            {
+                // FILTER WITHIN THE TWO NEAREST LEVELS.
+                __m256 lower_levels = _mm256_floor_ps(clamped_mipmap_levels);
+                __m256i lower_level_indices = _mm256_cvttps_epi32(lower_levels);
+                __m256i upper_level_indices = _mm256_min_epi32(
+                    _mm256_add_epi32(lower_level_indices, _mm256_set1_epi32(1)),
+                    _mm256_set1_epi32(max_mipmap_level_index));
+                ColorSimd8x lower_level_texel_colors = LookupBilinearTexels(texture_coordinates, lower_level_indices, texel_mask, texture);
+                ColorSimd8x upper_level_texel_colors = LookupBilinearTexels(texture_coordinates, upper_level_indices, texel_mask, texture);
+
+                // INTERPOLATE BETWEEN THE LEVELS.
+                __m256 ratios_toward_upper_levels = _mm256_sub_ps(clamped_mipmap_levels, lower_levels);
+                ColorSimd8x texel_colors = InterpolateColors(lower_level_texel_colors, upper_level_texel_colors, ratios_toward_upper_levels);
+                return texel_colors;
+            }
+            case TextureFilteringType::NEAREST:
+            default:
+            {
+                // CLAMP THE TEXTURE COORDINATES TO THE VALID RANGE.
+                const __m256 MIN_TEXTURE_COORDINATE = _mm256_set1_ps(0.0f);
+                const __m256 MAX_TEXTURE_COORDINATE = _mm256_set1_ps(1.0f);
+                __m256 clamped_texture_x_coordinates = _mm256_min_ps(_mm256_max_ps(texture_coordinates.X, MIN_TEXTURE_COORDINATE), MAX_TEXTURE_COORDINATE);
+                __m256 clamped_texture_y_coordinates = _mm256_min_ps(_mm256_max_ps(texture_coordinates.Y, MIN_TEXTURE_COORDINATE), MAX_TEXTURE_COORDINATE);
+
+                // COMPUTE THE TEXEL ADDRESSES IN THE FULL-RESOLUTION LEVEL.
+                // This uses the same addressing as non-mipmapped textures.
+                const IMAGES::MipmapLevel& full_resolution_level = texture.GetLevel(0);
+                unsigned int max_texture_pixel_x_coordinate = full_resolution_level.WidthInPixels - 1;
+                __m256i texture_pixel_x_coordinates = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_set1_ps(static_cast<float>(max_texture_pixel_x_coordinate)), clamped_texture_x_coordinates));
+                unsigned int max_texture_pixel_y_coordinate = full_resolution_level.HeightInPixels - 1;
+                __m256i texture_pixel_y_coordinates = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_set1_ps(static_cast<float>(max_texture_pixel_y_coordinate)), clamped_texture_y_coordinates));
+
+                __m256i texel_indices = ComputeTexelIndices(
+                    _mm256_set1_epi32(static_cast<int>(full_resolution_level.FirstTexelIndex)),
+                    _mm256_set1_epi32(static_cast<int>(full_resolution_level.TileRowTexelCount)),
+                    texture_pixel_x_coordinates,
+                    texture_pixel_y_coordinates,
+                    texture);
+
+                // GATHER AND UNPACK THE TEXELS.
+                constexpr int TEXEL_BYTE_COUNT = sizeof(uint32_t);
+                const int* texels = reinterpret_cast<const int*>(texture.GetRawData());
+                __m256i packed_texel_colors = _mm256_mask_i32gather_epi32(
+                    _mm256_setzero_si256(),
+                    texels,
+                    texel_indices,
+                    _mm256_castps_si256(texel_mask),
+                    TEXEL_BYTE_COUNT);
+                ColorSimd8x texel_colors = ColorSimd8x::Unpack(packed_texel_colors, texture.GetColorFormat());
+                return texel_colors;
+            }
+        }
+    }
+
+    /// Looks up a bilinearly filtered texel color within a single mipmap level.
+    /// Texel centers are treated as being at half-integer coordinates, with addressing clamped to the level's edges.
+    /// @param[in]  texture_coordinates - The texture coordinates to look up.  Expected to already be clamped.
+    /// @param[in]  level_index - The index of the mipmap level in which to look up the texel.
+    /// @param[in]  texture - The texture in which to lookup the texel color.
+    /// @return The bilinearly filtered color from the texture.
+    Color TextureMappingAlgorithm::LookupBilinearTexel(
+        const MATH::Vector2f& texture_coordinates,
+        const std::size_t level_index,
+        const IMAGES::MipmappedTexture& texture)
+    {
+        // FIND THE 2x2 BLOCK OF TEXELS SURROUNDING THE TEXTURE COORDINATES.
+        const IMAGES::MipmapLevel& level = texture.GetLevel(level_index);
+        constexpr float TEXEL_CENTER_OFFSET = 0.5f;
+        float texel_x = (texture_coordinates.X * static_cast<float>(level.WidthInPixels)) - TEXEL_CENTER_OFFSET;
+        float texel_y = (texture_coordinates.Y * static_cast<float>(level.HeightInPixels)) - TEXEL_CENTER_OFFSET;
+        float left_texel_x = std::floor(texel_x);
+        float top_texel_y = std::floor(texel_y);
+
+        constexpr int MIN_TEXEL_COORDINATE = 0;
+        int max_texel_x = static_cast<int>(level.WidthInPixels) - 1;
+        int max_texel_y = static_cast<int>(level.HeightInPixels) - 1;
+        unsigned int left_x = static_cast<unsigned int>(std::clamp(static_cast<int>(left_texel_x), MIN_TEXEL_COORDINATE, max_texel_x));
+        unsigned int right_x = static_cast<unsigned int>(std::clamp(static_cast<int>(left_texel_x) + 1, MIN_TEXEL_COORDINATE, max_texel_x));
+        unsigned int top_y = static_cast<unsigned int>(std::clamp(static_cast<int>(top_texel_y), MIN_TEXEL_COORDINATE, max_texel_y));
+        unsigned int bottom_y = static_cast<unsigned int>(std::clamp(static_cast<int>(top_texel_y) + 1, MIN_TEXEL_COORDINATE, max_texel_y));
+
+        // GET THE COLORS OF THE TEXELS.
+        ColorFormat color_format = texture.GetColorFormat();
+        Color top_left_color = Color::Unpack(texture.GetTexel(level_index, left_x, top_y), color_format);
+        Color top_right_color = Color::Unpack(texture.GetTexel(level_index, right_x, top_y), color_format);
+        Color bottom_left_color = Color::Unpack(texture.GetTexel(level_index, left_x, bottom_y), color_format);
+        Color bottom_right_color = Color::Unpack(texture.GetTexel(level_index, right_x, bottom_y), color_format);
+
+        // INTERPOLATE BETWEEN THE TEXELS.
+        float ratio_toward_right = texel_x - left_texel_x;
+        float ratio_toward_bottom = texel_y - top_texel_y;
+        Color top_color = InterpolateColors(top_left_color, top_right_color, ratio_toward_right);
+        Color bottom_color = InterpolateColors(bottom_left_color, bottom_right_color, ratio_toward_right);
+        Color texel_color = InterpolateColors(top_color, bottom_color, ratio_toward_bottom);
+        return texel_color;
+    }
+
+    /// Looks up 8 bilinearly filtered texel colors using SIMD operations, with each texel potentially from a different mipmap level.
+    /// @param[in]  texture_coordinates - The texture coordinates to look up.  Will be clamped to the valid range.
+    /// @param[in]  level_indices - The indices of the mipmap levels in which to look up the texels.  Must be valid indices.
+    /// @param[in]  texel_mask - A mask indicating which texels to look up.
+    /// @param[in]  texture - The texture in which to lookup the texel colors.
+    /// @return The bilinearly filtered colors from the texture.
+    SIMD_TARGET_AVX2 ColorSimd8x TextureMappingAlgorithm::LookupBilinearTexels(
+        const MATH::Vector2Simd8x& texture_coordinates,
+        const __m256i level_indices,
+        const __m256 texel_mask,
+        const IMAGES::MipmappedTexture& texture)
+    {
+        // CLAMP THE TEXTURE COORDINATES TO THE VALID RANGE.
+        const __m256 MIN_TEXTURE_COORDINATE = _mm256_set1_ps(0.0f);
+        const __m256 MAX_TEXTURE_COORDINATE = _mm256_set1_ps(1.0f);
+        __m256 clamped_texture_x_coordinates = _mm256_min_ps(_mm256_max_ps(texture_coordinates.X, MIN_TEXTURE_COORDINATE), MAX_TEXTURE_COORDINATE);
+        __m256 clamped_texture_y_coordinates = _mm256_min_ps(_mm256_max_ps(texture_coordinates.Y, MIN_TEXTURE_COORDINATE), MAX_TEXTURE_COORDINATE);
+
+        // GATHER INFORMATION ABOUT THE LEVEL FOR EACH TEXEL.
+        // Level fields are all 32-bit, so they can be gathered directly from the array of levels.
+        static_assert(sizeof(IMAGES::MipmapLevel) == 4 * sizeof(uint32_t), "Mipmap levels must be tightly packed for SIMD gathers.");
+        constexpr int FIELD_BYTE_COUNT = sizeof(uint32_t);
+        constexpr int FIELDS_PER_LEVEL = sizeof(IMAGES::MipmapLevel) / sizeof(uint32_t);
+        const int* level_fields = reinterpret_cast<const int*>(texture.GetLevels().data());
+        __m256i level_field_offsets = _mm256_mullo_epi32(level_indices, _mm256_set1_epi32(FIELDS_PER_LEVEL));
+        __m256i level_widths = _mm256_i32gather_epi32(level_fields + offsetof(IMAGES::MipmapLevel, WidthInPixels) / FIELD_BYTE_COUNT, level_field_offsets, FIELD_BYTE_COUNT);
+        __m256i level_heights = _mm256_i32gather_epi32(level_fields + offsetof(IMAGES::MipmapLevel, HeightInPixels) / FIELD_BYTE_COUNT, level_field_offsets, FIELD_BYTE_COUNT);
+        __m256i level_first_texel_indices = _mm256_i32gather_epi32(level_fields + offsetof(IMAGES::MipmapLevel, FirstTexelIndex) / FIELD_BYTE_COUNT, level_field_offsets, FIELD_BYTE_COUNT);
+        __m256i level_tile_row_texel_counts = _mm256_i32gather_epi32(level_fields + offsetof(IMAGES::MipmapLevel, TileRowTexelCount) / FIELD_BYTE_COUNT, level_field_offsets, FIELD_BYTE_COUNT);
+
+        // FIND THE 2x2 BLOCKS OF TEXELS SURROUNDING THE TEXTURE COORDINATES.
+        const __m256 TEXEL_CENTER_OFFSET = _mm256_set1_ps(0.5f);
+        __m256 texel_x = _mm256_sub_ps(_mm256_mul_ps(clamped_texture_x_coordinates, _mm256_cvtepi32_ps(level_widths)), TEXEL_CENTER_OFFSET);
+        __m256 texel_y = _mm256_sub_ps(_mm256_mul_ps(clamped_texture_y_coordinates, _mm256_cvtepi32_ps(level_heights)), TEXEL_CENTER_OFFSET);
+        __m256 left_texel_x = _mm256_floor_ps(texel_x);
+        __m256 top_texel_y = _mm256_floor_ps(texel_y);
+
+        const __m256i MIN_TEXEL_COORDINATE = _mm256_setzero_si256();
+        const __m256i ONE_TEXEL = _mm256_set1_epi32(1);
+        __m256i max_texel_x = _mm256_sub_epi32(level_widths, ONE_TEXEL);
+        __m256i max_texel_y = _mm256_sub_epi32(level_heights, ONE_TEXEL);
+        __m256i unclamped_left_x = _mm256_cvttps_epi32(left_texel_x);
+        __m256i unclamped_top_y = _mm256_cvttps_epi32(top_texel_y);
+        __m256i left_x = _mm256_min_epi32(_mm256_max_epi32(unclamped_left_x, MIN_TEXEL_COORDINATE), max_texel_x);
+        __m256i right_x = _mm256_min_epi32(_mm256_max_epi32(_mm256_add_epi32(unclamped_left_x, ONE_TEXEL), MIN_TEXEL_COORDINATE), max_texel_x);
+        __m256i top_y = _mm256_min_epi32(_mm256_max_epi32(unclamped_top_y, MIN_TEXEL_COORDINATE), max_texel_y);
+        __m256i bottom_y = _mm256_min_epi32(_mm256_max_epi32(_mm256_add_epi32(unclamped_top_y, ONE_TEXEL), MIN_TEXEL_COORDINATE), max_texel_y);
+
+        __m256i top_left_texel_indices = ComputeTexelIndices(level_first_texel_indices, level_tile_row_texel_counts, left_x, top_y, texture);
+        __m256i top_right_texel_indices = ComputeTexelIndices(level_first_texel_indices, level_tile_row_texel_counts, right_x, top_y, texture);
+        __m256i bottom_left_texel_indices = ComputeTexelIndices(level_first_texel_indices, level_tile_row_texel_counts, left_x, bottom_y, texture);
+        __m256i bottom_right_texel_indices = ComputeTexelIndices(level_first_texel_indices, level_tile_row_texel_counts, right_x, bottom_y, texture);
+
+        // GATHER THE COLORS OF THE TEXELS.
+        constexpr int TEXEL_BYTE_COUNT = sizeof(uint32_t);
+        const int* texels = reinterpret_cast<const int*>(texture.GetRawData());
+        __m256i gather_mask = _mm256_castps_si256(texel_mask);
+        ColorFormat color_format = texture.GetColorFormat();
+        ColorSimd8x top_left_colors = ColorSimd8x::Unpack(
+            _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), texels, top_left_texel_indices, gather_mask, TEXEL_BYTE_COUNT),
+            color_format);
+        ColorSimd8x top_right_colors = ColorSimd8x::Unpack(
+            _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), texels, top_right_texel_indices, gather_mask, TEXEL_BYTE_COUNT),
+            color_format);
+        ColorSimd8x bottom_left_colors = ColorSimd8x::Unpack(
+            _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), texels, bottom_left_texel_indices, gather_mask, TEXEL_BYTE_COUNT),
+            color_format);
+        ColorSimd8x bottom_right_colors = ColorSimd8x::Unpack(
+            _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), texels, bottom_right_texel_indices, gather_mask, TEXEL_BYTE_COUNT),
+            color_format);
+
+        // INTERPOLATE BETWEEN THE TEXELS.
+        __m256 ratios_toward_right = _mm256_sub_ps(texel_x, left_texel_x);
+        __m256 ratios_toward_bottom = _mm256_sub_ps(texel_y, top_texel_y);
+        ColorSimd8x top_colors = InterpolateColors(top_left_colors, top_right_colors, ratios_toward_right);
+        ColorSimd8x bottom_colors = InterpolateColors(bottom_left_colors, bottom_right_colors, ratios_toward_right);
+        ColorSimd8x texel_colors = InterpolateColors(top_colors, bottom_colors, ratios_toward_bottom);
+        return texel_colors;
+    }
+
+    /// Computes the indices of 8 texels within the raw texels of a texture using SIMD operations.
+    /// This mirrors @ref IMAGES::MipmappedTexture::GetTexelIndex, with the texture's memory layout
+    /// handled via shifts and masks rather than branching.
+    /// @param[in]  first_texel_indices - The first texel index of the level containing each texel.
+    /// @param[in]  tile_row_texel_counts - The number of texels per row of tiles in the level containing each texel.
+    /// @param[in]  x - The horizontal coordinates of the texels within their levels.
+    /// @param[in]  y - The vertical coordinates of the texels within their levels.
+    /// @param[in]  texture - The texture containing the texels.
+    /// @return The indices of the texels.
+    SIMD_TARGET_AVX2 __m256i TextureMappingAlgorithm::ComputeTexelIndices(
+        const __m256i first_texel_indices,
+        const __m256i tile_row_texel_counts,
+        const __m256i x,
+        const __m256i y,
+        const IMAGES::MipmappedTexture& texture)
+    {
+        uint32_t tile_dimension_bit_shift = texture.GetTileDimensionBitShift();
+        __m128i tile_dimension_bit_shift_count = _mm_cvtsi32_si128(static_cast<int>(tile_dimension_bit_shift));
+        __m128i tile_texel_count_bit_shift_count = _mm_cvtsi32_si128(static_cast<int>(2 * tile_dimension_bit_shift));
+        __m256i tile_dimension_mask = _mm256_set1_epi32(static_cast<int>((1u << tile_dimension_bit_shift) - 1));
+
+        __m256i tile_row_offsets = _mm256_mullo_epi32(_mm256_srl_epi32(y, tile_dimension_bit_shift_count), tile_row_texel_counts);
+        __m256i tile_offsets = _mm256_sll_epi32(_mm256_srl_epi32(x, tile_dimension_bit_shift_count), tile_texel_count_bit_shift_count);
+        __m256i offsets_within_tiles = _mm256_add_epi32(
+            _mm256_sll_epi32(_mm256_and_si256(y, tile_dimension_mask), tile_dimension_bit_shift_count),
+            _mm256_and_si256(x, tile_dimension_mask));
+        __m256i texel_indices = _mm256_add_epi32(
+            _mm256_add_epi32(first_texel_indices, tile_row_offsets),
+            _mm256_add_epi32(tile_offsets, offsets_within_tiles));
+        return texel_indices;
+    }
+
+    /// Linearly interpolates between all components of two colors.
+    /// @param[in]  start_color - The color at the start of the interpolation.
+    /// @param[in]  end_color - The color at the end of the interpolation.
+    /// @param[in]  ratio_toward_end - The ratio [0, 1] of the way from the start to the end color.
+    /// @return The interpolated color.
+    Color TextureMappingAlgorithm::InterpolateColors(const Color& start_color, const Color& end_color, const float ratio_toward_end)
+    {
+        Color interpolated_color(
+            start_color.Red + ratio_toward_end * (end_color.Red - start_color.Red),
+            start_color.Green + ratio_toward_end * (end_color.Green - start_color.Green),
+            start_color.Blue + ratio_toward_end * (end_color.Blue - start_color.Blue),
+            start_color.Alpha + ratio_toward_end * (end_color.Alpha - start_color.Alpha));
+        return interpolated_color;
+    }
+
+    /// Linearly interpolates between all components of 8 pairs of colors.
+    /// @param[in]  start_colors - The colors at the start of the interpolation.
+    /// @param[in]  end_colors - The colors at the end of the interpolation.
+    /// @param[in]  ratios_toward_end - The ratios [0, 1] of the way from the start to the end colors.
+    /// @return The interpolated colors.
+    SIMD_TARGET_AVX2 ColorSimd8x TextureMappingAlgorithm::InterpolateColors(const ColorSimd8x& start_colors, const ColorSimd8x& end_colors, const __m256 ratios_toward_end)
+    {
+        ColorSimd8x interpolated_colors;
+        interpolated_colors.Red = _mm256_add_ps(start_colors.Red, _mm256_mul_ps(ratios_toward_end, _mm256_sub_ps(end_colors.Red, start_colors.Red)));
+        interpolated_colors.Green = _mm256_add_ps(start_colors.Green, _mm256_mul_ps(ratios_toward_end, _mm256_sub_ps(end_colors.Green, start_colors.Green)));
+        interpolated_colors.Blue = _mm256_add_ps(start_colors.Blue, _mm256_mul_ps(ratios_toward_end, _mm256_sub_ps(end_colors.Blue, start_colors.Blue)));
+        interpolated_colors.Alpha = _mm256_add_ps(start_colors.Alpha, _mm256_mul_ps(ratios_toward_end, _mm256_sub_ps(end_colors.Alpha, start_colors.Alpha)));
+        return interpolated_colors;
+    }
 }
@@ -1,9 +1,14 @@
 #pragma once
 
+#include <cstddef>
 #include "Graphics/Color.h"
+#include "Graphics/ColorSimd8x.h"
 #include "Graphics/Geometry/Triangle.h"
 #include "Graphics/Images/Bitmap.h"
+#include "Graphics/Images/MipmappedTexture.h"
+#include "Graphics/TextureFilteringType.h"
 #include "Math/Vector2.h"
+#include "Processor/SimdIntrinsics.h"
 
 namespace GRAPHICS
 {
@@ -12,9 +17,67 @@ namespace GRAPHICS
     class TextureMappingAlgorithm
     {
     public:
+        // TEXTURE COORDINATES.
+        static MATH::Vector2f InterpolateTextureCoordinates(
+            const GEOMETRY::Triangle& triangle,
+            const MATH::Vector2f& triangle_point);
+
+        // MIPMAP LEVEL SELECTION.
+        static float ComputeMipmapLevel(
+            const MATH::Vector2f& quad_top_left_texture_coordinates,
+            const MATH::Vector2f& quad_top_right_texture_coordinates,
+            const MATH::Vector2f& quad_bottom_left_texture_coordinates,
+            const IMAGES::MipmappedTexture& texture);
+        SIMD_TARGET_AVX2 static __m256 ComputeMipmapLevels(
+            const MATH::Vector2Simd8x& quad_top_left_texture_coordinates,
+            const MATH::Vector2Simd8x& quad_top_right_texture_coordinates,
+            const MATH::Vector2Simd8x& quad_bottom_left_texture_coordinates,
+            const IMAGES::MipmappedTexture& texture);
+
+        // TEXEL LOOKUP.
         static Color LookupTexel(
             const GEOMETRY::Triangle& triangle,
             const MATH::Vector2f& triangle_point,
             const IMAGES::Bitmap& texture);
+        static Color LookupTexel(
+            const GEOMETRY::Triangle& triangle,
+            const MATH::Vector2f& triangle_point,
+            const TextureFilteringType filtering_type,
+            const IMAGES::MipmappedTexture& texture);
+        static Color LookupTexel(
+            const MATH::Vector2f& texture_coordinates,
+            const float mipmap_level,
+            const TextureFilteringType filtering_type,
+            const IMAGES::MipmappedTexture& texture);
+        SIMD_TARGET_AVX2 static ColorSimd8x LookupTexels(
+            const MATH::Vector2Simd8x& texture_coordinates,
+            const __m256 texel_mask,
+            const IMAGES::Bitmap& texture);
+        SIMD_TARGET_AVX2 static ColorSimd8x LookupTexels(
+            const MATH::Vector2Simd8x& texture_coordinates,
+            const __m256 mipmap_levels,
+            const TextureFilteringType filtering_type,
+            const __m256 texel_mask,
+            const IMAGES::MipmappedTexture& texture);
+
+    private:
+        // HELPER METHODS.
+        static Color LookupBilinearTexel(
+            const MATH::Vector2f& texture_coordinates,
+            const std::size_t level_index,
+            const IMAGES::MipmappedTexture& texture);
+        SIMD_TARGET_AVX2 static ColorSimd8x LookupBilinearTexels(
+            const MATH::Vector2Simd8x& texture_coordinates,
+            const __m256i level_indices,
+            const __m256 texel_mask,
+            const IMAGES::MipmappedTexture& texture);
+        SIMD_TARGET_AVX2 static __m256i ComputeTexelIndices(
+            const __m256i first_texel_indices,
+            const __m256i tile_row_texel_counts,
+            const __m256i x,
+            const __m256i y,
+            const IMAGES::MipmappedTexture& texture);
+        static Color InterpolateColors(const Color& start_color, const Color& end_color, const float ratio_toward_end);
+        SIMD_TARGET_AVX2 static ColorSimd8x InterpolateColors(const ColorSimd8x& start_colors, const ColorSimd8x& end_colors, const __m256 ratios_toward_end);
     };
 }
@@ -0,0 +1,16 @@
+#pragma once
+
+namespace GRAPHICS
+{
+    /// The different ways texels of a texture can be arranged in memory.
+    enum class TextureMemoryLayout
+    {
+        /// Texels are stored one full row after another (the same layout as bitmaps).
+        /// Moving vertically across the texture therefore jumps an entire row in memory per texel.
+        ROW_MAJOR = 0,
+        /// Texels are stored in 4x4 tiles, with tiles in row-major order and texels within each tile in row-major order.
+        /// A tile of 32-bit texels fills a single 64-byte cache line, so nearby texels in any direction
+        /// (as read when textures are rotated or minified) tend to share cache lines.
+        TILED_4X4,
+    };
+}
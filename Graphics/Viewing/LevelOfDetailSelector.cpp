@@ -0,0 +1,162 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "Graphics/Viewing/LevelOfDetailSelector.h"
+#include "Math/Vector4.h"
+
+namespace GRAPHICS::VIEWING
+{
+    /// Computes the fraction of the screen's height covered by the diameter of a mesh's bounding sphere.
+    /// @param[in]  mesh - The mesh for which to compute coverage.  Its bounding sphere should already be computed.
+    /// @param[in]  object_3D - The object to which the mesh belongs.
+    /// @param[in]  camera - The camera through which the mesh is being viewed.
+    /// @return The fraction of the screen height covered by the mesh.  May be greater than 1 for meshes
+    ///     larger than the screen, and is the maximum float if coverage doesn't depend on distance.
+    float LevelOfDetailSelector::ComputeScreenHeightFraction(const Mesh& mesh, const Object3D& object_3D, const Camera& camera)
+    {
+        // TRANSFORM THE BOUNDING SPHERE INTO WORLD SPACE.
+        // Non-uniform scaling stretches the sphere into an ellipsoid, so the largest scale is used to still enclose the mesh.
+        MATH::Matrix4x4f world_transform = object_3D.WorldTransform();
+        MATH::Vector4f homogeneous_center = MATH::Vector4f::HomogeneousPositionVector(mesh.BoundingSphereCenter);
+        MATH::Vector4f world_center = world_transform * homogeneous_center;
+        float max_scale = std::max({ std::abs(object_3D.Scale.X), std::abs(object_3D.Scale.Y), std::abs(object_3D.Scale.Z) });
+        float world_radius = mesh.BoundingSphereRadius * max_scale;
+
+        // COMPUTE THE HALF HEIGHT OF THE VIEW AT THE SPHERE.
+        // Orthographic views are the same height everywhere, but perspective views get taller with distance.
+        MATH::Angle<float>::Radians field_of_view_in_radians = MATH::Angle<float>::DegreesToRadians(camera.FieldOfView);
+        float half_field_of_view_tangent = std::tan(field_of_view_in_radians.Value / 2.0f);
+        float view_distance = camera.NearClipPlaneViewDistance;
+        bool is_perspective = (ProjectionType::PERSPECTIVE == camera.Projection);
+        if (is_perspective)
+        {
+            MATH::Vector3f camera_to_center = MATH::Vector3f(world_center.X, world_center.Y, world_center.Z) - camera.WorldPosition;
+            view_distance = camera_to_center.Length();
+
+            // Spheres around the camera cover the entire screen.
+            if (view_distance <= world_radius)
+            {
+                return std::numeric_limits<float>::max();
+            }
+        }
+        float half_view_height = half_field_of_view_tangent * view_distance;
+        if (half_view_height <= 0.0f)
+        {
+            return std::numeric_limits<float>::max();
+        }
+
+        // COMPUTE THE COVERAGE.
+        float screen_height_fraction = world_radius / half_view_height;
+        return screen_height_fraction;
+    }
+
+    /// Selects the ideal level of detail for a given screen coverage, without considering any previous selection.
+    /// @param[in]  screen_height_fraction - The fraction of the screen height covered by the mesh.
+    /// @param[in]  level_of_detail_count - The number of available levels of detail.
+    /// @param[in]  full_detail_screen_height_fraction - The coverage at or above which full detail is used.
+    /// @return The index of the level of detail to use.
+    std::size_t LevelOfDetailSelector::SelectIdealLevelOfDetailIndex(
+        const float screen_height_fraction,
+        const std::size_t level_of_detail_count,
+        const float full_detail_screen_height_fraction)
+    {
+        // HANDLE COVERAGE AT EITHER EXTREME.
+        std::size_t least_detailed_level_index = (level_of_detail_count > 0) ? (level_of_detail_count - 1) : 0;
+        if (screen_height_fraction >= full_detail_screen_height_fraction)
+        {
+            return 0;
+        }
+        else if (screen_height_fraction <= 0.0f)
+        {
+            return least_detailed_level_index;
+        }
+
+        // SELECT A LEVEL BASED ON HOW MANY TIMES COVERAGE HAS BEEN HALVED.
+        // Coverage in [full / 2, full) uses level 1, coverage in [full / 4, full / 2) uses level 2, and so on.
+        float coverage_halving_count = std::ceil(std::log2(full_detail_screen_height_fraction / screen_height_fraction));
+        std::size_t level_of_detail_index = std::min(static_cast<std::size_t>(coverage_halving_count), least_detailed_level_index);
+        return level_of_detail_index;
+    }
+
+    /// Selects the level of detail for a given screen coverage, preferring to keep a previous selection.
+    /// @param[in]  screen_height_fraction - The fraction of the screen height covered by the mesh.
+    /// @param[in]  level_of_detail_count - The number of available levels of detail.
+    /// @param[in]  previous_level_of_detail_index - The level of detail previously selected.
+    /// @return The index of the level of detail to use.
+    std::size_t LevelOfDetailSelector::SelectLevelOfDetailIndex(
+        const float screen_height_fraction,
+        const std::size_t level_of_detail_count,
+        const std::size_t previous_level_of_detail_index) const
+    {
+        // SWITCH TO A MORE DETAILED LEVEL IF COVERAGE IS WELL ABOVE THE PREVIOUS LEVEL.
+        float decreased_screen_height_fraction = screen_height_fraction / (1.0f + HysteresisRatio);
+        std::size_t more_detailed_level_index = SelectIdealLevelOfDetailIndex(decreased_screen_height_fraction, level_of_detail_count, FullDetailScreenHeightFraction);
+        if (more_detailed_level_index < previous_level_of_detail_index)
+        {
+            return more_detailed_level_index;
+        }
+
+        // SWITCH TO A LESS DETAILED LEVEL IF COVERAGE IS WELL BELOW THE PREVIOUS LEVEL.
+        float increased_screen_height_fraction = screen_height_fraction / (1.0f - HysteresisRatio);
+        std::size_t less_detailed_level_index = SelectIdealLevelOfDetailIndex(increased_screen_height_fraction, level_of_detail_count, FullDetailScreenHeightFraction);
+        if (less_detailed_level_index > previous_level_of_detail_index)
+        {
+            return less_detailed_level_index;
+        }
+
+        // KEEP THE PREVIOUS LEVEL.
+        // The number of levels may have been reduced since the previous selection.
+        std::size_t least_detailed_level_index = (level_of_detail_count > 0) ? (level_of_detail_count - 1) : 0;
+        std::size_t level_of_detail_index = std::min(previous_level_of_detail_index, least_detailed_level_index);
+        return level_of_detail_index;
+    }
+
+    /// Starts selecting levels of detail for a new frame.
+    /// Selections from the frame that just finished are kept for hysteresis, and
+    /// any older selections are discarded so that removed meshes don't accumulate.
+    void LevelOfDetailSelector::BeginFrame()
+    {
+        std::swap(PreviousLevelOfDetailIndicesByMesh, CurrentLevelOfDetailIndicesByMesh);
+        CurrentLevelOfDetailIndicesByMesh.clear();
+    }
+
+    /// Selects the level of detail to render for a mesh in the current frame.
+    /// @param[in]  mesh - The full detail mesh for which to select a level of detail.
+    /// @param[in]  object_3D - The object to which the mesh belongs.
+    /// @param[in]  camera - The camera through which the mesh is being viewed.
+    /// @return The mesh for the selected level of detail.
+    const Mesh& LevelOfDetailSelector::Select(const Mesh& mesh, const Object3D& object_3D, const Camera& camera)
+    {
+        // USE THE MESH DIRECTLY IF IT HAS NO OTHER LEVELS OF DETAIL.
+        if (mesh.LevelsOfDetail.empty())
+        {
+            return mesh;
+        }
+
+        // CHECK IF THE MESH WAS ALREADY SELECTED THIS FRAME.
+        // This keeps the selection consistent across multiple passes.
+        auto current_level_of_detail_index = CurrentLevelOfDetailIndicesByMesh.find(&mesh);
+        if (CurrentLevelOfDetailIndicesByMesh.end() != current_level_of_detail_index)
+        {
+            return mesh.GetLevelOfDetail(current_level_of_detail_index->second);
+        }
+
+        // SELECT THE LEVEL OF DETAIL.
+        float screen_height_fraction = ComputeScreenHeightFraction(mesh, object_3D, camera);
+        std::size_t level_of_detail_count = mesh.LevelOfDetailCount();
+        std::size_t level_of_detail_index = 0;
+        auto previous_level_of_detail_index = PreviousLevelOfDetailIndicesByMesh.find(&mesh);
+        if (PreviousLevelOfDetailIndicesByMesh.end() != previous_level_of_detail_index)
+        {
+            level_of_detail_index = SelectLevelOfDetailIndex(screen_height_fraction, level_of_detail_count, previous_level_of_detail_index->second);
+        }
+        else
+        {
+            level_of_detail_index = SelectIdealLevelOfDetailIndex(screen_height_fraction, level_of_detail_count, FullDetailScreenHeightFraction);
+        }
+
+        // REMEMBER THE SELECTION FOR THE NEXT FRAME.
+        CurrentLevelOfDetailIndicesByMesh[&mesh] = level_of_detail_index;
+        return mesh.GetLevelOfDetail(level_of_detail_index);
+    }
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+#include "Graphics/Mesh.h"
+#include "Graphics/Object3D.h"
+#include "Graphics/Viewing/Camera.h"
+
+namespace GRAPHICS::VIEWING
+{
+    /// Selects levels of detail for meshes based on how much of the screen their bounding spheres cover.
+    ///
+    /// Level 0 is used when a mesh's bounding sphere covers at least the full detail fraction of the
+    /// screen's height, and each subsequent level is used for half the coverage of the previous level.
+    /// To avoid visibly popping back and forth between levels when coverage hovers near a boundary,
+    /// the level selected for a mesh in the previous frame is kept until coverage moves past the
+    /// boundary by the hysteresis ratio.
+    class LevelOfDetailSelector
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The default fraction of the screen height a mesh must cover to be rendered at full detail.
+        static constexpr float DEFAULT_FULL_DETAIL_SCREEN_HEIGHT_FRACTION = 0.5f;
+        /// The default fraction past a level's boundaries that coverage must move before switching levels.
+        static constexpr float DEFAULT_HYSTERESIS_RATIO = 0.2f;
+
+        // SCREEN COVERAGE.
+        static float ComputeScreenHeightFraction(const Mesh& mesh, const Object3D& object_3D, const Camera& camera);
+
+        // SELECTION.
+        static std::size_t SelectIdealLevelOfDetailIndex(
+            const float screen_height_fraction,
+            const std::size_t level_of_detail_count,
+            const float full_detail_screen_height_fraction);
+        std::size_t SelectLevelOfDetailIndex(
+            const float screen_height_fraction,
+            const std::size_t level_of_detail_count,
+            const std::size_t previous_level_of_detail_index) const;
+        void BeginFrame();
+        const Mesh& Select(const Mesh& mesh, const Object3D& object_3D, const Camera& camera);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The fraction of the screen height a mesh must cover to be rendered at full detail.
+        float FullDetailScreenHeightFraction = DEFAULT_FULL_DETAIL_SCREEN_HEIGHT_FRACTION;
+        /// The fraction past a level's boundaries that coverage must move before switching levels.
+        float HysteresisRatio = DEFAULT_HYSTERESIS_RATIO;
+        /// The levels of detail selected for meshes in the previous frame.
+        std::unordered_map<const Mesh*, std::size_t> PreviousLevelOfDetailIndicesByMesh = {};
+        /// The levels of detail selected for meshes in the current frame.
+        std::unordered_map<const Mesh*, std::size_t> CurrentLevelOfDetailIndicesByMesh = {};
+    };
+}
@@ -11,28 +11,38 @@ namespace GRAPHICS::VIEWING
         CameraProjectionTransform = camera.ProjectionTransform();
         CameraNearClipPlaneViewDistance = camera.NearClipPlaneViewDistance;
         CameraFarClipPlaneViewDistance = camera.FarClipPlaneViewDistance;
+        CameraProjection = camera.Projection;
     }
 
     /// Creates viewing transformations for the specified parameters.
     /// @param[in]  camera - The camera used for viewing.
     /// @param[in]  output_plane - The 2D plane onto which the final image will be viewed.
-    ViewingTransformations::ViewingTransformations(const Camera& camera, const IMAGES::Bitmap& output_plane)
+    ViewingTransformations::ViewingTransformations(const Camera& camera, const IMAGES::Bitmap& output_plane) :
+        ViewingTransformations(camera, output_plane.GetWidthInPixels(), output_plane.GetHeightInPixels())
+    {}
+
+    /// Creates viewing transformations for the specified parameters.
+    /// @param[in]  camera - The camera used for viewing.
+    /// @param[in]  screen_width_in_pixels - The width of the 2D plane onto which the final image will be viewed.
+    /// @param[in]  screen_height_in_pixels - The height of the 2D plane onto which the final image will be viewed.
+    ViewingTransformations::ViewingTransformations(const Camera& camera, const unsigned int screen_width_in_pixels, const unsigned int screen_height_in_pixels)
     {
         // INITIALIZE PROPERTIES FROM THE CAMERA.
         CameraViewTransform = camera.ViewTransform();
         CameraProjectionTransform = camera.ProjectionTransform();
         CameraNearClipPlaneViewDistance = camera.NearClipPlaneViewDistance;
         CameraFarClipPlaneViewDistance = camera.FarClipPlaneViewDistance;
+        CameraProjection = camera.Projection;
 
         // INITIALIZE THE SCREEN TRANSFORM.
         MATH::Matrix4x4f flip_y_transform = MATH::Matrix4x4f::Scale(MATH::Vector3f(1.0f, -1.0f, 1.0f));
         MATH::Matrix4x4f scale_to_screen_transform = MATH::Matrix4x4f::Scale(MATH::Vector3f(
-            static_cast<float>(output_plane.GetWidthInPixels()) / 2.0f,
-            static_cast<float>(output_plane.GetHeightInPixels()) / 2.0f,
+            static_cast<float>(screen_width_in_pixels) / 2.0f,
+            static_cast<float>(screen_height_in_pixels) / 2.0f,
             1.0f));
         MATH::Matrix4x4f translate_to_screen_center_transform = MATH::Matrix4x4f::Translation(MATH::Vector3f(
-            static_cast<float>(output_plane.GetWidthInPixels()) / 2.0f,
-            static_cast<float>(output_plane.GetHeightInPixels()) / 2.0f,
+            static_cast<float>(screen_width_in_pixels) / 2.0f,
+            static_cast<float>(screen_height_in_pixels) / 2.0f,
             0.0f));
         ScreenTransform = translate_to_screen_center_transform * scale_to_screen_transform * flip_y_transform;
     }
@@ -51,36 +61,117 @@ namespace GRAPHICS::VIEWING
         std::size_t triangle_vertex_count = world_triangle.Vertices.size();
         for (std::size_t vertex_index = 0; vertex_index < triangle_vertex_count; ++vertex_index)
         {
-            // TRANSFORM THE WORLD VERTEX INTO VIEW OF THE CAMERA.
             const MATH::Vector3f& world_vertex = world_triangle.Vertices[vertex_index].Position;
-            MATH::Vector4f world_homogeneous_vertex = MATH::Vector4f::HomogeneousPositionVector(world_vertex);
-            MATH::Vector4f view_vertex = CameraViewTransform * world_homogeneous_vertex;
-
-            // MAKE SURE THE VERTEX FALLS WITHIN CLIP PLANES.
-            // If not, we could get some odd projections (divide by zero, flipping, etc.) for triangles behind the camera.
-            // This also saves on rendering budgets for triangles out-of-view.
-            float near_z_boundary = -CameraNearClipPlaneViewDistance;
-            float far_z_boundary = -CameraFarClipPlaneViewDistance;
-            // "Direction" of >= comparisons is reversed due to being along negative Z axis.
-            bool current_vertex_within_near_far_clip_planes = (near_z_boundary >= view_vertex.Z && view_vertex.Z >= far_z_boundary);
-            if (!current_vertex_within_near_far_clip_planes)
+            std::optional<MATH::Vector3f> screen_space_vertex = WorldToScreen(world_vertex);
+            if (!screen_space_vertex)
             {
                 // The triangle falls outside of the clipping range.
                 return std::nullopt;
             }
 
-            // PROJECT THE VERTEX.
-            MATH::Vector4f projected_vertex = CameraProjectionTransform * view_vertex;
-            // The vertex must be de-homogenized.
-            MATH::Vector4f transformed_vertex = MATH::Vector4f::Scale(1.0f / projected_vertex.W, projected_vertex);
-
-            // TRANSFORM THE VERTEX INTO SCREEN SPACE.
-            MATH::Vector4f screen_space_vertex = ScreenTransform * transformed_vertex;
-            screen_space_triangle.Vertices[vertex_index].Position = MATH::Vector3f(screen_space_vertex.X, screen_space_vertex.Y, screen_space_vertex.Z);
+            screen_space_triangle.Vertices[vertex_index].Position = *screen_space_vertex;
         }
 
         // RETURN THE SCREEN SPACE TRIANGLE.
         // If we didn't already return early above, then the triangle should be visible on screen.
         return screen_space_triangle;
     }
+
+    /// Transforms a single position from world space to screen space.
+    /// @param[in]  world_position - The world position to transform.
+    /// @return The screen space position (with any reversed-Z depth), if within the near and far clip planes; null otherwise.
+    std::optional<MATH::Vector3f> ViewingTransformations::WorldToScreen(const MATH::Vector3f& world_position) const
+    {
+        // TRANSFORM THE WORLD POSITION INTO VIEW OF THE CAMERA.
+        MATH::Vector4f world_homogeneous_position = MATH::Vector4f::HomogeneousPositionVector(world_position);
+        MATH::Vector4f view_position = CameraViewTransform * world_homogeneous_position;
+
+        // MAKE SURE THE POSITION FALLS WITHIN CLIP PLANES.
+        // If not, we could get some odd projections (divide by zero, flipping, etc.) for positions behind the camera.
+        // This also saves on rendering budgets for geometry out-of-view.
+        float near_z_boundary = -CameraNearClipPlaneViewDistance;
+        float far_z_boundary = -CameraFarClipPlaneViewDistance;
+        // "Direction" of >= comparisons is reversed due to being along negative Z axis.
+        bool position_within_near_far_clip_planes = (near_z_boundary >= view_position.Z && view_position.Z >= far_z_boundary);
+        if (!position_within_near_far_clip_planes)
+        {
+            return std::nullopt;
+        }
+
+        // PROJECT THE POSITION.
+        MATH::Vector4f projected_position = CameraProjectionTransform * view_position;
+        // The position must be de-homogenized.
+        MATH::Vector4f transformed_position = MATH::Vector4f::Scale(1.0f / projected_position.W, projected_position);
+
+        // TRANSFORM THE POSITION INTO SCREEN SPACE.
+        MATH::Vector4f screen_space_position = ScreenTransform * transformed_position;
+        MATH::Vector3f screen_position(screen_space_position.X, screen_space_position.Y, screen_space_position.Z);
+
+        // COMPUTE ANY REVERSED-Z DEPTH.
+        // This is equivalent to remapping the projected depth from [-1, 1] to [0, 1], but computing it from
+        // the view space depth avoids losing precision for far depths (which projected depths crowd near -1).
+        if (ReversedZ)
+        {
+            float near_to_far_distance = near_z_boundary - far_z_boundary;
+            float view_depth_from_far_plane = view_position.Z - far_z_boundary;
+            float reversed_z_depth = view_depth_from_far_plane / near_to_far_distance;
+            if (ProjectionType::PERSPECTIVE == CameraProjection)
+            {
+                // Perspective projection scales depths by the near plane relative to the position's depth.
+                reversed_z_depth *= (near_z_boundary / view_position.Z);
+            }
+            screen_position.Z = reversed_z_depth;
+        }
+
+        return screen_position;
+    }
+
+    /// Computes the transform from screen space (with regular depths) back to world space.
+    /// Inverting the transforms is relatively expensive, so the result should be reused when
+    /// converting many positions via ScreenToWorld().
+    /// @return The screen to world transform.
+    MATH::Matrix4x4f ViewingTransformations::ScreenToWorldTransform() const
+    {
+        MATH::Matrix4x4f world_to_screen_transform = ScreenTransform * CameraProjectionTransform * CameraViewTransform;
+        MATH::Matrix4x4f screen_to_world_transform = MATH::Matrix4x4f::Inverse(world_to_screen_transform);
+        return screen_to_world_transform;
+    }
+
+    /// Transforms a single position from screen space back to world space,
+    /// such as for reconstructing world positions from a depth buffer.
+    /// @param[in]  screen_position - The screen space position (with any reversed-Z depth) to transform.
+    /// @param[in]  screen_to_world_transform - The transform from ScreenToWorldTransform().
+    /// @return The world space position.
+    MATH::Vector3f ViewingTransformations::ScreenToWorld(const MATH::Vector3f& screen_position, const MATH::Matrix4x4f& screen_to_world_transform) const
+    {
+        // CONVERT ANY REVERSED-Z DEPTH TO A REGULAR DEPTH.
+        // Reversed-Z depths aren't produced by the projection transform, so they're first converted back
+        // to a view space depth (inverting the computation in WorldToScreen()) and then projected.
+        float screen_depth = screen_position.Z;
+        if (ReversedZ)
+        {
+            float near_z_boundary = -CameraNearClipPlaneViewDistance;
+            float far_z_boundary = -CameraFarClipPlaneViewDistance;
+            float near_to_far_distance = near_z_boundary - far_z_boundary;
+            float view_depth = far_z_boundary + (screen_depth * near_to_far_distance);
+            if (ProjectionType::PERSPECTIVE == CameraProjection)
+            {
+                view_depth = (near_z_boundary * far_z_boundary) / (near_z_boundary - (screen_depth * near_to_far_distance));
+            }
+
+            MATH::Vector4f projected_depth = CameraProjectionTransform * MATH::Vector4f(0.0f, 0.0f, view_depth, 1.0f);
+            MATH::Vector4f screen_space_depth = ScreenTransform * MATH::Vector4f(0.0f, 0.0f, projected_depth.Z / projected_depth.W, 1.0f);
+            screen_depth = screen_space_depth.Z;
+        }
+
+        // TRANSFORM THE POSITION BACK TO WORLD SPACE.
+        MATH::Vector4f screen_homogeneous_position(screen_position.X, screen_position.Y, screen_depth, 1.0f);
+        MATH::Vector4f world_homogeneous_position = screen_to_world_transform * screen_homogeneous_position;
+        // The position must be de-homogenized.
+        MATH::Vector3f world_position(
+            world_homogeneous_position.X / world_homogeneous_position.W,
+            world_homogeneous_position.Y / world_homogeneous_position.W,
+            world_homogeneous_position.Z / world_homogeneous_position.W);
+        return world_position;
+    }
 }
@@ -20,8 +20,12 @@ namespace GRAPHICS::VIEWING
     public:
         explicit ViewingTransformations(const Camera& camera);
         explicit ViewingTransformations(const Camera& camera, const IMAGES::Bitmap& output_plane);
+        explicit ViewingTransformations(const Camera& camera, const unsigned int screen_width_in_pixels, const unsigned int screen_height_in_pixels);
 
         std::optional<GEOMETRY::Triangle> Apply(const GEOMETRY::Triangle& world_triangle) const;
+        std::optional<MATH::Vector3f> WorldToScreen(const MATH::Vector3f& world_position) const;
+        MATH::Matrix4x4f ScreenToWorldTransform() const;
+        MATH::Vector3f ScreenToWorld(const MATH::Vector3f& screen_position, const MATH::Matrix4x4f& screen_to_world_transform) const;
 
         /// The transform to transform a vertex from world to camera view space.
         MATH::Matrix4x4f CameraViewTransform = {};
@@ -31,6 +35,12 @@ namespace GRAPHICS::VIEWING
         float CameraNearClipPlaneViewDistance = 0.0f;
         /// The far clip plane viewing distance for the camera.
         float CameraFarClipPlaneViewDistance = 0.0f;
+        /// The type of projection used by the camera.
+        ProjectionType CameraProjection = ProjectionType::ORTHOGRAPHIC;
+        /// True if screen space depths should be reversed-Z depths from 0 (far) to 1 (near);
+        /// false for regular depths from -1 (far) to 1 (near).  Reversed-Z depths are computed directly
+        /// from view space depths to preserve precision that would be lost after projection.
+        bool ReversedZ = false;
         /// The transform to transform a vertex from projected view space to screen space.
         MATH::Matrix4x4f ScreenTransform = {};
     };
@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <catch.hpp>
+#include "Graphics/CpuRendering/ClusteredLightGrid.h"
+#include "Graphics/Geometry/Triangle.h"
+#include "Graphics/Shading/WorldSpaceShading.h"
+#include "Graphics/Surface.h"
+#include "Graphics/testing/Viewing/TestCamera.h"
+
+/// Creates lights for clustered light grid tests: an ambient light, a directional light,
+/// and a grid of point lights with small ranges spread across the view of the test camera.
+/// @return The lights.
+std::vector<GRAPHICS::SHADING::LIGHTING::Light> CreateClusteredLightGridTestLights()
+{
+    std::vector<GRAPHICS::SHADING::LIGHTING::Light> lights;
+    lights.emplace_back(GRAPHICS::SHADING::LIGHTING::Light
+    {
+        .Type = GRAPHICS::SHADING::LIGHTING::LightType::AMBIENT,
+        .Color = GRAPHICS::Color(0.1f, 0.1f, 0.1f, 1.0f),
+    });
+    for (int x = -4; x <= 4; ++x)
+    {
+        for (int y = -4; y <= 4; ++y)
+        {
+            // Point lights are staggered in depth so that they fall in different depth slices.
+            float z = static_cast<float>((x + y) % 3);
+            lights.emplace_back(GRAPHICS::SHADING::LIGHTING::Light
+            {
+                .Type = GRAPHICS::SHADING::LIGHTING::LightType::POINT,
+                .Color = GRAPHICS::Color(0.2f, 0.15f, 0.1f, 1.0f),
+                .PointLightWorldPosition = MATH::Vector3f(2.0f * static_cast<float>(x), 2.0f * static_cast<float>(y), z),
+                .PointLightRange = 1.0f,
+            });
+        }
+    }
+    lights.emplace_back(GRAPHICS::SHADING::LIGHTING::Light
+    {
+        .Type = GRAPHICS::SHADING::LIGHTING::LightType::DIRECTIONAL,
+        .Color = GRAPHICS::Color(0.3f, 0.3f, 0.3f, 1.0f),
+        .DirectionalLightDirection = MATH::Vector3f::Normalize(MATH::Vector3f(1.0f, -1.0f, -1.0f)),
+    });
+    return lights;
+}
+
+TEST_CASE("Clusters include all lights that reach positions within them in their original order.", "[ClusteredLightGrid][GetLights]")
+{
+    // BUILD THE GRID.
+    // The screen spans multiple tiles to exercise culling across tiles.
+    constexpr unsigned int SCREEN_DIMENSION_IN_PIXELS = 8 * GRAPHICS::CPU_RENDERING::ClusteredLightGrid::TILE_DIMENSION_IN_PIXELS;
+    GRAPHICS::IMAGES::Bitmap screen(SCREEN_DIMENSION_IN_PIXELS, SCREEN_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    GRAPHICS::VIEWING::ViewingTransformations viewing_transformations(CreatePerspectiveTestCamera(), screen);
+    std::vector<GRAPHICS::SHADING::LIGHTING::Light> lights = CreateClusteredLightGridTestLights();
+    GRAPHICS::CPU_RENDERING::ClusteredLightGrid light_grid(lights, viewing_transformations, SCREEN_DIMENSION_IN_PIXELS, SCREEN_DIMENSION_IN_PIXELS);
+
+    // CHECK THE LIGHTS FOR POSITIONS THROUGHOUT THE VIEW.
+    std::size_t missing_light_count = 0;
+    std::size_t out_of_order_light_count = 0;
+    for (float x = -10.0f; x <= 10.0f; x += 0.25f)
+    {
+        for (float y = -10.0f; y <= 10.0f; y += 0.25f)
+        {
+            for (float z = -3.0f; z <= 4.0f; z += 0.5f)
+            {
+                // CHECK THAT ALL LIGHTS REACHING THE POSITION ARE INCLUDED.
+                MATH::Vector3f world_position(x, y, z);
+                const std::vector<GRAPHICS::SHADING::LIGHTING::Light>& position_lights = light_grid.GetLights(world_position);
+                auto next_position_light = position_lights.cbegin();
+                for (const GRAPHICS::SHADING::LIGHTING::Light& light : lights)
+                {
+                    if (!light.Reaches(world_position))
+                    {
+                        continue;
+                    }
+
+                    // Lights should be in the same relative order so that lighting is summed in the same order.
+                    auto position_light = std::find(next_position_light, position_lights.cend(), light);
+                    if (position_lights.cend() != position_light)
+                    {
+                        next_position_light = position_light + 1;
+                    }
+                    else if (position_lights.cend() != std::find(position_lights.cbegin(), position_lights.cend(), light))
+                    {
+                        ++out_of_order_light_count;
+                    }
+                    else
+                    {
+                        ++missing_light_count;
+                    }
+                }
+            }
+        }
+    }
+    REQUIRE(0 == missing_light_count);
+    REQUIRE(0 == out_of_order_light_count);
+
+    // VERIFY THAT LIGHTS WERE ACTUALLY CULLED.
+    // Positions on screen only need a small fraction of all lights.
+    REQUIRE(light_grid.GetLights(MATH::Vector3f(0.0f, 0.0f, 0.0f)).size() < lights.size() / 4);
+    REQUIRE(light_grid.GetLights(MATH::Vector3f(4.0f, -3.0f, 1.0f)).size() < lights.size() / 4);
+}
+
+TEST_CASE("Positions outside of a clustered light grid use all lights or only lights without limited ranges.", "[ClusteredLightGrid][GetLights]")
+{
+    // BUILD THE GRID.
+    constexpr unsigned int SCREEN_DIMENSION_IN_PIXELS = 2 * GRAPHICS::CPU_RENDERING::ClusteredLightGrid::TILE_DIMENSION_IN_PIXELS;
+    GRAPHICS::IMAGES::Bitmap screen(SCREEN_DIMENSION_IN_PIXELS, SCREEN_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    GRAPHICS::VIEWING::ViewingTransformations viewing_transformations(CreatePerspectiveTestCamera(), screen);
+    std::vector<GRAPHICS::SHADING::LIGHTING::Light> lights = CreateClusteredLightGridTestLights();
+    GRAPHICS::CPU_RENDERING::ClusteredLightGrid light_grid(lights, viewing_transformations, SCREEN_DIMENSION_IN_PIXELS, SCREEN_DIMENSION_IN_PIXELS);
+
+    // VERIFY POSITIONS OUTSIDE OF THE SCREEN OR CLIP PLANES USE ALL LIGHTS.
+    REQUIRE(lights == light_grid.GetLights(MATH::Vector3f(0.0f, 0.0f, 20.0f)));
+    REQUIRE(lights == light_grid.GetLights(MATH::Vector3f(0.0f, 0.0f, -200.0f)));
+    REQUIRE(lights == light_grid.GetLights(MATH::Vector3f(500.0f, 0.0f, 0.0f)));
+
+    // VERIFY POSITIONS ON SCREEN BEYOND ALL POINT LIGHTS ONLY USE THE AMBIENT AND DIRECTIONAL LIGHTS.
+    std::vector<GRAPHICS::SHADING::LIGHTING::Light> expected_unlimited_range_lights = { lights.front(), lights.back() };
+    REQUIRE(expected_unlimited_range_lights == light_grid.GetLights(MATH::Vector3f(0.0f, 0.0f, -50.0f)));
+}
+
+TEST_CASE("Shading with clustered lights exactly matches shading with all lights.", "[ClusteredLightGrid][GetLights]")
+{
+    // BUILD THE GRID.
+    constexpr unsigned int SCREEN_DIMENSION_IN_PIXELS = 4 * GRAPHICS::CPU_RENDERING::ClusteredLightGrid::TILE_DIMENSION_IN_PIXELS;
+    GRAPHICS::IMAGES::Bitmap screen(SCREEN_DIMENSION_IN_PIXELS, SCREEN_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    GRAPHICS::VIEWING::Camera camera = CreatePerspectiveTestCamera();
+    GRAPHICS::VIEWING::ViewingTransformations viewing_transformations(camera, screen);
+    std::vector<GRAPHICS::SHADING::LIGHTING::Light> lights = CreateClusteredLightGridTestLights();
+    GRAPHICS::CPU_RENDERING::ClusteredLightGrid light_grid(lights, viewing_transformations, SCREEN_DIMENSION_IN_PIXELS, SCREEN_DIMENSION_IN_PIXELS);
+
+    // CREATE A SURFACE FACING THE CAMERA.
+    auto material = std::make_shared<GRAPHICS::Material>();
+    material->AmbientProperties.Color = GRAPHICS::Color(0.2f, 0.2f, 0.2f, 1.0f);
+    material->DiffuseProperties.Color = GRAPHICS::Color(0.8f, 0.6f, 0.4f, 1.0f);
+    material->SpecularProperties.Color = GRAPHICS::Color::WHITE;
+    material->SpecularProperties.SpecularPower = 16.0f;
+    GRAPHICS::GEOMETRY::Triangle material_triangle;
+    material_triangle.Material = material;
+    GRAPHICS::Surface surface = { .Shape = &material_triangle, .Normal = MATH::Vector3f(0.0f, 0.0f, 1.0f) };
+    GRAPHICS::SHADING::ShadingSettings shading_settings = { .TextureMappingEnabled = false };
+
+    // SHADE POSITIONS ACROSS THE SURFACE.
+    std::size_t mismatched_color_count = 0;
+    for (float x = -10.0f; x <= 10.0f; x += 0.2f)
+    {
+        for (float y = -10.0f; y <= 10.0f; y += 0.2f)
+        {
+            MATH::Vector3f world_position(x, y, 0.5f);
+            GRAPHICS::Color expected_color = GRAPHICS::SHADING::WorldSpaceShading::ComputeMaterialShading(
+                world_position,
+                surface,
+                camera.WorldPosition,
+                lights,
+                {},
+                shading_settings);
+            GRAPHICS::Color clustered_color = GRAPHICS::SHADING::WorldSpaceShading::ComputeMaterialShading(
+                world_position,
+                surface,
+                camera.WorldPosition,
+                light_grid.GetLights(world_position),
+                {},
+                shading_settings);
+            if (expected_color != clustered_color)
+            {
+                ++mismatched_color_count;
+            }
+        }
+    }
+    REQUIRE(0 == mismatched_color_count);
+}
@@ -0,0 +1,341 @@
+#if _WIN32
+
+#include <memory>
+#include <optional>
+#include <vector>
+#include <catch.hpp>
+#include "Graphics/CpuRendering/CpuRasterizationAlgorithm.h"
+#include "Graphics/testing/Viewing/TestCamera.h"
+
+/// Creates a large textured triangle covering most of a render target for testing.
+/// @param[in]  render_target_dimension_in_pixels - The width and height of the render target.
+/// @return A triangle with a material having diffuse color and a diffuse texture.
+GRAPHICS::GEOMETRY::Triangle CreateCpuRasterizationTestTriangle(const unsigned int render_target_dimension_in_pixels)
+{
+    // CREATE A CHECKERED TEXTURE.
+    constexpr unsigned int TEXTURE_DIMENSION_IN_PIXELS = 64;
+    auto texture = std::make_shared<GRAPHICS::IMAGES::Bitmap>(TEXTURE_DIMENSION_IN_PIXELS, TEXTURE_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    for (unsigned int y = 0; y < TEXTURE_DIMENSION_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < TEXTURE_DIMENSION_IN_PIXELS; ++x)
+        {
+            bool is_light_square = (((x / 8) + (y / 8)) % 2 == 0);
+            GRAPHICS::Color color = is_light_square ? GRAPHICS::Color::WHITE : GRAPHICS::Color(0.25f, 0.5f, 0.75f, 1.0f);
+            texture->WritePixel(x, y, color);
+        }
+    }
+
+    // CREATE THE MATERIAL.
+    auto material = std::make_shared<GRAPHICS::Material>();
+    material->DiffuseProperties.Color = GRAPHICS::Color::WHITE;
+    material->DiffuseProperties.Texture = texture;
+    material->DiffuseProperties.MipmappedTexture = GRAPHICS::IMAGES::MipmappedTexture::Create(*texture, GRAPHICS::TextureMemoryLayout::ROW_MAJOR);
+
+    // CREATE THE TRIANGLE.
+    float max_coordinate = static_cast<float>(render_target_dimension_in_pixels - 2);
+    GRAPHICS::GEOMETRY::Triangle triangle;
+    triangle.Material = material;
+    triangle.Vertices[0] = GRAPHICS::VertexWithAttributes
+    {
+        .Position = MATH::Vector3f(2.0f, 2.0f, 0.25f),
+        .Color = GRAPHICS::Color(1.0f, 0.5f, 0.5f, 1.0f),
+        .TextureCoordinates = MATH::Vector2f(0.0f, 0.0f),
+    };
+    triangle.Vertices[1] = GRAPHICS::VertexWithAttributes
+    {
+        .Position = MATH::Vector3f(max_coordinate, 10.0f, 0.5f),
+        .Color = GRAPHICS::Color(0.5f, 1.0f, 0.5f, 1.0f),
+        .TextureCoordinates = MATH::Vector2f(2.0f, 0.0f),
+    };
+    triangle.Vertices[2] = GRAPHICS::VertexWithAttributes
+    {
+        .Position = MATH::Vector3f(20.0f, max_coordinate, 0.75f),
+        .Color = GRAPHICS::Color(0.5f, 0.5f, 1.0f, 1.0f),
+        .TextureCoordinates = MATH::Vector2f(0.0f, 2.0f),
+    };
+    return triangle;
+}
+
+TEST_CASE("Textures are only applied for enabled kinds of lighting.", "[CpuRasterizationAlgorithm][Render]")
+{
+    // CREATE A TEXTURED TRIANGLE.
+    constexpr unsigned int RENDER_TARGET_DIMENSION_IN_PIXELS = 64;
+    GRAPHICS::GEOMETRY::Triangle triangle = CreateCpuRasterizationTestTriangle(RENDER_TARGET_DIMENSION_IN_PIXELS);
+
+    // RENDER THE TRIANGLE WITHOUT TEXTURE MAPPING.
+    GRAPHICS::RenderingSettings rendering_settings;
+    rendering_settings.UseCpuSimd = GENERATE(false, true);
+    rendering_settings.Shading.ShadingType = GRAPHICS::SHADING::ShadingType::MATERIAL;
+    rendering_settings.Shading.TextureMappingEnabled = false;
+    GRAPHICS::IMAGES::Bitmap untextured_render_target(RENDER_TARGET_DIMENSION_IN_PIXELS, RENDER_TARGET_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::ARGB);
+    GRAPHICS::CPU_RENDERING::CpuRasterizationAlgorithm::Render(triangle, rendering_settings, untextured_render_target, nullptr);
+
+    // RENDER THE TRIANGLE WITH TEXTURE MAPPING BUT WITHOUT DIFFUSE LIGHTING.
+    rendering_settings.Shading.TextureMappingEnabled = true;
+    rendering_settings.Shading.Lighting.DiffuseLightingEnabled = false;
+    GRAPHICS::IMAGES::Bitmap render_target(RENDER_TARGET_DIMENSION_IN_PIXELS, RENDER_TARGET_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::ARGB);
+    GRAPHICS::CPU_RENDERING::CpuRasterizationAlgorithm::Render(triangle, rendering_settings, render_target, nullptr);
+
+    // VERIFY THE DIFFUSE TEXTURE WASN'T APPLIED.
+    for (unsigned int y = 0; y < RENDER_TARGET_DIMENSION_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < RENDER_TARGET_DIMENSION_IN_PIXELS; ++x)
+        {
+            REQUIRE(untextured_render_target.GetPixel(x, y) == render_target.GetPixel(x, y));
+        }
+    }
+}
+
+TEST_CASE("Shadow mapping only darkens surfaces behind occluders.", "[CpuRasterizationAlgorithm][Render]")
+{
+    // CREATE A FLOOR WITH AN OCCLUDER ABOVE IT.
+    // The floor is finely subdivided since forward lighting only shadows vertices.
+    auto material = std::make_shared<GRAPHICS::Material>();
+    material->AmbientProperties.Color = GRAPHICS::Color(0.1f, 0.1f, 0.1f, 1.0f);
+    material->DiffuseProperties.Color = GRAPHICS::Color(0.8f, 0.6f, 0.4f, 1.0f);
+    GRAPHICS::Mesh floor;
+    constexpr uint32_t FLOOR_VERTEX_COUNT_PER_SIDE = 41;
+    constexpr float FLOOR_VERTEX_SPACING = 0.25f;
+    for (uint32_t row = 0; row < FLOOR_VERTEX_COUNT_PER_SIDE; ++row)
+    {
+        for (uint32_t column = 0; column < FLOOR_VERTEX_COUNT_PER_SIDE; ++column)
+        {
+            floor.Vertices.emplace_back(GRAPHICS::VertexWithAttributes
+            {
+                .Position = MATH::Vector3f(FLOOR_VERTEX_SPACING * column - 5.0f, FLOOR_VERTEX_SPACING * row - 5.0f, 0.0f),
+                .Color = GRAPHICS::Color::WHITE,
+                .Normal = MATH::Vector3f(0.0f, 0.0f, 1.0f),
+            });
+        }
+    }
+    for (uint32_t row = 0; row + 1 < FLOOR_VERTEX_COUNT_PER_SIDE; ++row)
+    {
+        for (uint32_t column = 0; column + 1 < FLOOR_VERTEX_COUNT_PER_SIDE; ++column)
+        {
+            uint32_t top_left_index = row * FLOOR_VERTEX_COUNT_PER_SIDE + column;
+            uint32_t bottom_left_index = top_left_index + FLOOR_VERTEX_COUNT_PER_SIDE;
+            floor.Indices.insert(floor.Indices.end(), { top_left_index, top_left_index + 1, bottom_left_index + 1, top_left_index, bottom_left_index + 1, bottom_left_index });
+        }
+    }
+    floor.Subsets.emplace_back(GRAPHICS::MeshSubset{ .FirstIndex = 0, .IndexCount = static_cast<uint32_t>(floor.Indices.size()), .Material = material });
+
+    GRAPHICS::Mesh occluder;
+    for (float y : { -2.0f, 0.0f })
+    {
+        for (float x : { -2.0f, 0.0f })
+        {
+            occluder.Vertices.emplace_back(GRAPHICS::VertexWithAttributes
+            {
+                .Position = MATH::Vector3f(x, y, 2.0f),
+                .Color = GRAPHICS::Color::WHITE,
+                .Normal = MATH::Vector3f(0.0f, 0.0f, 1.0f),
+            });
+        }
+    }
+    occluder.Indices = { 0, 1, 3, 0, 3, 2 };
+    occluder.Subsets.emplace_back(GRAPHICS::MeshSubset{ .FirstIndex = 0, .IndexCount = 6, .Material = material });
+
+    // CREATE THE SCENE.
+    // The light shines at an angle so that the occluder's shadow is visible from above.
+    GRAPHICS::Scene scene;
+    GRAPHICS::Object3D object_3D;
+    object_3D.Model.MeshesByName["Floor"] = floor;
+    object_3D.Model.MeshesByName["Occluder"] = occluder;
+    scene.Objects.emplace_back(object_3D);
+    scene.Lights.emplace_back(GRAPHICS::SHADING::LIGHTING::Light{ .Type = GRAPHICS::SHADING::LIGHTING::LightType::AMBIENT, .Color = GRAPHICS::Color(0.2f, 0.2f, 0.2f, 1.0f) });
+    scene.Lights.emplace_back(GRAPHICS::SHADING::LIGHTING::Light
+    {
+        .Type = GRAPHICS::SHADING::LIGHTING::LightType::DIRECTIONAL,
+        .Color = GRAPHICS::Color(0.8f, 0.8f, 0.8f, 1.0f),
+        .DirectionalLightDirection = MATH::Vector3f::Normalize(MATH::Vector3f(1.0f, 0.0f, -1.0f)),
+        .ShadowMapDimensionInPixels = 256,
+    });
+    GRAPHICS::VIEWING::Camera camera = CreatePerspectiveTestCamera(12.0f);
+
+    // RENDER THE SCENE WITH AND WITHOUT SHADOWS.
+    constexpr unsigned int RENDER_TARGET_DIMENSION_IN_PIXELS = 128;
+    GRAPHICS::RenderingSettings rendering_settings;
+    rendering_settings.DepthBuffering = true;
+    rendering_settings.Shading.ShadingType = GRAPHICS::SHADING::ShadingType::MATERIAL;
+    rendering_settings.DeferredLighting = GENERATE(false, true);
+    INFO("Deferred lighting: " << rendering_settings.DeferredLighting);
+    GRAPHICS::DepthBuffer depth_buffer(RENDER_TARGET_DIMENSION_IN_PIXELS, RENDER_TARGET_DIMENSION_IN_PIXELS);
+    GRAPHICS::IMAGES::Bitmap unshadowed_render_target(RENDER_TARGET_DIMENSION_IN_PIXELS, RENDER_TARGET_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::ARGB);
+    GRAPHICS::CPU_RENDERING::CpuRasterizationAlgorithm::Render(scene, camera, rendering_settings, unshadowed_render_target, &depth_buffer);
+    rendering_settings.ShadowMapping = true;
+    GRAPHICS::IMAGES::Bitmap shadowed_render_target(RENDER_TARGET_DIMENSION_IN_PIXELS, RENDER_TARGET_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::ARGB);
+    GRAPHICS::CPU_RENDERING::CpuRasterizationAlgorithm::Render(scene, camera, rendering_settings, shadowed_render_target, &depth_buffer);
+
+    // VERIFY ONLY THE FLOOR BEHIND THE OCCLUDER IS DARKENED.
+    GRAPHICS::VIEWING::ViewingTransformations viewing_transformations(camera, shadowed_render_target);
+    std::optional<MATH::Vector3f> shadowed_screen_position = viewing_transformations.WorldToScreen(MATH::Vector3f(1.0f, -1.0f, 0.0f));
+    REQUIRE(shadowed_screen_position);
+    unsigned int shadowed_x = static_cast<unsigned int>(shadowed_screen_position->X);
+    unsigned int shadowed_y = static_cast<unsigned int>(shadowed_screen_position->Y);
+    REQUIRE(shadowed_render_target.GetPixel(shadowed_x, shadowed_y).Red < unshadowed_render_target.GetPixel(shadowed_x, shadowed_y).Red);
+
+    const std::vector<MATH::Vector3f> LIT_WORLD_POSITIONS =
+    {
+        MATH::Vector3f(3.0f, -1.0f, 0.0f),
+        MATH::Vector3f(1.0f, 2.0f, 0.0f),
+        MATH::Vector3f(-3.0f, 3.0f, 0.0f),
+        MATH::Vector3f(-1.0f, -1.0f, 2.0f),
+    };
+    for (const MATH::Vector3f& lit_world_position : LIT_WORLD_POSITIONS)
+    {
+        std::optional<MATH::Vector3f> lit_screen_position = viewing_transformations.WorldToScreen(lit_world_position);
+        REQUIRE(lit_screen_position);
+        unsigned int lit_x = static_cast<unsigned int>(lit_screen_position->X);
+        unsigned int lit_y = static_cast<unsigned int>(lit_screen_position->Y);
+        REQUIRE(shadowed_render_target.GetPixel(lit_x, lit_y) == unshadowed_render_target.GetPixel(lit_x, lit_y));
+    }
+}
+
+TEST_CASE("SIMD rasterization matches non-SIMD rasterization.", "[CpuRasterizationAlgorithm][Render]")
+{
+    // CREATE OVERLAPPING TRIANGLES THAT AREN'T ALIGNED TO PIXELS.
+    // The front triangle is a mirrored copy of the back triangle moved closer to the viewer,
+    // so depth tests pass for some pixels and fail for others when it's rendered first.
+    constexpr unsigned int RENDER_TARGET_DIMENSION_IN_PIXELS = 64;
+    GRAPHICS::GEOMETRY::Triangle back_triangle = CreateCpuRasterizationTestTriangle(RENDER_TARGET_DIMENSION_IN_PIXELS);
+    GRAPHICS::GEOMETRY::Triangle front_triangle = back_triangle;
+    for (std::size_t vertex_index = 0; vertex_index < GRAPHICS::GEOMETRY::Triangle::VERTEX_COUNT; ++vertex_index)
+    {
+        MATH::Vector3f& back_position = back_triangle.Vertices[vertex_index].Position;
+        back_position.X += 0.3f;
+        back_position.Y += 0.7f;
+
+        MATH::Vector3f& front_position = front_triangle.Vertices[vertex_index].Position;
+        front_position.X = static_cast<float>(RENDER_TARGET_DIMENSION_IN_PIXELS - 1) - front_position.X - 0.35f;
+        front_position.Y += 0.45f;
+        front_position.Z += 0.2f;
+    }
+
+    // RENDER THE TRIANGLES WITH AND WITHOUT SIMD.
+    auto [shading_type, texture_mapping_enabled] = GENERATE(
+        std::make_tuple(GRAPHICS::SHADING::ShadingType::FLAT, false),
+        std::make_tuple(GRAPHICS::SHADING::ShadingType::MATERIAL, false),
+        std::make_tuple(GRAPHICS::SHADING::ShadingType::MATERIAL, true));
+    bool depth_buffering = GENERATE(false, true);
+    INFO("Shading type: " << static_cast<int>(shading_type));
+    INFO("Texture mapping: " << texture_mapping_enabled);
+    INFO("Depth buffering: " << depth_buffering);
+    GRAPHICS::RenderingSettings rendering_settings;
+    rendering_settings.Shading.ShadingType = shading_type;
+    rendering_settings.Shading.TextureMappingEnabled = texture_mapping_enabled;
+    rendering_settings.Shading.TextureFiltering = GRAPHICS::TextureFilteringType::NEAREST;
+
+    GRAPHICS::IMAGES::Bitmap simd_render_target(RENDER_TARGET_DIMENSION_IN_PIXELS, RENDER_TARGET_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::ARGB);
+    GRAPHICS::IMAGES::Bitmap non_simd_render_target(RENDER_TARGET_DIMENSION_IN_PIXELS, RENDER_TARGET_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::ARGB);
+    for (GRAPHICS::IMAGES::Bitmap* render_target : { &simd_render_target, &non_simd_render_target })
+    {
+        rendering_settings.UseCpuSimd = (&simd_render_target == render_target);
+        render_target->FillPixels(GRAPHICS::Color::BLACK);
+        GRAPHICS::DepthBuffer depth_buffer(RENDER_TARGET_DIMENSION_IN_PIXELS, RENDER_TARGET_DIMENSION_IN_PIXELS);
+        GRAPHICS::DepthBuffer* active_depth_buffer = depth_buffering ? &depth_buffer : nullptr;
+        GRAPHICS::CPU_RENDERING::CpuRasterizationAlgorithm::Render(front_triangle, rendering_settings, *render_target, active_depth_buffer);
+        GRAPHICS::CPU_RENDERING::CpuRasterizationAlgorithm::Render(back_triangle, rendering_settings, *render_target, active_depth_buffer);
+    }
+
+    // VERIFY THE SAME PIXELS ARE COVERED WITH NEARLY THE SAME COLORS.
+    // Both versions sample the same points, so coverage should match exactly.  Colors may only differ by
+    // a single 8-bit step from floating-point operations being done in a different order.
+    constexpr float MAX_COLOR_COMPONENT_DIFFERENCE = 1.0f / 255.0f;
+    for (unsigned int y = 0; y < RENDER_TARGET_DIMENSION_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < RENDER_TARGET_DIMENSION_IN_PIXELS; ++x)
+        {
+            INFO("Pixel: (" << x << ", " << y << ")");
+            GRAPHICS::Color simd_color = simd_render_target.GetPixel(x, y);
+            GRAPHICS::Color non_simd_color = non_simd_render_target.GetPixel(x, y);
+            bool simd_pixel_covered = (GRAPHICS::Color::BLACK != simd_color);
+            bool non_simd_pixel_covered = (GRAPHICS::Color::BLACK != non_simd_color);
+            REQUIRE(non_simd_pixel_covered == simd_pixel_covered);
+
+            REQUIRE(non_simd_color.Red == Approx(simd_color.Red).margin(MAX_COLOR_COMPONENT_DIFFERENCE));
+            REQUIRE(non_simd_color.Green == Approx(simd_color.Green).margin(MAX_COLOR_COMPONENT_DIFFERENCE));
+            REQUIRE(non_simd_color.Blue == Approx(simd_color.Blue).margin(MAX_COLOR_COMPONENT_DIFFERENCE));
+        }
+    }
+}
+
+TEST_CASE("Render targets are cleared to the background color unless the caller already cleared them.", "[CpuRasterizationAlgorithm][Render]")
+{
+    // CREATE A RENDER TARGET WHOSE TRACKED STATE MATCHES THE BACKGROUND BUT WHOSE PIXELS DON'T.
+    // Pixels written through raw data aren't tracked, so the tracked state can't be trusted for skipping the clear.
+    GRAPHICS::Scene scene;
+    scene.BackgroundColor = GRAPHICS::Color::BLUE;
+    GRAPHICS::IMAGES::Bitmap render_target(8, 8, GRAPHICS::ColorFormat::ARGB);
+    render_target.FillPixels(scene.BackgroundColor);
+    GRAPHICS::IMAGES::Bitmap red_pixel_source(1, 1, GRAPHICS::ColorFormat::ARGB);
+    red_pixel_source.WritePixel(0, 0, GRAPHICS::Color::RED);
+    render_target.GetRawData()[0] = red_pixel_source.GetRawData()[0];
+
+    // VERIFY THE RENDER TARGET IS CLEARED BY DEFAULT.
+    GRAPHICS::VIEWING::Camera camera;
+    GRAPHICS::RenderingSettings rendering_settings;
+    GRAPHICS::CPU_RENDERING::CpuRasterizationAlgorithm::Render(scene, camera, rendering_settings, render_target, nullptr);
+    REQUIRE(GRAPHICS::Color::BLUE == render_target.GetPixel(0, 0));
+
+    // VERIFY THE CLEAR IS SKIPPED IF THE CALLER ALREADY CLEARED THE RENDER TARGET.
+    render_target.FillPixels(GRAPHICS::Color::GREEN);
+    constexpr bool RENDER_TARGET_ALREADY_CLEARED = true;
+    GRAPHICS::CPU_RENDERING::CpuRasterizationAlgorithm::Render(
+        scene, camera, rendering_settings, render_target, nullptr, nullptr, nullptr, nullptr, RENDER_TARGET_ALREADY_CLEARED);
+    REQUIRE(GRAPHICS::Color::GREEN == render_target.GetPixel(0, 0));
+}
+
+/// This benchmark is hidden by default since it's slow.  Run it with the "[benchmark]" tag.
+TEST_CASE("Benchmark triangle rasterization for common settings.", "[.][benchmark][CpuRasterizationAlgorithm]")
+{
+    // CREATE A LARGE TEXTURED TRIANGLE.
+    constexpr unsigned int RENDER_TARGET_DIMENSION_IN_PIXELS = 512;
+    GRAPHICS::GEOMETRY::Triangle triangle = CreateCpuRasterizationTestTriangle(RENDER_TARGET_DIMENSION_IN_PIXELS);
+    GRAPHICS::IMAGES::Bitmap render_target(RENDER_TARGET_DIMENSION_IN_PIXELS, RENDER_TARGET_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::ARGB);
+    GRAPHICS::DepthBuffer depth_buffer(RENDER_TARGET_DIMENSION_IN_PIXELS, RENDER_TARGET_DIMENSION_IN_PIXELS);
+
+    // RASTERIZE THE TRIANGLE WITH COMMON SETTINGS FOR EACH PATH.
+    // The depth buffer is cleared each time so that all pixels pass the depth test.
+    GRAPHICS::RenderingSettings rendering_settings;
+    rendering_settings.UseCpuSimd = GENERATE(false, true);
+    INFO("SIMD: " << rendering_settings.UseCpuSimd);
+
+    rendering_settings.Shading.ShadingType = GRAPHICS::SHADING::ShadingType::FLAT;
+    BENCHMARK("Flat shading")
+    {
+        depth_buffer.ClearToDepth(GRAPHICS::DepthBuffer::MAX_DEPTH);
+        GRAPHICS::CPU_RENDERING::CpuRasterizationAlgorithm::Render(triangle, rendering_settings, render_target, &depth_buffer);
+    }
+
+    rendering_settings.Shading.ShadingType = GRAPHICS::SHADING::ShadingType::MATERIAL;
+    rendering_settings.Shading.TextureMappingEnabled = false;
+    BENCHMARK("Interpolated colors")
+    {
+        depth_buffer.ClearToDepth(GRAPHICS::DepthBuffer::MAX_DEPTH);
+        GRAPHICS::CPU_RENDERING::CpuRasterizationAlgorithm::Render(triangle, rendering_settings, render_target, &depth_buffer);
+    }
+
+    rendering_settings.Shading.TextureMappingEnabled = true;
+    rendering_settings.Shading.TextureFiltering = GRAPHICS::TextureFilteringType::NEAREST;
+    BENCHMARK("Nearest texture filtering")
+    {
+        depth_buffer.ClearToDepth(GRAPHICS::DepthBuffer::MAX_DEPTH);
+        GRAPHICS::CPU_RENDERING::CpuRasterizationAlgorithm::Render(triangle, rendering_settings, render_target, &depth_buffer);
+    }
+
+    rendering_settings.Shading.TextureFiltering = GRAPHICS::TextureFilteringType::TRILINEAR;
+    BENCHMARK("Trilinear texture filtering")
+    {
+        depth_buffer.ClearToDepth(GRAPHICS::DepthBuffer::MAX_DEPTH);
+        GRAPHICS::CPU_RENDERING::CpuRasterizationAlgorithm::Render(triangle, rendering_settings, render_target, &depth_buffer);
+    }
+
+    rendering_settings.ColorWrites = false;
+    BENCHMARK("Depth only")
+    {
+        depth_buffer.ClearToDepth(GRAPHICS::DepthBuffer::MAX_DEPTH);
+        GRAPHICS::CPU_RENDERING::CpuRasterizationAlgorithm::Render(triangle, rendering_settings, render_target, &depth_buffer);
+    }
+}
+
+#endif
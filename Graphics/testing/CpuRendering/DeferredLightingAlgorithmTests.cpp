@@ -0,0 +1,128 @@
+#include <memory>
+#include <vector>
+#include <catch.hpp>
+#include "Graphics/CpuRendering/DeferredLightingAlgorithm.h"
+#include "Graphics/Shading/WorldSpaceShading.h"
+#include "Graphics/Surface.h"
+#include "Graphics/testing/Viewing/TestCamera.h"
+
+TEST_CASE("Only point lights with limited ranges have screen bounds smaller than the screen.", "[DeferredLightingAlgorithm][ComputeScreenBounds]")
+{
+    // CREATE THE VIEWING TRANSFORMATIONS.
+    constexpr unsigned int SCREEN_DIMENSION_IN_PIXELS = 64;
+    GRAPHICS::IMAGES::Bitmap screen(SCREEN_DIMENSION_IN_PIXELS, SCREEN_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    GRAPHICS::VIEWING::ViewingTransformations viewing_transformations(CreatePerspectiveTestCamera(), screen);
+    MATH::Rectangleui entire_screen = MATH::Rectangleui::FromLeftTopAndDimensions(0, 0, SCREEN_DIMENSION_IN_PIXELS, SCREEN_DIMENSION_IN_PIXELS);
+
+    // VERIFY LIGHTS WITHOUT LIMITED RANGES COVER THE ENTIRE SCREEN.
+    GRAPHICS::SHADING::LIGHTING::Light ambient_light = { .Type = GRAPHICS::SHADING::LIGHTING::LightType::AMBIENT };
+    REQUIRE(entire_screen == GRAPHICS::CPU_RENDERING::DeferredLightingAlgorithm::ComputeScreenBounds(
+        ambient_light, viewing_transformations, SCREEN_DIMENSION_IN_PIXELS, SCREEN_DIMENSION_IN_PIXELS));
+    GRAPHICS::SHADING::LIGHTING::Light point_light = { .Type = GRAPHICS::SHADING::LIGHTING::LightType::POINT, .PointLightWorldPosition = MATH::Vector3f(0.0f, 0.0f, 0.0f) };
+    REQUIRE(entire_screen == GRAPHICS::CPU_RENDERING::DeferredLightingAlgorithm::ComputeScreenBounds(
+        point_light, viewing_transformations, SCREEN_DIMENSION_IN_PIXELS, SCREEN_DIMENSION_IN_PIXELS));
+
+    // VERIFY A POINT LIGHT WITH A LIMITED RANGE ONLY COVERS PART OF THE SCREEN AROUND IT.
+    point_light.PointLightWorldPosition = MATH::Vector3f(2.0f, 0.0f, 0.0f);
+    point_light.PointLightRange = 1.0f;
+    MATH::Rectangleui point_light_bounds = GRAPHICS::CPU_RENDERING::DeferredLightingAlgorithm::ComputeScreenBounds(
+        point_light, viewing_transformations, SCREEN_DIMENSION_IN_PIXELS, SCREEN_DIMENSION_IN_PIXELS);
+    REQUIRE_FALSE(point_light_bounds.IsEmpty());
+    REQUIRE(point_light_bounds.Area() < entire_screen.Area());
+    std::optional<MATH::Vector3f> light_screen_position = viewing_transformations.WorldToScreen(point_light.PointLightWorldPosition);
+    REQUIRE(light_screen_position);
+    MATH::Rectangleui light_center_pixel = MATH::Rectangleui::FromLeftTopAndDimensions(
+        static_cast<unsigned int>(light_screen_position->X),
+        static_cast<unsigned int>(light_screen_position->Y),
+        1,
+        1);
+    REQUIRE(point_light_bounds.Contains(light_center_pixel));
+
+    // VERIFY A POINT LIGHT BEHIND THE CAMERA DOESN'T COVER ANYTHING.
+    point_light.PointLightWorldPosition = MATH::Vector3f(0.0f, 0.0f, 20.0f);
+    REQUIRE(GRAPHICS::CPU_RENDERING::DeferredLightingAlgorithm::ComputeScreenBounds(
+        point_light, viewing_transformations, SCREEN_DIMENSION_IN_PIXELS, SCREEN_DIMENSION_IN_PIXELS).IsEmpty());
+}
+
+TEST_CASE("Deferred lighting shades covered pixels the same as shading their reconstructed surfaces.", "[DeferredLightingAlgorithm][Apply]")
+{
+    // CREATE THE VIEWING TRANSFORMATIONS.
+    // The screen spans multiple tiles to exercise lighting across tiles.
+    constexpr unsigned int SCREEN_DIMENSION_IN_PIXELS = 2 * GRAPHICS::CPU_RENDERING::DeferredLightingAlgorithm::TILE_DIMENSION_IN_PIXELS;
+    GRAPHICS::IMAGES::Bitmap render_target(SCREEN_DIMENSION_IN_PIXELS, SCREEN_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::ARGB);
+    render_target.FillPixels(GRAPHICS::Color::BLUE);
+    GRAPHICS::VIEWING::Camera camera = CreatePerspectiveTestCamera();
+    GRAPHICS::VIEWING::ViewingTransformations viewing_transformations(camera, render_target);
+
+    // WRITE A FEW PIXELS OF A PLANE FACING THE CAMERA.
+    auto material = std::make_shared<GRAPHICS::Material>();
+    material->AmbientProperties.Color = GRAPHICS::Color(0.1f, 0.1f, 0.1f, 1.0f);
+    material->DiffuseProperties.Color = GRAPHICS::Color(0.8f, 0.6f, 0.4f, 1.0f);
+    GRAPHICS::CPU_RENDERING::GBuffer g_buffer(SCREEN_DIMENSION_IN_PIXELS, SCREEN_DIMENSION_IN_PIXELS);
+    uint16_t material_id = g_buffer.GetMaterialId(material);
+    MATH::Vector3f plane_normal(0.0f, 0.0f, 1.0f);
+    float plane_depth = viewing_transformations.WorldToScreen(MATH::Vector3f(0.0f, 0.0f, 0.0f))->Z;
+    const unsigned int COVERED_PIXEL_COORDINATES[][2] = { { 32, 32 }, { 10, 50 }, { 60, 5 } };
+    for (const auto& pixel_coordinates : COVERED_PIXEL_COORDINATES)
+    {
+        g_buffer.WritePixel(pixel_coordinates[0], pixel_coordinates[1], plane_normal, GRAPHICS::Color(0.5f, 1.0f, 1.0f, 1.0f), material_id, plane_depth);
+    }
+
+    // LIGHT THE PIXELS.
+    // The last point light is out of range of all pixels except the center.
+    std::vector<GRAPHICS::SHADING::LIGHTING::Light> lights =
+    {
+        GRAPHICS::SHADING::LIGHTING::Light{ .Type = GRAPHICS::SHADING::LIGHTING::LightType::AMBIENT, .Color = GRAPHICS::Color::WHITE },
+        GRAPHICS::SHADING::LIGHTING::Light
+        {
+            .Type = GRAPHICS::SHADING::LIGHTING::LightType::DIRECTIONAL,
+            .Color = GRAPHICS::Color(0.5f, 0.5f, 0.5f, 1.0f),
+            .DirectionalLightDirection = MATH::Vector3f(0.0f, 0.0f, -1.0f),
+        },
+        GRAPHICS::SHADING::LIGHTING::Light
+        {
+            .Type = GRAPHICS::SHADING::LIGHTING::LightType::POINT,
+            .Color = GRAPHICS::Color::WHITE,
+            .PointLightWorldPosition = MATH::Vector3f(0.0f, 0.0f, 1.0f),
+            .PointLightRange = 1.5f,
+        },
+    };
+    GRAPHICS::SHADING::ShadingSettings shading_settings = { .TextureMappingEnabled = false };
+    const std::vector<GRAPHICS::CPU_RENDERING::ShadowMap> NO_SHADOW_MAPS;
+    GRAPHICS::CPU_RENDERING::DeferredLightingAlgorithm::Apply(
+        g_buffer,
+        lights,
+        NO_SHADOW_MAPS,
+        camera.WorldPosition,
+        viewing_transformations,
+        shading_settings,
+        render_target);
+
+    // VERIFY EACH COVERED PIXEL WAS LIT THE SAME AS SHADING ITS SURFACE DIRECTLY.
+    GRAPHICS::Surface surface = { .Normal = plane_normal, .Material = material };
+    MATH::Matrix4x4f screen_to_world_transform = viewing_transformations.ScreenToWorldTransform();
+    for (const auto& pixel_coordinates : COVERED_PIXEL_COORDINATES)
+    {
+        MATH::Vector3f screen_position(static_cast<float>(pixel_coordinates[0]), static_cast<float>(pixel_coordinates[1]), plane_depth);
+        MATH::Vector3f world_position = viewing_transformations.ScreenToWorld(screen_position, screen_to_world_transform);
+        GRAPHICS::Color expected_color = GRAPHICS::SHADING::WorldSpaceShading::ComputeMaterialShading(
+            world_position,
+            surface,
+            camera.WorldPosition,
+            lights,
+            {},
+            shading_settings);
+        expected_color = GRAPHICS::Color::ComponentMultiplyRedGreenBlue(expected_color, GRAPHICS::Color(0.5f, 1.0f, 1.0f, 1.0f));
+        expected_color.Clamp();
+        REQUIRE(expected_color == render_target.GetPixel(pixel_coordinates[0], pixel_coordinates[1]));
+    }
+
+    // VERIFY THE POINT LIGHT ONLY LIT PIXELS WITHIN ITS RANGE.
+    GRAPHICS::Color center_color = render_target.GetPixel(32, 32);
+    GRAPHICS::Color corner_color = render_target.GetPixel(60, 5);
+    REQUIRE(center_color.Green > corner_color.Green);
+
+    // VERIFY UNCOVERED PIXELS WERE LEFT UNCHANGED.
+    REQUIRE(GRAPHICS::Color::BLUE == render_target.GetPixel(0, 0));
+    REQUIRE(GRAPHICS::Color::BLUE == render_target.GetPixel(33, 32));
+}
@@ -0,0 +1,54 @@
+#include <memory>
+#include <catch.hpp>
+#include "Graphics/CpuRendering/GBuffer.h"
+
+TEST_CASE("Each material written to a G-buffer is assigned its own ID until cleared.", "[GBuffer][GetMaterialId]")
+{
+    // ASSIGN IDS TO MATERIALS.
+    GRAPHICS::CPU_RENDERING::GBuffer g_buffer(4, 4);
+    auto first_material = std::make_shared<GRAPHICS::Material>();
+    auto second_material = std::make_shared<GRAPHICS::Material>();
+    uint16_t first_material_id = g_buffer.GetMaterialId(first_material);
+    uint16_t second_material_id = g_buffer.GetMaterialId(second_material);
+
+    // VERIFY THE IDS IDENTIFY THE MATERIALS.
+    REQUIRE(GRAPHICS::CPU_RENDERING::GBuffer::NO_MATERIAL_ID != first_material_id);
+    REQUIRE(GRAPHICS::CPU_RENDERING::GBuffer::NO_MATERIAL_ID != second_material_id);
+    REQUIRE(first_material_id != second_material_id);
+    REQUIRE(first_material_id == g_buffer.GetMaterialId(first_material));
+    REQUIRE(first_material == g_buffer.GetMaterial(first_material_id));
+    REQUIRE(second_material == g_buffer.GetMaterial(second_material_id));
+    REQUIRE(GRAPHICS::CPU_RENDERING::GBuffer::NO_MATERIAL_ID == g_buffer.GetMaterialId(nullptr));
+    REQUIRE_FALSE(g_buffer.GetMaterial(GRAPHICS::CPU_RENDERING::GBuffer::NO_MATERIAL_ID));
+
+    // VERIFY CLEARING FORGETS THE MATERIALS.
+    g_buffer.Clear();
+    REQUIRE_FALSE(g_buffer.GetMaterial(second_material_id));
+    REQUIRE(first_material_id == g_buffer.GetMaterialId(second_material));
+}
+
+TEST_CASE("Writing G-buffer pixels records their attributes and bounds.", "[GBuffer][WritePixel]")
+{
+    // WRITE A FEW PIXELS.
+    GRAPHICS::CPU_RENDERING::GBuffer g_buffer(8, 8);
+    uint16_t material_id = g_buffer.GetMaterialId(std::make_shared<GRAPHICS::Material>());
+    MATH::Vector3f normal(0.0f, 1.0f, 0.0f);
+    g_buffer.WritePixel(2, 3, normal, GRAPHICS::Color::RED, material_id, 0.25f);
+    g_buffer.WritePixel(5, 1, normal, GRAPHICS::Color::WHITE, material_id, 0.5f);
+    g_buffer.WritePixel(8, 8, normal, GRAPHICS::Color::WHITE, material_id, 0.5f);
+
+    // VERIFY THE ATTRIBUTES WERE WRITTEN.
+    REQUIRE(normal == g_buffer.Normals(2, 3));
+    REQUIRE(GRAPHICS::Color::RED == GRAPHICS::Color::Unpack(g_buffer.Albedos(2, 3), GRAPHICS::CPU_RENDERING::GBuffer::ALBEDO_COLOR_FORMAT));
+    REQUIRE(material_id == g_buffer.MaterialIds(2, 3));
+    REQUIRE(0.25f == g_buffer.Depths(2, 3));
+    REQUIRE(GRAPHICS::CPU_RENDERING::GBuffer::NO_MATERIAL_ID == g_buffer.MaterialIds(0, 0));
+
+    // VERIFY THE BOUNDS ONLY INCLUDE VALID PIXELS.
+    REQUIRE(MATH::Rectangleui::FromLeftTopAndDimensions(2, 1, 4, 3) == g_buffer.WrittenBounds);
+
+    // VERIFY CLEARING UNCOVERS ALL PIXELS.
+    g_buffer.Clear();
+    REQUIRE(GRAPHICS::CPU_RENDERING::GBuffer::NO_MATERIAL_ID == g_buffer.MaterialIds(2, 3));
+    REQUIRE(g_buffer.WrittenBounds.IsEmpty());
+}
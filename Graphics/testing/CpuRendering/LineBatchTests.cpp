@@ -0,0 +1,61 @@
+#include <catch.hpp>
+#include "Graphics/CpuRendering/LineBatch.h"
+
+TEST_CASE("Single-colored lines have their color packed when added.", "[LineBatch][Add]")
+{
+    // ADD A LINE.
+    GRAPHICS::CPU_RENDERING::LineBatch line_batch(GRAPHICS::ColorFormat::RGBA);
+    MATH::Vector3f start_position(1.0f, 2.0f, 0.5f);
+    MATH::Vector3f end_position(10.0f, 20.0f, -0.5f);
+    line_batch.Add(start_position, end_position, GRAPHICS::Color::RED);
+
+    // VERIFY THE LINE WAS ADDED WITH A PACKED COLOR.
+    REQUIRE(1 == line_batch.Lines.size());
+    const GRAPHICS::CPU_RENDERING::LineBatch::Line& line = line_batch.Lines.front();
+    REQUIRE(start_position == line.StartPosition);
+    REQUIRE(end_position == line.EndPosition);
+    uint32_t expected_packed_color = GRAPHICS::Color::RED.Pack(GRAPHICS::ColorFormat::RGBA);
+    REQUIRE(expected_packed_color == line.StartColor);
+    REQUIRE(expected_packed_color == line.EndColor);
+}
+
+TEST_CASE("Lines between vertices have clamped colors packed for each end.", "[LineBatch][Add]")
+{
+    // ADD A LINE BETWEEN VERTICES.
+    GRAPHICS::CPU_RENDERING::LineBatch line_batch(GRAPHICS::ColorFormat::ARGB);
+    GRAPHICS::VertexWithAttributes start_vertex;
+    start_vertex.Color = GRAPHICS::Color(2.0f, 0.0f, 0.0f, 1.0f);
+    GRAPHICS::VertexWithAttributes end_vertex;
+    end_vertex.Color = GRAPHICS::Color(0.0f, 0.0f, 1.0f, 0.0f);
+    line_batch.Add(start_vertex, end_vertex);
+
+    // VERIFY THE COLORS WERE CLAMPED AND PACKED.
+    // Only red, green, and blue are interpolated along lines, so alpha from the start is used for the end.
+    REQUIRE(1 == line_batch.Lines.size());
+    REQUIRE(GRAPHICS::Color::RED.Pack(GRAPHICS::ColorFormat::ARGB) == line_batch.Lines.front().StartColor);
+    REQUIRE(GRAPHICS::Color::BLUE.Pack(GRAPHICS::ColorFormat::ARGB) == line_batch.Lines.front().EndColor);
+}
+
+TEST_CASE("Edges shared between triangles are only added once.", "[LineBatch][AddEdge]")
+{
+    // ADD EDGES FOR TWO TRIANGLES SHARING AN EDGE.
+    GRAPHICS::CPU_RENDERING::LineBatch line_batch(GRAPHICS::ColorFormat::ARGB);
+    GRAPHICS::VertexWithAttributes vertex;
+    line_batch.AddEdge(0, 1, vertex, vertex);
+    line_batch.AddEdge(1, 2, vertex, vertex);
+    line_batch.AddEdge(2, 0, vertex, vertex);
+    // The shared edge is traversed in the opposite direction for the second triangle.
+    line_batch.AddEdge(2, 1, vertex, vertex);
+    line_batch.AddEdge(1, 3, vertex, vertex);
+    line_batch.AddEdge(3, 2, vertex, vertex);
+
+    // VERIFY ONLY UNIQUE EDGES WERE ADDED.
+    constexpr std::size_t UNIQUE_EDGE_COUNT = 5;
+    REQUIRE(UNIQUE_EDGE_COUNT == line_batch.Lines.size());
+
+    // VERIFY EDGES CAN BE ADDED AGAIN AFTER CLEARING.
+    line_batch.Clear();
+    REQUIRE(line_batch.Lines.empty());
+    line_batch.AddEdge(1, 2, vertex, vertex);
+    REQUIRE(1 == line_batch.Lines.size());
+}
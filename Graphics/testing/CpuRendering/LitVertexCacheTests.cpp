@@ -0,0 +1,285 @@
+#include <memory>
+#include <catch.hpp>
+#include "Graphics/CpuRendering/LitVertexCache.h"
+#include "Graphics/Geometry/Triangle.h"
+#include "Graphics/Shading/WorldSpaceShading.h"
+#include "Graphics/Surface.h"
+#include "Graphics/testing/Viewing/TestCamera.h"
+
+/// Creates an indexed quad mesh with vertex normals tilted outward from its center.
+/// @param[in]  material - The material for the quad.
+/// @return The quad mesh.
+GRAPHICS::Mesh CreateLitVertexCacheQuadMesh(const std::shared_ptr<GRAPHICS::Material>& material)
+{
+    GRAPHICS::Mesh quad_mesh;
+    for (const MATH::Vector2f& corner : { MATH::Vector2f(-1.0f, -1.0f), MATH::Vector2f(1.0f, -1.0f), MATH::Vector2f(1.0f, 1.0f), MATH::Vector2f(-1.0f, 1.0f) })
+    {
+        quad_mesh.Vertices.emplace_back(GRAPHICS::VertexWithAttributes
+        {
+            .Position = MATH::Vector3f(corner.X, corner.Y, 0.0f),
+            .Normal = MATH::Vector3f::Normalize(MATH::Vector3f(corner.X, corner.Y, 2.0f)),
+        });
+    }
+    quad_mesh.Indices = { 0, 1, 2, 0, 2, 3 };
+    quad_mesh.Subsets.emplace_back(GRAPHICS::MeshSubset{ .FirstIndex = 0, .IndexCount = 6, .Material = material });
+    return quad_mesh;
+}
+
+TEST_CASE("Vertex lighting is only cacheable for indexed meshes with vertex normals enabled.", "[LitVertexCache][VertexLightingCacheable]")
+{
+    auto material = std::make_shared<GRAPHICS::Material>();
+    GRAPHICS::Mesh indexed_mesh = CreateLitVertexCacheQuadMesh(material);
+    GRAPHICS::Mesh non_indexed_mesh;
+    non_indexed_mesh.Triangles.emplace_back(GRAPHICS::GEOMETRY::Triangle::CreateEquilateral(material));
+
+    GRAPHICS::SHADING::LIGHTING::LightingSettings lighting_settings;
+    REQUIRE_FALSE(GRAPHICS::CPU_RENDERING::LitVertexCache::VertexLightingCacheable(indexed_mesh, lighting_settings));
+
+    lighting_settings.VertexNormalsEnabled = true;
+    REQUIRE(GRAPHICS::CPU_RENDERING::LitVertexCache::VertexLightingCacheable(indexed_mesh, lighting_settings));
+    REQUIRE_FALSE(GRAPHICS::CPU_RENDERING::LitVertexCache::VertexLightingCacheable(non_indexed_mesh, lighting_settings));
+
+    lighting_settings.Enabled = false;
+    REQUIRE_FALSE(GRAPHICS::CPU_RENDERING::LitVertexCache::VertexLightingCacheable(indexed_mesh, lighting_settings));
+}
+
+TEST_CASE("Cached vertex lighting matches shading each vertex with its normal.", "[LitVertexCache][GetLitVertices]")
+{
+    // CREATE THE MESH AND LIGHTS.
+    auto material = std::make_shared<GRAPHICS::Material>();
+    material->AmbientProperties.Color = GRAPHICS::Color(0.1f, 0.1f, 0.1f, 1.0f);
+    material->DiffuseProperties.Color = GRAPHICS::Color(0.8f, 0.4f, 0.2f, 1.0f);
+    material->SpecularProperties.Color = GRAPHICS::Color::WHITE;
+    material->SpecularProperties.SpecularPower = 8.0f;
+    GRAPHICS::Mesh quad_mesh = CreateLitVertexCacheQuadMesh(material);
+
+    std::vector<GRAPHICS::SHADING::LIGHTING::Light> lights =
+    {
+        GRAPHICS::SHADING::LIGHTING::Light{ .Type = GRAPHICS::SHADING::LIGHTING::LightType::AMBIENT, .Color = GRAPHICS::Color::WHITE },
+        GRAPHICS::SHADING::LIGHTING::Light
+        {
+            .Type = GRAPHICS::SHADING::LIGHTING::LightType::POINT,
+            .Color = GRAPHICS::Color::WHITE,
+            .PointLightWorldPosition = MATH::Vector3f(2.0f, 1.0f, 3.0f),
+        },
+    };
+    MATH::Vector3f camera_world_position(0.0f, 0.0f, 5.0f);
+    GRAPHICS::SHADING::LIGHTING::LightingSettings lighting_settings = { .VertexNormalsEnabled = true };
+
+    // LIGHT THE VERTICES.
+    GRAPHICS::CPU_RENDERING::LitVertexCache lit_vertex_cache;
+    MATH::AffineTransform3x4 world_transform = MATH::AffineTransform3x4::Translation(MATH::Vector3f(0.0f, 0.0f, -1.0f));
+    const GRAPHICS::CPU_RENDERING::LitVertexCache::MeshEntry& mesh_entry = lit_vertex_cache.GetLitVertices(
+        quad_mesh,
+        world_transform,
+        lights,
+        camera_world_position,
+        lighting_settings);
+
+    // VERIFY EACH VERTEX WAS LIT THE SAME AS SHADING IT DIRECTLY.
+    REQUIRE(mesh_entry.VertexLightingComputed);
+    REQUIRE(1 == mesh_entry.Materials.size());
+    REQUIRE(std::vector<std::size_t>{ 0 } == mesh_entry.SubsetMaterialIndices);
+    GRAPHICS::GEOMETRY::Triangle material_triangle;
+    material_triangle.Material = material;
+    GRAPHICS::SHADING::ShadingSettings shading_settings = { .Lighting = lighting_settings, .TextureMappingEnabled = false };
+    for (std::size_t vertex_index = 0; vertex_index < quad_mesh.Vertices.size(); ++vertex_index)
+    {
+        const GRAPHICS::VertexWithAttributes& local_vertex = quad_mesh.Vertices[vertex_index];
+        MATH::Vector3f expected_world_position = local_vertex.Position + MATH::Vector3f(0.0f, 0.0f, -1.0f);
+        REQUIRE(expected_world_position == mesh_entry.WorldSpaceVertices[vertex_index].Position);
+
+        GRAPHICS::Surface surface = { .Shape = &material_triangle, .Normal = local_vertex.Normal };
+        GRAPHICS::Color expected_color = GRAPHICS::SHADING::WorldSpaceShading::ComputeMaterialShading(
+            expected_world_position,
+            surface,
+            camera_world_position,
+            lights,
+            {},
+            shading_settings);
+        REQUIRE(expected_color == mesh_entry.LitVertexColorsByMaterialIndex[0][vertex_index]);
+    }
+
+    // VERIFY VERTICES WITH DIFFERENT NORMALS WERE LIT DIFFERENTLY.
+    REQUIRE(mesh_entry.LitVertexColorsByMaterialIndex[0][0] != mesh_entry.LitVertexColorsByMaterialIndex[0][2]);
+}
+
+TEST_CASE("Cached vertex lighting with clustered lights matches lighting with all lights.", "[LitVertexCache][GetLitVertices]")
+{
+    // CREATE A GRID MESH FACING THE CAMERA.
+    // Enough vertices are used for vertices in the same clusters to be lit together in batches.
+    auto material = std::make_shared<GRAPHICS::Material>();
+    material->AmbientProperties.Color = GRAPHICS::Color(0.1f, 0.1f, 0.1f, 1.0f);
+    material->DiffuseProperties.Color = GRAPHICS::Color(0.8f, 0.4f, 0.2f, 1.0f);
+    material->SpecularProperties.Color = GRAPHICS::Color::WHITE;
+    material->SpecularProperties.SpecularPower = 8.0f;
+    constexpr uint32_t GRID_DIMENSION_IN_VERTICES = 33;
+    GRAPHICS::Mesh grid_mesh;
+    for (uint32_t row_index = 0; row_index < GRID_DIMENSION_IN_VERTICES; ++row_index)
+    {
+        for (uint32_t column_index = 0; column_index < GRID_DIMENSION_IN_VERTICES; ++column_index)
+        {
+            grid_mesh.Vertices.emplace_back(GRAPHICS::VertexWithAttributes
+            {
+                .Position = MATH::Vector3f(0.25f * static_cast<float>(column_index) - 4.0f, 0.25f * static_cast<float>(row_index) - 4.0f, 0.0f),
+                .Normal = MATH::Vector3f(0.0f, 0.0f, 1.0f),
+            });
+        }
+    }
+    for (uint32_t row_index = 0; row_index + 1 < GRID_DIMENSION_IN_VERTICES; ++row_index)
+    {
+        for (uint32_t column_index = 0; column_index + 1 < GRID_DIMENSION_IN_VERTICES; ++column_index)
+        {
+            uint32_t top_left_index = row_index * GRID_DIMENSION_IN_VERTICES + column_index;
+            uint32_t bottom_left_index = top_left_index + GRID_DIMENSION_IN_VERTICES;
+            grid_mesh.Indices.insert(grid_mesh.Indices.end(), { top_left_index, top_left_index + 1, bottom_left_index + 1, top_left_index, bottom_left_index + 1, bottom_left_index });
+        }
+    }
+    grid_mesh.Subsets.emplace_back(GRAPHICS::MeshSubset{ .FirstIndex = 0, .IndexCount = static_cast<uint32_t>(grid_mesh.Indices.size()), .Material = material });
+
+    // CREATE LIGHTS WITH LIMITED RANGES ACROSS THE MESH.
+    std::vector<GRAPHICS::SHADING::LIGHTING::Light> lights =
+    {
+        GRAPHICS::SHADING::LIGHTING::Light{ .Type = GRAPHICS::SHADING::LIGHTING::LightType::AMBIENT, .Color = GRAPHICS::Color::WHITE },
+    };
+    for (float x = -3.0f; x <= 3.0f; x += 2.0f)
+    {
+        for (float y = -3.0f; y <= 3.0f; y += 2.0f)
+        {
+            lights.emplace_back(GRAPHICS::SHADING::LIGHTING::Light
+            {
+                .Type = GRAPHICS::SHADING::LIGHTING::LightType::POINT,
+                .Color = GRAPHICS::Color(0.3f, 0.3f, 0.3f, 1.0f),
+                .PointLightWorldPosition = MATH::Vector3f(x, y, 0.5f),
+                .PointLightRange = 1.5f,
+            });
+        }
+    }
+
+    // BUILD THE CLUSTERED LIGHT GRID.
+    GRAPHICS::VIEWING::Camera camera = CreatePerspectiveTestCamera();
+    constexpr unsigned int SCREEN_DIMENSION_IN_PIXELS = 4 * GRAPHICS::CPU_RENDERING::ClusteredLightGrid::TILE_DIMENSION_IN_PIXELS;
+    GRAPHICS::IMAGES::Bitmap screen(SCREEN_DIMENSION_IN_PIXELS, SCREEN_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    GRAPHICS::VIEWING::ViewingTransformations viewing_transformations(camera, screen);
+    GRAPHICS::CPU_RENDERING::ClusteredLightGrid light_grid(lights, viewing_transformations, SCREEN_DIMENSION_IN_PIXELS, SCREEN_DIMENSION_IN_PIXELS);
+
+    // LIGHT THE VERTICES WITH AND WITHOUT CLUSTERED LIGHTS.
+    GRAPHICS::SHADING::LIGHTING::LightingSettings lighting_settings = { .VertexNormalsEnabled = true };
+    MATH::AffineTransform3x4 world_transform = MATH::AffineTransform3x4::Identity();
+    GRAPHICS::CPU_RENDERING::LitVertexCache lit_vertex_cache;
+    std::vector<GRAPHICS::Color> expected_colors = lit_vertex_cache.GetLitVertices(
+        grid_mesh, world_transform, lights, camera.WorldPosition, lighting_settings).LitVertexColorsByMaterialIndex[0];
+    GRAPHICS::CPU_RENDERING::LitVertexCache clustered_lit_vertex_cache;
+    const GRAPHICS::CPU_RENDERING::LitVertexCache::MeshEntry& clustered_mesh_entry = clustered_lit_vertex_cache.GetLitVertices(
+        grid_mesh, world_transform, lights, camera.WorldPosition, lighting_settings, &light_grid);
+
+    // VERIFY THE COLORS ARE THE SAME.
+    REQUIRE(expected_colors == clustered_mesh_entry.LitVertexColorsByMaterialIndex[0]);
+}
+
+TEST_CASE("Cached vertices are reused until their inputs change.", "[LitVertexCache][GetLitVertices]")
+{
+    // LIGHT THE VERTICES OF A MESH.
+    auto material = std::make_shared<GRAPHICS::Material>();
+    material->DiffuseProperties.Color = GRAPHICS::Color::WHITE;
+    GRAPHICS::Mesh quad_mesh = CreateLitVertexCacheQuadMesh(material);
+    std::vector<GRAPHICS::SHADING::LIGHTING::Light> lights =
+    {
+        GRAPHICS::SHADING::LIGHTING::Light
+        {
+            .Type = GRAPHICS::SHADING::LIGHTING::LightType::DIRECTIONAL,
+            .Color = GRAPHICS::Color::WHITE,
+            .DirectionalLightDirection = MATH::Vector3f(0.0f, 0.0f, -1.0f),
+        },
+    };
+    MATH::Vector3f camera_world_position(0.0f, 0.0f, 5.0f);
+    GRAPHICS::SHADING::LIGHTING::LightingSettings lighting_settings = { .VertexNormalsEnabled = true };
+    GRAPHICS::CPU_RENDERING::LitVertexCache lit_vertex_cache;
+    MATH::AffineTransform3x4 world_transform = MATH::AffineTransform3x4::Identity();
+    GRAPHICS::Color original_color = lit_vertex_cache.GetLitVertices(
+        quad_mesh, world_transform, lights, camera_world_position, lighting_settings).LitVertexColorsByMaterialIndex[0][0];
+
+    // VERIFY THE CACHED VERTICES ARE REUSED WHEN INPUTS ARE THE SAME.
+    // Changes to the mesh itself aren't detected, which makes it possible to observe reuse.
+    quad_mesh.Vertices[0].Position.Z = 10.0f;
+    const GRAPHICS::CPU_RENDERING::LitVertexCache::MeshEntry& reused_mesh_entry = lit_vertex_cache.GetLitVertices(
+        quad_mesh, world_transform, lights, camera_world_position, lighting_settings);
+    REQUIRE(0.0f == reused_mesh_entry.WorldSpaceVertices[0].Position.Z);
+    REQUIRE(1 == lit_vertex_cache.EntriesByMesh.size());
+
+    // VERIFY THE VERTICES ARE RECOMPUTED WHEN THE WORLD TRANSFORM CHANGES.
+    world_transform = MATH::AffineTransform3x4::Translation(MATH::Vector3f(1.0f, 0.0f, 0.0f));
+    const GRAPHICS::CPU_RENDERING::LitVertexCache::MeshEntry& transformed_mesh_entry = lit_vertex_cache.GetLitVertices(
+        quad_mesh, world_transform, lights, camera_world_position, lighting_settings);
+    REQUIRE(MATH::Vector3f(0.0f, -1.0f, 10.0f) == transformed_mesh_entry.WorldSpaceVertices[0].Position);
+
+    // VERIFY LIGHTING IS RECOMPUTED WHEN THE LIGHTS CHANGE.
+    lights.front().Color = GRAPHICS::Color::BLACK;
+    const GRAPHICS::CPU_RENDERING::LitVertexCache::MeshEntry& relit_mesh_entry = lit_vertex_cache.GetLitVertices(
+        quad_mesh, world_transform, lights, camera_world_position, lighting_settings);
+    REQUIRE(original_color != relit_mesh_entry.LitVertexColorsByMaterialIndex[0][0]);
+    REQUIRE(GRAPHICS::Color::BLACK == relit_mesh_entry.LitVertexColorsByMaterialIndex[0][0]);
+}
+
+TEST_CASE("A different mesh replacing a cached mesh at the same address isn't mistaken for it.", "[LitVertexCache][GetLitVertices]")
+{
+    // LIGHT THE VERTICES OF A MESH.
+    auto white_material = std::make_shared<GRAPHICS::Material>();
+    white_material->DiffuseProperties.Color = GRAPHICS::Color::WHITE;
+    GRAPHICS::Mesh quad_mesh = CreateLitVertexCacheQuadMesh(white_material);
+    std::vector<GRAPHICS::SHADING::LIGHTING::Light> lights =
+    {
+        GRAPHICS::SHADING::LIGHTING::Light
+        {
+            .Type = GRAPHICS::SHADING::LIGHTING::LightType::DIRECTIONAL,
+            .Color = GRAPHICS::Color::WHITE,
+            .DirectionalLightDirection = MATH::Vector3f(0.0f, 0.0f, -1.0f),
+        },
+    };
+    MATH::Vector3f camera_world_position(0.0f, 0.0f, 5.0f);
+    GRAPHICS::SHADING::LIGHTING::LightingSettings lighting_settings = { .VertexNormalsEnabled = true };
+    GRAPHICS::CPU_RENDERING::LitVertexCache lit_vertex_cache;
+    MATH::AffineTransform3x4 world_transform = MATH::AffineTransform3x4::Identity();
+    GRAPHICS::Color original_color = lit_vertex_cache.GetLitVertices(
+        quad_mesh, world_transform, lights, camera_world_position, lighting_settings).LitVertexColorsByMaterialIndex[0][0];
+    REQUIRE(GRAPHICS::Color::BLACK != original_color);
+
+    // REPLACE THE MESH WITH A DIFFERENT ONE HAVING THE SAME NUMBER OF VERTICES.
+    // This is like reloading a mesh in place, which leaves the mesh at the same address but with new vertex memory.
+    auto black_material = std::make_shared<GRAPHICS::Material>();
+    black_material->DiffuseProperties.Color = GRAPHICS::Color::BLACK;
+    GRAPHICS::Mesh replacement_quad_mesh = CreateLitVertexCacheQuadMesh(black_material);
+    replacement_quad_mesh.Vertices[0].Position.Z = 10.0f;
+    quad_mesh = std::move(replacement_quad_mesh);
+
+    // VERIFY THE VERTICES AND LIGHTING ARE RECOMPUTED FOR THE REPLACEMENT MESH.
+    const GRAPHICS::CPU_RENDERING::LitVertexCache::MeshEntry& replacement_mesh_entry = lit_vertex_cache.GetLitVertices(
+        quad_mesh, world_transform, lights, camera_world_position, lighting_settings);
+    REQUIRE(1 == lit_vertex_cache.EntriesByMesh.size());
+    REQUIRE(10.0f == replacement_mesh_entry.WorldSpaceVertices[0].Position.Z);
+    REQUIRE(black_material == replacement_mesh_entry.Materials[0]);
+    REQUIRE(GRAPHICS::Color::BLACK == replacement_mesh_entry.LitVertexColorsByMaterialIndex[0][0]);
+}
+
+TEST_CASE("Cache entries for meshes not used in a frame are removed.", "[LitVertexCache][BeginFrame]")
+{
+    // CACHE VERTICES FOR TWO MESHES.
+    auto material = std::make_shared<GRAPHICS::Material>();
+    GRAPHICS::Mesh first_mesh = CreateLitVertexCacheQuadMesh(material);
+    GRAPHICS::Mesh second_mesh = CreateLitVertexCacheQuadMesh(material);
+    GRAPHICS::CPU_RENDERING::LitVertexCache lit_vertex_cache;
+    lit_vertex_cache.BeginFrame();
+    lit_vertex_cache.GetWorldSpaceVertices(first_mesh, MATH::AffineTransform3x4::Identity());
+    lit_vertex_cache.GetWorldSpaceVertices(second_mesh, MATH::AffineTransform3x4::Identity());
+    REQUIRE(2 == lit_vertex_cache.EntriesByMesh.size());
+
+    // ONLY USE ONE MESH IN THE NEXT FRAME.
+    lit_vertex_cache.BeginFrame();
+    lit_vertex_cache.GetWorldSpaceVertices(first_mesh, MATH::AffineTransform3x4::Identity());
+    REQUIRE(2 == lit_vertex_cache.EntriesByMesh.size());
+
+    // VERIFY THE UNUSED MESH IS REMOVED AT THE START OF THE FOLLOWING FRAME.
+    lit_vertex_cache.BeginFrame();
+    REQUIRE(1 == lit_vertex_cache.EntriesByMesh.size());
+    REQUIRE(lit_vertex_cache.EntriesByMesh.contains(&first_mesh));
+}
@@ -0,0 +1,174 @@
+#include <vector>
+#include <catch.hpp>
+#include "Graphics/CpuRendering/ShadowMap.h"
+
+/// Writes the depths of an occluder to a shadow map face for shadow map tests, as if it had been rendered.
+/// The occluder covers the half of the horizontal plane at the specified height with negative X coordinates.
+/// @param[in]  occluder_y_position - The height of the occluder's plane.
+/// @param[in,out]  face - The face to write depths to.
+void WriteShadowMapTestOccluderDepths(const float occluder_y_position, GRAPHICS::CPU_RENDERING::ShadowMap::Face& face)
+{
+    MATH::Matrix4x4f screen_to_world_transform = face.LightViewingTransformations.ScreenToWorldTransform();
+    for (unsigned int y = 0; y < face.Depths.GetHeightInPixels(); ++y)
+    {
+        for (unsigned int x = 0; x < face.Depths.GetWidthInPixels(); ++x)
+        {
+            // FIND WHERE THE TEXEL'S RAY FROM THE LIGHT HITS THE OCCLUDER'S PLANE.
+            MATH::Vector3f near_screen_position(static_cast<float>(x), static_cast<float>(y), 0.75f);
+            MATH::Vector3f far_screen_position(static_cast<float>(x), static_cast<float>(y), 0.25f);
+            MATH::Vector3f near_world_position = face.LightViewingTransformations.ScreenToWorld(near_screen_position, screen_to_world_transform);
+            MATH::Vector3f far_world_position = face.LightViewingTransformations.ScreenToWorld(far_screen_position, screen_to_world_transform);
+            MATH::Vector3f ray_direction = far_world_position - near_world_position;
+            if (0.0f == ray_direction.Y)
+            {
+                continue;
+            }
+            float ray_distance_to_occluder = (occluder_y_position - near_world_position.Y) / ray_direction.Y;
+            MATH::Vector3f occluder_world_position = near_world_position + MATH::Vector3f::Scale(ray_distance_to_occluder, ray_direction);
+            if (occluder_world_position.X >= 0.0f)
+            {
+                continue;
+            }
+
+            // WRITE THE OCCLUDER'S DEPTH.
+            std::optional<MATH::Vector3f> occluder_screen_position = face.LightViewingTransformations.WorldToScreen(occluder_world_position);
+            if (occluder_screen_position)
+            {
+                face.Depths.WriteDepth(x, y, occluder_screen_position->Z);
+            }
+        }
+    }
+}
+
+TEST_CASE("Only directional and point lights with non-empty shadow maps cast shadows.", "[ShadowMap][CastsShadows]")
+{
+    GRAPHICS::SHADING::LIGHTING::Light light = { .Type = GRAPHICS::SHADING::LIGHTING::LightType::AMBIENT };
+    REQUIRE_FALSE(GRAPHICS::CPU_RENDERING::ShadowMap::CastsShadows(light));
+
+    light.Type = GRAPHICS::SHADING::LIGHTING::LightType::DIRECTIONAL;
+    REQUIRE(GRAPHICS::CPU_RENDERING::ShadowMap::CastsShadows(light));
+
+    light.Type = GRAPHICS::SHADING::LIGHTING::LightType::POINT;
+    REQUIRE(GRAPHICS::CPU_RENDERING::ShadowMap::CastsShadows(light));
+
+    light.ShadowMapDimensionInPixels = 0;
+    REQUIRE_FALSE(GRAPHICS::CPU_RENDERING::ShadowMap::CastsShadows(light));
+}
+
+TEST_CASE("Directional light shadow maps only shadow positions behind occluders.", "[ShadowMap][ComputeShadowFactor]")
+{
+    // CREATE A SHADOW MAP WITH AN OCCLUDER.
+    GRAPHICS::SHADING::LIGHTING::Light light =
+    {
+        .Type = GRAPHICS::SHADING::LIGHTING::LightType::DIRECTIONAL,
+        .Color = GRAPHICS::Color::WHITE,
+        .DirectionalLightDirection = MATH::Vector3f(0.0f, -1.0f, 0.0f),
+        .ShadowMapDimensionInPixels = 128,
+    };
+    constexpr unsigned int HARD_SHADOW_FILTER_RADIUS_IN_TEXELS = 0;
+    GRAPHICS::CPU_RENDERING::ShadowMap shadow_map(light, MATH::Vector3f(0.0f, 0.0f, 0.0f), 3.0f, HARD_SHADOW_FILTER_RADIUS_IN_TEXELS);
+    REQUIRE(1 == shadow_map.Faces.size());
+    constexpr float OCCLUDER_Y_POSITION = 1.0f;
+    WriteShadowMapTestOccluderDepths(OCCLUDER_Y_POSITION, shadow_map.Faces[0]);
+
+    // VERIFY ONLY POSITIONS BEHIND THE OCCLUDER ARE SHADOWED.
+    const MATH::Vector3f UP_NORMAL(0.0f, 1.0f, 0.0f);
+    REQUIRE(0.0f == shadow_map.ComputeShadowFactor(MATH::Vector3f(-1.0f, 0.0f, 0.0f), UP_NORMAL));
+    REQUIRE(0.0f == shadow_map.ComputeShadowFactor(MATH::Vector3f(-2.0f, -1.0f, 1.0f), UP_NORMAL));
+    REQUIRE(1.0f == shadow_map.ComputeShadowFactor(MATH::Vector3f(1.0f, 0.0f, 0.0f), UP_NORMAL));
+    REQUIRE(1.0f == shadow_map.ComputeShadowFactor(MATH::Vector3f(2.0f, -1.0f, -1.0f), UP_NORMAL));
+
+    // VERIFY THE OCCLUDER DOESN'T SHADOW ITSELF.
+    REQUIRE(1.0f == shadow_map.ComputeShadowFactor(MATH::Vector3f(-1.0f, OCCLUDER_Y_POSITION, 0.0f), UP_NORMAL));
+    REQUIRE(1.0f == shadow_map.ComputeShadowFactor(MATH::Vector3f(-2.5f, OCCLUDER_Y_POSITION, 1.5f), UP_NORMAL));
+
+    // VERIFY FILTERING SOFTENS THE EDGE OF THE SHADOW.
+    shadow_map.FilterRadiusInTexels = 2;
+    float shadow_edge_shadow_factor = shadow_map.ComputeShadowFactor(MATH::Vector3f(0.0f, 0.0f, 0.0f), UP_NORMAL);
+    REQUIRE(0.0f < shadow_edge_shadow_factor);
+    REQUIRE(shadow_edge_shadow_factor < 1.0f);
+    REQUIRE(0.0f == shadow_map.ComputeShadowFactor(MATH::Vector3f(-1.0f, 0.0f, 0.0f), UP_NORMAL));
+    REQUIRE(1.0f == shadow_map.ComputeShadowFactor(MATH::Vector3f(1.0f, 0.0f, 0.0f), UP_NORMAL));
+}
+
+TEST_CASE("Point light shadow maps only shadow positions behind occluders in the face toward them.", "[ShadowMap][ComputeShadowFactor]")
+{
+    // CREATE A SHADOW MAP WITH AN OCCLUDER BELOW THE LIGHT.
+    GRAPHICS::SHADING::LIGHTING::Light light =
+    {
+        .Type = GRAPHICS::SHADING::LIGHTING::LightType::POINT,
+        .Color = GRAPHICS::Color::WHITE,
+        .PointLightWorldPosition = MATH::Vector3f(0.0f, 3.0f, 0.0f),
+        .ShadowMapDimensionInPixels = 128,
+    };
+    constexpr unsigned int HARD_SHADOW_FILTER_RADIUS_IN_TEXELS = 0;
+    GRAPHICS::CPU_RENDERING::ShadowMap shadow_map(light, MATH::Vector3f(0.0f, 0.0f, 0.0f), 3.0f, HARD_SHADOW_FILTER_RADIUS_IN_TEXELS);
+    REQUIRE(GRAPHICS::CPU_RENDERING::ShadowMap::CUBE_MAP_FACE_COUNT == shadow_map.Faces.size());
+    constexpr std::size_t NEGATIVE_Y_FACE_INDEX = 3;
+    constexpr float OCCLUDER_Y_POSITION = 2.0f;
+    WriteShadowMapTestOccluderDepths(OCCLUDER_Y_POSITION, shadow_map.Faces[NEGATIVE_Y_FACE_INDEX]);
+
+    // VERIFY ONLY POSITIONS BEHIND THE OCCLUDER ARE SHADOWED.
+    const MATH::Vector3f UP_NORMAL(0.0f, 1.0f, 0.0f);
+    REQUIRE(0.0f == shadow_map.ComputeShadowFactor(MATH::Vector3f(-1.0f, 0.0f, 0.0f), UP_NORMAL));
+    REQUIRE(0.0f == shadow_map.ComputeShadowFactor(MATH::Vector3f(-0.5f, 0.0f, 1.0f), UP_NORMAL));
+    REQUIRE(1.0f == shadow_map.ComputeShadowFactor(MATH::Vector3f(1.0f, 0.0f, 0.0f), UP_NORMAL));
+    REQUIRE(1.0f == shadow_map.ComputeShadowFactor(MATH::Vector3f(0.5f, 0.0f, -1.0f), UP_NORMAL));
+
+    // VERIFY THE OCCLUDER DOESN'T SHADOW ITSELF.
+    REQUIRE(1.0f == shadow_map.ComputeShadowFactor(MATH::Vector3f(-0.5f, OCCLUDER_Y_POSITION, 0.25f), UP_NORMAL));
+
+    // VERIFY POSITIONS COVERED BY OTHER FACES AREN'T SHADOWED.
+    const MATH::Vector3f RIGHT_NORMAL(1.0f, 0.0f, 0.0f);
+    REQUIRE(1.0f == shadow_map.ComputeShadowFactor(MATH::Vector3f(-3.0f, 2.5f, 0.0f), RIGHT_NORMAL));
+}
+
+TEST_CASE("Shadow factors are only computed for lights with shadow maps.", "[ShadowMap][ComputeShadowFactors]")
+{
+    // CREATE A SHADOW MAP FOR A DIRECTIONAL LIGHT WITH AN OCCLUDER.
+    std::vector<GRAPHICS::SHADING::LIGHTING::Light> lights =
+    {
+        GRAPHICS::SHADING::LIGHTING::Light{ .Type = GRAPHICS::SHADING::LIGHTING::LightType::AMBIENT, .Color = GRAPHICS::Color::WHITE },
+        GRAPHICS::SHADING::LIGHTING::Light
+        {
+            .Type = GRAPHICS::SHADING::LIGHTING::LightType::DIRECTIONAL,
+            .Color = GRAPHICS::Color::WHITE,
+            .DirectionalLightDirection = MATH::Vector3f(0.0f, -1.0f, 0.0f),
+            .ShadowMapDimensionInPixels = 64,
+        },
+        GRAPHICS::SHADING::LIGHTING::Light
+        {
+            .Type = GRAPHICS::SHADING::LIGHTING::LightType::DIRECTIONAL,
+            .Color = GRAPHICS::Color::WHITE,
+            .DirectionalLightDirection = MATH::Vector3f(1.0f, -1.0f, 0.0f),
+            .ShadowMapDimensionInPixels = 0,
+        },
+    };
+    std::vector<GRAPHICS::CPU_RENDERING::ShadowMap> shadow_maps;
+    constexpr unsigned int HARD_SHADOW_FILTER_RADIUS_IN_TEXELS = 0;
+    shadow_maps.emplace_back(lights[1], MATH::Vector3f(0.0f, 0.0f, 0.0f), 3.0f, HARD_SHADOW_FILTER_RADIUS_IN_TEXELS);
+    WriteShadowMapTestOccluderDepths(1.0f, shadow_maps.front().Faces.front());
+    REQUIRE(&shadow_maps.front() == GRAPHICS::CPU_RENDERING::ShadowMap::Find(shadow_maps, lights[1]));
+    REQUIRE(nullptr == GRAPHICS::CPU_RENDERING::ShadowMap::Find(shadow_maps, lights[2]));
+
+    // VERIFY ONLY THE LIGHT WITH A SHADOW MAP IS SHADOWED.
+    std::vector<float> shadow_factors_by_light_index;
+    GRAPHICS::CPU_RENDERING::ShadowMap::ComputeShadowFactors(
+        shadow_maps,
+        lights,
+        MATH::Vector3f(-1.0f, 0.0f, 0.0f),
+        MATH::Vector3f(0.0f, 1.0f, 0.0f),
+        shadow_factors_by_light_index);
+    std::vector<float> expected_shadow_factors_by_light_index = { 1.0f, 0.0f, 1.0f };
+    REQUIRE(expected_shadow_factors_by_light_index == shadow_factors_by_light_index);
+
+    // VERIFY NO SHADOW FACTORS ARE COMPUTED WITHOUT SHADOW MAPS.
+    const std::vector<GRAPHICS::CPU_RENDERING::ShadowMap> NO_SHADOW_MAPS;
+    GRAPHICS::CPU_RENDERING::ShadowMap::ComputeShadowFactors(
+        NO_SHADOW_MAPS,
+        lights,
+        MATH::Vector3f(-1.0f, 0.0f, 0.0f),
+        MATH::Vector3f(0.0f, 1.0f, 0.0f),
+        shadow_factors_by_light_index);
+    REQUIRE(shadow_factors_by_light_index.empty());
+}
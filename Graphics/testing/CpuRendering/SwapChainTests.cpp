@@ -0,0 +1,231 @@
+#include <mutex>
+#include <optional>
+#include <set>
+#include <thread>
+#include <vector>
+#include <catch.hpp>
+#include "Graphics/CpuRendering/SwapChain.h"
+#include "Windowing/IWindow.h"
+
+/// A window that just records the top-left pixel of each displayed bitmap
+/// along with the dirty rectangles of any partial displays and the threads displaying.
+class SwapChainTestWindow : public WINDOWING::IWindow
+{
+public:
+    unsigned int GetWidthInPixels() const override
+    {
+        return 4;
+    }
+
+    unsigned int GetHeightInPixels() const override
+    {
+        return 4;
+    }
+
+    bool SupportsDisplayFromAnyThread() const override
+    {
+        return DisplayFromAnyThreadSupported;
+    }
+
+    void Display(const GRAPHICS::IMAGES::Bitmap& bitmap) override
+    {
+        std::lock_guard<std::mutex> lock(DisplayedColorsMutex);
+        DisplayThreadIds.insert(std::this_thread::get_id());
+        DisplayedColors.emplace_back(bitmap.GetPixel(0, 0));
+        DisplayedDirtyRectangles.emplace_back(std::nullopt);
+    }
+
+    void Display(const GRAPHICS::IMAGES::Bitmap& bitmap, const std::vector<MATH::Rectangleui>& dirty_rectangles) override
+    {
+        std::lock_guard<std::mutex> lock(DisplayedColorsMutex);
+        DisplayThreadIds.insert(std::this_thread::get_id());
+        DisplayedColors.emplace_back(bitmap.GetPixel(0, 0));
+        DisplayedDirtyRectangles.emplace_back(dirty_rectangles);
+    }
+
+    /// Whether or not the window claims to support being displayed to from any thread.
+    bool DisplayFromAnyThreadSupported = true;
+    /// Protects access to the displayed colors.
+    std::mutex DisplayedColorsMutex = {};
+    /// The top-left color of each displayed bitmap, in the order displayed.
+    std::vector<GRAPHICS::Color> DisplayedColors = {};
+    /// The dirty rectangles of each display, in the order displayed.  Empty for displays of entire bitmaps.
+    std::vector<std::optional<std::vector<MATH::Rectangleui>>> DisplayedDirtyRectangles = {};
+    /// The threads that have displayed bitmaps.
+    std::set<std::thread::id> DisplayThreadIds = {};
+};
+
+TEST_CASE("Presents rotate through buffers and are displayed in order.", "[SwapChain][Present]")
+{
+    // PRESENT MORE FRAMES THAN THERE ARE BUFFERS.
+    SwapChainTestWindow window;
+    constexpr std::size_t BUFFER_COUNT = 3;
+    GRAPHICS::CPU_RENDERING::SwapChain swap_chain(4, 4, GRAPHICS::ColorFormat::ARGB, BUFFER_COUNT);
+    REQUIRE(BUFFER_COUNT == swap_chain.BufferCount());
+
+    const std::vector<GRAPHICS::Color> FRAME_COLORS = { GRAPHICS::Color::RED, GRAPHICS::Color::GREEN, GRAPHICS::Color::BLUE, GRAPHICS::Color::WHITE };
+    uint64_t last_fence_value = GRAPHICS::CPU_RENDERING::SwapChain::NO_FENCE;
+    for (std::size_t frame_index = 0; frame_index < FRAME_COLORS.size(); ++frame_index)
+    {
+        REQUIRE(frame_index % BUFFER_COUNT == swap_chain.CurrentBufferIndex());
+        swap_chain.GetCurrentBuffer().FillPixels(FRAME_COLORS[frame_index]);
+
+        uint64_t fence_value = swap_chain.Present(window);
+        REQUIRE(fence_value > last_fence_value);
+        last_fence_value = fence_value;
+    }
+
+    // VERIFY THE FRAMES WERE DISPLAYED IN ORDER.
+    swap_chain.WaitForIdle();
+    REQUIRE(swap_chain.FenceCompleted(last_fence_value));
+    REQUIRE(FRAME_COLORS == window.DisplayedColors);
+}
+
+TEST_CASE("Presented frames can be read back after their fence completes.", "[SwapChain][Fences]")
+{
+    // PRESENT A FRAME WITH READ BACK.
+    SwapChainTestWindow window;
+    GRAPHICS::CPU_RENDERING::SwapChain swap_chain(4, 4, GRAPHICS::ColorFormat::ARGB);
+    swap_chain.ClearCurrentBuffer(GRAPHICS::Color::BLUE);
+    swap_chain.GetCurrentBuffer().WritePixelAndMarkDirty(1, 2, GRAPHICS::Color::RED);
+    GRAPHICS::IMAGES::Bitmap read_back_bitmap(0, 0, GRAPHICS::ColorFormat::ARGB);
+    uint64_t fence_value = swap_chain.Present(window, &read_back_bitmap);
+
+    // VERIFY THE FRAME WAS READ BACK.
+    swap_chain.WaitForFence(fence_value);
+    REQUIRE(swap_chain.FenceCompleted(fence_value));
+    REQUIRE(4 == read_back_bitmap.GetWidthInPixels());
+    REQUIRE(GRAPHICS::Color::RED == read_back_bitmap.GetPixel(1, 2));
+    REQUIRE(GRAPHICS::Color::BLUE == read_back_bitmap.GetPixel(0, 0));
+
+    // VERIFY UNSUBMITTED FENCES AREN'T COMPLETE.
+    REQUIRE_FALSE(swap_chain.FenceCompleted(fence_value + 1));
+}
+
+TEST_CASE("Buffers are cleared to the clear color after being presented.", "[SwapChain][ClearCurrentBuffer]")
+{
+    // PRESENT EACH BUFFER AFTER DRAWING TO IT.
+    SwapChainTestWindow window;
+    GRAPHICS::CPU_RENDERING::SwapChain swap_chain(4, 4, GRAPHICS::ColorFormat::ARGB);
+    swap_chain.ClearCurrentBuffer(GRAPHICS::Color::GREEN);
+    for (std::size_t buffer_index = 0; buffer_index < swap_chain.BufferCount(); ++buffer_index)
+    {
+        swap_chain.GetCurrentBuffer().WritePixelAndMarkDirty(3, 3, GRAPHICS::Color::RED);
+        swap_chain.Present(window);
+    }
+
+    // VERIFY THE BUFFERS WERE CLEARED IN THE BACKGROUND.
+    for (std::size_t buffer_index = 0; buffer_index < swap_chain.BufferCount(); ++buffer_index)
+    {
+        GRAPHICS::IMAGES::Bitmap& buffer = swap_chain.GetCurrentBuffer();
+        REQUIRE(GRAPHICS::Color::GREEN == buffer.GetPixel(3, 3));
+        swap_chain.Present(window);
+    }
+}
+
+TEST_CASE("Clearing the current buffer is only skipped if the swap chain itself cleared it.", "[SwapChain][ClearCurrentBuffer]")
+{
+    // CLEAR A BUFFER THAT WAS CLEARED TO THE SAME COLOR IN THE BACKGROUND.
+    SwapChainTestWindow window;
+    GRAPHICS::CPU_RENDERING::SwapChain swap_chain(4, 4, GRAPHICS::ColorFormat::ARGB, 1);
+    swap_chain.ClearCurrentBuffer(GRAPHICS::Color::GREEN);
+    swap_chain.Present(window);
+    swap_chain.ClearCurrentBuffer(GRAPHICS::Color::GREEN);
+    REQUIRE(GRAPHICS::Color::GREEN == swap_chain.GetCurrentBuffer().GetPixel(0, 0));
+
+    // MODIFY THE BUFFER WITHOUT MARKING ANY PIXELS DIRTY.
+    // Getting the buffer gives the caller write access, so the buffer's cleared state is no longer trusted.
+    GRAPHICS::IMAGES::Bitmap red_pixel_source(1, 1, GRAPHICS::ColorFormat::ARGB);
+    red_pixel_source.WritePixel(0, 0, GRAPHICS::Color::RED);
+    swap_chain.GetCurrentBuffer().GetRawData()[0] = red_pixel_source.GetRawData()[0];
+
+    // VERIFY CLEARING TO THE SAME COLOR STILL CLEARS THE BUFFER.
+    swap_chain.ClearCurrentBuffer(GRAPHICS::Color::GREEN);
+    REQUIRE(GRAPHICS::Color::GREEN == swap_chain.GetCurrentBuffer().GetPixel(0, 0));
+}
+
+TEST_CASE("Only regions dirtied in consecutive frames with the same fill color are displayed.", "[SwapChain][Present]")
+{
+    // PRESENT FRAMES THAT EACH CHANGE A SINGLE PIXEL.
+    SwapChainTestWindow window;
+    GRAPHICS::CPU_RENDERING::SwapChain swap_chain(4, 4, GRAPHICS::ColorFormat::ARGB);
+    swap_chain.ClearCurrentBuffer(GRAPHICS::Color::BLUE);
+    swap_chain.GetCurrentBuffer().WritePixelAndMarkDirty(1, 1, GRAPHICS::Color::RED);
+    swap_chain.Present(window);
+    swap_chain.ClearCurrentBuffer(GRAPHICS::Color::BLUE);
+    swap_chain.GetCurrentBuffer().WritePixelAndMarkDirty(2, 3, GRAPHICS::Color::RED);
+    swap_chain.Present(window);
+
+    // PRESENT A FRAME WITH A DIFFERENT FILL COLOR.
+    swap_chain.ClearCurrentBuffer(GRAPHICS::Color::GREEN);
+    swap_chain.Present(window);
+
+    // VERIFY ONLY THE SECOND FRAME WAS PARTIALLY DISPLAYED.
+    // The pixel from the first frame needs to be restored in addition to the pixel for the second frame.
+    swap_chain.WaitForIdle();
+    REQUIRE(3 == window.DisplayedDirtyRectangles.size());
+    REQUIRE_FALSE(window.DisplayedDirtyRectangles[0].has_value());
+    std::vector<MATH::Rectangleui> expected_dirty_rectangles =
+    {
+        MATH::Rectangleui::FromLeftTopAndDimensions(1, 1, 1, 1),
+        MATH::Rectangleui::FromLeftTopAndDimensions(2, 3, 1, 1),
+    };
+    REQUIRE(expected_dirty_rectangles == window.DisplayedDirtyRectangles[1]);
+    REQUIRE_FALSE(window.DisplayedDirtyRectangles[2].has_value());
+}
+
+TEST_CASE("Many presents are performed by a single background thread without accumulating.", "[SwapChain][Present]")
+{
+    // PRESENT MANY FRAMES.
+    SwapChainTestWindow window;
+    GRAPHICS::CPU_RENDERING::SwapChain swap_chain(4, 4, GRAPHICS::ColorFormat::ARGB);
+    constexpr std::size_t FRAME_COUNT = 2000;
+    for (std::size_t frame_index = 0; frame_index < FRAME_COUNT; ++frame_index)
+    {
+        swap_chain.GetCurrentBuffer().FillPixels((frame_index % 2) ? GRAPHICS::Color::RED : GRAPHICS::Color::GREEN);
+        swap_chain.Present(window);
+
+        // VERIFY THAT PRESENTS DON'T BUILD UP.
+        // Getting the next buffer waits for its previous present, so only a bounded number of presents can be queued.
+        REQUIRE(swap_chain.QueuedPresentCount() <= swap_chain.BufferCount());
+    }
+
+    // VERIFY ALL FRAMES WERE DISPLAYED IN ORDER ON THE SAME BACKGROUND THREAD.
+    swap_chain.WaitForIdle();
+    REQUIRE(0 == swap_chain.QueuedPresentCount());
+    REQUIRE(swap_chain.FenceCompleted(swap_chain.LastSubmittedFenceValue()));
+    REQUIRE(FRAME_COUNT == window.DisplayedColors.size());
+    REQUIRE(GRAPHICS::Color::GREEN == window.DisplayedColors.front());
+    REQUIRE(GRAPHICS::Color::RED == window.DisplayedColors.back());
+    REQUIRE(1 == window.DisplayThreadIds.size());
+    REQUIRE(0 == window.DisplayThreadIds.count(std::this_thread::get_id()));
+}
+
+TEST_CASE("Windows not supporting display from other threads are displayed to when presenting.", "[SwapChain][Present]")
+{
+    // PRESENT FRAMES TO A WINDOW ONLY SUPPORTING DISPLAY FROM ITS OWN THREAD.
+    SwapChainTestWindow window;
+    window.DisplayFromAnyThreadSupported = false;
+    GRAPHICS::CPU_RENDERING::SwapChain swap_chain(4, 4, GRAPHICS::ColorFormat::ARGB);
+    const std::vector<GRAPHICS::Color> FRAME_COLORS = { GRAPHICS::Color::RED, GRAPHICS::Color::GREEN, GRAPHICS::Color::BLUE };
+    GRAPHICS::IMAGES::Bitmap read_back_bitmap(0, 0, GRAPHICS::ColorFormat::ARGB);
+    uint64_t fence_value = GRAPHICS::CPU_RENDERING::SwapChain::NO_FENCE;
+    for (std::size_t frame_index = 0; frame_index < FRAME_COLORS.size(); ++frame_index)
+    {
+        swap_chain.GetCurrentBuffer().FillPixels(FRAME_COLORS[frame_index]);
+        fence_value = swap_chain.Present(window, &read_back_bitmap);
+
+        // VERIFY THE FRAME WAS DISPLAYED BEFORE PRESENTING RETURNED.
+        std::lock_guard<std::mutex> lock(window.DisplayedColorsMutex);
+        REQUIRE(frame_index + 1 == window.DisplayedColors.size());
+        REQUIRE(FRAME_COLORS[frame_index] == window.DisplayedColors.back());
+
+        // The read back bitmap is only reused once the previous present has completed.
+        swap_chain.WaitForFence(fence_value);
+    }
+
+    // VERIFY ALL FRAMES WERE DISPLAYED ON THIS THREAD WITH READ BACK STILL PERFORMED.
+    REQUIRE(1 == window.DisplayThreadIds.size());
+    REQUIRE(1 == window.DisplayThreadIds.count(std::this_thread::get_id()));
+    REQUIRE(GRAPHICS::Color::BLUE == read_back_bitmap.GetPixel(0, 0));
+}
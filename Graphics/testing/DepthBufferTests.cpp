@@ -1,5 +1,8 @@
+#include <array>
+#include <tuple>
 #include <catch.hpp>
 #include "Graphics/DepthBuffer.h"
+#include "Processor/CpuFeatures.h"
 
 TEST_CASE("A newly constructed depth buffer is cleared to the max depth.", "[DepthBuffer][Constructor]")
 {
@@ -85,3 +88,227 @@ TEST_CASE("A depth value can be written to specific coordinates.", "[DepthBuffer
     float actual_depth = depth_buffer.GetDepth(ARBITRARY_X, ARBITRARY_Y);
     REQUIRE(ARBITRARY_DEPTH == actual_depth);
 }
+
+TEST_CASE("A fixed-point depth buffer stores depths at the precision of its format.", "[DepthBuffer][Format]")
+{
+    // CREATE A FIXED-POINT DEPTH BUFFER.
+    constexpr GRAPHICS::DepthBufferFormat FORMAT = GRAPHICS::DepthBufferFormat::FIXED_POINT_16;
+    constexpr float MAX_DEPTH_ERROR = 1.0f / static_cast<float>(1u << 15);
+    bool reversed_z = GENERATE(false, true);
+    GRAPHICS::DepthBuffer depth_buffer(2, 2, FORMAT, reversed_z);
+    REQUIRE(FORMAT == depth_buffer.GetFormat());
+    REQUIRE(reversed_z == depth_buffer.IsReversedZ());
+
+    // VERIFY THE BUFFER WAS CLEARED TO THE FAR DEPTH.
+    // Fixed-point formats can't store depths beyond the far plane.
+    float expected_far_depth = reversed_z ? GRAPHICS::DepthBuffer::REVERSED_Z_FAR_DEPTH : GRAPHICS::DepthBuffer::FAR_DEPTH;
+    REQUIRE(expected_far_depth == depth_buffer.GetFarDepth());
+    REQUIRE(expected_far_depth == depth_buffer.GetDepth(0, 0));
+
+    // VERIFY WRITTEN DEPTHS ARE PRESERVED WITHIN THE PRECISION OF THE FORMAT.
+    constexpr float ARBITRARY_DEPTH = 0.3f;
+    depth_buffer.WriteDepth(1, 0, ARBITRARY_DEPTH);
+    REQUIRE(ARBITRARY_DEPTH == Approx(depth_buffer.GetDepth(1, 0)).margin(MAX_DEPTH_ERROR));
+
+    // VERIFY DEPTHS OUTSIDE OF THE NEAR AND FAR PLANES ARE CLAMPED.
+    depth_buffer.WriteDepth(0, 1, 5.0f);
+    REQUIRE(GRAPHICS::DepthBuffer::NEAR_DEPTH == depth_buffer.GetDepth(0, 1));
+    depth_buffer.WriteDepth(1, 1, -5.0f);
+    REQUIRE(expected_far_depth == depth_buffer.GetDepth(1, 1));
+}
+
+TEST_CASE("Depths in front of or equal to existing depths pass the depth test.", "[DepthBuffer][TestDepth]")
+{
+    // CREATE A DEPTH BUFFER WITH AN EXISTING DEPTH.
+    auto format = GENERATE(
+        GRAPHICS::DepthBufferFormat::FLOAT_32,
+        GRAPHICS::DepthBufferFormat::FIXED_POINT_16);
+    GRAPHICS::DepthBuffer depth_buffer(2, 2, format, false);
+    constexpr float EXISTING_DEPTH = 0.5f;
+    depth_buffer.WriteDepth(0, 0, EXISTING_DEPTH);
+
+    // VERIFY THE DEPTH TEST RESULTS.
+    REQUIRE(depth_buffer.TestDepth(0, 0, 0.75f));
+    REQUIRE(depth_buffer.TestDepth(0, 0, EXISTING_DEPTH));
+    REQUIRE_FALSE(depth_buffer.TestDepth(0, 0, 0.25f));
+    // Any depth within the cleared range should pass for other pixels.
+    REQUIRE(depth_buffer.TestDepth(1, 1, GRAPHICS::DepthBuffer::FAR_DEPTH));
+
+    // VERIFY OUT-OF-RANGE PIXELS NEVER PASS.
+    REQUIRE_FALSE(depth_buffer.TestDepth(2, 2, GRAPHICS::DepthBuffer::NEAR_DEPTH));
+}
+
+/// Tests and then writes 8 depths using SIMD operations.  Requires AVX2 support.
+/// @param[in]  first_pixel_index - The row-major index of the first pixel.
+/// @param[in]  depths - The depths to test and write.
+/// @param[in]  pixel_mask - Which pixels (with non-zero values) to test.
+/// @param[in,out]  depth_buffer - The depth buffer to test and write to.
+/// @return Which pixels passed the depth test (and were therefore written).
+SIMD_TARGET_AVX2 std::array<bool, 8> TestAndWriteDepthsWithSimd(
+    const std::size_t first_pixel_index,
+    const std::array<float, 8>& depths,
+    const std::array<int, 8>& pixel_mask,
+    GRAPHICS::DepthBuffer& depth_buffer)
+{
+    // TEST AND WRITE THE DEPTHS.
+    __m256i pixel_mask_values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pixel_mask.data()));
+    __m256 simd_pixel_mask = _mm256_castsi256_ps(_mm256_cmpgt_epi32(pixel_mask_values, _mm256_setzero_si256()));
+    __m256 simd_depths = _mm256_loadu_ps(depths.data());
+    __m256 passing_pixels = depth_buffer.TestDepths(first_pixel_index, simd_depths, simd_pixel_mask);
+    depth_buffer.WriteDepths(first_pixel_index, simd_depths, passing_pixels);
+
+    // CONVERT THE RESULTS TO NON-SIMD FORMAT.
+    int passing_pixel_bits = _mm256_movemask_ps(passing_pixels);
+    std::array<bool, 8> passing_pixel_flags = {};
+    for (std::size_t lane_index = 0; lane_index < passing_pixel_flags.size(); ++lane_index)
+    {
+        passing_pixel_flags[lane_index] = (0 != (passing_pixel_bits & (1 << lane_index)));
+    }
+    return passing_pixel_flags;
+}
+
+TEST_CASE("SIMD depth tests and writes match non-SIMD depth tests and writes.", "[DepthBuffer][TestDepths]")
+{
+    // SKIP THE TEST IF THE CPU DOESN'T SUPPORT THE NEEDED SIMD INSTRUCTIONS.
+    bool simd_supported = (PROCESSOR::CpuFeatures::GetSimdInstructionSet() >= PROCESSOR::SimdInstructionSet::AVX2);
+    if (!simd_supported)
+    {
+        return;
+    }
+
+    // CREATE DEPTH BUFFERS WITH SOME EXISTING DEPTHS.
+    auto format = GENERATE(
+        GRAPHICS::DepthBufferFormat::FLOAT_32,
+        GRAPHICS::DepthBufferFormat::FIXED_POINT_16);
+    bool reversed_z = GENERATE(false, true);
+    constexpr unsigned int WIDTH_IN_PIXELS = 5;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 2;
+    GRAPHICS::DepthBuffer simd_depth_buffer(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, format, reversed_z);
+    GRAPHICS::DepthBuffer non_simd_depth_buffer(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, format, reversed_z);
+    for (unsigned int x = 0; x < WIDTH_IN_PIXELS; ++x)
+    {
+        float existing_depth = 0.2f * static_cast<float>(x);
+        simd_depth_buffer.WriteDepth(x, 1, existing_depth);
+        non_simd_depth_buffer.WriteDepth(x, 1, existing_depth);
+    }
+
+    // TEST AND WRITE DEPTHS FOR THE LAST PIXELS OF THE BUFFER.
+    // The pixels past the end of the buffer are masked out to verify memory outside of the buffer isn't touched.
+    constexpr std::size_t FIRST_PIXEL_INDEX = 4;
+    std::array<float, 8> depths = { 0.9f, 0.0f, 0.3f, 0.2f, 0.1f, 1.0f, 0.5f, 0.5f };
+    std::array<int, 8> pixel_mask = { 1, 1, 0, 1, 1, 1, 0, 0 };
+    std::array<bool, 8> simd_passing_pixels = TestAndWriteDepthsWithSimd(FIRST_PIXEL_INDEX, depths, pixel_mask, simd_depth_buffer);
+
+    // VERIFY THE RESULTS MATCH THE NON-SIMD VERSION.
+    for (std::size_t lane_index = 0; lane_index < depths.size(); ++lane_index)
+    {
+        std::size_t pixel_index = FIRST_PIXEL_INDEX + lane_index;
+        unsigned int x = static_cast<unsigned int>(pixel_index % WIDTH_IN_PIXELS);
+        unsigned int y = static_cast<unsigned int>(pixel_index / WIDTH_IN_PIXELS);
+        bool expected_pixel_passed = pixel_mask[lane_index] && non_simd_depth_buffer.TestDepth(x, y, depths[lane_index]);
+        REQUIRE(expected_pixel_passed == simd_passing_pixels[lane_index]);
+        if (expected_pixel_passed)
+        {
+            non_simd_depth_buffer.WriteDepth(x, y, depths[lane_index]);
+        }
+    }
+    for (unsigned int y = 0; y < HEIGHT_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < WIDTH_IN_PIXELS; ++x)
+        {
+            REQUIRE(non_simd_depth_buffer.GetDepth(x, y) == simd_depth_buffer.GetDepth(x, y));
+        }
+    }
+}
+
+TEST_CASE("A fast cleared depth buffer behaves the same as a regularly cleared depth buffer.", "[DepthBuffer][FastClearToDepth]")
+{
+    // CLEAR DEPTH BUFFERS SPANNING MULTIPLE PARTIAL TILES.
+    auto format = GENERATE(
+        GRAPHICS::DepthBufferFormat::FLOAT_32,
+        GRAPHICS::DepthBufferFormat::FIXED_POINT_16);
+    constexpr unsigned int WIDTH_IN_PIXELS = GRAPHICS::DepthBuffer::FAST_CLEAR_TILE_DIMENSION_IN_PIXELS + 5;
+    constexpr unsigned int HEIGHT_IN_PIXELS = GRAPHICS::DepthBuffer::FAST_CLEAR_TILE_DIMENSION_IN_PIXELS + 3;
+    GRAPHICS::DepthBuffer fast_cleared_depth_buffer(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, format, false);
+    GRAPHICS::DepthBuffer regularly_cleared_depth_buffer(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, format, false);
+    constexpr float CLEAR_DEPTH = 0.25f;
+    fast_cleared_depth_buffer.FastClearToDepth(CLEAR_DEPTH);
+    regularly_cleared_depth_buffer.ClearToDepth(CLEAR_DEPTH);
+
+    // WRITE A DEPTH IN ONE TILE AND TEST DEPTHS IN OTHERS.
+    constexpr unsigned int WRITTEN_X = WIDTH_IN_PIXELS - 1;
+    constexpr unsigned int WRITTEN_Y = 1;
+    constexpr float WRITTEN_DEPTH = 0.75f;
+    fast_cleared_depth_buffer.WriteDepth(WRITTEN_X, WRITTEN_Y, WRITTEN_DEPTH);
+    regularly_cleared_depth_buffer.WriteDepth(WRITTEN_X, WRITTEN_Y, WRITTEN_DEPTH);
+    for (float tested_depth : { 0.0f, CLEAR_DEPTH, 0.5f, 1.0f })
+    {
+        REQUIRE(regularly_cleared_depth_buffer.TestDepth(0, 0, tested_depth) == fast_cleared_depth_buffer.TestDepth(0, 0, tested_depth));
+        REQUIRE(regularly_cleared_depth_buffer.TestDepth(WRITTEN_X, WRITTEN_Y, tested_depth) == fast_cleared_depth_buffer.TestDepth(WRITTEN_X, WRITTEN_Y, tested_depth));
+    }
+
+    // VERIFY ALL DEPTHS MATCH.
+    for (unsigned int y = 0; y < HEIGHT_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < WIDTH_IN_PIXELS; ++x)
+        {
+            REQUIRE(regularly_cleared_depth_buffer.GetDepth(x, y) == fast_cleared_depth_buffer.GetDepth(x, y));
+        }
+    }
+
+    // VERIFY THE FAST CLEAR IS RESOLVED BEFORE ACCESSING RAW DEPTHS.
+    if (GRAPHICS::DepthBufferFormat::FLOAT_32 == format)
+    {
+        const float* raw_depths = fast_cleared_depth_buffer.GetRawData();
+        REQUIRE(CLEAR_DEPTH == raw_depths[0]);
+        REQUIRE(CLEAR_DEPTH == raw_depths[(WIDTH_IN_PIXELS * HEIGHT_IN_PIXELS) - 1]);
+        REQUIRE(WRITTEN_DEPTH == raw_depths[(WRITTEN_Y * WIDTH_IN_PIXELS) + WRITTEN_X]);
+    }
+}
+
+TEST_CASE("SIMD depth tests and writes across fast cleared tiles match non-SIMD depth tests and writes.", "[DepthBuffer][FastClearToDepth]")
+{
+    // SKIP THE TEST IF THE CPU DOESN'T SUPPORT THE NEEDED SIMD INSTRUCTIONS.
+    bool simd_supported = (PROCESSOR::CpuFeatures::GetSimdInstructionSet() >= PROCESSOR::SimdInstructionSet::AVX2);
+    if (!simd_supported)
+    {
+        return;
+    }
+
+    // FAST CLEAR A DEPTH BUFFER.
+    auto format = GENERATE(
+        GRAPHICS::DepthBufferFormat::FLOAT_32,
+        GRAPHICS::DepthBufferFormat::FIXED_POINT_16);
+    constexpr unsigned int WIDTH_IN_PIXELS = 2 * GRAPHICS::DepthBuffer::FAST_CLEAR_TILE_DIMENSION_IN_PIXELS;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 2;
+    GRAPHICS::DepthBuffer simd_depth_buffer(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, format, false);
+    GRAPHICS::DepthBuffer non_simd_depth_buffer(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, format, false);
+    constexpr float CLEAR_DEPTH = 0.5f;
+    simd_depth_buffer.FastClearToDepth(CLEAR_DEPTH);
+    non_simd_depth_buffer.FastClearToDepth(CLEAR_DEPTH);
+
+    // TEST AND WRITE DEPTHS FOR PIXELS SPANNING TWO TILES.
+    constexpr std::size_t FIRST_PIXEL_INDEX = GRAPHICS::DepthBuffer::FAST_CLEAR_TILE_DIMENSION_IN_PIXELS - 4;
+    const std::array<float, 8> DEPTHS = { 0.0f, 0.25f, 0.5f, 0.75f, 1.0f, 0.4f, 0.6f, 0.9f };
+    const std::array<int, 8> PIXEL_MASK = { 1, 1, 1, 0, 1, 1, 1, 1 };
+    std::array<bool, 8> simd_passing_pixels = TestAndWriteDepthsWithSimd(FIRST_PIXEL_INDEX, DEPTHS, PIXEL_MASK, simd_depth_buffer);
+    for (std::size_t lane_index = 0; lane_index < DEPTHS.size(); ++lane_index)
+    {
+        unsigned int x = static_cast<unsigned int>(FIRST_PIXEL_INDEX + lane_index);
+        bool pixel_passes = PIXEL_MASK[lane_index] && non_simd_depth_buffer.TestDepth(x, 0, DEPTHS[lane_index]);
+        REQUIRE(pixel_passes == simd_passing_pixels[lane_index]);
+        if (pixel_passes)
+        {
+            non_simd_depth_buffer.WriteDepth(x, 0, DEPTHS[lane_index]);
+        }
+    }
+
+    // VERIFY THE RESULTING DEPTHS MATCH.
+    for (unsigned int y = 0; y < HEIGHT_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < WIDTH_IN_PIXELS; ++x)
+        {
+            REQUIRE(non_simd_depth_buffer.GetDepth(x, y) == simd_depth_buffer.GetDepth(x, y));
+        }
+    }
+}
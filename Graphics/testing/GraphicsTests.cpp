@@ -2,9 +2,26 @@
 #include <catch.hpp>
 
 #include "ColorTests.cpp"
+#include "CpuRendering/ClusteredLightGridTests.cpp"
+#include "CpuRendering/CpuRasterizationAlgorithmTests.cpp"
+#include "CpuRendering/DeferredLightingAlgorithmTests.cpp"
+#include "CpuRendering/GBufferTests.cpp"
+#include "CpuRendering/LineBatchTests.cpp"
+#include "CpuRendering/LitVertexCacheTests.cpp"
+#include "CpuRendering/ShadowMapTests.cpp"
+#include "CpuRendering/SwapChainTests.cpp"
 #include "DepthBufferTests.cpp"
 #include "Geometry/SphereTests.cpp"
 #include "Geometry/TriangleTests.cpp"
+#include "Gui/GlyphTests.cpp"
+#include "Images/BitmapTests.cpp"
+#include "Images/MipmappedTextureTests.cpp"
+#include "Modeling/MeshSimplificationTests.cpp"
 #include "Modeling/WavefrontObjectModelTests.cpp"
 #include "Object3DTests.cpp"
+#include "RenderQueueTests.cpp"
+#include "Shading/WorldSpaceShadingTests.cpp"
+#include "TextureMappingAlgorithmTests.cpp"
 #include "Viewing/CameraTests.cpp"
+#include "Viewing/LevelOfDetailSelectorTests.cpp"
+#include "Viewing/ViewingTransformationsTests.cpp"
@@ -0,0 +1,39 @@
+#include <catch.hpp>
+#include "Graphics/Gui/Glyph.h"
+
+TEST_CASE("A glyph's coverage mask is computed from the brightness of its font pixels.", "[Glyph][ComputeCoverageMask]")
+{
+    // CREATE FONT PIXELS WITH DIFFERENT LEVELS OF COVERAGE.
+    // The glyph is offset within the font pixels to verify only its own pixels are used.
+    GRAPHICS::IMAGES::Bitmap font_pixels(12, 3, GRAPHICS::ColorFormat::ARGB);
+    font_pixels.FillPixels(GRAPHICS::Color(0.0f, 0.0f, 0.0f, 0.0f));
+    font_pixels.WritePixel(1, 1, GRAPHICS::Color(static_cast<uint8_t>(255), 255, 255, 255));
+    font_pixels.WritePixel(2, 1, GRAPHICS::Color(static_cast<uint8_t>(0), 128, 0, 255));
+    font_pixels.WritePixel(3, 2, GRAPHICS::Color(static_cast<uint8_t>(255), 255, 255, 0));
+    font_pixels.WritePixel(0, 0, GRAPHICS::Color::WHITE);
+
+    // COMPUTE THE COVERAGE MASK FOR A GLYPH.
+    GRAPHICS::GUI::Glyph glyph
+    {
+        .WidthInPixels = 9,
+        .HeightInPixels = 2,
+        .LeftTopOffsetInFontPixels = MATH::Vector2ui(1, 1),
+        .FontPixels = &font_pixels
+    };
+    glyph.ComputeCoverageMask();
+
+    // VERIFY THE COVERAGE MASK WAS PADDED.
+    constexpr std::size_t EXPECTED_ROW_STRIDE = 16;
+    REQUIRE(EXPECTED_ROW_STRIDE == glyph.CoverageMaskRowStride());
+    REQUIRE(EXPECTED_ROW_STRIDE * glyph.HeightInPixels == glyph.CoverageMask.size());
+
+    // VERIFY THE COVERAGE VALUES.
+    REQUIRE(255 == glyph.GetCoverage(0, 0));
+    REQUIRE(128 == glyph.GetCoverage(1, 0));
+    // Fully transparent pixels aren't covered.
+    REQUIRE(0 == glyph.GetCoverage(2, 1));
+    REQUIRE(0 == glyph.GetCoverage(8, 1));
+    // Out-of-range coordinates aren't covered.
+    REQUIRE(0 == glyph.GetCoverage(9, 0));
+    REQUIRE(0 == glyph.GetCoverage(0, 2));
+}
@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <vector>
+#include <catch.hpp>
+#include "Graphics/Images/Bitmap.h"
+
+TEST_CASE("Filling a bitmap resets its dirty rectangles.", "[Bitmap][FillPixels]")
+{
+    // A NEW BITMAP IS ENTIRELY DIRTY.
+    GRAPHICS::IMAGES::Bitmap bitmap(8, 4, GRAPHICS::ColorFormat::ARGB);
+    REQUIRE_FALSE(bitmap.GetFillColor().has_value());
+    REQUIRE(std::vector<MATH::Rectangleui>{ MATH::Rectangleui::FromLeftTopAndDimensions(0, 0, 8, 4) } == bitmap.GetDirtyRectangles());
+
+    // FILLING THE BITMAP LEAVES NOTHING DIRTY.
+    bitmap.FillPixels(GRAPHICS::Color::BLUE);
+    REQUIRE(GRAPHICS::Color::BLUE == bitmap.GetFillColor());
+    REQUIRE(bitmap.GetDirtyRectangles().empty());
+}
+
+TEST_CASE("Writing pixels only marks them as dirty when requested.", "[Bitmap][WritePixel]")
+{
+    GRAPHICS::IMAGES::Bitmap bitmap(8, 4, GRAPHICS::ColorFormat::ARGB);
+    bitmap.FillPixels(GRAPHICS::Color::BLACK);
+
+    // WRITE A PIXEL WITHOUT MARKING IT DIRTY.
+    // Drawing code marks the bounds of what it draws separately.
+    bitmap.WritePixel(1, 1, GRAPHICS::Color::BLUE);
+    REQUIRE(GRAPHICS::Color::BLUE == bitmap.GetPixel(1, 1));
+    REQUIRE(bitmap.GetDirtyRectangles().empty());
+
+    // WRITE A PIXEL AND MARK IT DIRTY.
+    bitmap.WritePixelAndMarkDirty(3, 2, GRAPHICS::Color::RED);
+    REQUIRE(GRAPHICS::Color::RED == bitmap.GetPixel(3, 2));
+    REQUIRE(std::vector<MATH::Rectangleui>{ MATH::Rectangleui::FromLeftTopAndDimensions(3, 2, 1, 1) } == bitmap.GetDirtyRectangles());
+
+    // WRITING THE SAME PIXEL AGAIN DOESN'T ADD ANOTHER RECTANGLE.
+    bitmap.WritePixelAndMarkDirty(3, 2, GRAPHICS::Color::GREEN);
+    REQUIRE(1 == bitmap.GetDirtyRectangles().size());
+
+    // RECTANGLES OUTSIDE OF THE BITMAP ARE CLIPPED.
+    bitmap.MarkDirty(MATH::Rectangleui::FromLeftTopAndDimensions(6, 3, 10, 10));
+    REQUIRE(MATH::Rectangleui::FromLeftTopAndDimensions(6, 3, 2, 1) == bitmap.GetDirtyRectangles().back());
+    REQUIRE(GRAPHICS::Color::BLACK == bitmap.GetFillColor());
+}
+
+TEST_CASE("Dirty rectangles are merged once the maximum count is reached.", "[Bitmap][MarkDirty]")
+{
+    // MARK MORE SEPARATE PIXELS DIRTY THAN CAN BE TRACKED SEPARATELY.
+    GRAPHICS::IMAGES::Bitmap bitmap(32, 32, GRAPHICS::ColorFormat::ARGB);
+    bitmap.FillPixels(GRAPHICS::Color::BLACK);
+    constexpr unsigned int DIRTY_PIXEL_COUNT = 2 * GRAPHICS::IMAGES::Bitmap::MAX_DIRTY_RECTANGLE_COUNT;
+    for (unsigned int pixel_index = 0; pixel_index < DIRTY_PIXEL_COUNT; ++pixel_index)
+    {
+        bitmap.WritePixelAndMarkDirty(2 * pixel_index, pixel_index, GRAPHICS::Color::WHITE);
+    }
+
+    // VERIFY ALL DIRTY PIXELS ARE STILL COVERED.
+    const std::vector<MATH::Rectangleui>& dirty_rectangles = bitmap.GetDirtyRectangles();
+    REQUIRE(GRAPHICS::IMAGES::Bitmap::MAX_DIRTY_RECTANGLE_COUNT == dirty_rectangles.size());
+    for (unsigned int pixel_index = 0; pixel_index < DIRTY_PIXEL_COUNT; ++pixel_index)
+    {
+        MATH::Rectangleui dirty_pixel = MATH::Rectangleui::FromLeftTopAndDimensions(2 * pixel_index, pixel_index, 1, 1);
+        bool dirty_pixel_covered = std::any_of(
+            dirty_rectangles.cbegin(),
+            dirty_rectangles.cend(),
+            [&dirty_pixel](const MATH::Rectangleui& dirty_rectangle) { return dirty_rectangle.Contains(dirty_pixel); });
+        REQUIRE(dirty_pixel_covered);
+    }
+}
@@ -0,0 +1,159 @@
+#include <catch.hpp>
+#include "Graphics/Images/MipmappedTexture.h"
+
+TEST_CASE("A mipmapped texture has levels down to 1x1.", "[MipmappedTexture][Create]")
+{
+    // CREATE A MIPMAPPED TEXTURE FROM A NON-SQUARE BITMAP.
+    constexpr unsigned int WIDTH_IN_PIXELS = 8;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 4;
+    GRAPHICS::IMAGES::Bitmap bitmap(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    std::shared_ptr<GRAPHICS::IMAGES::MipmappedTexture> texture = GRAPHICS::IMAGES::MipmappedTexture::Create(bitmap, GRAPHICS::TextureMemoryLayout::ROW_MAJOR);
+    REQUIRE(texture);
+
+    // VERIFY THE LEVELS ARE CORRECTLY SIZED AND LAID OUT.
+    constexpr std::size_t EXPECTED_LEVEL_COUNT = 4;
+    REQUIRE(EXPECTED_LEVEL_COUNT == texture->GetLevelCount());
+
+    REQUIRE(8 == texture->GetLevel(0).WidthInPixels);
+    REQUIRE(4 == texture->GetLevel(0).HeightInPixels);
+    REQUIRE(0 == texture->GetLevel(0).FirstTexelIndex);
+
+    REQUIRE(4 == texture->GetLevel(1).WidthInPixels);
+    REQUIRE(2 == texture->GetLevel(1).HeightInPixels);
+    REQUIRE(32 == texture->GetLevel(1).FirstTexelIndex);
+
+    REQUIRE(2 == texture->GetLevel(2).WidthInPixels);
+    REQUIRE(1 == texture->GetLevel(2).HeightInPixels);
+    REQUIRE(40 == texture->GetLevel(2).FirstTexelIndex);
+
+    REQUIRE(1 == texture->GetLevel(3).WidthInPixels);
+    REQUIRE(1 == texture->GetLevel(3).HeightInPixels);
+    REQUIRE(42 == texture->GetLevel(3).FirstTexelIndex);
+}
+
+TEST_CASE("Each mipmap level averages 2x2 blocks of the previous level.", "[MipmappedTexture][Create]")
+{
+    // CREATE A MIPMAPPED TEXTURE FROM A 2x2 BITMAP.
+    constexpr unsigned int WIDTH_IN_PIXELS = 2;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 2;
+    GRAPHICS::IMAGES::Bitmap bitmap(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    bitmap.WritePixel(0, 0, static_cast<uint32_t>(0x00000000));
+    bitmap.WritePixel(1, 0, static_cast<uint32_t>(0x10FF0001));
+    bitmap.WritePixel(0, 1, static_cast<uint32_t>(0x20FF0001));
+    bitmap.WritePixel(1, 1, static_cast<uint32_t>(0x30FF0001));
+    std::shared_ptr<GRAPHICS::IMAGES::MipmappedTexture> texture = GRAPHICS::IMAGES::MipmappedTexture::Create(bitmap, GRAPHICS::TextureMemoryLayout::ROW_MAJOR);
+    REQUIRE(texture);
+
+    // VERIFY THE FULL-RESOLUTION LEVEL IS UNCHANGED.
+    REQUIRE(0x00000000 == texture->GetTexel(0, 0, 0));
+    REQUIRE(0x10FF0001 == texture->GetTexel(0, 1, 0));
+    REQUIRE(0x20FF0001 == texture->GetTexel(0, 0, 1));
+    REQUIRE(0x30FF0001 == texture->GetTexel(0, 1, 1));
+
+    // VERIFY THE SMALLEST LEVEL IS THE ROUNDED AVERAGE OF EACH COMPONENT.
+    // (0x00 + 0x10 + 0x20 + 0x30) / 4 = 0x18
+    // (0x00 + 0xFF + 0xFF + 0xFF) / 4 = 0xBF.25 -> 0xBF
+    // (0x00 + 0x00 + 0x00 + 0x00) / 4 = 0x00
+    // (0x00 + 0x01 + 0x01 + 0x01) / 4 = 0x00.C -> 0x01
+    constexpr uint32_t EXPECTED_AVERAGE_TEXEL = 0x18BF0001;
+    REQUIRE(2 == texture->GetLevelCount());
+    REQUIRE(EXPECTED_AVERAGE_TEXEL == texture->GetTexel(1, 0, 0));
+}
+
+TEST_CASE("Odd-sized mipmap levels clamp to the edge of the previous level.", "[MipmappedTexture][Create]")
+{
+    // CREATE A MIPMAPPED TEXTURE FROM A 3x1 BITMAP.
+    constexpr unsigned int WIDTH_IN_PIXELS = 3;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 1;
+    GRAPHICS::IMAGES::Bitmap bitmap(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::ARGB);
+    bitmap.WritePixel(0, 0, static_cast<uint32_t>(0x00000010));
+    bitmap.WritePixel(1, 0, static_cast<uint32_t>(0x00000030));
+    bitmap.WritePixel(2, 0, static_cast<uint32_t>(0x000000FF));
+    std::shared_ptr<GRAPHICS::IMAGES::MipmappedTexture> texture = GRAPHICS::IMAGES::MipmappedTexture::Create(bitmap, GRAPHICS::TextureMemoryLayout::ROW_MAJOR);
+    REQUIRE(texture);
+
+    // VERIFY THE SMALLER LEVEL ONLY USES THE FIRST 2 COLUMNS.
+    // With a single row, the same row is used for the top and bottom of each 2x2 block.
+    REQUIRE(2 == texture->GetLevelCount());
+    REQUIRE(1 == texture->GetLevel(1).WidthInPixels);
+    REQUIRE(1 == texture->GetLevel(1).HeightInPixels);
+    constexpr uint32_t EXPECTED_AVERAGE_TEXEL = 0x00000020;
+    REQUIRE(EXPECTED_AVERAGE_TEXEL == texture->GetTexel(1, 0, 0));
+    REQUIRE(GRAPHICS::ColorFormat::ARGB == texture->GetColorFormat());
+}
+
+TEST_CASE("A tiled mipmapped texture pads each level to whole 4x4 tiles.", "[MipmappedTexture][Create]")
+{
+    // CREATE A TILED MIPMAPPED TEXTURE FROM A BITMAP THAT ISN'T A MULTIPLE OF THE TILE SIZE.
+    constexpr unsigned int WIDTH_IN_PIXELS = 6;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 5;
+    GRAPHICS::IMAGES::Bitmap bitmap(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    std::shared_ptr<GRAPHICS::IMAGES::MipmappedTexture> texture = GRAPHICS::IMAGES::MipmappedTexture::Create(bitmap, GRAPHICS::TextureMemoryLayout::TILED_4X4);
+    REQUIRE(texture);
+    REQUIRE(GRAPHICS::TextureMemoryLayout::TILED_4X4 == texture->GetMemoryLayout());
+
+    // VERIFY THE LEVELS ARE CORRECTLY SIZED AND LAID OUT.
+    // The full-resolution level is padded to 8x8 texels, and each smaller level fits within a single tile.
+    constexpr std::size_t EXPECTED_LEVEL_COUNT = 3;
+    REQUIRE(EXPECTED_LEVEL_COUNT == texture->GetLevelCount());
+
+    REQUIRE(6 == texture->GetLevel(0).WidthInPixels);
+    REQUIRE(5 == texture->GetLevel(0).HeightInPixels);
+    REQUIRE(0 == texture->GetLevel(0).FirstTexelIndex);
+    REQUIRE(32 == texture->GetLevel(0).TileRowTexelCount);
+
+    REQUIRE(3 == texture->GetLevel(1).WidthInPixels);
+    REQUIRE(2 == texture->GetLevel(1).HeightInPixels);
+    REQUIRE(64 == texture->GetLevel(1).FirstTexelIndex);
+    REQUIRE(16 == texture->GetLevel(1).TileRowTexelCount);
+
+    REQUIRE(1 == texture->GetLevel(2).WidthInPixels);
+    REQUIRE(1 == texture->GetLevel(2).HeightInPixels);
+    REQUIRE(80 == texture->GetLevel(2).FirstTexelIndex);
+    REQUIRE(16 == texture->GetLevel(2).TileRowTexelCount);
+
+    // VERIFY TEXELS ARE STORED TILE BY TILE.
+    REQUIRE(0 == texture->GetTexelIndex(0, 0, 0));
+    REQUIRE(3 == texture->GetTexelIndex(0, 3, 0));
+    REQUIRE(4 == texture->GetTexelIndex(0, 0, 1));
+    REQUIRE(16 == texture->GetTexelIndex(0, 4, 0));
+    REQUIRE(32 == texture->GetTexelIndex(0, 0, 4));
+    REQUIRE(49 == texture->GetTexelIndex(0, 5, 4));
+    REQUIRE(70 == texture->GetTexelIndex(1, 2, 1));
+}
+
+TEST_CASE("Tiled and row-major mipmapped textures contain the same texels.", "[MipmappedTexture][Create]")
+{
+    // CREATE A BITMAP WITH A DIFFERENT COLOR FOR EACH TEXEL.
+    constexpr unsigned int WIDTH_IN_PIXELS = 13;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 7;
+    GRAPHICS::IMAGES::Bitmap bitmap(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    for (unsigned int y = 0; y < HEIGHT_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < WIDTH_IN_PIXELS; ++x)
+        {
+            uint32_t texel = (x * 0x01030507) ^ (y * 0x0B0D1113);
+            bitmap.WritePixel(x, y, texel);
+        }
+    }
+
+    // CREATE MIPMAPPED TEXTURES WITH EACH LAYOUT.
+    std::shared_ptr<GRAPHICS::IMAGES::MipmappedTexture> row_major_texture = GRAPHICS::IMAGES::MipmappedTexture::Create(bitmap, GRAPHICS::TextureMemoryLayout::ROW_MAJOR);
+    REQUIRE(row_major_texture);
+    std::shared_ptr<GRAPHICS::IMAGES::MipmappedTexture> tiled_texture = GRAPHICS::IMAGES::MipmappedTexture::Create(bitmap, GRAPHICS::TextureMemoryLayout::TILED_4X4);
+    REQUIRE(tiled_texture);
+
+    // VERIFY ALL TEXELS IN ALL LEVELS MATCH.
+    REQUIRE(row_major_texture->GetLevelCount() == tiled_texture->GetLevelCount());
+    for (std::size_t level_index = 0; level_index < row_major_texture->GetLevelCount(); ++level_index)
+    {
+        const GRAPHICS::IMAGES::MipmapLevel& level = row_major_texture->GetLevel(level_index);
+        for (unsigned int y = 0; y < level.HeightInPixels; ++y)
+        {
+            for (unsigned int x = 0; x < level.WidthInPixels; ++x)
+            {
+                REQUIRE(row_major_texture->GetTexel(level_index, x, y) == tiled_texture->GetTexel(level_index, x, y));
+            }
+        }
+    }
+}
@@ -0,0 +1,153 @@
+#include <memory>
+#include <catch.hpp>
+#include "Graphics/Modeling/MeshSimplification.h"
+
+/// Creates a flat square grid mesh in the XY plane for testing simplification.
+/// @param[in]  cells_per_side - The number of square cells along each side of the grid.
+/// @param[in]  left_material - The material for the left half of the grid.
+/// @param[in]  right_material - The material for the right half of the grid.
+/// @return The indexed grid mesh, with one subset per material.
+GRAPHICS::Mesh CreateFlatGridMesh(
+    const uint32_t cells_per_side,
+    const std::shared_ptr<GRAPHICS::Material>& left_material,
+    const std::shared_ptr<GRAPHICS::Material>& right_material)
+{
+    GRAPHICS::Mesh grid_mesh;
+
+    // CREATE THE VERTICES.
+    uint32_t vertices_per_side = cells_per_side + 1;
+    for (uint32_t y = 0; y < vertices_per_side; ++y)
+    {
+        for (uint32_t x = 0; x < vertices_per_side; ++x)
+        {
+            grid_mesh.Vertices.emplace_back(GRAPHICS::VertexWithAttributes
+            {
+                .Position = MATH::Vector3f(static_cast<float>(x), static_cast<float>(y), 0.0f),
+                .TextureCoordinates = MATH::Vector2f(static_cast<float>(x) / cells_per_side, static_cast<float>(y) / cells_per_side),
+                .Normal = MATH::Vector3f(0.0f, 0.0f, 1.0f),
+            });
+        }
+    }
+
+    // CREATE TWO TRIANGLES FOR EACH CELL IN EACH HALF OF THE GRID.
+    for (const auto& material : { left_material, right_material })
+    {
+        uint32_t first_cell_x = (material == left_material) ? 0 : (cells_per_side / 2);
+        uint32_t end_cell_x = (material == left_material) ? (cells_per_side / 2) : cells_per_side;
+        GRAPHICS::MeshSubset subset = { .FirstIndex = static_cast<uint32_t>(grid_mesh.Indices.size()), .Material = material };
+        for (uint32_t y = 0; y < cells_per_side; ++y)
+        {
+            for (uint32_t x = first_cell_x; x < end_cell_x; ++x)
+            {
+                uint32_t bottom_left_index = y * vertices_per_side + x;
+                uint32_t bottom_right_index = bottom_left_index + 1;
+                uint32_t top_left_index = bottom_left_index + vertices_per_side;
+                uint32_t top_right_index = top_left_index + 1;
+                grid_mesh.Indices.insert(grid_mesh.Indices.end(), { bottom_left_index, bottom_right_index, top_right_index });
+                grid_mesh.Indices.insert(grid_mesh.Indices.end(), { bottom_left_index, top_right_index, top_left_index });
+            }
+        }
+        subset.IndexCount = static_cast<uint32_t>(grid_mesh.Indices.size()) - subset.FirstIndex;
+        grid_mesh.Subsets.emplace_back(subset);
+    }
+
+    return grid_mesh;
+}
+
+TEST_CASE("A flat mesh can be simplified without changing its shape or materials.", "[MeshSimplification][Simplify]")
+{
+    // CREATE A FLAT MESH.
+    auto left_material = std::make_shared<GRAPHICS::Material>();
+    auto right_material = std::make_shared<GRAPHICS::Material>();
+    constexpr uint32_t CELLS_PER_SIDE = 16;
+    GRAPHICS::Mesh grid_mesh = CreateFlatGridMesh(CELLS_PER_SIDE, left_material, right_material);
+    REQUIRE(512 == grid_mesh.TriangleCount());
+
+    // SIMPLIFY THE MESH.
+    constexpr std::size_t TARGET_TRIANGLE_COUNT = 32;
+    GRAPHICS::Mesh simplified_mesh = GRAPHICS::MODELING::MeshSimplification::Simplify(grid_mesh, TARGET_TRIANGLE_COUNT);
+
+    // VERIFY THE MESH WAS SIMPLIFIED.
+    REQUIRE(simplified_mesh.IsIndexed());
+    REQUIRE(simplified_mesh.TriangleCount() <= TARGET_TRIANGLE_COUNT);
+    REQUIRE(simplified_mesh.TriangleCount() > 0);
+    REQUIRE(simplified_mesh.Vertices.size() < grid_mesh.Vertices.size());
+
+    // VERIFY THE MESH STILL COVERS THE SAME FLAT AREA.
+    // Corners are only kept if boundaries are preserved.
+    for (const GRAPHICS::VertexWithAttributes& vertex : simplified_mesh.Vertices)
+    {
+        REQUIRE(0.0f == vertex.Position.Z);
+    }
+    const float MAX_COORDINATE = static_cast<float>(CELLS_PER_SIDE);
+    for (const MATH::Vector3f& corner : { MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(MAX_COORDINATE, 0.0f, 0.0f), MATH::Vector3f(0.0f, MAX_COORDINATE, 0.0f), MATH::Vector3f(MAX_COORDINATE, MAX_COORDINATE, 0.0f) })
+    {
+        bool corner_kept = std::any_of(
+            simplified_mesh.Vertices.cbegin(),
+            simplified_mesh.Vertices.cend(),
+            [&corner](const GRAPHICS::VertexWithAttributes& vertex) { return corner == vertex.Position; });
+        REQUIRE(corner_kept);
+    }
+
+    // VERIFY NO TRIANGLES WERE FLIPPED.
+    for (std::size_t triangle_index = 0; triangle_index < simplified_mesh.TriangleCount(); ++triangle_index)
+    {
+        GRAPHICS::GEOMETRY::Triangle triangle = simplified_mesh.GetTriangle(triangle_index);
+        MATH::Vector3f first_edge = triangle.Vertices[1].Position - triangle.Vertices[0].Position;
+        MATH::Vector3f second_edge = triangle.Vertices[2].Position - triangle.Vertices[0].Position;
+        MATH::Vector3f normal = MATH::Vector3f::CrossProduct(first_edge, second_edge);
+        REQUIRE(normal.Z > 0.0f);
+    }
+
+    // VERIFY MATERIALS WERE KEPT.
+    REQUIRE(2 == simplified_mesh.Subsets.size());
+    REQUIRE(left_material == simplified_mesh.Subsets[0].Material);
+    REQUIRE(right_material == simplified_mesh.Subsets[1].Material);
+}
+
+TEST_CASE("A non-indexed mesh can be simplified.", "[MeshSimplification][Simplify]")
+{
+    // CREATE A NON-INDEXED MESH.
+    auto material = std::make_shared<GRAPHICS::Material>();
+    GRAPHICS::Mesh indexed_grid_mesh = CreateFlatGridMesh(8, material, material);
+    GRAPHICS::Mesh grid_mesh;
+    grid_mesh.Triangles = indexed_grid_mesh.GetTriangles();
+
+    // SIMPLIFY THE MESH.
+    constexpr std::size_t TARGET_TRIANGLE_COUNT = 16;
+    GRAPHICS::Mesh simplified_mesh = GRAPHICS::MODELING::MeshSimplification::Simplify(grid_mesh, TARGET_TRIANGLE_COUNT);
+
+    // VERIFY THE MESH WAS SIMPLIFIED INTO A SINGLE INDEXED SUBSET.
+    REQUIRE(simplified_mesh.IsIndexed());
+    REQUIRE(simplified_mesh.TriangleCount() <= TARGET_TRIANGLE_COUNT);
+    REQUIRE(1 == simplified_mesh.Subsets.size());
+    REQUIRE(material == simplified_mesh.Subsets[0].Material);
+}
+
+TEST_CASE("Levels of detail have progressively fewer triangles.", "[MeshSimplification][GenerateLevelsOfDetail]")
+{
+    // CREATE A MESH.
+    auto material = std::make_shared<GRAPHICS::Material>();
+    GRAPHICS::Mesh grid_mesh = CreateFlatGridMesh(16, material, material);
+
+    // GENERATE LEVELS OF DETAIL.
+    constexpr std::size_t LEVEL_OF_DETAIL_COUNT = 4;
+    GRAPHICS::MODELING::MeshSimplification::GenerateLevelsOfDetail(grid_mesh, LEVEL_OF_DETAIL_COUNT);
+
+    // VERIFY THE LEVELS OF DETAIL.
+    REQUIRE(LEVEL_OF_DETAIL_COUNT == grid_mesh.LevelOfDetailCount());
+    REQUIRE(&grid_mesh == &grid_mesh.GetLevelOfDetail(0));
+    for (std::size_t level_of_detail_index = 1; level_of_detail_index < LEVEL_OF_DETAIL_COUNT; ++level_of_detail_index)
+    {
+        const GRAPHICS::Mesh& previous_level_of_detail = grid_mesh.GetLevelOfDetail(level_of_detail_index - 1);
+        const GRAPHICS::Mesh& level_of_detail = grid_mesh.GetLevelOfDetail(level_of_detail_index);
+        REQUIRE(level_of_detail.TriangleCount() <= previous_level_of_detail.TriangleCount() / 2);
+    }
+    // Levels beyond the least detailed level should be clamped.
+    REQUIRE(&grid_mesh.LevelsOfDetail.back() == &grid_mesh.GetLevelOfDetail(LEVEL_OF_DETAIL_COUNT + 10));
+
+    // VERIFY THE BOUNDING SPHERE WAS COMPUTED.
+    const MATH::Vector3f EXPECTED_BOUNDING_SPHERE_CENTER(8.0f, 8.0f, 0.0f);
+    REQUIRE(EXPECTED_BOUNDING_SPHERE_CENTER == grid_mesh.BoundingSphereCenter);
+    REQUIRE(Approx(std::sqrt(128.0f)) == grid_mesh.BoundingSphereRadius);
+}
@@ -106,7 +106,16 @@ f 1 2 3 4
         first_triangle,
         second_triangle
     };
-    REQUIRE(expected_triangles == mesh.Triangles);
+    REQUIRE(expected_triangles == mesh.GetTriangles());
+
+    // Vertices shared between the triangles should only be stored once.
+    constexpr std::size_t EXPECTED_UNIQUE_VERTEX_COUNT = 4;
+    REQUIRE(EXPECTED_UNIQUE_VERTEX_COUNT == mesh.Vertices.size());
+    const std::vector<uint32_t> EXPECTED_INDICES = { 0, 1, 2, 0, 2, 3 };
+    REQUIRE(EXPECTED_INDICES == mesh.Indices);
+    REQUIRE(1 == mesh.Subsets.size());
+    REQUIRE(0 == mesh.Subsets.front().FirstIndex);
+    REQUIRE(EXPECTED_INDICES.size() == mesh.Subsets.front().IndexCount);
 
     // DELETE THE MODEL FILE.
     std::filesystem::remove(MODEL_FILEPATH);
@@ -240,7 +249,13 @@ f 2 6 7 3
         triangle_11,
         triangle_12,
     };
-    REQUIRE(expected_triangles == mesh.Triangles);
+    REQUIRE(expected_triangles == mesh.GetTriangles());
+
+    // Vertices shared between the triangles should only be stored once.
+    constexpr std::size_t EXPECTED_UNIQUE_VERTEX_COUNT = 8;
+    REQUIRE(EXPECTED_UNIQUE_VERTEX_COUNT == mesh.Vertices.size());
+    constexpr std::size_t EXPECTED_INDEX_COUNT = 12 * GRAPHICS::GEOMETRY::Triangle::VERTEX_COUNT;
+    REQUIRE(EXPECTED_INDEX_COUNT == mesh.Indices.size());
 
     // DELETE THE MODEL FILE.
     std::filesystem::remove(MODEL_FILEPATH);
@@ -298,7 +313,7 @@ f 1/1 2/2 3/3 4/4
     // The mesh should have the proper triangles.
     // For exact equality comparison, the texture must be copied over.
     // For simplicity, verification of the contents of the texture is excluded from this test but would be good to test later.
-    const std::shared_ptr<GRAPHICS::Material>& material = mesh.Triangles.front().Material;
+    const std::shared_ptr<GRAPHICS::Material>& material = mesh.Subsets.front().Material;
     REQUIRE(material);
 
     GRAPHICS::GEOMETRY::Triangle first_triangle;
@@ -349,7 +364,7 @@ f 1/1 2/2 3/3 4/4
         first_triangle,
         second_triangle
     };
-    REQUIRE(expected_triangles == mesh.Triangles);
+    REQUIRE(expected_triangles == mesh.GetTriangles());
 
     // DELETE THE MODEL FILES.
     std::filesystem::remove(MODEL_FILEPATH);
@@ -0,0 +1,140 @@
+#include <memory>
+#include <catch.hpp>
+#include "Graphics/RenderQueue.h"
+
+TEST_CASE("Sort keys place opaque items before transparent items.", "[RenderQueue][SortKey]")
+{
+    // COMPUTE SORT KEYS FOR ITEMS THAT WOULD OTHERWISE BE SORTED IN THE OPPOSITE ORDER.
+    const uint32_t FIRST_MATERIAL_ID = 0;
+    const float NEAR_VIEW_DEPTH = 1.0f;
+    uint64_t transparent_sort_key = GRAPHICS::RenderQueue::ComputeSortKey(true, FIRST_MATERIAL_ID, NEAR_VIEW_DEPTH);
+
+    const float FAR_VIEW_DEPTH = 1000.0f;
+    uint64_t opaque_sort_key = GRAPHICS::RenderQueue::ComputeSortKey(false, GRAPHICS::RenderQueue::MAX_MATERIAL_ID, FAR_VIEW_DEPTH);
+
+    // VERIFY OPAQUE ITEMS ARE SORTED FIRST.
+    REQUIRE(opaque_sort_key < transparent_sort_key);
+}
+
+TEST_CASE("Sort keys group opaque items by material and then order them front to back.", "[RenderQueue][SortKey]")
+{
+    // COMPUTE SORT KEYS FOR OPAQUE ITEMS WITH DIFFERENT MATERIALS AND DEPTHS.
+    uint64_t first_material_near_sort_key = GRAPHICS::RenderQueue::ComputeSortKey(false, 0, 1.0f);
+    uint64_t first_material_far_sort_key = GRAPHICS::RenderQueue::ComputeSortKey(false, 0, 500.0f);
+    uint64_t second_material_near_sort_key = GRAPHICS::RenderQueue::ComputeSortKey(false, 1, 0.5f);
+    uint64_t first_material_behind_camera_sort_key = GRAPHICS::RenderQueue::ComputeSortKey(false, 0, -10.0f);
+
+    // VERIFY THE ORDERING OF THE SORT KEYS.
+    REQUIRE(first_material_near_sort_key < first_material_far_sort_key);
+    REQUIRE(first_material_far_sort_key < second_material_near_sort_key);
+    REQUIRE(first_material_behind_camera_sort_key <= first_material_near_sort_key);
+}
+
+TEST_CASE("Sort keys order transparent items back to front.", "[RenderQueue][SortKey]")
+{
+    // COMPUTE SORT KEYS FOR TRANSPARENT ITEMS WITH DIFFERENT MATERIALS AND DEPTHS.
+    uint64_t near_sort_key = GRAPHICS::RenderQueue::ComputeSortKey(true, 0, 1.0f);
+    uint64_t far_sort_key = GRAPHICS::RenderQueue::ComputeSortKey(true, 1, 500.0f);
+    uint64_t middle_sort_key = GRAPHICS::RenderQueue::ComputeSortKey(true, 0, 2.0f);
+
+    // VERIFY THE ORDERING OF THE SORT KEYS.
+    REQUIRE(far_sort_key < middle_sort_key);
+    REQUIRE(middle_sort_key < near_sort_key);
+}
+
+TEST_CASE("Render queue sorts meshes of a scene into drawing order.", "[RenderQueue][Sort]")
+{
+    // CREATE MATERIALS.
+    auto opaque_material = std::make_shared<GRAPHICS::Material>();
+    auto other_opaque_material = std::make_shared<GRAPHICS::Material>();
+    auto transparent_material = std::make_shared<GRAPHICS::Material>();
+    transparent_material->DiffuseProperties.Color.Alpha = 0.5f;
+
+    // CREATE A SCENE WITH OBJECTS AT DIFFERENT DEPTHS.
+    // The camera looks down the negative z-axis from the origin.
+    auto create_object = [](const std::shared_ptr<GRAPHICS::Material>& material, const float view_depth)
+    {
+        GRAPHICS::GEOMETRY::Triangle triangle;
+        triangle.Material = material;
+
+        GRAPHICS::Object3D object_3D;
+        object_3D.Model.MeshesByName["Test"].Triangles = { triangle };
+        object_3D.WorldPosition = MATH::Vector3f(0.0f, 0.0f, -view_depth);
+        return object_3D;
+    };
+
+    GRAPHICS::Scene scene;
+    scene.Objects =
+    {
+        create_object(transparent_material, 5.0f),
+        create_object(opaque_material, 20.0f),
+        create_object(transparent_material, 30.0f),
+        create_object(other_opaque_material, 1.0f),
+        create_object(opaque_material, 10.0f),
+    };
+    scene.Objects.emplace_back(create_object(opaque_material, 2.0f));
+    scene.Objects.back().Model.MeshesByName["Test"].Visible = false;
+
+    GRAPHICS::VIEWING::Camera camera = GRAPHICS::VIEWING::Camera::LookAtFrom(
+        MATH::Vector3f(0.0f, 0.0f, -1.0f),
+        MATH::Vector3f(0.0f, 0.0f, 0.0f));
+
+    // SORT THE SCENE.
+    GRAPHICS::RenderQueue render_queue;
+    render_queue.Add(scene, camera);
+    render_queue.Sort();
+
+    // VERIFY THE DRAWING ORDER.
+    // Invisible meshes should be skipped, and materials are grouped in the order they were first seen.
+    const std::vector<std::size_t> EXPECTED_OBJECT_INDICES = { 4, 1, 3, 2, 0 };
+    REQUIRE(EXPECTED_OBJECT_INDICES.size() == render_queue.Items.size());
+    for (std::size_t item_index = 0; item_index < EXPECTED_OBJECT_INDICES.size(); ++item_index)
+    {
+        const GRAPHICS::Object3D* expected_object = &scene.Objects[EXPECTED_OBJECT_INDICES[item_index]];
+        const GRAPHICS::RenderQueue::DrawItem& actual_item = render_queue.Items[item_index];
+        REQUIRE(expected_object == actual_item.Object);
+        REQUIRE(&expected_object->Model.MeshesByName.at("Test") == actual_item.Mesh);
+    }
+
+    // VERIFY THE QUEUE CAN BE CLEARED FOR REUSE.
+    render_queue.Clear();
+    REQUIRE(render_queue.Items.empty());
+    REQUIRE(render_queue.MaterialIds.empty());
+}
+
+TEST_CASE("Render queue items share their object's world transform from when the object was added.", "[RenderQueue][WorldTransform]")
+{
+    // CREATE AN OBJECT WITH MULTIPLE MESHES AND A NON-TRIVIAL WORLD TRANSFORM.
+    GRAPHICS::Object3D object_3D;
+    object_3D.Model.MeshesByName["First"].Triangles = { GRAPHICS::GEOMETRY::Triangle() };
+    object_3D.Model.MeshesByName["Second"].Triangles = { GRAPHICS::GEOMETRY::Triangle() };
+    object_3D.WorldPosition = MATH::Vector3f(1.0f, 2.0f, -3.0f);
+    object_3D.RotationInRadians.Z = MATH::Angle<float>::DegreesToRadians(MATH::Angle<float>::Degrees(90.0f));
+    object_3D.Scale = MATH::Vector3f(2.0f, 2.0f, 2.0f);
+    GRAPHICS::VIEWING::Camera camera = GRAPHICS::VIEWING::Camera::LookAtFrom(
+        MATH::Vector3f(0.0f, 0.0f, -1.0f),
+        MATH::Vector3f(0.0f, 0.0f, 0.0f));
+
+    // ADD THE OBJECT TO THE QUEUE.
+    GRAPHICS::RenderQueue render_queue;
+    render_queue.Add(object_3D, camera);
+
+    // VERIFY EACH MESH HAS THE OBJECT'S WORLD TRANSFORM.
+    const MATH::AffineTransform3x4 EXPECTED_WORLD_TRANSFORM = object_3D.WorldAffineTransform();
+    REQUIRE(2 == render_queue.Items.size());
+    for (const GRAPHICS::RenderQueue::DrawItem& draw_item : render_queue.Items)
+    {
+        REQUIRE(EXPECTED_WORLD_TRANSFORM == draw_item.WorldTransform);
+    }
+
+    // VERIFY MOVING THE OBJECT ONLY AFFECTS ITEMS ADDED AFTERWARD.
+    object_3D.WorldPosition = MATH::Vector3f(0.0f, 5.0f, -3.0f);
+    render_queue.Add(object_3D, camera);
+    REQUIRE(4 == render_queue.Items.size());
+    REQUIRE(EXPECTED_WORLD_TRANSFORM == render_queue.Items[0].WorldTransform);
+    REQUIRE(EXPECTED_WORLD_TRANSFORM == render_queue.Items[1].WorldTransform);
+    const MATH::AffineTransform3x4 MOVED_WORLD_TRANSFORM = object_3D.WorldAffineTransform();
+    REQUIRE(EXPECTED_WORLD_TRANSFORM != MOVED_WORLD_TRANSFORM);
+    REQUIRE(MOVED_WORLD_TRANSFORM == render_queue.Items[2].WorldTransform);
+    REQUIRE(MOVED_WORLD_TRANSFORM == render_queue.Items[3].WorldTransform);
+}
@@ -0,0 +1,211 @@
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <catch.hpp>
+#include "Graphics/Shading/SurfacePointBatch.h"
+#include "Graphics/Shading/WorldSpaceShading.h"
+#include "Graphics/Surface.h"
+
+/// Creates a batch of varied surface points with a few different materials.
+/// Only one material has a lookup table for its specular power so that fast shading covers both ways of computing powers.
+/// @param[in]  point_count - The number of points to create.
+/// @return The batch of surface points.
+GRAPHICS::SHADING::SurfacePointBatch CreateWorldSpaceShadingTestSurfacePoints(const std::size_t point_count)
+{
+    // CREATE MATERIALS WITH DIFFERENT PROPERTIES.
+    GRAPHICS::SHADING::SurfacePointBatch surface_points;
+    auto shiny_material = std::make_shared<GRAPHICS::Material>();
+    shiny_material->AmbientProperties.Color = GRAPHICS::Color(0.1f, 0.2f, 0.3f, 1.0f);
+    shiny_material->DiffuseProperties.Color = GRAPHICS::Color(0.7f, 0.5f, 0.3f, 1.0f);
+    shiny_material->SpecularProperties.Color = GRAPHICS::Color::WHITE;
+    shiny_material->SpecularProperties.SpecularPower = 20.0f;
+    shiny_material->SpecularProperties.SpecularPowerLookupTable = std::make_shared<MATH::PowerLookupTable>(shiny_material->SpecularProperties.SpecularPower);
+    auto dull_material = std::make_shared<GRAPHICS::Material>();
+    dull_material->AmbientProperties.Color = GRAPHICS::Color(0.3f, 0.3f, 0.3f, 1.0f);
+    dull_material->DiffuseProperties.Color = GRAPHICS::Color(0.2f, 0.9f, 0.6f, 1.0f);
+    dull_material->SpecularProperties.Color = GRAPHICS::Color(0.1f, 0.1f, 0.1f, 1.0f);
+    dull_material->SpecularProperties.SpecularPower = 1.5f;
+    surface_points.Materials = { shiny_material, dull_material, nullptr };
+
+    // CREATE POINTS SPREAD OUT AROUND THE ORIGIN.
+    // The last material ID doesn't reference any material.
+    constexpr uint16_t MATERIAL_ID_COUNT = 4;
+    for (std::size_t point_index = 0; point_index < point_count; ++point_index)
+    {
+        float point_parameter = static_cast<float>(point_index);
+        MATH::Vector3f position(
+            3.0f * std::sin(point_parameter),
+            2.0f * std::cos(1.3f * point_parameter),
+            std::sin(0.7f * point_parameter) - 1.0f);
+        MATH::Vector3f normal = MATH::Vector3f::Normalize(MATH::Vector3f(
+            std::cos(point_parameter),
+            std::sin(2.1f * point_parameter),
+            1.0f));
+        uint16_t material_id = static_cast<uint16_t>(point_index % MATERIAL_ID_COUNT);
+        surface_points.Add(position, normal, material_id);
+    }
+    return surface_points;
+}
+
+TEST_CASE("Batch shading exactly matches shading points individually.", "[WorldSpaceShading][ComputeMaterialShading]")
+{
+    // CREATE POINTS THAT DON'T EVENLY FILL SIMD LANES.
+    constexpr std::size_t POINT_COUNT = 21;
+    GRAPHICS::SHADING::SurfacePointBatch surface_points = CreateWorldSpaceShadingTestSurfacePoints(POINT_COUNT);
+
+    // CREATE LIGHTS OF EACH TYPE.
+    // The limited range of the point light leaves some points unlit.
+    std::vector<GRAPHICS::SHADING::LIGHTING::Light> lights =
+    {
+        GRAPHICS::SHADING::LIGHTING::Light
+        {
+            .Type = GRAPHICS::SHADING::LIGHTING::LightType::DIRECTIONAL,
+            .Color = GRAPHICS::Color(0.9f, 0.8f, 0.7f, 1.0f),
+            .DirectionalLightDirection = MATH::Vector3f::Normalize(MATH::Vector3f(1.0f, -1.0f, -1.0f)),
+        },
+        GRAPHICS::SHADING::LIGHTING::Light
+        {
+            .Type = GRAPHICS::SHADING::LIGHTING::LightType::POINT,
+            .Color = GRAPHICS::Color::WHITE,
+            .PointLightWorldPosition = MATH::Vector3f(1.0f, 1.0f, 2.0f),
+            .PointLightRange = 4.0f,
+        },
+        GRAPHICS::SHADING::LIGHTING::Light
+        {
+            .Type = GRAPHICS::SHADING::LIGHTING::LightType::AMBIENT,
+            .Color = GRAPHICS::Color(0.2f, 0.2f, 0.2f, 1.0f),
+        },
+    };
+
+    // SHADOW SOME POINTS FOR ONLY THE FIRST TWO LIGHTS.
+    auto shadowing = GENERATE(false, true);
+    if (shadowing)
+    {
+        for (std::size_t shadow_factor_index = 0; shadow_factor_index < 2 * POINT_COUNT; ++shadow_factor_index)
+        {
+            surface_points.ShadowFactors.push_back(static_cast<float>(shadow_factor_index % 3) / 2.0f);
+        }
+    }
+
+    // SHADE THE POINTS AS A BATCH.
+    GRAPHICS::SHADING::ShadingSettings shading_settings =
+    {
+        .ShadingType = GRAPHICS::SHADING::ShadingType::MATERIAL,
+        .TextureMappingEnabled = false,
+    };
+    shading_settings.Lighting.SpecularLightingEnabled = GENERATE(false, true);
+    shading_settings.Precision = GENERATE(GRAPHICS::SHADING::ShadingPrecision::EXACT, GRAPHICS::SHADING::ShadingPrecision::FAST);
+    MATH::Vector3f viewing_point(0.0f, 0.0f, 5.0f);
+    std::vector<GRAPHICS::Color> batch_colors;
+    GRAPHICS::SHADING::WorldSpaceShading::ComputeMaterialShading(
+        surface_points,
+        viewing_point,
+        lights,
+        shading_settings,
+        batch_colors);
+
+    // VERIFY EACH POINT HAS EXACTLY THE SAME COLOR AS WHEN SHADED INDIVIDUALLY.
+    REQUIRE(POINT_COUNT == batch_colors.size());
+    for (std::size_t point_index = 0; point_index < POINT_COUNT; ++point_index)
+    {
+        GRAPHICS::Color expected_color = GRAPHICS::Color::BLACK;
+        std::shared_ptr<GRAPHICS::Material> material = surface_points.GetMaterial(point_index);
+        if (material)
+        {
+            std::vector<float> shadow_factors_by_light_index;
+            if (shadowing)
+            {
+                shadow_factors_by_light_index = { surface_points.ShadowFactors[point_index], surface_points.ShadowFactors[POINT_COUNT + point_index] };
+            }
+            GRAPHICS::Surface surface = { .Normal = surface_points.GetNormal(point_index), .Material = material };
+            expected_color = GRAPHICS::SHADING::WorldSpaceShading::ComputeMaterialShading(
+                surface_points.GetPosition(point_index),
+                surface,
+                viewing_point,
+                lights,
+                shadow_factors_by_light_index,
+                shading_settings);
+        }
+
+        const GRAPHICS::Color& batch_color = batch_colors[point_index];
+        REQUIRE(expected_color.Red == batch_color.Red);
+        REQUIRE(expected_color.Green == batch_color.Green);
+        REQUIRE(expected_color.Blue == batch_color.Blue);
+        REQUIRE(expected_color.Alpha == batch_color.Alpha);
+    }
+}
+
+TEST_CASE("Batch shading leaves points black when lighting is disabled.", "[WorldSpaceShading][ComputeMaterialShading]")
+{
+    // SHADE POINTS WITH LIGHTING DISABLED.
+    GRAPHICS::SHADING::SurfacePointBatch surface_points = CreateWorldSpaceShadingTestSurfacePoints(9);
+    std::vector<GRAPHICS::SHADING::LIGHTING::Light> lights =
+    {
+        GRAPHICS::SHADING::LIGHTING::Light
+        {
+            .Type = GRAPHICS::SHADING::LIGHTING::LightType::AMBIENT,
+            .Color = GRAPHICS::Color::WHITE,
+        },
+    };
+    GRAPHICS::SHADING::ShadingSettings shading_settings = { .ShadingType = GRAPHICS::SHADING::ShadingType::MATERIAL };
+    shading_settings.Lighting.Enabled = false;
+    std::vector<GRAPHICS::Color> batch_colors;
+    GRAPHICS::SHADING::WorldSpaceShading::ComputeMaterialShading(
+        surface_points,
+        MATH::Vector3f(0.0f, 0.0f, 5.0f),
+        lights,
+        shading_settings,
+        batch_colors);
+
+    // VERIFY ALL POINTS ARE BLACK.
+    REQUIRE(9 == batch_colors.size());
+    for (const GRAPHICS::Color& batch_color : batch_colors)
+    {
+        REQUIRE(GRAPHICS::Color::BLACK == batch_color);
+    }
+}
+
+TEST_CASE("Fast shading closely matches exact shading.", "[WorldSpaceShading][ComputeMaterialShading]")
+{
+    // CREATE POINTS LIT BY MULTIPLE LIGHTS.
+    GRAPHICS::SHADING::SurfacePointBatch surface_points = CreateWorldSpaceShadingTestSurfacePoints(64);
+    std::vector<GRAPHICS::SHADING::LIGHTING::Light> lights =
+    {
+        GRAPHICS::SHADING::LIGHTING::Light
+        {
+            .Type = GRAPHICS::SHADING::LIGHTING::LightType::DIRECTIONAL,
+            .Color = GRAPHICS::Color(0.9f, 0.8f, 0.7f, 1.0f),
+            .DirectionalLightDirection = MATH::Vector3f::Normalize(MATH::Vector3f(1.0f, -1.0f, -1.0f)),
+        },
+        GRAPHICS::SHADING::LIGHTING::Light
+        {
+            .Type = GRAPHICS::SHADING::LIGHTING::LightType::POINT,
+            .Color = GRAPHICS::Color::WHITE,
+            .PointLightWorldPosition = MATH::Vector3f(1.0f, 1.0f, 2.0f),
+            .PointLightRange = 10.0f,
+        },
+    };
+
+    // SHADE THE POINTS WITH EACH PRECISION.
+    GRAPHICS::SHADING::ShadingSettings shading_settings =
+    {
+        .ShadingType = GRAPHICS::SHADING::ShadingType::MATERIAL,
+        .TextureMappingEnabled = false,
+    };
+    MATH::Vector3f viewing_point(0.0f, 0.0f, 5.0f);
+    std::vector<GRAPHICS::Color> exact_colors;
+    GRAPHICS::SHADING::WorldSpaceShading::ComputeMaterialShading(surface_points, viewing_point, lights, shading_settings, exact_colors);
+    shading_settings.Precision = GRAPHICS::SHADING::ShadingPrecision::FAST;
+    std::vector<GRAPHICS::Color> fast_colors;
+    GRAPHICS::SHADING::WorldSpaceShading::ComputeMaterialShading(surface_points, viewing_point, lights, shading_settings, fast_colors);
+
+    // VERIFY THE COLORS DIFFER BY LESS THAN AN 8-BIT COLOR STEP.
+    constexpr float MAX_COLOR_COMPONENT_ERROR = 0.5f / 255.0f;
+    REQUIRE(exact_colors.size() == fast_colors.size());
+    for (std::size_t point_index = 0; point_index < exact_colors.size(); ++point_index)
+    {
+        CHECK(exact_colors[point_index].Red == Approx(fast_colors[point_index].Red).margin(MAX_COLOR_COMPONENT_ERROR));
+        CHECK(exact_colors[point_index].Green == Approx(fast_colors[point_index].Green).margin(MAX_COLOR_COMPONENT_ERROR));
+        CHECK(exact_colors[point_index].Blue == Approx(fast_colors[point_index].Blue).margin(MAX_COLOR_COMPONENT_ERROR));
+    }
+}
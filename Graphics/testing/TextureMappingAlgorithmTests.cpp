@@ -0,0 +1,325 @@
+#include <array>
+#include <catch.hpp>
+#include "Graphics/TextureMappingAlgorithm.h"
+#include "Processor/CpuFeatures.h"
+
+/// Creates a mipmapped texture with a simple gradient for testing.
+/// @param[in]  memory_layout - The memory layout for the texture.
+/// @return A 4x4 texture whose red component increases across columns and green component increases across rows.
+std::shared_ptr<GRAPHICS::IMAGES::MipmappedTexture> CreateGradientMipmappedTexture(const GRAPHICS::TextureMemoryLayout memory_layout)
+{
+    constexpr unsigned int SIZE_IN_PIXELS = 4;
+    GRAPHICS::IMAGES::Bitmap bitmap(SIZE_IN_PIXELS, SIZE_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    for (unsigned int y = 0; y < SIZE_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < SIZE_IN_PIXELS; ++x)
+        {
+            constexpr uint8_t COMPONENT_STEP = 64;
+            GRAPHICS::Color color(
+                static_cast<uint8_t>(x * COMPONENT_STEP),
+                static_cast<uint8_t>(y * COMPONENT_STEP),
+                static_cast<uint8_t>(0),
+                static_cast<uint8_t>(255));
+            bitmap.WritePixel(x, y, color);
+        }
+    }
+    std::shared_ptr<GRAPHICS::IMAGES::MipmappedTexture> texture = GRAPHICS::IMAGES::MipmappedTexture::Create(bitmap, memory_layout);
+    return texture;
+}
+
+/// Creates a bitmap with pseudo-random texels for testing.
+/// @param[in]  width_in_pixels - The width of the bitmap.
+/// @param[in]  height_in_pixels - The height of the bitmap.
+/// @return A bitmap where neighboring texels have unrelated colors.
+GRAPHICS::IMAGES::Bitmap CreateNoiseBitmap(const unsigned int width_in_pixels, const unsigned int height_in_pixels)
+{
+    GRAPHICS::IMAGES::Bitmap bitmap(width_in_pixels, height_in_pixels, GRAPHICS::ColorFormat::RGBA);
+    for (unsigned int y = 0; y < height_in_pixels; ++y)
+    {
+        for (unsigned int x = 0; x < width_in_pixels; ++x)
+        {
+            uint32_t texel = (x * 0x9E3779B1u) ^ (y * 0x85EBCA77u);
+            bitmap.WritePixel(x, y, texel);
+        }
+    }
+    return bitmap;
+}
+
+TEST_CASE("The mipmap level is based on how many texels a pixel covers.", "[TextureMappingAlgorithm][ComputeMipmapLevel]")
+{
+    // CREATE A TEXTURE.
+    std::shared_ptr<GRAPHICS::IMAGES::MipmappedTexture> texture = CreateGradientMipmappedTexture(GRAPHICS::TextureMemoryLayout::ROW_MAJOR);
+    REQUIRE(texture);
+
+    // VERIFY ONE TEXEL PER PIXEL USES THE FULL-RESOLUTION LEVEL.
+    constexpr float ONE_TEXEL = 0.25f;
+    MATH::Vector2f top_left(0.0f, 0.0f);
+    float one_texel_per_pixel_level = GRAPHICS::TextureMappingAlgorithm::ComputeMipmapLevel(
+        top_left,
+        MATH::Vector2f(ONE_TEXEL, 0.0f),
+        MATH::Vector2f(0.0f, ONE_TEXEL),
+        *texture);
+    REQUIRE(0.0f == Approx(one_texel_per_pixel_level).margin(0.0001f));
+
+    // VERIFY FOUR TEXELS PER PIXEL USES A LEVEL 2 LEVELS SMALLER.
+    // The larger of the two derivatives determines the level.
+    constexpr float FOUR_TEXELS = 4.0f * ONE_TEXEL;
+    float four_texels_per_pixel_level = GRAPHICS::TextureMappingAlgorithm::ComputeMipmapLevel(
+        top_left,
+        MATH::Vector2f(ONE_TEXEL, 0.0f),
+        MATH::Vector2f(0.0f, FOUR_TEXELS),
+        *texture);
+    REQUIRE(2.0f == Approx(four_texels_per_pixel_level));
+}
+
+TEST_CASE("Bilinear filtering at a texel center returns the texel.", "[TextureMappingAlgorithm][LookupTexel][Bilinear]")
+{
+    // CREATE A TEXTURE.
+    std::shared_ptr<GRAPHICS::IMAGES::MipmappedTexture> texture = CreateGradientMipmappedTexture(GRAPHICS::TextureMemoryLayout::ROW_MAJOR);
+    REQUIRE(texture);
+
+    // LOOK UP THE CENTER OF THE TEXEL AT (1, 2).
+    MATH::Vector2f texel_center(1.5f / 4.0f, 2.5f / 4.0f);
+    GRAPHICS::Color color = GRAPHICS::TextureMappingAlgorithm::LookupTexel(
+        texel_center,
+        0.0f,
+        GRAPHICS::TextureFilteringType::BILINEAR,
+        *texture);
+
+    // VERIFY THE EXACT TEXEL COLOR WAS RETURNED.
+    REQUIRE(64 == color.GetRedAsUint8());
+    REQUIRE(128 == color.GetGreenAsUint8());
+}
+
+TEST_CASE("Bilinear filtering between texels blends them.", "[TextureMappingAlgorithm][LookupTexel][Bilinear]")
+{
+    // CREATE A TEXTURE.
+    std::shared_ptr<GRAPHICS::IMAGES::MipmappedTexture> texture = CreateGradientMipmappedTexture(GRAPHICS::TextureMemoryLayout::ROW_MAJOR);
+    REQUIRE(texture);
+
+    // LOOK UP HALFWAY BETWEEN THE CENTERS OF TEXELS (1, 0) AND (2, 0).
+    MATH::Vector2f between_texels(2.0f / 4.0f, 0.5f / 4.0f);
+    GRAPHICS::Color color = GRAPHICS::TextureMappingAlgorithm::LookupTexel(
+        between_texels,
+        0.0f,
+        GRAPHICS::TextureFilteringType::BILINEAR,
+        *texture);
+
+    // VERIFY THE TEXELS WERE EQUALLY BLENDED.
+    constexpr float EXPECTED_RED = (64.0f + 128.0f) / 2.0f / 255.0f;
+    REQUIRE(EXPECTED_RED == Approx(color.Red));
+    REQUIRE(0.0f == Approx(color.Green));
+}
+
+TEST_CASE("Trilinear filtering blends between mipmap levels.", "[TextureMappingAlgorithm][LookupTexel][Trilinear]")
+{
+    // CREATE A TEXTURE.
+    std::shared_ptr<GRAPHICS::IMAGES::MipmappedTexture> texture = CreateGradientMipmappedTexture(GRAPHICS::TextureMemoryLayout::ROW_MAJOR);
+    REQUIRE(texture);
+
+    // LOOK UP THE SAME COORDINATES IN TWO LEVELS AND HALFWAY BETWEEN THEM.
+    MATH::Vector2f texture_coordinates(0.3f, 0.6f);
+    GRAPHICS::Color level_1_color = GRAPHICS::TextureMappingAlgorithm::LookupTexel(
+        texture_coordinates,
+        1.0f,
+        GRAPHICS::TextureFilteringType::TRILINEAR,
+        *texture);
+    GRAPHICS::Color level_2_color = GRAPHICS::TextureMappingAlgorithm::LookupTexel(
+        texture_coordinates,
+        2.0f,
+        GRAPHICS::TextureFilteringType::TRILINEAR,
+        *texture);
+    GRAPHICS::Color between_levels_color = GRAPHICS::TextureMappingAlgorithm::LookupTexel(
+        texture_coordinates,
+        1.5f,
+        GRAPHICS::TextureFilteringType::TRILINEAR,
+        *texture);
+
+    // VERIFY THE LEVELS WERE EQUALLY BLENDED.
+    REQUIRE((level_1_color.Red + level_2_color.Red) / 2.0f == Approx(between_levels_color.Red));
+    REQUIRE((level_1_color.Green + level_2_color.Green) / 2.0f == Approx(between_levels_color.Green));
+
+    // VERIFY LEVELS BEYOND THE SMALLEST LEVEL ARE CLAMPED.
+    GRAPHICS::Color beyond_smallest_level_color = GRAPHICS::TextureMappingAlgorithm::LookupTexel(
+        texture_coordinates,
+        100.0f,
+        GRAPHICS::TextureFilteringType::TRILINEAR,
+        *texture);
+    REQUIRE(level_2_color == beyond_smallest_level_color);
+}
+
+/// Looks up texels using SIMD operations, converting the results to non-SIMD colors for easy verification.
+/// Requires AVX2 support.
+/// @param[in]  texture_x_coordinates - The x texture coordinates to look up.
+/// @param[in]  texture_y_coordinates - The y texture coordinates to look up.
+/// @param[in]  mipmap_levels - The mipmap levels for the lookups.
+/// @param[in]  filtering_type - The type of filtering to use.
+/// @param[in]  texture - The texture in which to look up texels.
+/// @return The looked up colors.
+SIMD_TARGET_AVX2 std::array<GRAPHICS::Color, 8> LookupTexelsWithSimd(
+    const std::array<float, 8>& texture_x_coordinates,
+    const std::array<float, 8>& texture_y_coordinates,
+    const std::array<float, 8>& mipmap_levels,
+    const GRAPHICS::TextureFilteringType filtering_type,
+    const GRAPHICS::IMAGES::MipmappedTexture& texture)
+{
+    // LOOK UP THE TEXELS.
+    MATH::Vector2Simd8x texture_coordinates;
+    texture_coordinates.X = _mm256_loadu_ps(texture_x_coordinates.data());
+    texture_coordinates.Y = _mm256_loadu_ps(texture_y_coordinates.data());
+    const __m256 ALL_TEXELS = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+    GRAPHICS::ColorSimd8x simd_colors = GRAPHICS::TextureMappingAlgorithm::LookupTexels(
+        texture_coordinates,
+        _mm256_loadu_ps(mipmap_levels.data()),
+        filtering_type,
+        ALL_TEXELS,
+        texture);
+
+    // CONVERT THE COLORS TO NON-SIMD FORMAT.
+    std::array<float, 8> reds = {};
+    std::array<float, 8> greens = {};
+    std::array<float, 8> blues = {};
+    std::array<float, 8> alphas = {};
+    _mm256_storeu_ps(reds.data(), simd_colors.Red);
+    _mm256_storeu_ps(greens.data(), simd_colors.Green);
+    _mm256_storeu_ps(blues.data(), simd_colors.Blue);
+    _mm256_storeu_ps(alphas.data(), simd_colors.Alpha);
+    std::array<GRAPHICS::Color, 8> colors;
+    for (std::size_t lane_index = 0; lane_index < colors.size(); ++lane_index)
+    {
+        colors[lane_index] = GRAPHICS::Color(reds[lane_index], greens[lane_index], blues[lane_index], alphas[lane_index]);
+    }
+    return colors;
+}
+
+TEST_CASE("SIMD mipmapped texel lookups match non-SIMD lookups.", "[TextureMappingAlgorithm][LookupTexels]")
+{
+    // SKIP THE TEST IF THE CPU DOESN'T SUPPORT THE NEEDED SIMD INSTRUCTIONS.
+    bool simd_supported = (PROCESSOR::CpuFeatures::GetSimdInstructionSet() >= PROCESSOR::SimdInstructionSet::AVX2);
+    if (!simd_supported)
+    {
+        return;
+    }
+
+    // CREATE A TEXTURE.
+    auto memory_layout = GENERATE(
+        GRAPHICS::TextureMemoryLayout::ROW_MAJOR,
+        GRAPHICS::TextureMemoryLayout::TILED_4X4);
+    std::shared_ptr<GRAPHICS::IMAGES::MipmappedTexture> texture = GRAPHICS::IMAGES::MipmappedTexture::Create(CreateNoiseBitmap(13, 9), memory_layout);
+    REQUIRE(texture);
+
+    // DEFINE TEXTURE COORDINATES AND LEVELS COVERING A VARIETY OF CASES.
+    std::array<float, 8> texture_x_coordinates = { -0.5f, 0.0f, 0.1f, 0.3f, 0.5f, 0.77f, 1.0f, 1.5f };
+    std::array<float, 8> texture_y_coordinates = { 0.2f, 1.0f, 0.45f, 0.0f, 0.5f, 0.91f, 0.33f, -1.0f };
+    std::array<float, 8> mipmap_levels = { -1.0f, 0.0f, 0.25f, 0.5f, 0.75f, 1.0f, 1.6f, 10.0f };
+
+    // VERIFY EACH TYPE OF FILTERING PRODUCES THE SAME RESULTS.
+    auto filtering_type = GENERATE(
+        GRAPHICS::TextureFilteringType::NEAREST,
+        GRAPHICS::TextureFilteringType::BILINEAR,
+        GRAPHICS::TextureFilteringType::TRILINEAR);
+    std::array<GRAPHICS::Color, 8> simd_colors = LookupTexelsWithSimd(
+        texture_x_coordinates,
+        texture_y_coordinates,
+        mipmap_levels,
+        filtering_type,
+        *texture);
+    for (std::size_t lane_index = 0; lane_index < simd_colors.size(); ++lane_index)
+    {
+        GRAPHICS::Color expected_color = GRAPHICS::TextureMappingAlgorithm::LookupTexel(
+            MATH::Vector2f(texture_x_coordinates[lane_index], texture_y_coordinates[lane_index]),
+            mipmap_levels[lane_index],
+            filtering_type,
+            *texture);
+        REQUIRE(expected_color.Red == Approx(simd_colors[lane_index].Red).margin(0.00001f));
+        REQUIRE(expected_color.Green == Approx(simd_colors[lane_index].Green).margin(0.00001f));
+        REQUIRE(expected_color.Alpha == Approx(simd_colors[lane_index].Alpha).margin(0.00001f));
+    }
+}
+
+TEST_CASE("Texel lookups don't depend on the texture memory layout.", "[TextureMappingAlgorithm][LookupTexel]")
+{
+    // CREATE TEXTURES WITH EACH LAYOUT.
+    GRAPHICS::IMAGES::Bitmap bitmap = CreateNoiseBitmap(21, 10);
+    std::shared_ptr<GRAPHICS::IMAGES::MipmappedTexture> row_major_texture = GRAPHICS::IMAGES::MipmappedTexture::Create(bitmap, GRAPHICS::TextureMemoryLayout::ROW_MAJOR);
+    REQUIRE(row_major_texture);
+    std::shared_ptr<GRAPHICS::IMAGES::MipmappedTexture> tiled_texture = GRAPHICS::IMAGES::MipmappedTexture::Create(bitmap, GRAPHICS::TextureMemoryLayout::TILED_4X4);
+    REQUIRE(tiled_texture);
+
+    // VERIFY LOOKUPS ACROSS THE TEXTURE ARE IDENTICAL FOR EACH TYPE OF FILTERING.
+    auto filtering_type = GENERATE(
+        GRAPHICS::TextureFilteringType::NEAREST,
+        GRAPHICS::TextureFilteringType::BILINEAR,
+        GRAPHICS::TextureFilteringType::TRILINEAR);
+    constexpr unsigned int SAMPLE_COUNT_PER_DIMENSION = 17;
+    for (unsigned int y = 0; y < SAMPLE_COUNT_PER_DIMENSION; ++y)
+    {
+        for (unsigned int x = 0; x < SAMPLE_COUNT_PER_DIMENSION; ++x)
+        {
+            MATH::Vector2f texture_coordinates(
+                static_cast<float>(x) / (SAMPLE_COUNT_PER_DIMENSION - 1),
+                static_cast<float>(y) / (SAMPLE_COUNT_PER_DIMENSION - 1));
+            float mipmap_level = static_cast<float>(x + y) / SAMPLE_COUNT_PER_DIMENSION;
+            GRAPHICS::Color row_major_color = GRAPHICS::TextureMappingAlgorithm::LookupTexel(texture_coordinates, mipmap_level, filtering_type, *row_major_texture);
+            GRAPHICS::Color tiled_color = GRAPHICS::TextureMappingAlgorithm::LookupTexel(texture_coordinates, mipmap_level, filtering_type, *tiled_texture);
+            REQUIRE(row_major_color == tiled_color);
+        }
+    }
+}
+
+/// Fills a rotated screen-sized area with bilinearly filtered texels, as would be done when rendering
+/// a textured square rotated 90 degrees.  This walks the texture vertically for each row of pixels.
+/// @param[in]  screen_dimension_in_pixels - The width and height of the screen area to fill.
+/// @param[in]  texture - The texture to read texels from.
+/// @return The sum of all red components read (to ensure the reads aren't optimized away).
+float FillRotatedTexture(const unsigned int screen_dimension_in_pixels, const GRAPHICS::IMAGES::MipmappedTexture& texture)
+{
+    float red_sum = 0.0f;
+    constexpr float FULL_RESOLUTION_MIPMAP_LEVEL = 0.0f;
+    float texture_coordinates_per_pixel = 1.0f / static_cast<float>(screen_dimension_in_pixels);
+    for (unsigned int y = 0; y < screen_dimension_in_pixels; ++y)
+    {
+        for (unsigned int x = 0; x < screen_dimension_in_pixels; ++x)
+        {
+            MATH::Vector2f texture_coordinates(
+                static_cast<float>(y) * texture_coordinates_per_pixel,
+                static_cast<float>(x) * texture_coordinates_per_pixel);
+            GRAPHICS::Color texel = GRAPHICS::TextureMappingAlgorithm::LookupTexel(
+                texture_coordinates,
+                FULL_RESOLUTION_MIPMAP_LEVEL,
+                GRAPHICS::TextureFilteringType::BILINEAR,
+                texture);
+            red_sum += texel.Red;
+        }
+    }
+    return red_sum;
+}
+
+/// This benchmark is hidden by default since it's slow.  Run it with the "[benchmark]" tag.
+TEST_CASE("Benchmark rotated texture fill rate for each texture memory layout.", "[.][benchmark][TextureMappingAlgorithm]")
+{
+    // CREATE LARGE TEXTURES WITH EACH LAYOUT.
+    // The textures are large enough to not fit in most caches.
+    constexpr unsigned int TEXTURE_DIMENSION_IN_PIXELS = 2048;
+    GRAPHICS::IMAGES::Bitmap bitmap = CreateNoiseBitmap(TEXTURE_DIMENSION_IN_PIXELS, TEXTURE_DIMENSION_IN_PIXELS);
+    std::shared_ptr<GRAPHICS::IMAGES::MipmappedTexture> row_major_texture = GRAPHICS::IMAGES::MipmappedTexture::Create(bitmap, GRAPHICS::TextureMemoryLayout::ROW_MAJOR);
+    REQUIRE(row_major_texture);
+    std::shared_ptr<GRAPHICS::IMAGES::MipmappedTexture> tiled_texture = GRAPHICS::IMAGES::MipmappedTexture::Create(bitmap, GRAPHICS::TextureMemoryLayout::TILED_4X4);
+    REQUIRE(tiled_texture);
+
+    // FILL A ROTATED SCREEN AREA WITH EACH TEXTURE.
+    constexpr unsigned int SCREEN_DIMENSION_IN_PIXELS = TEXTURE_DIMENSION_IN_PIXELS;
+    float row_major_red_sum = 0.0f;
+    BENCHMARK("Rotated fill from row-major texture")
+    {
+        row_major_red_sum = FillRotatedTexture(SCREEN_DIMENSION_IN_PIXELS, *row_major_texture);
+    }
+    float tiled_red_sum = 0.0f;
+    BENCHMARK("Rotated fill from 4x4 tiled texture")
+    {
+        tiled_red_sum = FillRotatedTexture(SCREEN_DIMENSION_IN_PIXELS, *tiled_texture);
+    }
+
+    // VERIFY BOTH LAYOUTS PRODUCED THE SAME RESULTS.
+    REQUIRE(row_major_red_sum == tiled_red_sum);
+}
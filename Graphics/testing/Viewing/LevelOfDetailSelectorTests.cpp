@@ -0,0 +1,68 @@
+#include <catch.hpp>
+#include "Graphics/Viewing/LevelOfDetailSelector.h"
+
+TEST_CASE("Ideal levels of detail halve coverage with each level.", "[LevelOfDetailSelector][SelectIdealLevelOfDetailIndex]")
+{
+    constexpr std::size_t LEVEL_OF_DETAIL_COUNT = 4;
+    constexpr float FULL_DETAIL_SCREEN_HEIGHT_FRACTION = 0.5f;
+
+    REQUIRE(0 == GRAPHICS::VIEWING::LevelOfDetailSelector::SelectIdealLevelOfDetailIndex(2.0f, LEVEL_OF_DETAIL_COUNT, FULL_DETAIL_SCREEN_HEIGHT_FRACTION));
+    REQUIRE(0 == GRAPHICS::VIEWING::LevelOfDetailSelector::SelectIdealLevelOfDetailIndex(0.5f, LEVEL_OF_DETAIL_COUNT, FULL_DETAIL_SCREEN_HEIGHT_FRACTION));
+    REQUIRE(1 == GRAPHICS::VIEWING::LevelOfDetailSelector::SelectIdealLevelOfDetailIndex(0.3f, LEVEL_OF_DETAIL_COUNT, FULL_DETAIL_SCREEN_HEIGHT_FRACTION));
+    REQUIRE(2 == GRAPHICS::VIEWING::LevelOfDetailSelector::SelectIdealLevelOfDetailIndex(0.2f, LEVEL_OF_DETAIL_COUNT, FULL_DETAIL_SCREEN_HEIGHT_FRACTION));
+    REQUIRE(3 == GRAPHICS::VIEWING::LevelOfDetailSelector::SelectIdealLevelOfDetailIndex(0.001f, LEVEL_OF_DETAIL_COUNT, FULL_DETAIL_SCREEN_HEIGHT_FRACTION));
+    REQUIRE(3 == GRAPHICS::VIEWING::LevelOfDetailSelector::SelectIdealLevelOfDetailIndex(0.0f, LEVEL_OF_DETAIL_COUNT, FULL_DETAIL_SCREEN_HEIGHT_FRACTION));
+}
+
+TEST_CASE("Levels of detail only change once coverage moves past the hysteresis band.", "[LevelOfDetailSelector][SelectLevelOfDetailIndex]")
+{
+    GRAPHICS::VIEWING::LevelOfDetailSelector level_of_detail_selector;
+    level_of_detail_selector.FullDetailScreenHeightFraction = 0.5f;
+    level_of_detail_selector.HysteresisRatio = 0.2f;
+    constexpr std::size_t LEVEL_OF_DETAIL_COUNT = 4;
+
+    // Level 0 is ideal for coverage of at least 0.5, so it's kept until coverage drops below 0.5 * 0.8 = 0.4.
+    REQUIRE(0 == level_of_detail_selector.SelectLevelOfDetailIndex(0.45f, LEVEL_OF_DETAIL_COUNT, 0));
+    REQUIRE(0 == level_of_detail_selector.SelectLevelOfDetailIndex(0.41f, LEVEL_OF_DETAIL_COUNT, 0));
+    REQUIRE(1 == level_of_detail_selector.SelectLevelOfDetailIndex(0.39f, LEVEL_OF_DETAIL_COUNT, 0));
+
+    // Level 1 is ideal for coverage in [0.25, 0.5), so it's kept until coverage rises above 0.5 * 1.2 = 0.6 or drops below 0.25 * 0.8 = 0.2.
+    REQUIRE(1 == level_of_detail_selector.SelectLevelOfDetailIndex(0.55f, LEVEL_OF_DETAIL_COUNT, 1));
+    REQUIRE(0 == level_of_detail_selector.SelectLevelOfDetailIndex(0.65f, LEVEL_OF_DETAIL_COUNT, 1));
+    REQUIRE(1 == level_of_detail_selector.SelectLevelOfDetailIndex(0.21f, LEVEL_OF_DETAIL_COUNT, 1));
+    REQUIRE(2 == level_of_detail_selector.SelectLevelOfDetailIndex(0.19f, LEVEL_OF_DETAIL_COUNT, 1));
+}
+
+TEST_CASE("Levels of detail are selected for meshes based on distance from the camera.", "[LevelOfDetailSelector][Select]")
+{
+    // CREATE AN OBJECT WITH LEVELS OF DETAIL.
+    GRAPHICS::Object3D object_3D;
+    GRAPHICS::Mesh& mesh = object_3D.Model.MeshesByName["Test"];
+    mesh.BoundingSphereRadius = 1.0f;
+    mesh.LevelsOfDetail.resize(3);
+
+    // CREATE A CAMERA LOOKING AT THE OBJECT.
+    // The 90 degree field of view means the view is as tall as twice the distance.
+    GRAPHICS::VIEWING::Camera camera = GRAPHICS::VIEWING::Camera::LookAtFrom(
+        MATH::Vector3f(0.0f, 0.0f, 0.0f),
+        MATH::Vector3f(0.0f, 0.0f, 1.0f));
+    camera.Projection = GRAPHICS::VIEWING::ProjectionType::PERSPECTIVE;
+    camera.FieldOfView = MATH::Angle<float>::Degrees(90.0f);
+
+    // VERIFY FULL DETAIL IS USED WHEN CLOSE.
+    object_3D.WorldPosition = MATH::Vector3f(0.0f, 0.0f, -0.5f);
+    REQUIRE(Approx(1.0f / 1.5f) == GRAPHICS::VIEWING::LevelOfDetailSelector::ComputeScreenHeightFraction(mesh, object_3D, camera));
+
+    GRAPHICS::VIEWING::LevelOfDetailSelector level_of_detail_selector;
+    level_of_detail_selector.BeginFrame();
+    REQUIRE(&mesh == &level_of_detail_selector.Select(mesh, object_3D, camera));
+
+    // VERIFY LESS DETAIL IS USED WHEN FAR AWAY.
+    object_3D.WorldPosition = MATH::Vector3f(0.0f, 0.0f, -99.0f);
+    level_of_detail_selector.BeginFrame();
+    REQUIRE(&mesh.LevelsOfDetail.back() == &level_of_detail_selector.Select(mesh, object_3D, camera));
+
+    // VERIFY SELECTIONS ARE CONSISTENT WITHIN A FRAME.
+    object_3D.WorldPosition = MATH::Vector3f(0.0f, 0.0f, -0.5f);
+    REQUIRE(&mesh.LevelsOfDetail.back() == &level_of_detail_selector.Select(mesh, object_3D, camera));
+}
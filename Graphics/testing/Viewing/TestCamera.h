@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Graphics/Viewing/Camera.h"
+#include "Math/Vector3.h"
+
+/// Creates a perspective camera along the positive Z axis looking down the negative Z axis at the origin,
+/// shared by tests that need a simple view of geometry around the origin.
+/// @param[in]  camera_z_position - The Z position of the camera.
+/// @return The camera.
+inline GRAPHICS::VIEWING::Camera CreatePerspectiveTestCamera(const float camera_z_position = 10.0f)
+{
+    GRAPHICS::VIEWING::Camera camera = GRAPHICS::VIEWING::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 0.0f, camera_z_position));
+    camera.Projection = GRAPHICS::VIEWING::ProjectionType::PERSPECTIVE;
+    camera.NearClipPlaneViewDistance = 0.5f;
+    camera.FarClipPlaneViewDistance = 100.0f;
+    return camera;
+}
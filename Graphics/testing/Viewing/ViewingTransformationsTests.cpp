@@ -0,0 +1,56 @@
+#include <catch.hpp>
+#include "Graphics/Images/Bitmap.h"
+#include "Graphics/Viewing/Camera.h"
+#include "Graphics/Viewing/ViewingTransformations.h"
+
+TEST_CASE("Screen positions can be transformed back to the world positions they came from.", "[ViewingTransformations][ScreenToWorld]")
+{
+    // CREATE THE VIEWING TRANSFORMATIONS.
+    GRAPHICS::VIEWING::Camera camera = GRAPHICS::VIEWING::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(1.0f, 2.0f, 10.0f));
+    camera.NearClipPlaneViewDistance = 0.5f;
+    camera.FarClipPlaneViewDistance = 100.0f;
+    GRAPHICS::IMAGES::Bitmap output_plane(64, 48, GRAPHICS::ColorFormat::RGBA);
+
+    const MATH::Vector3f WORLD_POSITIONS[] =
+    {
+        MATH::Vector3f(0.0f, 0.0f, 0.0f),
+        MATH::Vector3f(-2.0f, 1.5f, 3.0f),
+        MATH::Vector3f(4.0f, -3.0f, -20.0f),
+    };
+    for (GRAPHICS::VIEWING::ProjectionType projection : { GRAPHICS::VIEWING::ProjectionType::ORTHOGRAPHIC, GRAPHICS::VIEWING::ProjectionType::PERSPECTIVE })
+    {
+        for (bool reversed_z : { false, true })
+        {
+            camera.Projection = projection;
+            GRAPHICS::VIEWING::ViewingTransformations viewing_transformations(camera, output_plane);
+            viewing_transformations.ReversedZ = reversed_z;
+            MATH::Matrix4x4f screen_to_world_transform = viewing_transformations.ScreenToWorldTransform();
+
+            // VERIFY EACH POSITION SURVIVES A ROUND TRIP THROUGH SCREEN SPACE.
+            for (const MATH::Vector3f& world_position : WORLD_POSITIONS)
+            {
+                std::optional<MATH::Vector3f> screen_position = viewing_transformations.WorldToScreen(world_position);
+                REQUIRE(screen_position);
+
+                MATH::Vector3f round_trip_world_position = viewing_transformations.ScreenToWorld(*screen_position, screen_to_world_transform);
+                CHECK(round_trip_world_position.X == Approx(world_position.X).margin(0.001f));
+                CHECK(round_trip_world_position.Y == Approx(world_position.Y).margin(0.001f));
+                CHECK(round_trip_world_position.Z == Approx(world_position.Z).margin(0.001f));
+            }
+        }
+    }
+}
+
+TEST_CASE("World positions outside of the near and far clip planes aren't transformed to screen space.", "[ViewingTransformations][WorldToScreen]")
+{
+    GRAPHICS::VIEWING::Camera camera = GRAPHICS::VIEWING::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 0.0f, 10.0f));
+    camera.Projection = GRAPHICS::VIEWING::ProjectionType::PERSPECTIVE;
+    camera.NearClipPlaneViewDistance = 0.5f;
+    camera.FarClipPlaneViewDistance = 100.0f;
+    GRAPHICS::IMAGES::Bitmap output_plane(64, 48, GRAPHICS::ColorFormat::RGBA);
+    GRAPHICS::VIEWING::ViewingTransformations viewing_transformations(camera, output_plane);
+
+    REQUIRE(viewing_transformations.WorldToScreen(MATH::Vector3f(0.0f, 0.0f, 0.0f)));
+    REQUIRE_FALSE(viewing_transformations.WorldToScreen(MATH::Vector3f(0.0f, 0.0f, 20.0f)));
+    REQUIRE_FALSE(viewing_transformations.WorldToScreen(MATH::Vector3f(0.0f, 0.0f, -200.0f)));
+}
@@ -0,0 +1,301 @@
+#include "Math/AffineTransform3x4.h"
+
+namespace MATH
+{
+    /// Creates a transform that leaves vectors unchanged.
+    /// @return An identity transform.
+    AffineTransform3x4 AffineTransform3x4::Identity()
+    {
+        AffineTransform3x4 identity_transform;
+        identity_transform.Elements = CONTAINERS::FixedSizeArray2D<float, COLUMN_COUNT, ROW_COUNT>(
+            {
+                1.0f, 0.0f, 0.0f, 0.0f,
+                0.0f, 1.0f, 0.0f, 0.0f,
+                0.0f, 0.0f, 1.0f, 0.0f,
+            });
+        return identity_transform;
+    }
+
+    /// Creates a translation transform.
+    /// @param[in]  translation_vector - The vector defining the translation amount.
+    /// @return The translation transform for the provided vector.
+    AffineTransform3x4 AffineTransform3x4::Translation(const Vector3f& translation_vector)
+    {
+        AffineTransform3x4 translation_transform;
+        translation_transform.Elements = CONTAINERS::FixedSizeArray2D<float, COLUMN_COUNT, ROW_COUNT>(
+            {
+                1.0f, 0.0f, 0.0f, translation_vector.X,
+                0.0f, 1.0f, 0.0f, translation_vector.Y,
+                0.0f, 0.0f, 1.0f, translation_vector.Z,
+            });
+        return translation_transform;
+    }
+
+    /// Creates a scaling transform.
+    /// @param[in]  scale_vector - The vector defining the scaling amount along each axis.
+    /// @return The scaling transform for the provided vector.
+    AffineTransform3x4 AffineTransform3x4::Scale(const Vector3f& scale_vector)
+    {
+        AffineTransform3x4 scale_transform;
+        scale_transform.Elements = CONTAINERS::FixedSizeArray2D<float, COLUMN_COUNT, ROW_COUNT>(
+            {
+                scale_vector.X, 0.0f, 0.0f, 0.0f,
+                0.0f, scale_vector.Y, 0.0f, 0.0f,
+                0.0f, 0.0f, scale_vector.Z, 0.0f,
+            });
+        return scale_transform;
+    }
+
+    /// Creates a rotation transform.
+    /// @param[in]  unit_quaternion - The rotation as a unit quaternion.
+    /// @return The rotation transform.
+    AffineTransform3x4 AffineTransform3x4::Rotation(const Quaternionf& unit_quaternion)
+    {
+        const Vector3f NO_TRANSLATION(0.0f, 0.0f, 0.0f);
+        const Vector3f NO_SCALING(1.0f, 1.0f, 1.0f);
+        AffineTransform3x4 rotation_transform = TranslationRotationScale(NO_TRANSLATION, unit_quaternion, NO_SCALING);
+        return rotation_transform;
+    }
+
+    /// Creates a transform that scales, then rotates, and then translates vectors, as is typical for objects.
+    /// This is computed directly rather than by multiplying separate transforms.
+    /// @param[in]  translation_vector - The vector defining the translation amount.
+    /// @param[in]  unit_quaternion - The rotation as a unit quaternion.
+    /// @param[in]  scale_vector - The vector defining the scaling amount along each axis.
+    /// @return The combined transform.
+    AffineTransform3x4 AffineTransform3x4::TranslationRotationScale(const Vector3f& translation_vector, const Quaternionf& unit_quaternion, const Vector3f& scale_vector)
+    {
+        // COMPUTE TERMS OF THE ROTATION MATRIX.
+        float doubled_x = 2.0f * unit_quaternion.X;
+        float doubled_y = 2.0f * unit_quaternion.Y;
+        float doubled_z = 2.0f * unit_quaternion.Z;
+        float xx = unit_quaternion.X * doubled_x;
+        float yy = unit_quaternion.Y * doubled_y;
+        float zz = unit_quaternion.Z * doubled_z;
+        float xy = unit_quaternion.X * doubled_y;
+        float xz = unit_quaternion.X * doubled_z;
+        float yz = unit_quaternion.Y * doubled_z;
+        float wx = unit_quaternion.W * doubled_x;
+        float wy = unit_quaternion.W * doubled_y;
+        float wz = unit_quaternion.W * doubled_z;
+
+        // COMBINE THE ROTATION WITH SCALING AND TRANSLATION.
+        // Scaling is applied first, so each column of the rotation matrix is scaled.
+        AffineTransform3x4 transform;
+        transform.Elements = CONTAINERS::FixedSizeArray2D<float, COLUMN_COUNT, ROW_COUNT>(
+            {
+                (1.0f - (yy + zz)) * scale_vector.X, (xy - wz) * scale_vector.Y, (xz + wy) * scale_vector.Z, translation_vector.X,
+                (xy + wz) * scale_vector.X, (1.0f - (xx + zz)) * scale_vector.Y, (yz - wx) * scale_vector.Z, translation_vector.Y,
+                (xz - wy) * scale_vector.X, (yz + wx) * scale_vector.Y, (1.0f - (xx + yy)) * scale_vector.Z, translation_vector.Z,
+            });
+        return transform;
+    }
+
+    /// Creates an affine transform from the first 3 rows of a 4x4 matrix.
+    /// @param[in]  matrix - The matrix to convert, whose last row is expected to be (0, 0, 0, 1).
+    /// @return The affine transform for the matrix.
+    AffineTransform3x4 AffineTransform3x4::FromMatrix4x4(const Matrix4x4f& matrix)
+    {
+        AffineTransform3x4 transform;
+        for (unsigned int row_index = 0; row_index < ROW_COUNT; ++row_index)
+        {
+            for (unsigned int column_index = 0; column_index < COLUMN_COUNT; ++column_index)
+            {
+                transform.Elements(column_index, row_index) = matrix.Elements(column_index, row_index);
+            }
+        }
+        return transform;
+    }
+
+    /// Computes the inverse of a transform.
+    /// This only requires inverting the 3x3 linear part, which is much cheaper than inverting a 4x4 matrix.
+    /// @param[in]  transform - The transform to invert.
+    /// @return The inverse of the transform; a transform of all zeros if the transform isn't invertible.
+    AffineTransform3x4 AffineTransform3x4::Inverse(const AffineTransform3x4& transform)
+    {
+        // CHECK IF THE LINEAR PART IS INVERTIBLE.
+        // Cross products of the rows are the columns of the linear part's adjugate, which is the inverse times the determinant.
+        Vector3f row_1(transform.Elements(0, 0), transform.Elements(1, 0), transform.Elements(2, 0));
+        Vector3f row_2(transform.Elements(0, 1), transform.Elements(1, 1), transform.Elements(2, 1));
+        Vector3f row_3(transform.Elements(0, 2), transform.Elements(1, 2), transform.Elements(2, 2));
+        Vector3f adjugate_column_1 = Vector3f::CrossProduct(row_2, row_3);
+        Vector3f adjugate_column_2 = Vector3f::CrossProduct(row_3, row_1);
+        Vector3f adjugate_column_3 = Vector3f::CrossProduct(row_1, row_2);
+        float determinant = Vector3f::DotProduct(row_1, adjugate_column_1);
+        bool transform_invertible = (0.0f != determinant);
+        if (!transform_invertible)
+        {
+            AffineTransform3x4 zero_transform;
+            return zero_transform;
+        }
+
+        // INVERT THE LINEAR PART.
+        AffineTransform3x4 inverse_transform;
+        const Vector3f ADJUGATE_COLUMNS[] = { adjugate_column_1, adjugate_column_2, adjugate_column_3 };
+        for (unsigned int column_index = 0; column_index < 3; ++column_index)
+        {
+            inverse_transform.Elements(column_index, 0) = ADJUGATE_COLUMNS[column_index].X / determinant;
+            inverse_transform.Elements(column_index, 1) = ADJUGATE_COLUMNS[column_index].Y / determinant;
+            inverse_transform.Elements(column_index, 2) = ADJUGATE_COLUMNS[column_index].Z / determinant;
+        }
+
+        // INVERT THE TRANSLATION.
+        // The translation is undone after the linear part is, so it must also be transformed by the inverted linear part.
+        Vector3f translation(transform.Elements(3, 0), transform.Elements(3, 1), transform.Elements(3, 2));
+        Vector3f inverse_translation = -inverse_transform.TransformDirection(translation);
+        inverse_transform.Elements(3, 0) = inverse_translation.X;
+        inverse_transform.Elements(3, 1) = inverse_translation.Y;
+        inverse_transform.Elements(3, 2) = inverse_translation.Z;
+        return inverse_transform;
+    }
+
+    /// Computes the transform for surface normals of geometry transformed by a transform.
+    /// Normals must be transformed by the inverse transpose of the linear part to remain
+    /// perpendicular to surfaces under non-uniform scaling.
+    /// @param[in]  transform - The transform of the geometry.
+    /// @return The transform for normals, without any translation.
+    AffineTransform3x4 AffineTransform3x4::NormalTransform(const AffineTransform3x4& transform)
+    {
+        AffineTransform3x4 inverse_transform = Inverse(transform);
+
+        AffineTransform3x4 normal_transform;
+        for (unsigned int row_index = 0; row_index < ROW_COUNT; ++row_index)
+        {
+            for (unsigned int column_index = 0; column_index < ROW_COUNT; ++column_index)
+            {
+                normal_transform.Elements(column_index, row_index) = inverse_transform.Elements(row_index, column_index);
+            }
+        }
+        return normal_transform;
+    }
+
+    /// Converts the transform to an equivalent 4x4 matrix.
+    /// @return The 4x4 matrix for the transform.
+    Matrix4x4f AffineTransform3x4::ToMatrix4x4() const
+    {
+        Matrix4x4f matrix = Matrix4x4f::Identity();
+        for (unsigned int row_index = 0; row_index < ROW_COUNT; ++row_index)
+        {
+            for (unsigned int column_index = 0; column_index < COLUMN_COUNT; ++column_index)
+            {
+                matrix.Elements(column_index, row_index) = Elements(column_index, row_index);
+            }
+        }
+        return matrix;
+    }
+
+    /// Equality operator.  Direct equality comparison is used for elements.
+    /// @param[in]  rhs - The transform to compare with.
+    /// @return True if this transform and the provided transform are equal; false otherwise.
+    bool AffineTransform3x4::operator== (const AffineTransform3x4& rhs) const
+    {
+        return Elements == rhs.Elements;
+    }
+
+    /// Inequality operator.
+    /// @param[in]  rhs - The transform to compare with.
+    /// @return True if this transform and the provided transform aren't equal; false otherwise.
+    bool AffineTransform3x4::operator!= (const AffineTransform3x4& rhs) const
+    {
+        bool transforms_equal = ((*this) == rhs);
+        return !transforms_equal;
+    }
+
+    /// Composes this transform with the provided transform.
+    /// @param[in]  rhs - The transform to apply before this transform.
+    /// @return The combined transform, with the same elements as multiplying equivalent 4x4 matrices.
+    AffineTransform3x4 AffineTransform3x4::operator* (const AffineTransform3x4& rhs) const
+    {
+        // COMPUTE EACH ROW OF THE PRODUCT.
+        // As for Matrix4x4 multiplication, each product row is the sum of the right-hand side's rows scaled by
+        // the left-hand side row's elements.  The implicit last row of the right-hand side only contributes to translation.
+        const float* lhs_elements = Elements.ValuesInRowMajorOrder();
+        const float* rhs_elements = rhs.Elements.ValuesInRowMajorOrder();
+        __m128 rhs_row_1 = _mm_load_ps(rhs_elements);
+        __m128 rhs_row_2 = _mm_load_ps(rhs_elements + COLUMN_COUNT);
+        __m128 rhs_row_3 = _mm_load_ps(rhs_elements + 2 * COLUMN_COUNT);
+        const __m128 RHS_ROW_4 = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+
+        AffineTransform3x4 product;
+        float* product_elements = product.Elements.ValuesInRowMajorOrder();
+        for (unsigned int row_index = 0; row_index < ROW_COUNT; ++row_index)
+        {
+            const float* lhs_row = lhs_elements + row_index * COLUMN_COUNT;
+            __m128 product_row = _mm_mul_ps(_mm_set1_ps(lhs_row[0]), rhs_row_1);
+            product_row = _mm_add_ps(product_row, _mm_mul_ps(_mm_set1_ps(lhs_row[1]), rhs_row_2));
+            product_row = _mm_add_ps(product_row, _mm_mul_ps(_mm_set1_ps(lhs_row[2]), rhs_row_3));
+            product_row = _mm_add_ps(product_row, _mm_mul_ps(_mm_set1_ps(lhs_row[3]), RHS_ROW_4));
+            _mm_store_ps(product_elements + row_index * COLUMN_COUNT, product_row);
+        }
+        return product;
+    }
+
+    /// Transforms a position, including translation.
+    /// @param[in]  point - The position to transform.
+    /// @return The transformed position.
+    Vector3f AffineTransform3x4::TransformPoint(const Vector3f& point) const
+    {
+        Vector3f transformed_point(
+            (Elements(0, 0) * point.X) + (Elements(1, 0) * point.Y) + (Elements(2, 0) * point.Z) + Elements(3, 0),
+            (Elements(0, 1) * point.X) + (Elements(1, 1) * point.Y) + (Elements(2, 1) * point.Z) + Elements(3, 1),
+            (Elements(0, 2) * point.X) + (Elements(1, 2) * point.Y) + (Elements(2, 2) * point.Z) + Elements(3, 2));
+        return transformed_point;
+    }
+
+    /// Transforms a direction, which isn't translated.
+    /// @param[in]  direction - The direction to transform.
+    /// @return The transformed direction.
+    Vector3f AffineTransform3x4::TransformDirection(const Vector3f& direction) const
+    {
+        Vector3f transformed_direction(
+            (Elements(0, 0) * direction.X) + (Elements(1, 0) * direction.Y) + (Elements(2, 0) * direction.Z),
+            (Elements(0, 1) * direction.X) + (Elements(1, 1) * direction.Y) + (Elements(2, 1) * direction.Z),
+            (Elements(0, 2) * direction.X) + (Elements(1, 2) * direction.Y) + (Elements(2, 2) * direction.Z));
+        return transformed_direction;
+    }
+
+    /// Transforms a surface normal, keeping it unit length.  This transform is expected to already
+    /// be a normal transform (see @ref NormalTransform) for the transform of the corresponding surface.
+    /// @param[in]  unit_normal - The unit normal to transform.
+    /// @return The transformed unit normal; a zero vector if the normal was transformed to zero length.
+    Vector3f AffineTransform3x4::TransformNormal(const Vector3f& unit_normal) const
+    {
+        Vector3f transformed_normal = TransformDirection(unit_normal);
+        Vector3f transformed_unit_normal = Vector3f::Normalize(transformed_normal);
+        return transformed_unit_normal;
+    }
+
+    /// Transforms 8 positions at once, exactly matching TransformPoint().
+    /// @param[in]  points - The positions to transform.
+    /// @return The transformed positions.
+    SIMD_TARGET_AVX2 Vector3Simd8x AffineTransform3x4::TransformPoints(const Vector3Simd8x& points) const
+    {
+        Vector3Simd8x transformed_points = TransformDirections(points);
+        transformed_points.X += Simd8xf(Elements(3, 0));
+        transformed_points.Y += Simd8xf(Elements(3, 1));
+        transformed_points.Z += Simd8xf(Elements(3, 2));
+        return transformed_points;
+    }
+
+    /// Transforms 8 directions at once, exactly matching TransformDirection().
+    /// @param[in]  directions - The directions to transform.
+    /// @return The transformed directions.
+    SIMD_TARGET_AVX2 Vector3Simd8x AffineTransform3x4::TransformDirections(const Vector3Simd8x& directions) const
+    {
+        Vector3Simd8x transformed_directions;
+        transformed_directions.X = (Simd8xf(Elements(0, 0)) * directions.X) + (Simd8xf(Elements(1, 0)) * directions.Y) + (Simd8xf(Elements(2, 0)) * directions.Z);
+        transformed_directions.Y = (Simd8xf(Elements(0, 1)) * directions.X) + (Simd8xf(Elements(1, 1)) * directions.Y) + (Simd8xf(Elements(2, 1)) * directions.Z);
+        transformed_directions.Z = (Simd8xf(Elements(0, 2)) * directions.X) + (Simd8xf(Elements(1, 2)) * directions.Y) + (Simd8xf(Elements(2, 2)) * directions.Z);
+        return transformed_directions;
+    }
+
+    /// Transforms 8 surface normals at once, exactly matching TransformNormal().
+    /// @param[in]  unit_normals - The unit normals to transform.
+    /// @return The transformed unit normals.
+    SIMD_TARGET_AVX2 Vector3Simd8x AffineTransform3x4::TransformNormals(const Vector3Simd8x& unit_normals) const
+    {
+        Vector3Simd8x transformed_normals = TransformDirections(unit_normals);
+        Vector3Simd8x transformed_unit_normals = Vector3Simd8x::Normalize(transformed_normals);
+        return transformed_unit_normals;
+    }
+}
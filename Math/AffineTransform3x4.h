@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Containers/FixedSizeArray2D.h"
+#include "Math/Matrix4x4.h"
+#include "Math/Quaternion.h"
+#include "Math/Vector3.h"
+#include "Processor/SimdIntrinsics.h"
+
+namespace MATH
+{
+    /// An affine transform (any combination of translation, rotation, scaling, and shearing) stored as a matrix
+    /// with 3 rows and 4 columns.  It's equivalent to a 4x4 matrix whose last row is always (0, 0, 0, 1),
+    /// which is true for all object transforms other than projections.  Omitting that row uses less memory,
+    /// and composing, inverting, and applying transforms requires fewer operations than for 4x4 matrices.
+    ///
+    /// Points and directions are transformed with exactly the same results as transforming homogeneous
+    /// vectors with the equivalent 4x4 matrix (see @ref ToMatrix4x4).
+    class AffineTransform3x4
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// 4 columns exist (3 for the linear part and 1 for translation).
+        static const unsigned int COLUMN_COUNT = 4;
+        /// 3 rows exist (1 for each output component).
+        static const unsigned int ROW_COUNT = 3;
+
+        // CONSTRUCTION.
+        static AffineTransform3x4 Identity();
+        static AffineTransform3x4 Translation(const Vector3f& translation_vector);
+        static AffineTransform3x4 Scale(const Vector3f& scale_vector);
+        static AffineTransform3x4 Rotation(const Quaternionf& unit_quaternion);
+        static AffineTransform3x4 TranslationRotationScale(const Vector3f& translation_vector, const Quaternionf& unit_quaternion, const Vector3f& scale_vector);
+        static AffineTransform3x4 FromMatrix4x4(const Matrix4x4f& matrix);
+
+        // OTHER OPERATIONS.
+        static AffineTransform3x4 Inverse(const AffineTransform3x4& transform);
+        static AffineTransform3x4 NormalTransform(const AffineTransform3x4& transform);
+        Matrix4x4f ToMatrix4x4() const;
+
+        // OPERATORS.
+        bool operator== (const AffineTransform3x4& rhs) const;
+        bool operator!= (const AffineTransform3x4& rhs) const;
+        AffineTransform3x4 operator* (const AffineTransform3x4& rhs) const;
+
+        // TRANSFORMATION.
+        Vector3f TransformPoint(const Vector3f& point) const;
+        Vector3f TransformDirection(const Vector3f& direction) const;
+        Vector3f TransformNormal(const Vector3f& unit_normal) const;
+        SIMD_TARGET_AVX2 Vector3Simd8x TransformPoints(const Vector3Simd8x& points) const;
+        SIMD_TARGET_AVX2 Vector3Simd8x TransformDirections(const Vector3Simd8x& directions) const;
+        SIMD_TARGET_AVX2 Vector3Simd8x TransformNormals(const Vector3Simd8x& unit_normals) const;
+
+        // MEMBER VARIABLES.
+        /// The underlying 3x4 array of elements, accessed as (column, row) like Matrix4x4.
+        /// Each row is aligned so that it can be directly loaded into a SIMD register.
+        CONTAINERS::FixedSizeArray2D<float, COLUMN_COUNT, ROW_COUNT> Elements = CONTAINERS::FixedSizeArray2D<float, COLUMN_COUNT, ROW_COUNT>();
+    };
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <numbers>
+
 namespace MATH
 {
     /// A mathematical angle, which exists between two lines with a common endpoint.
@@ -18,14 +20,14 @@ namespace MATH
             ValueType Value;
 
             // CONSTRUCTION.
-            explicit Radians(const ValueType value);
+            constexpr explicit Radians(const ValueType value);
 
             // OPERATORS.
-            bool operator==(const Radians rhs) const;
-            Radians operator+(const Radians rhs) const;
-            Radians operator-(const Radians rhs) const;
-            Radians operator*(const Radians rhs) const;
-            Radians operator/(const Radians rhs) const;
+            constexpr bool operator==(const Radians rhs) const;
+            constexpr Radians operator+(const Radians rhs) const;
+            constexpr Radians operator-(const Radians rhs) const;
+            constexpr Radians operator*(const Radians rhs) const;
+            constexpr Radians operator/(const Radians rhs) const;
         };
 
         /// A nested type to represent an angle value in degrees,
@@ -37,24 +39,24 @@ namespace MATH
             ValueType Value;
 
             // CONSTRUCTION.
-            explicit Degrees(const ValueType value);
+            constexpr explicit Degrees(const ValueType value);
 
             // OPERATORS.
-            bool operator==(const Degrees rhs) const;
-            Degrees operator+(const Degrees rhs) const;
-            Degrees operator-(const Degrees rhs) const;
-            Degrees operator*(const Degrees rhs) const;
-            Degrees operator/(const Degrees rhs) const;
+            constexpr bool operator==(const Degrees rhs) const;
+            constexpr Degrees operator+(const Degrees rhs) const;
+            constexpr Degrees operator-(const Degrees rhs) const;
+            constexpr Degrees operator*(const Degrees rhs) const;
+            constexpr Degrees operator/(const Degrees rhs) const;
         };
 
         // STATIC METHODS.
-        static Radians DegreesToRadians(const Degrees degrees);
+        static constexpr Radians DegreesToRadians(const Degrees degrees);
     };
     
     /// Constructor.
     /// @param[in]  value - The angle value, in radians.
     template <typename ValueType>
-    Angle<ValueType>::Radians::Radians(const ValueType value) :
+    constexpr Angle<ValueType>::Radians::Radians(const ValueType value) :
         Value(value)
     {}
 
@@ -62,7 +64,7 @@ namespace MATH
     /// @param[in]  rhs - The radian value to compare with.
     /// @return True if this radian value is equal with the provided radian value; false otherwise.
     template <typename ValueType>
-    bool Angle<ValueType>::Radians::operator==(const typename Angle<ValueType>::Radians rhs) const
+    constexpr bool Angle<ValueType>::Radians::operator==(const typename Angle<ValueType>::Radians rhs) const
     {
         bool radians_equal = (this->Value == rhs.Value);
         return radians_equal;
@@ -72,7 +74,7 @@ namespace MATH
     /// @param[in]  rhs - The radian value to add to this radian value.
     /// @return The sum of the two radian values.
     template <typename ValueType>
-    typename Angle<ValueType>::Radians Angle<ValueType>::Radians::operator+(const typename Angle<ValueType>::Radians rhs) const
+    constexpr typename Angle<ValueType>::Radians Angle<ValueType>::Radians::operator+(const typename Angle<ValueType>::Radians rhs) const
     {
         Angle<ValueType>::Radians radian_sum(this->Value + rhs.Value);
         return radian_sum;
@@ -82,7 +84,7 @@ namespace MATH
     /// @param[in]  rhs - The radian value to subtract from this radian value.
     /// @return The difference of the two radian values.
     template <typename ValueType>
-    typename Angle<ValueType>::Radians Angle<ValueType>::Radians::operator-(const typename Angle<ValueType>::Radians rhs) const
+    constexpr typename Angle<ValueType>::Radians Angle<ValueType>::Radians::operator-(const typename Angle<ValueType>::Radians rhs) const
     {
         Angle<ValueType>::Radians radian_difference(this->Value - rhs.Value);
         return radian_difference;
@@ -92,7 +94,7 @@ namespace MATH
     /// @param[in]  rhs - The radian value to multiply by.
     /// @return The product of the two radian values.
     template <typename ValueType>
-    typename Angle<ValueType>::Radians Angle<ValueType>::Radians::operator*(const typename Angle<ValueType>::Radians rhs) const
+    constexpr typename Angle<ValueType>::Radians Angle<ValueType>::Radians::operator*(const typename Angle<ValueType>::Radians rhs) const
     {
         Angle<ValueType>::Radians radian_product(this->Value * rhs.Value);
         return radian_product;
@@ -102,7 +104,7 @@ namespace MATH
     /// @param[in]  rhs - The radian value to divide by.
     /// @return The quotient of the two radian values.
     template <typename ValueType>
-    typename Angle<ValueType>::Radians Angle<ValueType>::Radians::operator/(const typename Angle<ValueType>::Radians rhs) const
+    constexpr typename Angle<ValueType>::Radians Angle<ValueType>::Radians::operator/(const typename Angle<ValueType>::Radians rhs) const
     {
         Angle<ValueType>::Radians radian_quotient(this->Value / rhs.Value);
         return radian_quotient;
@@ -111,7 +113,7 @@ namespace MATH
     /// Constructor.
     /// @param[in]  value - The angle value, in degrees.
     template <typename ValueType>
-    Angle<ValueType>::Degrees::Degrees(const ValueType value) :
+    constexpr Angle<ValueType>::Degrees::Degrees(const ValueType value) :
         Value(value)
     {}
 
@@ -119,7 +121,7 @@ namespace MATH
     /// @param[in]  rhs - The degree value to compare with.
     /// @return True if this degree value is equal with the provided degree value; false otherwise.
     template <typename ValueType>
-    bool Angle<ValueType>::Degrees::operator==(const typename Angle<ValueType>::Degrees rhs) const
+    constexpr bool Angle<ValueType>::Degrees::operator==(const typename Angle<ValueType>::Degrees rhs) const
     {
         bool degrees_equal = (this->Value == rhs.Value);
         return degrees_equal;
@@ -129,7 +131,7 @@ namespace MATH
     /// @param[in]  rhs - The degree value to add to this degree value.
     /// @return The sum of the two degree values.
     template <typename ValueType>
-    typename Angle<ValueType>::Degrees Angle<ValueType>::Degrees::operator+(const typename Angle<ValueType>::Degrees rhs) const
+    constexpr typename Angle<ValueType>::Degrees Angle<ValueType>::Degrees::operator+(const typename Angle<ValueType>::Degrees rhs) const
     {
         Angle<ValueType>::Degrees degree_sum(this->Value + rhs.Value);
         return degree_sum;
@@ -139,7 +141,7 @@ namespace MATH
     /// @param[in]  rhs - The degree value to subtract from this degree value.
     /// @return The difference of the two degree values.
     template <typename ValueType>
-    typename Angle<ValueType>::Degrees Angle<ValueType>::Degrees::operator-(const typename Angle<ValueType>::Degrees rhs) const
+    constexpr typename Angle<ValueType>::Degrees Angle<ValueType>::Degrees::operator-(const typename Angle<ValueType>::Degrees rhs) const
     {
         Angle<ValueType>::Degrees degree_difference(this->Value - rhs.Value);
         return degree_difference;
@@ -149,7 +151,7 @@ namespace MATH
     /// @param[in]  rhs - The degree value to multiply by.
     /// @return The product of the two degree values.
     template <typename ValueType>
-    typename Angle<ValueType>::Degrees Angle<ValueType>::Degrees::operator*(const typename Angle<ValueType>::Degrees rhs) const
+    constexpr typename Angle<ValueType>::Degrees Angle<ValueType>::Degrees::operator*(const typename Angle<ValueType>::Degrees rhs) const
     {
         Angle<ValueType>::Degrees degree_product(this->Value * rhs.Value);
         return degree_product;
@@ -159,7 +161,7 @@ namespace MATH
     /// @param[in]  rhs - The degree value to divide by.
     /// @return The quotient of the two degree values.
     template <typename ValueType>
-    typename Angle<ValueType>::Degrees Angle<ValueType>::Degrees::operator/(const typename Angle<ValueType>::Degrees rhs) const
+    constexpr typename Angle<ValueType>::Degrees Angle<ValueType>::Degrees::operator/(const typename Angle<ValueType>::Degrees rhs) const
     {
         Angle<ValueType>::Degrees degree_quotient(this->Value / rhs.Value);
         return degree_quotient;
@@ -169,11 +171,10 @@ namespace MATH
     /// @param[in]  degrees - The angle value in degrees.
     /// @return The angle value in radians.
     template <typename ValueType>
-    typename Angle<ValueType>::Radians Angle<ValueType>::DegreesToRadians(const typename Angle<ValueType>::Degrees degrees)
+    constexpr typename Angle<ValueType>::Radians Angle<ValueType>::DegreesToRadians(const typename Angle<ValueType>::Degrees degrees)
     {
-        /// @todo   More precision for pi.
-        const ValueType HALF_CIRCLE_IN_RADIANS = static_cast<ValueType>(3.14159);
-        const ValueType HALF_CIRCLE_IN_DEGREES = static_cast<ValueType>(180);
+        constexpr ValueType HALF_CIRCLE_IN_RADIANS = std::numbers::pi_v<ValueType>;
+        constexpr ValueType HALF_CIRCLE_IN_DEGREES = static_cast<ValueType>(180);
         ValueType radians_value = degrees.Value * HALF_CIRCLE_IN_RADIANS / HALF_CIRCLE_IN_DEGREES;
         Radians radians(radians_value);
         return radians;
@@ -0,0 +1,386 @@
+#include <algorithm>
+#include <future>
+#include <thread>
+#include <vector>
+#include "Math/BatchTransforms.h"
+#include "Math/Vector4.h"
+#include "Processor/CpuFeatures.h"
+
+namespace MATH
+{
+    // Arrays of Vector3f are loaded directly into SIMD registers as consecutive floats.
+    static_assert(sizeof(Vector3f) == 3 * sizeof(float));
+
+    /// Transforms positions by a matrix.
+    /// @param[in]  transform - The matrix to transform by.
+    /// @param[in]  points - The positions to transform.
+    /// @param[out] transformed_points - The transformed positions.
+    void BatchTransforms::TransformPoints(const Matrix4x4f& transform, const std::span<const Vector3f> points, const std::span<Vector3f> transformed_points)
+    {
+        TransformInParallel(TransformType::POINT, transform, points, transformed_points);
+    }
+
+    /// Transforms positions by a matrix.
+    /// @param[in]  transform - The matrix to transform by.
+    /// @param[in]  points - The positions to transform.
+    /// @param[out] transformed_points - The transformed positions.
+    void BatchTransforms::TransformPoints(const Matrix4x4f& transform, const Vector3Spans<const float>& points, const Vector3Spans<float>& transformed_points)
+    {
+        TransformInParallel(TransformType::POINT, transform, points, transformed_points);
+    }
+
+    /// Transforms positions by a matrix and then divides them by their transformed homogeneous w components.
+    /// @param[in]  transform - The matrix to transform by (typically including a perspective projection).
+    /// @param[in]  points - The positions to transform.
+    /// @param[out] transformed_points - The transformed positions after the perspective divide.
+    void BatchTransforms::TransformPointsWithPerspectiveDivide(const Matrix4x4f& transform, const std::span<const Vector3f> points, const std::span<Vector3f> transformed_points)
+    {
+        TransformInParallel(TransformType::PROJECTED_POINT, transform, points, transformed_points);
+    }
+
+    /// Transforms positions by a matrix and then divides them by their transformed homogeneous w components.
+    /// @param[in]  transform - The matrix to transform by (typically including a perspective projection).
+    /// @param[in]  points - The positions to transform.
+    /// @param[out] transformed_points - The transformed positions after the perspective divide.
+    void BatchTransforms::TransformPointsWithPerspectiveDivide(const Matrix4x4f& transform, const Vector3Spans<const float>& points, const Vector3Spans<float>& transformed_points)
+    {
+        TransformInParallel(TransformType::PROJECTED_POINT, transform, points, transformed_points);
+    }
+
+    /// Transforms directions by a matrix, without any translation.
+    /// @param[in]  transform - The matrix to transform by.
+    /// @param[in]  directions - The directions to transform.
+    /// @param[out] transformed_directions - The transformed directions.
+    void BatchTransforms::TransformDirections(const Matrix4x4f& transform, const std::span<const Vector3f> directions, const std::span<Vector3f> transformed_directions)
+    {
+        TransformInParallel(TransformType::DIRECTION, transform, directions, transformed_directions);
+    }
+
+    /// Transforms directions by a matrix, without any translation.
+    /// @param[in]  transform - The matrix to transform by.
+    /// @param[in]  directions - The directions to transform.
+    /// @param[out] transformed_directions - The transformed directions.
+    void BatchTransforms::TransformDirections(const Matrix4x4f& transform, const Vector3Spans<const float>& directions, const Vector3Spans<float>& transformed_directions)
+    {
+        TransformInParallel(TransformType::DIRECTION, transform, directions, transformed_directions);
+    }
+
+    /// Transforms surface normals for surfaces whose positions are transformed by a matrix.
+    /// Normals are transformed by the inverse transpose of the matrix to remain perpendicular to surfaces
+    /// under non-uniform scaling and are then normalized.
+    /// @param[in]  transform - The matrix transforming positions on the surfaces.
+    /// @param[in]  unit_normals - The normals to transform.
+    /// @param[out] transformed_unit_normals - The transformed normals; zero vectors if the matrix isn't invertible.
+    void BatchTransforms::TransformNormals(const Matrix4x4f& transform, const std::span<const Vector3f> unit_normals, const std::span<Vector3f> transformed_unit_normals)
+    {
+        Matrix4x4f normal_transform = GetNormalTransform(transform);
+        TransformInParallel(TransformType::UNIT_NORMAL, normal_transform, unit_normals, transformed_unit_normals);
+    }
+
+    /// Transforms surface normals for surfaces whose positions are transformed by a matrix.
+    /// Normals are transformed by the inverse transpose of the matrix to remain perpendicular to surfaces
+    /// under non-uniform scaling and are then normalized.
+    /// @param[in]  transform - The matrix transforming positions on the surfaces.
+    /// @param[in]  unit_normals - The normals to transform.
+    /// @param[out] transformed_unit_normals - The transformed normals; zero vectors if the matrix isn't invertible.
+    void BatchTransforms::TransformNormals(const Matrix4x4f& transform, const Vector3Spans<const float>& unit_normals, const Vector3Spans<float>& transformed_unit_normals)
+    {
+        Matrix4x4f normal_transform = GetNormalTransform(transform);
+        TransformInParallel(TransformType::UNIT_NORMAL, normal_transform, unit_normals, transformed_unit_normals);
+    }
+
+    /// Gets the matrix for transforming surface normals.
+    /// @param[in]  transform - The matrix transforming positions on the surfaces.
+    /// @return The inverse transpose of the matrix.
+    Matrix4x4f BatchTransforms::GetNormalTransform(const Matrix4x4f& transform)
+    {
+        Matrix4x4f inverse_transform = Matrix4x4f::Inverse(transform);
+        Matrix4x4f normal_transform = Matrix4x4f::Transpose(inverse_transform);
+        return normal_transform;
+    }
+
+    /// Transforms vectors, splitting large arrays across multiple threads.
+    /// @param[in]  transform_type - How to transform the vectors.
+    /// @param[in]  transform - The matrix to transform by.
+    /// @param[in]  vectors - The vectors to transform.
+    /// @param[out] transformed_vectors - The transformed vectors.
+    template <typename InputVectors, typename OutputVectors>
+    void BatchTransforms::TransformInParallel(const TransformType transform_type, const Matrix4x4f& transform, const InputVectors& vectors, const OutputVectors& transformed_vectors)
+    {
+        // DETERMINE HOW MANY THREADS TO USE.
+        std::size_t vector_count = std::min(vectors.size(), transformed_vectors.size());
+        std::size_t max_thread_count = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+        std::size_t thread_count = std::clamp<std::size_t>(vector_count / PARALLEL_TRANSFORM_MIN_VECTOR_COUNT_PER_THREAD, 1, max_thread_count);
+        if (thread_count <= 1)
+        {
+            TransformSerially(transform_type, transform, vectors.subspan(0, vector_count), transformed_vectors.subspan(0, vector_count));
+            return;
+        }
+
+        // TRANSFORM SEPARATE PORTIONS OF THE VECTORS ON EACH THREAD.
+        // Portions are multiples of 16 vectors, which fill whole cache lines in either layout,
+        // so that threads don't write to the same cache lines.
+        constexpr std::size_t CACHE_LINE_VECTOR_COUNT = 16;
+        std::size_t vectors_per_thread = (vector_count + thread_count - 1) / thread_count;
+        vectors_per_thread = ((vectors_per_thread + CACHE_LINE_VECTOR_COUNT - 1) / CACHE_LINE_VECTOR_COUNT) * CACHE_LINE_VECTOR_COUNT;
+        std::vector<std::future<void>> thread_transforms;
+        std::size_t first_vector_index = 0;
+        while (first_vector_index + vectors_per_thread < vector_count)
+        {
+            thread_transforms.emplace_back(std::async(
+                std::launch::async,
+                [transform_type, &transform, thread_vectors = vectors.subspan(first_vector_index, vectors_per_thread), thread_transformed_vectors = transformed_vectors.subspan(first_vector_index, vectors_per_thread)]()
+                {
+                    TransformSerially(transform_type, transform, thread_vectors, thread_transformed_vectors);
+                }));
+            first_vector_index += vectors_per_thread;
+        }
+
+        // The current thread transforms the last portion rather than just waiting.
+        std::size_t remaining_vector_count = vector_count - first_vector_index;
+        TransformSerially(
+            transform_type,
+            transform,
+            vectors.subspan(first_vector_index, remaining_vector_count),
+            transformed_vectors.subspan(first_vector_index, remaining_vector_count));
+        for (std::future<void>& thread_transform : thread_transforms)
+        {
+            thread_transform.wait();
+        }
+    }
+
+    /// Transforms vectors on the current thread.
+    /// @param[in]  transform_type - How to transform the vectors.
+    /// @param[in]  transform - The matrix to transform by.
+    /// @param[in]  vectors - The vectors to transform.
+    /// @param[out] transformed_vectors - The transformed vectors.  Must be the same size as the input vectors.
+    template <typename InputVectors, typename OutputVectors>
+    void BatchTransforms::TransformSerially(const TransformType transform_type, const Matrix4x4f& transform, const InputVectors& vectors, const OutputVectors& transformed_vectors)
+    {
+        // TRANSFORM AS MANY VECTORS AS POSSIBLE USING SIMD.
+        std::size_t first_remaining_vector_index = 0;
+        PROCESSOR::SimdInstructionSet instruction_set = PROCESSOR::CpuFeatures::GetSimdInstructionSet();
+        bool avx2_supported = (instruction_set >= PROCESSOR::SimdInstructionSet::AVX2);
+        if (avx2_supported)
+        {
+            first_remaining_vector_index = TransformAvx2(transform_type, transform, vectors, transformed_vectors);
+        }
+
+        // TRANSFORM ANY REMAINING VECTORS WITHOUT SIMD.
+        for (std::size_t vector_index = first_remaining_vector_index; vector_index < vectors.size(); ++vector_index)
+        {
+            Vector3f vector = GetVector(vectors, vector_index);
+            Vector3f transformed_vector = Transform(transform_type, transform, vector);
+            SetVector(transformed_vectors, vector_index, transformed_vector);
+        }
+    }
+
+    /// Transforms vectors 8 at a time using AVX2 instructions.
+    /// Products are summed in the same order as multiplying a matrix by a single vector for exactly the same results.
+    /// @param[in]  transform_type - How to transform the vectors.
+    /// @param[in]  transform - The matrix to transform by.
+    /// @param[in]  vectors - The vectors to transform.
+    /// @param[out] transformed_vectors - The transformed vectors.  Must be the same size as the input vectors.
+    /// @return The number of vectors transformed, which excludes any remaining vectors that don't fill an entire SIMD register.
+    template <typename InputVectors, typename OutputVectors>
+    SIMD_TARGET_AVX2 std::size_t BatchTransforms::TransformAvx2(const TransformType transform_type, const Matrix4x4f& transform, const InputVectors& vectors, const OutputVectors& transformed_vectors)
+    {
+        // BROADCAST EACH MATRIX ELEMENT TO ITS OWN REGISTER.
+        constexpr unsigned int ELEMENT_COUNT = Matrix4x4f::ROW_COUNT * Matrix4x4f::COLUMN_COUNT;
+        const float* elements = transform.ElementsInRowMajorOrder();
+        __m256 elements_8x[ELEMENT_COUNT];
+        for (unsigned int element_index = 0; element_index < ELEMENT_COUNT; ++element_index)
+        {
+            elements_8x[element_index] = _mm256_set1_ps(elements[element_index]);
+        }
+
+        // Points are translated by the last column of the matrix, but directions aren't.
+        bool translated = (TransformType::POINT == transform_type) || (TransformType::PROJECTED_POINT == transform_type);
+        const __m256 W_8X = _mm256_set1_ps(translated ? 1.0f : 0.0f);
+
+        // TRANSFORM THE VECTORS 8 AT A TIME.
+        constexpr std::size_t LANE_COUNT = 8;
+        std::size_t simd_vector_count = (vectors.size() / LANE_COUNT) * LANE_COUNT;
+        for (std::size_t first_vector_index = 0; first_vector_index < simd_vector_count; first_vector_index += LANE_COUNT)
+        {
+            Vector3Simd8x vectors_8x = LoadVectors8x(vectors, first_vector_index);
+
+            __m256 transformed_components_8x[Matrix4x4f::ROW_COUNT];
+            for (unsigned int row_index = 0; row_index < Matrix4x4f::ROW_COUNT; ++row_index)
+            {
+                const __m256* row_elements_8x = elements_8x + row_index * Matrix4x4f::COLUMN_COUNT;
+                __m256 transformed_component_8x = _mm256_mul_ps(row_elements_8x[0], vectors_8x.X);
+                transformed_component_8x = _mm256_add_ps(transformed_component_8x, _mm256_mul_ps(row_elements_8x[1], vectors_8x.Y));
+                transformed_component_8x = _mm256_add_ps(transformed_component_8x, _mm256_mul_ps(row_elements_8x[2], vectors_8x.Z));
+                transformed_component_8x = _mm256_add_ps(transformed_component_8x, _mm256_mul_ps(row_elements_8x[3], W_8X));
+                transformed_components_8x[row_index] = transformed_component_8x;
+            }
+
+            Vector3Simd8x transformed_vectors_8x;
+            transformed_vectors_8x.X = transformed_components_8x[0];
+            transformed_vectors_8x.Y = transformed_components_8x[1];
+            transformed_vectors_8x.Z = transformed_components_8x[2];
+            if (TransformType::PROJECTED_POINT == transform_type)
+            {
+                __m256 w_8x = transformed_components_8x[3];
+                transformed_vectors_8x.X = _mm256_div_ps(transformed_vectors_8x.X, w_8x);
+                transformed_vectors_8x.Y = _mm256_div_ps(transformed_vectors_8x.Y, w_8x);
+                transformed_vectors_8x.Z = _mm256_div_ps(transformed_vectors_8x.Z, w_8x);
+            }
+            else if (TransformType::UNIT_NORMAL == transform_type)
+            {
+                transformed_vectors_8x = Vector3Simd8x::Normalize(transformed_vectors_8x);
+            }
+
+            StoreVectors8x(transformed_vectors, first_vector_index, transformed_vectors_8x);
+        }
+
+        return simd_vector_count;
+    }
+
+    /// Transforms a single vector.
+    /// @param[in]  transform_type - How to transform the vector.
+    /// @param[in]  transform - The matrix to transform by.
+    /// @param[in]  vector - The vector to transform.
+    /// @return The transformed vector.
+    Vector3f BatchTransforms::Transform(const TransformType transform_type, const Matrix4x4f& transform, const Vector3f& vector)
+    {
+        switch (transform_type)
+        {
+            case TransformType::POINT:
+            {
+                Vector4f transformed_point = transform * Vector4f::HomogeneousPositionVector(vector);
+                return Vector3f(transformed_point.X, transformed_point.Y, transformed_point.Z);
+            }
+            case TransformType::PROJECTED_POINT:
+            {
+                Vector4f transformed_point = transform * Vector4f::HomogeneousPositionVector(vector);
+                return Vector3f(
+                    transformed_point.X / transformed_point.W,
+                    transformed_point.Y / transformed_point.W,
+                    transformed_point.Z / transformed_point.W);
+            }
+            case TransformType::DIRECTION:
+            {
+                Vector4f transformed_direction = transform * Vector4f(vector.X, vector.Y, vector.Z, 0.0f);
+                return Vector3f(transformed_direction.X, transformed_direction.Y, transformed_direction.Z);
+            }
+            case TransformType::UNIT_NORMAL:
+            default:
+            {
+                Vector4f transformed_normal = transform * Vector4f(vector.X, vector.Y, vector.Z, 0.0f);
+                return Vector3f::Normalize(Vector3f(transformed_normal.X, transformed_normal.Y, transformed_normal.Z));
+            }
+        }
+    }
+
+    /// Gets a single vector from an array of vectors.
+    /// @param[in]  vectors - The vectors from which to get a vector.
+    /// @param[in]  vector_index - The index of the vector to get.
+    /// @return The vector at the specified index.
+    Vector3f BatchTransforms::GetVector(const std::span<const Vector3f> vectors, const std::size_t vector_index)
+    {
+        return vectors[vector_index];
+    }
+
+    /// Gets a single vector from separate component arrays.
+    /// @param[in]  vectors - The vectors from which to get a vector.
+    /// @param[in]  vector_index - The index of the vector to get.
+    /// @return The vector at the specified index.
+    Vector3f BatchTransforms::GetVector(const Vector3Spans<const float>& vectors, const std::size_t vector_index)
+    {
+        return Vector3f(vectors.X[vector_index], vectors.Y[vector_index], vectors.Z[vector_index]);
+    }
+
+    /// Sets a single vector in an array of vectors.
+    /// @param[in,out]  vectors - The vectors in which to set a vector.
+    /// @param[in]  vector_index - The index of the vector to set.
+    /// @param[in]  vector - The vector to set.
+    void BatchTransforms::SetVector(const std::span<Vector3f> vectors, const std::size_t vector_index, const Vector3f& vector)
+    {
+        vectors[vector_index] = vector;
+    }
+
+    /// Sets a single vector in separate component arrays.
+    /// @param[in,out]  vectors - The vectors in which to set a vector.
+    /// @param[in]  vector_index - The index of the vector to set.
+    /// @param[in]  vector - The vector to set.
+    void BatchTransforms::SetVector(const Vector3Spans<float>& vectors, const std::size_t vector_index, const Vector3f& vector)
+    {
+        vectors.X[vector_index] = vector.X;
+        vectors.Y[vector_index] = vector.Y;
+        vectors.Z[vector_index] = vector.Z;
+    }
+
+    /// Loads 8 consecutive vectors from an array of vectors, separating their components into different registers.
+    /// @param[in]  vectors - The vectors to load from.
+    /// @param[in]  first_vector_index - The index of the first vector to load.
+    /// @return The loaded vectors.
+    SIMD_TARGET_AVX2 Vector3Simd8x BatchTransforms::LoadVectors8x(const std::span<const Vector3f> vectors, const std::size_t first_vector_index)
+    {
+        // LOAD THE COMPONENTS.
+        // Each 128-bit half of the registers holds 4 vectors' worth of components (x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3).
+        const float* components = reinterpret_cast<const float*>(vectors.data() + first_vector_index);
+        __m256 components_0_to_3_and_12_to_15 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(components)), _mm_loadu_ps(components + 12), 1);
+        __m256 components_4_to_7_and_16_to_19 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(components + 4)), _mm_loadu_ps(components + 16), 1);
+        __m256 components_8_to_11_and_20_to_23 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(components + 8)), _mm_loadu_ps(components + 20), 1);
+
+        // SHUFFLE THE COMPONENTS INTO SEPARATE REGISTERS.
+        __m256 x_and_y_components = _mm256_shuffle_ps(components_4_to_7_and_16_to_19, components_8_to_11_and_20_to_23, _MM_SHUFFLE(2, 1, 3, 2));
+        __m256 y_and_z_components = _mm256_shuffle_ps(components_0_to_3_and_12_to_15, components_4_to_7_and_16_to_19, _MM_SHUFFLE(1, 0, 2, 1));
+        Vector3Simd8x vectors_8x;
+        vectors_8x.X = _mm256_shuffle_ps(components_0_to_3_and_12_to_15, x_and_y_components, _MM_SHUFFLE(2, 0, 3, 0));
+        vectors_8x.Y = _mm256_shuffle_ps(y_and_z_components, x_and_y_components, _MM_SHUFFLE(3, 1, 2, 0));
+        vectors_8x.Z = _mm256_shuffle_ps(y_and_z_components, components_8_to_11_and_20_to_23, _MM_SHUFFLE(3, 0, 3, 1));
+        return vectors_8x;
+    }
+
+    /// Loads 8 consecutive vectors from separate component arrays.
+    /// @param[in]  vectors - The vectors to load from.
+    /// @param[in]  first_vector_index - The index of the first vector to load.
+    /// @return The loaded vectors.
+    SIMD_TARGET_AVX2 Vector3Simd8x BatchTransforms::LoadVectors8x(const Vector3Spans<const float>& vectors, const std::size_t first_vector_index)
+    {
+        Vector3Simd8x vectors_8x;
+        vectors_8x.X = _mm256_loadu_ps(vectors.X.data() + first_vector_index);
+        vectors_8x.Y = _mm256_loadu_ps(vectors.Y.data() + first_vector_index);
+        vectors_8x.Z = _mm256_loadu_ps(vectors.Z.data() + first_vector_index);
+        return vectors_8x;
+    }
+
+    /// Stores 8 consecutive vectors in an array of vectors, interleaving their components.
+    /// @param[in,out]  vectors - The vectors to store into.
+    /// @param[in]  first_vector_index - The index of the first vector to store.
+    /// @param[in]  vectors_8x - The vectors to store.
+    SIMD_TARGET_AVX2 void BatchTransforms::StoreVectors8x(const std::span<Vector3f> vectors, const std::size_t first_vector_index, const Vector3Simd8x& vectors_8x)
+    {
+        // SHUFFLE THE COMPONENTS BACK INTO CONSECUTIVE VECTORS.
+        // This reverses the shuffles for loading vectors.
+        __m256 x_and_y_components = _mm256_shuffle_ps(vectors_8x.X, vectors_8x.Y, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 y_and_z_components = _mm256_shuffle_ps(vectors_8x.Y, vectors_8x.Z, _MM_SHUFFLE(3, 1, 3, 1));
+        __m256 z_and_x_components = _mm256_shuffle_ps(vectors_8x.Z, vectors_8x.X, _MM_SHUFFLE(3, 1, 2, 0));
+        __m256 components_0_to_3_and_12_to_15 = _mm256_shuffle_ps(x_and_y_components, z_and_x_components, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 components_4_to_7_and_16_to_19 = _mm256_shuffle_ps(y_and_z_components, x_and_y_components, _MM_SHUFFLE(3, 1, 2, 0));
+        __m256 components_8_to_11_and_20_to_23 = _mm256_shuffle_ps(z_and_x_components, y_and_z_components, _MM_SHUFFLE(3, 1, 3, 1));
+
+        // STORE THE COMPONENTS.
+        float* components = reinterpret_cast<float*>(vectors.data() + first_vector_index);
+        _mm_storeu_ps(components, _mm256_castps256_ps128(components_0_to_3_and_12_to_15));
+        _mm_storeu_ps(components + 4, _mm256_castps256_ps128(components_4_to_7_and_16_to_19));
+        _mm_storeu_ps(components + 8, _mm256_castps256_ps128(components_8_to_11_and_20_to_23));
+        _mm_storeu_ps(components + 12, _mm256_extractf128_ps(components_0_to_3_and_12_to_15, 1));
+        _mm_storeu_ps(components + 16, _mm256_extractf128_ps(components_4_to_7_and_16_to_19, 1));
+        _mm_storeu_ps(components + 20, _mm256_extractf128_ps(components_8_to_11_and_20_to_23, 1));
+    }
+
+    /// Stores 8 consecutive vectors in separate component arrays.
+    /// @param[in,out]  vectors - The vectors to store into.
+    /// @param[in]  first_vector_index - The index of the first vector to store.
+    /// @param[in]  vectors_8x - The vectors to store.
+    SIMD_TARGET_AVX2 void BatchTransforms::StoreVectors8x(const Vector3Spans<float>& vectors, const std::size_t first_vector_index, const Vector3Simd8x& vectors_8x)
+    {
+        _mm256_storeu_ps(vectors.X.data() + first_vector_index, vectors_8x.X);
+        _mm256_storeu_ps(vectors.Y.data() + first_vector_index, vectors_8x.Y);
+        _mm256_storeu_ps(vectors.Z.data() + first_vector_index, vectors_8x.Z);
+    }
+}
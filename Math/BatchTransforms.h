@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include "Math/Matrix4x4.h"
+#include "Math/Vector3.h"
+#include "Processor/SimdIntrinsics.h"
+
+namespace MATH
+{
+    /// 3D vectors stored as separate arrays for each component (a structure of arrays),
+    /// which allows SIMD code to directly load components of multiple vectors at once.
+    /// All component spans must have the same size.
+    /// @tparam ComponentType - The type of the components, which may be const for read-only vectors.
+    template <typename ComponentType>
+    class Vector3Spans
+    {
+    public:
+        // SPAN OPERATIONS.
+        // These are named like the std::span methods so that code can be generic across vectors stored in either layout.
+        /// Gets the number of vectors.
+        /// @return The number of vectors.
+        std::size_t size() const
+        {
+            return X.size();
+        }
+
+        /// Gets a subset of the vectors.
+        /// @param[in]  offset - The index of the first vector in the subset.
+        /// @param[in]  count - The number of vectors in the subset.
+        /// @return The subset of vectors.
+        Vector3Spans subspan(const std::size_t offset, const std::size_t count) const
+        {
+            return Vector3Spans
+            {
+                .X = X.subspan(offset, count),
+                .Y = Y.subspan(offset, count),
+                .Z = Z.subspan(offset, count),
+            };
+        }
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The x components of the vectors.
+        std::span<ComponentType> X = {};
+        /// The y components of the vectors.
+        std::span<ComponentType> Y = {};
+        /// The z components of the vectors.
+        std::span<ComponentType> Z = {};
+    };
+
+    /// Transforms arrays of many 3D vectors by a single matrix, rather than requiring callers to loop
+    /// through vectors and convert each to a homogeneous 4D vector.
+    ///
+    /// Vectors may be stored either as arrays of Vector3f (an array of structures) or with separate arrays
+    /// for each component (a structure of arrays).  8 vectors at a time are transformed using AVX2 when
+    /// available (see @ref PROCESSOR::CpuFeatures), and very large arrays are split across multiple threads.
+    /// Results exactly match transforming each vector individually with the matrix, and input and output
+    /// arrays may be the same to transform vectors in-place.  Only as many vectors as fit in both the input
+    /// and output are transformed.
+    class BatchTransforms
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The minimum number of vectors transformed by each thread for a transform to be split across threads.
+        /// Fewer vectors are transformed faster than the overhead of starting threads.
+        static constexpr std::size_t PARALLEL_TRANSFORM_MIN_VECTOR_COUNT_PER_THREAD = 128 * 1024;
+
+        // POINT TRANSFORMATION.
+        static void TransformPoints(const Matrix4x4f& transform, const std::span<const Vector3f> points, const std::span<Vector3f> transformed_points);
+        static void TransformPoints(const Matrix4x4f& transform, const Vector3Spans<const float>& points, const Vector3Spans<float>& transformed_points);
+        static void TransformPointsWithPerspectiveDivide(const Matrix4x4f& transform, const std::span<const Vector3f> points, const std::span<Vector3f> transformed_points);
+        static void TransformPointsWithPerspectiveDivide(const Matrix4x4f& transform, const Vector3Spans<const float>& points, const Vector3Spans<float>& transformed_points);
+
+        // DIRECTION TRANSFORMATION.
+        static void TransformDirections(const Matrix4x4f& transform, const std::span<const Vector3f> directions, const std::span<Vector3f> transformed_directions);
+        static void TransformDirections(const Matrix4x4f& transform, const Vector3Spans<const float>& directions, const Vector3Spans<float>& transformed_directions);
+        static void TransformNormals(const Matrix4x4f& transform, const std::span<const Vector3f> unit_normals, const std::span<Vector3f> transformed_unit_normals);
+        static void TransformNormals(const Matrix4x4f& transform, const Vector3Spans<const float>& unit_normals, const Vector3Spans<float>& transformed_unit_normals);
+
+    private:
+        /// The different ways vectors can be transformed.
+        enum class TransformType
+        {
+            /// Positions with an implicit homogeneous w component of 1 (so they're translated).
+            POINT,
+            /// Points divided by their transformed homogeneous w component (as for perspective projections).
+            PROJECTED_POINT,
+            /// Directions with an implicit homogeneous w component of 0 (so they're not translated).
+            DIRECTION,
+            /// Directions that are normalized after being transformed.  The transform is expected
+            /// to already be the inverse transpose of the transform for the corresponding positions.
+            UNIT_NORMAL,
+        };
+
+        // HELPER METHODS.
+        static Matrix4x4f GetNormalTransform(const Matrix4x4f& transform);
+        template <typename InputVectors, typename OutputVectors>
+        static void TransformInParallel(const TransformType transform_type, const Matrix4x4f& transform, const InputVectors& vectors, const OutputVectors& transformed_vectors);
+        template <typename InputVectors, typename OutputVectors>
+        static void TransformSerially(const TransformType transform_type, const Matrix4x4f& transform, const InputVectors& vectors, const OutputVectors& transformed_vectors);
+        template <typename InputVectors, typename OutputVectors>
+        SIMD_TARGET_AVX2 static std::size_t TransformAvx2(const TransformType transform_type, const Matrix4x4f& transform, const InputVectors& vectors, const OutputVectors& transformed_vectors);
+        static Vector3f Transform(const TransformType transform_type, const Matrix4x4f& transform, const Vector3f& vector);
+
+        // VECTOR ACCESS.
+        static Vector3f GetVector(const std::span<const Vector3f> vectors, const std::size_t vector_index);
+        static Vector3f GetVector(const Vector3Spans<const float>& vectors, const std::size_t vector_index);
+        static void SetVector(const std::span<Vector3f> vectors, const std::size_t vector_index, const Vector3f& vector);
+        static void SetVector(const Vector3Spans<float>& vectors, const std::size_t vector_index, const Vector3f& vector);
+        SIMD_TARGET_AVX2 static Vector3Simd8x LoadVectors8x(const std::span<const Vector3f> vectors, const std::size_t first_vector_index);
+        SIMD_TARGET_AVX2 static Vector3Simd8x LoadVectors8x(const Vector3Spans<const float>& vectors, const std::size_t first_vector_index);
+        SIMD_TARGET_AVX2 static void StoreVectors8x(const std::span<Vector3f> vectors, const std::size_t first_vector_index, const Vector3Simd8x& vectors_8x);
+        SIMD_TARGET_AVX2 static void StoreVectors8x(const Vector3Spans<float>& vectors, const std::size_t first_vector_index, const Vector3Simd8x& vectors_8x);
+    };
+}
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <bit>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include "Math/Number.h"
+#include "Math/Vector3.h"
+#include "Processor/SimdIntrinsics.h"
+
+namespace MATH
+{
+    /// Fast approximations of common math functions that trade a small, bounded amount of precision for speed.
+    /// These are intended for places like shading where results are quantized to limited precision colors,
+    /// so the standard library's full precision is more than needed.
+    ///
+    /// Error bounds (verified by tests):
+    /// - ReciprocalSquareRoot() - Relative error of at most 1e-6 (a hardware estimate refined by 1 Newton-Raphson iteration).
+    /// - Log2() - Absolute error of at most 1e-6 * max(1, |log2(number)|) for positive, normal numbers.
+    /// - Exp2() - Relative error of at most 1e-6 for exponents within [-126, 127].
+    /// - Power() - Relative error of at most (1e-6 + 1e-6 * |exponent * log2(base)|), from the errors above.
+    class FastMath
+    {
+    public:
+        // SQUARE ROOTS.
+        static float ReciprocalSquareRoot(const float number);
+        static Vector3f Normalize(const Vector3f& vector);
+        SIMD_TARGET_AVX2 static Vector3Simd8x Normalize(const Vector3Simd8x& vectors);
+
+        // EXPONENTIALS AND LOGARITHMS.
+        static float Log2(const float number);
+        static float Exp2(const float exponent);
+        static float Power(const float base, const float exponent);
+    };
+
+    /// Approximates 1 / sqrt(number).
+    /// @param[in]  number - The positive, normal number to compute the reciprocal square root of.
+    /// @return The approximate reciprocal square root.
+    inline float FastMath::ReciprocalSquareRoot(const float number)
+    {
+        // ESTIMATE THE RECIPROCAL SQUARE ROOT.
+        // The hardware estimate is only accurate to about 12 bits.
+        float estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(number)));
+
+        // REFINE THE ESTIMATE.
+        // A single Newton-Raphson iteration (y * (1.5 - 0.5 * x * y^2)) roughly doubles the number of accurate bits.
+        float refined_estimate = estimate * (1.5f - 0.5f * number * estimate * estimate);
+        return refined_estimate;
+    }
+
+    /// Approximately normalizes a vector to be unit length (length of 1).
+    /// @param[in]  vector - The vector to normalize.
+    /// @return The approximate unit vector in the same direction; a zero vector if the vector's
+    ///     length is zero or too small for its squared length to be a normal float.
+    inline Vector3f FastMath::Normalize(const Vector3f& vector)
+    {
+        // RETURN A ZERO VECTOR IF THE VECTOR IS TOO SHORT TO NORMALIZE.
+        float squared_length = Vector3f::DotProduct(vector, vector);
+        bool vector_too_short = (squared_length < FLT_MIN);
+        if (vector_too_short)
+        {
+            return Vector3f(0.0f, 0.0f, 0.0f);
+        }
+
+        // SCALE THE VECTOR BY ITS RECIPROCAL LENGTH.
+        float reciprocal_length = ReciprocalSquareRoot(squared_length);
+        Vector3f normalized_vector = Vector3f::Scale(reciprocal_length, vector);
+        return normalized_vector;
+    }
+
+    /// Approximately normalizes vectors, exactly matching the non-SIMD approximation.
+    /// @param[in]  vectors - The vectors to normalize.
+    /// @return The approximate unit vectors in the same directions; zero vectors for any vectors
+    ///     whose lengths are zero or too small for their squared lengths to be normal floats.
+    SIMD_TARGET_AVX2 inline Vector3Simd8x FastMath::Normalize(const Vector3Simd8x& vectors)
+    {
+        // ESTIMATE THE RECIPROCAL LENGTHS.
+        // Operations are ordered the same as for the non-SIMD approximation.
+        Simd8xf squared_lengths = Vector3Simd8x::DotProduct(vectors, vectors);
+        Simd8xf estimates = _mm256_rsqrt_ps(squared_lengths);
+        Simd8xf correction_terms = ((Simd8xf(0.5f) * squared_lengths) * estimates) * estimates;
+        Simd8xf reciprocal_lengths = estimates * (Simd8xf(1.5f) - correction_terms);
+
+        // NORMALIZE THE VECTORS.
+        const Simd8xf ZERO = 0.0f;
+        SimdMask<8> vectors_too_short = (squared_lengths < Simd8xf(FLT_MIN));
+        Vector3Simd8x normalized_vectors = Vector3Simd8x::Scale(reciprocal_lengths, vectors);
+        normalized_vectors.X = Simd8xf::Blend(vectors_too_short, normalized_vectors.X, ZERO);
+        normalized_vectors.Y = Simd8xf::Blend(vectors_too_short, normalized_vectors.Y, ZERO);
+        normalized_vectors.Z = Simd8xf::Blend(vectors_too_short, normalized_vectors.Z, ZERO);
+        return normalized_vectors;
+    }
+
+    /// Approximates the base-2 logarithm of a number.
+    /// @param[in]  number - The positive, normal number to compute the logarithm of.
+    /// @return The approximate base-2 logarithm.
+    inline float FastMath::Log2(const float number)
+    {
+        // SPLIT THE NUMBER INTO ITS EXPONENT AND MANTISSA.
+        // The mantissa is then within [1, 2).
+        constexpr uint32_t MANTISSA_BIT_COUNT = 23;
+        constexpr uint32_t MANTISSA_MASK = (1u << MANTISSA_BIT_COUNT) - 1;
+        constexpr uint32_t EXPONENT_MASK = 0xFF;
+        constexpr int32_t EXPONENT_BIAS = 127;
+        uint32_t number_bits = std::bit_cast<uint32_t>(number);
+        int32_t exponent = static_cast<int32_t>((number_bits >> MANTISSA_BIT_COUNT) & EXPONENT_MASK) - EXPONENT_BIAS;
+        uint32_t mantissa_bits = (number_bits & MANTISSA_MASK) | (static_cast<uint32_t>(EXPONENT_BIAS) << MANTISSA_BIT_COUNT);
+        float mantissa = std::bit_cast<float>(mantissa_bits);
+
+        // CENTER THE MANTISSA AROUND 1.
+        // Keeping the mantissa within [sqrt(1/2), sqrt(2)) keeps the series below converging quickly.
+        constexpr float SQUARE_ROOT_OF_2 = 1.41421356f;
+        if (mantissa > SQUARE_ROOT_OF_2)
+        {
+            mantissa *= 0.5f;
+            ++exponent;
+        }
+
+        // APPROXIMATE THE LOGARITHM OF THE MANTISSA.
+        // ln(m) = 2 * (t + t^3/3 + t^5/5 + t^7/7 + ...), where t = (m - 1) / (m + 1).
+        // |t| < 0.172, so the first omitted term contributes less than 1e-7.
+        float t = (mantissa - 1.0f) / (mantissa + 1.0f);
+        float t_squared = t * t;
+        float series = t * (1.0f + t_squared * (1.0f / 3.0f + t_squared * (1.0f / 5.0f + t_squared * (1.0f / 7.0f))));
+        constexpr float TWO_OVER_NATURAL_LOG_OF_2 = 2.88539008f;
+        float mantissa_logarithm = TWO_OVER_NATURAL_LOG_OF_2 * series;
+
+        // COMBINE THE LOGARITHMS OF THE EXPONENT AND MANTISSA.
+        float logarithm = static_cast<float>(exponent) + mantissa_logarithm;
+        return logarithm;
+    }
+
+    /// Approximates 2 raised to an exponent.
+    /// @param[in]  exponent - The exponent.  Clamped to [-126, 127] to keep results within the range of normal floats.
+    /// @return The approximate value of 2 raised to the exponent.
+    inline float FastMath::Exp2(const float exponent)
+    {
+        // SPLIT THE EXPONENT INTO INTEGER AND FRACTIONAL PARTS.
+        // The fractional part is within [-0.5, 0.5].
+        constexpr float MIN_EXPONENT = -126.0f;
+        constexpr float MAX_EXPONENT = 127.0f;
+        float clamped_exponent = Number::Clamp(exponent, MIN_EXPONENT, MAX_EXPONENT);
+        float integer_exponent = std::floor(clamped_exponent + 0.5f);
+        float fractional_exponent = clamped_exponent - integer_exponent;
+
+        // APPROXIMATE 2 RAISED TO THE FRACTIONAL PART.
+        // 2^f = e^(f * ln(2)) = 1 + y + y^2/2! + ... + y^7/7! + ..., where |y| <= 0.347,
+        // so the first omitted term contributes less than 1e-8.
+        constexpr float NATURAL_LOG_OF_2 = 0.693147182f;
+        float y = fractional_exponent * NATURAL_LOG_OF_2;
+        float fractional_power = 1.0f + y * (1.0f + y * (1.0f / 2.0f + y * (1.0f / 6.0f + y * (1.0f / 24.0f +
+            y * (1.0f / 120.0f + y * (1.0f / 720.0f + y * (1.0f / 5040.0f)))))));
+
+        // COMPUTE 2 RAISED TO THE INTEGER PART.
+        // This can be done exactly by directly setting the exponent bits of a float.
+        constexpr uint32_t MANTISSA_BIT_COUNT = 23;
+        constexpr int32_t EXPONENT_BIAS = 127;
+        uint32_t integer_power_bits = static_cast<uint32_t>(static_cast<int32_t>(integer_exponent) + EXPONENT_BIAS) << MANTISSA_BIT_COUNT;
+        float integer_power = std::bit_cast<float>(integer_power_bits);
+
+        // COMBINE THE POWERS.
+        float power = integer_power * fractional_power;
+        return power;
+    }
+
+    /// Approximates a base raised to an exponent.
+    /// @param[in]  base - The non-negative base.
+    /// @param[in]  exponent - The exponent.
+    /// @return The approximate value of the base raised to the exponent.  Like std::pow(),
+    ///     this is 1 for an exponent of 0 and 0 for a base of 0 (and a positive exponent).
+    inline float FastMath::Power(const float base, const float exponent)
+    {
+        // HANDLE SPECIAL CASES THAT LOGARITHMS CAN'T.
+        if (0.0f == exponent)
+        {
+            return 1.0f;
+        }
+        if (base <= 0.0f)
+        {
+            return 0.0f;
+        }
+
+        // COMPUTE THE POWER USING LOGARITHMS.
+        // b^e = 2^(e * log2(b))
+        float power = Exp2(exponent * Log2(base));
+        return power;
+    }
+}
@@ -1,11 +1,14 @@
 #pragma once
 
 #include <array>
-#include <cmath>
-#include "Containers/Array2D.h"
+#include <type_traits>
+#include <utility>
+#include "Containers/FixedSizeArray2D.h"
 #include "Math/Angle.h"
+#include "Math/Number.h"
 #include "Math/Vector3.h"
 #include "Math/Vector4.h"
+#include "Processor/SimdIntrinsics.h"
 
 namespace MATH
 {
@@ -28,27 +31,33 @@ namespace MATH
         static const unsigned int ROW_COUNT = ELEMENT_COUNT_PER_DIMENSION;
 
         // CONSTRUCTION.
-        static Matrix4x4 Identity();
-        static Matrix4x4 Translation(const Vector3<ElementType>& translation_vector);
-        static Matrix4x4 Scale(const Vector3<ElementType>& scale_vector);
-        static Matrix4x4 RotateX(const typename Angle<ElementType>::Radians angle_in_radians);
-        static Matrix4x4 RotateY(const typename Angle<ElementType>::Radians angle_in_radians);
-        static Matrix4x4 RotateZ(const typename Angle<ElementType>::Radians angle_in_radians);
-        static Matrix4x4 Rotation(const Vector3< typename Angle<ElementType>::Radians >& angles_in_radians);
+        static constexpr Matrix4x4 Identity();
+        static constexpr Matrix4x4 Translation(const Vector3<ElementType>& translation_vector);
+        static constexpr Matrix4x4 Scale(const Vector3<ElementType>& scale_vector);
+        static constexpr Matrix4x4 RotateX(const typename Angle<ElementType>::Radians angle_in_radians);
+        static constexpr Matrix4x4 RotateY(const typename Angle<ElementType>::Radians angle_in_radians);
+        static constexpr Matrix4x4 RotateZ(const typename Angle<ElementType>::Radians angle_in_radians);
+        static constexpr Matrix4x4 Rotation(const Vector3< typename Angle<ElementType>::Radians >& angles_in_radians);
+
+        // OTHER OPERATIONS.
+        static constexpr Matrix4x4 Inverse(const Matrix4x4& matrix);
+        static constexpr Matrix4x4 Transpose(const Matrix4x4& matrix);
 
         // OPERATORS.
-        Matrix4x4 operator* (const Matrix4x4& rhs) const;
-        Vector4<ElementType> operator* (const Vector4<ElementType>& vector) const;
+        constexpr Matrix4x4 operator* (const Matrix4x4& rhs) const;
+        constexpr Vector4<ElementType> operator* (const Vector4<ElementType>& vector) const;
 
         // ELEMENT RETRIEVAL.
-        const ElementType* ElementsInRowMajorOrder() const;
+        constexpr const ElementType* ElementsInRowMajorOrder() const;
 
         // ELEMENT SETTING.
-        void SetRow(const unsigned int row_index, const Vector3<ElementType>& vector);
+        constexpr void SetRow(const unsigned int row_index, const Vector3<ElementType>& vector);
 
         // MEMBER VARIABLES.
-        /// The underlying 4x4 array of elements.
-        CONTAINERS::Array2D<ElementType> Elements = CONTAINERS::Array2D<ElementType>(COLUMN_COUNT, ROW_COUNT);
+        /// The underlying 4x4 array of elements.  They're stored inline (rather than on the heap)
+        /// so that matrices can be built and multiplied without memory allocations, and each row
+        /// is aligned so that it can be directly loaded into a SIMD register.
+        CONTAINERS::FixedSizeArray2D<ElementType, COLUMN_COUNT, ROW_COUNT> Elements = CONTAINERS::FixedSizeArray2D<ElementType, COLUMN_COUNT, ROW_COUNT>();
     };
 
     // DEFINE COMMON MATRIX4 TYPES.
@@ -58,12 +67,10 @@ namespace MATH
     /// Creates an identity matrix.
     /// @return An identity matrix.
     template <typename ElementType>
-    Matrix4x4<ElementType> Matrix4x4<ElementType>::Identity()
+    constexpr Matrix4x4<ElementType> Matrix4x4<ElementType>::Identity()
     {
         // CREATE IDENTITY MATRIX ELEMENTS.
-        CONTAINERS::Array2D<ElementType> identity_elements = CONTAINERS::Array2D<ElementType>(
-            COLUMN_COUNT, 
-            ROW_COUNT,
+        CONTAINERS::FixedSizeArray2D<ElementType, COLUMN_COUNT, ROW_COUNT> identity_elements = CONTAINERS::FixedSizeArray2D<ElementType, COLUMN_COUNT, ROW_COUNT>(
             {
                 1, 0, 0, 0,
                 0, 1, 0, 0,
@@ -81,12 +88,10 @@ namespace MATH
     /// @param[in]  translation_vector - The vector defining the translation amount.
     /// @return The translation matrix for the provided vector.
     template <typename ElementType>
-    Matrix4x4<ElementType> Matrix4x4<ElementType>::Translation(const Vector3<ElementType>& translation_vector)
+    constexpr Matrix4x4<ElementType> Matrix4x4<ElementType>::Translation(const Vector3<ElementType>& translation_vector)
     {
         // CREATE TRANSLATION MATRIX ELEMENTS.
-        CONTAINERS::Array2D<ElementType> translation_elements = CONTAINERS::Array2D<ElementType>(
-            COLUMN_COUNT,
-            ROW_COUNT,
+        CONTAINERS::FixedSizeArray2D<ElementType, COLUMN_COUNT, ROW_COUNT> translation_elements = CONTAINERS::FixedSizeArray2D<ElementType, COLUMN_COUNT, ROW_COUNT>(
             {
                 1, 0, 0, translation_vector.X,
                 0, 1, 0, translation_vector.Y,
@@ -104,12 +109,10 @@ namespace MATH
     /// @param[in]  scale_vector - The vector defining the scaling amount.
     /// @return The scale matrix for the provided vector.
     template <typename ElementType>
-    Matrix4x4<ElementType> Matrix4x4<ElementType>::Scale(const Vector3<ElementType>& scale_vector)
+    constexpr Matrix4x4<ElementType> Matrix4x4<ElementType>::Scale(const Vector3<ElementType>& scale_vector)
     {
         // CREATE SCALE MATRIX ELEMENTS.
-        CONTAINERS::Array2D<ElementType> scale_elements = CONTAINERS::Array2D<ElementType>(
-            COLUMN_COUNT,
-            ROW_COUNT,
+        CONTAINERS::FixedSizeArray2D<ElementType, COLUMN_COUNT, ROW_COUNT> scale_elements = CONTAINERS::FixedSizeArray2D<ElementType, COLUMN_COUNT, ROW_COUNT>(
             {
                 scale_vector.X, 0, 0, 0,
                 0, scale_vector.Y, 0, 0,
@@ -127,16 +130,14 @@ namespace MATH
     /// @param[in]  angle_in_radians - The angle in radians to rotate by.
     /// @return The rotation matrix about the X axis.
     template <typename ElementType>
-    Matrix4x4<ElementType> Matrix4x4<ElementType>::RotateX(const typename Angle<ElementType>::Radians angle_in_radians)
+    constexpr Matrix4x4<ElementType> Matrix4x4<ElementType>::RotateX(const typename Angle<ElementType>::Radians angle_in_radians)
     {
         // CREATE ROTATION MATRIX ELEMENTS.
-        CONTAINERS::Array2D<ElementType> rotation_elements = CONTAINERS::Array2D<ElementType>(
-            COLUMN_COUNT,
-            ROW_COUNT,
+        CONTAINERS::FixedSizeArray2D<ElementType, COLUMN_COUNT, ROW_COUNT> rotation_elements = CONTAINERS::FixedSizeArray2D<ElementType, COLUMN_COUNT, ROW_COUNT>(
             {
                 1, 0, 0, 0,
-                0, cos(angle_in_radians.Value), -sin(angle_in_radians.Value), 0,
-                0, sin(angle_in_radians.Value), cos(angle_in_radians.Value), 0,
+                0, Number::Cosine(angle_in_radians.Value), -Number::Sine(angle_in_radians.Value), 0,
+                0, Number::Sine(angle_in_radians.Value), Number::Cosine(angle_in_radians.Value), 0,
                 0, 0, 0, 1
             });
 
@@ -150,16 +151,14 @@ namespace MATH
     /// @param[in]  angle_in_radians - The angle in radians to rotate by.
     /// @return The rotation matrix about the Y axis.
     template <typename ElementType>
-    Matrix4x4<ElementType> Matrix4x4<ElementType>::RotateY(const typename Angle<ElementType>::Radians angle_in_radians)
+    constexpr Matrix4x4<ElementType> Matrix4x4<ElementType>::RotateY(const typename Angle<ElementType>::Radians angle_in_radians)
     {
         // CREATE ROTATION MATRIX ELEMENTS.
-        CONTAINERS::Array2D<ElementType> rotation_elements = CONTAINERS::Array2D<ElementType>(
-            COLUMN_COUNT,
-            ROW_COUNT,
+        CONTAINERS::FixedSizeArray2D<ElementType, COLUMN_COUNT, ROW_COUNT> rotation_elements = CONTAINERS::FixedSizeArray2D<ElementType, COLUMN_COUNT, ROW_COUNT>(
             {
-                cos(angle_in_radians.Value), 0, sin(angle_in_radians.Value), 0,
+                Number::Cosine(angle_in_radians.Value), 0, Number::Sine(angle_in_radians.Value), 0,
                 0, 1, 0, 0,
-                -sin(angle_in_radians.Value), 0, cos(angle_in_radians.Value), 0,
+                -Number::Sine(angle_in_radians.Value), 0, Number::Cosine(angle_in_radians.Value), 0,
                 0, 0, 0, 1
             });
 
@@ -173,15 +172,13 @@ namespace MATH
     /// @param[in]  angle_in_radians - The angle in radians to rotate by.
     /// @return The rotation matrix about the Z axis.
     template <typename ElementType>
-    Matrix4x4<ElementType> Matrix4x4<ElementType>::RotateZ(const typename Angle<ElementType>::Radians angle_in_radians)
+    constexpr Matrix4x4<ElementType> Matrix4x4<ElementType>::RotateZ(const typename Angle<ElementType>::Radians angle_in_radians)
     {
         // CREATE ROTATION MATRIX ELEMENTS.
-        CONTAINERS::Array2D<ElementType> rotation_elements = CONTAINERS::Array2D<ElementType>(
-            COLUMN_COUNT,
-            ROW_COUNT,
+        CONTAINERS::FixedSizeArray2D<ElementType, COLUMN_COUNT, ROW_COUNT> rotation_elements = CONTAINERS::FixedSizeArray2D<ElementType, COLUMN_COUNT, ROW_COUNT>(
             {
-                cos(angle_in_radians.Value), -sin(angle_in_radians.Value), 0, 0,
-                sin(angle_in_radians.Value), cos(angle_in_radians.Value), 0, 0,
+                Number::Cosine(angle_in_radians.Value), -Number::Sine(angle_in_radians.Value), 0, 0,
+                Number::Sine(angle_in_radians.Value), Number::Cosine(angle_in_radians.Value), 0, 0,
                 0, 0, 1, 0,
                 0, 0, 0, 1
             });
@@ -196,7 +193,7 @@ namespace MATH
     /// @param[in]  angles_in_radians - The rotation angles across the 3 primary axes.
     /// @return The specified rotation matrix about the primary axes.
     template <typename ElementType>
-    Matrix4x4<ElementType> Matrix4x4<ElementType>::Rotation(const Vector3< typename Angle<ElementType>::Radians >& angles_in_radians)
+    constexpr Matrix4x4<ElementType> Matrix4x4<ElementType>::Rotation(const Vector3< typename Angle<ElementType>::Radians >& angles_in_radians)
     {
         MATH::Matrix4x4<ElementType> x_rotation_matrix = RotateX(angles_in_radians.X);
         MATH::Matrix4x4<ElementType> y_rotation_matrix = RotateY(angles_in_radians.Y);
@@ -213,14 +210,141 @@ namespace MATH
         return rotation_matrix;
     }
 
+    /// Computes the inverse of a matrix using Gauss-Jordan elimination with partial pivoting.
+    /// @param[in]  matrix - The matrix to invert.
+    /// @return The inverse of the matrix; a matrix of all zeros if the matrix isn't invertible.
+    template <typename ElementType>
+    constexpr Matrix4x4<ElementType> Matrix4x4<ElementType>::Inverse(const Matrix4x4<ElementType>& matrix)
+    {
+        // REDUCE THE MATRIX TO THE IDENTITY WHILE APPLYING THE SAME OPERATIONS TO AN IDENTITY MATRIX.
+        // The elements are copied to local arrays as (row, column) to keep the elimination readable.
+        std::array<std::array<ElementType, COLUMN_COUNT>, ROW_COUNT> remaining_elements;
+        std::array<std::array<ElementType, COLUMN_COUNT>, ROW_COUNT> inverse_elements;
+        for (unsigned int row_index = 0; row_index < ROW_COUNT; ++row_index)
+        {
+            for (unsigned int column_index = 0; column_index < COLUMN_COUNT; ++column_index)
+            {
+                remaining_elements[row_index][column_index] = matrix.Elements(column_index, row_index);
+                inverse_elements[row_index][column_index] = static_cast<ElementType>(row_index == column_index ? 1 : 0);
+            }
+        }
+
+        for (unsigned int pivot_index = 0; pivot_index < ROW_COUNT; ++pivot_index)
+        {
+            // FIND THE ROW WITH THE LARGEST PIVOT.
+            // Using the largest available pivot minimizes error from dividing by small values.
+            unsigned int pivot_row_index = pivot_index;
+            for (unsigned int row_index = pivot_index + 1; row_index < ROW_COUNT; ++row_index)
+            {
+                bool larger_pivot = (Number::AbsoluteValue(remaining_elements[row_index][pivot_index]) > Number::AbsoluteValue(remaining_elements[pivot_row_index][pivot_index]));
+                if (larger_pivot)
+                {
+                    pivot_row_index = row_index;
+                }
+            }
+
+            ElementType pivot = remaining_elements[pivot_row_index][pivot_index];
+            bool matrix_invertible = (pivot != static_cast<ElementType>(0));
+            if (!matrix_invertible)
+            {
+                Matrix4x4<ElementType> zero_matrix;
+                return zero_matrix;
+            }
+            std::swap(remaining_elements[pivot_index], remaining_elements[pivot_row_index]);
+            std::swap(inverse_elements[pivot_index], inverse_elements[pivot_row_index]);
+
+            // SCALE THE PIVOT ROW SO THAT THE PIVOT BECOMES 1.
+            for (unsigned int column_index = 0; column_index < COLUMN_COUNT; ++column_index)
+            {
+                remaining_elements[pivot_index][column_index] /= pivot;
+                inverse_elements[pivot_index][column_index] /= pivot;
+            }
+
+            // ELIMINATE THE PIVOT COLUMN FROM ALL OTHER ROWS.
+            for (unsigned int row_index = 0; row_index < ROW_COUNT; ++row_index)
+            {
+                if (row_index == pivot_index)
+                {
+                    continue;
+                }
+
+                ElementType scale = remaining_elements[row_index][pivot_index];
+                for (unsigned int column_index = 0; column_index < COLUMN_COUNT; ++column_index)
+                {
+                    remaining_elements[row_index][column_index] -= scale * remaining_elements[pivot_index][column_index];
+                    inverse_elements[row_index][column_index] -= scale * inverse_elements[pivot_index][column_index];
+                }
+            }
+        }
+
+        // RETURN THE INVERSE MATRIX.
+        Matrix4x4<ElementType> inverse_matrix;
+        for (unsigned int row_index = 0; row_index < ROW_COUNT; ++row_index)
+        {
+            for (unsigned int column_index = 0; column_index < COLUMN_COUNT; ++column_index)
+            {
+                inverse_matrix.Elements(column_index, row_index) = inverse_elements[row_index][column_index];
+            }
+        }
+        return inverse_matrix;
+    }
+
+    /// Computes the transpose of a matrix (with rows and columns swapped).
+    /// @param[in]  matrix - The matrix to transpose.
+    /// @return The transpose of the matrix.
+    template <typename ElementType>
+    constexpr Matrix4x4<ElementType> Matrix4x4<ElementType>::Transpose(const Matrix4x4<ElementType>& matrix)
+    {
+        Matrix4x4<ElementType> transposed_matrix;
+        for (unsigned int row_index = 0; row_index < ROW_COUNT; ++row_index)
+        {
+            for (unsigned int column_index = 0; column_index < COLUMN_COUNT; ++column_index)
+            {
+                transposed_matrix.Elements(row_index, column_index) = matrix.Elements(column_index, row_index);
+            }
+        }
+        return transposed_matrix;
+    }
+
     /// Multiples this matrix by the provided matrix.
     /// @param[in]  rhs - The matrix to multiply on the right-hand side.
     /// @return The product of the matrix multiplication.
     template <typename ElementType>
-    Matrix4x4<ElementType> Matrix4x4<ElementType>::operator* (const Matrix4x4<ElementType>& rhs) const
+    constexpr Matrix4x4<ElementType> Matrix4x4<ElementType>::operator* (const Matrix4x4<ElementType>& rhs) const
     {
         Matrix4x4<ElementType> matrix_product;
 
+        // COMPUTE THE PRODUCT USING SIMD INSTRUCTIONS IF POSSIBLE.
+        // Each row of a float matrix exactly fits in an SSE register, and SSE is always available on x64,
+        // so no runtime instruction set checks are needed.  Each product row is the sum of the right-hand side's rows
+        // scaled by the left-hand side row's elements, which sums terms in the same order as the non-SIMD
+        // computation below for exactly the same results.
+        if constexpr (std::is_same_v<ElementType, float>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const float* lhs_elements = this->Elements.ValuesInRowMajorOrder();
+                const float* rhs_elements = rhs.Elements.ValuesInRowMajorOrder();
+                float* product_elements = matrix_product.Elements.ValuesInRowMajorOrder();
+
+                __m128 rhs_row_1 = _mm_load_ps(rhs_elements);
+                __m128 rhs_row_2 = _mm_load_ps(rhs_elements + COLUMN_COUNT);
+                __m128 rhs_row_3 = _mm_load_ps(rhs_elements + 2 * COLUMN_COUNT);
+                __m128 rhs_row_4 = _mm_load_ps(rhs_elements + 3 * COLUMN_COUNT);
+                for (unsigned int row_index = 0; row_index < ROW_COUNT; ++row_index)
+                {
+                    const float* lhs_row = lhs_elements + row_index * COLUMN_COUNT;
+                    __m128 product_row = _mm_mul_ps(_mm_set1_ps(lhs_row[0]), rhs_row_1);
+                    product_row = _mm_add_ps(product_row, _mm_mul_ps(_mm_set1_ps(lhs_row[1]), rhs_row_2));
+                    product_row = _mm_add_ps(product_row, _mm_mul_ps(_mm_set1_ps(lhs_row[2]), rhs_row_3));
+                    product_row = _mm_add_ps(product_row, _mm_mul_ps(_mm_set1_ps(lhs_row[3]), rhs_row_4));
+                    _mm_store_ps(product_elements + row_index * COLUMN_COUNT, product_row);
+                }
+
+                return matrix_product;
+            }
+        }
+
         // COMPUTE PRODUCT ELEMENT VALUES FOR EACH ROW.
         for (unsigned int row_index = 0; row_index < ROW_COUNT; ++row_index)
         {
@@ -263,10 +387,39 @@ namespace MATH
     /// @param[in]  vector - The vector to multiply on the right-hand side.
     /// @return The vector transformed by this matrix.
     template <typename ElementType>
-    Vector4<ElementType> Matrix4x4<ElementType>::operator* (const Vector4<ElementType>& vector) const
+    constexpr Vector4<ElementType> Matrix4x4<ElementType>::operator* (const Vector4<ElementType>& vector) const
     {
         Vector4<ElementType> transformed_vector;
 
+        // COMPUTE THE TRANSFORMED VECTOR USING SIMD INSTRUCTIONS IF POSSIBLE.
+        // The transformed vector is the sum of this matrix's columns scaled by the vector's components,
+        // which sums terms in the same order as the non-SIMD computation below for exactly the same results.
+        if constexpr (std::is_same_v<ElementType, float>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const float* elements = this->Elements.ValuesInRowMajorOrder();
+                __m128 column_1 = _mm_load_ps(elements);
+                __m128 column_2 = _mm_load_ps(elements + COLUMN_COUNT);
+                __m128 column_3 = _mm_load_ps(elements + 2 * COLUMN_COUNT);
+                __m128 column_4 = _mm_load_ps(elements + 3 * COLUMN_COUNT);
+                _MM_TRANSPOSE4_PS(column_1, column_2, column_3, column_4);
+
+                __m128 transformed_components = _mm_mul_ps(column_1, _mm_set1_ps(vector.X));
+                transformed_components = _mm_add_ps(transformed_components, _mm_mul_ps(column_2, _mm_set1_ps(vector.Y)));
+                transformed_components = _mm_add_ps(transformed_components, _mm_mul_ps(column_3, _mm_set1_ps(vector.Z)));
+                transformed_components = _mm_add_ps(transformed_components, _mm_mul_ps(column_4, _mm_set1_ps(vector.W)));
+
+                alignas(16) float transformed_component_values[ELEMENT_COUNT_PER_DIMENSION];
+                _mm_store_ps(transformed_component_values, transformed_components);
+                transformed_vector.X = transformed_component_values[0];
+                transformed_vector.Y = transformed_component_values[1];
+                transformed_vector.Z = transformed_component_values[2];
+                transformed_vector.W = transformed_component_values[3];
+                return transformed_vector;
+            }
+        }
+
         // CALCULATE THE X COMPONENT OF THE VECTOR.
         const unsigned int ROW_1 = 0;
         const unsigned int COLUMN_1 = 0;
@@ -310,7 +463,7 @@ namespace MATH
     /// (each row's values before the next row).
     /// @return The element values in row-major order.
     template <typename ElementType>
-    const ElementType* Matrix4x4<ElementType>::ElementsInRowMajorOrder() const
+    constexpr const ElementType* Matrix4x4<ElementType>::ElementsInRowMajorOrder() const
     {
         return Elements.ValuesInRowMajorOrder();
     }
@@ -319,7 +472,7 @@ namespace MATH
     /// The 4th element is left unchanged.
     /// @param[in]  vector - The values for the 1st 3 elements in the row.
     template <typename ElementType>
-    void Matrix4x4<ElementType>::SetRow(const unsigned int row_index, const Vector3<ElementType>& vector)
+    constexpr void Matrix4x4<ElementType>::SetRow(const unsigned int row_index, const Vector3<ElementType>& vector)
     {
         // SET THE FIRST 3 ELEMENTS IN THE ROW.
         // X, Y, and Z ordering is based on intuitive understanding.
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <type_traits>
+
 namespace MATH
 {
     /// Utilities for working with numbers.
@@ -21,6 +26,15 @@ namespace MATH
             const NumericType number_to_clamp,
             const NumericType min_value,
             const NumericType max_value);
+
+        template <typename NumericType>
+        constexpr static NumericType AbsoluteValue(const NumericType number);
+        template <typename NumericType>
+        constexpr static NumericType SquareRoot(const NumericType number);
+        template <typename FloatingPointType>
+        constexpr static FloatingPointType Sine(const FloatingPointType angle_in_radians);
+        template <typename FloatingPointType>
+        constexpr static FloatingPointType Cosine(const FloatingPointType angle_in_radians);
     };
 
     /// Determines if a number is even.
@@ -131,4 +145,177 @@ namespace MATH
         // RETURN THE NUMBER SINCE IT'S ALREADY CLAMPED WITHIN THE RANGE.
         return number_to_clamp;
     }
+
+    /// Computes the absolute value of a number.
+    /// Unlike std::abs, this can be used in constant expressions.
+    /// @tparam NumericType - The type of the number.
+    /// @param[in]  number - The number to get the absolute value of.
+    /// @return The absolute value of the number.
+    template <typename NumericType>
+    constexpr NumericType Number::AbsoluteValue(const NumericType number)
+    {
+        bool number_negative = (number < static_cast<NumericType>(0));
+        if (number_negative)
+        {
+            return -number;
+        }
+
+        return number;
+    }
+
+    /// Computes the square root of a number.  At runtime, this is exactly std::sqrt.
+    /// In constant expressions, Newton's method is used with double precision,
+    /// which may differ from std::sqrt in the last bit for double results.
+    /// @tparam NumericType - The type of the number.
+    /// @param[in]  number - The non-negative number to get the square root of.
+    /// @return The square root of the number; NaN for negative floating-point numbers.
+    template <typename NumericType>
+    constexpr NumericType Number::SquareRoot(const NumericType number)
+    {
+        // USE THE STANDARD LIBRARY AT RUNTIME.
+        // It's faster and keeps results identical to any other code using std::sqrt.
+        if (!std::is_constant_evaluated())
+        {
+            return static_cast<NumericType>(std::sqrt(number));
+        }
+
+        // HANDLE NUMBERS THAT ARE THEIR OWN SQUARE ROOT.
+        double value = static_cast<double>(number);
+        bool value_negative = (value < 0.0);
+        if (value_negative)
+        {
+            return std::numeric_limits<NumericType>::quiet_NaN();
+        }
+        bool value_zero_infinite_or_nan = (0.0 == value) || (value > std::numeric_limits<double>::max()) || (value != value);
+        if (value_zero_infinite_or_nan)
+        {
+            return number;
+        }
+
+        // REFINE AN ESTIMATE UNTIL IT STOPS DECREASING.
+        // Starting from an estimate no smaller than the square root means each Newton iteration
+        // decreases the estimate until it converges, so the loop is guaranteed to end.
+        double square_root = (value > 1.0) ? value : 1.0;
+        while (true)
+        {
+            double next_square_root = 0.5 * (square_root + value / square_root);
+            bool estimate_converged = (next_square_root >= square_root);
+            if (estimate_converged)
+            {
+                break;
+            }
+            square_root = next_square_root;
+        }
+        return static_cast<NumericType>(square_root);
+    }
+
+    /// Computes the sine of an angle.  At runtime, this is exactly std::sin.
+    /// In constant expressions, a Taylor series is used with double precision, which is accurate
+    /// to within a few units in the last place of a double for angles within about +/- 1e6 radians.
+    /// @tparam FloatingPointType - The floating-point type of the angle.
+    /// @param[in]  angle_in_radians - The angle to get the sine of.
+    /// @return The sine of the angle.
+    template <typename FloatingPointType>
+    constexpr FloatingPointType Number::Sine(const FloatingPointType angle_in_radians)
+    {
+        // USE THE STANDARD LIBRARY AT RUNTIME.
+        // It's faster and keeps results identical to any other code using std::sin.
+        if (!std::is_constant_evaluated())
+        {
+            return std::sin(angle_in_radians);
+        }
+
+        // REDUCE THE ANGLE TO WITHIN A SINGLE TURN CENTERED ON ZERO.
+        constexpr double PI = std::numbers::pi;
+        constexpr double FULL_TURN_IN_RADIANS = 2.0 * PI;
+        double angle = static_cast<double>(angle_in_radians);
+        double turn_count = angle / FULL_TURN_IN_RADIANS;
+        double nearest_whole_turn_count = static_cast<double>(static_cast<long long>(turn_count + ((turn_count < 0.0) ? -0.5 : 0.5)));
+        angle -= nearest_whole_turn_count * FULL_TURN_IN_RADIANS;
+
+        // REFLECT THE ANGLE TO WITHIN A QUARTER TURN OF ZERO.
+        // Since sin(pi - x) = sin(x), this keeps the series below converging quickly.
+        constexpr double HALF_PI = PI / 2.0;
+        if (angle > HALF_PI)
+        {
+            angle = PI - angle;
+        }
+        else if (angle < -HALF_PI)
+        {
+            angle = -PI - angle;
+        }
+
+        // SUM THE TAYLOR SERIES UNTIL ADDITIONAL TERMS NO LONGER CHANGE THE RESULT.
+        // sin(x) = x - x^3/3! + x^5/5! - x^7/7! + ...
+        double squared_angle = angle * angle;
+        double term = angle;
+        double sine = angle;
+        for (int term_index = 1; ; ++term_index)
+        {
+            double current_factorial_factors = static_cast<double>((2 * term_index) * (2 * term_index + 1));
+            term *= -squared_angle / current_factorial_factors;
+            double next_sine = sine + term;
+            bool series_converged = (next_sine == sine);
+            if (series_converged)
+            {
+                break;
+            }
+            sine = next_sine;
+        }
+        return static_cast<FloatingPointType>(sine);
+    }
+
+    /// Computes the cosine of an angle.  At runtime, this is exactly std::cos.
+    /// In constant expressions, this has the same accuracy as Sine().
+    /// @tparam FloatingPointType - The floating-point type of the angle.
+    /// @param[in]  angle_in_radians - The angle to get the cosine of.
+    /// @return The cosine of the angle.
+    template <typename FloatingPointType>
+    constexpr FloatingPointType Number::Cosine(const FloatingPointType angle_in_radians)
+    {
+        // USE THE STANDARD LIBRARY AT RUNTIME.
+        // It's faster and keeps results identical to any other code using std::cos.
+        if (!std::is_constant_evaluated())
+        {
+            return std::cos(angle_in_radians);
+        }
+
+        // REDUCE THE ANGLE TO WITHIN HALF A TURN OF ZERO.
+        // Since cos(-x) = cos(x), only the magnitude of the reduced angle matters.
+        constexpr double PI = std::numbers::pi;
+        constexpr double FULL_TURN_IN_RADIANS = 2.0 * PI;
+        double angle = static_cast<double>(angle_in_radians);
+        double turn_count = angle / FULL_TURN_IN_RADIANS;
+        double nearest_whole_turn_count = static_cast<double>(static_cast<long long>(turn_count + ((turn_count < 0.0) ? -0.5 : 0.5)));
+        angle = AbsoluteValue(angle - nearest_whole_turn_count * FULL_TURN_IN_RADIANS);
+
+        // REFLECT THE ANGLE TO WITHIN A QUARTER TURN OF ZERO.
+        // Since cos(pi - x) = -cos(x), this keeps the series below converging quickly.
+        constexpr double HALF_PI = PI / 2.0;
+        double sign = 1.0;
+        if (angle > HALF_PI)
+        {
+            angle = PI - angle;
+            sign = -1.0;
+        }
+
+        // SUM THE TAYLOR SERIES UNTIL ADDITIONAL TERMS NO LONGER CHANGE THE RESULT.
+        // cos(x) = 1 - x^2/2! + x^4/4! - x^6/6! + ...
+        double squared_angle = angle * angle;
+        double term = 1.0;
+        double cosine = 1.0;
+        for (int term_index = 1; ; ++term_index)
+        {
+            double current_factorial_factors = static_cast<double>((2 * term_index - 1) * (2 * term_index));
+            term *= -squared_angle / current_factorial_factors;
+            double next_cosine = cosine + term;
+            bool series_converged = (next_cosine == cosine);
+            if (series_converged)
+            {
+                break;
+            }
+            cosine = next_cosine;
+        }
+        return static_cast<FloatingPointType>(sign * cosine);
+    }
 }
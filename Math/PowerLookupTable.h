@@ -0,0 +1,70 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include "Math/Number.h"
+
+namespace MATH
+{
+    /// A table of precomputed powers for bases within [0, 1] and a single exponent.
+    /// Powers are approximated by linearly interpolating between table entries, which is much
+    /// faster than computing powers directly (such as when shading specular highlights).
+    ///
+    /// For exponents of at least 2, the error is at most exponent * (exponent - 1) / (8 * SEGMENT_COUNT^2)
+    /// (the bound for linear interpolation from the maximum second derivative, which occurs at a base of 1).
+    /// For exponents between 0 and 1, errors are largest near a base of 0 where powers change most rapidly.
+    class PowerLookupTable
+    {
+    public:
+        // CONSTANTS.
+        /// The number of evenly spaced segments between table entries.
+        static constexpr std::size_t SEGMENT_COUNT = 1024;
+
+        // CONSTRUCTION.
+        explicit PowerLookupTable(const float exponent);
+
+        // POWERS.
+        float Power(const float base) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The exponent that the table has powers for.
+        float Exponent = 1.0f;
+        /// The powers for evenly spaced bases from 0 to 1 (inclusive).
+        std::array<float, SEGMENT_COUNT + 1> Powers = {};
+    };
+
+    /// Precomputes a table of powers for the specified exponent.
+    /// @param[in]  exponent - The exponent to precompute powers for.
+    inline PowerLookupTable::PowerLookupTable(const float exponent) :
+        Exponent(exponent)
+    {
+        for (std::size_t entry_index = 0; entry_index <= SEGMENT_COUNT; ++entry_index)
+        {
+            float base = static_cast<float>(entry_index) / static_cast<float>(SEGMENT_COUNT);
+            Powers[entry_index] = std::pow(base, exponent);
+        }
+    }
+
+    /// Approximates a base raised to the table's exponent.
+    /// @param[in]  base - The base.  Clamped to [0, 1].
+    /// @return The approximate value of the base raised to the table's exponent.
+    inline float PowerLookupTable::Power(const float base) const
+    {
+        // FIND THE SEGMENT CONTAINING THE BASE.
+        // The last segment also contains a base of exactly 1.
+        constexpr float MIN_BASE = 0.0f;
+        constexpr float MAX_BASE = 1.0f;
+        float clamped_base = Number::Clamp(base, MIN_BASE, MAX_BASE);
+        float scaled_base = clamped_base * static_cast<float>(SEGMENT_COUNT);
+        std::size_t segment_index = std::min(static_cast<std::size_t>(scaled_base), SEGMENT_COUNT - 1);
+
+        // INTERPOLATE BETWEEN THE POWERS AT THE ENDS OF THE SEGMENT.
+        float segment_fraction = scaled_base - static_cast<float>(segment_index);
+        float segment_start_power = Powers[segment_index];
+        float segment_end_power = Powers[segment_index + 1];
+        float power = segment_start_power + segment_fraction * (segment_end_power - segment_start_power);
+        return power;
+    }
+}
@@ -0,0 +1,203 @@
+#pragma once
+
+#include "Math/Angle.h"
+#include "Math/Number.h"
+#include "Math/Vector3.h"
+
+namespace MATH
+{
+    /// A quaternion, primarily intended for representing rotations in 3D space.
+    /// Unit quaternions represent rotations more compactly than rotation matrices (4 components rather than 9)
+    /// and can be composed with fewer operations than rotation matrices.
+    ///
+    /// The ComponentType template parameter is intended to be replaced with
+    /// any floating-point type (float, double, etc.).
+    template <typename ComponentType>
+    class Quaternion
+    {
+    public:
+        // CONSTRUCTION.
+        static constexpr Quaternion Identity();
+        static constexpr Quaternion FromAxisAngle(const Vector3<ComponentType>& unit_axis, const typename Angle<ComponentType>::Radians angle_in_radians);
+        static constexpr Quaternion FromEulerAngles(const Vector3< typename Angle<ComponentType>::Radians >& angles_in_radians);
+
+        // OTHER OPERATIONS.
+        static constexpr Quaternion Normalize(const Quaternion& quaternion);
+        static constexpr Quaternion Conjugate(const Quaternion& quaternion);
+        static constexpr ComponentType DotProduct(const Quaternion& quaternion_1, const Quaternion& quaternion_2);
+
+        // OPERATORS.
+        constexpr bool operator== (const Quaternion& rhs) const;
+        constexpr bool operator!= (const Quaternion& rhs) const;
+        constexpr Quaternion operator* (const Quaternion& rhs) const;
+
+        // ROTATION.
+        constexpr Vector3<ComponentType> Rotate(const Vector3<ComponentType>& vector) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The real (scalar) component.  Defaults to the identity rotation.
+        ComponentType W = static_cast<ComponentType>(1);
+        /// The x component of the imaginary (vector) part.
+        ComponentType X = static_cast<ComponentType>(0);
+        /// The y component of the imaginary (vector) part.
+        ComponentType Y = static_cast<ComponentType>(0);
+        /// The z component of the imaginary (vector) part.
+        ComponentType Z = static_cast<ComponentType>(0);
+    };
+
+    // DEFINE COMMON QUATERNION TYPES.
+    /// A quaternion composed of 4 float components.
+    typedef Quaternion<float> Quaternionf;
+
+    /// Creates a quaternion representing no rotation.
+    /// @return The identity quaternion.
+    template <typename ComponentType>
+    constexpr Quaternion<ComponentType> Quaternion<ComponentType>::Identity()
+    {
+        Quaternion<ComponentType> identity;
+        return identity;
+    }
+
+    /// Creates a quaternion representing a rotation about an axis.
+    /// @param[in]  unit_axis - The unit vector for the axis to rotate about.
+    /// @param[in]  angle_in_radians - The angle to rotate by, counterclockwise when looking down the axis towards the origin.
+    /// @return The unit quaternion for the rotation.
+    template <typename ComponentType>
+    constexpr Quaternion<ComponentType> Quaternion<ComponentType>::FromAxisAngle(const Vector3<ComponentType>& unit_axis, const typename Angle<ComponentType>::Radians angle_in_radians)
+    {
+        ComponentType half_angle = angle_in_radians.Value / static_cast<ComponentType>(2);
+        ComponentType sine_of_half_angle = Number::Sine(half_angle);
+
+        Quaternion<ComponentType> quaternion;
+        quaternion.W = Number::Cosine(half_angle);
+        quaternion.X = sine_of_half_angle * unit_axis.X;
+        quaternion.Y = sine_of_half_angle * unit_axis.Y;
+        quaternion.Z = sine_of_half_angle * unit_axis.Z;
+        return quaternion;
+    }
+
+    /// Creates a quaternion representing rotations about the 3 primary axes.
+    /// Rotations are applied in the same order as Matrix4x4::Rotation() (about x, then y, then z).
+    /// @param[in]  angles_in_radians - The rotation angles across the 3 primary axes.
+    /// @return The unit quaternion for the rotations.
+    template <typename ComponentType>
+    constexpr Quaternion<ComponentType> Quaternion<ComponentType>::FromEulerAngles(const Vector3< typename Angle<ComponentType>::Radians >& angles_in_radians)
+    {
+        constexpr ComponentType ZERO = static_cast<ComponentType>(0);
+        constexpr ComponentType ONE = static_cast<ComponentType>(1);
+        Quaternion<ComponentType> x_rotation = FromAxisAngle(Vector3<ComponentType>(ONE, ZERO, ZERO), angles_in_radians.X);
+        Quaternion<ComponentType> y_rotation = FromAxisAngle(Vector3<ComponentType>(ZERO, ONE, ZERO), angles_in_radians.Y);
+        Quaternion<ComponentType> z_rotation = FromAxisAngle(Vector3<ComponentType>(ZERO, ZERO, ONE), angles_in_radians.Z);
+
+        Quaternion<ComponentType> rotation = z_rotation * y_rotation * x_rotation;
+        return rotation;
+    }
+
+    /// Normalizes a quaternion to be unit length, which is required for it to represent a rotation.
+    /// Composing many rotations can accumulate error, so quaternions may need to be periodically re-normalized.
+    /// @param[in]  quaternion - The quaternion to normalize.
+    /// @return The unit quaternion; the identity quaternion if the quaternion has zero length.
+    template <typename ComponentType>
+    constexpr Quaternion<ComponentType> Quaternion<ComponentType>::Normalize(const Quaternion<ComponentType>& quaternion)
+    {
+        // PREVENT DIVISION BY ZERO.
+        ComponentType length = Number::SquareRoot(DotProduct(quaternion, quaternion));
+        constexpr ComponentType ZERO = static_cast<ComponentType>(0);
+        if (ZERO == length)
+        {
+            return Identity();
+        }
+
+        // NORMALIZE THE QUATERNION.
+        Quaternion<ComponentType> normalized_quaternion;
+        normalized_quaternion.W = quaternion.W / length;
+        normalized_quaternion.X = quaternion.X / length;
+        normalized_quaternion.Y = quaternion.Y / length;
+        normalized_quaternion.Z = quaternion.Z / length;
+        return normalized_quaternion;
+    }
+
+    /// Computes the conjugate of a quaternion, which is the inverse rotation for unit quaternions.
+    /// @param[in]  quaternion - The quaternion to compute the conjugate of.
+    /// @return The conjugate of the quaternion.
+    template <typename ComponentType>
+    constexpr Quaternion<ComponentType> Quaternion<ComponentType>::Conjugate(const Quaternion<ComponentType>& quaternion)
+    {
+        Quaternion<ComponentType> conjugate;
+        conjugate.W = quaternion.W;
+        conjugate.X = -quaternion.X;
+        conjugate.Y = -quaternion.Y;
+        conjugate.Z = -quaternion.Z;
+        return conjugate;
+    }
+
+    /// Computes the dot product of two quaternions as if they were 4D vectors.
+    /// @param[in]  quaternion_1 - The first quaternion in the dot product.
+    /// @param[in]  quaternion_2 - The second quaternion in the dot product.
+    /// @return The dot product of the quaternions.
+    template <typename ComponentType>
+    constexpr ComponentType Quaternion<ComponentType>::DotProduct(const Quaternion<ComponentType>& quaternion_1, const Quaternion<ComponentType>& quaternion_2)
+    {
+        ComponentType dot_product = (
+            (quaternion_1.W * quaternion_2.W) +
+            (quaternion_1.X * quaternion_2.X) +
+            (quaternion_1.Y * quaternion_2.Y) +
+            (quaternion_1.Z * quaternion_2.Z));
+        return dot_product;
+    }
+
+    /// Equality operator.  Direct equality comparison is used for components, so the same
+    /// rotation represented by negated components is not considered equal.
+    /// @param[in]  rhs - The quaternion on the right-hand side of the operator.
+    /// @return True if this quaternion equals the provided quaternion; false otherwise.
+    template <typename ComponentType>
+    constexpr bool Quaternion<ComponentType>::operator== (const Quaternion<ComponentType>& rhs) const
+    {
+        bool quaternions_equal = (
+            (W == rhs.W) &&
+            (X == rhs.X) &&
+            (Y == rhs.Y) &&
+            (Z == rhs.Z));
+        return quaternions_equal;
+    }
+
+    /// Inequality operator.
+    /// @param[in]  rhs - The quaternion on the right-hand side of the operator.
+    /// @return True if this quaternion does not equal the provided quaternion; false otherwise.
+    template <typename ComponentType>
+    constexpr bool Quaternion<ComponentType>::operator!= (const Quaternion<ComponentType>& rhs) const
+    {
+        bool quaternions_equal = ((*this) == rhs);
+        return !quaternions_equal;
+    }
+
+    /// Multiplies two quaternions (the Hamilton product).  For rotations, the result
+    /// applies the right-hand side rotation first and then this rotation, like matrix multiplication.
+    /// @param[in]  rhs - The quaternion on the right-hand side of the operator.
+    /// @return The product of the quaternions.
+    template <typename ComponentType>
+    constexpr Quaternion<ComponentType> Quaternion<ComponentType>::operator* (const Quaternion<ComponentType>& rhs) const
+    {
+        Quaternion<ComponentType> product;
+        product.W = (W * rhs.W) - (X * rhs.X) - (Y * rhs.Y) - (Z * rhs.Z);
+        product.X = (W * rhs.X) + (X * rhs.W) + (Y * rhs.Z) - (Z * rhs.Y);
+        product.Y = (W * rhs.Y) - (X * rhs.Z) + (Y * rhs.W) + (Z * rhs.X);
+        product.Z = (W * rhs.Z) + (X * rhs.Y) - (Y * rhs.X) + (Z * rhs.W);
+        return product;
+    }
+
+    /// Rotates a vector by this quaternion, which must be a unit quaternion.
+    /// @param[in]  vector - The vector to rotate.
+    /// @return The rotated vector.
+    template <typename ComponentType>
+    constexpr Vector3<ComponentType> Quaternion<ComponentType>::Rotate(const Vector3<ComponentType>& vector) const
+    {
+        // ROTATE THE VECTOR.
+        // This expands q * v * conjugate(q) to v + 2w(u x v) + 2u x (u x v) for the vector part u,
+        // which avoids computing the unused real component.
+        Vector3<ComponentType> imaginary_part(X, Y, Z);
+        Vector3<ComponentType> doubled_cross_product = Vector3<ComponentType>::Scale(static_cast<ComponentType>(2), Vector3<ComponentType>::CrossProduct(imaginary_part, vector));
+        Vector3<ComponentType> rotated_vector = vector + Vector3<ComponentType>::Scale(W, doubled_cross_product) + Vector3<ComponentType>::CrossProduct(imaginary_part, doubled_cross_product);
+        return rotated_vector;
+    }
+}
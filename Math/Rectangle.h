@@ -0,0 +1,186 @@
+#pragma once
+
+#include <algorithm>
+
+namespace MATH
+{
+    /// An axis-aligned 2D rectangle, such as a region of pixels in an image.
+    /// Coordinates increase rightward and downward, and the right and bottom edges are exclusive.
+    ///
+    /// The CoordinateType template parameter is intended to be replaced with
+    /// any numerical type that is typically used for coordinates (int, float, etc.).
+    template <typename CoordinateType>
+    class Rectangle
+    {
+    public:
+        // STATIC METHODS.
+        static Rectangle FromLeftTopAndDimensions(
+            const CoordinateType left_x,
+            const CoordinateType top_y,
+            const CoordinateType width,
+            const CoordinateType height);
+        static Rectangle Union(const Rectangle& rectangle_1, const Rectangle& rectangle_2);
+        static Rectangle Intersection(const Rectangle& rectangle_1, const Rectangle& rectangle_2);
+
+        // OPERATORS.
+        bool operator==(const Rectangle& rhs) const = default;
+
+        // DIMENSIONS.
+        CoordinateType RightX() const;
+        CoordinateType BottomY() const;
+        CoordinateType Area() const;
+        bool IsEmpty() const;
+
+        // OTHER OPERATIONS.
+        bool Contains(const Rectangle& other_rectangle) const;
+        bool Intersects(const Rectangle& other_rectangle) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The x coordinate of the left edge.
+        CoordinateType LeftX = 0;
+        /// The y coordinate of the top edge.
+        CoordinateType TopY = 0;
+        /// The width of the rectangle.
+        CoordinateType Width = 0;
+        /// The height of the rectangle.
+        CoordinateType Height = 0;
+    };
+
+    // DEFINE COMMON RECTANGLE TYPES.
+    /// A rectangle with unsigned integer coordinates.
+    typedef Rectangle<unsigned int> Rectangleui;
+    /// A rectangle with float coordinates.
+    typedef Rectangle<float> Rectanglef;
+
+    /// Creates a rectangle from its top-left corner and dimensions.
+    /// @param[in]  left_x - The x coordinate of the left edge.
+    /// @param[in]  top_y - The y coordinate of the top edge.
+    /// @param[in]  width - The width of the rectangle.
+    /// @param[in]  height - The height of the rectangle.
+    /// @return The rectangle.
+    template <typename CoordinateType>
+    Rectangle<CoordinateType> Rectangle<CoordinateType>::FromLeftTopAndDimensions(
+        const CoordinateType left_x,
+        const CoordinateType top_y,
+        const CoordinateType width,
+        const CoordinateType height)
+    {
+        Rectangle<CoordinateType> rectangle;
+        rectangle.LeftX = left_x;
+        rectangle.TopY = top_y;
+        rectangle.Width = width;
+        rectangle.Height = height;
+        return rectangle;
+    }
+
+    /// Computes the smallest rectangle containing both rectangles.
+    /// Empty rectangles are ignored.
+    /// @param[in]  rectangle_1 - One rectangle to include.
+    /// @param[in]  rectangle_2 - Another rectangle to include.
+    /// @return The bounding rectangle of both rectangles.
+    template <typename CoordinateType>
+    Rectangle<CoordinateType> Rectangle<CoordinateType>::Union(const Rectangle<CoordinateType>& rectangle_1, const Rectangle<CoordinateType>& rectangle_2)
+    {
+        // HANDLE EMPTY RECTANGLES.
+        if (rectangle_1.IsEmpty())
+        {
+            return rectangle_2;
+        }
+        else if (rectangle_2.IsEmpty())
+        {
+            return rectangle_1;
+        }
+
+        // COMPUTE THE BOUNDS OF BOTH RECTANGLES.
+        CoordinateType left_x = std::min(rectangle_1.LeftX, rectangle_2.LeftX);
+        CoordinateType top_y = std::min(rectangle_1.TopY, rectangle_2.TopY);
+        CoordinateType right_x = std::max(rectangle_1.RightX(), rectangle_2.RightX());
+        CoordinateType bottom_y = std::max(rectangle_1.BottomY(), rectangle_2.BottomY());
+        return FromLeftTopAndDimensions(left_x, top_y, right_x - left_x, bottom_y - top_y);
+    }
+
+    /// Computes the overlapping area of two rectangles.
+    /// @param[in]  rectangle_1 - One rectangle to intersect.
+    /// @param[in]  rectangle_2 - Another rectangle to intersect.
+    /// @return The intersection of the rectangles; an empty rectangle if they don't overlap.
+    template <typename CoordinateType>
+    Rectangle<CoordinateType> Rectangle<CoordinateType>::Intersection(const Rectangle<CoordinateType>& rectangle_1, const Rectangle<CoordinateType>& rectangle_2)
+    {
+        // CHECK IF THE RECTANGLES OVERLAP.
+        if (!rectangle_1.Intersects(rectangle_2))
+        {
+            return Rectangle<CoordinateType>();
+        }
+
+        // COMPUTE THE OVERLAPPING BOUNDS.
+        CoordinateType left_x = std::max(rectangle_1.LeftX, rectangle_2.LeftX);
+        CoordinateType top_y = std::max(rectangle_1.TopY, rectangle_2.TopY);
+        CoordinateType right_x = std::min(rectangle_1.RightX(), rectangle_2.RightX());
+        CoordinateType bottom_y = std::min(rectangle_1.BottomY(), rectangle_2.BottomY());
+        return FromLeftTopAndDimensions(left_x, top_y, right_x - left_x, bottom_y - top_y);
+    }
+
+    /// Gets the x coordinate of the right edge.
+    /// @return The exclusive right x coordinate.
+    template <typename CoordinateType>
+    CoordinateType Rectangle<CoordinateType>::RightX() const
+    {
+        return LeftX + Width;
+    }
+
+    /// Gets the y coordinate of the bottom edge.
+    /// @return The exclusive bottom y coordinate.
+    template <typename CoordinateType>
+    CoordinateType Rectangle<CoordinateType>::BottomY() const
+    {
+        return TopY + Height;
+    }
+
+    /// Gets the area of the rectangle.
+    /// @return The area of the rectangle.
+    template <typename CoordinateType>
+    CoordinateType Rectangle<CoordinateType>::Area() const
+    {
+        return Width * Height;
+    }
+
+    /// Determines if the rectangle covers no area.
+    /// @return True if the rectangle is empty; false if not.
+    template <typename CoordinateType>
+    bool Rectangle<CoordinateType>::IsEmpty() const
+    {
+        bool empty = (Width <= 0 || Height <= 0);
+        return empty;
+    }
+
+    /// Determines if another rectangle is entirely within this rectangle.
+    /// @param[in]  other_rectangle - The other rectangle to check.
+    /// @return True if the other rectangle is contained within this rectangle; false if not.
+    template <typename CoordinateType>
+    bool Rectangle<CoordinateType>::Contains(const Rectangle<CoordinateType>& other_rectangle) const
+    {
+        bool contains_other_rectangle = (
+            LeftX <= other_rectangle.LeftX &&
+            TopY <= other_rectangle.TopY &&
+            other_rectangle.RightX() <= RightX() &&
+            other_rectangle.BottomY() <= BottomY());
+        return contains_other_rectangle;
+    }
+
+    /// Determines if another rectangle overlaps this rectangle.
+    /// Rectangles that only share an edge don't overlap, and empty rectangles never overlap anything.
+    /// @param[in]  other_rectangle - The other rectangle to check.
+    /// @return True if the rectangles overlap; false if not.
+    template <typename CoordinateType>
+    bool Rectangle<CoordinateType>::Intersects(const Rectangle<CoordinateType>& other_rectangle) const
+    {
+        bool rectangles_overlap = (
+            !IsEmpty() &&
+            !other_rectangle.IsEmpty() &&
+            LeftX < other_rectangle.RightX() &&
+            other_rectangle.LeftX < RightX() &&
+            TopY < other_rectangle.BottomY() &&
+            other_rectangle.TopY < BottomY());
+        return rectangles_overlap;
+    }
+}
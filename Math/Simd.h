@@ -0,0 +1,538 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include "Processor/SimdInstructionSet.h"
+#include "Processor/SimdIntrinsics.h"
+
+namespace MATH
+{
+    /// Gets the number of 32-bit lanes in the SIMD registers of an instruction set.
+    /// Kernels written against @ref Simd can be instantiated with this lane count
+    /// to use the widest registers that the instruction set supports.
+    /// @param[in]  instruction_set - The instruction set for which to get the lane count.
+    /// @return The number of 32-bit lanes for the instruction set.
+    constexpr std::size_t SimdLaneCount(const PROCESSOR::SimdInstructionSet instruction_set)
+    {
+        switch (instruction_set)
+        {
+            case PROCESSOR::SimdInstructionSet::SSE4:
+                return 4;
+            case PROCESSOR::SimdInstructionSet::AVX2:
+                return 8;
+            case PROCESSOR::SimdInstructionSet::AVX512:
+                return 16;
+            case PROCESSOR::SimdInstructionSet::SCALAR:
+            default:
+                return 1;
+        }
+    }
+
+    /// A mask of lanes for which a comparison between SIMD values held true.
+    /// @tparam LANE_COUNT - The number of lanes in the mask.
+    template <std::size_t LANE_COUNT>
+    class SimdMask;
+
+    /// A portable wrapper around SIMD registers, with multiple values (lanes) operated on at once.
+    ///
+    /// All lane counts provide the same operations, so kernels can be written once as templates on the lane count
+    /// and instantiated for each instruction set (see @ref SimdLaneCount):
+    /// - Construction by broadcasting a single value to all lanes, plus loading and storing.
+    /// - Arithmetic operators, Min, Max, and (for floats) Sqrt.
+    /// - Comparison operators producing a @ref SimdMask, which can be used to Blend values.
+    /// - Gathering values from arbitrary indices in memory.
+    /// - Horizontal reductions (ReduceAdd, ReduceMin, ReduceMax) across all lanes.
+    ///
+    /// Backends exist for scalar code (1 lane), SSE4.1 (4 lanes), AVX2 (8 lanes), and AVX-512 (16 lanes).
+    /// As with raw intrinsics, code must only use a backend if the CPU supports its instruction set
+    /// (see @ref PROCESSOR::CpuFeatures), and GCC and Clang require calling functions to be marked with the
+    /// corresponding SIMD_TARGET_* macro (kernels templated on the lane count should be marked SIMD_INLINE
+    /// and called from such functions).  Values implicitly convert to and from the underlying register type
+    /// so that wrapped values can be mixed with raw intrinsics where needed.
+    ///
+    /// Operations exactly match the corresponding scalar operations in each lane, except for ReduceAdd,
+    /// which sums lanes pairwise rather than sequentially.
+    /// @tparam ElementType - The type of values in each lane (float or int32_t).
+    /// @tparam LANE_COUNT - The number of lanes.
+    template <typename ElementType, std::size_t LANE_COUNT>
+    class Simd;
+
+    // DEFINE COMMON SIMD TYPES.
+    /// 8 float lanes in an AVX register.
+    typedef Simd<float, 8> Simd8xf;
+    /// 8 32-bit integer lanes in an AVX register.
+    typedef Simd<int32_t, 8> Simd8xi;
+
+    // SCALAR BACKEND.
+    /// A mask for a single lane.
+    template <>
+    class SimdMask<1>
+    {
+    public:
+        // CONSTRUCTION.
+        /// Constructor.
+        /// @param[in]  lane_set - True if the lane is set in the mask.
+        SimdMask(const bool lane_set = false) : Register(lane_set) {}
+
+        // OPERATORS.
+        SimdMask operator&(const SimdMask& rhs) const { return SimdMask(Register && rhs.Register); }
+        SimdMask operator|(const SimdMask& rhs) const { return SimdMask(Register || rhs.Register); }
+        SimdMask operator~() const { return SimdMask(!Register); }
+
+        // LANE QUERIES.
+        bool Any() const { return Register; }
+        bool All() const { return Register; }
+        uint32_t ToBits() const { return Register ? 1u : 0u; }
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The underlying value.
+        bool Register = false;
+    };
+
+    /// A single 32-bit integer lane.
+    template <>
+    class Simd<int32_t, 1>
+    {
+    public:
+        // CONSTRUCTION.
+        Simd() = default;
+        /// Constructor to broadcast a value to all lanes.
+        /// @param[in]  value - The value for all lanes.
+        explicit Simd(const int32_t value) : Register(value) {}
+        static Simd Load(const int32_t* const values) { return Simd(values[0]); }
+        void Store(int32_t* const values) const { values[0] = Register; }
+        static Simd Truncate(const Simd<float, 1>& values);
+
+        // OPERATORS.
+        Simd operator+(const Simd& rhs) const { return Simd(Register + rhs.Register); }
+        Simd operator-(const Simd& rhs) const { return Simd(Register - rhs.Register); }
+        Simd operator*(const Simd& rhs) const { return Simd(Register * rhs.Register); }
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The underlying value.
+        int32_t Register = 0;
+    };
+
+    /// A single float lane.
+    template <>
+    class Simd<float, 1>
+    {
+    public:
+        // CONSTRUCTION.
+        Simd() = default;
+        /// Constructor to broadcast a value to all lanes.
+        /// @param[in]  value - The value for all lanes.
+        Simd(const float value) : Register(value) {}
+        static Simd Load(const float* const values) { return Simd(values[0]); }
+        void Store(float* const values) const { values[0] = Register; }
+        static Simd Gather(const float* const base_values, const Simd<int32_t, 1>& indices) { return Simd(base_values[indices.Register]); }
+        static Simd Convert(const Simd<int32_t, 1>& values) { return Simd(static_cast<float>(values.Register)); }
+
+        // ARITHMETIC.
+        Simd operator+(const Simd& rhs) const { return Simd(Register + rhs.Register); }
+        Simd operator-(const Simd& rhs) const { return Simd(Register - rhs.Register); }
+        Simd operator*(const Simd& rhs) const { return Simd(Register * rhs.Register); }
+        Simd operator/(const Simd& rhs) const { return Simd(Register / rhs.Register); }
+        Simd operator-() const { return Simd(-Register); }
+        Simd& operator+=(const Simd& rhs) { return *this = (*this + rhs); }
+        Simd& operator-=(const Simd& rhs) { return *this = (*this - rhs); }
+        Simd& operator*=(const Simd& rhs) { return *this = (*this * rhs); }
+        Simd& operator/=(const Simd& rhs) { return *this = (*this / rhs); }
+        static Simd Min(const Simd& lhs, const Simd& rhs) { return (lhs.Register < rhs.Register) ? lhs : rhs; }
+        static Simd Max(const Simd& lhs, const Simd& rhs) { return (lhs.Register > rhs.Register) ? lhs : rhs; }
+        static Simd Sqrt(const Simd& values) { return Simd(std::sqrt(values.Register)); }
+
+        // COMPARISON.
+        SimdMask<1> operator<(const Simd& rhs) const { return SimdMask<1>(Register < rhs.Register); }
+        SimdMask<1> operator<=(const Simd& rhs) const { return SimdMask<1>(Register <= rhs.Register); }
+        SimdMask<1> operator>(const Simd& rhs) const { return SimdMask<1>(Register > rhs.Register); }
+        SimdMask<1> operator>=(const Simd& rhs) const { return SimdMask<1>(Register >= rhs.Register); }
+        SimdMask<1> operator==(const Simd& rhs) const { return SimdMask<1>(Register == rhs.Register); }
+        SimdMask<1> operator!=(const Simd& rhs) const { return SimdMask<1>(Register != rhs.Register); }
+        static Simd Blend(const SimdMask<1>& mask, const Simd& false_values, const Simd& true_values) { return mask.Register ? true_values : false_values; }
+
+        // REDUCTION.
+        float ReduceAdd() const { return Register; }
+        float ReduceMin() const { return Register; }
+        float ReduceMax() const { return Register; }
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The underlying value.
+        float Register = 0.0f;
+    };
+
+    /// Truncates float values toward zero to integers.
+    /// @param[in]  values - The values to truncate.
+    /// @return The truncated values.
+    inline Simd<int32_t, 1> Simd<int32_t, 1>::Truncate(const Simd<float, 1>& values)
+    {
+        return Simd(static_cast<int32_t>(values.Register));
+    }
+
+    // SSE4.1 BACKEND.
+    /// A mask for 4 lanes, with all bits of each set lane set.
+    template <>
+    class SimdMask<4>
+    {
+    public:
+        // CONSTRUCTION.
+        SimdMask() = default;
+        /// Constructor wrapping a register.
+        /// @param[in]  mask - The register with all bits set for lanes in the mask.
+        SIMD_TARGET_SSE4 SimdMask(const __m128 mask) : Register(mask) {}
+        SIMD_TARGET_SSE4 operator __m128() const { return Register; }
+
+        // OPERATORS.
+        SIMD_TARGET_SSE4 SimdMask operator&(const SimdMask& rhs) const { return _mm_and_ps(Register, rhs.Register); }
+        SIMD_TARGET_SSE4 SimdMask operator|(const SimdMask& rhs) const { return _mm_or_ps(Register, rhs.Register); }
+        SIMD_TARGET_SSE4 SimdMask operator~() const { return _mm_xor_ps(Register, _mm_castsi128_ps(_mm_set1_epi32(-1))); }
+
+        // LANE QUERIES.
+        SIMD_TARGET_SSE4 bool Any() const { return 0 != _mm_movemask_ps(Register); }
+        SIMD_TARGET_SSE4 bool All() const { return 0xF == _mm_movemask_ps(Register); }
+        SIMD_TARGET_SSE4 uint32_t ToBits() const { return static_cast<uint32_t>(_mm_movemask_ps(Register)); }
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The underlying register.
+        __m128 Register = {};
+    };
+
+    /// 4 32-bit integer lanes in an SSE register.
+    template <>
+    class Simd<int32_t, 4>
+    {
+    public:
+        // CONSTRUCTION.
+        Simd() = default;
+        /// Constructor wrapping a register.
+        /// @param[in]  values - The register of values.
+        SIMD_TARGET_SSE4 Simd(const __m128i values) : Register(values) {}
+        /// Constructor to broadcast a value to all lanes.
+        /// @param[in]  value - The value for all lanes.
+        SIMD_TARGET_SSE4 explicit Simd(const int32_t value) : Register(_mm_set1_epi32(value)) {}
+        SIMD_TARGET_SSE4 operator __m128i() const { return Register; }
+        SIMD_TARGET_SSE4 static Simd Load(const int32_t* const values) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(values)); }
+        SIMD_TARGET_SSE4 void Store(int32_t* const values) const { _mm_storeu_si128(reinterpret_cast<__m128i*>(values), Register); }
+        SIMD_TARGET_SSE4 static Simd Truncate(const Simd<float, 4>& values);
+
+        // OPERATORS.
+        SIMD_TARGET_SSE4 Simd operator+(const Simd& rhs) const { return _mm_add_epi32(Register, rhs.Register); }
+        SIMD_TARGET_SSE4 Simd operator-(const Simd& rhs) const { return _mm_sub_epi32(Register, rhs.Register); }
+        SIMD_TARGET_SSE4 Simd operator*(const Simd& rhs) const { return _mm_mullo_epi32(Register, rhs.Register); }
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The underlying register.
+        __m128i Register = {};
+    };
+
+    /// 4 float lanes in an SSE register.
+    template <>
+    class Simd<float, 4>
+    {
+    public:
+        // CONSTRUCTION.
+        Simd() = default;
+        /// Constructor wrapping a register.
+        /// @param[in]  values - The register of values.
+        SIMD_TARGET_SSE4 Simd(const __m128 values) : Register(values) {}
+        /// Constructor to broadcast a value to all lanes.
+        /// @param[in]  value - The value for all lanes.
+        SIMD_TARGET_SSE4 Simd(const float value) : Register(_mm_set1_ps(value)) {}
+        SIMD_TARGET_SSE4 operator __m128() const { return Register; }
+        SIMD_TARGET_SSE4 static Simd Load(const float* const values) { return _mm_loadu_ps(values); }
+        SIMD_TARGET_SSE4 void Store(float* const values) const { _mm_storeu_ps(values, Register); }
+        SIMD_TARGET_SSE4 static Simd Gather(const float* const base_values, const Simd<int32_t, 4>& indices)
+        {
+            // SSE has no gather instruction, so each value is loaded individually.
+            alignas(16) int32_t index_values[4];
+            indices.Store(index_values);
+            return _mm_setr_ps(base_values[index_values[0]], base_values[index_values[1]], base_values[index_values[2]], base_values[index_values[3]]);
+        }
+        SIMD_TARGET_SSE4 static Simd Convert(const Simd<int32_t, 4>& values) { return _mm_cvtepi32_ps(values.Register); }
+
+        // ARITHMETIC.
+        SIMD_TARGET_SSE4 Simd operator+(const Simd& rhs) const { return _mm_add_ps(Register, rhs.Register); }
+        SIMD_TARGET_SSE4 Simd operator-(const Simd& rhs) const { return _mm_sub_ps(Register, rhs.Register); }
+        SIMD_TARGET_SSE4 Simd operator*(const Simd& rhs) const { return _mm_mul_ps(Register, rhs.Register); }
+        SIMD_TARGET_SSE4 Simd operator/(const Simd& rhs) const { return _mm_div_ps(Register, rhs.Register); }
+        SIMD_TARGET_SSE4 Simd operator-() const { return _mm_xor_ps(Register, _mm_set1_ps(-0.0f)); }
+        SIMD_TARGET_SSE4 Simd& operator+=(const Simd& rhs) { return *this = (*this + rhs); }
+        SIMD_TARGET_SSE4 Simd& operator-=(const Simd& rhs) { return *this = (*this - rhs); }
+        SIMD_TARGET_SSE4 Simd& operator*=(const Simd& rhs) { return *this = (*this * rhs); }
+        SIMD_TARGET_SSE4 Simd& operator/=(const Simd& rhs) { return *this = (*this / rhs); }
+        SIMD_TARGET_SSE4 static Simd Min(const Simd& lhs, const Simd& rhs) { return _mm_min_ps(lhs.Register, rhs.Register); }
+        SIMD_TARGET_SSE4 static Simd Max(const Simd& lhs, const Simd& rhs) { return _mm_max_ps(lhs.Register, rhs.Register); }
+        SIMD_TARGET_SSE4 static Simd Sqrt(const Simd& values) { return _mm_sqrt_ps(values.Register); }
+
+        // COMPARISON.
+        SIMD_TARGET_SSE4 SimdMask<4> operator<(const Simd& rhs) const { return _mm_cmplt_ps(Register, rhs.Register); }
+        SIMD_TARGET_SSE4 SimdMask<4> operator<=(const Simd& rhs) const { return _mm_cmple_ps(Register, rhs.Register); }
+        SIMD_TARGET_SSE4 SimdMask<4> operator>(const Simd& rhs) const { return _mm_cmpgt_ps(Register, rhs.Register); }
+        SIMD_TARGET_SSE4 SimdMask<4> operator>=(const Simd& rhs) const { return _mm_cmpge_ps(Register, rhs.Register); }
+        SIMD_TARGET_SSE4 SimdMask<4> operator==(const Simd& rhs) const { return _mm_cmpeq_ps(Register, rhs.Register); }
+        SIMD_TARGET_SSE4 SimdMask<4> operator!=(const Simd& rhs) const { return _mm_cmpneq_ps(Register, rhs.Register); }
+        SIMD_TARGET_SSE4 static Simd Blend(const SimdMask<4>& mask, const Simd& false_values, const Simd& true_values) { return _mm_blendv_ps(false_values.Register, true_values.Register, mask.Register); }
+
+        // REDUCTION.
+        SIMD_TARGET_SSE4 float ReduceAdd() const
+        {
+            __m128 pair_sums = _mm_add_ps(Register, _mm_movehl_ps(Register, Register));
+            return _mm_cvtss_f32(_mm_add_ss(pair_sums, _mm_shuffle_ps(pair_sums, pair_sums, _MM_SHUFFLE(1, 1, 1, 1))));
+        }
+        SIMD_TARGET_SSE4 float ReduceMin() const
+        {
+            __m128 pair_minimums = _mm_min_ps(Register, _mm_movehl_ps(Register, Register));
+            return _mm_cvtss_f32(_mm_min_ss(pair_minimums, _mm_shuffle_ps(pair_minimums, pair_minimums, _MM_SHUFFLE(1, 1, 1, 1))));
+        }
+        SIMD_TARGET_SSE4 float ReduceMax() const
+        {
+            __m128 pair_maximums = _mm_max_ps(Register, _mm_movehl_ps(Register, Register));
+            return _mm_cvtss_f32(_mm_max_ss(pair_maximums, _mm_shuffle_ps(pair_maximums, pair_maximums, _MM_SHUFFLE(1, 1, 1, 1))));
+        }
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The underlying register.
+        __m128 Register = {};
+    };
+
+    /// Truncates float values toward zero to integers.
+    /// @param[in]  values - The values to truncate.
+    /// @return The truncated values.
+    SIMD_TARGET_SSE4 inline Simd<int32_t, 4> Simd<int32_t, 4>::Truncate(const Simd<float, 4>& values)
+    {
+        return _mm_cvttps_epi32(values.Register);
+    }
+
+    // AVX2 BACKEND.
+    /// A mask for 8 lanes, with all bits of each set lane set.
+    template <>
+    class SimdMask<8>
+    {
+    public:
+        // CONSTRUCTION.
+        SimdMask() = default;
+        /// Constructor wrapping a register.
+        /// @param[in]  mask - The register with all bits set for lanes in the mask.
+        SIMD_TARGET_AVX2 SimdMask(const __m256 mask) : Register(mask) {}
+        SIMD_TARGET_AVX2 operator __m256() const { return Register; }
+
+        // OPERATORS.
+        SIMD_TARGET_AVX2 SimdMask operator&(const SimdMask& rhs) const { return _mm256_and_ps(Register, rhs.Register); }
+        SIMD_TARGET_AVX2 SimdMask operator|(const SimdMask& rhs) const { return _mm256_or_ps(Register, rhs.Register); }
+        SIMD_TARGET_AVX2 SimdMask operator~() const { return _mm256_xor_ps(Register, _mm256_castsi256_ps(_mm256_set1_epi32(-1))); }
+
+        // LANE QUERIES.
+        SIMD_TARGET_AVX2 bool Any() const { return 0 != _mm256_movemask_ps(Register); }
+        SIMD_TARGET_AVX2 bool All() const { return 0xFF == _mm256_movemask_ps(Register); }
+        SIMD_TARGET_AVX2 uint32_t ToBits() const { return static_cast<uint32_t>(_mm256_movemask_ps(Register)); }
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The underlying register.
+        __m256 Register = {};
+    };
+
+    /// 8 32-bit integer lanes in an AVX register.
+    template <>
+    class Simd<int32_t, 8>
+    {
+    public:
+        // CONSTRUCTION.
+        Simd() = default;
+        /// Constructor wrapping a register.
+        /// @param[in]  values - The register of values.
+        SIMD_TARGET_AVX2 Simd(const __m256i values) : Register(values) {}
+        /// Constructor to broadcast a value to all lanes.
+        /// @param[in]  value - The value for all lanes.
+        SIMD_TARGET_AVX2 explicit Simd(const int32_t value) : Register(_mm256_set1_epi32(value)) {}
+        SIMD_TARGET_AVX2 operator __m256i() const { return Register; }
+        SIMD_TARGET_AVX2 static Simd Load(const int32_t* const values) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values)); }
+        SIMD_TARGET_AVX2 void Store(int32_t* const values) const { _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), Register); }
+        SIMD_TARGET_AVX2 static Simd Truncate(const Simd<float, 8>& values);
+
+        // OPERATORS.
+        SIMD_TARGET_AVX2 Simd operator+(const Simd& rhs) const { return _mm256_add_epi32(Register, rhs.Register); }
+        SIMD_TARGET_AVX2 Simd operator-(const Simd& rhs) const { return _mm256_sub_epi32(Register, rhs.Register); }
+        SIMD_TARGET_AVX2 Simd operator*(const Simd& rhs) const { return _mm256_mullo_epi32(Register, rhs.Register); }
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The underlying register.
+        __m256i Register = {};
+    };
+
+    /// 8 float lanes in an AVX register.
+    template <>
+    class Simd<float, 8>
+    {
+    public:
+        // CONSTRUCTION.
+        Simd() = default;
+        /// Constructor wrapping a register.
+        /// @param[in]  values - The register of values.
+        SIMD_TARGET_AVX2 Simd(const __m256 values) : Register(values) {}
+        /// Constructor to broadcast a value to all lanes.
+        /// @param[in]  value - The value for all lanes.
+        SIMD_TARGET_AVX2 Simd(const float value) : Register(_mm256_set1_ps(value)) {}
+        SIMD_TARGET_AVX2 operator __m256() const { return Register; }
+        SIMD_TARGET_AVX2 static Simd Load(const float* const values) { return _mm256_loadu_ps(values); }
+        SIMD_TARGET_AVX2 void Store(float* const values) const { _mm256_storeu_ps(values, Register); }
+        SIMD_TARGET_AVX2 static Simd Gather(const float* const base_values, const Simd<int32_t, 8>& indices) { return _mm256_i32gather_ps(base_values, indices.Register, sizeof(float)); }
+        SIMD_TARGET_AVX2 static Simd Convert(const Simd<int32_t, 8>& values) { return _mm256_cvtepi32_ps(values.Register); }
+
+        // ARITHMETIC.
+        SIMD_TARGET_AVX2 Simd operator+(const Simd& rhs) const { return _mm256_add_ps(Register, rhs.Register); }
+        SIMD_TARGET_AVX2 Simd operator-(const Simd& rhs) const { return _mm256_sub_ps(Register, rhs.Register); }
+        SIMD_TARGET_AVX2 Simd operator*(const Simd& rhs) const { return _mm256_mul_ps(Register, rhs.Register); }
+        SIMD_TARGET_AVX2 Simd operator/(const Simd& rhs) const { return _mm256_div_ps(Register, rhs.Register); }
+        SIMD_TARGET_AVX2 Simd operator-() const { return _mm256_xor_ps(Register, _mm256_set1_ps(-0.0f)); }
+        SIMD_TARGET_AVX2 Simd& operator+=(const Simd& rhs) { return *this = (*this + rhs); }
+        SIMD_TARGET_AVX2 Simd& operator-=(const Simd& rhs) { return *this = (*this - rhs); }
+        SIMD_TARGET_AVX2 Simd& operator*=(const Simd& rhs) { return *this = (*this * rhs); }
+        SIMD_TARGET_AVX2 Simd& operator/=(const Simd& rhs) { return *this = (*this / rhs); }
+        SIMD_TARGET_AVX2 static Simd Min(const Simd& lhs, const Simd& rhs) { return _mm256_min_ps(lhs.Register, rhs.Register); }
+        SIMD_TARGET_AVX2 static Simd Max(const Simd& lhs, const Simd& rhs) { return _mm256_max_ps(lhs.Register, rhs.Register); }
+        SIMD_TARGET_AVX2 static Simd Sqrt(const Simd& values) { return _mm256_sqrt_ps(values.Register); }
+
+        // COMPARISON.
+        SIMD_TARGET_AVX2 SimdMask<8> operator<(const Simd& rhs) const { return _mm256_cmp_ps(Register, rhs.Register, _CMP_LT_OQ); }
+        SIMD_TARGET_AVX2 SimdMask<8> operator<=(const Simd& rhs) const { return _mm256_cmp_ps(Register, rhs.Register, _CMP_LE_OQ); }
+        SIMD_TARGET_AVX2 SimdMask<8> operator>(const Simd& rhs) const { return _mm256_cmp_ps(Register, rhs.Register, _CMP_GT_OQ); }
+        SIMD_TARGET_AVX2 SimdMask<8> operator>=(const Simd& rhs) const { return _mm256_cmp_ps(Register, rhs.Register, _CMP_GE_OQ); }
+        SIMD_TARGET_AVX2 SimdMask<8> operator==(const Simd& rhs) const { return _mm256_cmp_ps(Register, rhs.Register, _CMP_EQ_OQ); }
+        SIMD_TARGET_AVX2 SimdMask<8> operator!=(const Simd& rhs) const { return _mm256_cmp_ps(Register, rhs.Register, _CMP_NEQ_UQ); }
+        SIMD_TARGET_AVX2 static Simd Blend(const SimdMask<8>& mask, const Simd& false_values, const Simd& true_values) { return _mm256_blendv_ps(false_values.Register, true_values.Register, mask.Register); }
+
+        // REDUCTION.
+        SIMD_TARGET_AVX2 float ReduceAdd() const { return Simd<float, 4>(_mm_add_ps(_mm256_castps256_ps128(Register), _mm256_extractf128_ps(Register, 1))).ReduceAdd(); }
+        SIMD_TARGET_AVX2 float ReduceMin() const { return Simd<float, 4>(_mm_min_ps(_mm256_castps256_ps128(Register), _mm256_extractf128_ps(Register, 1))).ReduceMin(); }
+        SIMD_TARGET_AVX2 float ReduceMax() const { return Simd<float, 4>(_mm_max_ps(_mm256_castps256_ps128(Register), _mm256_extractf128_ps(Register, 1))).ReduceMax(); }
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The underlying register.
+        __m256 Register = {};
+    };
+
+    /// Truncates float values toward zero to integers.
+    /// @param[in]  values - The values to truncate.
+    /// @return The truncated values.
+    SIMD_TARGET_AVX2 inline Simd<int32_t, 8> Simd<int32_t, 8>::Truncate(const Simd<float, 8>& values)
+    {
+        return _mm256_cvttps_epi32(values.Register);
+    }
+
+    // AVX-512 BACKEND.
+    /// A mask for 16 lanes, with 1 bit per lane in a mask register.
+    template <>
+    class SimdMask<16>
+    {
+    public:
+        // CONSTRUCTION.
+        SimdMask() = default;
+        /// Constructor wrapping a register.
+        /// @param[in]  mask - The register with bits set for lanes in the mask.
+        SimdMask(const __mmask16 mask) : Register(mask) {}
+        operator __mmask16() const { return Register; }
+
+        // OPERATORS.
+        SimdMask operator&(const SimdMask& rhs) const { return static_cast<__mmask16>(Register & rhs.Register); }
+        SimdMask operator|(const SimdMask& rhs) const { return static_cast<__mmask16>(Register | rhs.Register); }
+        SimdMask operator~() const { return static_cast<__mmask16>(~Register); }
+
+        // LANE QUERIES.
+        bool Any() const { return 0 != Register; }
+        bool All() const { return 0xFFFF == Register; }
+        uint32_t ToBits() const { return Register; }
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The underlying register.
+        __mmask16 Register = 0;
+    };
+
+    /// 16 32-bit integer lanes in an AVX-512 register.
+    template <>
+    class Simd<int32_t, 16>
+    {
+    public:
+        // CONSTRUCTION.
+        Simd() = default;
+        /// Constructor wrapping a register.
+        /// @param[in]  values - The register of values.
+        SIMD_TARGET_AVX512 Simd(const __m512i values) : Register(values) {}
+        /// Constructor to broadcast a value to all lanes.
+        /// @param[in]  value - The value for all lanes.
+        SIMD_TARGET_AVX512 explicit Simd(const int32_t value) : Register(_mm512_set1_epi32(value)) {}
+        SIMD_TARGET_AVX512 operator __m512i() const { return Register; }
+        SIMD_TARGET_AVX512 static Simd Load(const int32_t* const values) { return _mm512_loadu_si512(values); }
+        SIMD_TARGET_AVX512 void Store(int32_t* const values) const { _mm512_storeu_si512(values, Register); }
+        SIMD_TARGET_AVX512 static Simd Truncate(const Simd<float, 16>& values);
+
+        // OPERATORS.
+        SIMD_TARGET_AVX512 Simd operator+(const Simd& rhs) const { return _mm512_add_epi32(Register, rhs.Register); }
+        SIMD_TARGET_AVX512 Simd operator-(const Simd& rhs) const { return _mm512_sub_epi32(Register, rhs.Register); }
+        SIMD_TARGET_AVX512 Simd operator*(const Simd& rhs) const { return _mm512_mullo_epi32(Register, rhs.Register); }
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The underlying register.
+        __m512i Register = {};
+    };
+
+    /// 16 float lanes in an AVX-512 register.
+    template <>
+    class Simd<float, 16>
+    {
+    public:
+        // CONSTRUCTION.
+        Simd() = default;
+        /// Constructor wrapping a register.
+        /// @param[in]  values - The register of values.
+        SIMD_TARGET_AVX512 Simd(const __m512 values) : Register(values) {}
+        /// Constructor to broadcast a value to all lanes.
+        /// @param[in]  value - The value for all lanes.
+        SIMD_TARGET_AVX512 Simd(const float value) : Register(_mm512_set1_ps(value)) {}
+        SIMD_TARGET_AVX512 operator __m512() const { return Register; }
+        SIMD_TARGET_AVX512 static Simd Load(const float* const values) { return _mm512_loadu_ps(values); }
+        SIMD_TARGET_AVX512 void Store(float* const values) const { _mm512_storeu_ps(values, Register); }
+        SIMD_TARGET_AVX512 static Simd Gather(const float* const base_values, const Simd<int32_t, 16>& indices) { return _mm512_i32gather_ps(indices.Register, base_values, sizeof(float)); }
+        SIMD_TARGET_AVX512 static Simd Convert(const Simd<int32_t, 16>& values) { return _mm512_cvtepi32_ps(values.Register); }
+
+        // ARITHMETIC.
+        SIMD_TARGET_AVX512 Simd operator+(const Simd& rhs) const { return _mm512_add_ps(Register, rhs.Register); }
+        SIMD_TARGET_AVX512 Simd operator-(const Simd& rhs) const { return _mm512_sub_ps(Register, rhs.Register); }
+        SIMD_TARGET_AVX512 Simd operator*(const Simd& rhs) const { return _mm512_mul_ps(Register, rhs.Register); }
+        SIMD_TARGET_AVX512 Simd operator/(const Simd& rhs) const { return _mm512_div_ps(Register, rhs.Register); }
+        SIMD_TARGET_AVX512 Simd operator-() const { return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(Register), _mm512_set1_epi32(INT32_MIN))); }
+        SIMD_TARGET_AVX512 Simd& operator+=(const Simd& rhs) { return *this = (*this + rhs); }
+        SIMD_TARGET_AVX512 Simd& operator-=(const Simd& rhs) { return *this = (*this - rhs); }
+        SIMD_TARGET_AVX512 Simd& operator*=(const Simd& rhs) { return *this = (*this * rhs); }
+        SIMD_TARGET_AVX512 Simd& operator/=(const Simd& rhs) { return *this = (*this / rhs); }
+        SIMD_TARGET_AVX512 static Simd Min(const Simd& lhs, const Simd& rhs) { return _mm512_min_ps(lhs.Register, rhs.Register); }
+        SIMD_TARGET_AVX512 static Simd Max(const Simd& lhs, const Simd& rhs) { return _mm512_max_ps(lhs.Register, rhs.Register); }
+        SIMD_TARGET_AVX512 static Simd Sqrt(const Simd& values) { return _mm512_sqrt_ps(values.Register); }
+
+        // COMPARISON.
+        SIMD_TARGET_AVX512 SimdMask<16> operator<(const Simd& rhs) const { return _mm512_cmp_ps_mask(Register, rhs.Register, _CMP_LT_OQ); }
+        SIMD_TARGET_AVX512 SimdMask<16> operator<=(const Simd& rhs) const { return _mm512_cmp_ps_mask(Register, rhs.Register, _CMP_LE_OQ); }
+        SIMD_TARGET_AVX512 SimdMask<16> operator>(const Simd& rhs) const { return _mm512_cmp_ps_mask(Register, rhs.Register, _CMP_GT_OQ); }
+        SIMD_TARGET_AVX512 SimdMask<16> operator>=(const Simd& rhs) const { return _mm512_cmp_ps_mask(Register, rhs.Register, _CMP_GE_OQ); }
+        SIMD_TARGET_AVX512 SimdMask<16> operator==(const Simd& rhs) const { return _mm512_cmp_ps_mask(Register, rhs.Register, _CMP_EQ_OQ); }
+        SIMD_TARGET_AVX512 SimdMask<16> operator!=(const Simd& rhs) const { return _mm512_cmp_ps_mask(Register, rhs.Register, _CMP_NEQ_UQ); }
+        SIMD_TARGET_AVX512 static Simd Blend(const SimdMask<16>& mask, const Simd& false_values, const Simd& true_values) { return _mm512_mask_blend_ps(mask.Register, false_values.Register, true_values.Register); }
+
+        // REDUCTION.
+        SIMD_TARGET_AVX512 float ReduceAdd() const { return Simd<float, 8>(_mm256_add_ps(_mm512_castps512_ps256(Register), _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(Register), 1)))).ReduceAdd(); }
+        SIMD_TARGET_AVX512 float ReduceMin() const { return Simd<float, 8>(_mm256_min_ps(_mm512_castps512_ps256(Register), _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(Register), 1)))).ReduceMin(); }
+        SIMD_TARGET_AVX512 float ReduceMax() const { return Simd<float, 8>(_mm256_max_ps(_mm512_castps512_ps256(Register), _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(Register), 1)))).ReduceMax(); }
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The underlying register.
+        __m512 Register = {};
+    };
+
+    /// Truncates float values toward zero to integers.
+    /// @param[in]  values - The values to truncate.
+    /// @return The truncated values.
+    SIMD_TARGET_AVX512 inline Simd<int32_t, 16> Simd<int32_t, 16>::Truncate(const Simd<float, 16>& values)
+    {
+        return _mm512_cvttps_epi32(values.Register);
+    }
+}
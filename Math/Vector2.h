@@ -1,7 +1,7 @@
 #pragma once
 
-#include <cmath>
-#include <intrin.h>
+#include "Math/Number.h"
+#include "Math/Simd.h"
 
 /// Holds code related to math.
 namespace MATH
@@ -11,9 +11,9 @@ namespace MATH
     {
     public:
         /// The x components of the vectors.
-        __m256 X;
+        Simd8xf X;
         /// The y components of the vectors.
-        __m256 Y;
+        Simd8xf Y;
     };
 
     /// A 2D mathematical vector with both magnitude and direction.
@@ -27,22 +27,22 @@ namespace MATH
     {
     public:
         // STATIC METHODS.
-        static Vector2 Scale(const ComponentType scale_factor, const Vector2& vector);
-        static Vector2 Normalize(const Vector2& vector);
-        static ComponentType DotProduct(const Vector2& vector_1, const Vector2& vector_2);
+        static constexpr Vector2 Scale(const ComponentType scale_factor, const Vector2& vector);
+        static constexpr Vector2 Normalize(const Vector2& vector);
+        static constexpr ComponentType DotProduct(const Vector2& vector_1, const Vector2& vector_2);
 
         // CONSTRUCTION.
-        explicit Vector2(const ComponentType x = 0, const ComponentType y = 0);
+        constexpr explicit Vector2(const ComponentType x = 0, const ComponentType y = 0);
 
         // OPERATORS.
-        bool operator== (const Vector2& rhs) const;
-        bool operator!= (const Vector2& rhs) const;
-        Vector2 operator+ (const Vector2& rhs) const;
-        Vector2& operator+= (const Vector2& rhs);
-        Vector2 operator- (const Vector2& rhs) const;
+        constexpr bool operator== (const Vector2& rhs) const;
+        constexpr bool operator!= (const Vector2& rhs) const;
+        constexpr Vector2 operator+ (const Vector2& rhs) const;
+        constexpr Vector2& operator+= (const Vector2& rhs);
+        constexpr Vector2 operator- (const Vector2& rhs) const;
 
         // OTHER OPERATIONS.
-        ComponentType Length() const;
+        constexpr ComponentType Length() const;
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The x component of the vector.
@@ -64,7 +64,7 @@ namespace MATH
     /// @param[in]  vector - The vector to scale.
     /// @return The scaled version of the vector.
     template <typename ComponentType>
-    Vector2<ComponentType> Vector2<ComponentType>::Scale(const ComponentType scale_factor, const Vector2<ComponentType>& vector)
+    constexpr Vector2<ComponentType> Vector2<ComponentType>::Scale(const ComponentType scale_factor, const Vector2<ComponentType>& vector)
     {
         Vector2<ComponentType> scaled_vector;
         scaled_vector.X = scale_factor * vector.X;
@@ -77,7 +77,7 @@ namespace MATH
     /// @return The normalized version of the vector.
     ///     If the vector is a zero vector, then a zero vector is returned.
     template <typename ComponentType>
-    Vector2<ComponentType> Vector2<ComponentType>::Normalize(const Vector2<ComponentType>& vector)
+    constexpr Vector2<ComponentType> Vector2<ComponentType>::Normalize(const Vector2<ComponentType>& vector)
     {
         // GET THE VECTOR'S LENGTH.
         ComponentType vector_length = vector.Length();
@@ -101,7 +101,7 @@ namespace MATH
     /// @param[in]  vector_2 - Another vector to use in the dot product.
     /// @return The dot product between the 2 vectors.
     template <typename ComponentType>
-    ComponentType Vector2<ComponentType>::DotProduct(
+    constexpr ComponentType Vector2<ComponentType>::DotProduct(
         const Vector2<ComponentType>& vector_1,
         const Vector2<ComponentType>& vector_2)
     {
@@ -115,7 +115,7 @@ namespace MATH
     /// @param[in]  x - The x component value.
     /// @param[in]  y - The y component value.
     template <typename ComponentType>
-    Vector2<ComponentType>::Vector2(const ComponentType x, const ComponentType y) :
+    constexpr Vector2<ComponentType>::Vector2(const ComponentType x, const ComponentType y) :
         X(x),
         Y(y)
     {};
@@ -126,7 +126,7 @@ namespace MATH
     /// @param[in]  rhs - The vector on the right-hand side of the operator.
     /// @return True if the vectors are equal; false otherwise.
     template <typename ComponentType>
-    bool Vector2<ComponentType>::operator== (const Vector2<ComponentType>& rhs) const
+    constexpr bool Vector2<ComponentType>::operator== (const Vector2<ComponentType>& rhs) const
     {
         bool x_component_matches = (this->X == rhs.X);
         bool y_component_matches = (this->Y == rhs.Y);
@@ -141,7 +141,7 @@ namespace MATH
     /// @param[in]  rhs - The vector on the right-hand side of the operator.
     /// @return True if the vectors are unequal; false otherwise.
     template <typename ComponentType>
-    bool Vector2<ComponentType>::operator!= (const Vector2<ComponentType>& rhs) const
+    constexpr bool Vector2<ComponentType>::operator!= (const Vector2<ComponentType>& rhs) const
     {
         bool vectors_equal = ((*this) == rhs);
         return !vectors_equal;
@@ -152,7 +152,7 @@ namespace MATH
     ///     add to this vector.
     /// @return A new vector created by adding the provided vector to this vector.
     template <typename ComponentType>
-    Vector2<ComponentType> Vector2<ComponentType>::operator+ (const Vector2<ComponentType>& rhs) const
+    constexpr Vector2<ComponentType> Vector2<ComponentType>::operator+ (const Vector2<ComponentType>& rhs) const
     {
         MATH::Vector2<ComponentType> resulting_vector;
         resulting_vector.X = this->X + rhs.X;
@@ -165,7 +165,7 @@ namespace MATH
     ///     add to this vector.
     /// @return This vector with the provided vector added to it.
     template <typename ComponentType>
-    Vector2<ComponentType>& Vector2<ComponentType>::operator+= (const Vector2<ComponentType>& rhs)
+    constexpr Vector2<ComponentType>& Vector2<ComponentType>::operator+= (const Vector2<ComponentType>& rhs)
     {
         this->X += rhs.X;
         this->Y += rhs.Y;
@@ -177,7 +177,7 @@ namespace MATH
     ///     subtract from this vector.
     /// @return A new vector created by subtracting the provided vector from this vector.
     template <typename ComponentType>
-    Vector2<ComponentType> Vector2<ComponentType>::operator- (const Vector2<ComponentType>& rhs) const
+    constexpr Vector2<ComponentType> Vector2<ComponentType>::operator- (const Vector2<ComponentType>& rhs) const
     {
         MATH::Vector2<ComponentType> resulting_vector;
         resulting_vector.X = this->X - rhs.X;
@@ -188,12 +188,12 @@ namespace MATH
     /// Gets the length (magnitude) of the vector.
     /// @return The length of the vector.
     template <typename ComponentType>
-    ComponentType Vector2<ComponentType>::Length() const
+    constexpr ComponentType Vector2<ComponentType>::Length() const
     {
         // The dot product computes x*x + y*y.
         // The length is the square root of this (the distance formula).
         ComponentType length_squared = Vector2<ComponentType>::DotProduct(*this, *this);
-        ComponentType length = static_cast<ComponentType>(sqrt(length_squared));
+        ComponentType length = Number::SquareRoot(length_squared);
         return length;
     }
 }
@@ -1,8 +1,8 @@
 #pragma once
 
-#include <cmath>
 #include <string>
-#include <intrin.h>
+#include "Math/Number.h"
+#include "Math/Simd.h"
 
 namespace MATH
 {
@@ -10,14 +10,78 @@ namespace MATH
     class Vector3Simd8x
     {
     public:
+        // STATIC METHODS.
+        SIMD_TARGET_AVX2 static Vector3Simd8x Scale(const Simd8xf& scale_factors, const Vector3Simd8x& vectors);
+        SIMD_TARGET_AVX2 static Vector3Simd8x Normalize(const Vector3Simd8x& vectors);
+        SIMD_TARGET_AVX2 static Simd8xf DotProduct(const Vector3Simd8x& vectors_1, const Vector3Simd8x& vectors_2);
+
+        // OPERATORS.
+        SIMD_TARGET_AVX2 Vector3Simd8x operator- (const Vector3Simd8x& rhs) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The x components of the vectors.
-        __m256 X;
+        Simd8xf X;
         /// The y components of the vectors.
-        __m256 Y;
+        Simd8xf Y;
         /// The z components of the vectors.
-        __m256 Z;
+        Simd8xf Z;
     };
 
+    /// Scales the vectors by the specified factors.
+    /// @param[in]  scale_factors - The factors to multiply each vector by.
+    /// @param[in]  vectors - The vectors to scale.
+    /// @return The scaled vectors.
+    SIMD_TARGET_AVX2 inline Vector3Simd8x Vector3Simd8x::Scale(const Simd8xf& scale_factors, const Vector3Simd8x& vectors)
+    {
+        Vector3Simd8x scaled_vectors;
+        scaled_vectors.X = scale_factors * vectors.X;
+        scaled_vectors.Y = scale_factors * vectors.Y;
+        scaled_vectors.Z = scale_factors * vectors.Z;
+        return scaled_vectors;
+    }
+
+    /// Normalizes the vectors, exactly matching the non-SIMD normalization.
+    /// @param[in]  vectors - The vectors to normalize.
+    /// @return The unit vectors in the same directions; zero vectors for any vectors with zero length.
+    SIMD_TARGET_AVX2 inline Vector3Simd8x Vector3Simd8x::Normalize(const Vector3Simd8x& vectors)
+    {
+        // GET THE VECTORS' LENGTHS.
+        Simd8xf vector_lengths = Simd8xf::Sqrt(DotProduct(vectors, vectors));
+
+        // NORMALIZE THE VECTORS.
+        // Division is used rather than multiplication by a reciprocal to exactly match the non-SIMD normalization.
+        // Zero length vectors are kept as zero vectors rather than being divided by zero.
+        const Simd8xf ZERO = 0.0f;
+        SimdMask<8> vector_lengths_are_zero = (vector_lengths == ZERO);
+        Vector3Simd8x normalized_vectors;
+        normalized_vectors.X = Simd8xf::Blend(vector_lengths_are_zero, vectors.X / vector_lengths, ZERO);
+        normalized_vectors.Y = Simd8xf::Blend(vector_lengths_are_zero, vectors.Y / vector_lengths, ZERO);
+        normalized_vectors.Z = Simd8xf::Blend(vector_lengths_are_zero, vectors.Z / vector_lengths, ZERO);
+        return normalized_vectors;
+    }
+
+    /// Computes the dot products of the vectors, summing components in the same order as the non-SIMD dot product.
+    /// @param[in]  vectors_1 - The first vectors in the dot products.
+    /// @param[in]  vectors_2 - The second vectors in the dot products.
+    /// @return The dot products of the vectors.
+    SIMD_TARGET_AVX2 inline Simd8xf Vector3Simd8x::DotProduct(const Vector3Simd8x& vectors_1, const Vector3Simd8x& vectors_2)
+    {
+        Simd8xf dot_products = (vectors_1.X * vectors_2.X + vectors_1.Y * vectors_2.Y) + vectors_1.Z * vectors_2.Z;
+        return dot_products;
+    }
+
+    /// Subtracts the vectors.
+    /// @param[in]  rhs - The vectors to subtract from these vectors.
+    /// @return The differences of the vectors.
+    SIMD_TARGET_AVX2 inline Vector3Simd8x Vector3Simd8x::operator- (const Vector3Simd8x& rhs) const
+    {
+        Vector3Simd8x differences;
+        differences.X = X - rhs.X;
+        differences.Y = Y - rhs.Y;
+        differences.Z = Z - rhs.Z;
+        return differences;
+    }
+
     /// A 3D mathematical vector with both magnitude and direction.
     /// It currently only has the minimal functionality needed,
     /// so it cannot directly perform all common vector operations.
@@ -29,28 +93,28 @@ namespace MATH
     {
     public:
         // STATIC METHODS.
-        static Vector3 Scale(const ComponentType scale_factor, const Vector3& vector);
-        static Vector3 Normalize(const Vector3& vector);
-        static ComponentType DotProduct(const Vector3& vector_1, const Vector3& vector_2);
-        static Vector3 CrossProduct(const Vector3& lhs, const Vector3& rhs);
+        static constexpr Vector3 Scale(const ComponentType scale_factor, const Vector3& vector);
+        static constexpr Vector3 Normalize(const Vector3& vector);
+        static constexpr ComponentType DotProduct(const Vector3& vector_1, const Vector3& vector_2);
+        static constexpr Vector3 CrossProduct(const Vector3& lhs, const Vector3& rhs);
 
         // CONSTRUCTION.
-        explicit Vector3() = default;
-        explicit Vector3(
+        constexpr explicit Vector3() = default;
+        constexpr explicit Vector3(
             const ComponentType x, 
             const ComponentType y,
             const ComponentType z);
 
         // OPERATORS.
-        bool operator== (const Vector3& rhs) const;
-        bool operator!= (const Vector3& rhs) const;
-        Vector3 operator+ (const Vector3& rhs) const;
-        Vector3& operator+= (const Vector3& rhs);
-        Vector3 operator- (const Vector3& rhs) const;
-        Vector3 operator- () const;
+        constexpr bool operator== (const Vector3& rhs) const;
+        constexpr bool operator!= (const Vector3& rhs) const;
+        constexpr Vector3 operator+ (const Vector3& rhs) const;
+        constexpr Vector3& operator+= (const Vector3& rhs);
+        constexpr Vector3 operator- (const Vector3& rhs) const;
+        constexpr Vector3 operator- () const;
 
         // OTHER OPERATIONS.
-        ComponentType Length() const;
+        constexpr ComponentType Length() const;
         std::string ToString() const;
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
@@ -73,7 +137,7 @@ namespace MATH
     /// @param[in]  vector - The vector to scale.
     /// @return The scaled version of the vector.
     template <typename ComponentType>
-    Vector3<ComponentType> Vector3<ComponentType>::Scale(const ComponentType scale_factor, const Vector3<ComponentType>& vector)
+    constexpr Vector3<ComponentType> Vector3<ComponentType>::Scale(const ComponentType scale_factor, const Vector3<ComponentType>& vector)
     {
         Vector3<ComponentType> scaled_vector;
         scaled_vector.X = scale_factor * vector.X;
@@ -87,7 +151,7 @@ namespace MATH
     /// @return The normalized version of the vector.
     ///     If the vector is a zero vector, then a zero vector is returned.
     template <typename ComponentType>
-    Vector3<ComponentType> Vector3<ComponentType>::Normalize(const Vector3<ComponentType>& vector)
+    constexpr Vector3<ComponentType> Vector3<ComponentType>::Normalize(const Vector3<ComponentType>& vector)
     {
         // GET THE VECTOR'S LENGTH.
         ComponentType vector_length = vector.Length();
@@ -112,7 +176,7 @@ namespace MATH
     /// @param[in]  vector_2 - Another vector to use in the dot product.
     /// @return The dot product between the 2 vectors.
     template <typename ComponentType>
-    ComponentType Vector3<ComponentType>::DotProduct(
+    constexpr ComponentType Vector3<ComponentType>::DotProduct(
         const Vector3<ComponentType>& vector_1,
         const Vector3<ComponentType>& vector_2)
     {
@@ -128,7 +192,7 @@ namespace MATH
     /// @param[in]  rhs - The vector on the right-hand side of the cross product operation.
     /// @return The cross product between the 2 vectors.
     template <typename ComponentType>
-    Vector3<ComponentType> Vector3<ComponentType>::CrossProduct(
+    constexpr Vector3<ComponentType> Vector3<ComponentType>::CrossProduct(
         const Vector3<ComponentType>& lhs,
         const Vector3<ComponentType>& rhs)
     {
@@ -144,7 +208,7 @@ namespace MATH
     /// @param[in]  y - The y component value.
     /// @param[in]  z - The z component value.
     template <typename ComponentType>
-    Vector3<ComponentType>::Vector3(
+    constexpr Vector3<ComponentType>::Vector3(
         const ComponentType x, 
         const ComponentType y,
         const ComponentType z) :
@@ -159,7 +223,7 @@ namespace MATH
     /// @param[in]  rhs - The vector on the right-hand side of the operator.
     /// @return True if the vectors are equal; false otherwise.
     template <typename ComponentType>
-    bool Vector3<ComponentType>::operator== (const Vector3<ComponentType>& rhs) const
+    constexpr bool Vector3<ComponentType>::operator== (const Vector3<ComponentType>& rhs) const
     {
         bool x_component_matches = (this->X == rhs.X);
         bool y_component_matches = (this->Y == rhs.Y);
@@ -175,7 +239,7 @@ namespace MATH
     /// @param[in]  rhs - The vector on the right-hand side of the operator.
     /// @return True if the vectors are unequal; false otherwise.
     template <typename ComponentType>
-    bool Vector3<ComponentType>::operator!= (const Vector3<ComponentType>& rhs) const
+    constexpr bool Vector3<ComponentType>::operator!= (const Vector3<ComponentType>& rhs) const
     {
         bool vectors_equal = ((*this) == rhs);
         return !vectors_equal;
@@ -186,7 +250,7 @@ namespace MATH
     ///     add to this vector.
     /// @return A new vector created by adding the provided vector to this vector.
     template <typename ComponentType>
-    Vector3<ComponentType> Vector3<ComponentType>::operator+ (const Vector3<ComponentType>& rhs) const
+    constexpr Vector3<ComponentType> Vector3<ComponentType>::operator+ (const Vector3<ComponentType>& rhs) const
     {
         MATH::Vector3<ComponentType> resulting_vector;
         resulting_vector.X = this->X + rhs.X;
@@ -200,7 +264,7 @@ namespace MATH
     ///     add to this vector.
     /// @return This vector with the provided vector added to it.
     template <typename ComponentType>
-    Vector3<ComponentType>& Vector3<ComponentType>::operator+= (const Vector3<ComponentType>& rhs)
+    constexpr Vector3<ComponentType>& Vector3<ComponentType>::operator+= (const Vector3<ComponentType>& rhs)
     {
         this->X += rhs.X;
         this->Y += rhs.Y;
@@ -213,7 +277,7 @@ namespace MATH
     ///     subtract from this vector.
     /// @return A new vector created by subtracting the provided vector from this vector.
     template <typename ComponentType>
-    Vector3<ComponentType> Vector3<ComponentType>::operator- (const Vector3<ComponentType>& rhs) const
+    constexpr Vector3<ComponentType> Vector3<ComponentType>::operator- (const Vector3<ComponentType>& rhs) const
     {
         Vector3<ComponentType> resulting_vector;
         resulting_vector.X = this->X - rhs.X;
@@ -225,7 +289,7 @@ namespace MATH
     /// Creates a negated version of this vector.
     /// @return A negated version of this vector.
     template <typename ComponentType>
-    Vector3<ComponentType> Vector3<ComponentType>::operator- () const
+    constexpr Vector3<ComponentType> Vector3<ComponentType>::operator- () const
     {
         Vector3<ComponentType> negated_vector;
         negated_vector.X = -1 * this->X;
@@ -237,12 +301,12 @@ namespace MATH
     /// Gets the length (magnitude) of the vector.
     /// @return The length of the vector.
     template <typename ComponentType>
-    ComponentType Vector3<ComponentType>::Length() const
+    constexpr ComponentType Vector3<ComponentType>::Length() const
     {
         // The dot product computes x*x + y*y + z*z.
         // The length is the square root of this (the distance formula).
         ComponentType length_squared = Vector3<ComponentType>::DotProduct(*this, *this);
-        ComponentType length = sqrt(length_squared);
+        ComponentType length = Number::SquareRoot(length_squared);
         return length;
     }
 
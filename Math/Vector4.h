@@ -1,6 +1,6 @@
 #pragma once
 
-#include <cmath>
+#include "Math/Number.h"
 #include "Math/Vector3.h"
 
 namespace MATH
@@ -17,28 +17,28 @@ namespace MATH
     {
     public:
         // STATIC METHODS.
-        static Vector4 Scale(const ComponentType scale_factor, const Vector4& vector);
-        static Vector4 Normalize(const Vector4& vector);
-        static ComponentType DotProduct(const Vector4& vector_1, const Vector4& vector_2);
+        static constexpr Vector4 Scale(const ComponentType scale_factor, const Vector4& vector);
+        static constexpr Vector4 Normalize(const Vector4& vector);
+        static constexpr ComponentType DotProduct(const Vector4& vector_1, const Vector4& vector_2);
 
         // CONSTRUCTION.
-        static Vector4 HomogeneousPositionVector(const Vector3<ComponentType>& vector_3);
-        explicit Vector4(
+        static constexpr Vector4 HomogeneousPositionVector(const Vector3<ComponentType>& vector_3);
+        constexpr explicit Vector4(
             const ComponentType x = static_cast<ComponentType>(0),
             const ComponentType y = static_cast<ComponentType>(0),
             const ComponentType z = static_cast<ComponentType>(0),
             const ComponentType w = static_cast<ComponentType>(0));
 
         // OPERATORS.
-        bool operator== (const Vector4& rhs) const;
-        bool operator!= (const Vector4& rhs) const;
-        Vector4 operator+ (const Vector4& rhs) const;
-        Vector4& operator+= (const Vector4& rhs);
-        Vector4 operator- (const Vector4& rhs) const;
-        Vector4 operator- () const;
+        constexpr bool operator== (const Vector4& rhs) const;
+        constexpr bool operator!= (const Vector4& rhs) const;
+        constexpr Vector4 operator+ (const Vector4& rhs) const;
+        constexpr Vector4& operator+= (const Vector4& rhs);
+        constexpr Vector4 operator- (const Vector4& rhs) const;
+        constexpr Vector4 operator- () const;
 
         // OTHER OPERATIONS.
-        ComponentType Length() const;
+        constexpr ComponentType Length() const;
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The x component of the vector.
@@ -60,7 +60,7 @@ namespace MATH
     /// @param[in]  vector - The vector to scale.
     /// @return The scaled version of the vector.
     template <typename ComponentType>
-    Vector4<ComponentType> Vector4<ComponentType>::Scale(const ComponentType scale_factor, const Vector4<ComponentType>& vector)
+    constexpr Vector4<ComponentType> Vector4<ComponentType>::Scale(const ComponentType scale_factor, const Vector4<ComponentType>& vector)
     {
         Vector4<ComponentType> scaled_vector;
         scaled_vector.X = scale_factor * vector.X;
@@ -75,7 +75,7 @@ namespace MATH
     /// @return The normalized version of the vector.
     ///     If the vector is a zero vector, then a zero vector is returned.
     template <typename ComponentType>
-    Vector4<ComponentType> Vector4<ComponentType>::Normalize(const Vector4<ComponentType>& vector)
+    constexpr Vector4<ComponentType> Vector4<ComponentType>::Normalize(const Vector4<ComponentType>& vector)
     {
         // GET THE VECTOR'S LENGTH.
         ComponentType vector_length = vector.Length();
@@ -101,7 +101,7 @@ namespace MATH
     /// @param[in]  vector_2 - Another vector to use in the dot product.
     /// @return The dot product between the 2 vectors.
     template <typename ComponentType>
-    ComponentType Vector4<ComponentType>::DotProduct(
+    constexpr ComponentType Vector4<ComponentType>::DotProduct(
         const Vector4<ComponentType>& vector_1,
         const Vector4<ComponentType>& vector_2)
     {
@@ -117,7 +117,7 @@ namespace MATH
     /// @param[in]  vector_3 - The 3D vector for which to create a 4D vector.
     /// @return The homogeneous 4D position vector for the 3D vector.
     template <typename ComponentType>
-    Vector4<ComponentType> Vector4<ComponentType>::HomogeneousPositionVector(const Vector3<ComponentType>& vector_3)
+    constexpr Vector4<ComponentType> Vector4<ComponentType>::HomogeneousPositionVector(const Vector3<ComponentType>& vector_3)
     {
         Vector4<ComponentType> homogeneous_position_vector(
             vector_3.X,
@@ -135,7 +135,7 @@ namespace MATH
     /// @param[in]  z - The z component value.
     /// @param[in]  w - The w component value.
     template <typename ComponentType>
-    Vector4<ComponentType>::Vector4(
+    constexpr Vector4<ComponentType>::Vector4(
         const ComponentType x,
         const ComponentType y,
         const ComponentType z,
@@ -152,7 +152,7 @@ namespace MATH
     /// @param[in]  rhs - The vector on the right-hand side of the operator.
     /// @return True if the vectors are equal; false otherwise.
     template <typename ComponentType>
-    bool Vector4<ComponentType>::operator== (const Vector4<ComponentType>& rhs) const
+    constexpr bool Vector4<ComponentType>::operator== (const Vector4<ComponentType>& rhs) const
     {
         bool x_component_matches = (this->X == rhs.X);
         bool y_component_matches = (this->Y == rhs.Y);
@@ -169,7 +169,7 @@ namespace MATH
     /// @param[in]  rhs - The vector on the right-hand side of the operator.
     /// @return True if the vectors are unequal; false otherwise.
     template <typename ComponentType>
-    bool Vector4<ComponentType>::operator!= (const Vector4<ComponentType>& rhs) const
+    constexpr bool Vector4<ComponentType>::operator!= (const Vector4<ComponentType>& rhs) const
     {
         bool vectors_equal = ((*this) == rhs);
         return !vectors_equal;
@@ -180,7 +180,7 @@ namespace MATH
     ///     add to this vector.
     /// @return A new vector created by adding the provided vector to this vector.
     template <typename ComponentType>
-    Vector4<ComponentType> Vector4<ComponentType>::operator+ (const Vector4<ComponentType>& rhs) const
+    constexpr Vector4<ComponentType> Vector4<ComponentType>::operator+ (const Vector4<ComponentType>& rhs) const
     {
         MATH::Vector4<ComponentType> resulting_vector;
         resulting_vector.X = this->X + rhs.X;
@@ -195,7 +195,7 @@ namespace MATH
     ///     add to this vector.
     /// @return This vector with the provided vector added to it.
     template <typename ComponentType>
-    Vector4<ComponentType>& Vector4<ComponentType>::operator+= (const Vector4<ComponentType>& rhs)
+    constexpr Vector4<ComponentType>& Vector4<ComponentType>::operator+= (const Vector4<ComponentType>& rhs)
     {
         this->X += rhs.X;
         this->Y += rhs.Y;
@@ -209,7 +209,7 @@ namespace MATH
     ///     subtract from this vector.
     /// @return A new vector created by subtracting the provided vector from this vector.
     template <typename ComponentType>
-    Vector4<ComponentType> Vector4<ComponentType>::operator- (const Vector4<ComponentType>& rhs) const
+    constexpr Vector4<ComponentType> Vector4<ComponentType>::operator- (const Vector4<ComponentType>& rhs) const
     {
         Vector4<ComponentType> resulting_vector;
         resulting_vector.X = this->X - rhs.X;
@@ -222,7 +222,7 @@ namespace MATH
     /// Creates a negated version of this vector.
     /// @return A negated version of this vector.
     template <typename ComponentType>
-    Vector4<ComponentType> Vector4<ComponentType>::operator- () const
+    constexpr Vector4<ComponentType> Vector4<ComponentType>::operator- () const
     {
         Vector4<ComponentType> negated_vector;
         negated_vector.X = -1 * this->X;
@@ -235,12 +235,12 @@ namespace MATH
     /// Gets the length (magnitude) of the vector.
     /// @return The length of the vector.
     template <typename ComponentType>
-    ComponentType Vector4<ComponentType>::Length() const
+    constexpr ComponentType Vector4<ComponentType>::Length() const
     {
         // The dot product computes x*x + y*y + z*z + w*w.
         // The length is the square root of this (the distance formula).
         ComponentType length_squared = Vector4<ComponentType>::DotProduct(*this, *this);
-        ComponentType length = sqrt(length_squared);
+        ComponentType length = Number::SquareRoot(length_squared);
         return length;
     }
 }
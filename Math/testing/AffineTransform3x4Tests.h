@@ -0,0 +1,190 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include "Math/AffineTransform3x4.h"
+#include "Math/Angle.h"
+#include "Math/Matrix4x4.h"
+#include "Math/Quaternion.h"
+#include "Math/Vector3.h"
+#include "Math/Vector4.h"
+#include "Processor/CpuFeatures.h"
+
+/// A namespace for testing the AffineTransform3x4 class.
+namespace AFFINE_TRANSFORM_3X4_TESTS
+{
+    /// Creates a transform with translation, rotation, and non-uniform scaling.
+    /// @return The transform for testing.
+    MATH::AffineTransform3x4 CreateAffineTransformTestTransform()
+    {
+        MATH::Quaternionf rotation = MATH::Quaternionf::FromEulerAngles(MATH::Vector3<MATH::Angle<float>::Radians>(
+            MATH::Angle<float>::Radians(0.4f),
+            MATH::Angle<float>::Radians(-0.7f),
+            MATH::Angle<float>::Radians(1.3f)));
+        MATH::AffineTransform3x4 transform = MATH::AffineTransform3x4::TranslationRotationScale(
+            MATH::Vector3f(1.5f, -2.25f, 3.1f),
+            rotation,
+            MATH::Vector3f(0.5f, 2.0f, 3.3f));
+        return transform;
+    }
+
+    /// Transforms 8 vectors at once with AVX2.
+    /// @param[in]  transform - The transform to apply.
+    /// @param[in]  vectors - The vectors to transform.
+    /// @param[out] transformed_points - The vectors transformed as points.
+    /// @param[out] transformed_directions - The vectors transformed as directions.
+    /// @param[out] transformed_normals - The vectors transformed as normals.
+    SIMD_TARGET_AVX2 void TransformAffineTestVectors8x(
+        const MATH::AffineTransform3x4& transform,
+        const MATH::Vector3f (&vectors)[8],
+        MATH::Vector3f (&transformed_points)[8],
+        MATH::Vector3f (&transformed_directions)[8],
+        MATH::Vector3f (&transformed_normals)[8])
+    {
+        // LOAD THE VECTORS.
+        alignas(32) float x_components[8];
+        alignas(32) float y_components[8];
+        alignas(32) float z_components[8];
+        for (std::size_t vector_index = 0; vector_index < 8; ++vector_index)
+        {
+            x_components[vector_index] = vectors[vector_index].X;
+            y_components[vector_index] = vectors[vector_index].Y;
+            z_components[vector_index] = vectors[vector_index].Z;
+        }
+        MATH::Vector3Simd8x vectors_8x = { .X = MATH::Simd8xf::Load(x_components), .Y = MATH::Simd8xf::Load(y_components), .Z = MATH::Simd8xf::Load(z_components) };
+
+        // TRANSFORM THE VECTORS.
+        const MATH::Vector3Simd8x TRANSFORMED_VECTORS[] =
+        {
+            transform.TransformPoints(vectors_8x),
+            transform.TransformDirections(vectors_8x),
+            MATH::AffineTransform3x4::NormalTransform(transform).TransformNormals(vectors_8x),
+        };
+        MATH::Vector3f (*const OUTPUTS[])[8] = { &transformed_points, &transformed_directions, &transformed_normals };
+        for (std::size_t output_index = 0; output_index < 3; ++output_index)
+        {
+            TRANSFORMED_VECTORS[output_index].X.Store(x_components);
+            TRANSFORMED_VECTORS[output_index].Y.Store(y_components);
+            TRANSFORMED_VECTORS[output_index].Z.Store(z_components);
+            for (std::size_t vector_index = 0; vector_index < 8; ++vector_index)
+            {
+                (*OUTPUTS[output_index])[vector_index] = MATH::Vector3f(x_components[vector_index], y_components[vector_index], z_components[vector_index]);
+            }
+        }
+    }
+
+    TEST_CASE("Affine transforms exactly match transforming homogeneous vectors with equivalent 4x4 matrices.", "[AffineTransform3x4]")
+    {
+        // CREATE AN AFFINE TRANSFORM AND EQUIVALENT MATRIX.
+        const MATH::AffineTransform3x4 TRANSFORM = CreateAffineTransformTestTransform();
+        const MATH::Matrix4x4f MATRIX = TRANSFORM.ToMatrix4x4();
+        REQUIRE(TRANSFORM == MATH::AffineTransform3x4::FromMatrix4x4(MATRIX));
+
+        // VERIFY POINTS AND DIRECTIONS ARE TRANSFORMED THE SAME.
+        const MATH::Vector3f VECTOR(-1.25f, 0.3f, 7.5f);
+        MATH::Vector4f expected_point = MATRIX * MATH::Vector4f::HomogeneousPositionVector(VECTOR);
+        REQUIRE(MATH::Vector3f(expected_point.X, expected_point.Y, expected_point.Z) == TRANSFORM.TransformPoint(VECTOR));
+        MATH::Vector4f expected_direction = MATRIX * MATH::Vector4f(VECTOR.X, VECTOR.Y, VECTOR.Z, 0.0f);
+        REQUIRE(MATH::Vector3f(expected_direction.X, expected_direction.Y, expected_direction.Z) == TRANSFORM.TransformDirection(VECTOR));
+
+        // VERIFY COMPOSITION MATCHES MATRIX MULTIPLICATION.
+        const MATH::AffineTransform3x4 OTHER_TRANSFORM = MATH::AffineTransform3x4::Translation(MATH::Vector3f(-4.0f, 0.5f, 2.0f)) * MATH::AffineTransform3x4::Scale(MATH::Vector3f(1.0f, -3.0f, 0.25f));
+        MATH::AffineTransform3x4 combined_transform = TRANSFORM * OTHER_TRANSFORM;
+        REQUIRE(MATH::AffineTransform3x4::FromMatrix4x4(MATRIX * OTHER_TRANSFORM.ToMatrix4x4()) == combined_transform);
+    }
+
+    TEST_CASE("Affine transforms match composing separate translation, rotation, and scaling matrices.", "[AffineTransform3x4]")
+    {
+        // CREATE THE SAME TRANSFORM FROM SEPARATE MATRICES.
+        const MATH::Vector3<MATH::Angle<float>::Radians> ANGLES(
+            MATH::Angle<float>::Radians(0.4f),
+            MATH::Angle<float>::Radians(-0.7f),
+            MATH::Angle<float>::Radians(1.3f));
+        MATH::Matrix4x4f expected_matrix =
+            MATH::Matrix4x4f::Translation(MATH::Vector3f(1.5f, -2.25f, 3.1f)) *
+            MATH::Matrix4x4f::Rotation(ANGLES) *
+            MATH::Matrix4x4f::Scale(MATH::Vector3f(0.5f, 2.0f, 3.3f));
+
+        // VERIFY THE TRANSFORMS MATCH.
+        MATH::Matrix4x4f actual_matrix = CreateAffineTransformTestTransform().ToMatrix4x4();
+        for (unsigned int row_index = 0; row_index < MATH::Matrix4x4f::ROW_COUNT; ++row_index)
+        {
+            for (unsigned int column_index = 0; column_index < MATH::Matrix4x4f::COLUMN_COUNT; ++column_index)
+            {
+                REQUIRE(expected_matrix.Elements(column_index, row_index) == Approx(actual_matrix.Elements(column_index, row_index)).margin(0.00001f));
+            }
+        }
+    }
+
+    TEST_CASE("Affine transforms can be inverted.", "[AffineTransform3x4]")
+    {
+        // INVERT A TRANSFORM.
+        const MATH::AffineTransform3x4 TRANSFORM = CreateAffineTransformTestTransform();
+        MATH::AffineTransform3x4 inverse_transform = MATH::AffineTransform3x4::Inverse(TRANSFORM);
+
+        // VERIFY THE INVERSE UNDOES THE TRANSFORM.
+        MATH::AffineTransform3x4 identity_transform = inverse_transform * TRANSFORM;
+        MATH::AffineTransform3x4 expected_identity_transform = MATH::AffineTransform3x4::Identity();
+        for (unsigned int row_index = 0; row_index < MATH::AffineTransform3x4::ROW_COUNT; ++row_index)
+        {
+            for (unsigned int column_index = 0; column_index < MATH::AffineTransform3x4::COLUMN_COUNT; ++column_index)
+            {
+                REQUIRE(expected_identity_transform.Elements(column_index, row_index) == Approx(identity_transform.Elements(column_index, row_index)).margin(0.00001f));
+            }
+        }
+
+        // VERIFY NON-INVERTIBLE TRANSFORMS PRODUCE ZERO TRANSFORMS.
+        MATH::AffineTransform3x4 flattening_transform = MATH::AffineTransform3x4::Scale(MATH::Vector3f(1.0f, 0.0f, 1.0f));
+        REQUIRE(MATH::AffineTransform3x4() == MATH::AffineTransform3x4::Inverse(flattening_transform));
+    }
+
+    TEST_CASE("Transformed normals remain perpendicular to transformed surfaces under affine transforms.", "[AffineTransform3x4]")
+    {
+        const MATH::AffineTransform3x4 TRANSFORM = CreateAffineTransformTestTransform();
+        MATH::Vector3f transformed_tangent = TRANSFORM.TransformDirection(MATH::Vector3f::Normalize(MATH::Vector3f(1.0f, 1.0f, 0.0f)));
+        MATH::Vector3f transformed_normal = MATH::AffineTransform3x4::NormalTransform(TRANSFORM).TransformNormal(MATH::Vector3f::Normalize(MATH::Vector3f(1.0f, -1.0f, 0.0f)));
+
+        float dot_product = MATH::Vector3f::DotProduct(transformed_tangent, transformed_normal);
+        REQUIRE(0.0f == Approx(dot_product).margin(0.00001f));
+        REQUIRE(1.0f == Approx(transformed_normal.Length()));
+    }
+
+    TEST_CASE("SIMD affine transforms exactly match transforming each vector individually.", "[AffineTransform3x4]")
+    {
+        // SKIP THE TEST IF AVX2 ISN'T SUPPORTED.
+        bool avx2_supported = (PROCESSOR::SimdInstructionSet::AVX2 <= PROCESSOR::CpuFeatures::DetectSupportedSimdInstructionSet());
+        if (!avx2_supported)
+        {
+            return;
+        }
+
+        // TRANSFORM VECTORS WITH SIMD.
+        const MATH::AffineTransform3x4 TRANSFORM = CreateAffineTransformTestTransform();
+        const MATH::Vector3f VECTORS[8] =
+        {
+            MATH::Vector3f(1.0f, 2.0f, 3.0f),
+            MATH::Vector3f(-0.5f, 0.25f, 9.0f),
+            MATH::Vector3f(0.0f, 0.0f, 0.0f),
+            MATH::Vector3f(3.7f, -1.2f, 0.01f),
+            MATH::Vector3f(-8.0f, 4.5f, -2.25f),
+            MATH::Vector3f(0.3f, 0.3f, 0.3f),
+            MATH::Vector3f(100.0f, -50.0f, 25.0f),
+            MATH::Vector3f(-0.001f, 0.002f, -0.003f),
+        };
+        MATH::Vector3f transformed_points[8];
+        MATH::Vector3f transformed_directions[8];
+        MATH::Vector3f transformed_normals[8];
+        TransformAffineTestVectors8x(TRANSFORM, VECTORS, transformed_points, transformed_directions, transformed_normals);
+
+        // VERIFY THE RESULTS MATCH TRANSFORMING EACH VECTOR INDIVIDUALLY.
+        const MATH::AffineTransform3x4 NORMAL_TRANSFORM = MATH::AffineTransform3x4::NormalTransform(TRANSFORM);
+        std::size_t mismatched_vector_count = 0;
+        for (std::size_t vector_index = 0; vector_index < 8; ++vector_index)
+        {
+            mismatched_vector_count += (TRANSFORM.TransformPoint(VECTORS[vector_index]) != transformed_points[vector_index]);
+            mismatched_vector_count += (TRANSFORM.TransformDirection(VECTORS[vector_index]) != transformed_directions[vector_index]);
+            mismatched_vector_count += (NORMAL_TRANSFORM.TransformNormal(VECTORS[vector_index]) != transformed_normals[vector_index]);
+        }
+        REQUIRE(0 == mismatched_vector_count);
+    }
+}
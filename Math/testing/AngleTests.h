@@ -1,5 +1,6 @@
 #pragma once
 
+#include <numbers>
 #include "Math/Angle.h"
 
 /// A namespace for testing the code in the corresponding class.
@@ -108,7 +109,7 @@ namespace ANGLE_TESTS
         MATH::Angle<float>::Radians radians_0 = MATH::Angle<float>::DegreesToRadians(degrees_0);
         REQUIRE(0.0f == radians_0.Value);
 
-        constexpr float PI = 3.14159f;
+        constexpr float PI = std::numbers::pi_v<float>;
         MATH::Angle<float>::Degrees degrees_30(30.0f);
         MATH::Angle<float>::Radians radians_pi_over_6 = MATH::Angle<float>::DegreesToRadians(degrees_30);
         REQUIRE((PI / 6.0f) == radians_pi_over_6.Value);
@@ -147,7 +148,7 @@ namespace ANGLE_TESTS
 
         MATH::Angle<float>::Degrees degrees_225(225.0f);
         MATH::Angle<float>::Radians radians_5_pi_over_4 = MATH::Angle<float>::DegreesToRadians(degrees_225);
-        REQUIRE((5.0f * PI / 4.0f) == radians_5_pi_over_4.Value);
+        REQUIRE(Approx(5.0f * PI / 4.0f) == radians_5_pi_over_4.Value);
 
         MATH::Angle<float>::Degrees degrees_240(240.0f);
         MATH::Angle<float>::Radians radians_4_pi_over_3 = MATH::Angle<float>::DegreesToRadians(degrees_240);
@@ -163,7 +164,7 @@ namespace ANGLE_TESTS
 
         MATH::Angle<float>::Degrees degrees_315(315.0f);
         MATH::Angle<float>::Radians radians_7_pi_over_4 = MATH::Angle<float>::DegreesToRadians(degrees_315);
-        REQUIRE((7.0f * PI / 4.0f) == radians_7_pi_over_4.Value);
+        REQUIRE(Approx(7.0f * PI / 4.0f) == radians_7_pi_over_4.Value);
 
         MATH::Angle<float>::Degrees degrees_330(330.0f);
         MATH::Angle<float>::Radians radians_11_pi_over_6 = MATH::Angle<float>::DegreesToRadians(degrees_330);
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+#include "Math/BatchTransforms.h"
+#include "Math/Matrix4x4.h"
+#include "Math/Vector3.h"
+#include "Math/Vector4.h"
+#include "Processor/CpuFeatures.h"
+
+/// A namespace for testing the BatchTransforms class.
+namespace BATCH_TRANSFORMS_TESTS
+{
+    /// Creates a transform with translation, rotation, and non-uniform scaling.
+    /// @return The transform for testing.
+    MATH::Matrix4x4f CreateBatchTransformTestMatrix()
+    {
+        MATH::Matrix4x4f transform =
+            MATH::Matrix4x4f::Translation(MATH::Vector3f(1.5f, -2.25f, 3.1f)) *
+            MATH::Matrix4x4f::Rotation(MATH::Vector3<MATH::Angle<float>::Radians>(
+                MATH::Angle<float>::Radians(0.4f),
+                MATH::Angle<float>::Radians(-0.7f),
+                MATH::Angle<float>::Radians(1.3f))) *
+            MATH::Matrix4x4f::Scale(MATH::Vector3f(0.5f, 2.0f, 3.3f));
+        return transform;
+    }
+
+    /// Creates vectors with varied components for testing.
+    /// @param[in]  vector_count - The number of vectors to create.
+    /// @return The vectors for testing.
+    std::vector<MATH::Vector3f> CreateBatchTransformTestVectors(const std::size_t vector_count)
+    {
+        std::vector<MATH::Vector3f> vectors;
+        for (std::size_t vector_index = 0; vector_index < vector_count; ++vector_index)
+        {
+            float index = static_cast<float>(vector_index);
+            vectors.emplace_back(std::sin(index) * 3.7f, std::cos(index * 1.3f) - 0.4f, 0.1f * index + 2.0f);
+        }
+        return vectors;
+    }
+
+    TEST_CASE("Batch transforms exactly match transforming each vector individually for every instruction set and layout.", "[BatchTransforms]")
+    {
+        // TEST ALL INSTRUCTION SETS.
+        // Unsupported instruction sets will fall back to supported ones.
+        auto instruction_set = GENERATE(
+            PROCESSOR::SimdInstructionSet::SCALAR,
+            PROCESSOR::SimdInstructionSet::SSE4,
+            PROCESSOR::SimdInstructionSet::AVX2,
+            PROCESSOR::SimdInstructionSet::AVX512);
+        PROCESSOR::CpuFeatures::ForceSimdInstructionSet(instruction_set);
+
+        // CREATE A TRANSFORM WITH A PERSPECTIVE DIVIDE.
+        // All test vectors have z components large enough for w components to be positive.
+        MATH::Matrix4x4f transform = CreateBatchTransformTestMatrix();
+        transform.Elements(2, 3) = 0.25f;
+
+        // TEST COUNTS THAT DO AND DON'T FILL ENTIRE SIMD REGISTERS.
+        const MATH::Matrix4x4f NORMAL_TRANSFORM = MATH::Matrix4x4f::Transpose(MATH::Matrix4x4f::Inverse(transform));
+        constexpr std::size_t MAX_VECTOR_COUNT = 37;
+        std::size_t mismatched_vector_count = 0;
+        for (std::size_t vector_count = 0; vector_count <= MAX_VECTOR_COUNT; ++vector_count)
+        {
+            // COMPUTE THE EXPECTED TRANSFORMS FOR EACH VECTOR.
+            std::vector<MATH::Vector3f> vectors = CreateBatchTransformTestVectors(vector_count);
+            std::vector<MATH::Vector3f> expected_points;
+            std::vector<MATH::Vector3f> expected_projected_points;
+            std::vector<MATH::Vector3f> expected_directions;
+            std::vector<MATH::Vector3f> expected_normals;
+            for (const MATH::Vector3f& vector : vectors)
+            {
+                MATH::Vector4f point = transform * MATH::Vector4f::HomogeneousPositionVector(vector);
+                expected_points.emplace_back(point.X, point.Y, point.Z);
+                expected_projected_points.emplace_back(point.X / point.W, point.Y / point.W, point.Z / point.W);
+
+                MATH::Vector4f direction = transform * MATH::Vector4f(vector.X, vector.Y, vector.Z, 0.0f);
+                expected_directions.emplace_back(direction.X, direction.Y, direction.Z);
+
+                MATH::Vector4f normal = NORMAL_TRANSFORM * MATH::Vector4f(vector.X, vector.Y, vector.Z, 0.0f);
+                expected_normals.push_back(MATH::Vector3f::Normalize(MATH::Vector3f(normal.X, normal.Y, normal.Z)));
+            }
+
+            // transform VECTORS STORED AS ARRAYS OF STRUCTURES.
+            std::vector<MATH::Vector3f> points(vector_count);
+            MATH::BatchTransforms::TransformPoints(transform, vectors, points);
+            std::vector<MATH::Vector3f> projected_points(vector_count);
+            MATH::BatchTransforms::TransformPointsWithPerspectiveDivide(transform, vectors, projected_points);
+            std::vector<MATH::Vector3f> directions(vector_count);
+            MATH::BatchTransforms::TransformDirections(transform, vectors, directions);
+            std::vector<MATH::Vector3f> normals(vector_count);
+            MATH::BatchTransforms::TransformNormals(transform, vectors, normals);
+
+            mismatched_vector_count += (expected_points != points);
+            mismatched_vector_count += (expected_projected_points != projected_points);
+            mismatched_vector_count += (expected_directions != directions);
+            mismatched_vector_count += (expected_normals != normals);
+
+            // transform VECTORS STORED AS STRUCTURES OF ARRAYS.
+            std::vector<float> x_components;
+            std::vector<float> y_components;
+            std::vector<float> z_components;
+            for (const MATH::Vector3f& vector : vectors)
+            {
+                x_components.push_back(vector.X);
+                y_components.push_back(vector.Y);
+                z_components.push_back(vector.Z);
+            }
+            const MATH::Vector3Spans<const float> VECTOR_COMPONENTS = { .X = x_components, .Y = y_components, .Z = z_components };
+
+            std::vector<float> transformed_x_components(vector_count);
+            std::vector<float> transformed_y_components(vector_count);
+            std::vector<float> transformed_z_components(vector_count);
+            const MATH::Vector3Spans<float> TRANSFORMED_COMPONENTS = { .X = transformed_x_components, .Y = transformed_y_components, .Z = transformed_z_components };
+            auto count_mismatched_components = [&](const std::vector<MATH::Vector3f>& expected_vectors)
+            {
+                std::size_t mismatched_component_count = 0;
+                for (std::size_t vector_index = 0; vector_index < vector_count; ++vector_index)
+                {
+                    MATH::Vector3f transformed_vector(transformed_x_components[vector_index], transformed_y_components[vector_index], transformed_z_components[vector_index]);
+                    mismatched_component_count += (expected_vectors[vector_index] != transformed_vector);
+                }
+                return mismatched_component_count;
+            };
+
+            MATH::BatchTransforms::TransformPoints(transform, VECTOR_COMPONENTS, TRANSFORMED_COMPONENTS);
+            mismatched_vector_count += count_mismatched_components(expected_points);
+            MATH::BatchTransforms::TransformPointsWithPerspectiveDivide(transform, VECTOR_COMPONENTS, TRANSFORMED_COMPONENTS);
+            mismatched_vector_count += count_mismatched_components(expected_projected_points);
+            MATH::BatchTransforms::TransformDirections(transform, VECTOR_COMPONENTS, TRANSFORMED_COMPONENTS);
+            mismatched_vector_count += count_mismatched_components(expected_directions);
+            MATH::BatchTransforms::TransformNormals(transform, VECTOR_COMPONENTS, TRANSFORMED_COMPONENTS);
+            mismatched_vector_count += count_mismatched_components(expected_normals);
+
+            // transform VECTORS IN-PLACE.
+            MATH::BatchTransforms::TransformPoints(transform, vectors, vectors);
+            mismatched_vector_count += (expected_points != vectors);
+        }
+        REQUIRE(0 == mismatched_vector_count);
+
+        PROCESSOR::CpuFeatures::ForceSimdInstructionSet(std::nullopt);
+    }
+
+    TEST_CASE("Transformed normals remain perpendicular to transformed surfaces under non-uniform scaling.", "[BatchTransforms]")
+    {
+        // TRANSFORM A SURFACE TANGENT AND NORMAL.
+        const MATH::Matrix4x4f TRANSFORM = CreateBatchTransformTestMatrix();
+        const std::vector<MATH::Vector3f> TANGENTS = { MATH::Vector3f::Normalize(MATH::Vector3f(1.0f, 1.0f, 0.0f)) };
+        const std::vector<MATH::Vector3f> NORMALS = { MATH::Vector3f::Normalize(MATH::Vector3f(1.0f, -1.0f, 0.0f)) };
+        std::vector<MATH::Vector3f> transformed_tangents(TANGENTS.size());
+        MATH::BatchTransforms::TransformDirections(TRANSFORM, TANGENTS, transformed_tangents);
+        std::vector<MATH::Vector3f> transformed_normals(NORMALS.size());
+        MATH::BatchTransforms::TransformNormals(TRANSFORM, NORMALS, transformed_normals);
+
+        // VERIFY THE NORMAL IS STILL A PERPENDICULAR UNIT VECTOR.
+        float dot_product = MATH::Vector3f::DotProduct(transformed_tangents[0], transformed_normals[0]);
+        REQUIRE(0.0f == Approx(dot_product).margin(0.00001f));
+        REQUIRE(1.0f == Approx(transformed_normals[0].Length()));
+    }
+
+    TEST_CASE("Batch transforms of arrays split across threads match transforming each vector individually.", "[BatchTransforms]")
+    {
+        // TRANSFORM AN ARRAY LARGE ENOUGH FOR MULTIPLE THREADS.
+        // The count doesn't fill entire SIMD registers or cache lines.
+        constexpr std::size_t VECTOR_COUNT = 2 * MATH::BatchTransforms::PARALLEL_TRANSFORM_MIN_VECTOR_COUNT_PER_THREAD + 13;
+        const MATH::Matrix4x4f TRANSFORM = CreateBatchTransformTestMatrix();
+        std::vector<MATH::Vector3f> vectors = CreateBatchTransformTestVectors(VECTOR_COUNT);
+        std::vector<MATH::Vector3f> transformed_vectors(VECTOR_COUNT);
+        MATH::BatchTransforms::TransformPoints(TRANSFORM, vectors, transformed_vectors);
+
+        // VERIFY EACH VECTOR WAS TRANSFORMED.
+        std::size_t mismatched_vector_count = 0;
+        for (std::size_t vector_index = 0; vector_index < VECTOR_COUNT; ++vector_index)
+        {
+            MATH::Vector4f expected_point = TRANSFORM * MATH::Vector4f::HomogeneousPositionVector(vectors[vector_index]);
+            MATH::Vector3f expected_vector(expected_point.X, expected_point.Y, expected_point.Z);
+            mismatched_vector_count += (expected_vector != transformed_vectors[vector_index]);
+        }
+        REQUIRE(0 == mismatched_vector_count);
+    }
+}
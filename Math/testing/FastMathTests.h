@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include "Math/FastMath.h"
+
+/// A namespace for testing the code in the corresponding class.
+/// These tests document the error bounds of each approximation by comparing against
+/// double precision standard library results across wide ranges of inputs.
+namespace FAST_MATH_TESTS
+{
+    TEST_CASE("Fast reciprocal square roots have a relative error of at most 1e-6.", "[FastMath][ReciprocalSquareRoot]")
+    {
+        double max_relative_error = 0.0;
+        for (float number = 1e-30f; number < 1e30f; number *= 1.0137f)
+        {
+            double expected_reciprocal_square_root = 1.0 / std::sqrt(static_cast<double>(number));
+            double reciprocal_square_root = MATH::FastMath::ReciprocalSquareRoot(number);
+            double relative_error = std::abs(reciprocal_square_root - expected_reciprocal_square_root) / expected_reciprocal_square_root;
+            max_relative_error = std::max(max_relative_error, relative_error);
+        }
+        REQUIRE(max_relative_error <= 1e-6);
+    }
+
+    TEST_CASE("Fast normalization produces unit vectors in the same direction.", "[FastMath][Normalize]")
+    {
+        MATH::Vector3f original_vector(2.0f, 5.0f, 3.0f);
+        MATH::Vector3f normalized_vector = MATH::FastMath::Normalize(original_vector);
+        MATH::Vector3f expected_normalized_vector = MATH::Vector3f::Normalize(original_vector);
+
+        constexpr float MAX_ERROR = 1e-6f;
+        CHECK(expected_normalized_vector.X == Approx(normalized_vector.X).margin(MAX_ERROR));
+        CHECK(expected_normalized_vector.Y == Approx(normalized_vector.Y).margin(MAX_ERROR));
+        CHECK(expected_normalized_vector.Z == Approx(normalized_vector.Z).margin(MAX_ERROR));
+    }
+
+    TEST_CASE("Fast normalization leaves zero vectors as zero.", "[FastMath][Normalize]")
+    {
+        MATH::Vector3f normalized_vector = MATH::FastMath::Normalize(MATH::Vector3f(0.0f, 0.0f, 0.0f));
+        CHECK(0.0f == normalized_vector.X);
+        CHECK(0.0f == normalized_vector.Y);
+        CHECK(0.0f == normalized_vector.Z);
+    }
+
+    TEST_CASE("Fast base-2 logarithms have an error of at most 1e-6 * max(1, |log2(number)|).", "[FastMath][Log2]")
+    {
+        double max_scaled_error = 0.0;
+        for (float number = 1e-30f; number < 1e30f; number *= 1.00137f)
+        {
+            double expected_logarithm = std::log2(static_cast<double>(number));
+            double logarithm = MATH::FastMath::Log2(number);
+            double scaled_error = std::abs(logarithm - expected_logarithm) / std::max(1.0, std::abs(expected_logarithm));
+            max_scaled_error = std::max(max_scaled_error, scaled_error);
+        }
+        REQUIRE(max_scaled_error <= 1e-6);
+    }
+
+    TEST_CASE("Fast base-2 exponentials have a relative error of at most 1e-6.", "[FastMath][Exp2]")
+    {
+        double max_relative_error = 0.0;
+        for (float exponent = -126.0f; exponent <= 127.0f; exponent += 0.00123f)
+        {
+            double expected_power = std::exp2(static_cast<double>(exponent));
+            double power = MATH::FastMath::Exp2(exponent);
+            double relative_error = std::abs(power - expected_power) / expected_power;
+            max_relative_error = std::max(max_relative_error, relative_error);
+        }
+        REQUIRE(max_relative_error <= 1e-6);
+    }
+
+    TEST_CASE("Fast powers have a relative error of at most 1e-6 + 1e-6 * |exponent * log2(base)|.", "[FastMath][Power]")
+    {
+        // CHECK BASES AND EXPONENTS TYPICAL FOR SPECULAR HIGHLIGHTS.
+        // The error is measured relative to the error bound, which depends on the base.
+        float exponent = GENERATE(0.5f, 1.0f, 2.0f, 5.0f, 10.0f, 32.5f, 100.0f, 500.0f, 1000.0f);
+        double max_error_proportion_of_bound = 0.0;
+        for (float base = 0.0001f; base <= 1.0f; base += 0.0001f)
+        {
+            // SKIP POWERS TOO SMALL TO BE NORMAL FLOATS.
+            double expected_power = std::pow(static_cast<double>(base), static_cast<double>(exponent));
+            if (expected_power < FLT_MIN)
+            {
+                continue;
+            }
+
+            double power = MATH::FastMath::Power(base, exponent);
+            double relative_error = std::abs(power - expected_power) / expected_power;
+            double max_relative_error = 1e-6 + 1e-6 * std::abs(exponent * std::log2(static_cast<double>(base)));
+            max_error_proportion_of_bound = std::max(max_error_proportion_of_bound, relative_error / max_relative_error);
+        }
+        REQUIRE(max_error_proportion_of_bound <= 1.0);
+    }
+
+    TEST_CASE("Fast powers exactly handle special cases like the standard library.", "[FastMath][Power]")
+    {
+        CHECK(1.0f == MATH::FastMath::Power(0.0f, 0.0f));
+        CHECK(1.0f == MATH::FastMath::Power(0.5f, 0.0f));
+        CHECK(0.0f == MATH::FastMath::Power(0.0f, 10.0f));
+    }
+}
@@ -1,8 +1,16 @@
 #define CATCH_CONFIG_MAIN
 #include <catch.hpp>
+#include "AffineTransform3x4Tests.h"
 #include "AngleTests.h"
+#include "BatchTransformsTests.h"
+#include "FastMathTests.h"
+#include "Matrix4x4Tests.h"
 #include "NumberTests.h"
+#include "PowerLookupTableTests.h"
+#include "QuaternionTests.h"
 #include "RandomNumberGeneratorTests.h"
+#include "RectangleTests.h"
+#include "SimdTests.h"
 #include "Vector2Tests.h"
 #include "Vector3Tests.h"
 #include "Vector4Tests.h"
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <array>
+#include "Math/Matrix4x4.h"
+
+/// A namespace for testing the code in the corresponding class.
+namespace MATRIX_4X4_TESTS
+{
+    TEST_CASE("A 4x4 matrix multiplied by its inverse is the identity matrix.", "[Matrix4x4][Inverse]")
+    {
+        MATH::Matrix4x4f matrix =
+            MATH::Matrix4x4f::Translation(MATH::Vector3f(1.0f, -2.0f, 3.0f)) *
+            MATH::Matrix4x4f::RotateY(MATH::Angle<float>::Radians(0.5f)) *
+            MATH::Matrix4x4f::Scale(MATH::Vector3f(2.0f, 3.0f, 0.5f));
+        MATH::Matrix4x4f inverse_matrix = MATH::Matrix4x4f::Inverse(matrix);
+
+        MATH::Matrix4x4f product = matrix * inverse_matrix;
+        MATH::Matrix4x4f identity_matrix = MATH::Matrix4x4f::Identity();
+        for (unsigned int row_index = 0; row_index < MATH::Matrix4x4f::ROW_COUNT; ++row_index)
+        {
+            for (unsigned int column_index = 0; column_index < MATH::Matrix4x4f::COLUMN_COUNT; ++column_index)
+            {
+                CHECK(product.Elements(column_index, row_index) == Approx(identity_matrix.Elements(column_index, row_index)).margin(0.00001f));
+            }
+        }
+
+        MATH::Vector4f point(4.0f, 5.0f, 6.0f, 1.0f);
+        MATH::Vector4f round_trip_point = inverse_matrix * (matrix * point);
+        CHECK(Approx(point.X) == round_trip_point.X);
+        CHECK(Approx(point.Y) == round_trip_point.Y);
+        CHECK(Approx(point.Z) == round_trip_point.Z);
+        CHECK(Approx(point.W) == round_trip_point.W);
+    }
+
+    TEST_CASE("The inverse of a singular 4x4 matrix is all zeros.", "[Matrix4x4][Inverse]")
+    {
+        MATH::Matrix4x4f singular_matrix = MATH::Matrix4x4f::Scale(MATH::Vector3f(1.0f, 0.0f, 1.0f));
+        MATH::Matrix4x4f inverse_matrix = MATH::Matrix4x4f::Inverse(singular_matrix);
+
+        for (unsigned int row_index = 0; row_index < MATH::Matrix4x4f::ROW_COUNT; ++row_index)
+        {
+            for (unsigned int column_index = 0; column_index < MATH::Matrix4x4f::COLUMN_COUNT; ++column_index)
+            {
+                CHECK(0.0f == inverse_matrix.Elements(column_index, row_index));
+            }
+        }
+    }
+
+    TEST_CASE("4x4 matrix products exactly match sums of element products.", "[Matrix4x4]")
+    {
+        // CREATE MATRICES AND A VECTOR WITH VALUES THAT ROUND DIFFERENTLY IF SUMMED IN A DIFFERENT ORDER.
+        MATH::Matrix4x4f lhs_matrix =
+            MATH::Matrix4x4f::Translation(MATH::Vector3f(1.1f, -2.3f, 3.7f)) *
+            MATH::Matrix4x4f::Rotation(MATH::Vector3<MATH::Angle<float>::Radians>(
+                MATH::Angle<float>::Radians(0.3f),
+                MATH::Angle<float>::Radians(-1.1f),
+                MATH::Angle<float>::Radians(2.2f)));
+        lhs_matrix.Elements(0, 3) = 0.17f;
+        lhs_matrix.Elements(2, 3) = -0.31f;
+        MATH::Matrix4x4f rhs_matrix = MATH::Matrix4x4f::Inverse(lhs_matrix) * MATH::Matrix4x4f::Scale(MATH::Vector3f(0.7f, 1.9f, -3.3f));
+        MATH::Vector4f vector(0.9f, -4.1f, 2.6f, 1.3f);
+
+        // VERIFY THE MATRIX PRODUCT.
+        MATH::Matrix4x4f matrix_product = lhs_matrix * rhs_matrix;
+        for (unsigned int row_index = 0; row_index < MATH::Matrix4x4f::ROW_COUNT; ++row_index)
+        {
+            for (unsigned int column_index = 0; column_index < MATH::Matrix4x4f::COLUMN_COUNT; ++column_index)
+            {
+                float expected_element = lhs_matrix.Elements(0, row_index) * rhs_matrix.Elements(column_index, 0);
+                expected_element += lhs_matrix.Elements(1, row_index) * rhs_matrix.Elements(column_index, 1);
+                expected_element += lhs_matrix.Elements(2, row_index) * rhs_matrix.Elements(column_index, 2);
+                expected_element += lhs_matrix.Elements(3, row_index) * rhs_matrix.Elements(column_index, 3);
+                CHECK(expected_element == matrix_product.Elements(column_index, row_index));
+            }
+        }
+
+        // VERIFY THE TRANSFORMED VECTOR.
+        MATH::Vector4f transformed_vector = lhs_matrix * vector;
+        std::array<float, MATH::Matrix4x4f::ROW_COUNT> transformed_components = { transformed_vector.X, transformed_vector.Y, transformed_vector.Z, transformed_vector.W };
+        for (unsigned int row_index = 0; row_index < MATH::Matrix4x4f::ROW_COUNT; ++row_index)
+        {
+            float expected_component = lhs_matrix.Elements(0, row_index) * vector.X;
+            expected_component += lhs_matrix.Elements(1, row_index) * vector.Y;
+            expected_component += lhs_matrix.Elements(2, row_index) * vector.Z;
+            expected_component += lhs_matrix.Elements(3, row_index) * vector.W;
+            CHECK(expected_component == transformed_components[row_index]);
+        }
+    }
+
+    TEST_CASE("4x4 matrices can be built and multiplied in constant expressions.", "[Matrix4x4]")
+    {
+        constexpr MATH::Matrix4x4f SCALED_IDENTITY = []()
+        {
+            MATH::Matrix4x4f scale_matrix = MATH::Matrix4x4f::Identity();
+            scale_matrix.Elements(0, 0) = 2.0f;
+            scale_matrix.Elements(3, 1) = 5.0f;
+            return MATH::Matrix4x4f::Identity() * scale_matrix * scale_matrix;
+        }();
+
+        STATIC_REQUIRE(4.0f == SCALED_IDENTITY.Elements(0, 0));
+        STATIC_REQUIRE(1.0f == SCALED_IDENTITY.Elements(1, 1));
+        STATIC_REQUIRE(10.0f == SCALED_IDENTITY.Elements(3, 1));
+        STATIC_REQUIRE(0.0f == SCALED_IDENTITY.Elements(1, 0));
+    }
+
+    TEST_CASE("4x4 matrices built at compile time match those built at runtime.", "[Matrix4x4]")
+    {
+        // BUILD A TRANSFORM AT COMPILE TIME.
+        constexpr MATH::Vector3<MATH::Angle<float>::Radians> ANGLES(
+            MATH::Angle<float>::DegreesToRadians(MATH::Angle<float>::Degrees(30.0f)),
+            MATH::Angle<float>::DegreesToRadians(MATH::Angle<float>::Degrees(-45.0f)),
+            MATH::Angle<float>::DegreesToRadians(MATH::Angle<float>::Degrees(60.0f)));
+        constexpr MATH::Matrix4x4f COMPILE_TIME_MATRIX =
+            MATH::Matrix4x4f::Translation(MATH::Vector3f(1.0f, -2.0f, 3.0f)) *
+            MATH::Matrix4x4f::Rotation(ANGLES) *
+            MATH::Matrix4x4f::Scale(MATH::Vector3f(2.0f, 3.0f, 0.5f));
+        constexpr MATH::Vector4f COMPILE_TIME_POINT = COMPILE_TIME_MATRIX * MATH::Vector4f(4.0f, 5.0f, 6.0f, 1.0f);
+        static_assert(1.0f == COMPILE_TIME_POINT.W);
+
+        // VERIFY IT MATCHES THE SAME TRANSFORM BUILT AT RUNTIME.
+        MATH::Matrix4x4f runtime_matrix =
+            MATH::Matrix4x4f::Translation(MATH::Vector3f(1.0f, -2.0f, 3.0f)) *
+            MATH::Matrix4x4f::Rotation(ANGLES) *
+            MATH::Matrix4x4f::Scale(MATH::Vector3f(2.0f, 3.0f, 0.5f));
+        for (unsigned int row_index = 0; row_index < MATH::Matrix4x4f::ROW_COUNT; ++row_index)
+        {
+            for (unsigned int column_index = 0; column_index < MATH::Matrix4x4f::COLUMN_COUNT; ++column_index)
+            {
+                CHECK(runtime_matrix.Elements(column_index, row_index) == Approx(COMPILE_TIME_MATRIX.Elements(column_index, row_index)).margin(0.000001f));
+            }
+        }
+
+        MATH::Vector4f runtime_point = runtime_matrix * MATH::Vector4f(4.0f, 5.0f, 6.0f, 1.0f);
+        CHECK(Approx(runtime_point.X) == COMPILE_TIME_POINT.X);
+        CHECK(Approx(runtime_point.Y) == COMPILE_TIME_POINT.Y);
+        CHECK(Approx(runtime_point.Z) == COMPILE_TIME_POINT.Z);
+    }
+}
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
 #include "Math/Number.h"
 
 /// A namespace for testing the code in the corresponding class.
@@ -112,4 +116,73 @@ namespace NUMBER_TESTS
         int result = MATH::Number::Clamp(NUMBER_TO_CLAMP, MIN_VALUE, MAX_VALUE);
         REQUIRE(NUMBER_TO_CLAMP == result);
     }
+
+    /// Computes square roots at compile time.
+    /// @param[in]  numbers - The numbers to compute square roots of.
+    /// @return The square roots of the numbers.
+    constexpr std::array<float, 8> ComputeNumberTestSquareRoots(const std::array<float, 8>& numbers)
+    {
+        std::array<float, 8> square_roots = {};
+        for (std::size_t number_index = 0; number_index < numbers.size(); ++number_index)
+        {
+            square_roots[number_index] = MATH::Number::SquareRoot(numbers[number_index]);
+        }
+        return square_roots;
+    }
+
+    TEST_CASE("Square roots computed at compile time match the standard library.", "[Number]")
+    {
+        // COMPUTE SQUARE ROOTS AT COMPILE TIME.
+        constexpr std::array<float, 8> NUMBERS = { 0.0f, 1.0f, 2.0f, 0.3f, 16.0f, 12345.678f, 0.00001f, 1.0e30f };
+        constexpr std::array<float, 8> SQUARE_ROOTS = ComputeNumberTestSquareRoots(NUMBERS);
+        static_assert(3.0f == MATH::Number::SquareRoot(9.0f));
+
+        // VERIFY THE SQUARE ROOTS EXACTLY MATCH THOSE COMPUTED AT RUNTIME.
+        for (std::size_t number_index = 0; number_index < NUMBERS.size(); ++number_index)
+        {
+            REQUIRE(std::sqrt(NUMBERS[number_index]) == SQUARE_ROOTS[number_index]);
+            REQUIRE(std::sqrt(NUMBERS[number_index]) == MATH::Number::SquareRoot(NUMBERS[number_index]));
+        }
+    }
+
+    /// Builds a lookup table of sines and cosines at compile time.
+    /// @return Sines and cosines for angles from -4 pi to 4 pi, in that order.
+    constexpr std::array<double, 2 * 65> CreateNumberTestSineAndCosineTable()
+    {
+        constexpr std::size_t ANGLE_COUNT = 65;
+        std::array<double, 2 * ANGLE_COUNT> sines_and_cosines = {};
+        for (std::size_t angle_index = 0; angle_index < ANGLE_COUNT; ++angle_index)
+        {
+            double angle = -4.0 * std::numbers::pi + static_cast<double>(angle_index) * std::numbers::pi / 8.0 + 0.01;
+            sines_and_cosines[angle_index] = MATH::Number::Sine(angle);
+            sines_and_cosines[ANGLE_COUNT + angle_index] = MATH::Number::Cosine(angle);
+        }
+        return sines_and_cosines;
+    }
+
+    TEST_CASE("Sines and cosines computed at compile time closely match the standard library.", "[Number]")
+    {
+        // COMPUTE SINES AND COSINES AT COMPILE TIME.
+        constexpr std::array<double, 2 * 65> SINES_AND_COSINES = CreateNumberTestSineAndCosineTable();
+        static_assert(0.0 == MATH::Number::Sine(0.0));
+        static_assert(1.0 == MATH::Number::Cosine(0.0));
+
+        // VERIFY THE VALUES MATCH THOSE COMPUTED AT RUNTIME.
+        constexpr std::size_t ANGLE_COUNT = 65;
+        for (std::size_t angle_index = 0; angle_index < ANGLE_COUNT; ++angle_index)
+        {
+            double angle = -4.0 * std::numbers::pi + static_cast<double>(angle_index) * std::numbers::pi / 8.0 + 0.01;
+            REQUIRE(std::sin(angle) == Approx(SINES_AND_COSINES[angle_index]).margin(1.0e-14));
+            REQUIRE(std::cos(angle) == Approx(SINES_AND_COSINES[ANGLE_COUNT + angle_index]).margin(1.0e-14));
+            REQUIRE(std::sin(angle) == MATH::Number::Sine(angle));
+            REQUIRE(std::cos(angle) == MATH::Number::Cosine(angle));
+        }
+    }
+
+    TEST_CASE("Absolute values can be computed at compile time.", "[Number]")
+    {
+        static_assert(3 == MATH::Number::AbsoluteValue(-3));
+        static_assert(2.5f == MATH::Number::AbsoluteValue(2.5f));
+        REQUIRE(0.25 == MATH::Number::AbsoluteValue(-0.25));
+    }
 }
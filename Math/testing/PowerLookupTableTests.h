@@ -0,0 +1,43 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include "Math/PowerLookupTable.h"
+
+/// A namespace for testing the code in the corresponding class.
+namespace POWER_LOOKUP_TABLE_TESTS
+{
+    TEST_CASE("Power lookup table errors are within the bound for linear interpolation.", "[PowerLookupTable]")
+    {
+        // CREATE A TABLE FOR AN EXPONENT TYPICAL FOR SPECULAR HIGHLIGHTS.
+        float exponent = GENERATE(2.0f, 5.0f, 10.0f, 32.5f, 100.0f, 500.0f);
+        MATH::PowerLookupTable power_lookup_table(exponent);
+
+        // VERIFY ERRORS ARE WITHIN THE DOCUMENTED BOUND.
+        // A small margin is allowed for float rounding.
+        constexpr double SEGMENT_COUNT = static_cast<double>(MATH::PowerLookupTable::SEGMENT_COUNT);
+        double max_error = exponent * (exponent - 1.0) / (8.0 * SEGMENT_COUNT * SEGMENT_COUNT) + 1e-6;
+        double actual_max_error = 0.0;
+        for (float base = 0.0f; base <= 1.0f; base += 0.00001f)
+        {
+            double expected_power = std::pow(static_cast<double>(base), static_cast<double>(exponent));
+            double power = power_lookup_table.Power(base);
+            actual_max_error = std::max(actual_max_error, std::abs(power - expected_power));
+        }
+        REQUIRE(actual_max_error <= max_error);
+    }
+
+    TEST_CASE("Power lookup tables are exact at the ends of the range.", "[PowerLookupTable]")
+    {
+        MATH::PowerLookupTable power_lookup_table(20.0f);
+        CHECK(0.0f == power_lookup_table.Power(0.0f));
+        CHECK(1.0f == power_lookup_table.Power(1.0f));
+    }
+
+    TEST_CASE("Power lookup tables clamp bases to be within 0 and 1.", "[PowerLookupTable]")
+    {
+        MATH::PowerLookupTable power_lookup_table(3.0f);
+        CHECK(0.0f == power_lookup_table.Power(-0.5f));
+        CHECK(1.0f == power_lookup_table.Power(1.5f));
+    }
+}
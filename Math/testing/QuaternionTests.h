@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Math/Angle.h"
+#include "Math/Matrix4x4.h"
+#include "Math/Quaternion.h"
+#include "Math/Vector3.h"
+#include "Math/Vector4.h"
+
+/// A namespace for testing the Quaternion class.
+namespace QUATERNION_TESTS
+{
+    TEST_CASE("The identity quaternion doesn't rotate vectors.", "[Quaternion]")
+    {
+        const MATH::Vector3f VECTOR(1.5f, -2.0f, 3.25f);
+        MATH::Vector3f rotated_vector = MATH::Quaternionf::Identity().Rotate(VECTOR);
+        REQUIRE(VECTOR == rotated_vector);
+    }
+
+    TEST_CASE("A quaternion can rotate a vector about an axis.", "[Quaternion]")
+    {
+        // ROTATE A VECTOR A QUARTER TURN ABOUT THE Z AXIS.
+        const MATH::Vector3f Z_AXIS(0.0f, 0.0f, 1.0f);
+        MATH::Quaternionf rotation = MATH::Quaternionf::FromAxisAngle(Z_AXIS, MATH::Angle<float>::Radians(1.5707963f));
+        MATH::Vector3f rotated_vector = rotation.Rotate(MATH::Vector3f(1.0f, 0.0f, 0.0f));
+
+        // VERIFY THE VECTOR WAS ROTATED COUNTERCLOCKWISE.
+        REQUIRE(0.0f == Approx(rotated_vector.X).margin(0.00001f));
+        REQUIRE(1.0f == Approx(rotated_vector.Y));
+        REQUIRE(0.0f == Approx(rotated_vector.Z).margin(0.00001f));
+    }
+
+    TEST_CASE("Quaternions from Euler angles rotate the same as rotation matrices.", "[Quaternion]")
+    {
+        // CREATE THE SAME ROTATION AS A QUATERNION AND MATRIX.
+        const MATH::Vector3<MATH::Angle<float>::Radians> ANGLES(
+            MATH::Angle<float>::Radians(0.4f),
+            MATH::Angle<float>::Radians(-1.1f),
+            MATH::Angle<float>::Radians(2.3f));
+        MATH::Quaternionf rotation = MATH::Quaternionf::FromEulerAngles(ANGLES);
+        MATH::Matrix4x4f rotation_matrix = MATH::Matrix4x4f::Rotation(ANGLES);
+
+        // VERIFY THE ROTATIONS MATCH.
+        const MATH::Vector3f VECTOR(1.5f, -2.0f, 3.25f);
+        MATH::Vector3f rotated_vector = rotation.Rotate(VECTOR);
+        MATH::Vector4f expected_rotated_vector = rotation_matrix * MATH::Vector4f(VECTOR.X, VECTOR.Y, VECTOR.Z, 0.0f);
+        REQUIRE(expected_rotated_vector.X == Approx(rotated_vector.X));
+        REQUIRE(expected_rotated_vector.Y == Approx(rotated_vector.Y));
+        REQUIRE(expected_rotated_vector.Z == Approx(rotated_vector.Z));
+        REQUIRE(1.0f == Approx(MATH::Quaternionf::DotProduct(rotation, rotation)));
+    }
+
+    TEST_CASE("Quaternion products compose rotations and conjugates undo them.", "[Quaternion]")
+    {
+        // COMPOSE 2 ROTATIONS.
+        MATH::Quaternionf first_rotation = MATH::Quaternionf::FromAxisAngle(
+            MATH::Vector3f::Normalize(MATH::Vector3f(1.0f, 2.0f, -0.5f)),
+            MATH::Angle<float>::Radians(0.8f));
+        MATH::Quaternionf second_rotation = MATH::Quaternionf::FromAxisAngle(
+            MATH::Vector3f(0.0f, 1.0f, 0.0f),
+            MATH::Angle<float>::Radians(-2.1f));
+        MATH::Quaternionf combined_rotation = second_rotation * first_rotation;
+
+        // VERIFY THE COMBINED ROTATION APPLIES BOTH ROTATIONS IN ORDER.
+        const MATH::Vector3f VECTOR(-0.5f, 4.0f, 1.25f);
+        MATH::Vector3f expected_rotated_vector = second_rotation.Rotate(first_rotation.Rotate(VECTOR));
+        MATH::Vector3f rotated_vector = combined_rotation.Rotate(VECTOR);
+        REQUIRE(expected_rotated_vector.X == Approx(rotated_vector.X));
+        REQUIRE(expected_rotated_vector.Y == Approx(rotated_vector.Y));
+        REQUIRE(expected_rotated_vector.Z == Approx(rotated_vector.Z));
+
+        // VERIFY THE CONJUGATE UNDOES THE ROTATION.
+        MATH::Vector3f unrotated_vector = MATH::Quaternionf::Conjugate(combined_rotation).Rotate(rotated_vector);
+        REQUIRE(VECTOR.X == Approx(unrotated_vector.X));
+        REQUIRE(VECTOR.Y == Approx(unrotated_vector.Y));
+        REQUIRE(VECTOR.Z == Approx(unrotated_vector.Z));
+    }
+
+    TEST_CASE("Quaternions can be normalized to unit length.", "[Quaternion]")
+    {
+        MATH::Quaternionf quaternion = { .W = 2.0f, .X = 0.0f, .Y = -2.0f, .Z = 1.0f };
+        MATH::Quaternionf unit_quaternion = MATH::Quaternionf::Normalize(quaternion);
+        REQUIRE(1.0f == Approx(MATH::Quaternionf::DotProduct(unit_quaternion, unit_quaternion)));
+        REQUIRE(2.0f / 3.0f == Approx(unit_quaternion.W));
+
+        MATH::Quaternionf zero_quaternion = { .W = 0.0f, .X = 0.0f, .Y = 0.0f, .Z = 0.0f };
+        REQUIRE(MATH::Quaternionf::Identity() == MATH::Quaternionf::Normalize(zero_quaternion));
+    }
+}
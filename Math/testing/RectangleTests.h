@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Math/Rectangle.h"
+
+/// A namespace for testing the code in the corresponding class.
+namespace RECTANGLE_TESTS
+{
+    TEST_CASE("A rectangle has edges and an area based on its dimensions.", "[Rectangle]")
+    {
+        MATH::Rectangleui rectangle = MATH::Rectangleui::FromLeftTopAndDimensions(2, 3, 4, 5);
+        REQUIRE(6 == rectangle.RightX());
+        REQUIRE(8 == rectangle.BottomY());
+        REQUIRE(20 == rectangle.Area());
+        REQUIRE_FALSE(rectangle.IsEmpty());
+
+        MATH::Rectangleui empty_rectangle = MATH::Rectangleui::FromLeftTopAndDimensions(2, 3, 0, 5);
+        REQUIRE(empty_rectangle.IsEmpty());
+    }
+
+    TEST_CASE("The union of rectangles bounds both rectangles.", "[Rectangle]")
+    {
+        MATH::Rectangleui rectangle_1 = MATH::Rectangleui::FromLeftTopAndDimensions(0, 0, 2, 2);
+        MATH::Rectangleui rectangle_2 = MATH::Rectangleui::FromLeftTopAndDimensions(5, 1, 3, 4);
+        MATH::Rectangleui union_rectangle = MATH::Rectangleui::Union(rectangle_1, rectangle_2);
+        REQUIRE(MATH::Rectangleui::FromLeftTopAndDimensions(0, 0, 8, 5) == union_rectangle);
+        REQUIRE(union_rectangle.Contains(rectangle_1));
+        REQUIRE(union_rectangle.Contains(rectangle_2));
+
+        // Empty rectangles don't expand the union.
+        MATH::Rectangleui empty_rectangle = MATH::Rectangleui::FromLeftTopAndDimensions(100, 100, 0, 0);
+        REQUIRE(rectangle_1 == MATH::Rectangleui::Union(rectangle_1, empty_rectangle));
+        REQUIRE(rectangle_1 == MATH::Rectangleui::Union(empty_rectangle, rectangle_1));
+    }
+
+    TEST_CASE("The intersection of rectangles is their overlapping area.", "[Rectangle]")
+    {
+        MATH::Rectangleui rectangle_1 = MATH::Rectangleui::FromLeftTopAndDimensions(0, 0, 4, 4);
+        MATH::Rectangleui rectangle_2 = MATH::Rectangleui::FromLeftTopAndDimensions(2, 3, 4, 4);
+        REQUIRE(rectangle_1.Intersects(rectangle_2));
+        REQUIRE(MATH::Rectangleui::FromLeftTopAndDimensions(2, 3, 2, 1) == MATH::Rectangleui::Intersection(rectangle_1, rectangle_2));
+
+        // Rectangles only sharing an edge don't overlap.
+        MATH::Rectangleui adjacent_rectangle = MATH::Rectangleui::FromLeftTopAndDimensions(4, 0, 4, 4);
+        REQUIRE_FALSE(rectangle_1.Intersects(adjacent_rectangle));
+        REQUIRE(MATH::Rectangleui::Intersection(rectangle_1, adjacent_rectangle).IsEmpty());
+    }
+}
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include "Math/Simd.h"
+#include "Processor/CpuFeatures.h"
+
+/// A namespace for testing the Simd class.
+namespace SIMD_TESTS
+{
+    /// The number of values processed by the test kernel, which fills entire registers for all lane counts.
+    constexpr std::size_t SIMD_TEST_VALUE_COUNT = 32;
+
+    /// Inputs to the test kernel.
+    struct SimdTestKernelInputs
+    {
+        /// Values with varied signs and magnitudes.
+        std::array<float, SIMD_TEST_VALUE_COUNT> FirstValues = {};
+        /// Values with varied signs and magnitudes.
+        std::array<float, SIMD_TEST_VALUE_COUNT> SecondValues = {};
+        /// Indices into the values in a shuffled order.
+        std::array<int32_t, SIMD_TEST_VALUE_COUNT> Indices = {};
+    };
+
+    /// Outputs from the test kernel.
+    struct SimdTestKernelOutputs
+    {
+        /// Results from arithmetic and blending.
+        std::array<float, SIMD_TEST_VALUE_COUNT> ArithmeticResults = {};
+        /// Results from gathering values.
+        std::array<float, SIMD_TEST_VALUE_COUNT> GatheredValues = {};
+        /// Results from integer conversion and arithmetic.
+        std::array<int32_t, SIMD_TEST_VALUE_COUNT> IntegerResults = {};
+        /// Bits set for values where a combined comparison mask was set.
+        uint32_t MaskBits = 0;
+        /// The number of registers for which mask lane queries were inconsistent with the mask's bits.
+        std::size_t InconsistentMaskCount = 0;
+        /// The sum of all integer-valued values (which is exact regardless of summation order).
+        float Sum = 0.0f;
+        /// The minimum of all values.
+        float Minimum = 0.0f;
+        /// The maximum of all values.
+        float Maximum = 0.0f;
+    };
+
+    /// Creates inputs for the test kernel.
+    /// @return The inputs for testing.
+    SimdTestKernelInputs CreateSimdTestKernelInputs()
+    {
+        SimdTestKernelInputs inputs;
+        for (std::size_t value_index = 0; value_index < SIMD_TEST_VALUE_COUNT; ++value_index)
+        {
+            float index = static_cast<float>(value_index);
+            inputs.FirstValues[value_index] = 10.0f * std::sin(index);
+            inputs.SecondValues[value_index] = 10.0f * std::cos(0.7f * index);
+            inputs.Indices[value_index] = static_cast<int32_t>((7 * value_index) % SIMD_TEST_VALUE_COUNT);
+        }
+        // Some values are equal to test comparisons of equal values.
+        inputs.SecondValues[3] = inputs.FirstValues[3];
+        inputs.SecondValues[20] = inputs.FirstValues[20];
+        return inputs;
+    }
+
+    /// A kernel exercising all Simd operations, written once for any lane count.
+    /// @tparam LANE_COUNT - The number of lanes in SIMD registers.
+    /// @param[in]  inputs - The inputs to the kernel.
+    /// @return The outputs of the kernel.
+    template <std::size_t LANE_COUNT>
+    SIMD_INLINE SimdTestKernelOutputs ComputeSimdTestKernel(const SimdTestKernelInputs& inputs)
+    {
+        using Floats = MATH::Simd<float, LANE_COUNT>;
+        using Integers = MATH::Simd<int32_t, LANE_COUNT>;
+
+        SimdTestKernelOutputs outputs;
+        Floats sums = 0.0f;
+        Floats minimums = inputs.FirstValues[0];
+        Floats maximums = inputs.FirstValues[0];
+        for (std::size_t value_index = 0; value_index < SIMD_TEST_VALUE_COUNT; value_index += LANE_COUNT)
+        {
+            // LOAD THE INPUTS.
+            Floats first_values = Floats::Load(&inputs.FirstValues[value_index]);
+            Floats second_values = Floats::Load(&inputs.SecondValues[value_index]);
+            Integers indices = Integers::Load(&inputs.Indices[value_index]);
+
+            // COMPUTE ARITHMETIC RESULTS.
+            Floats product_terms = first_values * second_values - first_values;
+            Floats quotient_terms = Floats::Sqrt(first_values * first_values + Floats(1.0f)) / (-second_values);
+            Floats min_max_terms = Floats::Min(first_values, second_values) + Floats::Max(first_values, Floats(2.0f));
+            auto first_values_less = (first_values < second_values);
+            Floats arithmetic_results = Floats::Blend(first_values_less, quotient_terms, product_terms) + min_max_terms;
+            arithmetic_results.Store(&outputs.ArithmeticResults[value_index]);
+
+            // COMPUTE INTEGER RESULTS.
+            Integers truncated_values = Integers::Truncate(first_values);
+            Integers integer_results = truncated_values * Integers(3) - indices + Integers(1);
+            integer_results.Store(&outputs.IntegerResults[value_index]);
+
+            // GATHER VALUES.
+            Floats gathered_values = Floats::Gather(inputs.SecondValues.data(), indices);
+            gathered_values.Store(&outputs.GatheredValues[value_index]);
+
+            // COMBINE COMPARISON MASKS.
+            auto mask = (first_values_less & ~(first_values == second_values)) | (first_values >= Floats(5.0f)) | (second_values != second_values);
+            uint32_t mask_bits = mask.ToBits();
+            outputs.MaskBits |= (mask_bits << value_index);
+            constexpr uint32_t ALL_LANES_BITS = static_cast<uint32_t>((uint64_t(1) << LANE_COUNT) - 1);
+            bool any_consistent = (mask.Any() == (0 != mask_bits));
+            bool all_consistent = (mask.All() == (ALL_LANES_BITS == mask_bits));
+            outputs.InconsistentMaskCount += !(any_consistent && all_consistent);
+
+            // ACCUMULATE VALUES FOR REDUCTIONS.
+            sums += Floats::Convert(truncated_values);
+            minimums = Floats::Min(minimums, first_values);
+            maximums = Floats::Max(maximums, second_values);
+        }
+
+        outputs.Sum = sums.ReduceAdd();
+        outputs.Minimum = minimums.ReduceMin();
+        outputs.Maximum = maximums.ReduceMax();
+        return outputs;
+    }
+
+    /// Computes the test kernel with scalar code.
+    SimdTestKernelOutputs ComputeSimdTestKernel1x(const SimdTestKernelInputs& inputs)
+    {
+        return ComputeSimdTestKernel<1>(inputs);
+    }
+
+    /// Computes the test kernel with SSE4.1 code.
+    SIMD_TARGET_SSE4 SimdTestKernelOutputs ComputeSimdTestKernel4x(const SimdTestKernelInputs& inputs)
+    {
+        return ComputeSimdTestKernel<4>(inputs);
+    }
+
+    /// Computes the test kernel with AVX2 code.
+    SIMD_TARGET_AVX2 SimdTestKernelOutputs ComputeSimdTestKernel8x(const SimdTestKernelInputs& inputs)
+    {
+        return ComputeSimdTestKernel<8>(inputs);
+    }
+
+    /// Computes the test kernel with AVX-512 code.
+    SIMD_TARGET_AVX512 SimdTestKernelOutputs ComputeSimdTestKernel16x(const SimdTestKernelInputs& inputs)
+    {
+        return ComputeSimdTestKernel<16>(inputs);
+    }
+
+    TEST_CASE("Simd lane counts match the register widths of instruction sets.", "[Simd]")
+    {
+        STATIC_REQUIRE(1 == MATH::SimdLaneCount(PROCESSOR::SimdInstructionSet::SCALAR));
+        STATIC_REQUIRE(4 == MATH::SimdLaneCount(PROCESSOR::SimdInstructionSet::SSE4));
+        STATIC_REQUIRE(8 == MATH::SimdLaneCount(PROCESSOR::SimdInstructionSet::AVX2));
+        STATIC_REQUIRE(16 == MATH::SimdLaneCount(PROCESSOR::SimdInstructionSet::AVX512));
+        STATIC_REQUIRE(sizeof(MATH::Simd8xf) == 8 * sizeof(float));
+    }
+
+    TEST_CASE("Simd kernels written once exactly match scalar results at every supported lane count.", "[Simd]")
+    {
+        // COMPUTE THE EXPECTED SCALAR RESULTS.
+        const SimdTestKernelInputs INPUTS = CreateSimdTestKernelInputs();
+        const SimdTestKernelOutputs EXPECTED_OUTPUTS = ComputeSimdTestKernel1x(INPUTS);
+        REQUIRE(0 == EXPECTED_OUTPUTS.InconsistentMaskCount);
+
+        // COMPUTE RESULTS FOR EACH SUPPORTED INSTRUCTION SET.
+        auto instruction_set = GENERATE(
+            PROCESSOR::SimdInstructionSet::SSE4,
+            PROCESSOR::SimdInstructionSet::AVX2,
+            PROCESSOR::SimdInstructionSet::AVX512);
+        bool instruction_set_supported = (instruction_set <= PROCESSOR::CpuFeatures::DetectSupportedSimdInstructionSet());
+        if (!instruction_set_supported)
+        {
+            return;
+        }
+
+        SimdTestKernelOutputs outputs;
+        switch (instruction_set)
+        {
+            case PROCESSOR::SimdInstructionSet::SSE4:
+                outputs = ComputeSimdTestKernel4x(INPUTS);
+                break;
+            case PROCESSOR::SimdInstructionSet::AVX2:
+                outputs = ComputeSimdTestKernel8x(INPUTS);
+                break;
+            case PROCESSOR::SimdInstructionSet::AVX512:
+                outputs = ComputeSimdTestKernel16x(INPUTS);
+                break;
+            default:
+                break;
+        }
+
+        // VERIFY THE RESULTS MATCH.
+        REQUIRE(EXPECTED_OUTPUTS.ArithmeticResults == outputs.ArithmeticResults);
+        REQUIRE(EXPECTED_OUTPUTS.GatheredValues == outputs.GatheredValues);
+        REQUIRE(EXPECTED_OUTPUTS.IntegerResults == outputs.IntegerResults);
+        REQUIRE(EXPECTED_OUTPUTS.MaskBits == outputs.MaskBits);
+        REQUIRE(0 == outputs.InconsistentMaskCount);
+        REQUIRE(EXPECTED_OUTPUTS.Sum == outputs.Sum);
+        REQUIRE(EXPECTED_OUTPUTS.Minimum == outputs.Minimum);
+        REQUIRE(EXPECTED_OUTPUTS.Maximum == outputs.Maximum);
+    }
+
+    TEST_CASE("Scalar Simd kernels compute expected values.", "[Simd]")
+    {
+        // COMPUTE THE KERNEL WITH SCALAR CODE.
+        const SimdTestKernelInputs INPUTS = CreateSimdTestKernelInputs();
+        const SimdTestKernelOutputs OUTPUTS = ComputeSimdTestKernel1x(INPUTS);
+
+        // VERIFY THE RESULTS AGAINST PLAIN SCALAR CODE.
+        float expected_sum = 0.0f;
+        uint32_t expected_mask_bits = 0;
+        for (std::size_t value_index = 0; value_index < SIMD_TEST_VALUE_COUNT; ++value_index)
+        {
+            float first_value = INPUTS.FirstValues[value_index];
+            float second_value = INPUTS.SecondValues[value_index];
+            int32_t truncated_value = static_cast<int32_t>(first_value);
+            expected_sum += static_cast<float>(truncated_value);
+
+            bool mask_set = (first_value < second_value) || (first_value >= 5.0f);
+            expected_mask_bits |= (static_cast<uint32_t>(mask_set) << value_index);
+
+            REQUIRE(truncated_value * 3 - INPUTS.Indices[value_index] + 1 == OUTPUTS.IntegerResults[value_index]);
+            REQUIRE(INPUTS.SecondValues[INPUTS.Indices[value_index]] == OUTPUTS.GatheredValues[value_index]);
+        }
+        REQUIRE(expected_sum == OUTPUTS.Sum);
+        REQUIRE(expected_mask_bits == OUTPUTS.MaskBits);
+        REQUIRE(*std::min_element(INPUTS.FirstValues.begin(), INPUTS.FirstValues.end()) == OUTPUTS.Minimum);
+        REQUIRE(*std::max_element(INPUTS.SecondValues.begin(), INPUTS.SecondValues.end()) == OUTPUTS.Maximum);
+    }
+}
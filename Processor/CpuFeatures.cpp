@@ -0,0 +1,164 @@
+#include "Processor/CpuFeatures.h"
+#include "Processor/SimdIntrinsics.h"
+
+namespace PROCESSOR
+{
+    /// Queries the CPU for information via the CPUID instruction.
+    /// @param[in]  leaf - The main category of information to query (placed in EAX).
+    /// @param[in]  subleaf - The subcategory of information to query (placed in ECX).
+    /// @return The resulting EAX, EBX, ECX, and EDX register values (in that order).
+    std::array<uint32_t, 4> CpuFeatures::QueryCpuid(const uint32_t leaf, const uint32_t subleaf)
+    {
+        std::array<uint32_t, 4> registers = {};
+#if _MSC_VER
+        int raw_registers[4] = {};
+        __cpuidex(raw_registers, static_cast<int>(leaf), static_cast<int>(subleaf));
+        for (std::size_t register_index = 0; register_index < registers.size(); ++register_index)
+        {
+            registers[register_index] = static_cast<uint32_t>(raw_registers[register_index]);
+        }
+#else
+        __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+        return registers;
+    }
+
+    /// Reads the extended control register indicating which register states the operating system saves.
+    /// Only valid to call if the OSXSAVE CPUID feature bit is set.
+    /// @return The value of the XCR0 register.
+    uint64_t CpuFeatures::ReadExtendedControlRegister0()
+    {
+#if _MSC_VER
+        return _xgetbv(0);
+#else
+        uint32_t low_bits = 0;
+        uint32_t high_bits = 0;
+        __asm__ volatile("xgetbv" : "=a"(low_bits), "=d"(high_bits) : "c"(0));
+        return (static_cast<uint64_t>(high_bits) << 32) | low_bits;
+#endif
+    }
+
+    /// Determines if a bit in a value is set.
+    /// @param[in]  value - The value to check.
+    /// @param[in]  bit_index - The index of the bit to check (0 being the least significant bit).
+    /// @return True if the bit is set; false otherwise.
+    bool CpuFeatures::BitSet(const uint64_t value, const unsigned int bit_index)
+    {
+        bool bit_set = (0 != (value & (1ull << bit_index)));
+        return bit_set;
+    }
+
+    /// Detects the most advanced SIMD instruction set supported by the CPU and operating system.
+    /// Both CPU support and operating system support (for saving the relevant registers) are required
+    /// since the operating system may have disabled some instruction sets.
+    /// @return The most advanced supported SIMD instruction set.
+    SimdInstructionSet CpuFeatures::DetectSupportedSimdInstructionSet()
+    {
+        // DETERMINE WHICH CPUID LEAVES ARE SUPPORTED.
+        constexpr uint32_t HIGHEST_LEAF_LEAF = 0;
+        constexpr uint32_t PROCESSOR_FEATURES_LEAF = 1;
+        constexpr uint32_t EXTENDED_FEATURES_LEAF = 7;
+        std::array<uint32_t, 4> highest_leaf_registers = QueryCpuid(HIGHEST_LEAF_LEAF, 0);
+        uint32_t highest_leaf = highest_leaf_registers[0];
+        bool processor_features_supported = (highest_leaf >= PROCESSOR_FEATURES_LEAF);
+        if (!processor_features_supported)
+        {
+            return SimdInstructionSet::SCALAR;
+        }
+
+        // CHECK FOR SSE4.1 SUPPORT.
+        // Register indices and bit positions are documented in the Intel and AMD programming manuals.
+        constexpr std::size_t EBX = 1;
+        constexpr std::size_t ECX = 2;
+        std::array<uint32_t, 4> processor_features = QueryCpuid(PROCESSOR_FEATURES_LEAF, 0);
+        bool sse4_supported = BitSet(processor_features[ECX], 19);
+        if (!sse4_supported)
+        {
+            return SimdInstructionSet::SCALAR;
+        }
+
+        // CHECK FOR AVX2 SUPPORT.
+        // The operating system must save the SSE (bit 1) and AVX (bit 2) register states for AVX to be usable.
+        bool fma_supported = BitSet(processor_features[ECX], 12);
+        bool os_saves_extended_state = BitSet(processor_features[ECX], 27);
+        bool avx_supported = BitSet(processor_features[ECX], 28);
+        bool extended_features_supported = (highest_leaf >= EXTENDED_FEATURES_LEAF);
+        if (!fma_supported || !os_saves_extended_state || !avx_supported || !extended_features_supported)
+        {
+            return SimdInstructionSet::SSE4;
+        }
+
+        constexpr uint64_t SSE_AVX_STATE_MASK = 0x6;
+        uint64_t extended_control_register_0 = ReadExtendedControlRegister0();
+        bool os_supports_avx = ((extended_control_register_0 & SSE_AVX_STATE_MASK) == SSE_AVX_STATE_MASK);
+        std::array<uint32_t, 4> extended_features = QueryCpuid(EXTENDED_FEATURES_LEAF, 0);
+        bool avx2_supported = BitSet(extended_features[EBX], 5);
+        if (!os_supports_avx || !avx2_supported)
+        {
+            return SimdInstructionSet::SSE4;
+        }
+
+        // CHECK FOR AVX-512 SUPPORT.
+        // The operating system must additionally save the opmask (bit 5) and upper ZMM register (bits 6-7) states.
+        constexpr uint64_t AVX512_STATE_MASK = 0xE0;
+        bool os_supports_avx512 = ((extended_control_register_0 & AVX512_STATE_MASK) == AVX512_STATE_MASK);
+        bool avx512_foundation_supported = BitSet(extended_features[EBX], 16);
+        if (!os_supports_avx512 || !avx512_foundation_supported)
+        {
+            return SimdInstructionSet::AVX2;
+        }
+
+        return SimdInstructionSet::AVX512;
+    }
+
+    /// Gets the SIMD instruction set that should be used for SIMD code paths.
+    /// This is the detected instruction set unless a different (supported) one has been forced.
+    /// @return The SIMD instruction set to use.
+    SimdInstructionSet CpuFeatures::GetSimdInstructionSet()
+    {
+        // DETECT THE SUPPORTED INSTRUCTION SET ONLY ONCE.
+        // CPU features don't change while running, and detection involves somewhat expensive instructions.
+        static const SimdInstructionSet SUPPORTED_SIMD_INSTRUCTION_SET = DetectSupportedSimdInstructionSet();
+
+        // USE ANY FORCED INSTRUCTION SET IF SUPPORTED.
+        if (ForcedSimdInstructionSet)
+        {
+            bool forced_instruction_set_supported = (*ForcedSimdInstructionSet <= SUPPORTED_SIMD_INSTRUCTION_SET);
+            if (forced_instruction_set_supported)
+            {
+                return *ForcedSimdInstructionSet;
+            }
+        }
+
+        return SUPPORTED_SIMD_INSTRUCTION_SET;
+    }
+
+    /// Forces a specific SIMD instruction set to be used, primarily for benchmarking or testing different code paths.
+    /// Forcing an unsupported instruction set results in the detected instruction set being used instead.
+    /// Should not be called while other threads may be executing SIMD code paths.
+    /// @param[in]  instruction_set - The instruction set to force; null to use the detected instruction set.
+    void CpuFeatures::ForceSimdInstructionSet(const std::optional<SimdInstructionSet>& instruction_set)
+    {
+        ForcedSimdInstructionSet = instruction_set;
+    }
+
+    /// Converts a SIMD instruction set to a human-readable string.
+    /// @param[in]  instruction_set - The instruction set to convert.
+    /// @return The name of the instruction set.
+    std::string CpuFeatures::ToString(const SimdInstructionSet instruction_set)
+    {
+        switch (instruction_set)
+        {
+            case SimdInstructionSet::SCALAR:
+                return "Scalar";
+            case SimdInstructionSet::SSE4:
+                return "SSE4";
+            case SimdInstructionSet::AVX2:
+                return "AVX2";
+            case SimdInstructionSet::AVX512:
+                return "AVX-512";
+            default:
+                return "Unknown";
+        }
+    }
+}
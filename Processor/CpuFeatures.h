@@ -0,0 +1,40 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include "Processor/SimdInstructionSet.h"
+
+namespace PROCESSOR
+{
+    /// Provides information about features supported by the CPU on which code is running.
+    /// This primarily exists to allow selecting the best SIMD code path at runtime
+    /// rather than requiring a binary to be compiled for a specific instruction set
+    /// (which can crash on machines without that instruction set).
+    class CpuFeatures
+    {
+    public:
+        // DETECTION.
+        static SimdInstructionSet DetectSupportedSimdInstructionSet();
+
+        // SELECTION.
+        static SimdInstructionSet GetSimdInstructionSet();
+        static void ForceSimdInstructionSet(const std::optional<SimdInstructionSet>& instruction_set);
+
+        // CONVERSION.
+        static std::string ToString(const SimdInstructionSet instruction_set);
+
+    private:
+        // HELPER METHODS.
+        static std::array<uint32_t, 4> QueryCpuid(const uint32_t leaf, const uint32_t subleaf);
+        static uint64_t ReadExtendedControlRegister0();
+        static bool BitSet(const uint64_t value, const unsigned int bit_index);
+
+        // STATIC MEMBER VARIABLES.
+        /// An instruction set forced to be used (typically for benchmarking or testing),
+        /// overriding the detected instruction set.  Forced instruction sets are still
+        /// limited to those actually supported to avoid crashing.
+        static inline std::optional<SimdInstructionSet> ForcedSimdInstructionSet = std::nullopt;
+    };
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+/// Holds code related to the processor (CPU) on which code is running.
+namespace PROCESSOR
+{
+    /// Different SIMD instruction sets that may have specialized code paths.
+    /// Values are ordered such that later instruction sets are supersets of earlier ones,
+    /// allowing simple comparisons to determine if an instruction set is supported.
+    enum class SimdInstructionSet
+    {
+        /// No SIMD instructions; portable scalar code only.
+        SCALAR = 0,
+        /// SSE4.1 instructions with 4-wide float lanes.
+        SSE4,
+        /// AVX2 (plus FMA) instructions with 8-wide float lanes.
+        AVX2,
+        /// AVX-512 foundation instructions with 16-wide float lanes.
+        AVX512,
+    };
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+/// @file
+/// Portably includes SIMD intrinsics for the current compiler.
+///
+/// SIMD code paths in these libraries are selected at runtime (see @ref PROCESSOR::CpuFeatures),
+/// so code is not expected to be compiled with global instruction set flags (like /arch:AVX2 or -mavx2).
+/// MSVC allows any intrinsics to be used without such flags, but GCC and Clang require each function
+/// using intrinsics to be marked with the instruction sets it targets.  The SIMD_TARGET_* macros
+/// below should be placed before the return type of any function that directly uses intrinsics
+/// beyond the baseline instruction set.
+///
+/// Code written generically for multiple instruction sets (like kernels using MATH::Simd for any lane count)
+/// can't be marked with a single target, so such code should be marked with SIMD_INLINE and only called
+/// from functions marked with the SIMD_TARGET_* macro for the instruction set being used.  Being inlined
+/// compiles the generic code with the instruction sets of each calling function.
+
+#if _MSC_VER
+    #include <intrin.h>
+
+    /// Marks a function as containing SSE4.1 instructions.
+    #define SIMD_TARGET_SSE4
+    /// Marks a function as containing AVX2 instructions.
+    #define SIMD_TARGET_AVX2
+    /// Marks a function as containing AVX-512 foundation instructions.
+    #define SIMD_TARGET_AVX512
+    /// Forces a function to be inlined into its callers.
+    #define SIMD_INLINE __forceinline
+#else
+    #include <cpuid.h>
+    #include <immintrin.h>
+
+    /// Marks a function as containing SSE4.1 instructions.
+    #define SIMD_TARGET_SSE4 __attribute__((target("sse4.1")))
+    /// Marks a function as containing AVX2 instructions.
+    /// FMA is deliberately not enabled so that compilers don't fuse separate multiplies and adds,
+    /// which would make AVX2 results differ in their last bits from the equivalent scalar code.
+    #define SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+    /// Marks a function as containing AVX-512 foundation instructions.
+    /// AVX-512 implies FMA, so GCC's contraction of separate multiplies and adds into fused multiply-adds
+    /// is also turned off to keep results identical to scalar code.  Clang only contracts within
+    /// a single expression by default, which doesn't fuse separate intrinsics.
+    #if __clang__
+        #define SIMD_TARGET_AVX512 __attribute__((target("avx512f,avx2")))
+    #else
+        #define SIMD_TARGET_AVX512 __attribute__((target("avx512f,avx2"), optimize("fp-contract=off")))
+    #endif
+    /// Forces a function to be inlined into its callers.
+    #define SIMD_INLINE __attribute__((always_inline)) inline
+#endif
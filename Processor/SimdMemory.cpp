@@ -0,0 +1,259 @@
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <future>
+#include <thread>
+#include <vector>
+#include "Processor/CpuFeatures.h"
+#include "Processor/SimdIntrinsics.h"
+#include "Processor/SimdMemory.h"
+
+namespace PROCESSOR
+{
+    /// Fills an array of 32-bit integers with a single value.
+    /// @param[in,out]  values - The values to fill.
+    /// @param[in]  value_count - The number of values to fill.
+    /// @param[in]  value - The value to write to each element.
+    void SimdMemory::Fill(uint32_t* const values, const std::size_t value_count, const uint32_t value)
+    {
+        FillInParallel(values, value_count, value);
+    }
+
+    /// Fills an array of floats with a single value.
+    /// @param[in,out]  values - The values to fill.
+    /// @param[in]  value_count - The number of values to fill.
+    /// @param[in]  value - The value to write to each element.
+    void SimdMemory::Fill(float* const values, const std::size_t value_count, const float value)
+    {
+        FillInParallel(values, value_count, value);
+    }
+
+    /// Fills an array of 32-bit values, splitting large arrays across multiple threads.
+    /// @param[in,out]  values - The values to fill.
+    /// @param[in]  value_count - The number of values to fill.
+    /// @param[in]  value - The value to write to each element.
+    template <typename ValueType>
+    void SimdMemory::FillInParallel(ValueType* const values, const std::size_t value_count, const ValueType value)
+    {
+        // DETERMINE HOW TO FILL THE VALUES.
+        std::size_t byte_count = value_count * sizeof(ValueType);
+        bool streaming_stores = (byte_count >= STREAMING_STORE_MIN_BYTE_COUNT);
+        std::size_t max_thread_count = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+        std::size_t thread_count = std::clamp<std::size_t>(byte_count / PARALLEL_FILL_MIN_BYTE_COUNT_PER_THREAD, 1, max_thread_count);
+        if (thread_count <= 1)
+        {
+            FillSerially(values, value_count, value, streaming_stores);
+            return;
+        }
+
+        // FILL SEPARATE PORTIONS OF THE VALUES ON EACH THREAD.
+        // Portions are whole cache lines so that threads don't write to the same cache lines.
+        constexpr std::size_t CACHE_LINE_VALUE_COUNT = 64 / sizeof(ValueType);
+        std::size_t values_per_thread = (value_count + thread_count - 1) / thread_count;
+        values_per_thread = ((values_per_thread + CACHE_LINE_VALUE_COUNT - 1) / CACHE_LINE_VALUE_COUNT) * CACHE_LINE_VALUE_COUNT;
+        std::vector<std::future<void>> thread_fills;
+        std::size_t first_value_index = 0;
+        while (first_value_index + values_per_thread < value_count)
+        {
+            thread_fills.emplace_back(std::async(
+                std::launch::async,
+                [values, first_value_index, values_per_thread, value, streaming_stores]()
+                {
+                    FillSerially(values + first_value_index, values_per_thread, value, streaming_stores);
+                }));
+            first_value_index += values_per_thread;
+        }
+
+        // The current thread fills the last portion rather than just waiting.
+        FillSerially(values + first_value_index, value_count - first_value_index, value, streaming_stores);
+        for (std::future<void>& thread_fill : thread_fills)
+        {
+            thread_fill.wait();
+        }
+    }
+
+    /// Fills an array of 32-bit values on the current thread.
+    /// @param[in,out]  values - The values to fill.
+    /// @param[in]  value_count - The number of values to fill.
+    /// @param[in]  value - The value to write to each element.
+    /// @param[in]  streaming_stores - True to use non-temporal streaming stores; false for regular stores.
+    template <typename ValueType>
+    void SimdMemory::FillSerially(ValueType* const values, const std::size_t value_count, const ValueType value, const bool streaming_stores)
+    {
+        // FILL USING SIMD IF POSSIBLE.
+        // Floats are written via their raw bits to share the same SIMD kernels as integers.
+        uint32_t value_bits = std::bit_cast<uint32_t>(value);
+        bool filled_with_simd = FillSimd(values, value_count, value_bits, streaming_stores);
+        if (filled_with_simd)
+        {
+            return;
+        }
+
+        // FALL BACK TO FILLING WITHOUT SIMD.
+        std::fill(values, values + value_count, value);
+    }
+
+    /// Attempts to fill an array of 32-bit values using the current SIMD instruction set.
+    /// @param[in,out]  values - The 32-bit values to fill.
+    /// @param[in]  value_count - The number of values to fill.
+    /// @param[in]  value_bits - The raw bits of the value to write to each element.
+    /// @param[in]  streaming_stores - True to use non-temporal streaming stores; false for regular stores.
+    /// @return True if the values were filled; false if no SIMD instruction set is in use.
+    bool SimdMemory::FillSimd(void* const values, const std::size_t value_count, const uint32_t value_bits, const bool streaming_stores)
+    {
+        SimdInstructionSet instruction_set = CpuFeatures::GetSimdInstructionSet();
+        switch (instruction_set)
+        {
+            case SimdInstructionSet::SSE4:
+                FillSse4(values, value_count, value_bits, streaming_stores);
+                return true;
+            case SimdInstructionSet::AVX2:
+                FillAvx2(values, value_count, value_bits, streaming_stores);
+                return true;
+            case SimdInstructionSet::AVX512:
+                FillAvx512(values, value_count, value_bits, streaming_stores);
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    /// Fills an array of 32-bit values 4 at a time using SSE4 instructions.
+    /// @param[in,out]  values - The 32-bit values to fill.
+    /// @param[in]  value_count - The number of values to fill.
+    /// @param[in]  value_bits - The raw bits of the value to write to each element.
+    /// @param[in]  streaming_stores - True to use non-temporal streaming stores; false for regular stores.
+    SIMD_TARGET_SSE4 void SimdMemory::FillSse4(void* const values, const std::size_t value_count, const uint32_t value_bits, const bool streaming_stores)
+    {
+        constexpr std::size_t LANE_COUNT = 4;
+        const __m128i VALUE_4X = _mm_set1_epi32(static_cast<int>(value_bits));
+        uint32_t* const destination = static_cast<uint32_t*>(values);
+        std::size_t value_index = 0;
+
+        // FILL AS MANY ALIGNED GROUPS OF VALUES AS POSSIBLE WITH STREAMING STORES.
+        // Streaming stores require aligned memory, so any leading unaligned values are filled individually.
+        // Copying raw bytes avoids aliasing issues if the values are actually floats.
+        if (streaming_stores)
+        {
+            constexpr std::size_t ALIGNMENT_IN_BYTES = sizeof(__m128i);
+            for (; value_index < value_count && (reinterpret_cast<std::uintptr_t>(destination + value_index) % ALIGNMENT_IN_BYTES); ++value_index)
+            {
+                std::memcpy(destination + value_index, &value_bits, sizeof(value_bits));
+            }
+            for (; value_index + LANE_COUNT <= value_count; value_index += LANE_COUNT)
+            {
+                _mm_stream_si128(reinterpret_cast<__m128i*>(destination + value_index), VALUE_4X);
+            }
+
+            // Streaming stores are weakly ordered, so they must be completed before other threads read the values.
+            _mm_sfence();
+        }
+
+        // FILL AS MANY FULL GROUPS OF VALUES AS POSSIBLE.
+        for (; value_index + LANE_COUNT <= value_count; value_index += LANE_COUNT)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + value_index), VALUE_4X);
+        }
+
+        // FILL ANY REMAINING VALUES.
+        for (; value_index < value_count; ++value_index)
+        {
+            std::memcpy(destination + value_index, &value_bits, sizeof(value_bits));
+        }
+    }
+
+    /// Fills an array of 32-bit values 8 at a time using AVX2 instructions.
+    /// @param[in,out]  values - The 32-bit values to fill.
+    /// @param[in]  value_count - The number of values to fill.
+    /// @param[in]  value_bits - The raw bits of the value to write to each element.
+    /// @param[in]  streaming_stores - True to use non-temporal streaming stores; false for regular stores.
+    SIMD_TARGET_AVX2 void SimdMemory::FillAvx2(void* const values, const std::size_t value_count, const uint32_t value_bits, const bool streaming_stores)
+    {
+        constexpr std::size_t LANE_COUNT = 8;
+        const __m256i VALUE_8X = _mm256_set1_epi32(static_cast<int>(value_bits));
+        uint32_t* const destination = static_cast<uint32_t*>(values);
+        std::size_t value_index = 0;
+
+        // FILL AS MANY ALIGNED GROUPS OF VALUES AS POSSIBLE WITH STREAMING STORES.
+        // Streaming stores require aligned memory, so any leading unaligned values are filled individually.
+        if (streaming_stores)
+        {
+            constexpr std::size_t ALIGNMENT_IN_BYTES = sizeof(__m256i);
+            for (; value_index < value_count && (reinterpret_cast<std::uintptr_t>(destination + value_index) % ALIGNMENT_IN_BYTES); ++value_index)
+            {
+                std::memcpy(destination + value_index, &value_bits, sizeof(value_bits));
+            }
+            for (; value_index + LANE_COUNT <= value_count; value_index += LANE_COUNT)
+            {
+                _mm256_stream_si256(reinterpret_cast<__m256i*>(destination + value_index), VALUE_8X);
+            }
+
+            // Streaming stores are weakly ordered, so they must be completed before other threads read the values.
+            _mm_sfence();
+        }
+
+        // FILL AS MANY FULL GROUPS OF VALUES AS POSSIBLE.
+        for (; value_index + LANE_COUNT <= value_count; value_index += LANE_COUNT)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + value_index), VALUE_8X);
+        }
+
+        // FILL ANY REMAINING VALUES WITH A SINGLE MASKED STORE.
+        std::size_t remaining_value_count = value_count - value_index;
+        if (remaining_value_count > 0)
+        {
+            const __m256i LANE_INDICES = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            __m256i remaining_value_mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(remaining_value_count)), LANE_INDICES);
+            _mm256_maskstore_epi32(reinterpret_cast<int*>(destination + value_index), remaining_value_mask, VALUE_8X);
+        }
+    }
+
+    /// Fills an array of 32-bit values 16 at a time using AVX-512 instructions.
+    /// @param[in,out]  values - The 32-bit values to fill.
+    /// @param[in]  value_count - The number of values to fill.
+    /// @param[in]  value_bits - The raw bits of the value to write to each element.
+    /// @param[in]  streaming_stores - True to use non-temporal streaming stores; false for regular stores.
+    SIMD_TARGET_AVX512 void SimdMemory::FillAvx512(void* const values, const std::size_t value_count, const uint32_t value_bits, const bool streaming_stores)
+    {
+        constexpr std::size_t LANE_COUNT = 16;
+        const __m512i VALUE_16X = _mm512_set1_epi32(static_cast<int>(value_bits));
+        uint32_t* const destination = static_cast<uint32_t*>(values);
+        std::size_t value_index = 0;
+
+        // FILL AS MANY ALIGNED GROUPS OF VALUES AS POSSIBLE WITH STREAMING STORES.
+        // Leading values up to the first cache line boundary are filled with a single masked store.
+        if (streaming_stores)
+        {
+            constexpr std::size_t ALIGNMENT_IN_BYTES = sizeof(__m512i);
+            std::size_t misaligned_byte_count = reinterpret_cast<std::uintptr_t>(destination) % ALIGNMENT_IN_BYTES;
+            if (misaligned_byte_count > 0)
+            {
+                std::size_t leading_value_count = std::min(value_count, (ALIGNMENT_IN_BYTES - misaligned_byte_count) / sizeof(value_bits));
+                __mmask16 leading_value_mask = static_cast<__mmask16>((1u << leading_value_count) - 1);
+                _mm512_mask_storeu_epi32(destination, leading_value_mask, VALUE_16X);
+                value_index = leading_value_count;
+            }
+            for (; value_index + LANE_COUNT <= value_count; value_index += LANE_COUNT)
+            {
+                _mm512_stream_si512(reinterpret_cast<__m512i*>(destination + value_index), VALUE_16X);
+            }
+
+            // Streaming stores are weakly ordered, so they must be completed before other threads read the values.
+            _mm_sfence();
+        }
+
+        // FILL AS MANY FULL GROUPS OF VALUES AS POSSIBLE.
+        for (; value_index + LANE_COUNT <= value_count; value_index += LANE_COUNT)
+        {
+            _mm512_storeu_si512(destination + value_index, VALUE_16X);
+        }
+
+        // FILL ANY REMAINING VALUES WITH A SINGLE MASKED STORE.
+        std::size_t remaining_value_count = value_count - value_index;
+        if (remaining_value_count > 0)
+        {
+            __mmask16 remaining_value_mask = static_cast<__mmask16>((1u << remaining_value_count) - 1);
+            _mm512_mask_storeu_epi32(destination + value_index, remaining_value_mask, VALUE_16X);
+        }
+    }
+}
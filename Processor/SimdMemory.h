@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "Processor/SimdIntrinsics.h"
+
+namespace PROCESSOR
+{
+    /// Memory operations that use the best SIMD instruction set available at runtime
+    /// (see @ref CpuFeatures::GetSimdInstructionSet), with a portable scalar fallback.
+    ///
+    /// Large fills (such as clearing entire render targets) are limited by memory bandwidth,
+    /// so they use non-temporal streaming stores that bypass the cache and are split across threads.
+    class SimdMemory
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The minimum number of bytes filled for streaming stores to be used.  Filled memory this large
+        /// wouldn't remain in cache anyway, so bypassing the cache avoids evicting more useful data.
+        static constexpr std::size_t STREAMING_STORE_MIN_BYTE_COUNT = 4 * 1024 * 1024;
+        /// The minimum number of bytes filled by each thread for a fill to be split across threads.
+        /// Smaller fills complete faster than the overhead of starting threads.
+        static constexpr std::size_t PARALLEL_FILL_MIN_BYTE_COUNT_PER_THREAD = 2 * 1024 * 1024;
+
+        // FILLING.
+        static void Fill(uint32_t* const values, const std::size_t value_count, const uint32_t value);
+        static void Fill(float* const values, const std::size_t value_count, const float value);
+
+    private:
+        // HELPER METHODS.
+        template <typename ValueType>
+        static void FillInParallel(ValueType* const values, const std::size_t value_count, const ValueType value);
+        template <typename ValueType>
+        static void FillSerially(ValueType* const values, const std::size_t value_count, const ValueType value, const bool streaming_stores);
+        static bool FillSimd(void* const values, const std::size_t value_count, const uint32_t value_bits, const bool streaming_stores);
+        SIMD_TARGET_SSE4 static void FillSse4(void* const values, const std::size_t value_count, const uint32_t value_bits, const bool streaming_stores);
+        SIMD_TARGET_AVX2 static void FillAvx2(void* const values, const std::size_t value_count, const uint32_t value_bits, const bool streaming_stores);
+        SIMD_TARGET_AVX512 static void FillAvx512(void* const values, const std::size_t value_count, const uint32_t value_bits, const bool streaming_stores);
+    };
+}
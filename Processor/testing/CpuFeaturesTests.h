@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Processor/CpuFeatures.h"
+
+/// A namespace for testing the CpuFeatures class.
+namespace CPU_FEATURES_TESTS
+{
+    TEST_CASE("The detected SIMD instruction set is used by default.", "[CpuFeatures]")
+    {
+        // GET THE INSTRUCTION SET WITHOUT FORCING ONE.
+        PROCESSOR::CpuFeatures::ForceSimdInstructionSet(std::nullopt);
+        PROCESSOR::SimdInstructionSet instruction_set = PROCESSOR::CpuFeatures::GetSimdInstructionSet();
+
+        // VERIFY THE DETECTED INSTRUCTION SET IS USED.
+        PROCESSOR::SimdInstructionSet detected_instruction_set = PROCESSOR::CpuFeatures::DetectSupportedSimdInstructionSet();
+        REQUIRE(detected_instruction_set == instruction_set);
+    }
+
+    TEST_CASE("A scalar instruction set can always be forced.", "[CpuFeatures]")
+    {
+        // FORCE THE SCALAR INSTRUCTION SET.
+        PROCESSOR::CpuFeatures::ForceSimdInstructionSet(PROCESSOR::SimdInstructionSet::SCALAR);
+        PROCESSOR::SimdInstructionSet instruction_set = PROCESSOR::CpuFeatures::GetSimdInstructionSet();
+        PROCESSOR::CpuFeatures::ForceSimdInstructionSet(std::nullopt);
+
+        // VERIFY THE SCALAR INSTRUCTION SET IS USED.
+        REQUIRE(PROCESSOR::SimdInstructionSet::SCALAR == instruction_set);
+    }
+
+    TEST_CASE("An unsupported instruction set cannot be forced.", "[CpuFeatures]")
+    {
+        // FORCE THE MOST ADVANCED INSTRUCTION SET.
+        PROCESSOR::CpuFeatures::ForceSimdInstructionSet(PROCESSOR::SimdInstructionSet::AVX512);
+        PROCESSOR::SimdInstructionSet instruction_set = PROCESSOR::CpuFeatures::GetSimdInstructionSet();
+        PROCESSOR::CpuFeatures::ForceSimdInstructionSet(std::nullopt);
+
+        // VERIFY THE INSTRUCTION SET IS LIMITED TO WHAT IS SUPPORTED.
+        PROCESSOR::SimdInstructionSet detected_instruction_set = PROCESSOR::CpuFeatures::DetectSupportedSimdInstructionSet();
+        REQUIRE(instruction_set <= detected_instruction_set);
+    }
+}
@@ -0,0 +1,4 @@
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include "CpuFeaturesTests.h"
+#include "SimdMemoryTests.h"
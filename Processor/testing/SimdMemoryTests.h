@@ -0,0 +1,92 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Processor/CpuFeatures.h"
+#include "Processor/SimdMemory.h"
+
+/// A namespace for testing the SimdMemory class.
+namespace SIMD_MEMORY_TESTS
+{
+    TEST_CASE("Filling integers writes exactly the requested values for every instruction set.", "[SimdMemory]")
+    {
+        // TEST ALL INSTRUCTION SETS.
+        // Unsupported instruction sets will fall back to supported ones.
+        auto instruction_set = GENERATE(
+            PROCESSOR::SimdInstructionSet::SCALAR,
+            PROCESSOR::SimdInstructionSet::SSE4,
+            PROCESSOR::SimdInstructionSet::AVX2,
+            PROCESSOR::SimdInstructionSet::AVX512);
+        PROCESSOR::CpuFeatures::ForceSimdInstructionSet(instruction_set);
+
+        // TEST COUNTS THAT DO AND DON'T FILL ENTIRE SIMD REGISTERS.
+        constexpr std::size_t MAX_VALUE_COUNT = 37;
+        for (std::size_t value_count = 0; value_count <= MAX_VALUE_COUNT; ++value_count)
+        {
+            // FILL A RANGE IN THE MIDDLE OF A LARGER ARRAY.
+            constexpr uint32_t ORIGINAL_VALUE = 0xDEADBEEF;
+            constexpr std::size_t START_INDEX = 1;
+            std::vector<uint32_t> values(START_INDEX + MAX_VALUE_COUNT + 1, ORIGINAL_VALUE);
+            constexpr uint32_t FILL_VALUE = 0x12345678;
+            PROCESSOR::SimdMemory::Fill(values.data() + START_INDEX, value_count, FILL_VALUE);
+
+            // VERIFY ONLY THE REQUESTED VALUES WERE FILLED.
+            for (std::size_t value_index = 0; value_index < values.size(); ++value_index)
+            {
+                bool value_filled = (START_INDEX <= value_index) && (value_index < START_INDEX + value_count);
+                uint32_t expected_value = value_filled ? FILL_VALUE : ORIGINAL_VALUE;
+                REQUIRE(expected_value == values[value_index]);
+            }
+        }
+
+        PROCESSOR::CpuFeatures::ForceSimdInstructionSet(std::nullopt);
+    }
+
+    TEST_CASE("Filling large unaligned ranges with streaming stores across threads writes exactly the requested values.", "[SimdMemory]")
+    {
+        // TEST ALL INSTRUCTION SETS.
+        auto instruction_set = GENERATE(
+            PROCESSOR::SimdInstructionSet::SCALAR,
+            PROCESSOR::SimdInstructionSet::SSE4,
+            PROCESSOR::SimdInstructionSet::AVX2,
+            PROCESSOR::SimdInstructionSet::AVX512);
+        PROCESSOR::CpuFeatures::ForceSimdInstructionSet(instruction_set);
+
+        // FILL A RANGE LARGE ENOUGH FOR STREAMING STORES AND MULTIPLE THREADS.
+        // The range starts at an unaligned address and doesn't fill entire SIMD registers.
+        constexpr std::size_t VALUE_COUNT = (2 * PROCESSOR::SimdMemory::STREAMING_STORE_MIN_BYTE_COUNT / sizeof(uint32_t)) + 7;
+        constexpr uint32_t ORIGINAL_VALUE = 0xDEADBEEF;
+        constexpr std::size_t START_INDEX = 1;
+        std::vector<uint32_t> values(START_INDEX + VALUE_COUNT + 1, ORIGINAL_VALUE);
+        constexpr uint32_t FILL_VALUE = 0x12345678;
+        PROCESSOR::SimdMemory::Fill(values.data() + START_INDEX, VALUE_COUNT, FILL_VALUE);
+
+        // VERIFY ONLY THE REQUESTED VALUES WERE FILLED.
+        REQUIRE(ORIGINAL_VALUE == values.front());
+        REQUIRE(ORIGINAL_VALUE == values.back());
+        bool all_values_filled = std::all_of(
+            values.cbegin() + START_INDEX,
+            values.cbegin() + START_INDEX + VALUE_COUNT,
+            [](const uint32_t value) { return FILL_VALUE == value; });
+        REQUIRE(all_values_filled);
+
+        PROCESSOR::CpuFeatures::ForceSimdInstructionSet(std::nullopt);
+    }
+
+    TEST_CASE("Filling floats writes the exact value.", "[SimdMemory]")
+    {
+        // FILL SOME FLOATS.
+        constexpr std::size_t VALUE_COUNT = 21;
+        std::vector<float> values(VALUE_COUNT, 0.0f);
+        constexpr float FILL_VALUE = -1.5f;
+        PROCESSOR::SimdMemory::Fill(values.data(), values.size(), FILL_VALUE);
+
+        // VERIFY ALL VALUES WERE FILLED.
+        for (float value : values)
+        {
+            REQUIRE(FILL_VALUE == value);
+        }
+    }
+}
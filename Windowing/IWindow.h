@@ -1,6 +1,8 @@
 #pragma once
 
+#include <vector>
 #include "Graphics/Images/Bitmap.h"
+#include "Math/Rectangle.h"
 
 namespace WINDOWING
 {
@@ -21,8 +23,28 @@ namespace WINDOWING
         virtual unsigned int GetHeightInPixels() const = 0;
 
         // RENDERING.
+        /// Determines if the window can be displayed to from a thread other than the one that created it
+        /// (such as a CPU swap chain's present thread).  Currently, only Win32 windows support this,
+        /// so other windows are displayed to synchronously from the thread that created them.
+        /// @return True if displaying is safe from any thread; false if only from the thread that created the window.
+        virtual bool SupportsDisplayFromAnyThread() const
+        {
+            return false;
+        }
+
         /// Displays the specified bitmap in the window.
         /// @param[in]  bitmap - The bitmap to display in the window.
         virtual void Display(const GRAPHICS::IMAGES::Bitmap& bitmap) = 0;
+        /// Displays only the changed regions of the specified bitmap in the window.
+        /// Pixels outside of the dirty rectangles must match what was last displayed in the window.
+        /// By default, the entire bitmap is displayed for windows that don't support partial updates.
+        /// @param[in]  bitmap - The bitmap to display in the window.
+        /// @param[in]  dirty_rectangles - The regions of the bitmap that changed since the last display.
+        virtual void Display(const GRAPHICS::IMAGES::Bitmap& bitmap, const std::vector<MATH::Rectangleui>& dirty_rectangles)
+        {
+            // Reference the parameter to avoid compiler warnings.
+            dirty_rectangles;
+            Display(bitmap);
+        }
     };
 }
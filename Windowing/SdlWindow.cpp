@@ -2,6 +2,7 @@
 // the larger windowing library to be used without SDL.
 #if __has_include(<SDL/SDL.h>)
 
+#include <algorithm>
 #include <cassert>
 #include "ErrorHandling/Asserts.h"
 #include "Windowing/SdlWindow.h"
@@ -108,31 +109,7 @@ namespace WINDOWING
         }
 
         // DETERMINE THE APPROPRIATE SDL PIXEL FORMAT OF THE BITMAP.
-        SDL_PixelFormatEnum sdl_source_pixel_format = SDL_PIXELFORMAT_RGBA8888;
-        GRAPHICS::ColorFormat source_color_format = bitmap.GetColorFormat();
-        switch (source_color_format)
-        {
-            case GRAPHICS::ColorFormat::RGBA:
-            {
-                sdl_source_pixel_format = SDL_PIXELFORMAT_RGBA8888;
-                break;
-            }
-            case GRAPHICS::ColorFormat::ARGB:
-            {
-                sdl_source_pixel_format = SDL_PIXELFORMAT_ARGB8888;
-                break;
-            }
-            default:
-            {
-                // USE A DEFAULT PIXEL FORMAT IF AN UNSUPPORTED FORMAT IS DETECTED.
-                constexpr bool UNSUPPORTED_COLOR_FORMAT = false;
-                ASSERT_THEN_IF(UNSUPPORTED_COLOR_FORMAT)
-                {
-                    sdl_source_pixel_format = SDL_PIXELFORMAT_RGBA8888;
-                    break;
-                }
-            }
-        }
+        SDL_PixelFormatEnum sdl_source_pixel_format = GetSdlPixelFormat(bitmap.GetColorFormat());
 
         // COPY THE BITMAP'S PIXELS TO THE WINDOW'S SURFACE.
         /// @todo   This is not fully safe.  Get minimum of dimensions?  Or scale pixels based on some sampling rate?
@@ -159,6 +136,119 @@ namespace WINDOWING
         int surface_display_return_code = SDL_UpdateWindowSurface(UnderlyingWindow);
         bool surface_displayed_successfully = (0 == surface_display_return_code);
         assert(surface_displayed_successfully);
+        LastDisplayedSurface = window_surface;
+    }
+
+    /// Displays only the changed regions of a bitmap in the window.
+    /// Only the dirty rectangles are converted to the window's pixel format and updated on screen,
+    /// which is much cheaper than displaying the entire bitmap if only small regions changed.
+    /// @param[in]  bitmap - The bitmap to display.
+    /// @param[in]  dirty_rectangles - The regions of the bitmap that changed since the last display.
+    void SdlWindow::Display(const GRAPHICS::IMAGES::Bitmap& bitmap, const std::vector<MATH::Rectangleui>& dirty_rectangles)
+    {
+        // MAKE SURE THE WINDOW SURFACE CAN BE OBTAINED.
+        SDL_Surface* window_surface = SDL_GetWindowSurface(UnderlyingWindow);
+        ASSERT_THEN_IF_NOT(window_surface)
+        {
+            return;
+        }
+
+        // DISPLAY THE ENTIRE BITMAP IF THE SURFACE DOESN'T HAVE THE PREVIOUSLY DISPLAYED PIXELS.
+        bool window_surface_recreated = (window_surface != LastDisplayedSurface);
+        if (window_surface_recreated)
+        {
+            Display(bitmap);
+            return;
+        }
+
+        // COPY THE DIRTY RECTANGLES OF THE BITMAP TO THE WINDOW'S SURFACE.
+        SDL_PixelFormatEnum sdl_source_pixel_format = GetSdlPixelFormat(bitmap.GetColorFormat());
+        MATH::Rectangleui copyable_rectangle = MATH::Rectangleui::FromLeftTopAndDimensions(
+            0,
+            0,
+            std::min(bitmap.GetWidthInPixels(), static_cast<unsigned int>(window_surface->w)),
+            std::min(bitmap.GetHeightInPixels(), static_cast<unsigned int>(window_surface->h)));
+        const uint8_t* source_bitmap_raw_bytes = reinterpret_cast<const uint8_t*>(bitmap.GetRawData());
+        unsigned int source_bitmap_row_byte_count = bitmap.GetRowByteCount();
+        uint8_t* window_surface_raw_bytes = static_cast<uint8_t*>(window_surface->pixels);
+        constexpr unsigned int SOURCE_PIXEL_BYTE_COUNT = sizeof(uint32_t);
+        unsigned int window_surface_pixel_byte_count = window_surface->format->BytesPerPixel;
+        std::vector<SDL_Rect> window_rectangles;
+        for (const MATH::Rectangleui& dirty_rectangle : dirty_rectangles)
+        {
+            // SKIP ANY PARTS OF THE RECTANGLE OUTSIDE OF THE WINDOW.
+            MATH::Rectangleui copied_rectangle = MATH::Rectangleui::Intersection(dirty_rectangle, copyable_rectangle);
+            if (copied_rectangle.IsEmpty())
+            {
+                continue;
+            }
+
+            // CONVERT THE RECTANGLE'S PIXELS.
+            const uint8_t* source_pixels = (
+                source_bitmap_raw_bytes +
+                (static_cast<std::size_t>(copied_rectangle.TopY) * source_bitmap_row_byte_count) +
+                (static_cast<std::size_t>(copied_rectangle.LeftX) * SOURCE_PIXEL_BYTE_COUNT));
+            uint8_t* window_surface_pixels = (
+                window_surface_raw_bytes +
+                (static_cast<std::size_t>(copied_rectangle.TopY) * window_surface->pitch) +
+                (static_cast<std::size_t>(copied_rectangle.LeftX) * window_surface_pixel_byte_count));
+            int pixel_copy_return_code = SDL_ConvertPixels(
+                static_cast<int>(copied_rectangle.Width),
+                static_cast<int>(copied_rectangle.Height),
+                sdl_source_pixel_format,
+                source_pixels,
+                source_bitmap_row_byte_count,
+                window_surface->format->format,
+                window_surface_pixels,
+                window_surface->pitch);
+            bool pixels_copied_successfully = (0 == pixel_copy_return_code);
+            ASSERT_THEN_IF_NOT(pixels_copied_successfully)
+            {
+                return;
+            }
+
+            window_rectangles.emplace_back(SDL_Rect
+            {
+                .x = static_cast<int>(copied_rectangle.LeftX),
+                .y = static_cast<int>(copied_rectangle.TopY),
+                .w = static_cast<int>(copied_rectangle.Width),
+                .h = static_cast<int>(copied_rectangle.Height),
+            });
+        }
+
+        // DISPLAY THE UPDATED RECTANGLES TO SCREEN.
+        // If nothing changed, the screen already has the correct image.
+        if (window_rectangles.empty())
+        {
+            return;
+        }
+        int surface_display_return_code = SDL_UpdateWindowSurfaceRects(
+            UnderlyingWindow,
+            window_rectangles.data(),
+            static_cast<int>(window_rectangles.size()));
+        bool surface_displayed_successfully = (0 == surface_display_return_code);
+        assert(surface_displayed_successfully);
+    }
+
+    /// Gets the SDL pixel format for a color format.
+    /// @param[in]  color_format - The color format to convert.
+    /// @return The corresponding SDL pixel format.
+    SDL_PixelFormatEnum SdlWindow::GetSdlPixelFormat(const GRAPHICS::ColorFormat color_format)
+    {
+        switch (color_format)
+        {
+            case GRAPHICS::ColorFormat::RGBA:
+                return SDL_PIXELFORMAT_RGBA8888;
+            case GRAPHICS::ColorFormat::ARGB:
+                return SDL_PIXELFORMAT_ARGB8888;
+            default:
+            {
+                // USE A DEFAULT PIXEL FORMAT IF AN UNSUPPORTED FORMAT IS DETECTED.
+                constexpr bool UNSUPPORTED_COLOR_FORMAT = false;
+                assert(UNSUPPORTED_COLOR_FORMAT);
+                return SDL_PIXELFORMAT_RGBA8888;
+            }
+        }
     }
 }
 
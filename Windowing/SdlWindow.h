@@ -5,15 +5,19 @@
 #if __has_include(<SDL/SDL.h>)
 
 #include <memory>
+#include <vector>
 #include <SDL/SDL_syswm.h>
 #include <SDL/SDL_video.h>
 #include "Graphics/Hardware/GraphicsDeviceType.h"
 #include "Graphics/Images/Bitmap.h"
+#include "Math/Rectangle.h"
 #include "Windowing/IWindow.h"
 
 namespace WINDOWING
 {
     /// A window using the SDL library.
+    /// SDL only supports updating window surfaces from the thread that created the window,
+    /// so the window doesn't support being displayed to from other threads.
     class SdlWindow : public IWindow
     {
     public:
@@ -33,6 +37,7 @@ namespace WINDOWING
 
         // RENDERING.
         void Display(const GRAPHICS::IMAGES::Bitmap& bitmap) override;
+        void Display(const GRAPHICS::IMAGES::Bitmap& bitmap, const std::vector<MATH::Rectangleui>& dirty_rectangles) override;
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The underlying SDL window.
@@ -45,6 +50,13 @@ namespace WINDOWING
         unsigned int HeightInPixels = 0;
         /// True if the window is open; false if not.
         bool IsOpen = false;
+        /// The window surface most recently displayed to.  SDL recreates the surface when the window
+        /// is resized, in which case the entire surface needs to be displayed again.
+        SDL_Surface* LastDisplayedSurface = nullptr;
+
+    private:
+        // HELPER METHODS.
+        static SDL_PixelFormatEnum GetSdlPixelFormat(const GRAPHICS::ColorFormat color_format);
     };
 }
 
@@ -101,6 +101,13 @@ namespace WINDOWING
         return static_cast<unsigned int>(height_in_pixels);
     }
 
+    /// Determines if the window can be displayed to from a thread other than the one that created it.
+    /// @return True since GDI allows drawing to a window's device context from any thread.
+    bool Win32Window::SupportsDisplayFromAnyThread() const
+    {
+        return true;
+    }
+
     /// Displays the provided bitmap in the window.
     /// @param[in]  bitmap - The bitmap to display.
     void Win32Window::Display(const GRAPHICS::IMAGES::Bitmap& bitmap)
@@ -30,6 +30,7 @@ namespace WINDOWING
         unsigned int GetHeightInPixels() const override;
 
         // RENDERING.
+        bool SupportsDisplayFromAnyThread() const override;
         void Display(const GRAPHICS::IMAGES::Bitmap& bitmap) override;
         void DisplayAt(const GRAPHICS::IMAGES::Bitmap& bitmap, int left_x, int top_y);
 
@@ -259,12 +259,40 @@ int main()
     };
     build.Add(&input_control_library);
 
+    Project processor_library = 
+    {
+        .Type = ProjectType::LIBRARY,
+        .Name = "Processor",
+        .CodeFolderPath = workspace_folder_path / "Processor",
+        .UnityBuildFilepath = workspace_folder_path / "Processor/Processor.project",
+        .LinkerLibraryNames = { "Processor.lib" },
+    };
+    build.Add(&processor_library);
+
+    Project processor_tests = 
+    {
+        .Type = ProjectType::PROGRAM,
+        .Name = "ProcessorTests",
+        .CodeFolderPath = workspace_folder_path / "Processor/testing",
+        .UnityBuildFilepath = workspace_folder_path / "Processor/testing/ProcessorTests.cpp",
+        .Libraries = 
+        { 
+            &catch_library,
+            &processor_library 
+        },
+    };
+    build.Add(&processor_tests);
+
     Project math_library = 
     {
         .Type = ProjectType::LIBRARY,
         .Name = "Math",
         .CodeFolderPath = workspace_folder_path / "Math",
         .UnityBuildFilepath = workspace_folder_path / "Math/Math.project",
+        .Libraries = 
+        {
+            &processor_library,
+        },
         .LinkerLibraryNames = { "Math.lib" },
     };
     build.Add(&math_library);
@@ -349,6 +377,7 @@ int main()
             &stb_library,
             &math_library,
             &memory_library,
+            &processor_library,
             &filesystem_library,
             &string_library,
             &windowing_library,